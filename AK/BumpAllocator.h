@@ -78,6 +78,10 @@ public:
                 kfree_sized((void*)chunk, m_chunk_size);
             }
         });
+
+        m_head_chunk = 0;
+        m_current_chunk = 0;
+        m_byte_offset_into_current_chunk = 0;
     }
 
 protected:
@@ -180,13 +184,11 @@ public:
     {
         this->for_each_chunk([&](auto chunk) {
             auto base_ptr = align_up_to(chunk + sizeof(typename Allocator::ChunkHeader), alignof(T));
-            // Compute the offset of the first byte *after* this chunk:
-            FlatPtr end_offset = base_ptr + this->m_chunk_size - chunk - sizeof(typename Allocator::ChunkHeader);
+            // Every chunk but the current one was filled with as many objects as would fit before moving on to the next.
+            FlatPtr end_offset = this->m_chunk_size;
             if (chunk == this->m_current_chunk)
                 end_offset = this->m_byte_offset_into_current_chunk;
-            // Compute the offset of the first byte *after* the last valid object, in case the end of the chunk does not align with the end of an object:
-            end_offset = (end_offset / sizeof(T)) * sizeof(T);
-            for (; base_ptr - chunk < end_offset; base_ptr += sizeof(T))
+            for (; base_ptr - chunk + sizeof(T) <= end_offset; base_ptr += sizeof(T))
                 reinterpret_cast<T*>(base_ptr)->~T();
         });
     }
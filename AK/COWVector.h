@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/Vector.h>
 
@@ -19,10 +20,8 @@ class COWVector {
     };
 
 public:
-    COWVector()
-        : m_detail(make_ref_counted<Detail>())
-    {
-    }
+    // NOTE: The storage is only allocated once something is written, so empty vectors are free to create and copy.
+    COWVector() = default;
 
     COWVector(std::initializer_list<T> entries)
         : m_detail(make_ref_counted<Detail>())
@@ -39,6 +38,8 @@ public:
 
     Vector<T> release() &&
     {
+        if (!m_detail)
+            return {};
         if (m_detail->ref_count() == 1)
             return exchange(m_detail->m_members, Vector<T>());
 
@@ -71,7 +72,7 @@ public:
     void extend(COWVector<T> const& values)
     {
         copy();
-        m_detail->m_members.extend(values.m_detail->m_members);
+        m_detail->m_members.extend(values.members());
     }
 
     void resize(size_t size)
@@ -82,7 +83,7 @@ public:
 
     void ensure_capacity(size_t capacity)
     {
-        if (m_detail->m_members.capacity() >= capacity)
+        if (this->capacity() >= capacity)
             return;
 
         copy();
@@ -104,12 +105,24 @@ public:
 
     void clear()
     {
+        if (!m_detail)
+            return;
         if (m_detail->ref_count() > 1)
-            m_detail = make_ref_counted<Detail>();
+            m_detail = nullptr;
         else
             m_detail->m_members.clear();
     }
 
+    void clear_with_capacity()
+    {
+        if (!m_detail)
+            return;
+        if (m_detail->ref_count() > 1)
+            m_detail = nullptr;
+        else
+            m_detail->m_members.clear_with_capacity();
+    }
+
     T& mutable_at(size_t index)
     {
         // We're handing out a mutable reference, so make sure we own the data exclusively.
@@ -119,42 +132,52 @@ public:
 
     T const& at(size_t index) const
     {
-        return m_detail->m_members.at(index);
+        return members().at(index);
     }
 
     T const& operator[](size_t index) const
     {
-        return m_detail->m_members[index];
+        return members()[index];
     }
 
     size_t capacity() const
     {
-        return m_detail->m_members.capacity();
+        return members().capacity();
     }
 
     size_t size() const
     {
-        return m_detail->m_members.size();
+        return members().size();
     }
 
     bool is_empty() const
     {
-        return m_detail->m_members.is_empty();
+        return members().is_empty();
     }
 
     T const& first() const
     {
-        return m_detail->m_members.first();
+        return members().first();
     }
 
     T const& last() const
     {
-        return m_detail->m_members.last();
+        return members().last();
     }
 
 private:
+    Vector<T> const& members() const
+    {
+        static Vector<T> const s_empty;
+        return m_detail ? m_detail->m_members : s_empty;
+    }
+
     void copy()
     {
+        if (!m_detail) {
+            m_detail = make_ref_counted<Detail>();
+            return;
+        }
         if (m_detail->ref_count() <= 1)
             return;
         auto new_detail = make_ref_counted<Detail>();
@@ -162,7 +185,7 @@ private:
         m_detail = new_detail;
     }
 
-    NonnullRefPtr<Detail> m_detail;
+    RefPtr<Detail> m_detail;
 };
 
 }
@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/FlyString.h>
-#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/ScopeGuard.h>
 #include <AK/Singleton.h>
 #include <AK/String.h>
 #include <AK/StringData.h>
@@ -20,20 +22,75 @@ struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
     static bool equals(Detail::StringData const* a, Detail::StringData const* b) { return *a == *b; }
 };
 
+// The interning table is split into shards by hash, each behind its own lock, so that threads interning different
+// strings rarely have to wait for each other. Without contention, taking a lock is a single atomic exchange.
+class FlyStringTable {
+public:
+    class Shard {
+    public:
+        using Table = HashTable<Detail::StringData const*, FlyStringTableHashTraits>;
+
+        template<typename Callback>
+        decltype(auto) with_locked_table(Callback callback)
+        {
+            while (m_locked.exchange(true, memory_order_acquire)) {
+                while (m_locked.load(memory_order_relaxed))
+                    sched_yield();
+            }
+            ScopeGuard unlock = [this] { m_locked.store(false, memory_order_release); };
+            return callback(m_table);
+        }
+
+    private:
+        Atomic<bool> m_locked { false };
+        Table m_table;
+    };
+
+    Shard& shard_for_hash(u32 hash) { return m_shards[hash % shard_count]; }
+
+    size_t size()
+    {
+        size_t size = 0;
+        for (auto& shard : m_shards)
+            size += shard.with_locked_table([](auto& table) { return table.size(); });
+        return size;
+    }
+
+private:
+    static constexpr size_t shard_count = 32;
+
+    struct alignas(64) AlignedShard : public Shard {
+    };
+    Array<AlignedShard, shard_count> m_shards;
+};
+
 static auto& all_fly_strings()
 {
-    static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
+    static Singleton<FlyStringTable> table;
     return *table;
 }
 
+template<typename Predicate>
+static RefPtr<Detail::StringData const> find_fly_string_data(u32 hash, Predicate predicate)
+{
+    return all_fly_strings().shard_for_hash(hash).with_locked_table([&](auto& table) -> RefPtr<Detail::StringData const> {
+        // A fly string whose last reference is already gone stays in the table until its destructor removes it, so
+        // only consider the entries we can still take a reference to.
+        auto it = table.find(hash, [&](auto* entry) { return predicate(*entry) && entry->try_ref_fly_string(); });
+        if (it == table.end())
+            return nullptr;
+        return adopt_ref(**it);
+    });
+}
+
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
 {
     if (string.is_empty())
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto string_data = find_fly_string_data(string.hash(), [&](auto& entry) { return entry.bytes_as_string_view() == string; }))
+        return FlyString { Detail::StringBase(string_data.release_nonnull()) };
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -43,8 +100,8 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto string_data = find_fly_string_data(StringView(string).hash(), [&](auto& entry) { return entry.bytes_as_string_view() == string; }))
+        return FlyString { Detail::StringBase(string_data.release_nonnull()) };
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -60,15 +117,17 @@ FlyString::FlyString(String const& string)
         return;
     }
 
-    auto it = all_fly_strings().find(string.m_data);
-    if (it == all_fly_strings().end()) {
-        m_data = string;
-        all_fly_strings().set(string.m_data);
-        string.m_data->set_fly_string(true);
-    } else {
-        m_data.m_data = *it;
-        m_data.m_data->ref();
-    }
+    auto& string_data = *string.m_data;
+    all_fly_strings().shard_for_hash(string_data.hash()).with_locked_table([&](auto& table) {
+        auto it = table.find(string_data.hash(), [&](auto* entry) { return *entry == string_data && entry->try_ref_fly_string(); });
+        if (it == table.end()) {
+            string_data.set_fly_string(true);
+            table.set(&string_data);
+            m_data = string;
+        } else {
+            m_data.m_data = *it;
+        }
+    });
 }
 
 FlyString& FlyString::operator=(String const& string)
@@ -135,7 +194,12 @@ bool FlyString::operator==(char const* string) const
 
 void FlyString::did_destroy_fly_string_data(Badge<Detail::StringData>, Detail::StringData const& string_data)
 {
-    all_fly_strings().remove(&string_data);
+    all_fly_strings().shard_for_hash(string_data.hash()).with_locked_table([&](auto& table) {
+        // Another fly string with the same contents may have replaced this one in the meantime, so only remove our own entry.
+        auto it = table.find(string_data.hash(), [&](auto* entry) { return entry == &string_data; });
+        if (it != table.end())
+            table.remove(it);
+    });
 }
 
 Detail::StringBase FlyString::data(Badge<String>) const
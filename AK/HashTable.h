@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/Concepts.h>
 #include <AK/Error.h>
 #include <AK/ReverseIterator.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StdLibExtras.h>
 #include <AK/Traits.h>
 #include <AK/Types.h>
@@ -28,15 +30,38 @@ enum class HashSetExistingEntryBehavior {
     Replace,
 };
 
-// BucketState doubles as both an enum and a probe length value.
-// - Free: empty bucket
-// - Used (implicit, values 1..254): value-1 represents probe length
-// - CalculateLength: same as Used but probe length > 253, so we calculate the actual probe length
-enum class BucketState : u8 {
-    Free = 0,
-    CalculateLength = 255,
+namespace Detail {
+
+// Every bucket has a control byte, and those live in their own array so that a lookup can check a whole group of
+// buckets at once without touching the buckets themselves.
+// - Empty: the bucket has been free since the last rehash, so a probe sequence can stop here
+// - Deleted: the bucket's value was removed, but probe sequences have to continue past it
+// - Used (0..127): the bucket holds a value, and the control byte holds 7 bits of its hash
+class HashTableControlGroup {
+public:
+    static constexpr size_t width = 16;
+
+    static constexpr u8 Empty = 0x80;
+    static constexpr u8 Deleted = 0xfe;
+
+    static constexpr bool is_used(u8 control) { return (control & 0x80) == 0; }
+
+    explicit HashTableControlGroup(u8 const* control)
+        : m_control(SIMD::load_unaligned<SIMD::i8x16>(control))
+    {
+    }
+
+    // Each of these returns a mask with bit N set if the Nth control byte in the group matches.
+    u16 match(u8 hash_bits) const { return SIMD::maskbits(bit_cast<SIMD::i8x16>(m_control == static_cast<i8>(hash_bits))); }
+    u16 match_empty() const { return match(Empty); }
+    u16 match_empty_or_deleted() const { return SIMD::maskbits(bit_cast<SIMD::i8x16>(m_control < 0)); }
+
+private:
+    SIMD::i8x16 m_control;
 };
 
+}
+
 template<typename HashTableType, typename T, typename BucketType>
 class HashTableIterator {
     friend HashTableType;
@@ -55,20 +80,23 @@ private:
             return;
         do {
             ++m_bucket;
+            ++m_control;
             if (m_bucket == m_end_bucket) {
                 m_bucket = nullptr;
                 return;
             }
-        } while (m_bucket->state == BucketState::Free);
+        } while (!Detail::HashTableControlGroup::is_used(*m_control));
     }
 
-    HashTableIterator(BucketType* bucket, BucketType* end_bucket)
+    HashTableIterator(BucketType* bucket, u8 const* control, BucketType* end_bucket)
         : m_bucket(bucket)
+        , m_control(control)
         , m_end_bucket(end_bucket)
     {
     }
 
     BucketType* m_bucket { nullptr };
+    u8 const* m_control { nullptr };
     BucketType* m_end_bucket { nullptr };
 };
 
@@ -85,7 +113,7 @@ public:
     void operator--() { m_bucket = m_bucket->previous; }
 
 private:
-    OrderedHashTableIterator(BucketType* bucket, BucketType*)
+    OrderedHashTableIterator(BucketType* bucket)
         : m_bucket(bucket)
     {
     }
@@ -117,14 +145,17 @@ private:
 // A set datastructure based on a hash table with closed hashing.
 // HashTable can optionally provide ordered iteration when IsOrdered = true.
 // For a (more commonly required) map datastructure with key-value entries, see HashMap.
+//
+// The layout follows the "Swiss table" design: the capacity is a power of two, and next to the buckets there is an
+// array of control bytes holding 7 bits of each value's hash. Lookups compare a group of 16 control bytes at once,
+// and only look at buckets whose control byte matched.
 template<typename T, typename TraitsForT, bool IsOrdered>
 class HashTable {
-    static constexpr size_t grow_capacity_at_least = 8;
-    static constexpr size_t grow_at_load_factor_percent = 80;
-    static constexpr size_t grow_capacity_increase_percent = 60;
+    using ControlGroup = Detail::HashTableControlGroup;
+
+    static constexpr size_t minimum_capacity = 8;
 
     struct Bucket {
-        BucketState state;
         alignas(T) u8 storage[sizeof(T)];
         T* slot() { return reinterpret_cast<T*>(storage); }
         T const* slot() const { return reinterpret_cast<T const*>(storage); }
@@ -133,7 +164,6 @@ class HashTable {
     struct OrderedBucket {
         OrderedBucket* previous;
         OrderedBucket* next;
-        BucketState state;
         alignas(T) u8 storage[sizeof(T)];
         T* slot() { return reinterpret_cast<T*>(storage); }
         T const* slot() const { return reinterpret_cast<T const*>(storage); }
@@ -161,8 +191,9 @@ public:
             return;
 
         if constexpr (!IsTriviallyDestructible<T>) {
+            auto const* control = this->control();
             for (size_t i = 0; i < m_capacity; ++i) {
-                if (m_buckets[i].state != BucketState::Free)
+                if (ControlGroup::is_used(control[i]))
                     m_buckets[i].slot()->~T();
             }
         }
@@ -188,9 +219,11 @@ public:
         : m_buckets(other.m_buckets)
         , m_collection_data(other.m_collection_data)
         , m_size(other.m_size)
+        , m_deleted_count(other.m_deleted_count)
         , m_capacity(other.m_capacity)
     {
         other.m_size = 0;
+        other.m_deleted_count = 0;
         other.m_capacity = 0;
         other.m_buckets = nullptr;
         if constexpr (IsOrdered)
@@ -208,6 +241,7 @@ public:
     {
         swap(a.m_buckets, b.m_buckets);
         swap(a.m_size, b.m_size);
+        swap(a.m_deleted_count, b.m_deleted_count);
         swap(a.m_capacity, b.m_capacity);
 
         if constexpr (IsOrdered)
@@ -235,10 +269,10 @@ public:
     {
         // The user usually expects "capacity" to mean the number of values that can be stored in a
         // container without it needing to reallocate. Our definition of "capacity" is the number of
-        // buckets we can store, but we reallocate earlier because of `grow_at_load_factor_percent`.
+        // buckets we can store, but we reallocate earlier because of `max_load_for_capacity()`.
         // This calculates the required internal capacity to store `capacity` number of values.
-        size_t required_capacity = capacity * 100 / grow_at_load_factor_percent + 1;
-        if (required_capacity <= m_capacity)
+        size_t required_capacity = (capacity * 8 + 6) / 7;
+        if (max_load_for_capacity(m_capacity) >= capacity + m_deleted_count)
             return {};
         return try_rehash(required_capacity);
     }
@@ -265,18 +299,14 @@ public:
     [[nodiscard]] Iterator begin()
     {
         if constexpr (IsOrdered)
-            return Iterator(m_collection_data.head, end_bucket());
-
-        for (size_t i = 0; i < m_capacity; ++i) {
-            if (m_buckets[i].state != BucketState::Free)
-                return Iterator(&m_buckets[i], end_bucket());
-        }
-        return end();
+            return Iterator(m_collection_data.head);
+        else
+            return iterator_for_bucket<Iterator>(first_used_bucket());
     }
 
     [[nodiscard]] Iterator end()
     {
-        return Iterator(nullptr, nullptr);
+        return iterator_for_bucket<Iterator>(nullptr);
     }
 
     using ConstIterator = Conditional<IsOrdered,
@@ -286,18 +316,14 @@ public:
     [[nodiscard]] ConstIterator begin() const
     {
         if constexpr (IsOrdered)
-            return ConstIterator(m_collection_data.head, end_bucket());
-
-        for (size_t i = 0; i < m_capacity; ++i) {
-            if (m_buckets[i].state != BucketState::Free)
-                return ConstIterator(&m_buckets[i], end_bucket());
-        }
-        return end();
+            return ConstIterator(m_collection_data.head);
+        else
+            return iterator_for_bucket<ConstIterator>(first_used_bucket());
     }
 
     [[nodiscard]] ConstIterator end() const
     {
-        return ConstIterator(nullptr, nullptr);
+        return iterator_for_bucket<ConstIterator>(nullptr);
     }
 
     using ReverseIterator = Conditional<IsOrdered,
@@ -346,11 +372,12 @@ public:
         if (m_capacity == 0)
             return;
         if constexpr (!IsTriviallyDestructible<T>) {
-            for (auto* bucket : *this)
-                bucket->~T();
+            for (auto& value : *this)
+                value.~T();
         }
-        __builtin_memset(m_buckets, 0, size_in_bytes(m_capacity));
+        __builtin_memset(control(), ControlGroup::Empty, control_size_in_bytes(m_capacity));
         m_size = 0;
+        m_deleted_count = 0;
 
         if constexpr (IsOrdered)
             m_collection_data = { nullptr, nullptr };
@@ -359,8 +386,11 @@ public:
     template<typename U = T>
     ErrorOr<HashSetResult> try_set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
     {
-        if (should_grow())
-            TRY(try_rehash(m_capacity * (100 + grow_capacity_increase_percent) / 100));
+        if (should_grow()) {
+            // If deleted buckets take up enough of the space, it's enough to clear them out by rehashing in place.
+            auto new_capacity = (m_size + 1) * 2 <= max_load_for_capacity(m_capacity) ? m_capacity : m_capacity * 2;
+            TRY(try_rehash(new_capacity));
+        }
 
         return write_value(forward<U>(value), existing_entry_behavior);
     }
@@ -373,7 +403,7 @@ public:
     template<typename TUnaryPredicate>
     [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
     {
-        return Iterator(lookup_with_hash(hash, move(predicate)), end_bucket());
+        return iterator_for_bucket<Iterator>(lookup_with_hash(hash, move(predicate)));
     }
 
     [[nodiscard]] Iterator find(T const& value)
@@ -386,7 +416,7 @@ public:
     template<typename TUnaryPredicate>
     [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
     {
-        return ConstIterator(lookup_with_hash(hash, move(predicate)), end_bucket());
+        return iterator_for_bucket<ConstIterator>(lookup_with_hash(hash, move(predicate)));
     }
 
     [[nodiscard]] ConstIterator find(T const& value) const
@@ -463,17 +493,15 @@ public:
     bool remove_all_matching(TUnaryPredicate const& predicate)
     {
         bool has_removed_anything = false;
+        auto const* control = this->control();
         for (size_t i = 0; i < m_capacity; ++i) {
             auto& bucket = m_buckets[i];
-            if (bucket.state == BucketState::Free || !predicate(*bucket.slot()))
+            if (!ControlGroup::is_used(control[i]) || !predicate(*bucket.slot()))
                 continue;
 
+            // Deleting never moves other buckets around, so we can just carry on with the next index.
             delete_bucket(bucket);
             has_removed_anything = true;
-
-            // If a bucket was shifted up, reevaluate this bucket index
-            if (bucket.state != BucketState::Free)
-                --i;
         }
         return has_removed_anything;
     }
@@ -506,37 +534,82 @@ public:
     }
 
 private:
-    bool should_grow() const { return ((m_size + 1) * 100) >= (m_capacity * grow_at_load_factor_percent); }
-    static constexpr size_t size_in_bytes(size_t capacity) { return sizeof(BucketType) * capacity; }
+    // We keep at least one in eight buckets empty, so that every probe sequence is guaranteed to end.
+    static constexpr size_t max_load_for_capacity(size_t capacity) { return capacity - capacity / 8; }
+    bool should_grow() const { return m_size + m_deleted_count + 1 > max_load_for_capacity(m_capacity); }
+
+    // The control bytes of the first group are mirrored after the last one, so a group can be loaded starting at any
+    // bucket without having to wrap around.
+    static constexpr size_t control_size_in_bytes(size_t capacity) { return capacity + ControlGroup::width; }
+    static constexpr size_t size_in_bytes(size_t capacity) { return sizeof(BucketType) * capacity + control_size_in_bytes(capacity); }
 
-    BucketType* end_bucket()
+    // The control bytes are stored right after the buckets, in the same allocation.
+    u8* control() { return reinterpret_cast<u8*>(m_buckets + m_capacity); }
+    u8 const* control() const { return reinterpret_cast<u8 const*>(m_buckets + m_capacity); }
+
+    void set_control(size_t index, u8 value)
     {
-        if constexpr (IsOrdered)
-            return m_collection_data.tail;
-        else
-            return &m_buckets[m_capacity];
+        auto* control = this->control();
+        control[index] = value;
+        for (size_t mirror_index = index + m_capacity; mirror_index < m_capacity + ControlGroup::width - 1; mirror_index += m_capacity)
+            control[mirror_index] = value;
+    }
+
+    // The hash traits don't always mix their input well (e.g. pointers with their alignment bits), so we spread the
+    // hash over 64 bits first. The upper half picks the first bucket to probe, and the 7 bits below it become the tag
+    // we store in the control byte.
+    static ALWAYS_INLINE u64 mix_hash(unsigned hash) { return static_cast<u64>(hash) * 0x9e3779b97f4a7c15ull; }
+    ALWAYS_INLINE size_t probe_start(u64 mixed_hash) const { return static_cast<size_t>(mixed_hash >> 32) & (m_capacity - 1); }
+    static ALWAYS_INLINE u8 control_tag(u64 mixed_hash) { return static_cast<u8>(mixed_hash >> 25) & 0x7f; }
+
+    // Probes visit whole groups, moving ahead by one more group each time. Since the capacity is a power of two, this
+    // visits every group before returning to the first one.
+    ALWAYS_INLINE size_t next_probe_position(size_t position, size_t& stride) const
+    {
+        stride += ControlGroup::width;
+        return (position + stride) & (m_capacity - 1);
     }
-    BucketType const* end_bucket() const
+
+    template<typename IteratorType>
+    IteratorType iterator_for_bucket(BucketType* bucket) const
+    {
+        if constexpr (IsOrdered) {
+            return IteratorType(bucket);
+        } else {
+            if (!bucket)
+                return IteratorType(nullptr, nullptr, nullptr);
+            return IteratorType(bucket, control() + (bucket - m_buckets), &m_buckets[m_capacity]);
+        }
+    }
+
+    BucketType* first_used_bucket() const
     {
-        return const_cast<HashTable*>(this)->end_bucket();
+        auto const* control = this->control();
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (ControlGroup::is_used(control[i]))
+                return &m_buckets[i];
+        }
+        return nullptr;
     }
 
     ErrorOr<void> try_rehash(size_t new_capacity)
     {
-        new_capacity = max(new_capacity, m_capacity + grow_capacity_at_least);
-        new_capacity = kmalloc_good_size(size_in_bytes(new_capacity)) / sizeof(BucketType);
-        VERIFY(new_capacity >= size());
+        new_capacity = max(new_capacity, minimum_capacity);
+        new_capacity = static_cast<size_t>(1) << count_required_bits(new_capacity - 1);
+        VERIFY(max_load_for_capacity(new_capacity) >= size());
 
         auto* old_buckets = m_buckets;
         auto old_buckets_size = size_in_bytes(m_capacity);
         Iterator old_iter = begin();
 
-        auto* new_buckets = kcalloc(1, size_in_bytes(new_capacity));
+        auto* new_buckets = kmalloc(size_in_bytes(new_capacity));
         if (!new_buckets)
             return Error::from_errno(ENOMEM);
 
         m_buckets = static_cast<BucketType*>(new_buckets);
         m_capacity = new_capacity;
+        m_deleted_count = 0;
+        __builtin_memset(control(), ControlGroup::Empty, control_size_in_bytes(m_capacity));
 
         if constexpr (IsOrdered)
             m_collection_data = { nullptr, nullptr };
@@ -546,7 +619,7 @@ private:
 
         m_size = 0;
         for (auto it = move(old_iter); it != end(); ++it) {
-            write_value(move(*it), HashSetExistingEntryBehavior::Keep);
+            insert_new_value(TraitsForT::hash(*it), move(*it));
             it->~T();
         }
 
@@ -564,162 +637,83 @@ private:
         if (is_empty())
             return nullptr;
 
-        hash %= m_capacity;
+        auto mixed_hash = mix_hash(hash);
+        auto tag = control_tag(mixed_hash);
+        auto const* control = this->control();
+        auto position = probe_start(mixed_hash);
+        size_t stride = 0;
         for (;;) {
-            auto* bucket = &m_buckets[hash];
-            if (bucket->state == BucketState::Free)
+            ControlGroup group { control + position };
+            for (auto matches = group.match(tag); matches != 0; matches &= matches - 1) {
+                auto* bucket = &m_buckets[(position + count_trailing_zeroes(matches)) & (m_capacity - 1)];
+                if (predicate(*bucket->slot()))
+                    return bucket;
+            }
+            if (group.match_empty() != 0)
                 return nullptr;
-            if (predicate(*bucket->slot()))
-                return bucket;
-            if (++hash == m_capacity) [[unlikely]]
-                hash = 0;
+            position = next_probe_position(position, stride);
         }
     }
 
-    size_t used_bucket_probe_length(BucketType const& bucket) const
+    template<typename U = T>
+    HashSetResult write_value(U&& value, HashSetExistingEntryBehavior existing_entry_behavior)
     {
-        VERIFY(bucket.state != BucketState::Free);
-
-        if (bucket.state == BucketState::CalculateLength) {
-            size_t ideal_bucket_index = TraitsForT::hash(*bucket.slot()) % m_capacity;
-
-            VERIFY(&bucket >= m_buckets);
-            size_t actual_bucket_index = &bucket - m_buckets;
-
-            if (actual_bucket_index < ideal_bucket_index)
-                return m_capacity + actual_bucket_index - ideal_bucket_index;
-            return actual_bucket_index - ideal_bucket_index;
+        auto hash = TraitsForT::hash(value);
+        auto* bucket = lookup_with_hash(hash, [&](auto& entry) { return TraitsForT::equals(entry, static_cast<T const&>(value)); });
+        if (bucket) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace) {
+                (*bucket->slot()) = forward<U>(value);
+                return HashSetResult::ReplacedExistingEntry;
+            }
+            return HashSetResult::KeptExistingEntry;
         }
 
-        return static_cast<u8>(bucket.state) - 1;
-    }
-
-    ALWAYS_INLINE constexpr BucketState bucket_state_for_probe_length(size_t probe_length)
-    {
-        if (probe_length > 253)
-            return BucketState::CalculateLength;
-        return static_cast<BucketState>(probe_length + 1);
+        insert_new_value(hash, forward<U>(value));
+        return HashSetResult::InsertedNewEntry;
     }
 
+    // The caller has to make sure that the value is not in the table yet, and that there is room for it.
     template<typename U = T>
-    HashSetResult write_value(U&& value, HashSetExistingEntryBehavior existing_entry_behavior)
+    void insert_new_value(unsigned hash, U&& value)
     {
-        auto update_collection_for_new_bucket = [&](BucketType& bucket) {
-            if constexpr (IsOrdered) {
-                if (!m_collection_data.head) [[unlikely]] {
-                    m_collection_data.head = &bucket;
-                } else {
-                    bucket.previous = m_collection_data.tail;
-                    m_collection_data.tail->next = &bucket;
-                }
-                m_collection_data.tail = &bucket;
-            }
-        };
-        auto update_collection_for_swapped_buckets = [&](BucketType* left_bucket, BucketType* right_bucket) {
-            if constexpr (IsOrdered) {
-                if (m_collection_data.head == left_bucket)
-                    m_collection_data.head = right_bucket;
-                else if (m_collection_data.head == right_bucket)
-                    m_collection_data.head = left_bucket;
-                if (m_collection_data.tail == left_bucket)
-                    m_collection_data.tail = right_bucket;
-                else if (m_collection_data.tail == right_bucket)
-                    m_collection_data.tail = left_bucket;
-
-                if (left_bucket->previous) {
-                    if (left_bucket->previous == left_bucket)
-                        left_bucket->previous = right_bucket;
-                    left_bucket->previous->next = left_bucket;
-                }
-                if (left_bucket->next) {
-                    if (left_bucket->next == left_bucket)
-                        left_bucket->next = right_bucket;
-                    left_bucket->next->previous = left_bucket;
-                }
-
-                if (right_bucket->previous && right_bucket->previous != left_bucket)
-                    right_bucket->previous->next = right_bucket;
-                if (right_bucket->next && right_bucket->next != left_bucket)
-                    right_bucket->next->previous = right_bucket;
-            }
-        };
-
-        auto bucket_index = TraitsForT::hash(value) % m_capacity;
-        size_t probe_length = 0;
+        auto mixed_hash = mix_hash(hash);
+        auto const* control = this->control();
+        auto position = probe_start(mixed_hash);
+        size_t stride = 0;
+        size_t index;
         for (;;) {
-            auto* bucket = &m_buckets[bucket_index];
-
-            // We found a free bucket, write to it and stop
-            if (bucket->state == BucketState::Free) {
-                new (bucket->slot()) T(forward<U>(value));
-                bucket->state = bucket_state_for_probe_length(probe_length);
-                update_collection_for_new_bucket(*bucket);
-                ++m_size;
-                return HashSetResult::InsertedNewEntry;
-            }
-
-            // The bucket is already used, does it have an identical value?
-            if (TraitsForT::equals(*bucket->slot(), static_cast<T const&>(value))) {
-                if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace) {
-                    (*bucket->slot()) = forward<U>(value);
-                    return HashSetResult::ReplacedExistingEntry;
-                }
-                return HashSetResult::KeptExistingEntry;
+            auto free_buckets = ControlGroup { control + position }.match_empty_or_deleted();
+            if (free_buckets != 0) {
+                index = (position + count_trailing_zeroes(free_buckets)) & (m_capacity - 1);
+                break;
             }
+            position = next_probe_position(position, stride);
+        }
 
-            // Robin hood: if our probe length is larger (poor) than this bucket's (rich), steal its position!
-            // This ensures that we will always traverse buckets in order of probe length.
-            auto target_probe_length = used_bucket_probe_length(*bucket);
-            if (probe_length > target_probe_length) {
-                // Copy out bucket
-                BucketType bucket_to_move = move(*bucket);
-                update_collection_for_swapped_buckets(bucket, &bucket_to_move);
-
-                // Write new bucket
-                new (bucket->slot()) T(forward<U>(value));
-                bucket->state = bucket_state_for_probe_length(probe_length);
-                probe_length = target_probe_length;
-                if constexpr (IsOrdered)
-                    bucket->next = nullptr;
-                update_collection_for_new_bucket(*bucket);
-                ++m_size;
-
-                // Find a free bucket, swapping with smaller probe length buckets along the way
-                for (;;) {
-                    if (++bucket_index == m_capacity) [[unlikely]]
-                        bucket_index = 0;
-                    bucket = &m_buckets[bucket_index];
-                    ++probe_length;
-
-                    if (bucket->state == BucketState::Free) {
-                        *bucket = move(bucket_to_move);
-                        bucket->state = bucket_state_for_probe_length(probe_length);
-                        update_collection_for_swapped_buckets(&bucket_to_move, bucket);
-                        break;
-                    }
-
-                    target_probe_length = used_bucket_probe_length(*bucket);
-                    if (probe_length > target_probe_length) {
-                        swap(bucket_to_move, *bucket);
-                        bucket->state = bucket_state_for_probe_length(probe_length);
-                        probe_length = target_probe_length;
-                        update_collection_for_swapped_buckets(&bucket_to_move, bucket);
-                    }
-                }
-
-                return HashSetResult::InsertedNewEntry;
-            }
+        if (control[index] == ControlGroup::Deleted)
+            --m_deleted_count;
+        set_control(index, control_tag(mixed_hash));
 
-            // Try next bucket
-            if (++bucket_index == m_capacity) [[unlikely]]
-                bucket_index = 0;
-            ++probe_length;
+        auto& bucket = m_buckets[index];
+        new (bucket.slot()) T(forward<U>(value));
+        if constexpr (IsOrdered) {
+            bucket.previous = m_collection_data.tail;
+            bucket.next = nullptr;
+            if (!m_collection_data.head) [[unlikely]]
+                m_collection_data.head = &bucket;
+            else
+                m_collection_data.tail->next = &bucket;
+            m_collection_data.tail = &bucket;
         }
+        ++m_size;
     }
 
     void delete_bucket(auto& bucket)
     {
-        VERIFY(bucket.state != BucketState::Free);
+        VERIFY(&bucket >= m_buckets);
+        size_t index = &bucket - m_buckets;
+        VERIFY(index < m_capacity);
+        VERIFY(ControlGroup::is_used(control()[index]));
 
         // Delete the bucket
         bucket.slot()->~T();
@@ -737,60 +731,25 @@ private:
         }
         --m_size;
 
-        // If we deleted a bucket, we need to make sure to shift up all buckets after it to ensure
-        // that we can still probe for buckets with collisions, and we automatically optimize the
-        // probe lengths. To do so, we shift the following buckets up until we reach a free bucket,
-        // or a bucket with a probe length of 0 (the ideal index for that bucket).
-        auto update_bucket_neighbors = [&](BucketType* bucket) {
-            if constexpr (IsOrdered) {
-                if (bucket->previous)
-                    bucket->previous->next = bucket;
-                else
-                    m_collection_data.head = bucket;
-                if (bucket->next)
-                    bucket->next->previous = bucket;
-                else
-                    m_collection_data.tail = bucket;
-            }
-        };
-
-        VERIFY(&bucket >= m_buckets);
-        size_t shift_to_index = &bucket - m_buckets;
-        VERIFY(shift_to_index < m_capacity);
-        size_t shift_from_index = shift_to_index;
-        for (;;) {
-            if (++shift_from_index == m_capacity) [[unlikely]]
-                shift_from_index = 0;
-
-            auto* shift_from_bucket = &m_buckets[shift_from_index];
-            if (shift_from_bucket->state == BucketState::Free)
-                break;
-
-            auto shift_from_probe_length = used_bucket_probe_length(*shift_from_bucket);
-            if (shift_from_probe_length == 0)
-                break;
-
-            auto* shift_to_bucket = &m_buckets[shift_to_index];
-            *shift_to_bucket = move(*shift_from_bucket);
-            if constexpr (IsOrdered) {
-                shift_from_bucket->previous = nullptr;
-                shift_from_bucket->next = nullptr;
-            }
-            shift_to_bucket->state = bucket_state_for_probe_length(shift_from_probe_length - 1);
-            update_bucket_neighbors(shift_to_bucket);
-
-            if (++shift_to_index == m_capacity) [[unlikely]]
-                shift_to_index = 0;
+        // Lookups stop at the first group that has an empty bucket in it. If every group that could contain this
+        // bucket also contains an empty one, no probe sequence ever went past it and it can simply become empty
+        // again. Otherwise, we have to leave a tombstone behind so that lookups keep on probing.
+        auto empty_before = ControlGroup { control() + ((index - ControlGroup::width) & (m_capacity - 1)) }.match_empty();
+        auto empty_after = ControlGroup { control() + index }.match_empty();
+        if (empty_before != 0 && empty_after != 0
+            && static_cast<size_t>(count_leading_zeroes(empty_before) + count_trailing_zeroes(empty_after)) < ControlGroup::width) {
+            set_control(index, ControlGroup::Empty);
+        } else {
+            set_control(index, ControlGroup::Deleted);
+            ++m_deleted_count;
         }
-
-        // Mark last bucket as free
-        m_buckets[shift_to_index].state = BucketState::Free;
     }
 
     BucketType* m_buckets { nullptr };
 
     [[no_unique_address]] CollectionDataType m_collection_data;
     size_t m_size { 0 };
+    size_t m_deleted_count { 0 };
     size_t m_capacity { 0 };
 };
 }
@@ -18,6 +18,35 @@ constexpr bool is_space(int ch)
     return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
 }
 
+// Returns the number of bytes at the start of the input that can be copied into a string as-is, i.e. everything up to
+// the first quotation mark, reverse solidus or control character. This checks a machine word at a time.
+static size_t string_literal_length(ReadonlyBytes bytes)
+{
+    static constexpr auto has_byte_less_than = [](FlatPtr word, u8 value) {
+        return ((word - explode_byte(value)) & ~word & explode_byte(0x80)) != 0;
+    };
+    static constexpr auto has_byte = [](FlatPtr word, u8 value) {
+        return has_byte_less_than(word ^ explode_byte(value), 1);
+    };
+
+    size_t length = 0;
+
+    for (; length + sizeof(FlatPtr) <= bytes.size(); length += sizeof(FlatPtr)) {
+        FlatPtr word;
+        __builtin_memcpy(&word, bytes.offset(length), sizeof(word));
+        if (has_byte(word, '"') || has_byte(word, '\\') || has_byte_less_than(word, 0x20))
+            break;
+    }
+
+    for (; length < bytes.size(); ++length) {
+        auto ch = bytes[length];
+        if (ch == '"' || ch == '\\' || is_ascii_c0_control(ch))
+            break;
+    }
+
+    return length;
+}
+
 // ECMA-404 9 String
 // Boils down to
 // STRING = "\"" *("[^\"\\]" | "\\" ("[\"\\bfnrt]" | "u[0-9A-Za-z]{4}")) "\""
@@ -45,28 +74,31 @@ ErrorOr<ByteString> JsonParser::consume_and_unescape_string()
         //       of a set of "legal" non-special bytes,
         //       hence we don't need to bother with a code-point iterator,
         //       as a simple byte iterator suffices, which GenericLexer provides by default
-        size_t literal_characters = 0;
-        for (;;) {
-            char ch = peek(literal_characters);
-            // Note: We get a 0 byte when we hit EOF
-            if (ch == 0)
-                return Error::from_string_literal("JsonParser: EOF while parsing String");
-            // Spec: All code points may be placed within the quotation marks except
-            //       for the code points that must be escaped: quotation mark (U+0022),
-            //       reverse solidus (U+005C), and the control characters U+0000 to U+001F.
-            //       There are two-character escape sequence representations of some characters.
-            if (is_ascii_c0_control(ch))
-                return Error::from_string_literal("JsonParser: ASCII control sequence encountered");
-            if (ch == '"' || ch == '\\')
-                break;
-            ++literal_characters;
+        auto literal_characters = string_literal_length(remaining().bytes());
+
+        char ch = peek(literal_characters);
+        // Note: We get a 0 byte when we hit EOF
+        if (ch == 0)
+            return Error::from_string_literal("JsonParser: EOF while parsing String");
+        // Spec: All code points may be placed within the quotation marks except
+        //       for the code points that must be escaped: quotation mark (U+0022),
+        //       reverse solidus (U+005C), and the control characters U+0000 to U+001F.
+        //       There are two-character escape sequence representations of some characters.
+        if (is_ascii_c0_control(ch))
+            return Error::from_string_literal("JsonParser: ASCII control sequence encountered");
+
+        // OPTIMIZATION: Most strings don't contain any escapes, so they can be created straight from the input
+        //               without going through the StringBuilder.
+        if (ch == '"' && final_sb.is_empty()) {
+            ByteString string = consume(literal_characters);
+            ignore(); // '"'
+            return string;
         }
+
         final_sb.append(consume(literal_characters));
 
-        // We have checked all cases except end-of-string and escaped characters in the loop above,
+        // We have checked all cases except end-of-string and escaped characters above,
         // so we now only have to handle those two cases
-        char ch = peek();
-
         if (ch == '"') {
             consume();
             break;
@@ -194,13 +226,10 @@ ErrorOr<JsonValue> JsonParser::parse_string()
 
 ErrorOr<JsonValue> JsonParser::parse_number()
 {
-    Vector<char, 32> number_buffer;
-
     auto start_index = tell();
 
     bool negative = false;
     if (peek() == '-') {
-        number_buffer.append('-');
         ++m_index;
         negative = true;
 
@@ -257,7 +286,6 @@ ErrorOr<JsonValue> JsonParser::parse_number()
             if (ch != '0')
                 all_zero = false;
 
-            number_buffer.append(ch);
             ++m_index;
             continue;
         }
@@ -269,7 +297,7 @@ ErrorOr<JsonValue> JsonParser::parse_number()
     if (negative && all_zero)
         return JsonValue(-0.0);
 
-    StringView number_string(number_buffer.data(), number_buffer.size());
+    auto number_string = m_input.substring_view(start_index, m_index - start_index);
 
     if (auto number = number_string.to_number<u64>(); number.has_value())
         return JsonValue(*number);
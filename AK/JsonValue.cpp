@@ -61,7 +61,7 @@ JsonValue& JsonValue::operator=(JsonArray const& other)
 
 JsonValue& JsonValue::operator=(JsonArray&& other)
 {
-    return *this = JsonValue(other);
+    return *this = JsonValue(move(other));
 }
 
 JsonValue& JsonValue::operator=(JsonObject const& other)
@@ -71,7 +71,7 @@ JsonValue& JsonValue::operator=(JsonObject const& other)
 
 JsonValue& JsonValue::operator=(JsonObject&& other)
 {
-    return *this = JsonValue(other);
+    return *this = JsonValue(move(other));
 }
 
 bool JsonValue::equals(JsonValue const& other) const
@@ -195,12 +195,12 @@ JsonValue::JsonValue(JsonArray const& value)
 }
 
 JsonValue::JsonValue(JsonObject&& value)
-    : m_value(make<JsonObject>(value))
+    : m_value(make<JsonObject>(move(value)))
 {
 }
 
 JsonValue::JsonValue(JsonArray&& value)
-    : m_value(make<JsonArray>(value))
+    : m_value(make<JsonArray>(move(value)))
 {
 }
 
@@ -79,6 +79,23 @@ ALWAYS_INLINE static i32 maskbits(i32x4 mask)
 #endif
 }
 
+ALWAYS_INLINE static u16 maskbits(i8x16 mask)
+{
+#if defined(__SSE2__)
+    return static_cast<u16>(__builtin_ia32_pmovmskb128(bit_cast<c8x16>(mask)));
+#else
+    // Every lane ends up with a distinct bit, so OR-ing the bytes of each half together gathers 8 lanes into a byte.
+    auto bits = bit_cast<u64x2>(bit_cast<u8x16>(mask) & u8x16 { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 });
+    auto gather = [](u64 value) {
+        value |= value >> 32;
+        value |= value >> 16;
+        value |= value >> 8;
+        return static_cast<u8>(value);
+    };
+    return static_cast<u16>(gather(bits[0]) | (gather(bits[1]) << 8));
+#endif
+}
+
 ALWAYS_INLINE static bool all(i32x4 mask)
 {
     return maskbits(mask) == 15;
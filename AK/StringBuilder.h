@@ -34,6 +34,9 @@ public:
     template<typename... Parameters>
     ErrorOr<void> try_appendff(CheckedFormatString<Parameters...>&& fmtstr, Parameters const&... parameters)
     {
+        // Grow the buffer once up front instead of once per argument when formatting long strings.
+        TRY(will_append(fmtstr.view().length() + (estimated_formatted_length(parameters) + ... + 0)));
+
         VariadicFormatParams<AllowDebugOnlyFormatters::No, Parameters...> variadic_format_params { parameters... };
         return vformat(*this, fmtstr.view(), variadic_format_params);
     }
@@ -56,8 +59,7 @@ public:
     template<typename... Parameters>
     void appendff(CheckedFormatString<Parameters...>&& fmtstr, Parameters const&... parameters)
     {
-        VariadicFormatParams<AllowDebugOnlyFormatters::No, Parameters...> variadic_format_params { parameters... };
-        MUST(vformat(*this, fmtstr.view(), variadic_format_params));
+        MUST(try_appendff(move(fmtstr), parameters...));
     }
 
     [[nodiscard]] ByteString to_byte_string() const;
@@ -101,6 +103,21 @@ public:
 private:
     explicit StringBuilder(Buffer);
 
+    // The number of bytes a format argument will most likely take up. This is only a hint for sizing the buffer, so
+    // anything that isn't a string just counts as nothing.
+    template<typename T>
+    static size_t estimated_formatted_length(T const& value)
+    {
+        if constexpr (requires { { value.bytes_as_string_view() } -> SameAs<StringView>; })
+            return value.bytes_as_string_view().length();
+        else if constexpr (requires { { value.view() } -> SameAs<StringView>; })
+            return value.view().length();
+        else if constexpr (IsSame<T, StringView>)
+            return value.length();
+        else
+            return 0;
+    }
+
     ErrorOr<void> will_append(size_t);
     u8* data();
     u8 const* data() const;
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Error.h>
 #include <AK/FlyString.h>
 #include <AK/NonnullRefPtr.h>
@@ -106,6 +107,40 @@ public:
     bool is_fly_string() const { return m_is_fly_string; }
     void set_fly_string(bool is_fly_string) const { m_is_fly_string = is_fly_string; }
 
+    // Fly strings are reachable from every thread through the interning table, so their reference count is updated
+    // atomically. All other strings stick to the cheaper non-atomic path.
+    ALWAYS_INLINE void ref() const
+    {
+        if (!m_is_fly_string) {
+            RefCountedBase::ref();
+            return;
+        }
+        atomic_fetch_add(&m_ref_count, 1u, memory_order_relaxed);
+    }
+
+    ALWAYS_INLINE bool unref() const
+    {
+        if (!m_is_fly_string)
+            return RefCounted::unref();
+        if (atomic_fetch_sub(&m_ref_count, 1u, memory_order_acq_rel) != 1)
+            return false;
+        delete this;
+        return true;
+    }
+
+    // Takes a reference unless the last one is already gone, in which case the fly string is about to be destroyed
+    // and removed from the interning table.
+    [[nodiscard]] bool try_ref_fly_string() const
+    {
+        VERIFY(m_is_fly_string);
+        auto ref_count = atomic_load(&m_ref_count, memory_order_relaxed);
+        while (ref_count != 0) {
+            if (atomic_compare_exchange_strong(&m_ref_count, ref_count, ref_count + 1, memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
     size_t byte_count() const { return m_byte_count; }
 
 private:
@@ -55,9 +55,6 @@ ErrorOr<Utf16Data> utf8_to_utf16(StringView utf8_view, Endianness endianness)
 
 ErrorOr<Utf16Data> utf8_to_utf16(Utf8View const& utf8_view, Endianness endianness)
 {
-    // All callers want to allow lonely surrogates, which simdutf does not permit.
-    if (!utf8_view.validate(Utf8View::AllowSurrogates::No)) [[unlikely]]
-        return to_utf16_slow(utf8_view, endianness);
     if (utf8_view.is_empty())
         return Utf16Data {};
 
@@ -65,6 +62,27 @@ ErrorOr<Utf16Data> utf8_to_utf16(Utf8View const& utf8_view, Endianness endiannes
     auto length = utf8_view.byte_length();
 
     Utf16Data utf16_data;
+
+    // OPTIMIZATION: Most strings crossing the JS/DOM boundary are ASCII. Every ASCII byte is exactly one code unit, so we
+    //               can skip both the UTF-8 validation and length computation passes, and just widen the bytes.
+    if (simdutf::validate_ascii(data, length)) {
+        TRY(utf16_data.try_resize(length));
+
+        auto* utf16_output = reinterpret_cast<char16_t*>(utf16_data.data());
+        auto is_little_endian = endianness == Endianness::Little || (endianness == Endianness::Host && HostIsLittleEndian);
+
+        [[maybe_unused]] auto result = is_little_endian
+            ? simdutf::convert_latin1_to_utf16le(data, length, utf16_output)
+            : simdutf::convert_latin1_to_utf16be(data, length, utf16_output);
+        ASSERT(result == length);
+
+        return utf16_data;
+    }
+
+    // All callers want to allow lonely surrogates, which simdutf does not permit.
+    if (!utf8_view.validate(Utf8View::AllowSurrogates::No)) [[unlikely]]
+        return to_utf16_slow(utf8_view, endianness);
+
     TRY(utf16_data.try_resize(simdutf::utf16_length_from_utf8(data, length)));
 
     [[maybe_unused]] auto result = [&]() {
@@ -159,7 +177,8 @@ ErrorOr<ByteString> Utf16View::to_byte_string(AllowInvalidCodeUnits allow_invali
 
 ErrorOr<String> Utf16View::to_utf8(AllowInvalidCodeUnits allow_invalid_code_units) const
 {
-    if (allow_invalid_code_units == AllowInvalidCodeUnits::No)
+    // OPTIMIZATION: Only strings that actually contain lone surrogates need to be transcoded one code point at a time.
+    if (allow_invalid_code_units == AllowInvalidCodeUnits::No || validate())
         return String::from_utf16(*this);
 
     StringBuilder builder;
@@ -106,6 +106,9 @@ inspector.reset = () => {
     let cookieTable = document.getElementById("cookie-table");
     cookieTable.innerHTML = "";
 
+    let networkTable = document.getElementById("network-table");
+    networkTable.innerHTML = "";
+
     let styleSheetPicker = document.getElementById("style-sheet-picker");
     styleSheetPicker.replaceChildren();
 
@@ -245,6 +248,93 @@ inspector.setCookies = cookies => {
     oldTable.parentNode.replaceChild(newTable, oldTable);
 };
 
+const formatByteSize = size => {
+    if (size < 1024) return `${size} B`;
+    if (size < 1024 * 1024) return `${(size / 1024).toFixed(1)} KiB`;
+    return `${(size / (1024 * 1024)).toFixed(1)} MiB`;
+};
+
+const formatDuration = milliseconds => {
+    if (milliseconds < 1000) return `${Math.round(milliseconds)} ms`;
+    return `${(milliseconds / 1000).toFixed(2)} s`;
+};
+
+inspector.setNetworkRequests = requests => {
+    let oldTable = document.getElementById("network-table");
+
+    let newTable = document.createElement("tbody");
+    newTable.setAttribute("id", oldTable.id);
+
+    const addColumn = (row, value) => {
+        let column = row.insertCell();
+        column.innerText = value;
+        column.title = value;
+        return column;
+    };
+
+    const totalTime = Math.max(1, ...requests.map(request => request.end));
+
+    // Each request is split into the phases reported by RequestServer. Phases that did not happen (e.g. DNS lookup
+    // and connecting when a connection was reused) are null and are folded into the phase before them.
+    const createWaterfall = request => {
+        let waterfall = document.createElement("div");
+        waterfall.classList.add("network-waterfall");
+
+        const addSegment = (start, end, phase) => {
+            if (start === null || end === null || end <= start) return;
+
+            let segment = document.createElement("div");
+            segment.classList.add("network-waterfall-segment", `network-phase-${phase}`);
+            segment.style.left = `${(start / totalTime) * 100}%`;
+            segment.style.width = `${Math.max(((end - start) / totalTime) * 100, 0.2)}%`;
+            segment.title = `${phase}: ${formatDuration(end - start)}`;
+            waterfall.appendChild(segment);
+        };
+
+        const firstPhase = [
+            request.domainLookupStart,
+            request.connectStart,
+            request.requestStart,
+            request.responseStart,
+        ].find(time => time !== null);
+
+        addSegment(request.start, firstPhase ?? request.end, "queued");
+        addSegment(request.domainLookupStart, request.domainLookupEnd, "dns");
+        addSegment(request.connectStart, request.secureConnectionStart ?? request.connectEnd, "connect");
+        addSegment(request.secureConnectionStart, request.connectEnd, "tls");
+        addSegment(request.requestStart, request.responseStart, "waiting");
+        addSegment(request.responseStart, request.responseEnd ?? request.end, "download");
+
+        return waterfall;
+    };
+
+    requests
+        .sort((lhs, rhs) => lhs.start - rhs.start)
+        .forEach(request => {
+            let row = newTable.insertRow();
+
+            if (!request.success) row.classList.add("network-request-failed");
+
+            addColumn(row, request.url);
+            addColumn(row, request.method);
+            addColumn(row, request.status ?? (request.success ? "" : "(failed)"));
+            addColumn(row, request.initiatorType || request.destination);
+            addColumn(row, request.protocol + (request.connectionReused ? " (reused)" : ""));
+            addColumn(
+                row,
+                request.encodedBodySize !== request.decodedBodySize
+                    ? `${formatByteSize(request.encodedBodySize)} / ${formatByteSize(request.decodedBodySize)}`
+                    : formatByteSize(request.decodedBodySize)
+            );
+            addColumn(row, formatDuration(request.end - request.start));
+
+            let waterfallColumn = row.insertCell();
+            waterfallColumn.appendChild(createWaterfall(request));
+        });
+
+    oldTable.parentNode.replaceChild(newTable, oldTable);
+};
+
 inspector.setStyleSheets = styleSheets => {
     const styleSheetPicker = document.getElementById("style-sheet-picker");
     const styleSheetSource = document.getElementById("style-sheet-source");
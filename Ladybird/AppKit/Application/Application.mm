@@ -54,6 +54,9 @@ ApplicationBridge::ApplicationBridge(Badge<WebView::Application>, Main::Argument
 
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
+
+    OwnPtr<WebContentProcessPool> m_web_content_process_pool;
+    OwnPtr<WebWorkerProcessPool> m_web_worker_process_pool;
 }
 
 @end
@@ -119,6 +122,22 @@ static ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_new_image_decod
 
 - (ErrorOr<NonnullRefPtr<WebView::WebContentClient>>)launchWebContent:(Ladybird::WebViewBridge&)web_view_bridge
 {
+    if (!m_web_content_process_pool) {
+        if (auto size = WebView::Application::chrome_options().spare_web_content_processes; size > 0) {
+            m_web_content_process_pool = make<WebContentProcessPool>(size, [self]() -> ErrorOr<NonnullRefPtr<WebView::WebContentClient>> {
+                auto request_server_socket = TRY(connect_new_request_server_client(*self->m_request_server_client));
+                auto image_decoder_socket = TRY(connect_new_image_decoder_client(*self->m_image_decoder_client));
+
+                auto web_content_paths = TRY(get_paths_for_helper_process("WebContent"sv));
+                return launch_spare_web_content_process(web_content_paths, move(image_decoder_socket), move(request_server_socket));
+            });
+        }
+    } else if (auto spare_client = m_web_content_process_pool->take()) {
+        // Prefer a process that was launched ahead of time, so the new tab doesn't have to wait for one to start up.
+        spare_client->assign_initial_view(web_view_bridge);
+        return spare_client.release_nonnull();
+    }
+
     // FIXME: Fail to open the tab, rather than crashing the whole application if this fails
     auto request_server_socket = TRY(connect_new_request_server_client(*m_request_server_client));
     auto image_decoder_socket = TRY(connect_new_image_decoder_client(*m_image_decoder_client));
@@ -129,11 +148,26 @@ static ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_new_image_decod
     return web_content;
 }
 
-- (ErrorOr<IPC::File>)launchWebWorker
+- (ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>>)launchNewWebWorkerProcess
 {
     auto web_worker_paths = TRY(get_paths_for_helper_process("WebWorker"sv));
-    auto worker_client = TRY(launch_web_worker_process(web_worker_paths, m_request_server_client));
+    return launch_web_worker_process(web_worker_paths, m_request_server_client);
+}
+
+- (ErrorOr<IPC::File>)launchWebWorker
+{
+    // Workers are only started on demand, so we only keep spare WebWorker processes around once a page has used one.
+    if (!m_web_worker_process_pool) {
+        if (auto size = WebView::Application::chrome_options().spare_web_worker_processes; size > 0) {
+            m_web_worker_process_pool = make<WebWorkerProcessPool>(size, [self]() {
+                return [self launchNewWebWorkerProcess];
+            });
+        }
+    } else if (auto worker_client = m_web_worker_process_pool->take()) {
+        return worker_client->dup_socket();
+    }
 
+    auto worker_client = TRY([self launchNewWebWorkerProcess]);
     return worker_client->dup_socket();
 }
 
@@ -1126,7 +1126,9 @@ static void copy_data_to_clipboard(StringView data, NSPasteboardType pasteboard_
 
 - (void)copy:(id)sender
 {
-    copy_data_to_clipboard(m_web_view_bridge->selected_text(), NSPasteboardTypeString);
+    m_web_view_bridge->request_selected_text()->when_resolved([](auto const& text) {
+        copy_data_to_clipboard(text, NSPasteboardTypeString);
+    });
 }
 
 - (void)paste:(id)sender
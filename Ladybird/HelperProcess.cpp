@@ -71,11 +71,7 @@ static ErrorOr<NonnullRefPtr<ClientType>> launch_server_process(
     VERIFY_NOT_REACHED();
 }
 
-ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
-    WebView::ViewImplementation& view,
-    ReadonlySpan<ByteString> candidate_web_content_paths,
-    IPC::File image_decoder_socket,
-    Optional<IPC::File> request_server_socket)
+static Vector<ByteString> web_content_process_arguments(IPC::File const& image_decoder_socket, Optional<IPC::File> const& request_server_socket)
 {
     auto const& web_content_options = WebView::Application::web_content_options();
 
@@ -98,6 +94,10 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
         arguments.append("--log-all-js-exceptions"sv);
     if (web_content_options.enable_idl_tracing == WebView::EnableIDLTracing::Yes)
         arguments.append("--enable-idl-tracing"sv);
+    if (web_content_options.enable_bytecode_profiling == WebView::EnableBytecodeProfiling::Yes)
+        arguments.append("--enable-bytecode-profiling"sv);
+    if (web_content_options.enable_gc_performance_entries == WebView::EnableGCPerformanceEntries::Yes)
+        arguments.append("--enable-gc-performance-entries"sv);
     if (web_content_options.enable_http_cache == WebView::EnableHTTPCache::Yes)
         arguments.append("--enable-http-cache"sv);
     if (web_content_options.expose_internals_object == WebView::ExposeInternalsObject::Yes)
@@ -118,9 +118,28 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
     arguments.append("--image-decoder-socket"sv);
     arguments.append(ByteString::number(image_decoder_socket.fd()));
 
+    return arguments;
+}
+
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
+    WebView::ViewImplementation& view,
+    ReadonlySpan<ByteString> candidate_web_content_paths,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket)
+{
+    auto arguments = web_content_process_arguments(image_decoder_socket, request_server_socket);
     return launch_server_process<WebView::WebContentClient>("WebContent"sv, candidate_web_content_paths, move(arguments), view);
 }
 
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_spare_web_content_process(
+    ReadonlySpan<ByteString> candidate_web_content_paths,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket)
+{
+    auto arguments = web_content_process_arguments(image_decoder_socket, request_server_socket);
+    return launch_server_process<WebView::WebContentClient>("WebContent"sv, candidate_web_content_paths, move(arguments));
+}
+
 ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_image_decoder_process(ReadonlySpan<ByteString> candidate_image_decoder_paths)
 {
     Vector<ByteString> arguments;
@@ -7,9 +7,11 @@
 #pragma once
 
 #include <AK/Error.h>
+#include <AK/Function.h>
 #include <AK/Optional.h>
 #include <AK/Span.h>
 #include <AK/StringView.h>
+#include <LibCore/EventLoop.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibRequests/RequestClient.h>
 #include <LibWeb/Worker/WebWorkerClient.h>
@@ -22,6 +24,71 @@ ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_process(
     IPC::File image_decoder_socket,
     Optional<IPC::File> request_server_socket = {});
 
+ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_spare_web_content_process(
+    ReadonlySpan<ByteString> candidate_web_content_paths,
+    IPC::File image_decoder_socket,
+    Optional<IPC::File> request_server_socket = {});
+
+// Keeps a few helper processes launched ahead of time, so that new tabs and workers don't have to wait for one to start
+// up. Whenever a process is handed out, a replacement is launched once the event loop is idle again.
+template<typename ClientType>
+class HelperProcessPool {
+public:
+    using LaunchFunction = Function<ErrorOr<NonnullRefPtr<ClientType>>()>;
+
+    HelperProcessPool(size_t size, LaunchFunction launch)
+        : m_size(size)
+        , m_launch(move(launch))
+    {
+        schedule_refill();
+    }
+
+    RefPtr<ClientType> take()
+    {
+        RefPtr<ClientType> client;
+
+        // A spare process may have died while it sat around waiting to be used.
+        while (!client && !m_spare_processes.is_empty()) {
+            auto spare = m_spare_processes.take_first();
+            if (spare->is_open())
+                client = move(spare);
+        }
+
+        schedule_refill();
+        return client;
+    }
+
+private:
+    void schedule_refill()
+    {
+        if (m_refill_scheduled || m_spare_processes.size() >= m_size)
+            return;
+        m_refill_scheduled = true;
+
+        // Launch replacements after whatever the caller is doing with its new process, so as not to compete with it.
+        Core::deferred_invoke([this] {
+            m_refill_scheduled = false;
+
+            while (m_spare_processes.size() < m_size) {
+                auto client = m_launch();
+                if (client.is_error()) {
+                    warnln("Unable to launch a spare helper process: {}", client.error());
+                    break;
+                }
+                m_spare_processes.append(client.release_value());
+            }
+        });
+    }
+
+    size_t m_size { 0 };
+    LaunchFunction m_launch;
+    Vector<NonnullRefPtr<ClientType>> m_spare_processes;
+    bool m_refill_scheduled { false };
+};
+
+using WebContentProcessPool = HelperProcessPool<WebView::WebContentClient>;
+using WebWorkerProcessPool = HelperProcessPool<Web::HTML::WebWorkerClient>;
+
 ErrorOr<NonnullRefPtr<ImageDecoderClient::Client>> launch_image_decoder_process(ReadonlySpan<ByteString> candidate_image_decoder_paths);
 ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(ReadonlySpan<ByteString> candidate_web_worker_paths, RefPtr<Requests::RequestClient>);
 ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process(ReadonlySpan<ByteString> candidate_request_server_paths, StringView serenity_resource_root);
@@ -91,6 +91,55 @@ ErrorOr<void> Application::initialize_image_decoder()
     return {};
 }
 
+void Application::initialize_web_content_process_pool()
+{
+    auto size = chrome_options().spare_web_content_processes;
+    if (size == 0)
+        return;
+
+    m_web_content_process_pool = make<WebContentProcessPool>(size, [this]() -> ErrorOr<NonnullRefPtr<WebView::WebContentClient>> {
+        Optional<IPC::File> request_server_socket;
+        if (web_content_options().use_lagom_networking == WebView::UseLagomNetworking::Yes)
+            request_server_socket = TRY(connect_new_request_server_client(*request_server_client));
+
+        auto image_decoder_socket = TRY(connect_new_image_decoder_client(*m_image_decoder_client));
+
+        auto candidate_web_content_paths = TRY(get_paths_for_helper_process("WebContent"sv));
+        return launch_spare_web_content_process(candidate_web_content_paths, AK::move(image_decoder_socket), AK::move(request_server_socket));
+    });
+}
+
+RefPtr<WebView::WebContentClient> Application::take_spare_web_content_process()
+{
+    if (!m_web_content_process_pool)
+        return nullptr;
+    return m_web_content_process_pool->take();
+}
+
+ErrorOr<IPC::File> Application::launch_web_worker()
+{
+    // Workers are only started on demand, so we only keep spare WebWorker processes around once a page has used one.
+    if (!m_web_worker_process_pool) {
+        if (auto size = chrome_options().spare_web_worker_processes; size > 0)
+            m_web_worker_process_pool = make<WebWorkerProcessPool>(size, [this]() { return launch_new_web_worker_process(); });
+    } else if (auto worker_client = m_web_worker_process_pool->take()) {
+        return worker_client->dup_socket();
+    }
+
+    auto worker_client = TRY(launch_new_web_worker_process());
+    return worker_client->dup_socket();
+}
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_new_web_worker_process()
+{
+    RefPtr<Requests::RequestClient> request_server_client;
+    if (web_content_options().use_lagom_networking == WebView::UseLagomNetworking::Yes)
+        request_server_client = this->request_server_client;
+
+    auto candidate_web_worker_paths = TRY(get_paths_for_helper_process("WebWorker"sv));
+    return launch_web_worker_process(candidate_web_worker_paths, move(request_server_client));
+}
+
 void Application::show_task_manager_window()
 {
     if (!m_task_manager_window) {
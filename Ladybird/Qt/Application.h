@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashTable.h>
+#include <Ladybird/HelperProcess.h>
 #include <Ladybird/Qt/BrowserWindow.h>
 #include <LibImageDecoderClient/Client.h>
 #include <LibRequests/RequestClient.h>
@@ -34,6 +35,11 @@ public:
     NonnullRefPtr<ImageDecoderClient::Client> image_decoder_client() const { return *m_image_decoder_client; }
     ErrorOr<void> initialize_image_decoder();
 
+    void initialize_web_content_process_pool();
+    RefPtr<WebView::WebContentClient> take_spare_web_content_process();
+
+    ErrorOr<IPC::File> launch_web_worker();
+
     BrowserWindow& new_window(Vector<URL::URL> const& initial_urls, BrowserWindow::IsPopupWindow is_popup_window = BrowserWindow::IsPopupWindow::No, Tab* parent_tab = nullptr, Optional<u64> page_index = {});
 
     void show_task_manager_window();
@@ -48,12 +54,16 @@ private:
 
     virtual Optional<ByteString> ask_user_for_download_folder() const override;
 
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_new_web_worker_process();
+
     bool m_enable_qt_networking { false };
 
     TaskManagerWindow* m_task_manager_window { nullptr };
     BrowserWindow* m_active_window { nullptr };
 
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
+    OwnPtr<WebContentProcessPool> m_web_content_process_pool;
+    OwnPtr<WebWorkerProcessPool> m_web_worker_process_pool;
 };
 
 }
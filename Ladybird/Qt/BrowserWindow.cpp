@@ -1141,10 +1141,11 @@ void BrowserWindow::copy_selected_text()
     if (!m_current_tab)
         return;
 
-    auto text = m_current_tab->view().selected_text();
-
-    auto* clipboard = QGuiApplication::clipboard();
-    clipboard->setText(qstring_from_ak_string(text));
+    // Don't block the UI on a page that is busy running script; the text lands on the clipboard once it answers.
+    m_current_tab->view().request_selected_text()->when_resolved([](auto const& text) {
+        auto* clipboard = QGuiApplication::clipboard();
+        clipboard->setText(qstring_from_ak_string(text));
+    });
 }
 
 bool BrowserWindow::event(QEvent* event)
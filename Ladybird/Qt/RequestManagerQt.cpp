@@ -34,7 +34,7 @@ void RequestManagerQt::reply_finished(QNetworkReply* reply)
     request->did_finish();
 }
 
-RefPtr<Web::ResourceLoaderConnectorRequest> RequestManagerQt::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy)
+RefPtr<Web::ResourceLoaderConnectorRequest> RequestManagerQt::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy, Requests::RequestPriority)
 {
     if (!url.scheme().bytes_as_string_view().is_one_of_ignoring_ascii_case("http"sv, "https"sv)) {
         return nullptr;
@@ -113,7 +113,7 @@ void RequestManagerQt::Request::set_buffered_request_finished_callback(Requests:
 void RequestManagerQt::Request::set_unbuffered_request_callbacks(Requests::Request::HeadersReceived, Requests::Request::DataReceived, Requests::Request::RequestFinished on_request_finished)
 {
     dbgln("Unbuffered requests are not yet supported with Qt networking");
-    on_request_finished(false, 0);
+    on_request_finished(false, 0, {});
 }
 
 void RequestManagerQt::Request::did_finish()
@@ -136,7 +136,7 @@ void RequestManagerQt::Request::did_finish()
         }
     }
     bool success = http_status_code != 0;
-    on_buffered_request_finish(success, buffer.length(), response_headers, http_status_code, ReadonlyBytes { buffer.data(), (size_t)buffer.size() });
+    on_buffered_request_finish(success, buffer.length(), response_headers, http_status_code, ReadonlyBytes { buffer.data(), (size_t)buffer.size() }, {});
 }
 
 }
@@ -121,6 +121,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     }
 
     TRY(app->initialize_image_decoder());
+    app->initialize_web_content_process_pool();
 
     chrome_process.on_new_window = [&](auto const& urls) {
         app->new_window(urls);
@@ -11,12 +11,14 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/LocalServer.h>
 #include <LibCore/Process.h>
+#include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <LibTLS/Certificate.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 
 #if defined(AK_OS_MACOS)
 #    include <LibCore/Platform/ProcessStatisticsMach.h>
@@ -24,8 +26,13 @@
 
 namespace RequestServer {
 extern ByteString g_default_certificate_path;
+extern OwnPtr<DiskCache> g_disk_cache;
+extern bool g_enable_http3;
+extern ByteString g_dns_over_https_url;
 }
 
+static constexpr u64 disk_cache_maximum_size = 256 * MiB;
+
 static ErrorOr<ByteString> find_certificates(StringView serenity_resource_root)
 {
     auto cert_path = ByteString::formatted("{}/ladybird/cacert.pem", serenity_resource_root);
@@ -42,12 +49,16 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     bool wait_for_debugger = false;
+    bool disable_disk_cache = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(serenity_resource_root, "Absolute path to directory for serenity resources", "serenity-resource-root", 'r', "serenity-resource-root");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
+    args_parser.add_option(disable_disk_cache, "Don't cache responses on disk", "disable-disk-cache");
+    args_parser.add_option(RequestServer::g_enable_http3, "Try to use HTTP/3 for HTTPS requests", "enable-http3");
+    args_parser.add_option(RequestServer::g_dns_over_https_url, "Resolve host names through this DNS-over-HTTPS server", "dns-over-https", 0, "url");
     args_parser.parse(arguments);
 
     if (wait_for_debugger)
@@ -62,6 +73,14 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     DefaultRootCACertificates::set_default_certificate_paths(certificates.span());
     [[maybe_unused]] auto& certs = DefaultRootCACertificates::the();
 
+    if (!disable_disk_cache) {
+        auto disk_cache_directory = ByteString::formatted("{}/Ladybird/HTTPCache", Core::StandardPaths::cache_directory());
+        if (auto disk_cache = RequestServer::DiskCache::create(move(disk_cache_directory), disk_cache_maximum_size); disk_cache.is_error())
+            dbgln("Unable to open the disk cache: {}", disk_cache.error());
+        else
+            RequestServer::g_disk_cache = disk_cache.release_value();
+    }
+
     Core::EventLoop event_loop;
 
 #if defined(AK_OS_MACOS)
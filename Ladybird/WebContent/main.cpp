@@ -15,8 +15,10 @@
 #include <LibCore/Resource.h>
 #include <LibCore/SystemServerTakeover.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/TypefaceSkia.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profile.h>
 #include <LibMain/Main.h>
 #include <LibMedia/Audio/Loader.h>
 #include <LibRequests/RequestClient.h>
@@ -25,6 +27,7 @@
 #include <LibWeb/Loader/ContentFilter.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
 #include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/PerformanceTimeline/PerformanceGarbageCollectionTiming.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/AudioCodecPluginAgnostic.h>
 #include <LibWeb/Platform/EventLoopPluginSerenity.h>
@@ -104,6 +107,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool wait_for_debugger = false;
     bool log_all_js_exceptions = false;
     bool enable_idl_tracing = false;
+    bool enable_bytecode_profiling = false;
+    bool enable_gc_performance_entries = false;
     bool enable_http_cache = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
@@ -122,6 +127,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
+    args_parser.add_option(enable_bytecode_profiling, "Count executed JavaScript bytecode instructions", "enable-bytecode-profiling");
+    args_parser.add_option(enable_gc_performance_entries, "Report garbage collections to PerformanceObservers", "enable-gc-performance-entries");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
@@ -138,6 +145,10 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     Gfx::FontDatabase::the().load_all_fonts_from_uri("resource://fonts"sv);
 
+    // Text is most of what we paint, so keep enough rasterized glyphs around for a text-heavy page at high DPI.
+    static constexpr size_t glyph_cache_limit = 32 * MiB;
+    Gfx::TypefaceSkia::set_glyph_cache_limit(glyph_cache_limit);
+
     // Layout test mode implies internals object is exposed and the Skia CPU backend is used
     if (is_layout_test_mode) {
         expose_internals_object = true;
@@ -189,6 +200,13 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Web::WebIDL::g_enable_idl_tracing = true;
     }
 
+    if (enable_bytecode_profiling) {
+        static JS::Bytecode::Profile bytecode_profile;
+        Web::Bindings::main_thread_vm().bytecode_interpreter().set_profile(&bytecode_profile);
+    }
+
+    Web::PerformanceTimeline::PerformanceGarbageCollectionTiming::set_enabled(enable_gc_performance_entries);
+
     auto maybe_content_filter_error = load_content_filters(config_path);
     if (maybe_content_filter_error.is_error())
         dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
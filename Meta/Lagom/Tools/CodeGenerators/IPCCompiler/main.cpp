@@ -42,6 +42,7 @@ static ByteString pascal_case(ByteString const& identifier)
 }
 
 struct Message {
+    Vector<ByteString> attributes;
     ByteString name;
     bool is_synchronous { false };
     Vector<Parameter> inputs;
@@ -141,6 +142,23 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
         return parameter_type;
     };
 
+    auto parse_attributes = [&](Vector<ByteString>& storage) {
+        if (!lexer.consume_specific('['))
+            return;
+        for (;;) {
+            if (lexer.consume_specific(']')) {
+                consume_whitespace();
+                break;
+            }
+            if (lexer.consume_specific(',')) {
+                consume_whitespace();
+            }
+            auto attribute = lexer.consume_until([](char ch) { return ch == ']' || ch == ','; });
+            storage.append(attribute);
+            consume_whitespace();
+        }
+    };
+
     auto parse_parameter = [&](Vector<Parameter>& storage, StringView message_name) {
         for (auto parameter_index = 1;; ++parameter_index) {
             Parameter parameter;
@@ -151,20 +169,7 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
             consume_whitespace();
             if (lexer.peek() == ')')
                 break;
-            if (lexer.consume_specific('[')) {
-                for (;;) {
-                    if (lexer.consume_specific(']')) {
-                        consume_whitespace();
-                        break;
-                    }
-                    if (lexer.consume_specific(',')) {
-                        consume_whitespace();
-                    }
-                    auto attribute = lexer.consume_until([](char ch) { return ch == ']' || ch == ','; });
-                    parameter.attributes.append(attribute);
-                    consume_whitespace();
-                }
-            }
+            parse_attributes(parameter.attributes);
             parameter.type = parse_parameter_type();
             if (parameter.type.ends_with(',') || parameter.type.ends_with(')')) {
                 warnln("Parameter {} of method: {} must be named", parameter_index, message_name);
@@ -197,6 +202,7 @@ Vector<Endpoint> parse(ByteBuffer const& file_contents)
     auto parse_message = [&] {
         Message message;
         consume_whitespace();
+        parse_attributes(message.attributes);
         message.name = lexer.consume_until([](char ch) { return isspace(ch) || ch == '('; });
         consume_whitespace();
         assert_specific('(');
@@ -328,7 +334,20 @@ ByteString constructor_for_message(ByteString const& name, Vector<Parameter> con
     return builder.to_byte_string();
 }
 
-void do_message(SourceGenerator message_generator, ByteString const& name, Vector<Parameter> const& parameters, ByteString const& response_type = {})
+// A message declared with [Coalesce] is superseded by a later one of its kind, and [Coalesce=parameter] narrows that
+// down to later ones with the same value for the given parameter (e.g. the same page).
+static Optional<Optional<ByteString>> coalescing_key(Vector<ByteString> const& attributes)
+{
+    for (auto const& attribute : attributes) {
+        if (attribute == "Coalesce"sv)
+            return Optional<ByteString> {};
+        if (attribute.starts_with("Coalesce="sv))
+            return Optional<ByteString> { attribute.substring_view(9).trim_whitespace() };
+    }
+    return {};
+}
+
+void do_message(SourceGenerator message_generator, ByteString const& name, Vector<Parameter> const& parameters, ByteString const& response_type = {}, Vector<ByteString> const& attributes = {})
 {
     auto pascal_name = pascal_case(name);
     message_generator.set("message.name", name);
@@ -411,6 +430,32 @@ public:)~~~");
         return make<@message.pascal_name@>(@message.constructor_call_parameters@);
     })~~~");
 
+    if (auto key = coalescing_key(attributes); key.has_value()) {
+        message_generator.appendln(R"~~~(
+    virtual bool can_be_coalesced() const override { return true; }
+
+    virtual bool is_superseded_by(IPC::Message const& other) const override
+    {
+        if (other.endpoint_magic() != endpoint_magic() || other.message_id() != message_id())
+            return false;)~~~");
+
+        if (key->has_value()) {
+            auto parameter = parameters.find_if([&](auto const& parameter) { return parameter.name == **key; });
+            if (parameter.is_end()) {
+                warnln("Message {} is coalesced by unknown parameter {}", name, **key);
+                VERIFY_NOT_REACHED();
+            }
+            message_generator.set("message.coalescing_key", **key);
+            message_generator.appendln(R"~~~(
+        return m_@message.coalescing_key@ == static_cast<@message.pascal_name@ const&>(other).m_@message.coalescing_key@;
+    })~~~");
+        } else {
+            message_generator.appendln(R"~~~(
+        return true;
+    })~~~");
+        }
+    }
+
     message_generator.appendln(R"~~~(
     virtual bool valid() const override { return m_ipc_message_valid; }
 
@@ -419,7 +464,17 @@ public:)~~~");
         VERIFY(valid());
 
         IPC::MessageBuffer buffer;
-        IPC::Encoder stream(buffer);
+        IPC::Encoder stream(buffer);)~~~");
+
+    // Reserve room for the whole message up front, so the buffer doesn't have to grow while parameters are encoded.
+    StringBuilder size_hint_builder;
+    size_hint_builder.append("sizeof(u32) + sizeof(int)"sv);
+    for (auto const& parameter : parameters)
+        size_hint_builder.appendff(" + IPC::encoded_size_hint(m_{})", parameter.name);
+    message_generator.set("message.size_hint", size_hint_builder.to_byte_string());
+
+    message_generator.appendln(R"~~~(
+        TRY(stream.extend_capacity(@message.size_hint@));
         TRY(stream.encode(endpoint_magic()));
         TRY(stream.encode((int)MessageID::@message.pascal_name@));)~~~");
 
@@ -562,10 +617,46 @@ void do_message_for_proxy(SourceGenerator message_generator, Endpoint const& end
     })~~~");
     };
 
+    // Lets the caller get on with other work while the peer is busy, instead of blocking until it answers.
+    auto do_implement_proxy_with_response = [&](ByteString const& name, Vector<Parameter> const& parameters) {
+        message_generator.set("message.name", name);
+        message_generator.set("message.pascal_name", pascal_case(name));
+        message_generator.set("message.response_type", message_name(endpoint.name, name, true));
+        message_generator.append(R"~~~(
+    NonnullRefPtr<Core::Promise<NonnullOwnPtr<@message.response_type@>>> async_@message.name@_with_response()~~~");
+
+        for (size_t i = 0; i < parameters.size(); ++i) {
+            auto argument_generator = message_generator.fork();
+            argument_generator.set("argument.type", parameters[i].type);
+            argument_generator.set("argument.name", parameters[i].name);
+            argument_generator.append("@argument.type@ @argument.name@");
+            if (i != parameters.size() - 1)
+                argument_generator.append(", ");
+        }
+
+        message_generator.append(R"~~~() {
+        return m_connection.template send_async_with_response<Messages::@endpoint.name@::@message.pascal_name@>()~~~");
+
+        for (size_t i = 0; i < parameters.size(); ++i) {
+            auto argument_generator = message_generator.fork();
+            argument_generator.set("argument.name", parameters[i].name);
+            if (is_primitive_or_simple_type(parameters[i].type))
+                argument_generator.append("@argument.name@");
+            else
+                argument_generator.append("move(@argument.name@)");
+            if (i != parameters.size() - 1)
+                argument_generator.append(", ");
+        }
+
+        message_generator.appendln(R"~~~();
+    })~~~");
+    };
+
     do_implement_proxy(message.name, message.inputs, message.is_synchronous, false);
     if (message.is_synchronous) {
         do_implement_proxy(message.name, message.inputs, false, false);
         do_implement_proxy(message.name, message.inputs, true, true);
+        do_implement_proxy_with_response(message.name, message.inputs);
     }
 }
 
@@ -584,7 +675,7 @@ void build_endpoint(SourceGenerator generator, Endpoint const& endpoint)
             response_name = message.response_name();
             do_message(generator.fork(), response_name, message.outputs);
         }
-        do_message(generator.fork(), message.name, message.inputs, response_name);
+        do_message(generator.fork(), message.name, message.inputs, response_name, message.attributes);
     }
 
     generator.appendln(R"~~~(
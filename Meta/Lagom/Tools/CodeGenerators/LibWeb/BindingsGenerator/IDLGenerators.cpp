@@ -4190,6 +4190,7 @@ static void generate_using_namespace_definitions(SourceGenerator& generator)
     using namespace Web::DOMURL;
     using namespace Web::Encoding;
     using namespace Web::EntriesAPI;
+    using namespace Web::EventTiming;
     using namespace Web::Fetch;
     using namespace Web::FileAPI;
     using namespace Web::Geometry;
@@ -4198,11 +4199,13 @@ static void generate_using_namespace_definitions(SourceGenerator& generator)
     using namespace Web::IndexedDB;
     using namespace Web::Internals;
     using namespace Web::IntersectionObserver;
+    using namespace Web::LongTasks;
     using namespace Web::MediaCapabilitiesAPI;
     using namespace Web::NavigationTiming;
     using namespace Web::PerformanceTimeline;
     using namespace Web::RequestIdleCallback;
     using namespace Web::ResizeObserver;
+using namespace Web::ResourceTiming;
     using namespace Web::Selection;
     using namespace Web::StorageAPI;
     using namespace Web::Streams;
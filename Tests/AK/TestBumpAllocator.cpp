@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/BumpAllocator.h>
+
+static size_t s_live_objects = 0;
+
+// Sized so that the space left at the end of a chunk is smaller than the chunk header.
+struct LargeObject {
+    LargeObject() { ++s_live_objects; }
+    ~LargeObject() { --s_live_objects; }
+
+    u8 padding[2044];
+};
+
+TEST_CASE(uniform_destroys_every_object_once)
+{
+    {
+        UniformBumpAllocator<LargeObject> allocator;
+        for (size_t i = 0; i < 5; ++i)
+            EXPECT(allocator.allocate() != nullptr);
+        EXPECT_EQ(s_live_objects, 5u);
+    }
+    EXPECT_EQ(s_live_objects, 0u);
+}
+
+TEST_CASE(uniform_deallocate_all_and_reuse)
+{
+    UniformBumpAllocator<LargeObject> allocator;
+    for (size_t i = 0; i < 5; ++i)
+        allocator.allocate();
+    allocator.deallocate_all();
+    EXPECT_EQ(s_live_objects, 0u);
+
+    for (size_t i = 0; i < 3; ++i)
+        allocator.allocate();
+    EXPECT_EQ(s_live_objects, 3u);
+}
@@ -80,6 +80,18 @@ TEST_CASE(string_builder)
     EXPECT_EQ(builder.to_byte_string(), " 42  21 ");
 }
 
+TEST_CASE(string_builder_with_long_arguments)
+{
+    auto long_string = ByteString::repeated('a', StringBuilder::inline_capacity * 2);
+
+    StringBuilder builder;
+    builder.appendff("{}|{}|{}", long_string, long_string.view(), 42);
+    builder.appendff("{0}{0}", "b"sv);
+
+    EXPECT_EQ(builder.length(), long_string.length() * 2 + 6);
+    EXPECT_EQ(builder.string_view(), ByteString::formatted("{}|{}|42bb", long_string, long_string));
+}
+
 TEST_CASE(format_without_arguments)
 {
     EXPECT_EQ(ByteString::formatted("foo"), "foo");
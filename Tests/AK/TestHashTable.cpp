@@ -481,3 +481,81 @@ TEST_CASE(values)
     EXPECT_EQ(values[1], 30);
     EXPECT_EQ(values[2], 20);
 }
+
+static constexpr size_t benchmark_value_count = 100'000;
+
+static u32 benchmark_value(size_t index)
+{
+    // Spread the values out so that they don't simply end up in consecutive buckets.
+    return static_cast<u32>(index) * 2654435761u;
+}
+
+BENCHMARK_CASE(benchmark_insert_ints)
+{
+    for (size_t round = 0; round < 10; ++round) {
+        HashTable<u32> table;
+        for (size_t i = 0; i < benchmark_value_count; ++i)
+            table.set(benchmark_value(i));
+        EXPECT_EQ(table.size(), benchmark_value_count);
+    }
+}
+
+BENCHMARK_CASE(benchmark_find_ints)
+{
+    HashTable<u32> table;
+    for (size_t i = 0; i < benchmark_value_count; ++i)
+        table.set(benchmark_value(i));
+
+    size_t found = 0;
+    for (size_t round = 0; round < 10; ++round) {
+        // Half of these lookups hit, the other half miss.
+        for (size_t i = benchmark_value_count / 2; i < benchmark_value_count * 3 / 2; ++i)
+            found += table.contains(benchmark_value(i));
+    }
+    EXPECT_EQ(found, benchmark_value_count * 5);
+}
+
+BENCHMARK_CASE(benchmark_find_strings)
+{
+    Vector<ByteString> strings;
+    for (size_t i = 0; i < benchmark_value_count / 4; ++i)
+        strings.append(ByteString::formatted("string-{}", benchmark_value(i)));
+
+    HashTable<ByteString> table;
+    for (auto const& string : strings)
+        table.set(string);
+
+    size_t found = 0;
+    for (size_t round = 0; round < 10; ++round) {
+        for (auto const& string : strings)
+            found += table.contains(string);
+    }
+    EXPECT_EQ(found, strings.size() * 10);
+}
+
+BENCHMARK_CASE(benchmark_insert_and_remove_ints)
+{
+    HashTable<u32> table;
+    for (size_t i = 0; i < 1'000; ++i)
+        table.set(benchmark_value(i));
+
+    for (size_t i = 1'000; i < benchmark_value_count * 10; ++i) {
+        table.set(benchmark_value(i));
+        table.remove(benchmark_value(i - 1'000));
+    }
+    EXPECT_EQ(table.size(), 1'000u);
+}
+
+BENCHMARK_CASE(benchmark_iterate_ints)
+{
+    HashTable<u32> table;
+    for (size_t i = 0; i < benchmark_value_count; ++i)
+        table.set(benchmark_value(i));
+
+    u32 sum = 0;
+    for (size_t round = 0; round < 100; ++round) {
+        for (auto value : table)
+            sum += value;
+    }
+    EXPECT_NE(sum, 0u);
+}
@@ -101,6 +101,21 @@ TEST_CASE(json_encoded_surrogates)
     }
 }
 
+TEST_CASE(json_long_string)
+{
+    {
+        auto json = JsonValue::from_string("\"The quick brown fox jumps over the lazy dog\""sv).value();
+        EXPECT_EQ(json.as_string(), "The quick brown fox jumps over the lazy dog"sv);
+    }
+    {
+        auto json = JsonValue::from_string("\"The quick brown fox\\njumps over the \\\"lazy\\\" dog\""sv).value();
+        EXPECT_EQ(json.as_string(), "The quick brown fox\njumps over the \"lazy\" dog"sv);
+    }
+
+    EXPECT(JsonValue::from_string("\"The quick brown fox\njumps over the lazy dog\""sv).is_error());
+    EXPECT(JsonValue::from_string("\"The quick brown fox jumps over the lazy dog"sv).is_error());
+}
+
 /*
 FIXME: Parse JSON from a Utf8View
 
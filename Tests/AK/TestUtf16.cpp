@@ -425,3 +425,17 @@ TEST_CASE(little_endian)
         EXPECT_EQ(data, string);
     }
 }
+
+TEST_CASE(ascii_endianness)
+{
+    auto big_endian = MUST(AK::utf8_to_utf16("abc"sv, AK::Endianness::Big));
+    EXPECT_EQ(big_endian, to_array<u16>({ 0x6100, 0x6200, 0x6300 }));
+    EXPECT_EQ(MUST(Utf16View(big_endian, AK::Endianness::Big).to_utf8()), "abc"sv);
+
+    auto little_endian = MUST(AK::utf8_to_utf16("abc"sv, AK::Endianness::Little));
+    EXPECT_EQ(little_endian, to_array<u16>({ 0x61, 0x62, 0x63 }));
+    EXPECT_EQ(MUST(Utf16View(little_endian, AK::Endianness::Little).to_utf8()), "abc"sv);
+
+    auto host = MUST(AK::utf8_to_utf16("abc"sv));
+    EXPECT_EQ(host, to_array<u16>({ 'a', 'b', 'c' }));
+}
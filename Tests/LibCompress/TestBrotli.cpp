@@ -162,3 +162,29 @@ TEST_CASE(brotli_decompress_zero_one_bin)
     EXPECT(bytes_read == 32 * MiB);
     EXPECT(brotli_stream.is_eof());
 }
+
+TEST_CASE(brotli_decompress_in_small_reads)
+{
+    // Reads that stop in the middle of literal runs and copies have to pick up where they left off.
+    ByteString path = "brotli-test-files/happy3rd.html";
+
+    auto cmp_file = MUST(Core::File::open(path, Core::File::OpenMode::Read));
+    auto cmp_data = MUST(cmp_file->read_until_eof());
+
+    auto file = MUST(Core::File::open(ByteString::formatted("{}.br", path), Core::File::OpenMode::Read));
+    auto brotli_stream = Compress::BrotliDecompressionStream { MaybeOwned<Stream> { *file } };
+
+    u8 buffer_raw[7];
+    Bytes buffer { buffer_raw, 7 };
+
+    ByteBuffer data;
+    while (true) {
+        auto bytes = MUST(brotli_stream.read_some(buffer));
+        if (bytes.is_empty())
+            break;
+        data.append(bytes);
+    }
+
+    EXPECT_EQ(data, cmp_data);
+    EXPECT(brotli_stream.is_eof());
+}
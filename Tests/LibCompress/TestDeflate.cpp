@@ -58,6 +58,29 @@ TEST_CASE(canonical_code_complex)
         EXPECT_EQ(MUST(huffman.read_symbol(bit_stream)), output[idx]);
 }
 
+TEST_CASE(canonical_code_long_codes)
+{
+    // Codes of lengths 1 to 12 (with two of length 12), so some symbols are too long for the prefix table. The input ends
+    // with short codes and too few bits left to fill a full lookup.
+    Array<u8, 13> const code {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0c
+    };
+    Array<u8, 5> const input {
+        0xff, 0xff, 0x7f, 0xff, 0x03
+    };
+    Array<u32, 8> const output {
+        0x0c, 0x0b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    auto const huffman = Compress::CanonicalCode::from_bytes(code).value();
+    auto memory_stream = MUST(try_make<FixedMemoryStream>(input));
+    LittleEndianInputBitStream bit_stream { move(memory_stream) };
+
+    for (size_t idx = 0; idx < 8; ++idx)
+        EXPECT_EQ(MUST(huffman.read_symbol(bit_stream)), output[idx]);
+    EXPECT(huffman.read_symbol(bit_stream).is_error());
+}
+
 TEST_CASE(invalid_canonical_code)
 {
     Array<u8, 257> code;
@@ -152,6 +175,18 @@ TEST_CASE(deflate_round_trip_compress_large)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(deflate_round_trip_compress_parallel)
+{
+    // Large enough to be split into several segments, with the last one being shorter than the others.
+    auto size = Compress::DeflateCompressor::parallel_segment_size * 3 + 1234;
+    auto original = ByteBuffer::create_zeroed(size).release_value();
+    for (size_t offset = 0; offset < size; offset += 4096)
+        fill_with_random(original.bytes().slice(offset, min<size_t>(1024, size - offset)));
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original, Compress::DeflateCompressor::CompressionLevel::FAST));
+    auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(deflate_compress_literals)
 {
     // This byte array is known to not produce any back references with our lz77 implementation even at the highest compression settings
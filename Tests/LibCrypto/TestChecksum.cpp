@@ -21,6 +21,7 @@ TEST_CASE(test_adler32)
     do_test("abc"sv.bytes(), 0x024d0127);
     do_test("message digest"sv.bytes(), 0x29750586);
     do_test("abcdefghijklmnopqrstuvwxyz"sv.bytes(), 0x90860b20);
+    do_test("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789+/"sv.bytes(), 0x0a071566);
 }
 
 TEST_CASE(test_cksum)
@@ -62,4 +63,25 @@ TEST_CASE(test_crc32)
     do_test(""sv.bytes(), 0x0);
     do_test("The quick brown fox jumps over the lazy dog"sv.bytes(), 0x414FA339);
     do_test("various CRC algorithms input data"sv.bytes(), 0x9BD366AE);
+
+    // Long enough to go through the folding paths, both aligned and misaligned.
+    Array<u8, 1000> data;
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<u8>(i);
+    do_test(data, 0x74E3FB41);
+    do_test(data.span().slice(1), 0xC02003A2);
+}
+
+TEST_CASE(test_crc32_combine)
+{
+    auto first = "The quick brown fox "sv.bytes();
+    auto second = "jumps over the lazy dog"sv.bytes();
+
+    auto first_digest = Crypto::Checksum::CRC32(first).digest();
+    auto second_digest = Crypto::Checksum::CRC32(second).digest();
+    EXPECT_EQ(first_digest, 0x88B075E2u);
+    EXPECT_EQ(second_digest, 0x18786794u);
+
+    EXPECT_EQ(Crypto::Checksum::CRC32::combine(first_digest, second_digest, second.size()), 0x414FA339u);
+    EXPECT_EQ(Crypto::Checksum::CRC32::combine(first_digest, 0, 0), first_digest);
 }
@@ -208,6 +208,27 @@ TEST_CASE(test_jpeg_sof0_several_scans)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 592, 800 }));
 }
 
+TEST_CASE(test_jpeg_truncated)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes().trim(file->bytes().size() / 2)));
+
+    TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 592, 800 }));
+}
+
+TEST_CASE(test_jpeg_scaled_decoding)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    auto scaled_frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 100, 100 }));
+    EXPECT_EQ(scaled_frame.image->size(), Gfx::IntSize(148, 200));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(592, 800));
+}
+
 TEST_CASE(test_odd_mcu_restart_interval)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/odd-restart.jpg"sv)));
@@ -0,0 +1,12 @@
+// Array construction, iteration and the common higher-order methods.
+function benchmark() {
+    const array = [];
+    for (let i = 0; i < 100000; ++i) array.push(i);
+
+    const doubled = array.map(x => x * 2);
+    const even = doubled.filter(x => x % 4 === 0);
+    const sum = even.reduce((accumulator, x) => accumulator + x, 0);
+
+    const sorted = array.slice(0, 20000).sort((a, b) => b - a);
+    if (sum !== 4999900000 || sorted[0] !== 19999) throw new Error("Wrong result");
+}
@@ -0,0 +1,24 @@
+// Creating and calling closures, and passing callbacks around.
+function makeCounter(step) {
+    let count = 0;
+    return () => (count += step);
+}
+
+function compose(f, g) {
+    return x => f(g(x));
+}
+
+function benchmark() {
+    let total = 0;
+    for (let i = 0; i < 10000; ++i) {
+        const counter = makeCounter(i % 5);
+        for (let j = 0; j < 10; ++j) total += counter();
+    }
+
+    const addOne = x => x + 1;
+    const double = x => x * 2;
+    const composed = compose(addOne, double);
+    for (let i = 0; i < 200000; ++i) total += composed(i) & 1;
+
+    if (total !== 1300000) throw new Error("Wrong result");
+}
@@ -0,0 +1,16 @@
+// Round-tripping a medium-sized object graph through JSON.
+const data = [];
+for (let i = 0; i < 2000; ++i) {
+    data.push({
+        id: i,
+        name: `item ${i}`,
+        tags: ["alpha", "beta", "gamma"],
+        nested: { value: i * 1.5, flag: i % 2 === 0, text: "some \"quoted\" text\n" },
+    });
+}
+
+function benchmark() {
+    const text = JSON.stringify(data);
+    const parsed = JSON.parse(text);
+    if (parsed.length !== data.length || parsed[1999].nested.value !== 2998.5) throw new Error("Wrong result");
+}
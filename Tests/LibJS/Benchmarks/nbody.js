@@ -0,0 +1,36 @@
+// Floating-point heavy physics simulation, like the n-body benchmarks in Kraken and the Computer Language Benchmarks
+// Game.
+function benchmark() {
+    const bodies = [];
+    for (let i = 0; i < 5; ++i) {
+        bodies.push({ x: i, y: i * 0.5, z: -i, vx: 0.01 * i, vy: 0, vz: -0.01 * i, mass: 1 + i });
+    }
+
+    const dt = 0.01;
+    for (let step = 0; step < 20000; ++step) {
+        for (let i = 0; i < bodies.length; ++i) {
+            const a = bodies[i];
+            for (let j = i + 1; j < bodies.length; ++j) {
+                const b = bodies[j];
+                const dx = a.x - b.x;
+                const dy = a.y - b.y;
+                const dz = a.z - b.z;
+                const distanceSquared = dx * dx + dy * dy + dz * dz + 0.01;
+                const magnitude = dt / (distanceSquared * Math.sqrt(distanceSquared));
+                a.vx -= dx * b.mass * magnitude;
+                a.vy -= dy * b.mass * magnitude;
+                a.vz -= dz * b.mass * magnitude;
+                b.vx += dx * a.mass * magnitude;
+                b.vy += dy * a.mass * magnitude;
+                b.vz += dz * a.mass * magnitude;
+            }
+        }
+        for (const body of bodies) {
+            body.x += dt * body.vx;
+            body.y += dt * body.vy;
+            body.z += dt * body.vz;
+        }
+    }
+
+    if (!Number.isFinite(bodies[0].x)) throw new Error("Wrong result");
+}
@@ -0,0 +1,33 @@
+// Monomorphic and polymorphic property loads and stores, plus method calls through prototypes.
+class Point {
+    constructor(x, y) {
+        this.x = x;
+        this.y = y;
+    }
+
+    length() {
+        return Math.sqrt(this.x * this.x + this.y * this.y);
+    }
+}
+
+function benchmark() {
+    const points = [];
+    for (let i = 0; i < 1000; ++i) {
+        if (i % 3 === 0) points.push(new Point(i, i));
+        else if (i % 3 === 1) points.push({ x: i, y: i, z: 0 });
+        else points.push({ y: i, x: i });
+    }
+
+    let sum = 0;
+    for (let round = 0; round < 100; ++round) {
+        for (const point of points) {
+            point.x += 1;
+            sum += point.x + point.y;
+        }
+    }
+
+    const point = new Point(3, 4);
+    for (let i = 0; i < 100000; ++i) sum += point.length();
+
+    if (sum <= 0) throw new Error("Wrong result");
+}
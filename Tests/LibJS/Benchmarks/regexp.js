@@ -0,0 +1,14 @@
+// Matching, replacing and splitting with regular expressions.
+const words = [];
+for (let i = 0; i < 1000; ++i) words.push(`word${i} foo@example${i % 10}.com 2024-0${(i % 9) + 1}-1${i % 10}`);
+const text = words.join("\n");
+
+function benchmark() {
+    const emails = text.match(/[a-z]+@[a-z0-9]+\.com/g);
+    const dates = [...text.matchAll(/(\d{4})-(\d{2})-(\d{2})/g)];
+    const replaced = text.replace(/word(\d+)/g, (_, number) => `W${number}`);
+    const lines = text.split(/\r?\n/);
+
+    if (emails.length !== 1000 || dates.length !== 1000 || !replaced.startsWith("W0") || lines.length !== 1000)
+        throw new Error("Wrong result");
+}
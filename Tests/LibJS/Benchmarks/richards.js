@@ -0,0 +1,65 @@
+// A small task scheduler in the spirit of the Richards benchmark: lots of object allocation, virtual calls and
+// linked list manipulation.
+class Packet {
+    constructor(next, id) {
+        this.next = next;
+        this.id = id;
+        this.count = 0;
+    }
+}
+
+class Task {
+    constructor(id, priority) {
+        this.id = id;
+        this.priority = priority;
+        this.queue = null;
+        this.processed = 0;
+    }
+
+    enqueue(packet) {
+        packet.next = this.queue;
+        this.queue = packet;
+    }
+
+    run() {
+        const packet = this.queue;
+        if (!packet) return null;
+        this.queue = packet.next;
+        packet.count++;
+        this.processed++;
+        return packet;
+    }
+}
+
+class WorkerTask extends Task {
+    run() {
+        const packet = super.run();
+        if (packet) packet.id = (packet.id * 31 + this.id) % 1000;
+        return packet;
+    }
+}
+
+function benchmark() {
+    const tasks = [];
+    for (let i = 0; i < 10; ++i) tasks.push(i % 2 ? new WorkerTask(i, i) : new Task(i, i));
+
+    let packets = null;
+    for (let i = 0; i < 1000; ++i) packets = new Packet(packets, i);
+    for (let packet = packets; packet;) {
+        const next = packet.next;
+        tasks[packet.id % tasks.length].enqueue(packet);
+        packet = next;
+    }
+
+    let processed = 0;
+    for (let round = 0; round < 200; ++round) {
+        for (let i = 0; i < tasks.length; ++i) {
+            const packet = tasks[i].run();
+            if (!packet) continue;
+            ++processed;
+            tasks[(i + packet.id) % tasks.length].enqueue(packet);
+        }
+    }
+
+    if (processed !== 2000) throw new Error("Wrong result");
+}
@@ -0,0 +1,14 @@
+// Building strings by concatenation, template literals and joining.
+function benchmark() {
+    let concatenated = "";
+    for (let i = 0; i < 20000; ++i) concatenated += i + ",";
+
+    const parts = [];
+    for (let i = 0; i < 20000; ++i) parts.push(`<li class="item-${i % 7}">${i}</li>`);
+    const joined = parts.join("");
+
+    let characters = 0;
+    for (let i = 0; i < joined.length; i += 7) characters += joined.charCodeAt(i);
+
+    if (concatenated.length !== 108890 || characters <= 0) throw new Error("Wrong result");
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonParser.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <AK/Statistics.h>
+#include <AK/Vector.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/File.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Script.h>
+#include <LibMain/Main.h>
+
+// Every benchmark is a script that defines a global function called `benchmark`. The script itself is run once, then
+// benchmark() is called a number of times to warm up, and a number of times while being timed.
+
+struct BenchmarkResult {
+    ByteString name;
+    Statistics<double> milliseconds;
+};
+
+static ErrorOr<Vector<ByteString>> collect_benchmark_paths(Vector<StringView> const& paths)
+{
+    Vector<ByteString> benchmark_paths;
+
+    for (auto path : paths) {
+        if (!FileSystem::is_directory(path)) {
+            TRY(benchmark_paths.try_append(path));
+            continue;
+        }
+
+        Core::DirIterator iterator(path, Core::DirIterator::SkipDots);
+        while (iterator.has_next()) {
+            auto file_path = iterator.next_full_path();
+            if (file_path.ends_with(".js"sv))
+                TRY(benchmark_paths.try_append(move(file_path)));
+        }
+    }
+
+    quick_sort(benchmark_paths);
+    return benchmark_paths;
+}
+
+static ErrorOr<BenchmarkResult> run_benchmark(StringView path, size_t warmup_iterations, size_t iterations)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto source = TRY(file->read_until_eof());
+
+    // Every benchmark gets a fresh VM, so that they can't affect each other through the heap or inline caches.
+    auto vm = TRY(JS::VM::create());
+
+    JS::GCPtr<JS::Realm> realm;
+    auto root_execution_context = MUST(JS::Realm::initialize_host_defined_realm(
+        *vm,
+        [&](JS::Realm& realm_) -> JS::GlobalObject* {
+            realm = &realm_;
+            return nullptr;
+        },
+        nullptr));
+
+    auto script_or_error = JS::Script::parse(source, *realm, path);
+    if (script_or_error.is_error()) {
+        warnln("{}: {}", path, script_or_error.error()[0].to_byte_string());
+        return Error::from_string_literal("Benchmark failed to parse");
+    }
+
+    auto describe_exception = [&](JS::Completion const& completion) {
+        auto error = completion.value()->to_string_without_side_effects();
+        warnln("{}: Uncaught exception: {}", path, error);
+        return Error::from_string_literal("Benchmark threw an exception");
+    };
+
+    if (auto result = vm->bytecode_interpreter().run(*script_or_error.value()); result.is_error())
+        return describe_exception(result.throw_completion());
+
+    auto benchmark = MUST(realm->global_object().get("benchmark"));
+    if (!benchmark.is_function())
+        return Error::from_string_literal("Benchmark does not define a benchmark() function");
+
+    for (size_t i = 0; i < warmup_iterations; ++i) {
+        if (auto result = JS::call(*vm, benchmark, JS::js_undefined()); result.is_error())
+            return describe_exception(result.throw_completion());
+    }
+
+    BenchmarkResult benchmark_result { .name = LexicalPath::title(path), .milliseconds = {} };
+
+    for (size_t i = 0; i < iterations; ++i) {
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        if (auto result = JS::call(*vm, benchmark, JS::js_undefined()); result.is_error())
+            return describe_exception(result.throw_completion());
+        benchmark_result.milliseconds.add(static_cast<double>(timer.elapsed_time().to_nanoseconds()) / 1'000'000.0);
+    }
+
+    return benchmark_result;
+}
+
+static ErrorOr<JsonObject> load_baseline(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    auto json = TRY(JsonParser(contents).parse());
+    if (!json.is_object())
+        return Error::from_string_literal("Baseline is not a JSON object");
+
+    return json.as_object();
+}
+
+ErrorOr<int> serenity_main(Main::Arguments arguments)
+{
+    Vector<StringView> paths;
+    size_t warmup_iterations = 3;
+    size_t iterations = 10;
+    StringView filter;
+    StringView output_path;
+    StringView baseline_path;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Run JavaScript benchmarks and report timing statistics.");
+    args_parser.add_option(warmup_iterations, "Number of untimed iterations before measuring (default: 3)", "warmup", 'w', "n");
+    args_parser.add_option(iterations, "Number of timed iterations (default: 10)", "iterations", 'n', "n");
+    args_parser.add_option(filter, "Only run benchmarks whose name matches the given glob", "filter", 'f', "glob");
+    args_parser.add_option(output_path, "Write the results as JSON to the given file", "output", 'o', "path");
+    args_parser.add_option(baseline_path, "Compare against results previously written with --output", "compare", 'c', "path");
+    args_parser.add_positional_argument(paths, "Benchmark scripts or directories containing them", "paths");
+    args_parser.parse(arguments);
+
+    if (iterations == 0) {
+        warnln("At least one timed iteration is needed");
+        return 1;
+    }
+
+    Optional<JsonObject> baseline;
+    if (!baseline_path.is_empty())
+        baseline = TRY(load_baseline(baseline_path));
+
+    auto benchmark_paths = TRY(collect_benchmark_paths(paths));
+    if (!filter.is_empty()) {
+        benchmark_paths.remove_all_matching([&](auto const& path) {
+            return !LexicalPath::title(path).matches(filter);
+        });
+    }
+
+    JsonObject results;
+    bool had_failure = false;
+
+    outln("{:30} {:>12} {:>12} {:>12} {:>12}{}", "Benchmark", "Median (ms)", "Mean (ms)", "Stddev", "Min (ms)", baseline.has_value() ? "      vs. baseline"sv : ""sv);
+
+    for (auto const& path : benchmark_paths) {
+        auto result_or_error = run_benchmark(path, warmup_iterations, iterations);
+        if (result_or_error.is_error()) {
+            warnln("{}: {}", path, result_or_error.error());
+            had_failure = true;
+            continue;
+        }
+
+        auto& result = result_or_error.value();
+        auto& statistics = result.milliseconds;
+        auto median = statistics.median();
+
+        out("{:30} {:>12.3} {:>12.3} {:>12.3} {:>12.3}", result.name, median, statistics.average(), statistics.standard_deviation(), statistics.min());
+
+        if (baseline.has_value()) {
+            if (auto baseline_result = baseline->get_object(result.name); baseline_result.has_value()) {
+                if (auto baseline_median = baseline_result->get_double_with_precision_loss("median_ms"sv); baseline_median.has_value() && *baseline_median > 0)
+                    out("      {:>+8.1}%", (median / *baseline_median - 1.0) * 100.0);
+            }
+        }
+
+        outln();
+
+        JsonObject summary;
+        summary.set("iterations"sv, statistics.size());
+        summary.set("median_ms"sv, median);
+        summary.set("mean_ms"sv, statistics.average());
+        summary.set("stddev_ms"sv, statistics.standard_deviation());
+        summary.set("min_ms"sv, statistics.min());
+        summary.set("max_ms"sv, statistics.max());
+        results.set(result.name, move(summary));
+    }
+
+    if (!output_path.is_empty()) {
+        auto output_file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write));
+        TRY(output_file->write_until_depleted(results.serialized<StringBuilder>().bytes()));
+    }
+
+    return had_failure ? 1 : 0;
+}
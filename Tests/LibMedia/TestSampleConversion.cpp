@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibMedia/Audio/Resampler.h>
+#include <LibMedia/Audio/SampleFormats.h>
+#include <LibTest/TestCase.h>
+
+static void expect_sample(Audio::Sample sample, float left, float right)
+{
+    EXPECT_APPROXIMATE(sample.left, left);
+    EXPECT_APPROXIMATE(sample.right, right);
+}
+
+TEST_CASE(convert_interleaved_int16)
+{
+    Array<i16, 10> data { 0, 32767, -32767, 16384, 1, -1, 32767, 0, -16384, -32767 };
+    Array<Audio::Sample, 5> samples;
+    Audio::convert_interleaved_pcm_to_samples(Audio::PcmSampleFormat::Int16, 2, to_readonly_bytes(data.span()), samples);
+
+    expect_sample(samples[0], 0.0f, 1.0f);
+    expect_sample(samples[1], -1.0f, 16384.0f / 32767);
+    expect_sample(samples[2], 1.0f / 32767, -1.0f / 32767);
+    expect_sample(samples[3], 1.0f, 0.0f);
+    expect_sample(samples[4], -16384.0f / 32767, -1.0f);
+}
+
+TEST_CASE(convert_interleaved_int24)
+{
+    Array<u8, 15> data { 0xff, 0xff, 0x7f, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x40 };
+    Array<Audio::Sample, 5> samples;
+    Audio::convert_interleaved_pcm_to_samples(Audio::PcmSampleFormat::Int24, 1, data, samples);
+
+    expect_sample(samples[0], 1.0f, 1.0f);
+    expect_sample(samples[1], -1.0f, -1.0f);
+    expect_sample(samples[2], 0.0f, 0.0f);
+    expect_sample(samples[3], -1.0f / 8388607, -1.0f / 8388607);
+    expect_sample(samples[4], 0.5f, 0.5f);
+}
+
+TEST_CASE(convert_interleaved_more_than_two_channels)
+{
+    Array<float, 9> data { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f, 0.9f };
+    Array<Audio::Sample, 3> samples;
+    Audio::convert_interleaved_pcm_to_samples(Audio::PcmSampleFormat::Float32, 3, to_readonly_bytes(data.span()), samples);
+
+    expect_sample(samples[0], 0.1f, 0.2f);
+    expect_sample(samples[1], 0.4f, 0.5f);
+    expect_sample(samples[2], 0.7f, 0.8f);
+}
+
+TEST_CASE(convert_planar)
+{
+    Array<u8, 6> left { 0, 64, 128, 192, 255, 128 };
+    Array<u8, 6> right { 255, 192, 128, 64, 0, 0 };
+    Array<ReadonlyBytes, 2> planes { left.span(), right.span() };
+    Array<Audio::Sample, 6> samples;
+    Audio::convert_planar_pcm_to_samples(Audio::PcmSampleFormat::Uint8, planes, samples);
+
+    expect_sample(samples[0], -1.0f, 127.0f / 128);
+    expect_sample(samples[1], -0.5f, 0.5f);
+    expect_sample(samples[2], 0.0f, 0.0f);
+    expect_sample(samples[3], 0.5f, -0.5f);
+    expect_sample(samples[4], 127.0f / 128, -1.0f);
+    expect_sample(samples[5], 0.0f, -1.0f);
+
+    Array<double, 5> mono { 0.5, -0.25, 1.0, 0.0, -1.0 };
+    Array<ReadonlyBytes, 1> mono_planes { to_readonly_bytes(mono.span()) };
+    Array<Audio::Sample, 5> mono_samples;
+    Audio::convert_planar_pcm_to_samples(Audio::PcmSampleFormat::Float64, mono_planes, mono_samples);
+
+    for (size_t i = 0; i < mono.size(); i++)
+        expect_sample(mono_samples[i], mono[i], mono[i]);
+}
+
+static Vector<Audio::Sample> make_sine(u32 sample_rate, double frequency, size_t count)
+{
+    Vector<Audio::Sample> samples;
+    for (size_t i = 0; i < count; i++) {
+        auto value = static_cast<float>(AK::sin(2 * AK::Pi<double> * frequency * i / sample_rate) * 0.5);
+        samples.append({ value, -value });
+    }
+    return samples;
+}
+
+static Vector<Audio::Sample> resample(u32 source_sample_rate, u32 target_sample_rate, ReadonlySpan<Audio::Sample> input, size_t chunk_size)
+{
+    auto resampler = MUST(Audio::Resampler::create(source_sample_rate, target_sample_rate));
+    Vector<Audio::Sample> output;
+    for (size_t i = 0; i < input.size(); i += chunk_size)
+        MUST(resampler->process(input.slice(i, min(chunk_size, input.size() - i)), output));
+    MUST(resampler->flush(output));
+    return output;
+}
+
+TEST_CASE(resample_same_rate)
+{
+    auto input = make_sine(48000, 1000, 1000);
+    auto output = resample(48000, 48000, input, 100);
+
+    EXPECT_EQ(output.size(), input.size());
+    for (size_t i = 0; i < input.size(); i++)
+        expect_sample(output[i], input[i].left, input[i].right);
+}
+
+TEST_CASE(resample_sine)
+{
+    struct Ratio {
+        u32 source;
+        u32 target;
+    };
+    for (auto ratio : Array { Ratio { 44100, 48000 }, Ratio { 48000, 44100 }, Ratio { 8000, 44100 }, Ratio { 96000, 22050 } }) {
+        constexpr double frequency = 1000;
+        constexpr size_t input_size = 5000;
+
+        auto input = make_sine(ratio.source, frequency, input_size);
+        auto output = resample(ratio.source, ratio.target, input, 333);
+
+        EXPECT_EQ(output.size(), ceil_div(input_size * ratio.target, static_cast<size_t>(ratio.source)));
+
+        // Away from the edges, the output should be the same sine sampled at the new rate.
+        auto edge = output.size() / 10;
+        float max_error = 0;
+        for (size_t i = edge; i < output.size() - edge; i++) {
+            auto expected = static_cast<float>(AK::sin(2 * AK::Pi<double> * frequency * i / ratio.target) * 0.5);
+            max_error = max(max_error, AK::fabs(output[i].left - expected));
+            max_error = max(max_error, AK::fabs(output[i].right + expected));
+        }
+        EXPECT(max_error < 0.001f);
+    }
+}
+
+TEST_CASE(resample_in_chunks)
+{
+    auto input = make_sine(44100, 440, 4000);
+    auto whole = resample(44100, 48000, input, input.size());
+    auto chunked = resample(44100, 48000, input, 7);
+
+    EXPECT_EQ(whole.size(), chunked.size());
+    for (size_t i = 0; i < whole.size(); i++)
+        expect_sample(chunked[i], whole[i].left, whole[i].right);
+}
@@ -989,6 +989,29 @@ TEST_CASE(theoretically_infinite_loop)
     }
 }
 
+TEST_CASE(exponential_backtracking_without_match)
+{
+    // Backtracking through every way of splitting the a's would take forever; the DFA sees that no 'b' ever follows.
+    Regex<ECMA262> re("(a|aa)*b"sv, ECMAScriptFlags::Global);
+    auto subject = ByteString::formatted("{}c", ByteString::repeated('a', 100));
+    auto result = re.match(subject);
+    EXPECT_EQ(result.success, false);
+
+    subject = ByteString::formatted("{}cab", ByteString::repeated('a', 100));
+    result = re.match(subject);
+    EXPECT_EQ(result.success, true);
+    EXPECT_EQ(result.matches.size(), 1u);
+    EXPECT_EQ(result.matches.first().view.to_byte_string(), "ab"sv);
+    EXPECT_EQ(result.matches.first().global_offset, 101u);
+    EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "a"sv);
+
+    // A multi-character string compare must not be mistaken for a single character one.
+    Regex<PosixExtended> posix_re("hello(world|there)");
+    auto posix_result = posix_re.match("hellx hello there hellothere"sv, PosixFlags::Global);
+    EXPECT_EQ(posix_result.success, true);
+    EXPECT_EQ(posix_result.matches.first().view.to_byte_string(), "hellothere"sv);
+}
+
 static auto g_lots_of_a_s = ByteString::repeated('a', 10'000'000);
 
 BENCHMARK_CASE(fork_performance)
@@ -1087,6 +1110,70 @@ TEST_CASE(optimizer_alternation)
     }
 }
 
+TEST_CASE(optimizer_required_literals)
+{
+    Array tests {
+        // Pattern, Subject, Literal prefix, Required substring, Expected match
+        Tuple { "foo(a|b)*bar"sv, "xfoo foobabarx"sv, "foo"sv, ""sv, "foobabar"sv },
+        Tuple { "^(ab)c"sv, "abc"sv, "abc"sv, ""sv, "abc"sv },
+        Tuple { ".*ERROR:\\d+"sv, "ok\nwarn ERROR:12"sv, ""sv, "ERROR:"sv, "warn ERROR:12"sv },
+        // Literals in negative lookarounds and optional parts are not required.
+        Tuple { "(?!abc)a?bd"sv, "abc bd"sv, ""sv, "bd"sv, "bd"sv },
+        Tuple { "ab|cd"sv, "xcd"sv, ""sv, ""sv, "cd"sv },
+        // A lookbehind can match before the start, so nothing is extracted.
+        Tuple { "(?<=ab)c"sv, "abc"sv, ""sv, ""sv, "c"sv },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>(), ECMAScriptFlags::Global);
+        auto& optimization_data = re.parser_result.optimization_data;
+        EXPECT_EQ(optimization_data.literal_prefix.value_or(""), test.get<2>());
+        EXPECT_EQ(optimization_data.required_substring.value_or(""), test.get<3>());
+
+        auto result = re.match(test.get<1>());
+        EXPECT(result.success);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), test.get<4>());
+    }
+}
+
+TEST_CASE(failed_attempt_captures_are_discarded)
+{
+    // The attempt at offset 0 captures "a" before failing, which must not show up in the match found at offset 1.
+    Regex<ECMA262> re("b|(a)x(?=.)", ECMAScriptFlags::Global);
+    auto result = re.match("ab"sv);
+    EXPECT(result.success);
+    EXPECT_EQ(result.matches.first().view.to_byte_string(), "b"sv);
+    for (auto& group : result.capture_group_matches.first())
+        EXPECT(group.view.is_null());
+}
+
+TEST_CASE(compiled_program)
+{
+    // Once a pattern has been executed often enough it runs as a compiled program, which has to agree with the VM.
+    Regex<ECMA262> re("(\\w+)=(\\d*)(?:,|$)|(?<flag>!+)"sv, ECMAScriptFlags::Global);
+    auto vm_result = re.match("a=1, !! bb=22,c=x d="sv);
+    EXPECT_EQ(vm_result.count, 4u);
+
+    for (size_t i = 0; i < regex::c_compilation_threshold; ++i) {
+        re.start_offset = 0;
+        auto result = re.match("a=1, !! bb=22,c=x d="sv);
+        EXPECT_EQ(result.count, vm_result.count);
+        EXPECT_EQ(result.n_operations, vm_result.n_operations);
+        for (size_t j = 0; j < result.count; ++j) {
+            EXPECT_EQ(result.matches[j].view.to_byte_string(), vm_result.matches[j].view.to_byte_string());
+            EXPECT_EQ(result.capture_group_matches[j].size(), vm_result.capture_group_matches[j].size());
+            for (size_t k = 0; k < result.capture_group_matches[j].size(); ++k)
+                EXPECT_EQ(result.capture_group_matches[j][k].view.to_byte_string(), vm_result.capture_group_matches[j][k].view.to_byte_string());
+        }
+    }
+
+    re.start_offset = 0;
+    auto result = re.match("x=7"sv);
+    EXPECT_EQ(result.count, 1u);
+    EXPECT_EQ(result.capture_group_matches[0][0].view.to_byte_string(), "x"sv);
+    EXPECT_EQ(result.capture_group_matches[0][1].view.to_byte_string(), "7"sv);
+}
+
 TEST_CASE(start_anchor)
 {
     // Ensure that a circumflex at the start only matches the start of the line.
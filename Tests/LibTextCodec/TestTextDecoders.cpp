@@ -70,3 +70,32 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_windows1252_decode)
+{
+    auto& decoder = *TextCodec::decoder_for("windows-1252"sv);
+    auto test_string = "Caf\xe9 na\xefve \x80 and some more plain ASCII text"sv;
+
+    EXPECT_EQ(MUST(decoder.to_utf8(test_string)), "Café naïve € and some more plain ASCII text"sv);
+}
+
+TEST_CASE(test_shift_jis_decode)
+{
+    auto& decoder = *TextCodec::decoder_for("shift_jis"sv);
+    // This is the output of `python3 -c "print('plain text あ more plain text'.encode('shift_jis'))"`.
+    auto test_string = "plain text \x82\xa0 more plain text"sv;
+
+    Vector<u32> processed_code_points;
+    MUST(decoder.process(test_string, [&](u32 code_point) {
+        return processed_code_points.try_append(code_point);
+    }));
+    EXPECT_EQ(processed_code_points.size(), 28u);
+    EXPECT_EQ(processed_code_points[11], 0x3042u);
+
+    EXPECT_EQ(MUST(decoder.to_utf8(test_string)), "plain text あ more plain text"sv);
+
+    // A lead byte at the end of the input decodes to a replacement character, and an invalid trail byte that is ASCII
+    // is decoded again on its own.
+    EXPECT_EQ(MUST(decoder.to_utf8("abcdefgh\x82"sv)), "abcdefgh�"sv);
+    EXPECT_EQ(MUST(decoder.to_utf8("\x82 abcdefgh"sv)), "� abcdefgh"sv);
+}
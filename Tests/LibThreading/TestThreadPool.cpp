@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Time.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+#include <unistd.h>
+
+using namespace AK::TimeLiterals;
+
+template<typename Condition>
+static void wait_until(Condition condition)
+{
+    static constexpr auto delay = 1_ms;
+
+    for (auto i = 0; i < 2000; ++i) {
+        if (condition())
+            return;
+
+        usleep(delay.to_microseconds());
+    }
+
+    FAIL("Timed out waiting for the thread pool");
+}
+
+TEST_CASE(runs_all_tasks)
+{
+    auto pool = MUST(Threading::ThreadPool::create(4));
+    EXPECT_EQ(pool->thread_count(), 4u);
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> sum = 0;
+    for (size_t i = 1; i <= 1000; ++i)
+        pool->submit([&sum, i] { sum += i; });
+
+    wait_until([&] { return sum.load() == 500500; });
+}
+
+TEST_CASE(tasks_can_submit_tasks)
+{
+    auto pool = MUST(Threading::ThreadPool::create(2));
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> count = 0;
+    for (size_t i = 0; i < 10; ++i) {
+        pool->submit([&pool = *pool, &count] {
+            for (size_t j = 0; j < 10; ++j)
+                pool.submit([&count] { ++count; });
+        });
+    }
+
+    wait_until([&] { return count.load() == 100; });
+}
+
+TEST_CASE(higher_priority_tasks_run_first)
+{
+    auto pool = MUST(Threading::ThreadPool::create(1));
+
+    // Keep the only worker busy until everything else has been queued.
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> release = false;
+    pool->submit([&release] {
+        while (!release.load())
+            usleep(1000);
+    });
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Threading::Mutex order_mutex;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<int> order;
+    auto record = [&](int value) {
+        return [&, value] {
+            Threading::MutexLocker locker { order_mutex };
+            order.append(value);
+        };
+    };
+    pool->submit(record(3), Threading::ThreadPool::Priority::Background);
+    pool->submit(record(2), Threading::ThreadPool::Priority::Normal);
+    pool->submit(record(1), Threading::ThreadPool::Priority::UserBlocking);
+    auto last = pool->submit(record(4), Threading::ThreadPool::Priority::Background);
+
+    release.store(true);
+    wait_until([&] { return last->has_finished(); });
+
+    Threading::MutexLocker locker { order_mutex };
+    EXPECT_EQ(order, (Vector<int> { 1, 2, 3, 4 }));
+}
+
+TEST_CASE(canceled_tasks_do_not_run)
+{
+    auto pool = MUST(Threading::ThreadPool::create(1));
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> started = false;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> release = false;
+    auto blocker = pool->submit([&started, &release] {
+        started = true;
+        while (!release.load())
+            usleep(1000);
+    });
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> ran = false;
+    auto canceled = pool->submit([&ran] { ran = true; });
+    auto last = pool->submit([] {});
+
+    // A task that is already running can't be canceled.
+    wait_until([&] { return started.load(); });
+    EXPECT(!blocker->cancel());
+
+    EXPECT(canceled->cancel());
+    EXPECT(canceled->is_canceled());
+
+    release.store(true);
+    wait_until([&] { return last->has_finished(); });
+
+    EXPECT(!ran.load());
+    EXPECT(blocker->has_finished());
+    EXPECT(!canceled->has_finished());
+    EXPECT(!last->cancel());
+}
@@ -0,0 +1,47 @@
+// Rendering microbenchmarks for LibWeb. Run one with:
+//
+//     headless-browser --layout-test-mode --dump-text Tests/LibWeb/Benchmarks/<name>.html
+//
+// Every page builds a synthetic document, then uses the internals object to run each rendering phase from scratch a
+// number of times. The timings of each phase are printed as JSON, in milliseconds.
+
+const __benchmarkPhases = {
+    style: () => internals.measureStyleUpdate(),
+    selectors: () => internals.measureSelectorMatching(),
+    layout: () => internals.measureLayout(),
+    paint: () => internals.measureDisplayListRecording(),
+};
+
+function __summarizeSamples(samples) {
+    samples.sort((a, b) => a - b);
+    const mean = samples.reduce((total, sample) => total + sample, 0) / samples.length;
+    const round = value => Math.round(value * 1000) / 1000;
+    return {
+        min: round(samples[0]),
+        median: round(samples[Math.floor(samples.length / 2)]),
+        mean: round(mean),
+        max: round(samples[samples.length - 1]),
+    };
+}
+
+function benchmark(name, setup, { iterations = 20, warmup = 3 } = {}) {
+    if (globalThis.internals === undefined) {
+        console.log("Benchmarks need the internals object, run them with --layout-test-mode");
+        return;
+    }
+
+    window.addEventListener("load", () => {
+        setup(document.body);
+
+        const result = { benchmark: name, iterations, phases: {} };
+        for (const [phase, measure] of Object.entries(__benchmarkPhases)) {
+            for (let i = 0; i < warmup; ++i) measure();
+
+            const samples = [];
+            for (let i = 0; i < iterations; ++i) samples.push(measure());
+            result.phases[phase] = __summarizeSamples(samples);
+        }
+
+        internals.signalTextTestIsDone(JSON.stringify(result, null, 4) + "\n");
+    });
+}
@@ -219,6 +219,22 @@ TEST_CASE(doctype)
     EXPECT_END_TAG_TOKEN(html, 23u, 27u);
 }
 
+TEST_CASE(long_runs_of_text_and_attribute_values)
+{
+    auto tokens = run_tokenizer("<p title=\"a fairly long attribute value\">line one\nline two</p>"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 40u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(1);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(title, "a fairly long attribute value", 3u, 8u, 9u, 40u);
+    for (auto c : "line one\nline two"sv) {
+        EXPECT_CHARACTER_TOKEN(c);
+    }
+    EXPECT_EQ(current_token->start_position().line, 1u);
+    EXPECT_END_TAG_TOKEN(p, 10u, 11u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 // NOTE: This relies on the format of HTMLToken::to_string() staying the same.
 //       If that changes, or something is added to the test HTML, the hash needs to be adjusted.
 TEST_CASE(regression)
@@ -41,3 +41,25 @@ TEST_CASE(predefined_character_reference)
     auto const& content = node.children[0]->content.get<XML::Node::Text>();
     EXPECT_EQ(content.builder.string_view(), "Well hello &, <, >, ', and \"!");
 }
+
+TEST_CASE(listener_events)
+{
+    struct RecordingListener : public XML::Listener {
+        virtual void element_start(XML::Name const& name, HashMap<XML::Name, ByteString> const&) override { events.append(ByteString::formatted("<{}>", name)); }
+        virtual void element_end(XML::Name const& name) override { events.append(ByteString::formatted("</{}>", name)); }
+        virtual void text(StringView text) override
+        {
+            if (!text.is_empty())
+                events.append(text);
+        }
+
+        Vector<ByteString> events;
+    };
+
+    XML::Parser parser("<a><b>one</b><c/><b>two</b></a>"sv);
+    RecordingListener listener;
+    MUST(parser.parse_with_listener(listener));
+
+    Vector<ByteString> expected { "<a>", "<b>", "one", "</b>", "<c>", "</c>", "<b>", "two", "</b>", "</a>" };
+    EXPECT_EQ(listener.events, expected);
+}
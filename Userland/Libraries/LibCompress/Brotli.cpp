@@ -15,9 +15,25 @@ ErrorOr<size_t> Brotli::CanonicalCode::read_symbol(LittleEndianInputBitStream& i
 {
     size_t code_bits = 1;
 
+    if (m_prefix_length != 0) {
+        // Close to the end of the stream there may not be enough bits left for a full lookup, in which case the symbol
+        // is read bit by bit instead.
+        auto prefix_or_error = input_stream.peek_bits<size_t>(m_prefix_length);
+        if (!prefix_or_error.is_error()) [[likely]] {
+            auto prefix = prefix_or_error.release_value();
+            if (auto [symbol_value, code_length] = m_prefix_table[prefix]; code_length != 0) {
+                input_stream.discard_previously_peeked_bits(code_length);
+                return symbol_value;
+            }
+
+            // The code is longer than the lookup, so continue the search from the bits we have already looked at.
+            for (size_t i = 0; i < m_prefix_length; ++i)
+                code_bits = (code_bits << 1) | ((prefix >> i) & 1);
+            input_stream.discard_previously_peeked_bits(m_prefix_length);
+        }
+    }
+
     while (code_bits < (1 << 16)) {
-        // FIXME: This is very inefficient and could greatly be improved by implementing this
-        //        algorithm: https://www.hanshq.net/zip.html#huffdec
         size_t index;
         if (binary_search(m_symbol_codes.span(), code_bits, &index))
             return m_symbol_values[index];
@@ -28,6 +44,47 @@ ErrorOr<size_t> Brotli::CanonicalCode::read_symbol(LittleEndianInputBitStream& i
     return Error::from_string_literal("no matching code found");
 }
 
+ErrorOr<void> Brotli::CanonicalCode::build_prefix_table()
+{
+    auto code_length_of = [](size_t code) {
+        // Codes are stored with a leading 1 bit in front of them.
+        size_t length = 0;
+        while ((code >> (length + 1)) != 0)
+            length++;
+        return length;
+    };
+
+    size_t prefix_length = 0;
+    for (auto code : m_symbol_codes) {
+        if (auto length = code_length_of(code); length <= max_prefixed_code_length)
+            prefix_length = max(prefix_length, length);
+    }
+
+    // A code with a single symbol doesn't need any bits to be read at all.
+    if (prefix_length == 0)
+        return {};
+
+    TRY(m_prefix_table.try_resize(1 << prefix_length));
+
+    for (size_t i = 0; i < m_symbol_codes.size(); ++i) {
+        auto code = m_symbol_codes[i];
+        auto length = code_length_of(code);
+        if (length == 0 || length > prefix_length)
+            continue;
+
+        // The first bit of a code is the first one in the stream, so the table is indexed by the code bits in reverse.
+        size_t reversed_code = 0;
+        for (size_t bit = 0; bit < length; ++bit)
+            reversed_code |= ((code >> bit) & 1) << (length - 1 - bit);
+
+        for (size_t index = reversed_code; index < m_prefix_table.size(); index += 1 << length)
+            m_prefix_table[index] = PrefixTableEntry { static_cast<u16>(m_symbol_values[i]), static_cast<u16>(length) };
+    }
+
+    m_prefix_length = prefix_length;
+    return {};
+}
+
 BrotliDecompressionStream::BrotliDecompressionStream(MaybeOwned<Stream> stream)
     : m_input_stream(move(stream))
 {
@@ -227,6 +284,7 @@ ErrorOr<Brotli::CanonicalCode> Brotli::CanonicalCode::read_simple_prefix_code(Li
         }
     }
 
+    TRY(code.build_prefix_table());
     return code;
 }
 
@@ -286,6 +344,8 @@ ErrorOr<Brotli::CanonicalCode> Brotli::CanonicalCode::read_complex_prefix_code(L
         }
     }
 
+    TRY(temp_code.build_prefix_table());
+
     // Read the actual prefix code_value
     sum = 0;
     size_t i = 0;
@@ -381,6 +441,7 @@ ErrorOr<Brotli::CanonicalCode> Brotli::CanonicalCode::read_complex_prefix_code(L
         }
     }
 
+    TRY(final_code.build_prefix_table());
     return final_code;
 }
 
@@ -571,13 +632,18 @@ size_t BrotliDecompressionStream::literal_code_index_from_context()
 
 ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
 {
+    // Everything we output also goes into the lookback buffer, so make sure it has room for all of it up front.
+    if (m_lookback_buffer.has_value())
+        TRY(m_lookback_buffer.value().ensure_capacity(output_buffer.size()));
+
     size_t bytes_read = 0;
     while (bytes_read < output_buffer.size()) {
         if (m_current_state == State::WindowSize) {
             size_t window_bits = TRY(read_window_length());
             m_window_size = (1 << window_bits) - 16;
 
-            m_lookback_buffer = TRY(LookbackBuffer::try_create(m_window_size));
+            m_lookback_buffer = TRY(LookbackBuffer::try_create(1 << window_bits));
+            TRY(m_lookback_buffer.value().ensure_capacity(output_buffer.size()));
 
             m_current_state = State::Idle;
         } else if (m_current_state == State::Idle) {
@@ -736,8 +802,7 @@ ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
                 return Error::from_string_literal("eof");
 
             // TODO: Replace the home-grown LookbackBuffer with AK::CircularBuffer.
-            for (auto c : uncompressed_bytes)
-                m_lookback_buffer.value().write(c);
+            m_lookback_buffer.value().write(uncompressed_bytes);
 
             m_bytes_left -= uncompressed_bytes.size();
             bytes_read += uncompressed_bytes.size();
@@ -780,19 +845,24 @@ ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
                 m_current_state = State::CompressedDistance;
             }
         } else if (m_current_state == State::CompressedLiteral) {
-            if (m_literal_block.length == 0) {
-                TRY(block_read_new_state(m_literal_block));
-            }
-            m_literal_block.length--;
+            // Decode as many literals as we can in one go, rather than going through the state machine for each one.
+            auto& lookback_buffer = m_lookback_buffer.value();
+            size_t literal_count = min(min(m_insert_length, m_bytes_left), output_buffer.size() - bytes_read);
+            for (size_t i = 0; i < literal_count; i++) {
+                if (m_literal_block.length == 0) {
+                    TRY(block_read_new_state(m_literal_block));
+                }
+                m_literal_block.length--;
 
-            size_t literal_code_index = literal_code_index_from_context();
-            size_t literal_value = TRY(m_literal_codes[literal_code_index].read_symbol(m_input_stream));
+                size_t literal_code_index = literal_code_index_from_context();
+                size_t literal_value = TRY(m_literal_codes[literal_code_index].read_symbol(m_input_stream));
 
-            output_buffer[bytes_read] = literal_value;
-            m_lookback_buffer.value().write(literal_value);
-            bytes_read++;
-            m_insert_length--;
-            m_bytes_left--;
+                output_buffer[bytes_read] = literal_value;
+                lookback_buffer.write(literal_value);
+                bytes_read++;
+                m_insert_length--;
+                m_bytes_left--;
+            }
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -906,13 +976,17 @@ ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
                 m_current_state = State::CompressedCopy;
             }
         } else if (m_current_state == State::CompressedCopy) {
-            u8 copy_value = m_lookback_buffer.value().lookback(m_distance);
+            auto& lookback_buffer = m_lookback_buffer.value();
+            size_t copy_count = min(min(m_copy_length, m_bytes_left), output_buffer.size() - bytes_read);
+            for (size_t i = 0; i < copy_count; i++) {
+                u8 copy_value = lookback_buffer.lookback(m_distance);
+                output_buffer[bytes_read + i] = copy_value;
+                lookback_buffer.write(copy_value);
+            }
 
-            output_buffer[bytes_read] = copy_value;
-            m_lookback_buffer.value().write(copy_value);
-            bytes_read++;
-            m_copy_length--;
-            m_bytes_left--;
+            bytes_read += copy_count;
+            m_copy_length -= copy_count;
+            m_bytes_left -= copy_count;
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -920,13 +994,14 @@ ErrorOr<Bytes> BrotliDecompressionStream::read_some(Bytes output_buffer)
                 m_current_state = State::CompressedCommand;
         } else if (m_current_state == State::CompressedDictionary) {
             size_t offset = m_dictionary_data.size() - m_copy_length;
-            u8 dictionary_value = m_dictionary_data[offset];
-
-            output_buffer[bytes_read] = dictionary_value;
-            m_lookback_buffer.value().write(dictionary_value);
-            bytes_read++;
-            m_copy_length--;
-            m_bytes_left--;
+            size_t copy_count = min(min(m_copy_length, m_bytes_left), output_buffer.size() - bytes_read);
+            auto dictionary_bytes = m_dictionary_data.bytes().slice(offset, copy_count);
+
+            output_buffer.overwrite(bytes_read, dictionary_bytes.data(), copy_count);
+            m_lookback_buffer.value().write(dictionary_bytes);
+            bytes_read += copy_count;
+            m_copy_length -= copy_count;
+            m_bytes_left -= copy_count;
 
             if (m_bytes_left == 0)
                 m_current_state = State::Idle;
@@ -31,8 +31,21 @@ public:
 private:
     static ErrorOr<size_t> read_complex_prefix_code_length(LittleEndianInputBitStream&);
 
+    ErrorOr<void> build_prefix_table();
+
+    // Codes up to this length are decoded with a single table lookup, longer ones by searching m_symbol_codes.
+    static constexpr size_t max_prefixed_code_length = 8;
+
+    struct PrefixTableEntry {
+        u16 symbol_value { 0 };
+        u16 code_length { 0 };
+    };
+
     Vector<size_t> m_symbol_codes;
     Vector<size_t> m_symbol_values;
+
+    Vector<PrefixTableEntry> m_prefix_table;
+    size_t m_prefix_length { 0 };
 };
 
 }
@@ -65,30 +78,60 @@ public:
 
     class LookbackBuffer {
     private:
-        LookbackBuffer(FixedArray<u8>& buffer)
+        LookbackBuffer(FixedArray<u8>& buffer, size_t maximum_size)
             : m_buffer(move(buffer))
+            , m_maximum_size(maximum_size)
         {
         }
 
     public:
-        static ErrorOr<LookbackBuffer> try_create(size_t size)
+        // The buffer starts out small and only grows up to maximum_size as data is written, so that short streams with a
+        // large window don't have to allocate all of it.
+        static ErrorOr<LookbackBuffer> try_create(size_t maximum_size)
+        {
+            VERIFY(is_power_of_two(maximum_size));
+            auto buffer = TRY(FixedArray<u8>::create(min(maximum_size, initial_size)));
+            return LookbackBuffer { buffer, maximum_size };
+        }
+
+        // Must be called before writing, so that the next `count` bytes don't overwrite anything still in the window.
+        ErrorOr<void> ensure_capacity(size_t count)
         {
-            auto buffer = TRY(FixedArray<u8>::create(size));
-            return LookbackBuffer { buffer };
+            auto required_size = min(m_total_written + count, m_maximum_size);
+            if (required_size <= m_buffer.size())
+                return {};
+
+            auto new_size = m_buffer.size();
+            while (new_size < required_size)
+                new_size *= 2;
+
+            // The buffer only wraps around once it has reached its maximum size, so everything written so far is still
+            // in order at the start of it.
+            auto new_buffer = TRY(FixedArray<u8>::create(new_size));
+            new_buffer.span().overwrite(0, m_buffer.data(), m_total_written);
+            m_buffer = move(new_buffer);
+            m_offset = m_total_written;
+            return {};
         }
 
         void write(u8 value)
         {
             m_buffer[m_offset] = value;
-            m_offset = (m_offset + 1) % m_buffer.size();
+            m_offset = (m_offset + 1) & (m_buffer.size() - 1);
             m_total_written++;
         }
 
+        void write(ReadonlyBytes bytes)
+        {
+            for (auto value : bytes)
+                write(value);
+        }
+
         u8 lookback(size_t offset) const
         {
             VERIFY(offset <= m_total_written);
             VERIFY(offset <= m_buffer.size());
-            size_t index = (m_offset + m_buffer.size() - offset) % m_buffer.size();
+            size_t index = (m_offset - offset) & (m_buffer.size() - 1);
             return m_buffer[index];
         }
 
@@ -96,16 +139,17 @@ public:
         {
             if (offset > m_total_written || offset > m_buffer.size())
                 return fallback;
-            VERIFY(offset <= m_total_written);
-            VERIFY(offset <= m_buffer.size());
-            size_t index = (m_offset + m_buffer.size() - offset) % m_buffer.size();
+            size_t index = (m_offset - offset) & (m_buffer.size() - 1);
             return m_buffer[index];
         }
 
         size_t total_written() { return m_total_written; }
 
     private:
+        static constexpr size_t initial_size = 4 * KiB;
+
         FixedArray<u8> m_buffer;
+        size_t m_maximum_size { 0 };
         size_t m_offset { 0 };
         size_t m_total_written { 0 };
     };
@@ -9,6 +9,8 @@
 #include <AK/Assertions.h>
 #include <AK/BinarySearch.h>
 #include <AK/MemoryStream.h>
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
 #include <string.h>
 
 #include <LibCompress/Deflate.h>
@@ -24,29 +26,14 @@ static constexpr int EndOfBlock = 256;
 
 CanonicalCode const& CanonicalCode::fixed_literal_codes()
 {
-    static CanonicalCode code;
-    static bool initialized = false;
-
-    if (initialized)
-        return code;
-
-    code = MUST(CanonicalCode::from_bytes(fixed_literal_bit_lengths));
-    initialized = true;
-
+    // This may be called from several compression threads at once, so rely on the thread-safe initialization of statics.
+    static CanonicalCode const code = MUST(CanonicalCode::from_bytes(fixed_literal_bit_lengths));
     return code;
 }
 
 CanonicalCode const& CanonicalCode::fixed_distance_codes()
 {
-    static CanonicalCode code;
-    static bool initialized = false;
-
-    if (initialized)
-        return code;
-
-    code = MUST(CanonicalCode::from_bytes(fixed_distance_bit_lengths));
-    initialized = true;
-
+    static CanonicalCode const code = MUST(CanonicalCode::from_bytes(fixed_distance_bit_lengths));
     return code;
 }
 
@@ -64,6 +51,7 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
     }
 
     if (non_zero_symbols == 1) { // special case - only 1 symbol
+        TRY(code.m_prefix_table.try_resize(2));
         code.m_prefix_table[0] = PrefixTableEntry { static_cast<u16>(last_non_zero), 1u };
         code.m_prefix_table[1] = code.m_prefix_table[0];
         code.m_max_prefixed_code_length = 1;
@@ -127,10 +115,9 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
     if (next_code != (1 << 15))
         return Error::from_string_literal("Failed to decode code lengths");
 
-    for (auto [symbol_code, symbol_value, code_length] : prefix_codes) {
-        if (code_length == 0 || code_length > CanonicalCode::max_allowed_prefixed_code_length)
-            break;
+    TRY(code.m_prefix_table.try_resize(1 << code.m_max_prefixed_code_length));
 
+    for (auto [symbol_code, symbol_value, code_length] : prefix_codes.span().trim(number_of_prefix_codes)) {
         auto shift = code.m_max_prefixed_code_length - code_length;
         symbol_code <<= shift;
 
@@ -145,7 +132,10 @@ ErrorOr<CanonicalCode> CanonicalCode::from_bytes(ReadonlyBytes bytes)
 
 ErrorOr<u32> CanonicalCode::read_symbol(LittleEndianInputBitStream& stream) const
 {
-    auto prefix = TRY(stream.peek_bits<size_t>(m_max_prefixed_code_length));
+    auto prefix_or_error = stream.peek_bits<size_t>(m_max_prefixed_code_length);
+    if (prefix_or_error.is_error()) [[unlikely]]
+        return read_symbol_bit_by_bit(stream);
+    auto prefix = prefix_or_error.release_value();
 
     if (auto [symbol_value, code_length] = m_prefix_table[prefix]; code_length != 0) {
         stream.discard_previously_peeked_bits(code_length);
@@ -167,10 +157,34 @@ ErrorOr<u32> CanonicalCode::read_symbol(LittleEndianInputBitStream& stream) cons
     return Error::from_string_literal("Symbol exceeds maximum symbol number");
 }
 
+ErrorOr<u32> CanonicalCode::read_symbol_bit_by_bit(LittleEndianInputBitStream& stream) const
+{
+    // Close to the end of the stream there may not be enough bits left to peek at a full prefix, so only read as many
+    // as the symbol actually needs. Since the prefix table is indexed LSB-first, the bits read so far (with the rest
+    // left as zero) find the symbol as soon as they make up its whole code.
+    size_t prefix = 0;
+    for (size_t i = 0; i < m_max_prefixed_code_length; ++i) {
+        prefix |= TRY(stream.read_bit()) << i;
+        if (auto [symbol_value, code_length] = m_prefix_table[prefix]; code_length == i + 1)
+            return symbol_value;
+    }
+
+    u16 code_bits = fast_reverse16(prefix, m_max_prefixed_code_length) | (1 << m_max_prefixed_code_length);
+    for (size_t i = m_max_prefixed_code_length; i < 16; ++i) {
+        size_t index;
+        if (binary_search(m_symbol_codes.span(), code_bits, &index))
+            return m_symbol_values[index];
+
+        code_bits = code_bits << 1 | TRY(stream.read_bit());
+    }
+
+    return Error::from_string_literal("Symbol exceeds maximum symbol number");
+}
+
 DeflateDecompressor::CompressedBlock::CompressedBlock(DeflateDecompressor& decompressor, CanonicalCode literal_codes, Optional<CanonicalCode> distance_codes)
     : m_decompressor(decompressor)
-    , m_literal_codes(literal_codes)
-    , m_distance_codes(distance_codes)
+    , m_literal_codes(move(literal_codes))
+    , m_distance_codes(move(distance_codes))
 {
 }
 
@@ -179,37 +193,56 @@ ErrorOr<bool> DeflateDecompressor::CompressedBlock::try_read_more()
     if (m_eof == true)
         return false;
 
-    auto const symbol = TRY(m_literal_codes.read_symbol(*m_decompressor.m_input_stream));
+    auto& input_stream = *m_decompressor.m_input_stream;
+    auto& output_buffer = m_decompressor.m_output_buffer;
 
-    if (symbol >= 286)
-        return Error::from_string_literal("Invalid deflate literal/length symbol");
+    // Decode as many symbols as the output buffer is guaranteed to have room for, rather than just one. Runs of
+    // literals are collected here and written out together.
+    Array<u8, 256> literals;
+    size_t literal_count = 0;
+    auto flush_literals = [&] {
+        output_buffer.write(literals.span().trim(literal_count));
+        literal_count = 0;
+    };
 
-    if (symbol < EndOfBlock) {
-        u8 byte_symbol = symbol;
-        m_decompressor.m_output_buffer.write({ &byte_symbol, sizeof(byte_symbol) });
-        return true;
-    }
+    bool read_anything = false;
+    while (output_buffer.empty_space() >= literal_count + max_back_reference_length) {
+        auto const symbol = TRY(m_literal_codes.read_symbol(input_stream));
 
-    if (symbol == EndOfBlock) {
-        m_eof = true;
-        return false;
-    }
+        if (symbol < EndOfBlock) {
+            literals[literal_count++] = static_cast<u8>(symbol);
+            if (literal_count == literals.size())
+                flush_literals();
+            read_anything = true;
+            continue;
+        }
+
+        flush_literals();
 
-    if (!m_distance_codes.has_value())
-        return Error::from_string_literal("Distance codes have not been initialized");
+        if (symbol == EndOfBlock) {
+            m_eof = true;
+            return read_anything;
+        }
+
+        if (symbol >= 286)
+            return Error::from_string_literal("Invalid deflate literal/length symbol");
 
-    auto const length = TRY(m_decompressor.decode_length(symbol));
-    auto const distance_symbol = TRY(m_distance_codes.value().read_symbol(*m_decompressor.m_input_stream));
-    if (distance_symbol >= 30)
-        return Error::from_string_literal("Invalid deflate distance symbol");
+        if (!m_distance_codes.has_value())
+            return Error::from_string_literal("Distance codes have not been initialized");
 
-    auto const distance = TRY(m_decompressor.decode_distance(distance_symbol));
+        auto const length = TRY(m_decompressor.decode_length(symbol));
+        auto const distance_symbol = TRY(m_distance_codes.value().read_symbol(input_stream));
+        if (distance_symbol >= 30)
+            return Error::from_string_literal("Invalid deflate distance symbol");
 
-    auto copied_length = TRY(m_decompressor.m_output_buffer.copy_from_seekback(distance, length));
+        auto const distance = TRY(m_decompressor.decode_distance(distance_symbol));
 
-    // TODO: What should we do if the output buffer is full?
-    VERIFY(copied_length == length);
+        auto copied_length = TRY(output_buffer.copy_from_seekback(distance, length));
+        VERIFY(copied_length == length);
+        read_anything = true;
+    }
 
+    flush_literals();
     return true;
 }
 
@@ -298,7 +331,7 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
                 TRY(decode_codes(literal_codes, distance_codes));
 
                 m_state = State::ReadingCompressedBlock;
-                new (&m_compressed_block) CompressedBlock(*this, literal_codes, distance_codes);
+                new (&m_compressed_block) CompressedBlock(*this, move(literal_codes), move(distance_codes));
 
                 continue;
             }
@@ -959,13 +992,34 @@ ErrorOr<void> DeflateCompressor::final_flush()
     return {};
 }
 
-ErrorOr<ByteBuffer> DeflateCompressor::compress_all(ReadonlyBytes bytes, CompressionLevel compression_level)
+ErrorOr<void> DeflateCompressor::finish_segment()
+{
+    VERIFY(!m_finished);
+    if (m_pending_block_size != 0)
+        TRY(flush());
+
+    // An empty stored block leaves the output on a byte boundary, so that the next segment can be appended as is.
+    // This is the same thing that zlib does for Z_SYNC_FLUSH.
+    TRY(m_output_stream->write_bits(0b000u, 3)); // not final, no compression
+    TRY(m_output_stream->align_to_byte_boundary());
+    TRY(m_output_stream->write_value<LittleEndian<u16>>(0));
+    TRY(m_output_stream->write_value<LittleEndian<u16>>(0xffff));
+    TRY(m_output_stream->flush_buffer_to_stream());
+
+    m_finished = true;
+    return {};
+}
+
+ErrorOr<ByteBuffer> DeflateCompressor::compress_segment(ReadonlyBytes bytes, CompressionLevel compression_level, bool is_final_segment)
 {
     auto output_stream = TRY(try_make<AllocatingMemoryStream>());
     auto deflate_stream = TRY(DeflateCompressor::construct(MaybeOwned<Stream>(*output_stream), compression_level));
 
     TRY(deflate_stream->write_until_depleted(bytes));
-    TRY(deflate_stream->final_flush());
+    if (is_final_segment)
+        TRY(deflate_stream->final_flush());
+    else
+        TRY(deflate_stream->finish_segment());
 
     auto buffer = TRY(ByteBuffer::create_uninitialized(output_stream->used_buffer_size()));
     TRY(output_stream->read_until_filled(buffer));
@@ -973,4 +1027,64 @@ ErrorOr<ByteBuffer> DeflateCompressor::compress_all(ReadonlyBytes bytes, Compres
     return buffer;
 }
 
+ErrorOr<ByteBuffer> DeflateCompressor::compress_all(ReadonlyBytes bytes, CompressionLevel compression_level)
+{
+    static constexpr size_t max_thread_count = 16;
+
+    // Every block is compressed without referring back to the ones before it, so segments made up of whole blocks
+    // produce the same blocks whether they're compressed on their own or as part of the whole input.
+    static_assert(parallel_segment_size % block_size == 0);
+
+    auto segment_count = ceil_div(bytes.size(), parallel_segment_size);
+    auto thread_count = min(min(static_cast<size_t>(Core::System::hardware_concurrency()), segment_count), max_thread_count);
+    if (compression_level == CompressionLevel::STORE || thread_count <= 1)
+        return compress_segment(bytes, compression_level, true);
+
+    Vector<ErrorOr<ByteBuffer>> results;
+    TRY(results.try_ensure_capacity(segment_count));
+    for (size_t i = 0; i < segment_count; ++i)
+        results.unchecked_append(ByteBuffer {});
+
+    Atomic<size_t> next_segment { 0 };
+    auto compress_segments = [&] {
+        for (auto i = next_segment++; i < segment_count; i = next_segment++) {
+            auto segment = bytes.slice(i * parallel_segment_size, min(parallel_segment_size, bytes.size() - i * parallel_segment_size));
+            results[i] = compress_segment(segment, compression_level, i == segment_count - 1);
+        }
+    };
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct([&]() -> intptr_t {
+            compress_segments();
+            return 0;
+        },
+            "Deflate"sv);
+        thread->start();
+        threads.append(move(thread));
+    }
+
+    compress_segments();
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    size_t total_size = 0;
+    for (auto& result : results) {
+        if (result.is_error())
+            return result.release_error();
+        total_size += result.value().size();
+    }
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(total_size));
+    size_t offset = 0;
+    for (auto& result : results) {
+        auto& segment = result.value();
+        buffer.overwrite(offset, segment.data(), segment.size());
+        offset += segment.size();
+    }
+
+    return buffer;
+}
+
 }
@@ -31,7 +31,11 @@ public:
     static ErrorOr<CanonicalCode> from_bytes(ReadonlyBytes);
 
 private:
-    static constexpr size_t max_allowed_prefixed_code_length = 8;
+    // Codes up to this length are decoded with a single lookup, which covers all of the fixed codes and nearly all
+    // symbols of typical dynamic codes.
+    static constexpr size_t max_allowed_prefixed_code_length = 10;
+
+    ErrorOr<u32> read_symbol_bit_by_bit(LittleEndianInputBitStream&) const;
 
     struct PrefixTableEntry {
         u16 symbol_value { 0 };
@@ -42,7 +46,8 @@ private:
     Vector<u16, 286> m_symbol_codes;
     Vector<u16, 286> m_symbol_values;
 
-    Array<PrefixTableEntry, 1 << max_allowed_prefixed_code_length> m_prefix_table {};
+    // Sized for the longest prefixed code, as short codes are common and some formats use many codes at once.
+    Vector<PrefixTableEntry> m_prefix_table;
     size_t m_max_prefixed_code_length { 0 };
 
     // Compression - indexed by symbol
@@ -174,11 +179,18 @@ public:
     virtual void close() override;
     ErrorOr<void> final_flush();
 
+    // Large inputs are split into segments that are compressed on several threads at once, and joined back together.
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes, CompressionLevel = CompressionLevel::GOOD);
 
+    // Inputs are compressed in parallel once there's at least two segments of this size.
+    static constexpr size_t parallel_segment_size = 32 * block_size;
+
 private:
     DeflateCompressor(NonnullOwnPtr<LittleEndianOutputBitStream>, CompressionLevel = CompressionLevel::GOOD);
 
+    static ErrorOr<ByteBuffer> compress_segment(ReadonlyBytes bytes, CompressionLevel, bool is_final_segment);
+    ErrorOr<void> finish_segment();
+
     Bytes pending_block() { return { m_rolling_window + block_size, block_size }; }
 
     // LZ77 Compression
@@ -210,9 +210,8 @@ ErrorOr<size_t> GzipCompressor::write_some(ReadonlyBytes bytes)
     header.extra_flags = 3;      // DEFLATE sets 2 for maximum compression and 4 for minimum compression
     header.operating_system = 3; // unix
     TRY(m_output_stream->write_until_depleted({ &header, sizeof(header) }));
-    auto compressed_stream = TRY(DeflateCompressor::construct(MaybeOwned(*m_output_stream)));
-    TRY(compressed_stream->write_until_depleted(bytes));
-    TRY(compressed_stream->final_flush());
+    auto compressed_bytes = TRY(DeflateCompressor::compress_all(bytes));
+    TRY(m_output_stream->write_until_depleted(compressed_bytes));
     Crypto::Checksum::CRC32 crc32;
     crc32.update(bytes);
     TRY(m_output_stream->write_value<LittleEndian<u32>>(crc32.digest()));
@@ -20,6 +20,16 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+// Notifiers are registered with the kernel once where possible, so that waiting doesn't cost more with every notifier.
+// FIXME: Figure out why notifiers can't check their events under Android, and use epoll there too.
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USES_EPOLL
+#    include <sys/epoll.h>
+#elif defined(AK_OS_BSD_GENERIC)
+#    define EVENT_LOOP_USES_KQUEUE
+#    include <sys/event.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -255,6 +265,7 @@ struct ThreadData {
     ThreadData()
     {
         pid = getpid();
+        clear_notifiers();
         initialize_wake_pipe();
     }
 
@@ -281,17 +292,307 @@ struct ThreadData {
         wake_pipe_fds = result.release_value();
 
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+#if defined(EVENT_LOOP_USES_EPOLL) || defined(EVENT_LOOP_USES_KQUEUE)
+        VERIFY(watch_in_kernel(wake_pipe_fds[0], NotificationType::None, NotificationType::Read));
+#else
         VERIFY(poll_fds.size() == 0);
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifier_by_index.append(nullptr);
+#endif
+    }
+
+#if defined(EVENT_LOOP_USES_EPOLL) || defined(EVENT_LOOP_USES_KQUEUE)
+    void clear_notifiers()
+    {
+        // After a fork, the kernel queue may still be shared with the parent, so it must not be modified.
+        if (kernel_queue_fd != -1)
+            close(kernel_queue_fd);
+
+#    if defined(EVENT_LOOP_USES_EPOLL)
+        kernel_queue_fd = epoll_create1(EPOLL_CLOEXEC);
+#    else
+        kernel_queue_fd = kqueue();
+        if (kernel_queue_fd != -1)
+            fcntl(kernel_queue_fd, F_SETFD, FD_CLOEXEC);
+#    endif
+        if (kernel_queue_fd == -1) {
+            perror("EventLoopImplementationUnix: Failed to create kernel event queue");
+            VERIFY_NOT_REACHED();
+        }
+
+        watched_fds.clear();
+        unwatchable_notifiers.clear();
+        ready_event_count = 0;
+    }
+
+    // Changes which events the kernel reports for the file descriptor. This fails for files that can't be waited on,
+    // like regular files on Linux.
+    bool watch_in_kernel(int fd, NotificationType old_type, NotificationType new_type)
+    {
+        constexpr auto watched_types = NotificationType::Read | NotificationType::Write;
+        old_type &= watched_types;
+        new_type &= watched_types;
+        if (old_type == new_type)
+            return true;
+
+#    if defined(EVENT_LOOP_USES_EPOLL)
+        epoll_event event {};
+        if (has_flag(new_type, NotificationType::Read))
+            event.events |= EPOLLIN;
+        if (has_flag(new_type, NotificationType::Write))
+            event.events |= EPOLLOUT;
+        event.data.fd = fd;
+
+        int operation = EPOLL_CTL_MOD;
+        if (old_type == NotificationType::None)
+            operation = EPOLL_CTL_ADD;
+        else if (new_type == NotificationType::None)
+            operation = EPOLL_CTL_DEL;
+        return epoll_ctl(kernel_queue_fd, operation, fd, &event) == 0;
+#    else
+        Array<struct kevent, 2> changes;
+        size_t change_count = 0;
+        auto add_change = [&](NotificationType type, short filter) {
+            if (has_flag(old_type, type) == has_flag(new_type, type))
+                return;
+            EV_SET(&changes[change_count++], fd, filter, has_flag(new_type, type) ? EV_ADD : EV_DELETE, 0, 0, nullptr);
+        };
+        add_change(NotificationType::Read, EVFILT_READ);
+        add_change(NotificationType::Write, EVFILT_WRITE);
+        return kevent(kernel_queue_fd, changes.data(), change_count, nullptr, 0, nullptr) == 0;
+#    endif
+    }
+
+    void add_notifier(Notifier& notifier)
+    {
+        auto& watched = watched_fds.ensure(notifier.fd());
+        auto old_type = watched.type;
+        auto new_type = old_type | notifier.type();
+
+        if (!watch_in_kernel(notifier.fd(), old_type, new_type)) {
+            // The file is always ready as far as poll() is concerned, so treat it that way.
+            if (watched.notifiers.is_empty())
+                watched_fds.remove(notifier.fd());
+            unwatchable_notifiers.append(&notifier);
+            return;
+        }
+
+        watched.type = new_type;
+        watched.notifiers.append(&notifier);
+    }
+
+    void remove_notifier(Notifier& notifier)
+    {
+        if (unwatchable_notifiers.remove_first_matching([&](auto* other) { return other == &notifier; }))
+            return;
+
+        auto it = watched_fds.find(notifier.fd());
+        VERIFY(it != watched_fds.end());
+
+        auto& watched = it->value;
+        VERIFY(watched.notifiers.remove_first_matching([&](auto* other) { return other == &notifier; }));
+
+        auto new_type = NotificationType::None;
+        for (auto* other : watched.notifiers)
+            new_type |= other->type();
+
+        // If the file descriptor was closed before its notifier, the kernel has already forgotten about it.
+        (void)watch_in_kernel(notifier.fd(), watched.type, new_type);
+        watched.type = new_type;
+
+        if (watched.notifiers.is_empty())
+            watched_fds.remove(it);
+    }
+
+    ErrorOr<void> wait_for_file_descriptors(int timeout)
+    {
+        // Files that we can't wait on are always ready.
+        if (!unwatchable_notifiers.is_empty())
+            timeout = 0;
+
+#    if defined(EVENT_LOOP_USES_EPOLL)
+        auto result = epoll_wait(kernel_queue_fd, ready_events.data(), ready_events.size(), timeout);
+        if (result < 0)
+            return Error::from_syscall("epoll_wait"sv, -errno);
+#    else
+        timespec timeout_spec {};
+        timeout_spec.tv_sec = timeout / 1000;
+        timeout_spec.tv_nsec = (timeout % 1000) * 1'000'000;
+        auto result = kevent(kernel_queue_fd, nullptr, 0, ready_events.data(), ready_events.size(), timeout < 0 ? nullptr : &timeout_spec);
+        if (result < 0)
+            return Error::from_syscall("kevent"sv, -errno);
+#    endif
+        ready_event_count = result;
+        return {};
+    }
+
+    static int ready_event_fd(auto const& event)
+    {
+#    if defined(EVENT_LOOP_USES_EPOLL)
+        return event.data.fd;
+#    else
+        return static_cast<int>(event.ident);
+#    endif
+    }
+
+    static NotificationType ready_event_type(auto const& event)
+    {
+        NotificationType type = NotificationType::None;
+#    if defined(EVENT_LOOP_USES_EPOLL)
+        if (has_flag(event.events, EPOLLIN))
+            type |= NotificationType::Read;
+        if (has_flag(event.events, EPOLLOUT))
+            type |= NotificationType::Write;
+        if (has_flag(event.events, EPOLLHUP))
+            type |= NotificationType::HangUp;
+        if (has_flag(event.events, EPOLLERR))
+            type |= NotificationType::Error;
+#    else
+        if (event.filter == EVFILT_READ)
+            type |= NotificationType::Read;
+        if (event.filter == EVFILT_WRITE)
+            type |= NotificationType::Write;
+        if (has_flag(event.flags, EV_EOF))
+            type |= NotificationType::HangUp;
+        if (has_flag(event.flags, EV_ERROR))
+            type |= NotificationType::Error;
+#    endif
+        return type;
+    }
+
+    bool wake_pipe_is_readable() const
+    {
+        for (int i = 0; i < ready_event_count; ++i) {
+            if (ready_event_fd(ready_events[i]) == wake_pipe_fds[0])
+                return true;
+        }
+        return false;
+    }
+
+    void post_notifier_activation_events()
+    {
+        for (int i = 0; i < ready_event_count; ++i) {
+            auto& event = ready_events[i];
+            // The notifiers may have been unregistered by a signal handler in the meantime.
+            auto watched = watched_fds.get(ready_event_fd(event));
+            if (!watched.has_value())
+                continue;
+
+            auto ready_type = ready_event_type(event);
+            for (auto* notifier : watched->notifiers) {
+                auto type = ready_type & notifier->type();
+                if (type != NotificationType::None)
+                    ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(notifier->fd(), type));
+            }
+        }
+
+        for (auto* notifier : unwatchable_notifiers)
+            ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(notifier->fd(), notifier->type()));
+    }
+#else
+    void clear_notifiers()
+    {
+        poll_fds.clear();
+        notifier_by_ptr.clear();
+        notifier_by_index.clear();
+    }
+
+    void add_notifier(Notifier& notifier)
+    {
+        notifier_by_ptr.set(&notifier, poll_fds.size());
+        notifier_by_index.append(&notifier);
+        poll_fds.append({
+            .fd = notifier.fd(),
+            .events = notification_type_to_poll_events(notifier.type()),
+            .revents = 0,
+        });
+    }
+
+    void remove_notifier(Notifier& notifier)
+    {
+        auto it = notifier_by_ptr.find(&notifier);
+        VERIFY(it != notifier_by_ptr.end());
+
+        size_t notifier_index = it->value;
+        notifier_by_ptr.remove(it);
+
+        if (notifier_index + 1 != poll_fds.size()) {
+            swap(poll_fds[notifier_index], poll_fds.last());
+            swap(notifier_by_index[notifier_index], notifier_by_index.last());
+            notifier_by_ptr.set(notifier_by_index[notifier_index], notifier_index);
+        }
+        poll_fds.take_last();
+        notifier_by_index.take_last();
+    }
+
+    ErrorOr<void> wait_for_file_descriptors(int timeout)
+    {
+        marked_fd_count = TRY(System::poll(poll_fds, timeout));
+        return {};
+    }
+
+    bool wake_pipe_is_readable() const
+    {
+        return has_flag(poll_fds[0].revents, POLLIN);
+    }
+
+    void post_notifier_activation_events()
+    {
+        if (marked_fd_count == 0)
+            return;
+
+        // Handle file system notifiers by making them normal events.
+        for (size_t i = 1; i < poll_fds.size(); ++i) {
+            // FIXME: Make the check work under Android, pehaps use ALooper
+#    ifdef AK_OS_ANDROID
+            auto& notifier = *notifier_by_index[i];
+            ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), notifier.type()));
+#    else
+            auto& revents = poll_fds[i].revents;
+            auto& notifier = *notifier_by_index[i];
+
+            NotificationType type = NotificationType::None;
+            if (has_flag(revents, POLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(revents, POLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(revents, POLLHUP))
+                type |= NotificationType::HangUp;
+            if (has_flag(revents, POLLERR))
+                type |= NotificationType::Error;
+            type &= notifier.type();
+            if (type != NotificationType::None)
+                ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), type));
+#    endif
+        }
     }
+#endif
 
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
+#if defined(EVENT_LOOP_USES_EPOLL) || defined(EVENT_LOOP_USES_KQUEUE)
+    struct WatchedFileDescriptor {
+        NotificationType type { NotificationType::None };
+        Vector<Notifier*, 2> notifiers;
+    };
+    int kernel_queue_fd { -1 };
+    HashMap<int, WatchedFileDescriptor> watched_fds;
+    Vector<Notifier*> unwatchable_notifiers;
+
+    // Anything that doesn't fit is reported by the next wait, since both epoll and kqueue are level-triggered.
+#    if defined(EVENT_LOOP_USES_EPOLL)
+    Array<epoll_event, 256> ready_events;
+#    else
+    Array<struct kevent, 256> ready_events;
+#    endif
+    int ready_event_count { 0 };
+#else
     Vector<pollfd> poll_fds;
     HashMap<Notifier*, size_t> notifier_by_ptr;
     Vector<Notifier*> notifier_by_index;
+    int marked_fd_count { 0 };
+#endif
 
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
@@ -382,20 +683,20 @@ retry:
     }
 
 try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    ErrorOr<int> error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+    // Wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+    auto wait_result = thread_data.wait_for_file_descriptors(should_wait_forever ? -1 : timeout);
     auto time_after_poll = MonotonicTime::now_coarse();
-    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
-    if (error_or_marked_fd_count.is_error()) {
-        if (error_or_marked_fd_count.error().code() == EINTR)
+    // Because POSIX, we might spuriously return with EINTR; just wait again.
+    if (wait_result.is_error()) {
+        if (wait_result.error().code() == EINTR)
             goto try_select_again;
-        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+        dbgln("EventLoopImplementationUnix::wait_for_events: {}", wait_result.error());
         VERIFY_NOT_REACHED();
     }
 
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (thread_data.wake_pipe_is_readable()) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -424,32 +725,7 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
-        // Handle file system notifiers by making them normal events.
-        for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
-            // FIXME: Make the check work under Android, pehaps use ALooper
-#ifdef AK_OS_ANDROID
-            auto& notifier = *thread_data.notifier_by_index[i];
-            ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), notifier.type()));
-#else
-            auto& revents = thread_data.poll_fds[i].revents;
-            auto& notifier = *thread_data.notifier_by_index[i];
-
-            NotificationType type = NotificationType::None;
-            if (has_flag(revents, POLLIN))
-                type |= NotificationType::Read;
-            if (has_flag(revents, POLLOUT))
-                type |= NotificationType::Write;
-            if (has_flag(revents, POLLHUP))
-                type |= NotificationType::HangUp;
-            if (has_flag(revents, POLLERR))
-                type |= NotificationType::Error;
-            type &= notifier.type();
-            if (type != NotificationType::None)
-                ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), type));
-#endif
-        }
-    }
+    thread_data.post_notifier_activation_events();
 
     // Handle expired timers.
     thread_data.timeouts.fire_expired(time_after_poll);
@@ -526,9 +802,7 @@ void EventLoopImplementationUnix::notify_forked_and_in_child()
 {
     auto& thread_data = ThreadData::the();
     thread_data.timeouts.clear();
-    thread_data.poll_fds.clear();
-    thread_data.notifier_by_ptr.clear();
-    thread_data.notifier_by_index.clear();
+    thread_data.clear_notifiers();
     thread_data.initialize_wake_pipe();
     if (auto* info = signals_info<false>()) {
         info->signal_handlers.clear();
@@ -683,15 +957,7 @@ void EventLoopManagerUnix::unregister_timer(intptr_t timer_id)
 void EventLoopManagerUnix::register_notifier(Notifier& notifier)
 {
     auto& thread_data = ThreadData::the();
-
-    thread_data.notifier_by_ptr.set(&notifier, thread_data.poll_fds.size());
-    thread_data.notifier_by_index.append(&notifier);
-    thread_data.poll_fds.append({
-        .fd = notifier.fd(),
-        .events = notification_type_to_poll_events(notifier.type()),
-        .revents = 0,
-    });
-
+    thread_data.add_notifier(notifier);
     notifier.set_owner_thread(s_thread_id);
 }
 
@@ -701,20 +967,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
     if (!thread_data_ptr)
         return;
 
-    auto& thread_data = *thread_data_ptr;
-    auto it = thread_data.notifier_by_ptr.find(&notifier);
-    VERIFY(it != thread_data.notifier_by_ptr.end());
-
-    size_t notifier_index = it->value;
-    thread_data.notifier_by_ptr.remove(it);
-
-    if (notifier_index + 1 != thread_data.poll_fds.size()) {
-        swap(thread_data.poll_fds[notifier_index], thread_data.poll_fds.last());
-        swap(thread_data.notifier_by_index[notifier_index], thread_data.notifier_by_index.last());
-        thread_data.notifier_by_ptr.set(thread_data.notifier_by_index[notifier_index], notifier_index);
-    }
-    thread_data.poll_fds.take_last();
-    thread_data.notifier_by_index.take_last();
+    thread_data_ptr->remove_notifier(notifier);
 }
 
 void EventLoopManagerUnix::did_post_event()
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/File.h>
+#include <LibCore/Process.h>
+#include <LibCore/Tracing.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace Core::Tracing {
+
+struct Event {
+    char const* category { nullptr };
+    char const* name { nullptr };
+    i64 start_nanoseconds { 0 };
+    i64 end_nanoseconds { 0 };
+    u32 thread_id { 0 };
+};
+
+// Roughly 2.5 MiB per process, which is enough for the last few seconds of even a heavy page load.
+static constexpr size_t event_buffer_capacity = 64 * KiB;
+
+static Event* s_events { nullptr };
+static Atomic<size_t> s_next_event_index { 0 };
+static Atomic<u32> s_next_thread_id { 1 };
+static char const* s_trace_directory { nullptr };
+
+static void write_trace_file_on_exit()
+{
+    auto process_name = Process::get_name();
+    auto path = ByteString::formatted("{}/{}-{}.json", s_trace_directory, process_name.is_error() ? "unknown"sv : process_name.value().bytes_as_string_view(), getpid());
+
+    if (auto result = write_trace_file(path); result.is_error())
+        warnln("Unable to write trace to {}: {}", path, result.error());
+}
+
+static bool initialize()
+{
+    s_trace_directory = getenv("LADYBIRD_TRACE_DIRECTORY");
+    if (!s_trace_directory || !*s_trace_directory)
+        return false;
+
+    s_events = new Event[event_buffer_capacity];
+    atexit(write_trace_file_on_exit);
+    return true;
+}
+
+bool g_enabled = initialize();
+
+static u32 current_thread_id()
+{
+    static thread_local u32 thread_id = s_next_thread_id.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    return thread_id;
+}
+
+void record(char const* category, char const* name, MonotonicTime start, MonotonicTime end)
+{
+    VERIFY(s_events);
+
+    // Once the buffer is full, the oldest events are overwritten.
+    auto index = s_next_event_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+
+    s_events[index % event_buffer_capacity] = {
+        .category = category,
+        .name = name,
+        .start_nanoseconds = start.nanoseconds(),
+        .end_nanoseconds = end.nanoseconds(),
+        .thread_id = current_thread_id(),
+    };
+}
+
+// Writes the recorded events as a JSON object in Chrome's Trace Event Format.
+ErrorOr<void> write_trace_file(StringView path)
+{
+    if (!s_events)
+        return Error::from_string_literal("Tracing is not enabled");
+
+    auto process_name = TRY(Process::get_name());
+    auto pid = getpid();
+
+    auto event_count = s_next_event_index.load(AK::MemoryOrder::memory_order_relaxed);
+    auto first_event_index = event_count > event_buffer_capacity ? event_count - event_buffer_capacity : 0;
+
+    StringBuilder builder;
+    builder.append("{\"traceEvents\":["sv);
+
+    builder.appendff("{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},\"args\":{{\"name\":\"", pid);
+    builder.append_escaped_for_json(process_name.bytes_as_string_view());
+    builder.append("\"}}"sv);
+
+    for (auto index = first_event_index; index < event_count; ++index) {
+        auto const& event = s_events[index % event_buffer_capacity];
+
+        // Timestamps and durations are in microseconds, but fractions are allowed.
+        builder.append(",{\"cat\":\""sv);
+        builder.append_escaped_for_json({ event.category, strlen(event.category) });
+        builder.append("\",\"name\":\""sv);
+        builder.append_escaped_for_json({ event.name, strlen(event.name) });
+        builder.appendff("\",\"ph\":\"X\",\"ts\":{}.{:03},\"dur\":{}.{:03},\"pid\":{},\"tid\":{}}}",
+            event.start_nanoseconds / 1000, event.start_nanoseconds % 1000,
+            (event.end_nanoseconds - event.start_nanoseconds) / 1000, (event.end_nanoseconds - event.start_nanoseconds) % 1000,
+            pid, event.thread_id);
+    }
+
+    builder.append("]}"sv);
+
+    auto file = TRY(File::open(path, File::OpenMode::Write | File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(builder.string_view().bytes()));
+
+    return {};
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+
+// Lightweight scoped tracing, written out in the Chrome trace event format so that it can be viewed with
+// chrome://tracing or https://ui.perfetto.dev.
+//
+// Tracing is off unless the LADYBIRD_TRACE_DIRECTORY environment variable is set when a process starts. In that case,
+// every process records its trace scopes into a fixed-size ring buffer, and writes the most recent ones to
+// "<directory>/<process name>-<pid>.json" when it exits. Timestamps come from the monotonic clock, so the files of all
+// processes can be loaded together to see a whole page load across WebContent, RequestServer, ImageDecoder, etc.
+//
+// When tracing is off, a trace scope costs a single branch on a global.
+
+namespace Core::Tracing {
+
+extern bool g_enabled;
+
+inline bool is_enabled() { return g_enabled; }
+
+// Both strings must outlive the process, e.g. string literals or IPC message names.
+void record(char const* category, char const* name, MonotonicTime start, MonotonicTime end);
+
+ErrorOr<void> write_trace_file(StringView path);
+
+class Scope {
+    AK_MAKE_NONCOPYABLE(Scope);
+    AK_MAKE_NONMOVABLE(Scope);
+
+public:
+    Scope(char const* category, char const* name)
+        : m_category(category)
+        , m_name(name)
+    {
+        if (is_enabled()) [[unlikely]]
+            m_start = MonotonicTime::now();
+    }
+
+    ~Scope()
+    {
+        if (m_start.has_value()) [[unlikely]]
+            record(m_category, m_name, *m_start, MonotonicTime::now());
+    }
+
+private:
+    char const* m_category { nullptr };
+    char const* m_name { nullptr };
+    Optional<MonotonicTime> m_start;
+};
+
+}
+
+#define __TRACE_SCOPE_VARIABLE_NAME(line) __trace_scope_##line
+#define __TRACE_SCOPE_VARIABLE(line) __TRACE_SCOPE_VARIABLE_NAME(line)
+
+#define TRACE_SCOPE(category, name) \
+    ::Core::Tracing::Scope __TRACE_SCOPE_VARIABLE(__LINE__) { category, name }
@@ -9,38 +9,132 @@
 
 namespace Crypto {
 
+using Word = UnsignedBigInteger::Word;
+using DoubleWord = AK::Detail::DoubleWord<Word>;
+
+// Below this many words, the bookkeeping of Karatsuba costs more than the multiplications it saves.
+static constexpr size_t karatsuba_threshold = 32;
+
+// Adds value into result, rippling the carry up to the end of result.
+static void add_words_into(Word* result, size_t result_length, Word const* value, size_t value_length)
+{
+    DoubleWord carry = 0;
+    size_t i = 0;
+    for (; i < value_length; ++i) {
+        carry += static_cast<DoubleWord>(result[i]) + value[i];
+        result[i] = static_cast<Word>(carry);
+        carry >>= UnsignedBigInteger::BITS_IN_WORD;
+    }
+    for (; carry && i < result_length; ++i) {
+        carry += result[i];
+        result[i] = static_cast<Word>(carry);
+        carry >>= UnsignedBigInteger::BITS_IN_WORD;
+    }
+}
+
+// Subtracts value from result, which must not be smaller than it.
+static void subtract_words_from(Word* result, size_t result_length, Word const* value, size_t value_length)
+{
+    Word borrow = 0;
+    size_t i = 0;
+    for (; i < value_length; ++i) {
+        auto difference = static_cast<DoubleWord>(result[i]) - value[i] - borrow;
+        result[i] = static_cast<Word>(difference);
+        borrow = static_cast<Word>(difference >> UnsignedBigInteger::BITS_IN_WORD) & 1;
+    }
+    for (; borrow && i < result_length; ++i) {
+        auto difference = static_cast<DoubleWord>(result[i]) - borrow;
+        result[i] = static_cast<Word>(difference);
+        borrow = static_cast<Word>(difference >> UnsignedBigInteger::BITS_IN_WORD) & 1;
+    }
+}
+
+// Writes low + high into output, which has room for high_length + 1 words. high must be at least as long as low.
+static void add_halves(Word const* low, size_t low_length, Word const* high, size_t high_length, Word* output)
+{
+    __builtin_memcpy(output, high, high_length * sizeof(Word));
+    output[high_length] = 0;
+    add_words_into(output, high_length + 1, low, low_length);
+}
+
+/**
+ * Complexity: O(N*M) where N and M are the number of words in the two numbers
+ */
+static void schoolbook_multiply(Word const* left, size_t left_length, Word const* right, size_t right_length, Word* result)
+{
+    __builtin_memset(result, 0, (left_length + right_length) * sizeof(Word));
+    for (size_t i = 0; i < left_length; ++i) {
+        DoubleWord carry = 0;
+        for (size_t j = 0; j < right_length; ++j) {
+            carry += static_cast<DoubleWord>(left[i]) * right[j] + result[i + j];
+            result[i + j] = static_cast<Word>(carry);
+            carry >>= UnsignedBigInteger::BITS_IN_WORD;
+        }
+        result[i + right_length] = static_cast<Word>(carry);
+    }
+}
+
 /**
- * Complexity: O(N^2) where N is the number of words in the larger number
+ * Complexity: O(N^1.58) where N is the number of words in the smaller number, once both are past the threshold.
  * Multiplication method:
- * An integer is equal to the sum of the powers of two
- * according to the indices of its 'on' bits.
- * So to multiple x*y, we go over each '1' bit in x (say the i'th bit),
- * and add y<<i to the result.
+ * Splitting both numbers into halves as x = x1 * B^m + x0 and y = y1 * B^m + y0 gives
+ * x * y = z2 * B^2m + z1 * B^m + z0, with z2 = x1 * y1, z0 = x0 * y0 and z1 = (x0 + x1) * (y0 + y1) - z2 - z0.
+ * This takes three half-sized multiplications rather than four. Small products use schoolbook multiplication.
  */
+static void multiply_words(Word const* left, size_t left_length, Word const* right, size_t right_length, Word* result)
+{
+    auto result_length = left_length + right_length;
+
+    if (min(left_length, right_length) < karatsuba_threshold) {
+        schoolbook_multiply(left, left_length, right, right_length, result);
+        return;
+    }
+
+    auto split = min(left_length, right_length) / 2;
+    auto left_high_length = left_length - split;
+    auto right_high_length = right_length - split;
+
+    // z0 goes into the low 2m words of the result, and z2 right above it.
+    multiply_words(left, split, right, split, result);
+    multiply_words(left + split, left_high_length, right + split, right_high_length, result + 2 * split);
+
+    auto left_sum_length = left_high_length + 1;
+    auto right_sum_length = right_high_length + 1;
+    auto middle_length = left_sum_length + right_sum_length;
+
+    Vector<Word, 4 * karatsuba_threshold> buffer;
+    buffer.resize(left_sum_length + right_sum_length + middle_length);
+    auto* left_sum = buffer.data();
+    auto* right_sum = left_sum + left_sum_length;
+    auto* middle = right_sum + right_sum_length;
+
+    add_halves(left, split, left + split, left_high_length, left_sum);
+    add_halves(right, split, right + split, right_high_length, right_sum);
+    multiply_words(left_sum, left_sum_length, right_sum, right_sum_length, middle);
+
+    subtract_words_from(middle, middle_length, result, 2 * split);
+    subtract_words_from(middle, middle_length, result + 2 * split, result_length - 2 * split);
+
+    // z1 * B^m is no larger than the full product, so anything of z1 past the end of the result is zero.
+    add_words_into(result + split, result_length - split, middle, min(middle_length, result_length - split));
+}
+
 FLATTEN void UnsignedBigIntegerAlgorithms::multiply_without_allocation(
     UnsignedBigInteger const& left,
     UnsignedBigInteger const& right,
-    UnsignedBigInteger& temp_shift_result,
-    UnsignedBigInteger& temp_shift_plus,
-    UnsignedBigInteger& temp_shift,
     UnsignedBigInteger& output)
 {
-    output.set_to_0();
+    VERIFY(&output != &left && &output != &right);
 
-    // iterate all bits
-    for (size_t word_index = 0; word_index < left.length(); ++word_index) {
-        for (size_t bit_index = 0; bit_index < UnsignedBigInteger::BITS_IN_WORD; ++bit_index) {
-            // If the bit is off - skip over it
-            if (!(left.m_words[word_index] & (1 << bit_index)))
-                continue;
+    auto left_length = left.trimmed_length();
+    auto right_length = right.trimmed_length();
 
-            size_t shift_amount = word_index * UnsignedBigInteger::BITS_IN_WORD + bit_index;
+    output.set_to_0();
+    if (left_length == 0 || right_length == 0)
+        return;
 
-            // output += (right << shift_amount);
-            shift_left_without_allocation(right, shift_amount, temp_shift_result, temp_shift_plus, temp_shift);
-            add_into_accumulator_without_allocation(output, temp_shift);
-        }
-    }
+    output.resize_with_leading_zeros(left_length + right_length);
+    multiply_words(left.m_words.data(), left_length, right.m_words.data(), right_length, output.m_words.data());
 }
 
 }
@@ -28,7 +28,26 @@ void Adler32::update(ReadonlyBytes data)
         //     state_b += state_a
         // print(state_b < 2 ** 64)
         auto chunk = data.slice(0, min(data.size(), iterations_without_overflow));
-        for (u8 byte : chunk) {
+
+        // Adding a block of bytes x_0..x_(n-1) one at a time is the same as
+        //     state_b += n * state_a + sum((n - i) * x_i)
+        //     state_a += sum(x_i)
+        // which breaks the dependency between consecutive bytes and lets the sums be vectorized.
+        constexpr size_t block_size = 16;
+        auto remaining = chunk;
+        while (remaining.size() >= block_size) {
+            u32 sum = 0;
+            u32 weighted_sum = 0;
+            for (size_t i = 0; i < block_size; ++i) {
+                sum += remaining[i];
+                weighted_sum += (block_size - i) * remaining[i];
+            }
+            state_b += block_size * state_a + weighted_sum;
+            state_a += sum;
+            remaining = remaining.slice(block_size);
+        }
+
+        for (u8 byte : remaining) {
             state_a += byte;
             state_b += state_a;
         }
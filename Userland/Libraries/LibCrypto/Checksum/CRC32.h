@@ -29,6 +29,10 @@ public:
     virtual void update(ReadonlyBytes data) override;
     virtual u32 digest() override;
 
+    // Returns the checksum of two pieces of data appended to each other, given the checksum of each piece and the
+    // length of the second one. This lets chunks of data be checksummed independently of each other.
+    static u32 combine(u32 checksum_a, u32 checksum_b, u64 length_b);
+
 private:
     u32 m_state { ~0u };
 };
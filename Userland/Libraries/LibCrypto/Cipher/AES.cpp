@@ -8,6 +8,10 @@
 #include <LibCrypto/Cipher/AES.h>
 #include <LibCrypto/Cipher/AESTables.h>
 
+#if ARCH(X86_64)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Cipher {
 
 template<typename T>
@@ -23,6 +27,73 @@ constexpr void swap_keys(u32* keys, size_t i, size_t j)
     keys[j] = temp;
 }
 
+#if ARCH(X86_64)
+static bool has_hardware_aes()
+{
+    static bool const s_has_hardware_aes = __builtin_cpu_supports("aes") && __builtin_cpu_supports("ssse3");
+    return s_has_hardware_aes;
+}
+
+// Our round keys are kept as big-endian words for the table-based code, while AES-NI wants the bytes of each round key
+// in the order the standard key schedule produces them, so every word has to be byte-swapped on the way in.
+[[gnu::target("ssse3")]] static void load_hardware_round_keys(AESCipherKey const& key, __m128i* out)
+{
+    auto const* round_keys = key.round_keys();
+    auto const byte_swap_words = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    for (size_t i = 0; i <= key.rounds(); ++i)
+        out[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(round_keys + i * 4)), byte_swap_words);
+}
+
+[[gnu::target("aes,ssse3")]] static void hardware_encrypt_blocks(AESCipherKey const& key, u8 const* in, u8* out, size_t count)
+{
+    auto const rounds = key.rounds();
+    __m128i keys[15];
+    load_hardware_round_keys(key, keys);
+
+    // Each AESENC depends on the previous round of the same block, so keep several independent blocks in flight to
+    // hide its latency. Eight is enough to saturate the AES units of current x86 cores.
+    static constexpr size_t interleaved_blocks = 8;
+
+    for (; count >= interleaved_blocks; count -= interleaved_blocks) {
+        __m128i blocks[interleaved_blocks];
+        for (size_t i = 0; i < interleaved_blocks; ++i)
+            blocks[i] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i * 16)), keys[0]);
+        for (size_t round = 1; round < rounds; ++round) {
+            for (size_t i = 0; i < interleaved_blocks; ++i)
+                blocks[i] = _mm_aesenc_si128(blocks[i], keys[round]);
+        }
+        for (size_t i = 0; i < interleaved_blocks; ++i)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 16), _mm_aesenclast_si128(blocks[i], keys[rounds]));
+
+        in += interleaved_blocks * 16;
+        out += interleaved_blocks * 16;
+    }
+
+    for (; count > 0; --count) {
+        auto block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in)), keys[0]);
+        for (size_t round = 1; round < rounds; ++round)
+            block = _mm_aesenc_si128(block, keys[round]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_aesenclast_si128(block, keys[rounds]));
+
+        in += 16;
+        out += 16;
+    }
+}
+
+// The decryption key schedule is already in the "equivalent inverse cipher" form that AESDEC expects.
+[[gnu::target("aes,ssse3")]] static void hardware_decrypt_block(AESCipherKey const& key, u8 const* in, u8* out)
+{
+    auto const rounds = key.rounds();
+    __m128i keys[15];
+    load_hardware_round_keys(key, keys);
+
+    auto block = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in)), keys[0]);
+    for (size_t round = 1; round < rounds; ++round)
+        block = _mm_aesdec_si128(block, keys[round]);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_aesdeclast_si128(block, keys[rounds]));
+}
+#endif
+
 ByteString AESCipherBlock::to_byte_string() const
 {
     StringBuilder builder;
@@ -194,8 +265,35 @@ void AESCipherKey::expand_decrypt_key(ReadonlyBytes user_key, size_t bits)
     }
 }
 
+void AESCipher::encrypt_blocks(ReadonlyBytes in, Bytes out)
+{
+    VERIFY(in.size() % block_size() == 0);
+    VERIFY(out.size() >= in.size());
+
+#if ARCH(X86_64)
+    if (has_hardware_aes()) {
+        hardware_encrypt_blocks(m_key, in.data(), out.data(), in.size() / block_size());
+        return;
+    }
+#endif
+
+    AESCipherBlock block;
+    for (size_t offset = 0; offset < in.size(); offset += block_size()) {
+        block.overwrite(in.slice(offset, block_size()));
+        encrypt_block(block, block);
+        block.bytes().copy_to(out.slice(offset));
+    }
+}
+
 void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64)
+    if (has_hardware_aes()) {
+        hardware_encrypt_blocks(m_key, in.bytes().data(), out.bytes().data(), 1);
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -285,6 +383,13 @@ void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 
 void AESCipher::decrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64)
+    if (has_hardware_aes()) {
+        hardware_decrypt_block(m_key, in.bytes().data(), out.bytes().data());
+        return;
+    }
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
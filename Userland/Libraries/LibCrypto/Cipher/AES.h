@@ -112,6 +112,9 @@ public:
     virtual void encrypt_block(BlockType const& in, BlockType& out) override;
     virtual void decrypt_block(BlockType const& in, BlockType& out) override;
 
+    // Encrypts consecutive whole blocks in one go, which lets hardware AES work on several of them at once.
+    void encrypt_blocks(ReadonlyBytes in, Bytes out);
+
     virtual ByteString class_name() const override
     {
         return "AES";
@@ -165,6 +165,34 @@ protected:
         size_t offset { 0 };
         auto block_size = cipher.block_size();
 
+        if constexpr (requires { cipher.encrypt_blocks(ReadonlyBytes {}, Bytes {}); }) {
+            // Generate the key stream for a batch of counters at a time, so the cipher can work on them in parallel.
+            static constexpr size_t batch_size = 8 * IVSizeInBits / 8;
+            u8 counters[batch_size];
+            u8 key_stream[batch_size];
+
+            VERIFY(block_size == IV_length());
+            while (length >= block_size) {
+                auto write_size = min(batch_size, length - length % block_size);
+                for (size_t i = 0; i < write_size; i += block_size) {
+                    __builtin_memcpy(counters + i, iv.data(), block_size);
+                    increment(iv);
+                }
+                cipher.encrypt_blocks({ counters, write_size }, { key_stream, write_size });
+
+                VERIFY(offset + write_size <= out.size());
+                if (in) {
+                    for (size_t i = 0; i < write_size; ++i)
+                        out[offset + i] = key_stream[i] ^ (*in)[offset + i];
+                } else {
+                    __builtin_memcpy(out.offset(offset), key_stream, write_size);
+                }
+
+                length -= write_size;
+                offset += write_size;
+            }
+        }
+
         while (length > 0) {
             m_cipher_block.overwrite(iv.slice(0, block_size));
 
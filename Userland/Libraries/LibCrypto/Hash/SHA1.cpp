@@ -10,6 +10,10 @@
 #include <AK/Types.h>
 #include <LibCrypto/Hash/SHA1.h>
 
+#if ARCH(X86_64)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Hash {
 
 static constexpr auto ROTATE_LEFT(u32 value, size_t bits)
@@ -17,8 +21,85 @@ static constexpr auto ROTATE_LEFT(u32 value, size_t bits)
     return (value << bits) | (value >> (32 - bits));
 }
 
+#if ARCH(X86_64)
+static bool has_sha_extensions()
+{
+    static bool const s_has_sha_extensions = __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+    return s_has_sha_extensions;
+}
+
+// SHA1RNDS4 does four rounds at a time, with E kept separately and folded into the next message words by SHA1NEXTE.
+// SHA1MSG1, SHA1MSG2 and an XOR expand the message schedule four words at a time.
+[[gnu::target("sha,sse4.1")]] static void transform_with_sha_extensions(u32 (&state)[5], u8 const* data)
+{
+    auto const byte_swap_block = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+    auto abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[0])), 0x1b);
+    auto e = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+    __m128i next_e;
+
+    auto initial_abcd = abcd;
+    auto initial_e = e;
+
+    __m128i schedule[4];
+
+#    pragma GCC unroll 20
+    for (size_t group = 0; group < 20; ++group) {
+        auto& words = schedule[group % 4];
+        auto& current_e = group % 2 == 0 ? e : next_e;
+        auto& following_e = group % 2 == 0 ? next_e : e;
+
+        if (group < 4)
+            words = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + group * 16)), byte_swap_block);
+
+        if (group == 0)
+            current_e = _mm_add_epi32(current_e, words);
+        else
+            current_e = _mm_sha1nexte_epu32(current_e, words);
+        following_e = abcd;
+
+        if (group >= 3 && group < 19)
+            schedule[(group + 1) % 4] = _mm_sha1msg2_epu32(schedule[(group + 1) % 4], words);
+
+        // The round function is an immediate operand, so it can't be computed from the group.
+        switch (group / 5) {
+        case 0:
+            abcd = _mm_sha1rnds4_epu32(abcd, current_e, 0);
+            break;
+        case 1:
+            abcd = _mm_sha1rnds4_epu32(abcd, current_e, 1);
+            break;
+        case 2:
+            abcd = _mm_sha1rnds4_epu32(abcd, current_e, 2);
+            break;
+        default:
+            abcd = _mm_sha1rnds4_epu32(abcd, current_e, 3);
+            break;
+        }
+
+        if (group >= 1 && group < 17)
+            schedule[(group + 3) % 4] = _mm_sha1msg1_epu32(schedule[(group + 3) % 4], words);
+        if (group >= 2 && group < 18)
+            schedule[(group + 2) % 4] = _mm_xor_si128(schedule[(group + 2) % 4], words);
+    }
+
+    e = _mm_sha1nexte_epu32(e, initial_e);
+    abcd = _mm_add_epi32(abcd, initial_abcd);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_shuffle_epi32(abcd, 0x1b));
+    state[4] = static_cast<u32>(_mm_extract_epi32(e, 3));
+}
+#endif
+
 inline void SHA1::transform(u8 const* data)
 {
+#if ARCH(X86_64)
+    if (has_sha_extensions()) {
+        transform_with_sha_extensions(m_state, data);
+        return;
+    }
+#endif
+
     u32 blocks[80];
     for (size_t i = 0; i < 16; ++i)
         blocks[i] = AK::convert_between_host_and_network_endian(((u32 const*)data)[i]);
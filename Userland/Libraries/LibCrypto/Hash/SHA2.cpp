@@ -8,6 +8,10 @@
 #include <AK/Types.h>
 #include <LibCrypto/Hash/SHA2.h>
 
+#if ARCH(X86_64)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Hash {
 constexpr static auto ROTRIGHT(u32 a, size_t b) { return (a >> b) | (a << (32 - b)); }
 constexpr static auto CH(u32 x, u32 y, u32 z) { return (x & y) ^ (z & ~x); }
@@ -25,8 +29,70 @@ constexpr static auto EP1(u64 x) { return ROTRIGHT(x, 14) ^ ROTRIGHT(x, 18) ^ RO
 constexpr static auto SIGN0(u64 x) { return ROTRIGHT(x, 1) ^ ROTRIGHT(x, 8) ^ (x >> 7); }
 constexpr static auto SIGN1(u64 x) { return ROTRIGHT(x, 19) ^ ROTRIGHT(x, 61) ^ (x >> 6); }
 
+#if ARCH(X86_64)
+static bool has_sha_extensions()
+{
+    static bool const s_has_sha_extensions = __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+    return s_has_sha_extensions;
+}
+
+// SHA256RNDS2 works on the state split into ABEF and CDGH halves, and does two rounds at a time with the message words
+// and round constants in the low half of its third operand. SHA256MSG1 and SHA256MSG2 expand the message schedule
+// four words at a time, so only four vectors of it are ever live.
+[[gnu::target("sha,sse4.1")]] static void transform_with_sha_extensions(u32 (&state)[8], u8 const* data)
+{
+    auto const byte_swap_words = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    auto dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[0])), 0xb1);
+    auto efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[4])), 0x1b);
+    auto abef = _mm_alignr_epi8(dcba, efgh, 8);
+    auto cdgh = _mm_blend_epi16(efgh, dcba, 0xf0);
+
+    auto initial_abef = abef;
+    auto initial_cdgh = cdgh;
+
+    __m128i schedule[4];
+
+#    pragma GCC unroll 16
+    for (size_t group = 0; group < 16; ++group) {
+        auto& words = schedule[group % 4];
+        if (group < 4)
+            words = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + group * 16)), byte_swap_words);
+
+        auto message = _mm_add_epi32(words, _mm_loadu_si128(reinterpret_cast<__m128i const*>(&SHA256Constants::RoundConstants[group * 4])));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+
+        if (group >= 3 && group < 15) {
+            auto& next_words = schedule[(group + 1) % 4];
+            next_words = _mm_add_epi32(next_words, _mm_alignr_epi8(words, schedule[(group + 3) % 4], 4));
+            next_words = _mm_sha256msg2_epu32(next_words, words);
+        }
+
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(message, 0x0e));
+
+        if (group >= 1 && group < 13)
+            schedule[(group + 3) % 4] = _mm_sha256msg1_epu32(schedule[(group + 3) % 4], words);
+    }
+
+    abef = _mm_add_epi32(abef, initial_abef);
+    cdgh = _mm_add_epi32(cdgh, initial_cdgh);
+
+    auto feba = _mm_shuffle_epi32(abef, 0x1b);
+    auto dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+}
+#endif
+
 inline void SHA256::transform(u8 const* data)
 {
+#if ARCH(X86_64)
+    if (has_sha_extensions()) {
+        transform_with_sha_extensions(m_state, data);
+        return;
+    }
+#endif
+
     u32 m[64];
 
     size_t i = 0;
@@ -77,6 +77,15 @@ ErrorOr<void> encode(Encoder& encoder, Gfx::BitmapSequence const& bitmap_sequenc
 
     TRY(encoder.encode(metadata));
 
+    // A single bitmap that already lives in shared memory (e.g. one a decoder wrote into directly) is sent as is.
+    if (bitmaps.size() == 1 && bitmaps.first().has_value()) {
+        auto const& bitmap = bitmaps.first().value();
+        if (bitmap->anonymous_buffer().is_valid() && bitmap->anonymous_buffer().size() >= bitmap->size_in_bytes()) {
+            TRY(encoder.encode(bitmap->anonymous_buffer()));
+            return {};
+        }
+    }
+
     // collate all of the bitmap data into one contiguous buffer
     auto collated_buffer = TRY(Core::AnonymousBuffer::create_with_size(total_buffer_size));
 
@@ -108,6 +117,16 @@ ErrorOr<Gfx::BitmapSequence> decode(Decoder& decoder)
     ReadonlyBytes bytes = ReadonlyBytes(collated_buffer.data<u8>(), collated_buffer.size());
     size_t bytes_read = 0;
 
+    // A single bitmap can use the received buffer directly instead of copying it out.
+    if (metadata_list.size() == 1 && metadata_list.first().has_value()) {
+        auto const& metadata = metadata_list.first().value();
+        auto pixel_data_size = Gfx::Bitmap::size_in_bytes(Gfx::Bitmap::minimum_pitch(metadata.size.width(), metadata.format), metadata.size.height());
+        if (metadata.size_in_bytes > bytes.size() || pixel_data_size > bytes.size())
+            return Error::from_string_literal("IPC: Invalid Gfx::BitmapSequence buffer data");
+        bitmaps.append(TRY(Gfx::Bitmap::create_with_anonymous_buffer(metadata.format, metadata.alpha_type, move(collated_buffer), metadata.size)));
+        return result;
+    }
+
     // sequentially read each valid bitmap's data from the collated buffer
     for (auto const& metadata_option : metadata_list) {
         Optional<NonnullRefPtr<Gfx::Bitmap>> bitmap = {};
@@ -26,11 +26,19 @@ ErrorOr<RefPtr<Bitmap>> CMYKBitmap::to_low_quality_rgb() const
     if (!m_rgb_bitmap) {
         m_rgb_bitmap = TRY(Bitmap::create(BitmapFormat::BGRx8888, { m_size.width(), m_size.height() }));
 
+        // Exact for all products of two u8s, and unlike the division the loop below can be vectorized with it.
+        auto divide_by_255 = [](u32 value) { return (value + 1 + (value >> 8)) >> 8; };
+
         for (int y = 0; y < m_size.height(); ++y) {
+            auto const* cmyk_row = scanline(y);
+            auto* rgb_row = m_rgb_bitmap->scanline(y);
             for (int x = 0; x < m_size.width(); ++x) {
-                auto const& cmyk = scanline(y)[x];
-                u8 k = 255 - cmyk.k;
-                m_rgb_bitmap->scanline(y)[x] = Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255).value();
+                auto const& cmyk = cmyk_row[x];
+                u32 k = 255 - cmyk.k;
+                u32 r = divide_by_255((255 - cmyk.c) * k);
+                u32 g = divide_by_255((255 - cmyk.m) * k);
+                u32 b = divide_by_255((255 - cmyk.y) * k);
+                rgb_row[x] = 0xff000000 | (r << 16) | (g << 8) | b;
             }
         }
     }
@@ -373,6 +373,15 @@ void EdgeFlagPathRasterizer<SamplesPerPixel>::fast_fill_solid_color_span(ARGB32*
     fast_u32_fill(scanline_ptr + start_x, color.value(), end_x - start_x + 1);
 }
 
+template<unsigned SamplesPerPixel>
+void EdgeFlagPathRasterizer<SamplesPerPixel>::fast_blend_solid_color_span(BitmapFormat format, ARGB32* scanline_ptr, int start, int end, Color color)
+{
+    auto start_x = start + m_blit_origin.x();
+    auto end_x = end + m_blit_origin.x();
+    for (auto x = start_x; x <= end_x; x++)
+        scanline_ptr[x] = color_for_format(format, scanline_ptr[x]).blend(color).value();
+}
+
 template<unsigned SamplesPerPixel>
 template<WindingRule WindingRule>
 FLATTEN __attribute__((hot)) void EdgeFlagPathRasterizer<SamplesPerPixel>::write_scanline(DeprecatedPainter& painter, int scanline, EdgeExtent edge_extent, auto& color_or_function)
@@ -404,12 +413,17 @@ FLATTEN __attribute__((hot)) void EdgeFlagPathRasterizer<SamplesPerPixel>::write
             write_pixel(dest_format, dest_ptr, scanline, x, sample, color_or_function);
         });
     };
-    // Fast fill case: Track spans of solid color and set the entire span via a fast_u32_fill().
-    // Used for opaque colors (i.e. alpha == 255).
+    // Fast fill case: Track spans of solid color and write the entire span at once. Opaque colors are set via a
+    // fast_u32_fill(), other colors are blended without recomputing the coverage and color for every pixel.
     auto write_scanline_with_fast_fills = [&](Color color) {
-        if (color.alpha() != 255)
-            return write_scanline_pixelwise(color);
         constexpr SampleType full_coverage = NumericLimits<SampleType>::max();
+        auto full_coverage_color = scanline_color(scanline, 0, 255, color);
+        auto fill_span = [&](int start, int end) {
+            if (full_coverage_color.alpha() == 255)
+                fast_fill_solid_color_span(dest_ptr, start, end, full_coverage_color);
+            else
+                fast_blend_solid_color_span(dest_format, dest_ptr, start, end, full_coverage_color);
+        };
         int full_coverage_count = 0;
         accumulate_scanline<WindingRule>(clipped_extent, acc, [&](int x, SampleType sample) {
             if (sample == full_coverage) {
@@ -419,12 +433,12 @@ FLATTEN __attribute__((hot)) void EdgeFlagPathRasterizer<SamplesPerPixel>::write
                 write_pixel(dest_format, dest_ptr, scanline, x, sample, color);
             }
             if (full_coverage_count > 0) {
-                fast_fill_solid_color_span(dest_ptr, x - full_coverage_count, x - 1, color);
+                fill_span(x - full_coverage_count, x - 1);
                 full_coverage_count = 0;
             }
         });
         if (full_coverage_count > 0)
-            fast_fill_solid_color_span(dest_ptr, clipped_extent.max_x - full_coverage_count + 1, clipped_extent.max_x, color);
+            fill_span(clipped_extent.max_x - full_coverage_count + 1, clipped_extent.max_x);
     };
     switch_on_color_or_function(
         color_or_function, write_scanline_with_fast_fills, write_scanline_pixelwise);
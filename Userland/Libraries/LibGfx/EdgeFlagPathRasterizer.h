@@ -182,6 +182,7 @@ private:
     Color scanline_color(int scanline, int offset, u8 alpha, auto& color_or_function);
     void write_pixel(BitmapFormat format, ARGB32* scanline_ptr, int scanline, int offset, SampleType sample, auto& color_or_function);
     void fast_fill_solid_color_span(ARGB32* scanline_ptr, int start, int end, Color color);
+    void fast_blend_solid_color_span(BitmapFormat format, ARGB32* scanline_ptr, int start, int end, Color color);
 
     template<WindingRule, typename Callback>
     auto accumulate_scanline(EdgeExtent, auto, Callback);
@@ -6,6 +6,7 @@
 
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/TextLayout.h>
 #include <harfbuzz/hb.h>
 
 namespace Gfx {
@@ -36,4 +37,11 @@ hb_font_t* Font::harfbuzz_font() const
     return m_harfbuzz_font;
 }
 
+HashMap<ByteString, ShapedText>& Font::shaping_cache() const
+{
+    if (!m_shaping_cache)
+        m_shaping_cache = make<HashMap<ByteString, ShapedText>>();
+    return *m_shaping_cache;
+}
+
 }
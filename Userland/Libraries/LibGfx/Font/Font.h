@@ -9,6 +9,9 @@
 
 #include <AK/Bitmap.h>
 #include <AK/ByteReader.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/String.h>
@@ -54,6 +57,7 @@ enum FontWidth {
 constexpr float text_shaping_resolution = 64;
 
 class Typeface;
+struct ShapedText;
 
 class Font : public RefCounted<Font> {
 public:
@@ -92,11 +96,15 @@ public:
     Font const& bold_variant() const;
     hb_font_t* harfbuzz_font() const;
 
+    // Memoized shape_text() results for this font, keyed by the shaped text.
+    HashMap<ByteString, ShapedText>& shaping_cache() const;
+
     virtual Typeface const& typeface() const = 0;
 
 private:
     mutable RefPtr<Gfx::Font const> m_bold_variant;
     mutable hb_font_t* m_harfbuzz_font { nullptr };
+    mutable OwnPtr<HashMap<ByteString, ShapedText>> m_shaping_cache;
 };
 
 }
@@ -11,6 +11,7 @@
 
 #include <core/SkData.h>
 #include <core/SkFontMgr.h>
+#include <core/SkGraphics.h>
 #include <core/SkRefCnt.h>
 #include <core/SkTypeface.h>
 #ifndef AK_OS_ANDROID
@@ -58,6 +59,21 @@ ErrorOr<NonnullRefPtr<TypefaceSkia>> TypefaceSkia::load_from_buffer(AK::Readonly
     return adopt_ref(*new TypefaceSkia { make<TypefaceSkia::Impl>(skia_typeface), buffer, ttc_index });
 }
 
+void TypefaceSkia::set_glyph_cache_limit(size_t bytes)
+{
+    SkGraphics::SetFontCacheLimit(bytes);
+}
+
+size_t TypefaceSkia::glyph_cache_limit()
+{
+    return SkGraphics::GetFontCacheLimit();
+}
+
+size_t TypefaceSkia::glyph_cache_memory_usage()
+{
+    return SkGraphics::GetFontCacheUsed();
+}
+
 SkTypeface const* TypefaceSkia::sk_typeface() const
 {
     return impl().skia_typeface.get();
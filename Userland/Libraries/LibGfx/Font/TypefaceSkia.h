@@ -29,6 +29,12 @@ public:
 
     SkTypeface const* sk_typeface() const;
 
+    // Rasterized glyphs are kept in a single LRU cache shared by all typefaces, keyed by typeface, size and subpixel
+    // position, so repeated text paints from cached glyph images.
+    static void set_glyph_cache_limit(size_t bytes);
+    static size_t glyph_cache_limit();
+    static size_t glyph_cache_memory_usage();
+
 private:
     struct Impl;
     Impl& impl() const { return *m_impl; }
@@ -11,11 +11,13 @@ namespace Gfx {
 void FontCascadeList::add(NonnullRefPtr<Font> font)
 {
     m_fonts.append({ move(font), {} });
+    m_fallback_cache = nullptr;
 }
 
 void FontCascadeList::add(NonnullRefPtr<Font> font, Vector<UnicodeRange> unicode_ranges)
 {
     m_fonts.append({ move(font), move(unicode_ranges) });
+    m_fallback_cache = nullptr;
 }
 
 void FontCascadeList::extend(FontCascadeList const& other)
@@ -23,23 +25,48 @@ void FontCascadeList::extend(FontCascadeList const& other)
     for (auto const& font : other.m_fonts) {
         m_fonts.append({ font.font, font.unicode_ranges });
     }
+    m_fallback_cache = nullptr;
 }
 
-Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
+bool FontCascadeList::entry_contains_code_point(Entry const& entry, u32 code_point)
+{
+    if (entry.unicode_ranges.has_value()) {
+        for (auto const& range : *entry.unicode_ranges) {
+            if (range.contains(code_point) && entry.font->contains_glyph(code_point))
+                return true;
+        }
+        return false;
+    }
+    return entry.font->contains_glyph(code_point);
+}
+
+Gfx::Font const& FontCascadeList::find_font_for_code_point(u32 code_point) const
 {
     for (auto const& entry : m_fonts) {
-        if (entry.unicode_ranges.has_value()) {
-            for (auto const& range : *entry.unicode_ranges) {
-                if (range.contains(code_point) && entry.font->contains_glyph(code_point))
-                    return entry.font;
-            }
-        } else if (entry.font->contains_glyph(code_point)) {
+        if (entry_contains_code_point(entry, code_point))
             return entry.font;
-        }
     }
     return *m_last_resort_font;
 }
 
+Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
+{
+    // Most text is covered by the first font, which needs no cache.
+    if (!m_fonts.is_empty() && entry_contains_code_point(m_fonts.first(), code_point))
+        return m_fonts.first().font;
+
+    if (!m_fallback_cache)
+        m_fallback_cache = make<Array<CachedFallback, fallback_cache_size>>();
+
+    auto& cached_fallback = (*m_fallback_cache)[code_point % fallback_cache_size];
+    if (cached_fallback.font && cached_fallback.code_point == code_point)
+        return *cached_fallback.font;
+
+    auto const& font = find_font_for_code_point(code_point);
+    cached_fallback = { code_point, &font };
+    return font;
+}
+
 bool FontCascadeList::equals(FontCascadeList const& other) const
 {
     if (m_fonts.size() != other.m_fonts.size())
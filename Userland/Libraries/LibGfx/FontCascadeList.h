@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/OwnPtr.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -43,11 +45,27 @@ public:
         Optional<Vector<UnicodeRange>> unicode_ranges;
     };
 
-    void set_last_resort_font(NonnullRefPtr<Font> font) { m_last_resort_font = move(font); }
+    void set_last_resort_font(NonnullRefPtr<Font> font)
+    {
+        m_last_resort_font = move(font);
+        m_fallback_cache = nullptr;
+    }
 
 private:
+    static bool entry_contains_code_point(Entry const&, u32 code_point);
+    Gfx::Font const& find_font_for_code_point(u32 code_point) const;
+
     RefPtr<Font const> m_last_resort_font;
     Vector<Entry> m_fonts;
+
+    // Remembers which font was picked for code points that the first font doesn't cover, so that text which keeps
+    // falling back (e.g. CJK or emoji) doesn't walk the whole list for every code point.
+    struct CachedFallback {
+        u32 code_point { 0 };
+        Font const* font { nullptr };
+    };
+    static constexpr size_t fallback_cache_size = 128;
+    mutable OwnPtr<Array<CachedFallback, fallback_cache_size>> m_fallback_cache;
 };
 
 }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/Math.h>
 #include <LibGfx/DeprecatedPainter.h>
 #include <LibGfx/Gradients.h>
@@ -45,6 +46,35 @@ float color_stop_step(ColorStop const& previous_stop, ColorStop const& next_stop
     return c;
 }
 
+// The colors along a gradient line, sampled once for every shade the gradient needs.
+struct GradientLineColors : public RefCounted<GradientLineColors> {
+    Vector<Color, 1024> colors;
+    bool requires_blending { false };
+};
+
+struct GradientLineColorsKey {
+    Vector<ColorStop> color_stops;
+    int color_count { 0 };
+    int necessary_length { 0 };
+    int start_offset { 0 };
+    AlphaType alpha_type { AlphaType::Premultiplied };
+
+    bool operator==(GradientLineColorsKey const&) const = default;
+};
+
+struct GradientLineColorsKeyTraits : public DefaultTraits<GradientLineColorsKey> {
+    static unsigned hash(GradientLineColorsKey const& key)
+    {
+        auto hash = pair_int_hash(pair_int_hash(key.color_count, key.necessary_length), pair_int_hash(key.start_offset, to_underlying(key.alpha_type)));
+        for (auto const& color_stop : key.color_stops) {
+            hash = pair_int_hash(hash, pair_int_hash(color_stop.color.value(), bit_cast<u32>(color_stop.position)));
+            if (color_stop.transition_hint.has_value())
+                hash = pair_int_hash(hash, bit_cast<u32>(*color_stop.transition_hint));
+        }
+        return hash;
+    }
+};
+
 class GradientLine {
 public:
     GradientLine(int gradient_length, ReadonlySpan<ColorStop> color_stops, Optional<float> repeat_length, AlphaType alpha_type = AlphaType::Premultiplied)
@@ -58,20 +88,7 @@ public:
         m_sample_scale = float(necessary_length) / gradient_length;
         // Note: color_count will be < gradient_length for repeating gradients.
         auto color_count = round_to<int>(repeat_length.value_or(1.0f) * necessary_length);
-        m_gradient_line_colors.resize(color_count);
-
-        for (int loc = 0; loc < color_count; loc++) {
-            auto relative_loc = float(loc + m_start_offset) / necessary_length;
-            Color gradient_color = color_blend(color_stops[0].color, color_stops[1].color,
-                color_stop_step(color_stops[0], color_stops[1], relative_loc));
-            for (size_t i = 1; i < color_stops.size() - 1; i++) {
-                gradient_color = color_blend(gradient_color, color_stops[i + 1].color,
-                    color_stop_step(color_stops[i], color_stops[i + 1], relative_loc));
-            }
-            m_gradient_line_colors[loc] = gradient_color;
-            if (gradient_color.alpha() < 255)
-                m_requires_blending = true;
-        }
+        m_gradient_line_colors = cached_gradient_line_colors(color_count, necessary_length);
     }
 
     Color color_blend(Color a, Color b, float amount) const
@@ -87,9 +104,9 @@ public:
     {
         if (index < 0)
             return m_color_stops.first().color;
-        if (index >= static_cast<i64>(m_gradient_line_colors.size()))
+        if (index >= static_cast<i64>(m_gradient_line_colors->colors.size()))
             return m_color_stops.last().color;
-        return m_gradient_line_colors[index];
+        return m_gradient_line_colors->colors[index];
     }
 
     Color sample_color(float loc) const
@@ -101,7 +118,7 @@ public:
         auto repeat_wrap_if_required = [&](i64 loc) {
             if (m_repeat_mode != RepeatMode::None) {
                 auto current_loc = loc + m_start_offset;
-                auto gradient_len = static_cast<i64>(m_gradient_line_colors.size());
+                auto gradient_len = static_cast<i64>(m_gradient_line_colors->colors.size());
                 if (m_repeat_mode == RepeatMode::Repeat) {
                     auto color_loc = current_loc % gradient_len;
                     return color_loc < 0 ? gradient_len + color_loc : color_loc;
@@ -126,10 +143,18 @@ public:
     {
         auto clipped_rect = rect.intersected(painter.clip_rect());
         auto start_offset = clipped_rect.location() - rect.location();
+        auto requires_blending = m_gradient_line_colors->requires_blending;
         for (int y = 0; y < clipped_rect.height(); y++) {
+            // Opaque gradients overwrite whatever is there, so the colors go straight into the scanline.
+            if (!requires_blending) {
+                auto* scanline = painter.target().scanline(clipped_rect.y() + y) + clipped_rect.x();
+                for (int x = 0; x < clipped_rect.width(); x++)
+                    scanline[x] = sample_color(location_transform(x + start_offset.x(), y + start_offset.y())).value();
+                continue;
+            }
             for (int x = 0; x < clipped_rect.width(); x++) {
                 auto pixel = sample_color(location_transform(x + start_offset.x(), y + start_offset.y()));
-                painter.set_physical_pixel(clipped_rect.location().translated(x, y), pixel, m_requires_blending);
+                painter.set_physical_pixel(clipped_rect.location().translated(x, y), pixel, true);
             }
         }
     }
@@ -153,14 +178,53 @@ public:
     }
 
 private:
+    // Pages tend to paint the same gradients over and over, e.g. on every button, so the sampled colors are kept
+    // around for any gradient line with the same stops and length.
+    NonnullRefPtr<GradientLineColors const> cached_gradient_line_colors(int color_count, int necessary_length) const
+    {
+        // Once full, the cache is simply cleared. The gradients still in use are quickly sampled again.
+        static constexpr size_t max_cached_gradient_lines = 256;
+        static HashMap<GradientLineColorsKey, NonnullRefPtr<GradientLineColors const>, GradientLineColorsKeyTraits> s_cache;
+
+        GradientLineColorsKey key {
+            .color_stops = Vector<ColorStop> { m_color_stops },
+            .color_count = color_count,
+            .necessary_length = necessary_length,
+            .start_offset = m_start_offset,
+            .alpha_type = m_alpha_type,
+        };
+        if (auto it = s_cache.find(key); it != s_cache.end())
+            return it->value;
+        if (s_cache.size() >= max_cached_gradient_lines)
+            s_cache.clear();
+
+        auto const& color_stops = m_color_stops;
+        auto gradient_line_colors = adopt_ref(*new GradientLineColors);
+        gradient_line_colors->colors.resize(color_count);
+        for (int loc = 0; loc < color_count; loc++) {
+            auto relative_loc = float(loc + m_start_offset) / necessary_length;
+            Color gradient_color = color_blend(color_stops[0].color, color_stops[1].color,
+                color_stop_step(color_stops[0], color_stops[1], relative_loc));
+            for (size_t i = 1; i < color_stops.size() - 1; i++) {
+                gradient_color = color_blend(gradient_color, color_stops[i + 1].color,
+                    color_stop_step(color_stops[i], color_stops[i + 1], relative_loc));
+            }
+            gradient_line_colors->colors[loc] = gradient_color;
+            if (gradient_color.alpha() < 255)
+                gradient_line_colors->requires_blending = true;
+        }
+
+        s_cache.set(move(key), gradient_line_colors);
+        return gradient_line_colors;
+    }
+
     RepeatMode m_repeat_mode { RepeatMode::None };
     int m_start_offset { 0 };
     float m_sample_scale { 1 };
     ReadonlySpan<ColorStop> m_color_stops {};
     AlphaType m_alpha_type { AlphaType::Premultiplied };
 
-    Vector<Color, 1024> m_gradient_line_colors;
-    bool m_requires_blending = false;
+    RefPtr<GradientLineColors const> m_gradient_line_colors;
 };
 
 template<typename TransformFunction>
@@ -1705,16 +1705,55 @@ ErrorOr<void> Profile::convert_image_matrix_matrix(Gfx::Bitmap& bitmap, MatrixMa
     return {};
 }
 
+namespace {
+
+// Going through the PCS is expensive, while neighboring pixels of an image often share a color.
+// This remembers the most recent conversions in a small direct-mapped table.
+class ConversionCache {
+public:
+    ConversionCache()
+    {
+        m_entries.resize(entry_count);
+    }
+
+    template<typename Convert>
+    ErrorOr<u32> convert(u32 input, Convert convert)
+    {
+        auto& entry = m_entries[(input * 2654435761u) >> (32 - index_bits)];
+        if (entry.is_valid && entry.input == input)
+            return entry.output;
+        entry = { .input = input, .output = TRY(convert()), .is_valid = true };
+        return entry.output;
+    }
+
+private:
+    static constexpr size_t index_bits = 12;
+    static constexpr size_t entry_count = 1 << index_bits;
+
+    struct Entry {
+        u32 input { 0 };
+        u32 output { 0 };
+        bool is_valid { false };
+    };
+    Vector<Entry> m_entries;
+};
+
+}
+
 ErrorOr<void> Profile::convert_image(Gfx::Bitmap& bitmap, Profile const& source_profile) const
 {
     if (auto map = matrix_matrix_conversion(source_profile); map.has_value())
         return convert_image_matrix_matrix(bitmap, map.value());
 
+    ConversionCache cache;
     for (auto& pixel : bitmap) {
-        u8 rgb[] = { Color::from_argb(pixel).red(), Color::from_argb(pixel).green(), Color::from_argb(pixel).blue() };
-        auto pcs = TRY(source_profile.to_pcs(rgb));
-        TRY(from_pcs(source_profile, pcs, rgb));
-        pixel = Color(rgb[0], rgb[1], rgb[2], Color::from_argb(pixel).alpha()).value();
+        auto rgb_value = TRY(cache.convert(pixel & 0xffffff, [&]() -> ErrorOr<u32> {
+            u8 rgb[] = { Color::from_argb(pixel).red(), Color::from_argb(pixel).green(), Color::from_argb(pixel).blue() };
+            auto pcs = TRY(source_profile.to_pcs(rgb));
+            TRY(from_pcs(source_profile, pcs, rgb));
+            return Color(rgb[0], rgb[1], rgb[2]).value() & 0xffffff;
+        }));
+        pixel = (pixel & 0xff000000) | rgb_value;
     }
 
     return {};
@@ -1733,13 +1772,17 @@ ErrorOr<void> Profile::convert_cmyk_image(Bitmap& out, CMYKBitmap const& in, Pro
     ARGB32* out_data = out.begin();
     CMYK const* in_data = const_cast<CMYKBitmap&>(in).begin();
 
+    ConversionCache cache;
     for (size_t i = 0; i < in.data_size() / sizeof(CMYK); ++i) {
         u8 cmyk[] = { in_data[i].c, in_data[i].m, in_data[i].y, in_data[i].k };
-        auto pcs = TRY(source_profile.to_pcs(cmyk));
+        auto cmyk_value = (static_cast<u32>(cmyk[0]) << 24) | (cmyk[1] << 16) | (cmyk[2] << 8) | cmyk[3];
+        out_data[i] = TRY(cache.convert(cmyk_value, [&]() -> ErrorOr<u32> {
+            auto pcs = TRY(source_profile.to_pcs(cmyk));
 
-        u8 rgb[3];
-        TRY(from_pcs(source_profile, pcs, rgb));
-        out_data[i] = Color(rgb[0], rgb[1], rgb[2]).value();
+            u8 rgb[3];
+            TRY(from_pcs(source_profile, pcs, rgb));
+            return Color(rgb[0], rgb[1], rgb[2]).value();
+        }));
     }
 
     return {};
@@ -26,20 +26,42 @@ struct JPEGLoadingContext {
     ReadonlyBytes data;
     Vector<u8> icc_data;
 
+    IntSize natural_size;
+    unsigned scale_denominator { 1 };
+
     JPEGLoadingContext(ReadonlyBytes data)
         : data(data)
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size);
 };
 
+// libjpeg can scale the image down by 1/2, 1/4 or 1/8 while decoding, by skipping the high frequency DCT coefficients.
+// This picks the largest of those reductions that still covers the ideal size.
+static unsigned scale_denominator_for(IntSize natural_size, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty() || natural_size.is_empty())
+        return 1;
+    for (unsigned denominator = 8; denominator > 1; denominator /= 2) {
+        auto scaled_width = ceil_div(static_cast<unsigned>(natural_size.width()), denominator);
+        auto scaled_height = ceil_div(static_cast<unsigned>(natural_size.height()), denominator);
+        if (scaled_width >= static_cast<unsigned>(ideal_size->width()) && scaled_height >= static_cast<unsigned>(ideal_size->height()))
+            return denominator;
+    }
+    return 1;
+}
+
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
 {
+    rgb_bitmap = nullptr;
+    cmyk_bitmap = nullptr;
+    icc_data.clear();
+
     struct jpeg_decompress_struct cinfo;
     struct JPEGErrorManager jerr;
     cinfo.err = jpeg_std_error(&jerr);
@@ -63,7 +85,15 @@ ErrorOr<void> JPEGLoadingContext::decode()
     source_manager.next_input_byte = data.data();
     source_manager.bytes_in_buffer = data.size();
     source_manager.init_source = [](j_decompress_ptr) {};
-    source_manager.fill_input_buffer = [](j_decompress_ptr) -> boolean { return false; };
+    source_manager.fill_input_buffer = [](j_decompress_ptr context) -> boolean {
+        // We ran out of data before the end of the image, e.g. because only part of it has been loaded so far.
+        // Like libjpeg's own stdio source, insert a fake EOI marker so that the image decodes with whatever data we
+        // have, instead of suspending forever in jpeg_read_scanlines().
+        static constexpr JOCTET end_of_image_marker[] = { 0xFF, JPEG_EOI };
+        context->src->next_input_byte = end_of_image_marker;
+        context->src->bytes_in_buffer = sizeof(end_of_image_marker);
+        return TRUE;
+    };
     source_manager.skip_input_data = [](j_decompress_ptr context, long num_bytes) {
         if (num_bytes > static_cast<long>(context->src->bytes_in_buffer)) {
             context->src->bytes_in_buffer = 0;
@@ -89,10 +119,16 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    natural_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+    scale_denominator = scale_denominator_for(natural_size, ideal_size);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scale_denominator;
+
     jpeg_start_decompress(&cinfo);
 
     if (cinfo.out_color_space == JCS_EXT_BGRX) {
-        rgb_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
+        // Decode straight into shared memory, so the frame can be sent to other processes without copying it.
+        rgb_bitmap = TRY(Gfx::Bitmap::create_shareable(Gfx::BitmapFormat::BGRx8888, Gfx::AlphaType::Premultiplied, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
         while (cinfo.output_scanline < cinfo.output_height) {
             auto* row_ptr = (u8*)rgb_bitmap->scanline(cinfo.output_scanline);
             jpeg_read_scanlines(&cinfo, &row_ptr, 1);
@@ -137,11 +173,7 @@ IntSize JPEGImageDecoderPlugin::size()
 
     if (m_context->state == JPEGLoadingContext::State::Error)
         return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->natural_size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -157,7 +189,7 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -165,8 +197,12 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
+    // A previous decode at another scale can't serve this request, so decode again.
+    if (m_context->state == JPEGLoadingContext::State::Decoded && m_context->scale_denominator != scale_denominator_for(m_context->natural_size, ideal_size))
+        m_context->state = JPEGLoadingContext::State::NotDecoded;
+
     if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        TRY(m_context->decode());
+        TRY(m_context->decode(ideal_size));
         m_context->state = JPEGLoadingContext::State::Decoded;
     }
 
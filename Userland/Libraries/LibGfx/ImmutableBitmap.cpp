@@ -9,6 +9,7 @@
 namespace Gfx {
 
 static size_t s_next_immutable_bitmap_id = 0;
+static size_t s_total_size_in_bytes = 0;
 
 NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create(NonnullRefPtr<Bitmap> bitmap)
 {
@@ -19,6 +20,17 @@ ImmutableBitmap::ImmutableBitmap(NonnullRefPtr<Bitmap> bitmap)
     : m_bitmap(move(bitmap))
     , m_id(s_next_immutable_bitmap_id++)
 {
+    s_total_size_in_bytes += m_bitmap->size_in_bytes();
+}
+
+ImmutableBitmap::~ImmutableBitmap()
+{
+    s_total_size_in_bytes -= m_bitmap->size_in_bytes();
+}
+
+size_t ImmutableBitmap::total_size_in_bytes()
+{
+    return s_total_size_in_bytes;
 }
 
 }
@@ -18,7 +18,10 @@ class ImmutableBitmap final : public RefCounted<ImmutableBitmap> {
 public:
     static NonnullRefPtr<ImmutableBitmap> create(NonnullRefPtr<Bitmap> bitmap);
 
-    ~ImmutableBitmap() = default;
+    ~ImmutableBitmap();
+
+    // The pixel memory of all immutable bitmaps in this process, which are mostly decoded images.
+    static size_t total_size_in_bytes();
 
     Bitmap const& bitmap() const { return *m_bitmap; }
 
@@ -12,7 +12,7 @@
 
 namespace Gfx {
 
-RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type)
+static ShapedText shape_text_uncached(Utf8View string, Gfx::Font const& font)
 {
     hb_buffer_t* buffer = hb_buffer_create();
     ScopeGuard destroy_buffer = [&]() { hb_buffer_destroy(buffer); };
@@ -29,17 +29,52 @@ RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, Utf8View string, Gfx::Fon
     glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
     auto* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
 
-    Vector<Gfx::DrawGlyph> glyph_run;
-    FloatPoint point = baseline_start;
+    Vector<Gfx::DrawGlyph> glyphs;
+    glyphs.ensure_capacity(glyph_count);
+    FloatPoint point;
     for (size_t i = 0; i < glyph_count; ++i) {
         auto position = point
             - FloatPoint { 0, font.pixel_metrics().ascent }
             + FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution;
-        glyph_run.append({ position, glyph_info[i].codepoint });
+        glyphs.unchecked_append({ position, glyph_info[i].codepoint });
         point += FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution;
     }
 
-    return adopt_ref(*new Gfx::GlyphRun(move(glyph_run), font, text_type, point.x()));
+    return { move(glyphs), point.x() };
+}
+
+RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type)
+{
+    // Layout shapes the same words again every time a paragraph is (re)wrapped, so we keep the results around per font.
+    // Runs longer than this are rare enough (and expensive enough to keep around) that they're always shaped afresh.
+    static constexpr size_t max_cached_text_length = 1024;
+    // Once full, the cache is simply cleared. Whatever text is still in use is quickly shaped again.
+    static constexpr size_t max_cached_texts_per_font = 4096;
+
+    auto make_glyph_run = [&](ShapedText const& shaped_text) {
+        // NOTE: Glyph runs are modified during layout, so each one gets its own copy of the glyphs.
+        auto glyphs = shaped_text.glyphs;
+        if (!baseline_start.is_zero()) {
+            for (auto& glyph : glyphs)
+                glyph.translate_by(baseline_start);
+        }
+        return adopt_ref(*new Gfx::GlyphRun(move(glyphs), font, text_type, baseline_start.x() + shaped_text.width));
+    };
+
+    auto text = string.as_string();
+    if (text.length() > max_cached_text_length)
+        return make_glyph_run(shape_text_uncached(string, font));
+
+    auto& cache = font.shaping_cache();
+    if (auto it = cache.find(text); it != cache.end())
+        return make_glyph_run(it->value);
+
+    if (cache.size() >= max_cached_texts_per_font)
+        cache.clear();
+    auto shaped_text = shape_text_uncached(string, font);
+    auto glyph_run = make_glyph_run(shaped_text);
+    cache.set(ByteString { text }, move(shaped_text));
+    return glyph_run;
 }
 
 float measure_text_width(Utf8View const& string, Gfx::Font const& font)
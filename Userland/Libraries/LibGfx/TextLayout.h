@@ -30,6 +30,12 @@ struct DrawGlyph {
     }
 };
 
+// The output of shaping a string, positioned relative to a baseline that starts at the origin.
+struct ShapedText {
+    Vector<DrawGlyph> glyphs;
+    float width { 0 };
+};
+
 class GlyphRun : public RefCounted<GlyphRun> {
 public:
     enum class TextType {
@@ -8,6 +8,7 @@
 #include <AK/Vector.h>
 #include <LibCore/Socket.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
@@ -43,10 +44,13 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Core::LocalS
                 break;
             }
 
-            auto message = queue->messages.take_first();
+            // Take everything that has queued up while we were busy, so it can go out in as few writes as possible.
+            Vector<MessageBuffer> messages;
+            while (!queue->messages.is_empty())
+                messages.append(queue->messages.take_first());
             queue->mutex.unlock();
 
-            if (auto result = message.transfer_message(*m_socket); result.is_error()) {
+            if (auto result = MessageBuffer::transfer_messages(*m_socket, messages); result.is_error()) {
                 dbgln("ConnectionBase::send_thread: {}", result.error());
                 continue;
             }
@@ -96,30 +100,69 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
 void ConnectionBase::shutdown()
 {
     m_socket->close();
+
+    auto pending_responses = move(m_pending_responses);
+    for (auto& pending_response : pending_responses)
+        pending_response.on_disconnect();
+
     die();
 }
 
+void ConnectionBase::expect_response(u32 endpoint_magic, int message_id, Function<void(Message&)> on_response, Function<void()> on_disconnect)
+{
+    m_pending_responses.append({ endpoint_magic, message_id, move(on_response), move(on_disconnect) });
+}
+
 void ConnectionBase::shutdown_with_error(Error const& error)
 {
     dbgln("IPC::ConnectionBase ({:p}) had an error ({}), disconnecting.", this, error);
     shutdown();
 }
 
+static bool is_superseded_by_later_message(Span<NonnullOwnPtr<Message>> messages, size_t index)
+{
+    auto const& message = *messages[index];
+    if (!message.can_be_coalesced())
+        return false;
+
+    // Only look across a run of coalescable messages, so that the state a message carries is never dropped before
+    // some other message that might depend on it.
+    for (size_t i = index + 1; i < messages.size() && messages[i]->can_be_coalesced(); ++i) {
+        if (message.is_superseded_by(*messages[i]))
+            return true;
+    }
+    return false;
+}
+
 void ConnectionBase::handle_messages()
 {
     auto messages = move(m_unprocessed_messages);
-    for (auto& message : messages) {
-        if (message->endpoint_magic() == m_local_endpoint_magic) {
-            auto handler_result = m_local_stub.handle(*message);
-            if (handler_result.is_error()) {
-                dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
-                continue;
+    for (size_t i = 0; i < messages.size(); ++i) {
+        auto& message = messages[i];
+        if (is_superseded_by_later_message(messages, i))
+            continue;
+
+        if (message->endpoint_magic() != m_local_endpoint_magic) {
+            auto pending_response_index = m_pending_responses.find_first_index_if([&](auto const& pending_response) {
+                return pending_response.endpoint_magic == message->endpoint_magic() && pending_response.message_id == message->message_id();
+            });
+            if (pending_response_index.has_value()) {
+                auto pending_response = m_pending_responses.take(*pending_response_index);
+                pending_response.on_response(*message);
             }
+            continue;
+        }
+
+        TRACE_SCOPE("ipc", message->message_name());
+        auto handler_result = m_local_stub.handle(*message);
+        if (handler_result.is_error()) {
+            dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
+            continue;
+        }
 
-            if (auto response = handler_result.release_value()) {
-                if (auto post_result = post_message(*response); post_result.is_error()) {
-                    dbgln("IPC::ConnectionBase::handle_messages: {}", post_result.error());
-                }
+        if (auto response = handler_result.release_value()) {
+            if (auto post_result = post_message(*response); post_result.is_error()) {
+                dbgln("IPC::ConnectionBase::handle_messages: {}", post_result.error());
             }
         }
     }
@@ -137,16 +180,13 @@ void ConnectionBase::wait_for_socket_to_become_readable()
     VERIFY(maybe_did_become_readable.value());
 }
 
-ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without_blocking()
+ErrorOr<ByteBuffer> ConnectionBase::read_as_much_as_possible_from_socket_without_blocking()
 {
-    Vector<u8> bytes;
-
-    if (!m_unprocessed_bytes.is_empty()) {
-        bytes.append(m_unprocessed_bytes.data(), m_unprocessed_bytes.size());
-        m_unprocessed_bytes.clear();
-    }
+    // Pick up where the partial message from last time left off, and receive straight into the end of its buffer.
+    auto bytes = move(m_unprocessed_bytes);
+    m_unprocessed_bytes = {};
 
-    u8 buffer[4096];
+    static constexpr size_t receive_size = 64 * KiB;
     Vector<int> received_fds;
 
     bool should_shut_down = false;
@@ -158,8 +198,12 @@ ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without
     };
 
     while (m_socket->is_open()) {
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+        auto old_size = bytes.size();
+        auto buffer = TRY(bytes.get_bytes_for_writing(receive_size));
+
+        auto maybe_bytes_read = m_socket->receive_message(buffer, MSG_DONTWAIT, received_fds);
         if (maybe_bytes_read.is_error()) {
+            bytes.trim(old_size, false);
             auto error = maybe_bytes_read.release_error();
             if (error.is_syscall() && error.code() == EAGAIN) {
                 break;
@@ -176,12 +220,12 @@ ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without
         }
 
         auto bytes_read = maybe_bytes_read.release_value();
+        bytes.trim(old_size + bytes_read.size(), false);
         if (bytes_read.is_empty()) {
             schedule_shutdown();
             break;
         }
 
-        bytes.append(bytes_read.data(), bytes_read.size());
         for (auto const& fd : received_fds)
             m_unprocessed_fds.enqueue(IPC::File::adopt_fd(fd));
     }
@@ -207,12 +251,16 @@ ErrorOr<void> ConnectionBase::drain_messages_from_peer()
         // Sometimes we might receive a partial message. That's okay, just stash away
         // the unprocessed bytes and we'll prepend them to the next incoming message
         // in the next run of this function.
-        auto remaining_bytes = TRY(ByteBuffer::copy(bytes.span().slice(index)));
         if (!m_unprocessed_bytes.is_empty()) {
             shutdown();
             return Error::from_string_literal("drain_messages_from_peer: Already have unprocessed bytes");
         }
-        m_unprocessed_bytes = move(remaining_bytes);
+        if (index > 0) {
+            auto remaining_size = bytes.size() - index;
+            memmove(bytes.data(), bytes.data() + index, remaining_size);
+            bytes.trim(remaining_size, false);
+        }
+        m_unprocessed_bytes = move(bytes);
     }
 
     if (!m_unprocessed_messages.is_empty()) {
@@ -225,15 +273,27 @@ ErrorOr<void> ConnectionBase::drain_messages_from_peer()
 
 OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32 endpoint_magic, int message_id)
 {
+    // Any requests of the same kind that were sent asynchronously before this one will be answered first, and those
+    // responses must be left for their own handlers.
+    auto responses_to_skip = 0uz;
+    for (auto const& pending_response : m_pending_responses) {
+        if (pending_response.endpoint_magic == endpoint_magic && pending_response.message_id == message_id)
+            ++responses_to_skip;
+    }
+
     for (;;) {
         // Double check we don't already have the event waiting for us.
         // Otherwise we might end up blocked for a while for no reason.
+        auto skipped_responses = 0uz;
         for (size_t i = 0; i < m_unprocessed_messages.size(); ++i) {
             auto& message = m_unprocessed_messages[i];
             if (message->endpoint_magic() != endpoint_magic)
                 continue;
-            if (message->message_id() == message_id)
-                return m_unprocessed_messages.take(i);
+            if (message->message_id() != message_id)
+                continue;
+            if (skipped_responses++ < responses_to_skip)
+                continue;
+            return m_unprocessed_messages.take(i);
         }
 
         if (!m_socket->is_open())
@@ -246,7 +306,7 @@ OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32
     return {};
 }
 
-void ConnectionBase::try_parse_messages(Vector<u8> const& bytes, size_t& index)
+void ConnectionBase::try_parse_messages(ReadonlyBytes bytes, size_t& index)
 {
     u32 message_size = 0;
     for (; index + sizeof(message_size) < bytes.size(); index += message_size) {
@@ -10,6 +10,7 @@
 #include <AK/Forward.h>
 #include <AK/Queue.h>
 #include <LibCore/EventReceiver.h>
+#include <LibCore/Promise.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
 #include <LibThreading/ConditionVariable.h>
@@ -41,10 +42,14 @@ protected:
     virtual OwnPtr<Message> try_parse_message(ReadonlyBytes, Queue<IPC::File>&) = 0;
 
     OwnPtr<IPC::Message> wait_for_specific_endpoint_message_impl(u32 endpoint_magic, int message_id);
+
+    // Registers a handler for the response to an asynchronously sent request. Responses arrive in the order their
+    // requests were sent, so each is handed to the oldest handler waiting for that kind of message.
+    void expect_response(u32 endpoint_magic, int message_id, Function<void(Message&)> on_response, Function<void()> on_disconnect);
     void wait_for_socket_to_become_readable();
-    ErrorOr<Vector<u8>> read_as_much_as_possible_from_socket_without_blocking();
+    ErrorOr<ByteBuffer> read_as_much_as_possible_from_socket_without_blocking();
     ErrorOr<void> drain_messages_from_peer();
-    void try_parse_messages(Vector<u8> const& bytes, size_t& index);
+    void try_parse_messages(ReadonlyBytes bytes, size_t& index);
 
     ErrorOr<void> post_message(MessageBuffer);
     void handle_messages();
@@ -59,6 +64,14 @@ protected:
     Queue<IPC::File> m_unprocessed_fds;
     ByteBuffer m_unprocessed_bytes;
 
+    struct PendingResponse {
+        u32 endpoint_magic { 0 };
+        int message_id { 0 };
+        Function<void(Message&)> on_response;
+        Function<void()> on_disconnect;
+    };
+    Vector<PendingResponse> m_pending_responses;
+
     u32 m_local_endpoint_magic { 0 };
 
     struct SendQueue : public AtomicRefCounted<SendQueue> {
@@ -95,6 +108,30 @@ public:
         return response.release_nonnull();
     }
 
+    // Sends a synchronous request without blocking on it. The promise is resolved once the response arrives, or
+    // rejected if the connection goes away first.
+    template<typename RequestType, typename... Args>
+    NonnullRefPtr<Core::Promise<NonnullOwnPtr<typename RequestType::ResponseType>>> send_async_with_response(Args&&... args)
+    {
+        using ResponseType = typename RequestType::ResponseType;
+        auto promise = Core::Promise<NonnullOwnPtr<ResponseType>>::construct();
+
+        if (auto result = post_message(RequestType(forward<Args>(args)...)); result.is_error()) {
+            promise->reject(result.release_error());
+            return promise;
+        }
+
+        expect_response(
+            PeerEndpoint::static_magic(), ResponseType::static_message_id(),
+            [promise](Message& response) {
+                promise->resolve(make<ResponseType>(move(static_cast<ResponseType&>(response))));
+            },
+            [promise] {
+                promise->reject(Error::from_string_literal("IPC connection closed before the response arrived"));
+            });
+        return promise;
+    }
+
     template<typename RequestType, typename... Args>
     OwnPtr<typename RequestType::ResponseType> send_sync_but_allow_failure(Args&&... args)
     {
@@ -50,6 +50,12 @@ ErrorOr<ByteBuffer> decode(Decoder& decoder)
     if (length == 0)
         return ByteBuffer {};
 
+    if (length >= shared_memory_byte_buffer_threshold) {
+        auto anon_file = TRY(decoder.decode<IPC::File>());
+        auto shared_buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(anon_file.take_fd(), length));
+        return ByteBuffer::copy(shared_buffer.data<void>(), length);
+    }
+
     auto buffer = TRY(ByteBuffer::create_uninitialized(length));
     auto bytes = buffer.bytes();
 
@@ -75,10 +75,35 @@ template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
     TRY(encoder.encode_size(value.size()));
+
+    if (value.size() >= shared_memory_byte_buffer_threshold) {
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(value.size()));
+        memcpy(buffer.data<void>(), value.data(), value.size());
+        TRY(encoder.encode(TRY(IPC::File::clone_fd(buffer.fd()))));
+        return {};
+    }
+
     TRY(encoder.append(value.data(), value.size()));
     return {};
 }
 
+size_t encoded_size_hint(String const& value)
+{
+    return sizeof(u32) + value.bytes().size();
+}
+
+size_t encoded_size_hint(ByteString const& value)
+{
+    return sizeof(u32) + value.length();
+}
+
+size_t encoded_size_hint(ByteBuffer const& value)
+{
+    if (value.size() >= shared_memory_byte_buffer_threshold)
+        return sizeof(u32);
+    return sizeof(u32) + value.size();
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, JsonValue const& value)
 {
@@ -177,6 +177,46 @@ ErrorOr<void> encode(Encoder& encoder, T const& variant)
     });
 }
 
+// A cheap estimate of how many bytes encoding a value will take, which generated messages use to size their buffer
+// up front. Types without an estimate count for nothing, and the buffer grows as needed while they are encoded.
+template<typename T>
+size_t encoded_size_hint(T const&)
+{
+    return 0;
+}
+
+template<Arithmetic T>
+size_t encoded_size_hint(T const&)
+{
+    return sizeof(T);
+}
+
+template<Enum T>
+size_t encoded_size_hint(T const&)
+{
+    return sizeof(UnderlyingType<T>);
+}
+
+size_t encoded_size_hint(String const&);
+size_t encoded_size_hint(ByteString const&);
+size_t encoded_size_hint(ByteBuffer const&);
+
+template<Concepts::Vector T>
+size_t encoded_size_hint(T const& vector)
+{
+    if constexpr (Arithmetic<typename T::ValueType>)
+        return sizeof(u32) + vector.size() * sizeof(typename T::ValueType);
+    return sizeof(u32);
+}
+
+template<Concepts::Optional T>
+size_t encoded_size_hint(T const& optional)
+{
+    if (optional.has_value())
+        return sizeof(bool) + encoded_size_hint(optional.value());
+    return sizeof(bool);
+}
+
 // This must be last so that it knows about the above specializations.
 template<typename T>
 ErrorOr<void> Encoder::encode(T const& value)
@@ -38,27 +38,25 @@ ErrorOr<void> MessageBuffer::append_file_descriptor(int fd)
     return {};
 }
 
-ErrorOr<void> MessageBuffer::transfer_message(Core::LocalSocket& socket)
+void MessageBuffer::write_message_size()
+{
+    MessageSizeType const message_size = m_data.size() - sizeof(MessageSizeType);
+    m_data.span().overwrite(0, reinterpret_cast<u8 const*>(&message_size), sizeof(message_size));
+}
+
+static ErrorOr<void> check_message_size(size_t size)
 {
-    Checked<MessageSizeType> checked_message_size { m_data.size() };
+    Checked<MessageSizeType> checked_message_size { size };
     checked_message_size -= sizeof(MessageSizeType);
 
     if (checked_message_size.has_overflow())
         return Error::from_string_literal("Message is too large for IPC encoding");
+    return {};
+}
 
-    MessageSizeType const message_size = checked_message_size.value();
-    m_data.span().overwrite(0, reinterpret_cast<u8 const*>(&message_size), sizeof(message_size));
-
-    auto raw_fds = Vector<int, 1> {};
-    auto num_fds_to_transfer = m_fds.size();
-    if (num_fds_to_transfer > 0) {
-        raw_fds.ensure_capacity(num_fds_to_transfer);
-        for (auto& owned_fd : m_fds) {
-            raw_fds.unchecked_append(owned_fd->value());
-        }
-    }
-
-    ReadonlyBytes bytes_to_write { m_data.span() };
+static ErrorOr<void> write_to_socket(Core::LocalSocket& socket, ReadonlyBytes bytes_to_write, Vector<int, 1> const& raw_fds)
+{
+    auto num_fds_to_transfer = raw_fds.size();
 
     while (!bytes_to_write.is_empty()) {
         ErrorOr<ssize_t> maybe_nwritten = 0;
@@ -104,4 +102,62 @@ ErrorOr<void> MessageBuffer::transfer_message(Core::LocalSocket& socket)
     return {};
 }
 
+// Batching is meant for the flood of small messages; anything bigger goes out on its own, without being copied.
+static constexpr size_t max_batched_message_size = 4 * KiB;
+static constexpr size_t max_batch_size = 64 * KiB;
+
+// Linux refuses to pass more than SCM_MAX_FD (253) file descriptors in one message.
+static constexpr size_t max_batched_file_descriptors = 64;
+
+ErrorOr<void> MessageBuffer::transfer_message(Core::LocalSocket& socket)
+{
+    TRY(check_message_size(m_data.size()));
+    write_message_size();
+
+    Vector<int, 1> raw_fds;
+    TRY(raw_fds.try_ensure_capacity(m_fds.size()));
+    for (auto& owned_fd : m_fds)
+        raw_fds.unchecked_append(owned_fd->value());
+
+    return write_to_socket(socket, m_data.span(), raw_fds);
+}
+
+ErrorOr<void> MessageBuffer::transfer_messages(Core::LocalSocket& socket, Span<MessageBuffer> messages)
+{
+    if (messages.size() == 1)
+        return messages[0].transfer_message(socket);
+
+    Vector<u8> batch;
+    Vector<int, 1> batch_fds;
+
+    auto flush_batch = [&]() -> ErrorOr<void> {
+        if (batch.is_empty())
+            return {};
+        TRY(write_to_socket(socket, batch.span(), batch_fds));
+        batch.clear_with_capacity();
+        batch_fds.clear_with_capacity();
+        return {};
+    };
+
+    for (auto& message : messages) {
+        if (message.m_data.size() > max_batched_message_size) {
+            TRY(flush_batch());
+            TRY(message.transfer_message(socket));
+            continue;
+        }
+
+        TRY(check_message_size(message.m_data.size()));
+        message.write_message_size();
+
+        if (batch.size() + message.m_data.size() > max_batch_size || batch_fds.size() + message.m_fds.size() > max_batched_file_descriptors)
+            TRY(flush_batch());
+
+        TRY(batch.try_append(message.m_data.data(), message.m_data.size()));
+        for (auto& owned_fd : message.m_fds)
+            TRY(batch_fds.try_append(owned_fd->value()));
+    }
+
+    return flush_batch();
+}
+
 }
@@ -35,6 +35,9 @@ private:
     int m_fd;
 };
 
+// Byte buffers at least this large are passed in shared memory, rather than being copied through the socket.
+static constexpr size_t shared_memory_byte_buffer_threshold = 64 * KiB;
+
 class MessageBuffer {
 public:
     MessageBuffer();
@@ -46,7 +49,11 @@ public:
 
     ErrorOr<void> transfer_message(Core::LocalSocket& socket);
 
+    // Writes several messages to the socket at once, batching as many of them into each write as is reasonable.
+    static ErrorOr<void> transfer_messages(Core::LocalSocket& socket, Span<MessageBuffer> messages);
+
 private:
+    void write_message_size();
     Vector<u8, 1024> m_data;
     Vector<NonnullRefPtr<AutoCloseFileDescriptor>, 1> m_fds;
 };
@@ -68,6 +75,11 @@ public:
     virtual bool valid() const = 0;
     virtual ErrorOr<MessageBuffer> encode() const = 0;
 
+    // Messages declared with [Coalesce] only carry the latest state of something. If one is followed by another that
+    // supersedes it before either has been handled, the earlier one is dropped.
+    virtual bool can_be_coalesced() const { return false; }
+    virtual bool is_superseded_by(Message const&) const { return false; }
+
 protected:
     Message() = default;
 };
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtr.h>
@@ -23,10 +24,29 @@
 namespace JS::Bytecode {
 
 struct PropertyLookupCache {
-    WeakPtr<Shape> shape;
-    Optional<u32> property_offset;
-    WeakPtr<Object> prototype;
-    WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    static constexpr size_t max_number_of_shapes_to_remember = 4;
+    struct Entry {
+        WeakPtr<Shape> shape;
+        Optional<u32> property_offset;
+        WeakPtr<Object> prototype;
+        WeakPtr<PrototypeChainValidity> prototype_chain_validity;
+    };
+
+    // Shifts existing entries back (dropping the oldest one), and returns a cleared entry at the front.
+    Entry& get_entry_for_update()
+    {
+        for (size_t i = entries.size() - 1; i > 0; --i)
+            entries[i] = move(entries[i - 1]);
+        entries[0] = {};
+        return entries[0];
+    }
+
+    // Entries are kept in most-recently-cached-first order.
+    AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // How often a lookup was answered by one of the entries, and how often it had to take the slow path.
+    u64 hit_count { 0 };
+    u64 miss_count { 0 };
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -71,6 +91,10 @@ public:
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // Execution counters, for finding hot code. Loop iterations are counted as backward jumps.
+    u64 invocation_count { 0 };
+    u64 loop_iteration_count { 0 };
+
     struct ExceptionHandlers {
         size_t start_offset;
         size_t end_offset;
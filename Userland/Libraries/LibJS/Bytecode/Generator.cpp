@@ -315,6 +315,31 @@ CodeGenerationErrorOr<NonnullGCPtr<Executable>> Generator::compile(VM& vm, ASTNo
         }
     }
 
+    // Pass: Thread jumps through blocks that contain nothing but an unconditional jump, so that chains of
+    //       such blocks (common after lowering nested control flow) only cost a single jump at runtime.
+    auto thread_jump_target = [&](u32 block_index) {
+        for (size_t hops = 0; hops < generator.m_root_basic_blocks.size(); ++hops) {
+            auto const& target_block = *generator.m_root_basic_blocks[block_index];
+            if (target_block.size() == 0 || target_block.handler() || target_block.finalizer())
+                break;
+            auto const& target_instruction = *InstructionStreamIterator { target_block.instruction_stream() };
+            if (target_instruction.type() != Instruction::Type::Jump || target_instruction.length() != target_block.size())
+                break;
+            block_index = static_cast<Op::Jump const&>(target_instruction).target().basic_block_index();
+        }
+        return block_index;
+    };
+    for (auto& block : generator.m_root_basic_blocks) {
+        Bytecode::InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                label = Label { thread_jump_target(label.basic_block_index()) };
+            });
+            ++it;
+        }
+    }
+
     // Also rewrite the `undefined` constant if we have one for inserting End.
     if (undefined_constant.has_value())
         undefined_constant.value().operand().offset_index_by(number_of_registers);
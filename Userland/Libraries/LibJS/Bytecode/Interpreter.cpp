@@ -7,6 +7,7 @@
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
 #include <AK/TemporaryChange.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
@@ -14,6 +15,7 @@
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Profile.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -33,6 +35,7 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/SamplingProfiler.h>
 #include <LibJS/SourceTextModule.h>
 
 namespace JS::Bytecode {
@@ -152,6 +155,9 @@ Interpreter::Interpreter(VM& vm)
 
 Interpreter::~Interpreter()
 {
+    // A profiler may outlive us, e.g. when it's owned by a console that is only destroyed with the heap.
+    if (m_sampling_profiler)
+        m_sampling_profiler->stop();
 }
 
 ALWAYS_INLINE Value Interpreter::get(Operand op) const
@@ -183,6 +189,8 @@ ALWAYS_INLINE Value Interpreter::do_yield(Value value, Optional<Label> continuat
 // 16.1.6 ScriptEvaluation ( scriptRecord ), https://tc39.es/ecma262/#sec-runtime-semantics-scriptevaluation
 ThrowCompletionOr<Value> Interpreter::run(Script& script_record, JS::GCPtr<Environment> lexical_environment_override)
 {
+    TRACE_SCOPE("js", "Interpreter::run");
+
     auto& vm = this->vm();
 
     // 1. Let globalEnv be scriptRecord.[[Realm]].[[GlobalEnv]].
@@ -291,6 +299,8 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, JS::GCPtr<Envir
 
 ThrowCompletionOr<Value> Interpreter::run(SourceTextModule& module)
 {
+    TRACE_SCOPE("js", "Interpreter::run");
+
     // FIXME: This is not a entry point as defined in the spec, but is convenient.
     //        To avoid work we use link_and_eval_module however that can already be
     //        dangerous if the vm loaded other modules.
@@ -355,6 +365,8 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     TemporaryChange change(m_program_counter, Optional<size_t&>(program_counter));
 
+    take_sample_if_requested();
+
     // Declare a lookup table for computed goto with each of the `handle_*` labels
     // to avoid the overhead of a switch statement.
     // This is a GCC extension, but it's also supported by Clang.
@@ -365,6 +377,16 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     };
 #undef SET_UP_LABEL
 
+    // While a profile is attached, every instruction is first dispatched to a label that counts it.
+    // This keeps the cost of profiling support down to picking a table when entering the function.
+    static void* const profiling_dispatch_table[] = {
+#define SET_UP_LABEL(name) &&count_instruction,
+        ENUMERATE_BYTECODE_OPS(SET_UP_LABEL)
+    };
+#undef SET_UP_LABEL
+
+    void* const* dispatch_table = m_profile ? profiling_dispatch_table : bytecode_dispatch_table;
+
 #define DISPATCH_NEXT(name)                                                                         \
     do {                                                                                            \
         if constexpr (Op::name::IsVariableLength)                                                   \
@@ -372,13 +394,21 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         else                                                                                        \
             program_counter += sizeof(Op::name);                                                    \
         auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
-        goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
+        goto* dispatch_table[static_cast<size_t>(next_instruction.type())];                         \
     } while (0)
 
     for (;;) {
     start:
         for (;;) {
-            goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
+            goto* dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
+
+        count_instruction: {
+            auto type = reinterpret_cast<Instruction const*>(&bytecode[program_counter])->type();
+            // NOTE: The profile may have been detached since we entered this function.
+            if (m_profile)
+                m_profile->did_execute(type);
+            goto* bytecode_dispatch_table[static_cast<size_t>(type)];
+        }
 
         handle_GetArgument: {
             auto const& instruction = *reinterpret_cast<Op::GetArgument const*>(&bytecode[program_counter]);
@@ -406,7 +436,11 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
+            auto target = instruction.target().address();
+            if (target <= program_counter)
+                ++executable.loop_iteration_count;
+            program_counter = target;
+            take_sample_if_requested();
             goto start;
         }
 
@@ -562,7 +596,46 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         DISPATCH_NEXT(name);                                                                \
     }
 
-            HANDLE_INSTRUCTION(Add);
+// OPTIMIZATION: Handle the Int32 case of the hottest arithmetic instructions right here in the dispatch loop,
+//               so that tight loops don't pay for an out-of-line call and a completion check per instruction.
+#define HANDLE_INSTRUCTION_WITH_INT32_FAST_PATH(name, checked_operation, int32_operator)                                         \
+    handle_##name:                                                                                                               \
+    {                                                                                                                            \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]);                                      \
+        auto lhs = get(instruction.lhs());                                                                                       \
+        auto rhs = get(instruction.rhs());                                                                                       \
+        if (lhs.is_int32() && rhs.is_int32() && !Checked<i32>::checked_operation##_would_overflow(lhs.as_i32(), rhs.as_i32())) { \
+            set(instruction.dst(), Value(lhs.as_i32() int32_operator rhs.as_i32()));                                             \
+            DISPATCH_NEXT(name);                                                                                                 \
+        }                                                                                                                        \
+        auto result = instruction.execute_impl(*this);                                                                           \
+        if (result.is_error()) {                                                                                                 \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)          \
+                return;                                                                                                          \
+            goto start;                                                                                                          \
+        }                                                                                                                        \
+        DISPATCH_NEXT(name);                                                                                                     \
+    }
+
+#define HANDLE_UNARY_INSTRUCTION_WITH_INT32_FAST_PATH(name, limit, int32_operator)                                      \
+    handle_##name:                                                                                                      \
+    {                                                                                                                   \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]);                             \
+        auto value = get(instruction.dst());                                                                            \
+        if (value.is_int32() && value.as_i32() != NumericLimits<i32>::limit()) {                                        \
+            set(instruction.dst(), Value(value.as_i32() int32_operator 1));                                             \
+            DISPATCH_NEXT(name);                                                                                        \
+        }                                                                                                               \
+        auto result = instruction.execute_impl(*this);                                                                  \
+        if (result.is_error()) {                                                                                        \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable) \
+                return;                                                                                                 \
+            goto start;                                                                                                 \
+        }                                                                                                               \
+        DISPATCH_NEXT(name);                                                                                            \
+    }
+
+            HANDLE_INSTRUCTION_WITH_INT32_FAST_PATH(Add, addition, +);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(AsyncIteratorClose);
@@ -582,7 +655,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(CreateVariable);
             HANDLE_INSTRUCTION(CreateRestParams);
             HANDLE_INSTRUCTION(CreateArguments);
-            HANDLE_INSTRUCTION(Decrement);
+            HANDLE_UNARY_INSTRUCTION_WITH_INT32_FAST_PATH(Decrement, min, -);
             HANDLE_INSTRUCTION(DeleteById);
             HANDLE_INSTRUCTION(DeleteByIdWithThis);
             HANDLE_INSTRUCTION(DeleteByValue);
@@ -614,7 +687,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
-            HANDLE_INSTRUCTION(Increment);
+            HANDLE_UNARY_INSTRUCTION_WITH_INT32_FAST_PATH(Increment, max, +);
             HANDLE_INSTRUCTION(InitializeLexicalBinding);
             HANDLE_INSTRUCTION(InitializeVariableBinding);
             HANDLE_INSTRUCTION(InstanceOf);
@@ -656,7 +729,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(SetVariableBinding);
             HANDLE_INSTRUCTION(StrictlyEquals);
             HANDLE_INSTRUCTION(StrictlyInequals);
-            HANDLE_INSTRUCTION(Sub);
+            HANDLE_INSTRUCTION_WITH_INT32_FAST_PATH(Sub, subtraction, -);
             HANDLE_INSTRUCTION(SuperCallWithArgumentArray);
             HANDLE_INSTRUCTION(Throw);
             HANDLE_INSTRUCTION(ThrowIfNotObject);
@@ -694,6 +767,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     }
 }
 
+void Interpreter::take_sample()
+{
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    if (m_sampling_profiler)
+        m_sampling_profiler->take_sample(program_counter());
+}
+
 Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& executable, Optional<size_t> entry_point, Value initial_accumulator_value)
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {:p}", &executable);
@@ -727,6 +808,10 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     running_execution_context.executable = &executable;
 
+    // NOTE: Resuming a generator or async function isn't counted as another invocation.
+    if (!entry_point.has_value())
+        ++executable.invocation_count;
+
     for (size_t i = 0; i < executable.constants.size(); ++i) {
         running_execution_context.registers_and_constants_and_locals[executable.number_of_registers + i] = executable.constants[i];
     }
@@ -965,7 +1050,7 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
 {
     if constexpr (mode == GetByIdMode::Length) {
         if (base_value.is_string()) {
-            return Value(base_value.as_string().utf16_string().length_in_code_units());
+            return Value(base_value.as_string().length_in_utf16_code_units());
         }
     }
 
@@ -980,37 +1065,44 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
 
     auto& shape = base_obj->shape();
 
-    if (cache.prototype) {
-        // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-        bool can_use_cache = [&]() -> bool {
-            if (&shape != cache.shape)
-                return false;
-            if (!cache.prototype_chain_validity)
-                return false;
-            if (!cache.prototype_chain_validity->is_valid())
-                return false;
-            return true;
-        }();
-        if (can_use_cache)
-            return cache.prototype->get_direct(cache.property_offset.value());
-    } else if (&shape == cache.shape) {
-        // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-        return base_obj->get_direct(cache.property_offset.value());
+    for (auto& cache_entry : cache.entries) {
+        if (&shape != cache_entry.shape)
+            continue;
+        if (cache_entry.prototype) {
+            // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+            bool can_use_cache = [&]() -> bool {
+                if (!cache_entry.prototype_chain_validity)
+                    return false;
+                if (!cache_entry.prototype_chain_validity->is_valid())
+                    return false;
+                return true;
+            }();
+            if (can_use_cache) {
+                ++cache.hit_count;
+                return cache_entry.prototype->get_direct(cache_entry.property_offset.value());
+            }
+        } else {
+            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+            ++cache.hit_count;
+            return base_obj->get_direct(cache_entry.property_offset.value());
+        }
     }
 
+    ++cache.miss_count;
+
     CacheablePropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
 
     if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-        cache = {};
-        cache.shape = shape;
-        cache.property_offset = cacheable_metadata.property_offset.value();
+        auto& cache_entry = cache.get_entry_for_update();
+        cache_entry.shape = shape;
+        cache_entry.property_offset = cacheable_metadata.property_offset.value();
     } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
-        cache = {};
-        cache.shape = &base_obj->shape();
-        cache.property_offset = cacheable_metadata.property_offset.value();
-        cache.prototype = *cacheable_metadata.prototype;
-        cache.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
+        auto& cache_entry = cache.get_entry_for_update();
+        cache_entry.shape = &base_obj->shape();
+        cache_entry.property_offset = cacheable_metadata.property_offset.value();
+        cache_entry.prototype = *cacheable_metadata.prototype;
+        cache_entry.prototype_chain_validity = *cacheable_metadata.prototype->shape().prototype_chain_validity();
     }
 
     return value;
@@ -1062,6 +1154,10 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<IdentifierTableInd
                     return fast_typed_array_get_element<i32>(typed_array, index);
                 case TypedArrayBase::Kind::Uint8ClampedArray:
                     return fast_typed_array_get_element<u8>(typed_array, index);
+                case TypedArrayBase::Kind::Float32Array:
+                    return fast_typed_array_get_element<float>(typed_array, index);
+                case TypedArrayBase::Kind::Float64Array:
+                    return fast_typed_array_get_element<double>(typed_array, index);
                 default:
                     // FIXME: Support more TypedArray kinds.
                     break;
@@ -1102,16 +1198,21 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
 
         // OPTIMIZATION: For global var bindings, if the shape of the global object hasn't changed,
         //               we can use the cached property offset.
-        if (&shape == cache.shape) {
-            return binding_object.get_direct(cache.property_offset.value());
+        auto& cache_entry = cache.entries[0];
+        if (&shape == cache_entry.shape) {
+            ++cache.hit_count;
+            return binding_object.get_direct(cache_entry.property_offset.value());
         }
 
         // OPTIMIZATION: For global lexical bindings, if the global declarative environment hasn't changed,
         //               we can use the cached environment binding index.
-        if (cache.environment_binding_index.has_value())
+        if (cache.environment_binding_index.has_value()) {
+            ++cache.hit_count;
             return declarative_record.get_binding_value_direct(vm, cache.environment_binding_index.value());
+        }
     }
 
+    ++cache.miss_count;
     cache.environment_serial_number = declarative_record.environment_serial_number();
 
     auto& identifier = interpreter.current_executable().get_identifier(identifier_index);
@@ -1136,8 +1237,9 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         CacheablePropertyMetadata cacheable_metadata;
         auto value = TRY(binding_object.internal_get(identifier, js_undefined(), &cacheable_metadata));
         if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-            cache.shape = shape;
-            cache.property_offset = cacheable_metadata.property_offset.value();
+            auto& cache_entry = cache.entries[0];
+            cache_entry.shape = shape;
+            cache_entry.property_offset = cacheable_metadata.property_offset.value();
         }
         return value;
     }
@@ -1177,17 +1279,24 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
         break;
     }
     case Op::PropertyKind::KeyValue: {
-        if (cache && cache->shape == &object->shape()) {
-            object->put_direct(*cache->property_offset, value);
-            return {};
+        if (cache) {
+            for (auto& cache_entry : cache->entries) {
+                if (cache_entry.shape == &object->shape()) {
+                    ++cache->hit_count;
+                    object->put_direct(*cache_entry.property_offset, value);
+                    return {};
+                }
+            }
+            ++cache->miss_count;
         }
 
         CacheablePropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
         if (succeeded && cache && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
-            cache->shape = object->shape();
-            cache->property_offset = cacheable_metadata.property_offset.value();
+            auto& cache_entry = cache->get_entry_for_update();
+            cache_entry.shape = object->shape();
+            cache_entry.property_offset = cacheable_metadata.property_offset.value();
         }
 
         if (!succeeded && vm.in_strict_mode()) {
@@ -1329,6 +1438,17 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Depreca
                 }
             }
 
+            if (value.is_number() && is_valid_integer_index(typed_array, canonical_index)) {
+                if (typed_array.kind() == TypedArrayBase::Kind::Float32Array) {
+                    fast_typed_array_set_element<float>(typed_array, index, static_cast<float>(value.as_double()));
+                    return {};
+                }
+                if (typed_array.kind() == TypedArrayBase::Kind::Float64Array) {
+                    fast_typed_array_set_element<double>(typed_array, index, value.as_double());
+                    return {};
+                }
+            }
+
             if (typed_array.kind() == TypedArrayBase::Kind::Uint32Array && value.is_integral_number()) {
                 auto integer = value.as_double();
 
@@ -1412,7 +1532,7 @@ inline Value new_regexp(VM& vm, ParsedRegex const& parsed_regex, ByteString cons
 
     // 3. Return ! RegExpCreate(pattern, flags).
     auto& realm = *vm.current_realm();
-    Regex<ECMA262> regex(parsed_regex.regex, parsed_regex.pattern, parsed_regex.flags);
+    auto regex = compile_regex(vm, parsed_regex.pattern, parsed_regex.flags, &parsed_regex.regex);
     // NOTE: We bypass RegExpCreate and subsequently RegExpAlloc as an optimization to use the already parsed values.
     auto regexp_object = RegExpObject::create(realm, move(regex), pattern, flags);
     // RegExpAlloc has these two steps from the 'Legacy RegExp features' proposal.
@@ -2539,7 +2659,7 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
         return {};
     }
 
-    Vector<Value> argument_values;
+    Vector<Value, ExecutionContext::inline_argument_capacity> argument_values;
     argument_values.ensure_capacity(m_argument_count);
     for (size_t i = 0; i < m_argument_count; ++i)
         argument_values.unchecked_append(interpreter.get(m_arguments[i]));
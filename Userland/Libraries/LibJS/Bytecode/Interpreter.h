@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
+#include <AK/Badge.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Register.h>
@@ -80,9 +82,26 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler; }
+    void set_sampling_profiler(Badge<SamplingProfiler>, SamplingProfiler* profiler) { m_sampling_profiler = profiler; }
+
+    // May be called from any thread. The sample is taken at the next function entry or jump.
+    void request_sample() { m_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed); }
+
+    // While a profile is attached, every executed instruction is counted in it.
+    Profile* profile() { return m_profile; }
+    void set_profile(Profile* profile) { m_profile = profile; }
+
 private:
     void run_bytecode(size_t entry_point);
 
+    ALWAYS_INLINE void take_sample_if_requested()
+    {
+        if (m_sample_requested.load(AK::MemoryOrder::memory_order_relaxed)) [[unlikely]]
+            take_sample();
+    }
+    void take_sample();
+
     enum class HandleExceptionResponse {
         ExitFromExecutable,
         ContinueInThisExecutable,
@@ -99,6 +118,9 @@ private:
     Span<Value> m_arguments;
     Span<Value> m_registers_and_constants_and_locals;
     ExecutionContext* m_running_execution_context { nullptr };
+    SamplingProfiler* m_sampling_profiler { nullptr };
+    Atomic<bool> m_sample_requested { false };
+    Profile* m_profile { nullptr };
 };
 
 extern bool g_dump_bytecode;
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/QuickSort.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Profile.h>
+#include <LibJS/Heap/Heap.h>
+#include <LibJS/SourceRange.h>
+
+namespace JS::Bytecode {
+
+StringView opcode_name(Instruction::Type type)
+{
+    switch (type) {
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return #op##sv;
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static JsonObject cache_counters_to_json(PropertyLookupCache const& cache)
+{
+    JsonObject object;
+    object.set("hits"sv, cache.hit_count);
+    object.set("misses"sv, cache.miss_count);
+    return object;
+}
+
+template<typename Caches>
+static JsonObject caches_to_json(Caches const& caches)
+{
+    u64 hit_count = 0;
+    u64 miss_count = 0;
+    JsonArray used_caches;
+
+    for (size_t i = 0; i < caches.size(); ++i) {
+        auto const& cache = caches[i];
+        if (cache.hit_count == 0 && cache.miss_count == 0)
+            continue;
+
+        hit_count += cache.hit_count;
+        miss_count += cache.miss_count;
+
+        auto cache_object = cache_counters_to_json(cache);
+        cache_object.set("index"sv, i);
+        used_caches.must_append(move(cache_object));
+    }
+
+    JsonObject object;
+    object.set("hits"sv, hit_count);
+    object.set("misses"sv, miss_count);
+    object.set("caches"sv, move(used_caches));
+    return object;
+}
+
+static JsonObject executable_to_json(Executable const& executable)
+{
+    JsonObject object;
+    object.set("name"sv, executable.name.is_empty() ? "(anonymous)"sv : executable.name.view());
+
+    // NOTE: The lowest mapped offset is the closest we have to where the function starts.
+    Optional<size_t> first_mapped_offset;
+    for (auto const& [offset, source_record] : executable.source_map) {
+        if (!first_mapped_offset.has_value() || offset < *first_mapped_offset)
+            first_mapped_offset = offset;
+    }
+    if (first_mapped_offset.has_value()) {
+        if (auto source_range = executable.source_range_at(*first_mapped_offset); source_range.source_code) {
+            auto realized_source_range = source_range.realize();
+            object.set("url"sv, realized_source_range.filename());
+            object.set("line"sv, realized_source_range.start.line);
+            object.set("column"sv, realized_source_range.start.column);
+        }
+    }
+
+    object.set("invocations"sv, executable.invocation_count);
+    object.set("loop_iterations"sv, executable.loop_iteration_count);
+    object.set("property_lookup_caches"sv, caches_to_json(executable.property_lookup_caches));
+    object.set("global_variable_caches"sv, caches_to_json(executable.global_variable_caches));
+    return object;
+}
+
+JsonObject dump_profile(Heap& heap, Profile const* profile, size_t hot_function_count)
+{
+    JsonObject object;
+
+    if (profile) {
+        Vector<Instruction::Type> executed_opcodes;
+        for (size_t i = 0; i < Profile::opcode_count; ++i) {
+            if (profile->opcode_counts()[i] != 0)
+                executed_opcodes.append(static_cast<Instruction::Type>(i));
+        }
+        quick_sort(executed_opcodes, [&](auto a, auto b) { return profile->count_for(a) > profile->count_for(b); });
+
+        JsonObject opcodes;
+        for (auto opcode : executed_opcodes)
+            opcodes.set(opcode_name(opcode), profile->count_for(opcode));
+        object.set("opcodes"sv, move(opcodes));
+    }
+
+    auto hotness = [](Executable const& executable) {
+        return executable.invocation_count + executable.loop_iteration_count;
+    };
+
+    Vector<Executable const*> executables;
+    heap.for_each_live_cell([&](Cell* cell) {
+        if (!is<Executable>(*cell))
+            return;
+        auto const& executable = static_cast<Executable const&>(*cell);
+        if (hotness(executable) != 0)
+            executables.append(&executable);
+    });
+    quick_sort(executables, [&](auto const* a, auto const* b) { return hotness(*a) > hotness(*b); });
+
+    JsonArray functions;
+    for (size_t i = 0; i < min(executables.size(), hot_function_count); ++i)
+        functions.must_append(executable_to_json(*executables[i]));
+    object.set("functions"sv, move(functions));
+
+    return object;
+}
+
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/JsonObject.h>
+#include <AK/StdLibExtras.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// Counts of executed instructions, gathered by the interpreter while the profile is attached to it.
+//
+// Counting every instruction costs an extra indirect jump per instruction, so unlike the function invocation, loop
+// iteration and inline cache counters kept on each Executable, it is only done on request.
+class Profile {
+    AK_MAKE_NONCOPYABLE(Profile);
+    AK_MAKE_NONMOVABLE(Profile);
+
+public:
+    static constexpr size_t opcode_count = 0
+#define __BYTECODE_OP(op) +1
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+        ;
+
+    static constexpr size_t default_hot_function_count = 50;
+
+    Profile() = default;
+
+    ALWAYS_INLINE void did_execute(Instruction::Type type) { ++m_opcode_counts[to_underlying(type)]; }
+
+    u64 count_for(Instruction::Type type) const { return m_opcode_counts[to_underlying(type)]; }
+    AK::Array<u64, opcode_count> const& opcode_counts() const { return m_opcode_counts; }
+
+private:
+    AK::Array<u64, opcode_count> m_opcode_counts {};
+};
+
+StringView opcode_name(Instruction::Type);
+
+// Returns the opcode counts of the given profile, if any, and the hottest functions that are still alive along with
+// their execution and inline cache counters. Functions are ranked by invocations plus loop iterations.
+JsonObject dump_profile(Heap&, Profile const*, size_t hot_function_count = Profile::default_hot_function_count);
+
+}
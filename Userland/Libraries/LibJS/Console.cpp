@@ -17,6 +17,7 @@
 #include <LibJS/Runtime/StringConstructor.h>
 #include <LibJS/Runtime/Temporal/Duration.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/SamplingProfiler.h>
 
 namespace JS {
 
@@ -667,6 +668,70 @@ ThrowCompletionOr<Value> Console::time_end()
     return js_undefined();
 }
 
+ThrowCompletionOr<void> Console::print_message(LogLevel log_level, String message)
+{
+    if (!m_client)
+        return {};
+
+    auto& vm = realm().vm();
+
+    MarkedVector<Value> message_as_vector { vm.heap() };
+    message_as_vector.append(PrimitiveString::create(vm, move(message)));
+    TRY(m_client->printer(log_level, move(message_as_vector)));
+
+    return {};
+}
+
+// Non-standard: profile(label), as implemented by other engines.
+ThrowCompletionOr<Value> Console::profile()
+{
+    auto& vm = realm().vm();
+
+    auto label = TRY(label_or_fallback(vm, "default"sv));
+
+    // NOTE: Only one profile can be recorded at a time, as samples are taken for the whole VM.
+    if (m_profiler) {
+        TRY(print_message(LogLevel::Warn, TRY_OR_THROW_OOM(vm, String::formatted("Profile '{}' is already running.", m_profile_label))));
+        return js_undefined();
+    }
+
+    auto profiler = SamplingProfiler::start(vm);
+    if (profiler.is_error()) {
+        TRY(print_message(LogLevel::Warn, TRY_OR_THROW_OOM(vm, String::formatted("Unable to start profile '{}': {}", label, profiler.error()))));
+        return js_undefined();
+    }
+
+    m_profiler = profiler.release_value();
+    m_profile_label = label;
+
+    TRY(print_message(LogLevel::Info, TRY_OR_THROW_OOM(vm, String::formatted("Profile '{}' started.", label))));
+    return js_undefined();
+}
+
+// Non-standard: profileEnd(label), as implemented by other engines.
+ThrowCompletionOr<Value> Console::profile_end()
+{
+    auto& vm = realm().vm();
+
+    auto label = TRY(label_or_fallback(vm, "default"sv));
+
+    if (!m_profiler || m_profile_label != label) {
+        TRY(print_message(LogLevel::Warn, TRY_OR_THROW_OOM(vm, String::formatted("Profile '{}' does not exist.", label))));
+        return js_undefined();
+    }
+
+    auto profiler = m_profiler.release_nonnull();
+    profiler->stop();
+
+    auto duration = profiler->duration().to_milliseconds();
+    TRY(print_message(LogLevel::Info, TRY_OR_THROW_OOM(vm, String::formatted("Profile '{}' finished: {} samples in {}ms.", label, profiler->sample_count(), duration))));
+
+    if (m_client)
+        m_client->profile_did_finish(label, *profiler);
+
+    return js_undefined();
+}
+
 MarkedVector<Value> Console::vm_arguments()
 {
     auto& vm = realm().vm();
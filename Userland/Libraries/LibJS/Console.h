@@ -10,6 +10,7 @@
 #include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/Noncopyable.h>
+#include <AK/OwnPtr.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
 #include <LibCore/ElapsedTimer.h>
@@ -86,6 +87,8 @@ public:
     ThrowCompletionOr<Value> time();
     ThrowCompletionOr<Value> time_log();
     ThrowCompletionOr<Value> time_end();
+    ThrowCompletionOr<Value> profile();
+    ThrowCompletionOr<Value> profile_end();
 
     void output_debug_message(LogLevel log_level, String const& output) const;
     void report_exception(JS::Error const&, bool) const;
@@ -97,6 +100,7 @@ private:
 
     ThrowCompletionOr<String> value_vector_to_string(MarkedVector<Value> const&);
     ThrowCompletionOr<String> format_time_since(Core::ElapsedTimer timer);
+    ThrowCompletionOr<void> print_message(LogLevel, String message);
 
     NonnullGCPtr<Realm> m_realm;
     GCPtr<ConsoleClient> m_client;
@@ -104,6 +108,9 @@ private:
     HashMap<String, unsigned> m_counters;
     HashMap<String, Core::ElapsedTimer> m_timer_table;
     Vector<Group> m_group_stack;
+
+    String m_profile_label;
+    OwnPtr<SamplingProfiler> m_profiler;
 };
 
 class ConsoleClient : public Cell {
@@ -119,6 +126,7 @@ public:
 
     virtual void add_css_style_to_current_message(StringView) { }
     virtual void report_exception(JS::Error const&, bool) { }
+    virtual void profile_did_finish(String const& /* label */, SamplingProfiler const&) { }
 
     virtual void clear() = 0;
     virtual void end_group() = 0;
@@ -205,6 +205,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
@@ -321,6 +322,7 @@ class Generator;
 class Instruction;
 class Interpreter;
 class Operand;
+class Profile;
 class RegexTable;
 class Register;
 }
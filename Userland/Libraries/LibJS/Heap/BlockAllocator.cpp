@@ -24,6 +24,7 @@ namespace JS {
 
 BlockAllocator::~BlockAllocator()
 {
+    m_blocks.extend(move(m_resident_blocks));
     for (auto* block : m_blocks) {
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
         if (munmap(block, HeapBlock::block_size) < 0) {
@@ -35,10 +36,13 @@ BlockAllocator::~BlockAllocator()
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
-    if (!m_blocks.is_empty()) {
+    // Prefer blocks whose pages are still resident, as those won't fault on first use.
+    for (auto* cache : { &m_resident_blocks, &m_blocks }) {
+        if (cache->is_empty())
+            continue;
         // To reduce predictability, take a random block from the cache.
-        size_t random_index = get_random_uniform(m_blocks.size());
-        auto* block = m_blocks.unstable_take(random_index);
+        size_t random_index = get_random_uniform(cache->size());
+        auto* block = cache->unstable_take(random_index);
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
         LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
         return block;
@@ -54,6 +58,22 @@ void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
 
+    if (m_resident_blocks.size() < max_resident_cached_blocks) {
+        ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+        LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+        m_resident_blocks.append(block);
+        return;
+    }
+
+    release_physical_pages(block);
+
+    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+    m_blocks.append(block);
+}
+
+void BlockAllocator::release_physical_pages(void* block)
+{
 #if defined(USE_FALLBACK_BLOCK_DEALLOCATION)
     // If we can't use any of the nicer techniques, unmap and remap the block to return the physical pages while keeping the VM.
     if (munmap(block, HeapBlock::block_size) < 0) {
@@ -75,10 +95,6 @@ void BlockAllocator::deallocate_block(void* block)
         VERIFY_NOT_REACHED();
     }
 #endif
-
-    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
-    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
-    m_blocks.append(block);
 }
 
 }
@@ -20,6 +20,13 @@ public:
     void deallocate_block(void*);
 
 private:
+    void release_physical_pages(void*);
+
+    // Freed blocks are kept resident up to this limit, so that sweeping does not have to make a system
+    // call for every empty block, and so that blocks which are quickly reused don't incur new page faults.
+    static constexpr size_t max_resident_cached_blocks = 64;
+
+    Vector<void*> m_resident_blocks;
     Vector<void*> m_blocks;
 };
 
@@ -55,6 +55,10 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // Cells that have not yet survived a garbage collection are considered "young".
+    bool is_young() const { return m_young; }
+    void set_young(bool b) { m_young = b; }
+
     virtual StringView class_name() const = 0;
 
     class Visitor {
@@ -161,6 +165,9 @@ public:
     // This will be called on unmarked objects by the garbage collector in a separate pass before destruction.
     virtual void finalize() { }
 
+    // Memory owned by this cell outside of its heap block, e.g. in hash tables. Used for heap statistics.
+    virtual size_t external_memory_usage() const { return 0; }
+
     // This allows cells to survive GC by choice, even if nothing points to them.
     // It's used to implement special rules in the web platform.
     // NOTE: Cells must call set_overrides_must_survive_garbage_collection() for this to be honored.
@@ -180,6 +187,7 @@ private:
     bool m_mark : 1 { false };
     bool m_overrides_must_survive_garbage_collection : 1 { false };
     State m_state : 1 { State::Live };
+    bool m_young : 1 { true };
 };
 
 }
@@ -30,12 +30,14 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
             m_min_block_address = block_ptr;
         if (m_max_block_address < block_ptr)
             m_max_block_address = block_ptr;
+        heap.did_create_heap_block({}, *block);
         m_usable_blocks.append(*block.leak_ptr());
     }
 
     auto& block = *m_usable_blocks.last();
     auto* cell = block.allocate();
     VERIFY(cell);
+    ++m_allocated_cell_count;
     if (block.is_full())
         m_full_blocks.append(*m_usable_blocks.last());
     return cell;
@@ -27,6 +27,7 @@ public:
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
+    char const* class_name() const { return m_class_name; }
 
     Cell* allocate_cell(Heap&);
 
@@ -54,6 +55,12 @@ public:
     FlatPtr min_block_address() const { return m_min_block_address; }
     FlatPtr max_block_address() const { return m_max_block_address; }
 
+    size_t allocated_cell_count() const { return m_allocated_cell_count; }
+
+    // Number of cells from this allocator that survived the most recent garbage collection.
+    size_t surviving_cell_count() const { return m_surviving_cell_count; }
+    void set_surviving_cell_count(Badge<Heap>, size_t count) { m_surviving_cell_count = count; }
+
 private:
     char const* const m_class_name { nullptr };
     size_t const m_cell_size;
@@ -65,6 +72,9 @@ private:
     BlockList m_usable_blocks;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
+
+    size_t m_allocated_cell_count { 0 };
+    size_t m_surviving_cell_count { 0 };
 };
 
 template<typename T>
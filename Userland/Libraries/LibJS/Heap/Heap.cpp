@@ -14,6 +14,7 @@
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/Heap/Handle.h>
@@ -51,6 +52,7 @@ Heap::~Heap()
 {
     vm().string_cache().clear();
     vm().byte_string_cache().clear();
+    on_garbage_collection = nullptr;
     collect_garbage(CollectionType::CollectEverything);
 }
 
@@ -122,10 +124,6 @@ public:
         : m_heap(heap)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
 
         for (auto& [root, root_origin] : roots) {
             auto& graph_node = m_graph.ensure(bit_cast<FlatPtr>(root));
@@ -155,7 +153,7 @@ public:
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_pointers(m_heap.m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
             if (m_node_being_visited)
                 m_node_being_visited->edges.set(reinterpret_cast<FlatPtr>(&cell));
 
@@ -232,7 +230,6 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
@@ -246,26 +243,112 @@ AK::JsonObject Heap::dump_graph()
     return visitor.dump();
 }
 
+AK::JsonObject Heap::dump_cell_statistics()
+{
+    struct ClassStatistics {
+        size_t live_cells { 0 };
+        size_t live_bytes { 0 };
+        size_t external_bytes { 0 };
+    };
+    HashMap<StringView, ClassStatistics> statistics_by_class;
+
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            auto& statistics = statistics_by_class.ensure(cell->class_name());
+            ++statistics.live_cells;
+            statistics.live_bytes += block.cell_size();
+            statistics.external_bytes += cell->external_memory_usage();
+        });
+        return IterationDecision::Continue;
+    });
+
+    AK::JsonObject classes;
+    for (auto const& [class_name, statistics] : statistics_by_class) {
+        AK::JsonObject class_object;
+        class_object.set("live_cells"sv, statistics.live_cells);
+        class_object.set("live_bytes"sv, statistics.live_bytes);
+        class_object.set("external_bytes"sv, statistics.external_bytes);
+        classes.set(class_name, move(class_object));
+    }
+
+    AK::JsonArray allocators;
+    for (auto& allocator : m_all_cell_allocators) {
+        AK::JsonObject allocator_object;
+        if (allocator.class_name())
+            allocator_object.set("class_name"sv, allocator.class_name());
+        allocator_object.set("cell_size"sv, allocator.cell_size());
+        allocator_object.set("allocated_cells"sv, allocator.allocated_cell_count());
+        allocator_object.set("allocated_bytes"sv, allocator.allocated_cell_count() * allocator.cell_size());
+        allocator_object.set("surviving_cells"sv, allocator.surviving_cell_count());
+        allocators.must_append(move(allocator_object));
+    }
+
+    AK::JsonObject result;
+    result.set("classes"sv, move(classes));
+    result.set("allocators"sv, move(allocators));
+    return result;
+}
+
+Heap::MemoryUsage Heap::memory_usage()
+{
+    MemoryUsage usage;
+
+    for (auto& allocator : m_all_cell_allocators)
+        usage.used_bytes += allocator.surviving_cell_count() * allocator.cell_size();
+    usage.used_bytes += m_allocated_bytes_since_last_gc;
+
+    usage.committed_bytes = m_live_heap_blocks.size() * HeapBlock::block_size;
+
+    return usage;
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
+    TRACE_SCOPE("gc", "Heap::collect_garbage");
+
     VERIFY(!m_collecting_garbage);
     TemporaryChange change(m_collecting_garbage, true);
 
-    Core::ElapsedTimer collection_measurement_timer;
-    if (print_report)
-        collection_measurement_timer.start();
+    if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+        m_should_gc_when_deferral_ends = true;
+        return;
+    }
+
+    // NOTE: The collection is always timed, as reading the clock a few times is nothing compared to the collection itself.
+    Core::ElapsedTimer collection_measurement_timer { Core::TimerType::Precise };
+    collection_measurement_timer.start();
+
+    GarbageCollectionEvent event {
+        .type = collection_type,
+        .start_time = MonotonicTime::now(),
+        .duration = {},
+        .used_bytes_before = memory_usage().used_bytes,
+        .used_bytes_after = 0,
+        .swept_cells = 0,
+        .swept_bytes = 0,
+    };
+
+    CollectionPhaseTimestamps phase_timestamps;
+    auto record_phase_timestamp = [&](AK::Duration& timestamp) {
+        if (print_report)
+            timestamp = collection_measurement_timer.elapsed_time();
+    };
 
     if (collection_type == CollectionType::CollectGarbage) {
-        if (m_gc_deferrals) {
-            m_should_gc_when_deferral_ends = true;
-            return;
-        }
         HashMap<Cell*, HeapRoot> roots;
         gather_roots(roots);
+        record_phase_timestamp(phase_timestamps.roots_gathered);
         mark_live_cells(roots);
+        record_phase_timestamp(phase_timestamps.cells_marked);
     }
     finalize_unmarked_cells();
-    sweep_dead_cells(print_report, collection_measurement_timer);
+    record_phase_timestamp(phase_timestamps.cells_finalized);
+    sweep_dead_cells(print_report, collection_measurement_timer, phase_timestamps, event);
+
+    event.duration = collection_measurement_timer.elapsed_time();
+    event.used_bytes_after = memory_usage().used_bytes;
+    if (on_garbage_collection)
+        on_garbage_collection(event);
 }
 
 void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
@@ -353,13 +436,7 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
+    for_each_cell_among_possible_pointers(m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
             roots.set(cell, *possible_pointers.get(possible_pointer));
@@ -375,10 +452,6 @@ public:
         : m_heap(heap)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
 
         for (auto* root : roots.keys()) {
             visit(root);
@@ -403,7 +476,7 @@ public:
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_pointers(m_heap.m_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
             if (cell->is_marked())
                 return;
             if (cell->state() != Cell::State::Live)
@@ -423,7 +496,6 @@ public:
 private:
     Heap& m_heap;
     Vector<NonnullGCPtr<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
@@ -460,7 +532,7 @@ void Heap::finalize_unmarked_cells()
     });
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer, CollectionPhaseTimestamps const& phase_timestamps, GarbageCollectionEvent& event)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
@@ -470,24 +542,40 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
+    size_t collected_young_cells = 0;
+    size_t collected_young_cell_bytes = 0;
+    size_t promoted_cells = 0;
+
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.set_surviving_cell_count({}, 0);
 
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
+        size_t block_live_cells = 0;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell)) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                if (cell->is_young()) {
+                    ++collected_young_cells;
+                    collected_young_cell_bytes += block.cell_size();
+                }
                 block.deallocate(cell);
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
-                block_has_live_cells = true;
+                if (cell->is_young()) {
+                    cell->set_young(false);
+                    ++promoted_cells;
+                }
+                ++block_live_cells;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
-        if (!block_has_live_cells)
+        auto& allocator = block.cell_allocator();
+        allocator.set_surviving_cell_count({}, allocator.surviving_cell_count() + block_live_cells);
+        if (!block_live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
             full_blocks_that_became_usable.append(&block);
@@ -499,6 +587,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
 
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
+        m_live_heap_blocks.remove(block);
         block->cell_allocator().block_did_become_empty({}, *block);
     }
 
@@ -514,7 +603,15 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    // Allow the heap to grow to (live size * growth factor) before collecting again.
+    auto allowed_growth_bytes = static_cast<size_t>(static_cast<double>(live_cell_bytes) * (m_heap_growth_factor - 1.0));
+    m_gc_bytes_threshold = max(allowed_growth_bytes, GC_MIN_BYTES_THRESHOLD);
+
+    // Collections that weren't triggered by an allocation (e.g. when idle) start a new allocation budget too.
+    m_allocated_bytes_since_last_gc = 0;
+
+    event.swept_cells = collected_cells;
+    event.swept_bytes = collected_cell_bytes;
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -527,8 +624,14 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         dbgln("Garbage collection report");
         dbgln("=============================================");
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
+        dbgln("   Gather roots: {} us", phase_timestamps.roots_gathered.to_microseconds());
+        dbgln("           Mark: {} us", (phase_timestamps.cells_marked - phase_timestamps.roots_gathered).to_microseconds());
+        dbgln("       Finalize: {} us", (phase_timestamps.cells_finalized - phase_timestamps.cells_marked).to_microseconds());
+        dbgln("          Sweep: {} us", (time_spent - phase_timestamps.cells_finalized).to_microseconds());
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
+        dbgln("     Died young: {} ({} bytes)", collected_young_cells, collected_young_cell_bytes);
+        dbgln(" Promoted cells: {}", promoted_cells);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
         dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
         dbgln("=============================================");
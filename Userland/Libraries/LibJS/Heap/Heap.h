@@ -7,6 +7,8 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/Function.h>
+#include <AK/Time.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
@@ -64,11 +66,61 @@ public:
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    struct GarbageCollectionEvent {
+        CollectionType type { CollectionType::CollectGarbage };
+        MonotonicTime start_time;
+        AK::Duration duration {};
+        // The heap's used bytes (see MemoryUsage) just before and just after the collection.
+        size_t used_bytes_before { 0 };
+        size_t used_bytes_after { 0 };
+        size_t swept_cells { 0 };
+        size_t swept_bytes { 0 };
+    };
+
+    // Called at the end of every collection, except the final one when the heap is destroyed.
+    // NOTE: This is called while the collection is still in progress, so it must not allocate anything on this heap.
+    Function<void(GarbageCollectionEvent const&)> on_garbage_collection;
     AK::JsonObject dump_graph();
 
+    // Returns live cell counts and sizes by class name, along with per-allocator allocation counters.
+    AK::JsonObject dump_cell_statistics();
+
+    struct MemoryUsage {
+        // Bytes in cells that survived the most recent collection, plus the bytes allocated since then.
+        size_t used_bytes { 0 };
+        // Bytes in heap blocks, whether their cells are in use or not.
+        size_t committed_bytes { 0 };
+    };
+
+    // Unlike dump_cell_statistics(), this doesn't walk the heap, so it's cheap enough to be sampled periodically.
+    MemoryUsage memory_usage();
+
+    // Calls the callback for every cell that survived the most recent collection or was allocated since then.
+    template<typename Callback>
+    void for_each_live_cell(Callback callback)
+    {
+        for_each_block([&](auto& block) {
+            block.template for_each_cell_in_state<Cell::State::Live>(callback);
+            return IterationDecision::Continue;
+        });
+    }
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // The heap is allowed to grow to this multiple of the live cell size before another collection is triggered.
+    double heap_growth_factor() const { return m_heap_growth_factor; }
+    void set_heap_growth_factor(double factor)
+    {
+        VERIFY(factor > 1.0);
+        m_heap_growth_factor = factor;
+    }
+
+    // Returns true if enough has been allocated that an allocation will soon trigger a collection anyway.
+    // Embedders can use this to collect during idle time instead of in the middle of a hot loop.
+    bool should_collect_when_idle() const { return m_allocated_bytes_since_last_gc >= m_gc_bytes_threshold * GC_IDLE_COLLECTION_THRESHOLD_RATIO; }
+
     void did_create_handle(Badge<HandleImpl>, HandleImpl&);
     void did_destroy_handle(Badge<HandleImpl>, HandleImpl&);
 
@@ -85,6 +137,7 @@ public:
     void did_destroy_execution_context(Badge<ExecutionContext>, ExecutionContext&);
 
     void register_cell_allocator(Badge<CellAllocator>, CellAllocator&);
+    void did_create_heap_block(Badge<CellAllocator>, HeapBlock&);
 
     void uproot_cell(Cell* cell);
 
@@ -118,7 +171,14 @@ private:
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
     void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
     void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+
+    // Points in time (relative to the start of the collection) at which each phase finished.
+    struct CollectionPhaseTimestamps {
+        AK::Duration roots_gathered;
+        AK::Duration cells_marked;
+        AK::Duration cells_finalized;
+    };
+    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&, CollectionPhaseTimestamps const&, GarbageCollectionEvent&);
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
@@ -141,14 +201,20 @@ private:
     }
 
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
+    static constexpr double GC_DEFAULT_HEAP_GROWTH_FACTOR { 2.0 };
+    static constexpr double GC_IDLE_COLLECTION_THRESHOLD_RATIO { 0.75 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    double m_heap_growth_factor { GC_DEFAULT_HEAP_GROWTH_FACTOR };
 
     bool m_should_collect_on_every_allocation { false };
 
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
+    // Kept up to date as blocks come and go, so that conservative scanning doesn't have to rebuild it for every collection.
+    HashTable<HeapBlock*> m_live_heap_blocks;
+
     HandleImpl::List m_handles;
     MarkedVectorBase::List m_marked_vectors;
     ConservativeVectorBase::List m_conservative_vectors;
@@ -215,4 +281,9 @@ inline void Heap::register_cell_allocator(Badge<CellAllocator>, CellAllocator& a
     m_all_cell_allocators.append(allocator);
 }
 
+inline void Heap::did_create_heap_block(Badge<CellAllocator>, HeapBlock& block)
+{
+    m_live_heap_blocks.set(&block);
+}
+
 }
@@ -719,6 +719,82 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+// NOTE: The elements of an Array with packed simple storage are all present own data properties, so HasProperty and Get
+//       can neither run user code nor reach the prototype chain for them, and searches can read the storage directly.
+static SimpleIndexedPropertyStorage const* packed_array_storage(Object const& object, u64 length)
+{
+    if (!is<Array>(object))
+        return nullptr;
+    auto const* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    auto const& simple_storage = static_cast<SimpleIndexedPropertyStorage const&>(*storage);
+    if (simple_storage.element_kind() == SimpleIndexedPropertyStorage::ElementKind::Holey || simple_storage.array_like_size() < length)
+        return nullptr;
+    return &simple_storage;
+}
+
+enum class SearchEquality {
+    IsStrictlyEqual,
+    SameValueZero,
+};
+
+enum class SearchDirection {
+    Forward,
+    Backward,
+};
+
+template<typename Predicate>
+static Optional<size_t> find_element_index(ReadonlySpan<Value> elements, size_t start, SearchDirection direction, Predicate const& matches)
+{
+    if (direction == SearchDirection::Forward) {
+        for (size_t i = start; i < elements.size(); ++i) {
+            if (matches(elements[i]))
+                return i;
+        }
+    } else {
+        for (size_t i = min(start + 1, elements.size()); i-- > 0;) {
+            if (matches(elements[i]))
+                return i;
+        }
+    }
+    return {};
+}
+
+static Optional<size_t> find_packed_element_index(SimpleIndexedPropertyStorage const& storage, u64 length, Value search_element, SearchEquality equality, size_t start, SearchDirection direction)
+{
+    using enum SimpleIndexedPropertyStorage::ElementKind;
+
+    auto elements = storage.elements().span().trim(length);
+    auto kind = storage.element_kind();
+
+    if (kind == PackedInt32 || kind == PackedNumber) {
+        // Numbers are never equal to values of any other type.
+        if (!search_element.is_number())
+            return {};
+
+        auto needle = search_element.as_double();
+        if (isnan(needle)) {
+            if (equality == SearchEquality::IsStrictlyEqual || kind == PackedInt32)
+                return {};
+            return find_element_index(elements, start, direction, [](Value element) { return isnan(element.as_double()); });
+        }
+
+        if (kind == PackedInt32) {
+            if (trunc(needle) != needle || needle < NumericLimits<i32>::min() || needle > NumericLimits<i32>::max())
+                return {};
+            auto int32_needle = static_cast<i32>(needle);
+            return find_element_index(elements, start, direction, [&](Value element) { return element.as_i32() == int32_needle; });
+        }
+
+        return find_element_index(elements, start, direction, [&](Value element) { return element.as_double() == needle; });
+    }
+
+    if (equality == SearchEquality::SameValueZero)
+        return find_element_index(elements, start, direction, [&](Value element) { return same_value_zero(element, search_element); });
+    return find_element_index(elements, start, direction, [&](Value element) { return is_strictly_equal(search_element, element); });
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -742,6 +818,8 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+    if (auto const* storage = packed_array_storage(this_object, length))
+        return Value(find_packed_element_index(*storage, length, value_to_find, SearchEquality::SameValueZero, from_index, SearchDirection::Forward).has_value());
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +873,11 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = packed_array_storage(object, length)) {
+        auto index = find_packed_element_index(*storage, length, search_element, SearchEquality::IsStrictlyEqual, k, SearchDirection::Forward);
+        return index.has_value() ? Value(*index) : Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -906,6 +989,11 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    if (auto const* storage = packed_array_storage(object, length); storage && k >= 0) {
+        auto index = find_packed_element_index(*storage, length, search_element, SearchEquality::IsStrictlyEqual, k, SearchDirection::Backward);
+        return index.has_value() ? Value(*index) : Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -51,65 +51,70 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     // 2. Let promise be ? PromiseResolve(%Promise%, value).
     auto* promise_object = TRY(promise_resolve(vm, realm.intrinsics().promise_constructor(), value));
 
-    // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
-    //    following steps when called:
-    auto fulfilled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto value = vm.argument(0);
+    // OPTIMIZATION: The closures below only capture asyncContext, which is the same for every await in this async
+    //               function. The functions are never exposed to user code (PerformPromiseThen doesn't look at them),
+    //               so we create them once and reuse them for every subsequent await.
+    if (!m_on_fulfilled) {
+        // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
+        //    following steps when called:
+        auto fulfilled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
+            auto value = vm.argument(0);
 
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
+            // a. Let prevContext be the running execution context.
+            auto& prev_context = vm.running_execution_context();
 
-        // FIXME: b. Suspend prevContext.
+            // FIXME: b. Suspend prevContext.
 
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+            // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
+            TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
 
-        // d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
-        //    suspended it.
-        continue_async_execution(vm, value, true);
+            // d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
+            //    suspended it.
+            continue_async_execution(vm, value, true);
 
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
+            // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
+            //    prevContext is the currently running execution context.
+            VERIFY(&vm.running_execution_context() == &prev_context);
 
-        // f. Return undefined.
-        return js_undefined();
-    };
+            // f. Return undefined.
+            return js_undefined();
+        };
 
-    // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
-    auto on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1, "");
+        // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
+        m_on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1, "");
 
-    // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
-    //    following steps when called:
-    auto rejected_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto reason = vm.argument(0);
+        // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
+        //    following steps when called:
+        auto rejected_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
+            auto reason = vm.argument(0);
 
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
+            // a. Let prevContext be the running execution context.
+            auto& prev_context = vm.running_execution_context();
 
-        // FIXME: b. Suspend prevContext.
+            // FIXME: b. Suspend prevContext.
 
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+            // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
+            TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
 
-        // d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
-        //    suspended it.
-        continue_async_execution(vm, reason, false);
+            // d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
+            //    suspended it.
+            continue_async_execution(vm, reason, false);
 
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
+            // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
+            //    prevContext is the currently running execution context.
+            VERIFY(&vm.running_execution_context() == &prev_context);
 
-        // f. Return undefined.
-        return js_undefined();
-    };
+            // f. Return undefined.
+            return js_undefined();
+        };
 
-    // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
-    auto on_rejected = NativeFunction::create(realm, move(rejected_closure), 1, "");
+        // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
+        m_on_rejected = NativeFunction::create(realm, move(rejected_closure), 1, "");
+    }
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = verify_cast<Promise>(promise_object);
-    m_current_promise->perform_then(on_fulfilled, on_rejected, {});
+    m_current_promise->perform_then(m_on_fulfilled, m_on_rejected, {});
 
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
     //    execution context stack as the running execution context.
@@ -190,8 +195,9 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_generator_object);
     visitor.visit(m_top_level_promise);
-    if (m_current_promise)
-        visitor.visit(m_current_promise);
+    visitor.visit(m_current_promise);
+    visitor.visit(m_on_fulfilled);
+    visitor.visit(m_on_rejected);
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
 }
@@ -15,6 +15,8 @@
 #include <AK/Atomic.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
+#include <AK/HashMap.h>
+#include <AK/Time.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
@@ -22,6 +24,8 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
 
 namespace JS {
 
@@ -146,6 +150,78 @@ enum class WaitMode {
     Async,
 };
 
+// 25.4.1 Waiter Record, https://tc39.es/ecma262/#sec-waiter-record
+struct Waiter {
+    explicit Waiter(Threading::Mutex& mutex)
+        : condition(mutex)
+    {
+    }
+
+    Threading::ConditionVariable condition;
+    bool notified { false };
+};
+
+// 25.4.2 WaiterList Records, https://tc39.es/ecma262/#sec-waiterlist-records
+// NOTE: A WaiterList is identified by the address of the byte it waits on, which is stable for the lifetime of a Shared
+//       Data Block. All WaiterLists share a single critical section, which is held by at most one agent at a time.
+static Threading::Mutex s_waiter_list_mutex;
+static HashMap<FlatPtr, Vector<Waiter*>> s_waiter_lists;
+
+// 25.4.3.1 GetWaiterList ( block, i ), https://tc39.es/ecma262/#sec-getwaiterlist
+static FlatPtr waiter_list_key(ByteBuffer const& block, size_t byte_index_in_buffer)
+{
+    // 1. Assert: i and i + 3 are valid byte offsets within the memory of block.
+    VERIFY(byte_index_in_buffer + 3 < block.size());
+
+    // 2. Return the WaiterList that is referenced by the pair (block, i).
+    return reinterpret_cast<FlatPtr>(block.data() + byte_index_in_buffer);
+}
+
+// 25.4.3.11 SuspendThisAgent ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-suspendthisagent
+// NOTE: Returns false if the waiter timed out. Must be called from within the critical section.
+static bool suspend_this_agent(FlatPtr waiter_list, Waiter& waiter, double timeout)
+{
+    // NOTE: Timeouts too large to be represented are treated as infinite.
+    static constexpr double max_timeout_in_milliseconds = static_cast<double>(NumericLimits<i64>::max() / 1'000'000);
+
+    // 1. Assert: The surrounding agent is in the critical section for WL.
+    // 2. Assert: waiterRecord.[[AgentSignifier]] is AgentSignifier().
+    // 3. Assert: AgentCanSuspend() is true.
+    // 4. Perform LeaveCriticalSection(WL) and suspend the surrounding agent until the time is waiterRecord.[[TimeoutTime]],
+    //    performing the combined operation in such a way that a notification that arrives after the critical section is
+    //    exited but before the suspension takes effect is not lost. The surrounding agent can only wake from suspension
+    //    due to a timeout or due to another agent calling NotifyWaiter with arguments WL and thisAgent (i.e. via a call to
+    //    Atomics.notify).
+    if (timeout >= max_timeout_in_milliseconds) {
+        waiter.condition.wait_while([&] { return !waiter.notified; });
+    } else {
+        auto timeout_time = MonotonicTime::now() + AK::Duration::from_milliseconds(static_cast<i64>(timeout));
+
+        while (!waiter.notified) {
+            auto now = MonotonicTime::now();
+            if (now >= timeout_time)
+                break;
+            (void)waiter.condition.wait_for(timeout_time - now);
+        }
+    }
+
+    // 5. Perform EnterCriticalSection(WL).
+    // NOTE: The condition variable reacquires the critical section before returning.
+
+    // 6. If thisAgent was notified explicitly by another agent calling NotifyWaiter(WL, thisAgent), return.
+    if (waiter.notified)
+        return true;
+
+    // 7. Remove waiterRecord from WL.[[Waiters]].
+    auto& waiters = s_waiter_lists.find(waiter_list)->value;
+    waiters.remove_first_matching([&](auto* entry) { return entry == &waiter; });
+    if (waiters.is_empty())
+        s_waiter_lists.remove(waiter_list);
+
+    // 8. Set waiterRecord.[[Result]] to "timed-out".
+    return false;
+}
+
 // 25.4.3.14 DoWait ( mode, typedArray, index, value, timeout ), https://tc39.es/ecma262/#sec-dowait
 static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& typed_array, Value index_value, Value expected_value, Value timeout_value)
 {
@@ -186,15 +262,83 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
         timeout = max(timeout_number.as_double(), 0.0);
 
     // 10. If mode is sync and AgentCanSuspend() is false, throw a TypeError exception.
-    if (mode == WaitMode::Sync && !agent_can_suspend())
+    if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)index;
-    (void)value;
-    (void)timeout;
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    auto& block = buffer->buffer();
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 12. Let WL be GetWaiterList(block, i).
+    auto waiter_list = waiter_list_key(block, index);
+
+    // FIXME: 13. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    // 14. Else,
+    //     a. Let promiseCapability be ! NewPromiseCapability(%Promise%).
+    //     b. Let resultObject be OrdinaryObjectCreate(%Object.prototype%).
+    auto create_result_object = [&](bool is_async, Value result) {
+        auto result_object = Object::create(*vm.current_realm(), vm.current_realm()->intrinsics().object_prototype());
+        MUST(result_object->create_data_property_or_throw(vm.names.async, Value { is_async }));
+        MUST(result_object->create_data_property_or_throw(vm.names.value, result));
+        return result_object;
+    };
+
+    // 15. Perform EnterCriticalSection(WL).
+    // NOTE: The critical section is left when the locker goes out of scope.
+    Threading::MutexLocker locker { s_waiter_list_mutex };
+
+    // 16. Let elementType be TypedArrayElementType(typedArray).
+    // 17. Let w be GetValueFromBuffer(buffer, i, elementType, true, seq-cst).
+    auto current_value = typed_array.get_value_from_buffer(index, ArrayBuffer::Order::SeqCst);
+    i64 current = current_value.is_bigint() ? MUST(current_value.to_bigint_int64(vm)) : MUST(current_value.to_i32(vm));
+
+    // 18. If v ≠ w, then
+    if (value != current) {
+        // a. Perform LeaveCriticalSection(WL).
+        // b. If mode is sync, return "not-equal".
+        if (mode == WaitMode::Sync)
+            return PrimitiveString::create(vm, "not-equal"_string);
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "not-equal").
+        // e. Return resultObject.
+        return create_result_object(false, PrimitiveString::create(vm, "not-equal"_string));
+    }
+
+    // 19. If t = 0 and mode is async, then
+    if (timeout == 0 && mode == WaitMode::Async) {
+        // a. NOTE: There is no special handling of synchronous immediate timeouts. Asynchronous immediate timeouts have
+        //    special handling in order to fail fast and avoid unnecessary Promise jobs.
+        // b. Perform LeaveCriticalSection(WL).
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "timed-out").
+        // e. Return resultObject.
+        return create_result_object(false, PrimitiveString::create(vm, "timed-out"_string));
+    }
+
+    // FIXME: Implement asynchronous waits, which need the host to enqueue timeout jobs and resolve promises across agents.
+    if (mode == WaitMode::Async)
+        return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Atomics.waitAsync"sv);
+
+    // 20. Let thisAgent be AgentSignifier().
+    // 21. Let now be the time value (UTC) identifying the current time.
+    // 22. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 23. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 24. NOTE: When t is +∞, timeoutTime is also +∞.
+    // 25. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    Waiter waiter { s_waiter_list_mutex };
+
+    // 26. Perform AddWaiter(WL, waiterRecord).
+    s_waiter_lists.ensure(waiter_list).append(&waiter);
+
+    // 27. If mode is sync, then
+    //     a. Perform SuspendThisAgent(WL, waiterRecord).
+    auto was_notified = suspend_this_agent(waiter_list, waiter, timeout);
+
+    // 29. Perform LeaveCriticalSection(WL).
+    // 30. If mode is sync, return waiterRecord.[[Result]].
+    return PrimitiveString::create(vm, was_notified ? "ok"_string : "timed-out"_string);
 }
 
 template<typename T, typename AtomicFunction>
@@ -544,12 +688,35 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
-    (void)block;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    auto waiter_list = waiter_list_key(block, byte_index_in_buffer);
+
+    // 8. Perform EnterCriticalSection(WL).
+    // NOTE: The critical section is left when the locker goes out of scope.
+    Threading::MutexLocker locker { s_waiter_list_mutex };
+
+    // 9. Let S be RemoveWaiters(WL, c).
+    // 10. For each element W of S, do
+    //     a. Perform NotifyWaiter(WL, W).
+    size_t notified_count = 0;
+    if (auto it = s_waiter_lists.find(waiter_list); it != s_waiter_lists.end()) {
+        auto& waiters = it->value;
+
+        while (!waiters.is_empty() && static_cast<double>(notified_count) < count) {
+            auto* waiter = waiters.take_first();
+            waiter->notified = true;
+            waiter->condition.signal();
+            ++notified_count;
+        }
+
+        if (waiters.is_empty())
+            s_waiter_lists.remove(it);
+    }
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 11. Perform LeaveCriticalSection(WL).
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { notified_count };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
@@ -79,6 +79,7 @@ namespace JS {
     P(asinh)                                 \
     P(assert)                                \
     P(assign)                                \
+    P(async)                                 \
     P(at)                                    \
     P(atan)                                  \
     P(atan2)                                 \
@@ -420,6 +421,8 @@ namespace JS {
     P(pop)                                   \
     P(pow)                                   \
     P(preventExtensions)                     \
+    P(profile)                               \
+    P(profileEnd)                            \
     P(promise)                               \
     P(propertyIsEnumerable)                  \
     P(prototype)                             \
@@ -57,6 +57,8 @@ void ConsoleObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.time, time, 0, attr);
     define_native_function(realm, vm.names.timeLog, time_log, 0, attr);
     define_native_function(realm, vm.names.timeEnd, time_end, 0, attr);
+    define_native_function(realm, vm.names.profile, profile, 0, attr);
+    define_native_function(realm, vm.names.profileEnd, profile_end, 0, attr);
 
     define_direct_property(vm.well_known_symbol_to_string_tag(), PrimitiveString::create(vm, "console"_string), Attribute::Configurable);
 }
@@ -187,4 +189,18 @@ JS_DEFINE_NATIVE_FUNCTION(ConsoleObject::time_end)
     return console_object.console().time_end();
 }
 
+// Non-standard: profile(label), as implemented by other engines.
+JS_DEFINE_NATIVE_FUNCTION(ConsoleObject::profile)
+{
+    auto& console_object = *vm.current_realm()->intrinsics().console_object();
+    return console_object.console().profile();
+}
+
+// Non-standard: profileEnd(label), as implemented by other engines.
+JS_DEFINE_NATIVE_FUNCTION(ConsoleObject::profile_end)
+{
+    auto& console_object = *vm.current_realm()->intrinsics().console_object();
+    return console_object.console().profile_end();
+}
+
 }
@@ -73,6 +73,8 @@ private:
     ThrowCompletionOr<Value> get_binding_value_direct(VM&, Binding const&) const;
     ThrowCompletionOr<void> set_mutable_binding_direct(VM&, Binding&, Value, bool strict);
 
+    static u64 next_environment_serial_number();
+
     friend Completion dispose_resources(VM&, GCPtr<DeclarativeEnvironment>, Completion);
     Vector<DisposableResource> const& disposable_resource_stack() const { return m_disposable_resource_stack; }
 
@@ -129,7 +131,7 @@ private:
     Vector<Binding> m_bindings;
     Vector<DisposableResource> m_disposable_resource_stack;
 
-    u64 m_environment_serial_number { 0 };
+    u64 m_environment_serial_number { next_environment_serial_number() };
 };
 
 inline ThrowCompletionOr<Value> DeclarativeEnvironment::get_binding_value_direct(VM& vm, size_t index) const
@@ -102,8 +102,16 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(DeprecatedFlyString name, Byt
         return true;
     });
 
+    m_uses_this = parsing_insights.uses_this;
+    m_uses_this_from_environment = parsing_insights.uses_this_from_environment;
+}
+
+void ECMAScriptFunctionObject::analyze_function_declaration_instantiation()
+{
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
+    //       Most function objects are never called, so this is deferred until the first call.
+    VERIFY(!m_function_declaration_instantiation_analyzed);
 
     // 2. Let code be func.[[ECMAScriptCode]].
     ScopeNode const* scope_body = nullptr;
@@ -331,8 +339,8 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(DeprecatedFlyString name, Byt
         }));
     }
 
-    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
-    m_uses_this = parsing_insights.uses_this;
+    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || m_uses_this_from_environment || m_contains_direct_call_to_eval;
+    m_function_declaration_instantiation_analyzed = true;
 }
 
 void ECMAScriptFunctionObject::initialize(Realm& realm)
@@ -574,6 +582,8 @@ ThrowCompletionOr<void> ECMAScriptFunctionObject::prepare_for_ordinary_call(Exec
 
     // Non-standard
     callee_context.is_strict_mode = m_strict;
+    if (!m_function_declaration_instantiation_analyzed)
+        analyze_function_declaration_instantiation();
 
     // 1. Let callerContext be the running execution context.
     // 2. Let calleeContext be a new ECMAScript code execution context.
@@ -99,7 +99,11 @@ public:
 
     Variant<PropertyKey, PrivateName, Empty> const& class_field_initializer_name() const { return m_class_field_initializer_name; }
 
-    bool allocates_function_environment() const { return m_function_environment_needed; }
+    bool allocates_function_environment() const
+    {
+        VERIFY(m_function_declaration_instantiation_analyzed);
+        return m_function_environment_needed;
+    }
 
     friend class Bytecode::Generator;
 
@@ -114,6 +118,7 @@ private:
     virtual bool is_ecmascript_function_object() const override { return true; }
     virtual void visit_edges(Visitor&) override;
 
+    void analyze_function_declaration_instantiation();
     ThrowCompletionOr<void> prepare_for_ordinary_call(ExecutionContext& callee_context, Object* new_target);
     void ordinary_call_bind_this(ExecutionContext&, Value this_argument);
 
@@ -165,6 +170,8 @@ private:
     bool m_is_module_wrapper { false };
     bool m_function_environment_needed { false };
     bool m_uses_this { false };
+    bool m_uses_this_from_environment { false };
+    bool m_function_declaration_instantiation_analyzed { false };
     Vector<VariableNameToInitialize> m_var_names_to_initialize_binding;
     Vector<DeprecatedFlyString> m_function_names_to_initialize_binding;
 
@@ -85,7 +85,7 @@ void ExecutionContext::visit_edges(Cell::Visitor& visitor)
     visitor.visit(this_value);
     visitor.visit(executable);
     visitor.visit(function_name);
-    visitor.visit(arguments);
+    visitor.visit(arguments.span());
     visitor.visit(registers_and_constants_and_locals);
     for (auto& context : unwind_contexts) {
         visitor.visit(context.lexical_environment);
@@ -73,7 +73,9 @@ public:
     u32 passed_argument_count { 0 };
     bool is_strict_mode { false };
 
-    Vector<Value> arguments;
+    // NOTE: Most calls pass only a handful of arguments, so keep them inline to avoid a heap allocation per call.
+    static constexpr size_t inline_argument_capacity = 8;
+    Vector<Value, inline_argument_capacity> arguments;
     Vector<Value> registers_and_constants_and_locals;
     Vector<Bytecode::UnwindInfo> unwind_contexts;
     Vector<Optional<size_t>> previously_scheduled_jumps;
@@ -18,6 +18,8 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     , m_array_size(initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        update_element_kind(value);
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -43,10 +45,26 @@ void SimpleIndexedPropertyStorage::grow_storage_if_needed()
     }
 }
 
+void SimpleIndexedPropertyStorage::update_element_kind(Value value)
+{
+    auto kind = ElementKind::Packed;
+    if (value.is_int32())
+        kind = ElementKind::PackedInt32;
+    else if (value.is_number())
+        kind = ElementKind::PackedNumber;
+    else if (value.is_empty())
+        kind = ElementKind::Holey;
+    m_element_kind = max(m_element_kind, kind);
+}
+
 void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttributes attributes)
 {
     VERIFY(attributes == default_attributes);
 
+    if (index > m_array_size)
+        m_element_kind = ElementKind::Holey;
+    update_element_kind(value);
+
     if (index >= m_array_size) {
         m_array_size = index + 1;
         grow_storage_if_needed();
@@ -58,6 +76,7 @@ void SimpleIndexedPropertyStorage::remove(u32 index)
 {
     VERIFY(index < m_array_size);
     m_packed_elements[index] = {};
+    m_element_kind = ElementKind::Holey;
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
@@ -76,6 +95,8 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
 
 bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
 {
+    if (new_size > m_array_size)
+        m_element_kind = ElementKind::Holey;
     m_array_size = new_size;
     m_packed_elements.resize_and_keep_capacity(new_size);
     return true;
@@ -56,6 +56,14 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // Summarizes the values in [0, array_like_size()). Kinds only ever transition towards Holey.
+    enum class ElementKind : u8 {
+        PackedInt32,
+        PackedNumber,
+        Packed,
+        Holey,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes) {};
     explicit SimpleIndexedPropertyStorage(Vector<Value>&& initial_values);
@@ -73,6 +81,7 @@ public:
     virtual bool set_array_like_size(size_t new_size) override;
 
     Vector<Value> const& elements() const { return m_packed_elements; }
+    ElementKind element_kind() const { return m_element_kind; }
 
     [[nodiscard]] bool inline_has_index(u32 index) const
     {
@@ -90,9 +99,11 @@ private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
+    void update_element_kind(Value);
 
     size_t m_array_size { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::PackedInt32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
@@ -57,10 +57,12 @@ public:
     NonnullGCPtr<FunctionObject> unescape_function() const { return *m_unescape_function; }
 
     // Namespace/constructor object functions
-    NonnullGCPtr<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    NonnullGCPtr<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    NonnullGCPtr<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    NonnullGCPtr<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    // These are captured when their owning object is first created, so asking for them doesn't force the creation of
+    // the Array, Date and JSON intrinsics on every realm.
+    NonnullGCPtr<FunctionObject> array_prototype_values_function();
+    NonnullGCPtr<FunctionObject> date_constructor_now_function();
+    NonnullGCPtr<FunctionObject> json_parse_function();
+    NonnullGCPtr<FunctionObject> json_stringify_function();
     NonnullGCPtr<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
     NonnullGCPtr<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
 #include <AK/Function.h>
+#include <AK/GenericLexer.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
@@ -107,7 +110,9 @@ ThrowCompletionOr<Optional<ByteString>> JSONObject::stringify_impl(VM& vm, Value
 
     auto wrapper = Object::create(realm, realm.intrinsics().object_prototype());
     MUST(wrapper->create_data_property_or_throw(ByteString::empty(), value));
-    return serialize_json_property(vm, state, ByteString::empty(), wrapper);
+    if (!TRY(serialize_json_property(vm, state, ByteString::empty(), wrapper)))
+        return Optional<ByteString> {};
+    return state.builder.to_byte_string();
 }
 
 // 25.5.2 JSON.stringify ( value [ , replacer [ , space ] ] ), https://tc39.es/ecma262/#sec-json.stringify
@@ -127,11 +132,33 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::stringify)
     return PrimitiveString::create(vm, maybe_string.release_value());
 }
 
+// Plain objects and arrays use the ordinary internal methods, so their own data properties can be read straight from
+// storage, without going through [[Get]].
+static bool has_ordinary_internal_methods(Object const& object)
+{
+    return typeid(object) == typeid(Object) || typeid(object) == typeid(Array);
+}
+
+static Optional<Value> own_data_property_value(Object const& object, PropertyKey const& key)
+{
+    if (!has_ordinary_internal_methods(object))
+        return {};
+
+    auto value_and_attributes = object.storage_get(key);
+    if (!value_and_attributes.has_value() || value_and_attributes->value.is_accessor())
+        return {};
+    return value_and_attributes->value;
+}
+
 // 25.5.2.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/ecma262/#sec-serializejsonproperty
-ThrowCompletionOr<Optional<ByteString>> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
+// NOTE: Appends the serialization to state.builder, and returns false if the result would be undefined.
+ThrowCompletionOr<bool> JSONObject::serialize_json_property(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder)
 {
     // 1. Let value be ? Get(holder, key).
-    auto value = TRY(holder->get(key));
+    // OPTIMIZATION: Avoid [[Get]] for own data properties of plain objects and arrays.
+    auto value = own_data_property_value(*holder, key).value_or(js_undefined());
+    if (value.is_undefined())
+        value = TRY(holder->get(key));
 
     // 2. If Type(value) is Object or BigInt, then
     if (value.is_object() || value.is_bigint()) {
@@ -178,26 +205,35 @@ ThrowCompletionOr<Optional<ByteString>> JSONObject::serialize_json_property(VM&
     }
 
     // 5. If value is null, return "null".
-    if (value.is_null())
-        return "null"sv;
+    if (value.is_null()) {
+        state.builder.append("null"sv);
+        return true;
+    }
 
     // 6. If value is true, return "true".
     // 7. If value is false, return "false".
-    if (value.is_boolean())
-        return value.as_bool() ? "true"sv : "false"sv;
+    if (value.is_boolean()) {
+        state.builder.append(value.as_bool() ? "true"sv : "false"sv);
+        return true;
+    }
 
     // 8. If Type(value) is String, return QuoteJSONString(value).
-    if (value.is_string())
-        return quote_json_string(value.as_string().byte_string());
+    if (value.is_string()) {
+        quote_json_string(state.builder, value.as_string().byte_string());
+        return true;
+    }
 
     // 9. If Type(value) is Number, then
     if (value.is_number()) {
         // a. If value is finite, return ! ToString(value).
-        if (value.is_finite_number())
-            return MUST(value.to_byte_string(vm));
-
+        if (value.is_int32())
+            state.builder.appendff("{}", value.as_i32());
+        else if (value.is_finite_number())
+            number_to_string(state.builder, value.as_double());
         // b. Return "null".
-        return "null"sv;
+        else
+            state.builder.append("null"sv);
+        return true;
     }
 
     // 10. If Type(value) is BigInt, throw a TypeError exception.
@@ -211,18 +247,45 @@ ThrowCompletionOr<Optional<ByteString>> JSONObject::serialize_json_property(VM&
 
         // b. If isArray is true, return ? SerializeJSONArray(state, value).
         if (is_array)
-            return TRY(serialize_json_array(vm, state, value.as_object()));
-
+            TRY(serialize_json_array(vm, state, value.as_object()));
         // c. Return ? SerializeJSONObject(state, value).
-        return TRY(serialize_json_object(vm, state, value.as_object()));
+        else
+            TRY(serialize_json_object(vm, state, value.as_object()));
+        return true;
     }
 
     // 12. Return undefined.
-    return Optional<ByteString> {};
+    return false;
+}
+
+static ThrowCompletionOr<Vector<PropertyKey>> enumerable_own_string_keys(Object& object)
+{
+    // OPTIMIZATION: Plain objects can list their keys directly from their indexed storage and shape, without creating
+    //               a string value for every key.
+    if (typeid(object) == typeid(Object)) {
+        Vector<PropertyKey> keys;
+        keys.ensure_capacity(object.indexed_properties().real_size() + object.shape().property_count());
+        for (auto& entry : object.indexed_properties()) {
+            if (object.indexed_properties().get(entry.index())->attributes.is_enumerable())
+                keys.unchecked_append(entry.index());
+        }
+        for (auto& [key, metadata] : object.shape().property_table()) {
+            if (key.is_string() && metadata.attributes.is_enumerable())
+                keys.unchecked_append(key);
+        }
+        return keys;
+    }
+
+    auto property_list = TRY(object.enumerable_own_property_names(Object::PropertyKind::Key));
+    Vector<PropertyKey> keys;
+    keys.ensure_capacity(property_list.size());
+    for (auto& property : property_list)
+        keys.unchecked_append(property.as_string().byte_string());
+    return keys;
 }
 
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
-ThrowCompletionOr<ByteString> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
+ThrowCompletionOr<void> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
@@ -230,19 +293,33 @@ ThrowCompletionOr<ByteString> JSONObject::serialize_json_object(VM& vm, Stringif
     state.seen_objects.set(&object);
     ByteString previous_indent = state.indent;
     state.indent = ByteString::formatted("{}{}", state.indent, state.gap);
-    Vector<ByteString> property_strings;
+
+    auto& builder = state.builder;
+    bool first = true;
+    builder.append('{');
 
     auto process_property = [&](PropertyKey const& key) -> ThrowCompletionOr<void> {
         if (key.is_symbol())
             return {};
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, key, &object));
-        if (serialized_property_string.has_value()) {
-            property_strings.append(ByteString::formatted(
-                "{}:{}{}",
-                quote_json_string(key.to_string()),
-                state.gap.is_empty() ? "" : " ",
-                serialized_property_string));
+
+        auto length_before_property = builder.length();
+        if (!first)
+            builder.append(',');
+        if (!state.gap.is_empty()) {
+            builder.append('\n');
+            builder.append(state.indent);
+        }
+        quote_json_string(builder, key.to_string());
+        builder.append(':');
+        if (!state.gap.is_empty())
+            builder.append(' ');
+
+        // NOTE: Properties that serialize to undefined are skipped, so remove everything we've appended for them.
+        if (!TRY(serialize_json_property(vm, state, key, &object))) {
+            builder.trim(builder.length() - length_before_property);
+            return {};
         }
+        first = false;
         return {};
     };
 
@@ -251,46 +328,24 @@ ThrowCompletionOr<ByteString> JSONObject::serialize_json_object(VM& vm, Stringif
         for (auto& property : property_list)
             TRY(process_property(property));
     } else {
-        auto property_list = TRY(object.enumerable_own_property_names(PropertyKind::Key));
+        auto property_list = TRY(enumerable_own_string_keys(object));
         for (auto& property : property_list)
-            TRY(process_property(property.as_string().byte_string()));
+            TRY(process_property(property));
     }
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("{}"sv);
-    } else {
-        bool first = true;
-        builder.append('{');
-        if (state.gap.is_empty()) {
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-        } else {
-            builder.append('\n');
-            builder.append(state.indent);
-            auto separator = ByteString::formatted(",\n{}", state.indent);
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append('\n');
-            builder.append(previous_indent);
-        }
-        builder.append('}');
+
+    if (!first && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
     }
+    builder.append('}');
 
     state.seen_objects.remove(&object);
     state.indent = previous_indent;
-    return builder.to_byte_string();
+    return {};
 }
 
 // 25.5.2.5 SerializeJSONArray ( state, value ), https://tc39.es/ecma262/#sec-serializejsonarray
-ThrowCompletionOr<ByteString> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
+ThrowCompletionOr<void> JSONObject::serialize_json_array(VM& vm, StringifyState& state, Object& object)
 {
     if (state.seen_objects.contains(&object))
         return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
@@ -298,68 +353,89 @@ ThrowCompletionOr<ByteString> JSONObject::serialize_json_array(VM& vm, Stringify
     state.seen_objects.set(&object);
     ByteString previous_indent = state.indent;
     state.indent = ByteString::formatted("{}{}", state.indent, state.gap);
-    Vector<ByteString> property_strings;
 
     auto length = TRY(length_of_array_like(vm, object));
 
-    // Optimization
-    property_strings.ensure_capacity(length);
+    auto& builder = state.builder;
+    builder.append('[');
 
     for (size_t i = 0; i < length; ++i) {
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, i, &object));
-        if (!serialized_property_string.has_value()) {
-            property_strings.append("null"sv);
-        } else {
-            property_strings.append(serialized_property_string.release_value());
+        if (i > 0)
+            builder.append(',');
+        if (!state.gap.is_empty()) {
+            builder.append('\n');
+            builder.append(state.indent);
         }
+        if (!TRY(serialize_json_property(vm, state, i, &object)))
+            builder.append("null"sv);
     }
 
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("[]"sv);
-    } else {
-        if (state.gap.is_empty()) {
-            builder.append('[');
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append(']');
-        } else {
-            builder.append("[\n"sv);
-            builder.append(state.indent);
-            auto separator = ByteString::formatted(",\n{}", state.indent);
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append('\n');
-            builder.append(previous_indent);
-            builder.append(']');
-        }
+    if (length > 0 && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
     }
+    builder.append(']');
 
     state.seen_objects.remove(&object);
     state.indent = previous_indent;
-    return builder.to_byte_string();
+    return {};
+}
+
+// Returns the length of the run of characters starting at the given offset that don't need any special handling.
+// Quotes, backslashes and control characters always end a run, and non-ASCII characters do if requested.
+static size_t length_of_plain_json_run(StringView string, size_t offset, bool stop_at_non_ascii)
+{
+    auto const* characters = reinterpret_cast<u8 const*>(string.characters_without_null_termination());
+    auto length = string.length();
+    auto index = offset;
+
+    // OPTIMIZATION: Check 8 bytes at a time. Each check sets the high bit of every byte that matches, although bytes
+    //               above a match may also be flagged because of borrows. We only use them to find out whether there
+    //               is any match at all, and then find the exact position one byte at a time.
+    static constexpr u64 ones = 0x0101010101010101ull;
+    static constexpr u64 high_bits = 0x8080808080808080ull;
+    auto has_zero_byte = [](u64 word) { return (word - ones) & ~word & high_bits; };
+    while (index + sizeof(u64) <= length) {
+        u64 word;
+        __builtin_memcpy(&word, characters + index, sizeof(u64));
+        auto special_bytes = has_zero_byte(word ^ (ones * '"'))
+            | has_zero_byte(word ^ (ones * '\\'))
+            | ((word - ones * 0x20) & ~word & high_bits);
+        if (stop_at_non_ascii)
+            special_bytes |= word & high_bits;
+        if (special_bytes)
+            break;
+        index += sizeof(u64);
+    }
+
+    for (; index < length; ++index) {
+        auto ch = characters[index];
+        if (ch == '"' || ch == '\\' || ch < 0x20 || (stop_at_non_ascii && ch >= 0x80))
+            break;
+    }
+    return index - offset;
 }
 
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
-ByteString JSONObject::quote_json_string(ByteString string)
+void JSONObject::quote_json_string(StringBuilder& builder, StringView string)
 {
     // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
-    StringBuilder builder;
     builder.append('"');
 
     // 2. For each code point C of StringToCodePoints(value), do
-    auto utf_view = Utf8View(string);
-    for (auto code_point : utf_view) {
+    for (size_t offset = 0; offset < string.length();) {
+        // OPTIMIZATION: Runs of ASCII characters that don't need escaping are appended as-is.
+        auto run_length = length_of_plain_json_run(string, offset, true);
+        builder.append(string.substring_view(offset, run_length));
+        offset += run_length;
+        if (offset == string.length())
+            break;
+
+        auto code_point_view = Utf8View(string.substring_view(offset));
+        auto it = code_point_view.begin();
+        auto code_point = *it;
+        offset += it.underlying_code_point_length_in_bytes();
+
         // a. If C is listed in the “Code Point” column of Table 70, then
         // i. Set product to the string-concatenation of product and the escape sequence for C as specified in the “Escape Sequence” column of the corresponding row.
         switch (code_point) {
@@ -402,9 +478,246 @@ ByteString JSONObject::quote_json_string(ByteString string)
     builder.append('"');
 
     // 4. Return product.
-    return builder.to_byte_string();
 }
 
+// Parses JSON text directly into JS values in a single pass, without materializing an intermediate AK::JsonValue tree.
+class JSONValueParser : private GenericLexer {
+public:
+    JSONValueParser(VM& vm, StringView input)
+        : GenericLexer(input)
+        , m_vm(vm)
+        , m_realm(*vm.current_realm())
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        skip_whitespace();
+        if (!is_eof())
+            return malformed();
+        return value;
+    }
+
+private:
+    static constexpr bool is_json_whitespace(char ch)
+    {
+        return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+    }
+
+    Completion malformed()
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    void skip_whitespace()
+    {
+        ignore_while(is_json_whitespace);
+    }
+
+    size_t plain_string_run_length() const
+    {
+        return length_of_plain_json_run(m_input, m_index, false);
+    }
+
+    // Consumes a string, and returns it without escapes. Strings without escape sequences are returned as views into the input.
+    ThrowCompletionOr<StringView> consume_string()
+    {
+        if (!consume_specific('"'))
+            return malformed();
+
+        auto run = consume(plain_string_run_length());
+        if (peek() == '"') {
+            ignore();
+            return run;
+        }
+
+        m_string_builder.clear();
+        m_string_builder.append(run);
+        for (;;) {
+            if (is_eof() || is_ascii_c0_control(peek()))
+                return malformed();
+            if (consume_specific('"'))
+                break;
+
+            VERIFY(peek() == '\\');
+            ignore();
+            switch (is_eof() ? '\0' : consume()) {
+            case '"':
+                m_string_builder.append('"');
+                break;
+            case '\\':
+                m_string_builder.append('\\');
+                break;
+            case '/':
+                m_string_builder.append('/');
+                break;
+            case 'b':
+                m_string_builder.append('\b');
+                break;
+            case 'f':
+                m_string_builder.append('\f');
+                break;
+            case 'n':
+                m_string_builder.append('\n');
+                break;
+            case 'r':
+                m_string_builder.append('\r');
+                break;
+            case 't':
+                m_string_builder.append('\t');
+                break;
+            case 'u': {
+                auto code_point = decode_single_or_paired_surrogate();
+                if (code_point.is_error())
+                    return malformed();
+                m_string_builder.append_code_point(code_point.value());
+                break;
+            }
+            default:
+                return malformed();
+            }
+
+            m_string_builder.append(consume(plain_string_run_length()));
+        }
+        return m_string_builder.string_view();
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = tell();
+
+        consume_specific('-');
+        if (consume_specific('0')) {
+            if (is_ascii_digit(peek()))
+                return malformed();
+        } else if (is_ascii_digit(peek())) {
+            ignore_while(is_ascii_digit);
+        } else {
+            return malformed();
+        }
+
+        bool is_integer = true;
+        if (consume_specific('.')) {
+            if (!is_ascii_digit(peek()))
+                return malformed();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+        if (peek() == 'e' || peek() == 'E') {
+            ignore();
+            if (peek() == '+' || peek() == '-')
+                ignore();
+            if (!is_ascii_digit(peek()))
+                return malformed();
+            ignore_while(is_ascii_digit);
+            is_integer = false;
+        }
+
+        auto number_text = m_input.substring_view(start, tell() - start);
+
+        // OPTIMIZATION: Integers with at most 15 digits are exactly representable, so we can accumulate them directly.
+        if (is_integer && number_text.length() <= 15) {
+            bool negative = number_text.starts_with('-');
+            double value = 0;
+            for (auto ch : number_text.substring_view(negative ? 1 : 0))
+                value = value * 10 + parse_ascii_digit(ch);
+            return Value(negative ? -value : value);
+        }
+
+        auto const* characters = number_text.characters_without_null_termination();
+        auto result = parse_first_floating_point<double>(characters, characters + number_text.length());
+        VERIFY(result.parsed_value());
+        return Value(result.value);
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+        ignore(); // '{'
+        skip_whitespace();
+        if (consume_specific('}'))
+            return object;
+
+        for (;;) {
+            skip_whitespace();
+            if (peek() != '"')
+                return malformed();
+
+            // NOTE: Keys are interned directly from the input (or the unescaped string), so repeated keys don't cause
+            //       any allocations, and objects with the same key sequence share shapes through cached transitions.
+            auto key = DeprecatedFlyString { TRY(consume_string()) };
+
+            skip_whitespace();
+            if (!consume_specific(':'))
+                return malformed();
+
+            auto value = TRY(parse_value());
+            object->define_direct_property(key, value, default_attributes);
+
+            skip_whitespace();
+            if (consume_specific('}'))
+                return object;
+            if (!consume_specific(','))
+                return malformed();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        auto array = MUST(Array::create(m_realm, 0));
+        ignore(); // '['
+        skip_whitespace();
+        if (consume_specific(']'))
+            return array;
+
+        for (size_t index = 0;; ++index) {
+            auto value = TRY(parse_value());
+            array->define_direct_property(index, value, default_attributes);
+
+            skip_whitespace();
+            if (consume_specific(']'))
+                return array;
+            if (!consume_specific(','))
+                return malformed();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        skip_whitespace();
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"':
+            return PrimitiveString::create(m_vm, TRY(consume_string()));
+        case 't':
+            if (!consume_specific("true"sv))
+                return malformed();
+            return Value(true);
+        case 'f':
+            if (!consume_specific("false"sv))
+                return malformed();
+            return Value(false);
+        case 'n':
+            if (!consume_specific("null"sv))
+                return malformed();
+            return js_null();
+        default:
+            return parse_number();
+        }
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringBuilder m_string_builder;
+};
+
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
 JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
 {
@@ -413,10 +726,7 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     auto string = TRY(vm.argument(0).to_byte_string(vm));
     auto reviver = vm.argument(1);
 
-    auto json = JsonValue::from_string(string);
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-    Value unfiltered = parse_json_value(vm, json.value());
+    Value unfiltered = TRY(JSONValueParser(vm, string).parse());
     if (reviver.is_function()) {
         auto root = Object::create(realm, realm.intrinsics().object_prototype());
         auto root_name = ByteString::empty();
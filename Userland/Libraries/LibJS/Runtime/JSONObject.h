@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/StringBuilder.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
@@ -33,13 +34,14 @@ private:
         ByteString indent { ByteString::empty() };
         ByteString gap;
         Optional<Vector<ByteString>> property_list;
+        StringBuilder builder;
     };
 
     // Stringify helpers
-    static ThrowCompletionOr<Optional<ByteString>> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
-    static ThrowCompletionOr<ByteString> serialize_json_object(VM&, StringifyState&, Object&);
-    static ThrowCompletionOr<ByteString> serialize_json_array(VM&, StringifyState&, Object&);
-    static ByteString quote_json_string(ByteString);
+    static ThrowCompletionOr<bool> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
+    static ThrowCompletionOr<void> serialize_json_object(VM&, StringifyState&, Object&);
+    static ThrowCompletionOr<void> serialize_json_array(VM&, StringifyState&, Object&);
+    static void quote_json_string(StringBuilder&, StringView);
 
     // Parse helpers
     static Object* parse_json_object(VM&, JsonObject const&);
@@ -26,6 +26,8 @@ PrimitiveString::PrimitiveString(PrimitiveString& lhs, PrimitiveString& rhs)
     , m_lhs(&lhs)
     , m_rhs(&rhs)
 {
+    if (lhs.m_length_in_utf16_code_units.has_value() && rhs.m_length_in_utf16_code_units.has_value())
+        m_length_in_utf16_code_units = *lhs.m_length_in_utf16_code_units + *rhs.m_length_in_utf16_code_units;
 }
 
 PrimitiveString::PrimitiveString(String string)
@@ -136,13 +138,57 @@ Utf16View PrimitiveString::utf16_string_view() const
     return m_utf16_string->view();
 }
 
+size_t PrimitiveString::length_in_utf16_code_units() const
+{
+    if (m_length_in_utf16_code_units.has_value())
+        return *m_length_in_utf16_code_units;
+
+    if (!m_is_rope) {
+        if (has_utf16_string())
+            m_length_in_utf16_code_units = m_utf16_string->length_in_code_units();
+        else if (has_utf8_string())
+            m_length_in_utf16_code_units = utf16_code_unit_length_from_utf8(m_utf8_string->bytes_as_string_view());
+        else if (has_byte_string())
+            m_length_in_utf16_code_units = utf16_code_unit_length_from_utf8(*m_byte_string);
+        else
+            VERIFY_NOT_REACHED();
+        return *m_length_in_utf16_code_units;
+    }
+
+    // NOTE: Like in resolve_rope_if_needed(), we avoid recursion here. Since the length is cached on every string
+    //       we ask, a string built by repeated concatenation only has to look at its newest pieces.
+    size_t length = 0;
+    Vector<PrimitiveString const*> stack;
+    stack.append(m_rhs);
+    stack.append(m_lhs);
+    while (!stack.is_empty()) {
+        auto const* current = stack.take_last();
+        if (current->m_is_rope && !current->m_length_in_utf16_code_units.has_value()) {
+            stack.append(current->m_rhs);
+            stack.append(current->m_lhs);
+            continue;
+        }
+        length += current->length_in_utf16_code_units();
+    }
+
+    m_length_in_utf16_code_units = length;
+    return length;
+}
+
+DeprecatedFlyString PrimitiveString::to_deprecated_fly_string() const
+{
+    DeprecatedFlyString fly_string { byte_string() };
+    m_byte_string = ByteString { fly_string };
+    return fly_string;
+}
+
 ThrowCompletionOr<Optional<Value>> PrimitiveString::get(VM& vm, PropertyKey const& property_key) const
 {
     if (property_key.is_symbol())
         return Optional<Value> {};
     if (property_key.is_string()) {
         if (property_key.as_string() == vm.names.length.as_string()) {
-            auto length = utf16_string().length_in_code_units();
+            auto length = length_in_utf16_code_units();
             return Value(static_cast<double>(length));
         }
     }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/ByteString.h>
+#include <AK/DeprecatedFlyString.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -51,6 +52,13 @@ public:
     [[nodiscard]] Utf16View utf16_string_view() const;
     bool has_utf16_string() const { return m_utf16_string.has_value(); }
 
+    // NOTE: This does not resolve ropes, so it's cheap to call on strings that are still being built.
+    [[nodiscard]] size_t length_in_utf16_code_units() const;
+
+    // Returns this string as an interned property key string. The interned copy replaces our own ByteString,
+    // so converting the same string again doesn't need another lookup in the interning table.
+    [[nodiscard]] DeprecatedFlyString to_deprecated_fly_string() const;
+
     ThrowCompletionOr<Optional<Value>> get(VM&, PropertyKey const&) const;
 
 private:
@@ -75,6 +83,8 @@ private:
     mutable Optional<String> m_utf8_string;
     mutable Optional<ByteString> m_byte_string;
     mutable Optional<Utf16String> m_utf16_string;
+
+    mutable Optional<size_t> m_length_in_utf16_code_units;
 };
 
 }
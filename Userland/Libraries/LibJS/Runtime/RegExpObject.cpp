@@ -145,6 +145,19 @@ ThrowCompletionOr<ByteString> parse_regex_pattern(VM& vm, StringView pattern, bo
     return result.release_value();
 }
 
+Regex<ECMA262> compile_regex(VM& vm, ByteString pattern, regex::RegexOptions<ECMAScriptFlags> flags, regex::Parser::Result const* parse_result)
+{
+    if (auto cached_parser_result = vm.find_cached_regex(pattern, flags); cached_parser_result.has_value())
+        return Regex<ECMA262>::from_optimized_parser_result(cached_parser_result.release_value(), move(pattern), flags);
+
+    auto regex = parse_result
+        ? Regex<ECMA262>(*parse_result, pattern, flags)
+        : Regex<ECMA262>(pattern, flags);
+    if (regex.parser_result.error == regex::Error::NoError)
+        vm.cache_regex(move(pattern), flags, regex.parser_result);
+    return regex;
+}
+
 NonnullGCPtr<RegExpObject> RegExpObject::create(Realm& realm)
 {
     return realm.heap().allocate<RegExpObject>(realm, realm.intrinsics().regexp_prototype());
@@ -217,7 +230,7 @@ ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM
     }
 
     // 14. If parseResult is a non-empty List of SyntaxError objects, throw a SyntaxError exception.
-    Regex<ECMA262> regex(move(parsed_pattern), parsed_flags);
+    auto regex = compile_regex(vm, move(parsed_pattern), parsed_flags);
     if (regex.parser_result.error != regex::Error::NoError)
         return vm.throw_completion<SyntaxError>(ErrorType::RegExpCompileError, regex.error_string());
 
@@ -23,6 +23,9 @@ struct ParseRegexPatternError {
 ErrorOr<ByteString, ParseRegexPatternError> parse_regex_pattern(StringView pattern, bool unicode, bool unicode_sets);
 ThrowCompletionOr<ByteString> parse_regex_pattern(VM& vm, StringView pattern, bool unicode, bool unicode_sets);
 
+// Compiles an already parsed pattern, reusing the program of an earlier RegExp with the same pattern and flags if the VM still has it.
+Regex<ECMA262> compile_regex(VM&, ByteString pattern, regex::RegexOptions<ECMAScriptFlags>, regex::Parser::Result const* parse_result = nullptr);
+
 class RegExpObject : public Object {
     JS_OBJECT(RegExpObject, Object);
     JS_DECLARE_ALLOCATOR(RegExpObject);
@@ -15,6 +15,30 @@ JS_DEFINE_ALLOCATOR(PrototypeChainValidity);
 
 static HashTable<JS::GCPtr<Shape>> s_all_prototype_shapes;
 
+// Small shapes answer lookups by walking their transition chain, so most of them never need a property table.
+static constexpr u32 max_property_count_for_lookup_without_property_table = 8;
+static constexpr size_t max_transition_chain_walk_length = 16;
+
+// Dead transitions are otherwise only pruned when the same transition is requested again.
+static constexpr size_t min_transition_count_for_pruning = 8;
+
+template<typename Key>
+static void prune_dead_transitions_if_needed(HashMap<Key, WeakPtr<Shape>>& transitions)
+{
+    if (transitions.size() < min_transition_count_for_pruning || !is_power_of_two(transitions.size()))
+        return;
+    transitions.remove_all_matching([](auto const&, auto const& shape) { return !shape; });
+}
+
+template<typename Map>
+static size_t approximate_memory_usage(Map const* map)
+{
+    if (!map)
+        return 0;
+    // NOTE: This is an upper bound for unordered maps, which don't have the previous/next bucket pointers.
+    return sizeof(Map) + map->capacity() * (sizeof(typename Map::KeyType) + sizeof(typename Map::ValueType) + 2 * sizeof(void*));
+}
+
 Shape::~Shape()
 {
     if (m_is_prototype_shape)
@@ -110,6 +134,7 @@ NonnullGCPtr<Shape> Shape::create_put_transition(StringOrSymbol const& property_
     if (!m_is_prototype_shape) {
         if (!m_forward_transitions)
             m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+        prune_dead_transitions_if_needed(*m_forward_transitions);
         m_forward_transitions->set(key, new_shape.ptr());
     }
     return new_shape;
@@ -125,6 +150,7 @@ NonnullGCPtr<Shape> Shape::create_configure_transition(StringOrSymbol const& pro
     if (!m_is_prototype_shape) {
         if (!m_forward_transitions)
             m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+        prune_dead_transitions_if_needed(*m_forward_transitions);
         m_forward_transitions->set(key, new_shape.ptr());
     }
     return new_shape;
@@ -141,6 +167,7 @@ NonnullGCPtr<Shape> Shape::create_prototype_transition(Object* new_prototype)
     if (!m_is_prototype_shape) {
         if (!m_prototype_transitions)
             m_prototype_transitions = make<HashMap<GCPtr<Object>, WeakPtr<Shape>>>();
+        prune_dead_transitions_if_needed(*m_prototype_transitions);
         m_prototype_transitions->set(new_prototype, new_shape.ptr());
     }
     return new_shape;
@@ -210,10 +237,61 @@ void Shape::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_prototype_chain_validity);
 }
 
+size_t Shape::external_memory_usage() const
+{
+    return approximate_memory_usage(m_property_table.ptr())
+        + approximate_memory_usage(m_forward_transitions.ptr())
+        + approximate_memory_usage(m_prototype_transitions.ptr())
+        + approximate_memory_usage(m_delete_transitions.ptr());
+}
+
+bool Shape::lookup_in_transition_chain(StringOrSymbol const& property_key, Optional<PropertyMetadata>& result) const
+{
+    Optional<PropertyAttributes> configured_attributes;
+    size_t walked_shapes = 0;
+    for (auto const* shape = this; shape; shape = shape->m_previous) {
+        if (++walked_shapes > max_transition_chain_walk_length)
+            return false;
+
+        if (shape->m_property_table) {
+            result = shape->m_property_table->get(property_key);
+            if (result.has_value() && configured_attributes.has_value())
+                result->attributes = *configured_attributes;
+            return true;
+        }
+
+        // NOTE: Deletions shift the offsets of all later properties, so we leave those to ensure_property_table().
+        if (shape->m_transition_type == TransitionType::Delete)
+            return false;
+
+        if (!shape->m_property_key.is_valid() || shape->m_property_key != property_key)
+            continue;
+
+        if (shape->m_transition_type == TransitionType::Configure) {
+            // The most recent configure transition determines the attributes.
+            if (!configured_attributes.has_value())
+                configured_attributes = shape->m_attributes;
+            continue;
+        }
+
+        VERIFY(shape->m_transition_type == TransitionType::Put);
+        result = PropertyMetadata { shape->m_property_count - 1, configured_attributes.value_or(shape->m_attributes) };
+        return true;
+    }
+
+    result = {};
+    return true;
+}
+
 Optional<PropertyMetadata> Shape::lookup(StringOrSymbol const& property_key) const
 {
     if (m_property_count == 0)
         return {};
+    if (!m_property_table && m_property_count <= max_property_count_for_lookup_without_property_table) {
+        Optional<PropertyMetadata> property;
+        if (lookup_in_transition_chain(property_key, property))
+            return property;
+    }
     auto property = property_table().get(property_key);
     if (!property.has_value())
         return {};
@@ -278,6 +356,7 @@ NonnullGCPtr<Shape> Shape::create_delete_transition(StringOrSymbol const& proper
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     if (!m_delete_transitions)
         m_delete_transitions = make<HashMap<StringOrSymbol, WeakPtr<Shape>>>();
+    prune_dead_transitions_if_needed(*m_delete_transitions);
     m_delete_transitions->set(property_key, new_shape.ptr());
     return new_shape;
 }
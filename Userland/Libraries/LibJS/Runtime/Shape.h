@@ -115,6 +115,9 @@ private:
     void invalidate_all_prototype_chains_leading_to_this();
 
     virtual void visit_edges(Visitor&) override;
+    virtual size_t external_memory_usage() const override;
+
+    [[nodiscard]] bool lookup_in_transition_chain(StringOrSymbol const&, Optional<PropertyMetadata>& result) const;
 
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_forward_transition(TransitionKey const&);
     [[nodiscard]] GCPtr<Shape> get_or_prune_cached_prototype_transition(Object* prototype);
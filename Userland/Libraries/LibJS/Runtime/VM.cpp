@@ -511,6 +511,64 @@ VM::StoredModule* VM::get_stored_module(ImportedModuleReferrer const&, ByteStrin
     return &(*end_or_module);
 }
 
+RefPtr<Program> VM::find_cached_program(StringView filename, StringView source_text, size_t line_number_offset) const
+{
+    auto source_hash = source_text.hash();
+    for (auto const& cached_program : m_cached_programs) {
+        if (cached_program.source_hash != source_hash || cached_program.line_number_offset != line_number_offset || cached_program.filename != filename)
+            continue;
+        if (cached_program.program->source_code().code() != source_text)
+            continue;
+        return cached_program.program;
+    }
+    return nullptr;
+}
+
+void VM::cache_program(StringView filename, size_t line_number_offset, NonnullRefPtr<Program> program)
+{
+    // NOTE: Only the most recent parse of a given script is kept around.
+    m_cached_programs.remove_all_matching([&](auto const& cached_program) {
+        return cached_program.filename == filename && cached_program.line_number_offset == line_number_offset;
+    });
+    if (m_cached_programs.size() >= max_cached_programs)
+        m_cached_programs.take_first();
+
+    auto source_hash = program->source_code().code().bytes_as_string_view().hash();
+    m_cached_programs.append({
+        .filename = filename,
+        .line_number_offset = line_number_offset,
+        .source_hash = source_hash,
+        .program = move(program),
+    });
+}
+
+Optional<regex::Parser::Result> VM::find_cached_regex(StringView pattern, regex::RegexOptions<ECMAScriptFlags> flags)
+{
+    for (size_t i = 0; i < m_cached_regexes.size(); ++i) {
+        auto& cached_regex = m_cached_regexes[i];
+        if (cached_regex.flags.value() != flags.value() || cached_regex.pattern != pattern)
+            continue;
+
+        auto parser_result = cached_regex.parser_result;
+        if (i != m_cached_regexes.size() - 1)
+            m_cached_regexes.append(m_cached_regexes.take(i));
+        return parser_result;
+    }
+    return {};
+}
+
+void VM::cache_regex(ByteString pattern, regex::RegexOptions<ECMAScriptFlags> flags, regex::Parser::Result const& parser_result)
+{
+    if (m_cached_regexes.size() >= max_cached_regexes)
+        m_cached_regexes.take_first();
+
+    m_cached_regexes.append({
+        .pattern = move(pattern),
+        .flags = flags,
+        .parser_result = parser_result,
+    });
+}
+
 ThrowCompletionOr<void> VM::link_and_eval_module(Badge<Bytecode::Interpreter>, SourceTextModule& module)
 {
     return link_and_eval_module(module);
@@ -26,6 +26,7 @@
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/Value.h>
+#include <LibRegex/RegexParser.h>
 
 namespace JS {
 
@@ -75,6 +76,14 @@ public:
         return m_byte_string_cache;
     }
 
+    // Parse trees of large classic scripts, reused when the exact same source is parsed again.
+    RefPtr<Program> find_cached_program(StringView filename, StringView source_text, size_t line_number_offset) const;
+    void cache_program(StringView filename, size_t line_number_offset, NonnullRefPtr<Program>);
+
+    // Optimized regex programs, reused when a RegExp with the same pattern and flags is created again.
+    Optional<regex::Parser::Result> find_cached_regex(StringView pattern, regex::RegexOptions<ECMAScriptFlags>);
+    void cache_regex(ByteString pattern, regex::RegexOptions<ECMAScriptFlags>, regex::Parser::Result const&);
+
     PrimitiveString& empty_string() { return *m_empty_string; }
 
     PrimitiveString& single_ascii_character_string(u8 character)
@@ -266,6 +275,10 @@ public:
 
     void set_dynamic_imports_allowed(bool value) { m_dynamic_imports_allowed = value; }
 
+    // The [[CanBlock]] field of the Agent Record of the agent this VM is running.
+    bool agent_can_block() const { return m_agent_can_block; }
+    void set_agent_can_block(bool value) { m_agent_can_block = value; }
+
     Function<void(Promise&, Promise::RejectionOperation)> host_promise_rejection_tracker;
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, ReadonlySpan<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
@@ -329,6 +342,26 @@ private:
 
     Vector<StoredModule> m_loaded_modules;
 
+    struct CachedProgram {
+        ByteString filename;
+        size_t line_number_offset { 0 };
+        unsigned source_hash { 0 };
+        NonnullRefPtr<Program> program;
+    };
+
+    static constexpr size_t max_cached_programs = 16;
+    Vector<CachedProgram> m_cached_programs;
+
+    struct CachedRegex {
+        ByteString pattern;
+        regex::RegexOptions<ECMAScriptFlags> flags;
+        regex::Parser::Result parser_result;
+    };
+
+    // NOTE: Kept in least recently used order.
+    static constexpr size_t max_cached_regexes = 64;
+    Vector<CachedRegex> m_cached_regexes;
+
     WellKnownSymbols m_well_known_symbols;
 
     u32 m_execution_generation { 0 };
@@ -338,6 +371,7 @@ private:
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
     bool m_dynamic_imports_allowed { false };
+    bool m_agent_can_block { true };
 };
 
 template<typename GlobalObjectType, typename... Args>
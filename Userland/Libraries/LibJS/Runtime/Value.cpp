@@ -73,7 +73,7 @@ ALWAYS_INLINE bool both_bigint(Value const& lhs, Value const& rhs)
 
 // 6.1.6.1.20 Number::toString ( x ), https://tc39.es/ecma262/#sec-numeric-types-number-tostring
 // Implementation for radix = 10
-static void number_to_string_impl(StringBuilder& builder, double d, NumberToStringMode mode)
+void number_to_string(StringBuilder& builder, double d, NumberToStringMode mode)
 {
     auto convert_to_decimal_digits_array = [](auto x, auto& digits, auto& length) {
         for (; x; x /= 10)
@@ -208,14 +208,14 @@ static void number_to_string_impl(StringBuilder& builder, double d, NumberToStri
 String number_to_string(double d, NumberToStringMode mode)
 {
     StringBuilder builder;
-    number_to_string_impl(builder, d, mode);
+    number_to_string(builder, d, mode);
     return builder.to_string().release_value();
 }
 
 ByteString number_to_byte_string(double d, NumberToStringMode mode)
 {
     StringBuilder builder;
-    number_to_string_impl(builder, d, mode);
+    number_to_string(builder, d, mode);
     return builder.to_byte_string();
 }
 
@@ -889,6 +889,10 @@ ThrowCompletionOr<PropertyKey> Value::to_property_key(VM& vm) const
     if (is_int32() && as_i32() >= 0)
         return PropertyKey { as_i32() };
 
+    // OPTIMIZATION: Strings are already primitive, and keep their interned property key string around.
+    if (is_string())
+        return PropertyKey { as_string().to_deprecated_fly_string() };
+
     // 1. Let key be ? ToPrimitive(argument, string).
     auto key = TRY(to_primitive(vm, PreferredType::String));
 
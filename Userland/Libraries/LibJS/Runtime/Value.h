@@ -588,6 +588,7 @@ enum class NumberToStringMode {
 };
 [[nodiscard]] String number_to_string(double, NumberToStringMode = NumberToStringMode::WithExponent);
 [[nodiscard]] ByteString number_to_byte_string(double, NumberToStringMode = NumberToStringMode::WithExponent);
+void number_to_string(StringBuilder&, double, NumberToStringMode = NumberToStringMode::WithExponent);
 double string_to_number(StringView);
 
 inline bool Value::operator==(Value const& value) const { return same_value(*this, value); }
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/SamplingProfiler.h>
+#include <LibThreading/Thread.h>
+#include <unistd.h>
+
+namespace JS {
+
+ErrorOr<NonnullOwnPtr<SamplingProfiler>> SamplingProfiler::start(VM& vm, AK::Duration sampling_interval)
+{
+    auto& interpreter = vm.bytecode_interpreter();
+    if (interpreter.sampling_profiler())
+        return AK::Error::from_string_literal("A profiler is already running");
+
+    auto profiler = TRY(adopt_nonnull_own_or_enomem(new (nothrow) SamplingProfiler(vm, sampling_interval)));
+
+    profiler->m_thread = TRY(Threading::Thread::try_create([&profiler = *profiler]() -> intptr_t {
+        auto& interpreter = profiler.m_vm.bytecode_interpreter();
+
+        while (!profiler.m_should_stop.load(AK::MemoryOrder::memory_order_relaxed)) {
+            usleep(static_cast<useconds_t>(profiler.m_sampling_interval.to_microseconds()));
+            interpreter.request_sample();
+        }
+
+        return 0;
+    },
+        "JS Profiler"sv));
+
+    interpreter.set_sampling_profiler({}, profiler.ptr());
+    profiler->m_start_time = MonotonicTime::now();
+    profiler->m_thread->start();
+
+    return profiler;
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration sampling_interval)
+    : m_vm(vm)
+    , m_sampling_interval(sampling_interval)
+{
+    // The root of the call tree.
+    m_frames.append({ .function_name = "(root)", .url = {} });
+    m_nodes.append({ .frame_index = 0 });
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!m_thread)
+        return;
+
+    m_should_stop.store(true, AK::MemoryOrder::memory_order_relaxed);
+    (void)m_thread->join();
+    m_thread = nullptr;
+
+    m_end_time = MonotonicTime::now();
+    m_vm.bytecode_interpreter().set_sampling_profiler({}, nullptr);
+}
+
+size_t SamplingProfiler::frame_index_for(ExecutionContext const& context)
+{
+    FrameKey key;
+    if (context.function_name)
+        key.function_name = context.function_name->byte_string();
+
+    // Functions are told apart by where they start, native functions and top-level code only by their name and source.
+    UnrealizedSourceRange source_range;
+    if (context.function && is<ECMAScriptFunctionObject>(*context.function))
+        source_range = static_cast<ECMAScriptFunctionObject const&>(*context.function).ecmascript_code().unrealized_source_range();
+    else if (context.executable)
+        source_range = { context.executable->source_code, 0, 0 };
+
+    key.source_code = source_range.source_code.ptr();
+    key.offset = source_range.start_offset;
+
+    if (auto frame_index = m_frame_indices.get(key); frame_index.has_value())
+        return *frame_index;
+
+    CallFrame frame;
+    frame.function_name = key.function_name.is_empty() ? "(anonymous)" : key.function_name;
+
+    if (source_range.source_code) {
+        auto realized_source_range = source_range.realize();
+        frame.url = realized_source_range.filename();
+        frame.line = realized_source_range.start.line;
+        frame.column = realized_source_range.start.column;
+
+        m_source_codes.append(*source_range.source_code);
+    }
+
+    auto frame_index = m_frames.size();
+    m_frames.append(move(frame));
+    m_frame_indices.set(move(key), frame_index);
+
+    return frame_index;
+}
+
+size_t SamplingProfiler::child_node_index(size_t parent_index, size_t frame_index)
+{
+    for (auto child_index : m_nodes[parent_index].children) {
+        if (m_nodes[child_index].frame_index == frame_index)
+            return child_index;
+    }
+
+    auto child_index = m_nodes.size();
+    m_nodes.append({ .frame_index = frame_index });
+    m_nodes[parent_index].children.append(child_index);
+
+    return child_index;
+}
+
+void SamplingProfiler::take_sample(Optional<size_t> program_counter)
+{
+    auto const& execution_context_stack = m_vm.execution_context_stack();
+    if (execution_context_stack.is_empty())
+        return;
+
+    size_t node_index = 0;
+    ++m_nodes[node_index].total_samples;
+
+    for (auto const* context : execution_context_stack) {
+        node_index = child_node_index(node_index, frame_index_for(*context));
+        ++m_nodes[node_index].total_samples;
+    }
+
+    auto& leaf = m_nodes[node_index];
+    ++leaf.self_samples;
+
+    auto const& running_context = *execution_context_stack.last();
+    if (running_context.executable && program_counter.has_value()) {
+        if (auto source_range = running_context.executable->source_range_at(*program_counter); source_range.source_code)
+            ++leaf.self_samples_per_line.ensure(source_range.realize().start.line, [] { return 0; });
+    }
+
+    m_samples.append({ .node_index = node_index, .time = MonotonicTime::now() });
+}
+
+// https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+JsonObject SamplingProfiler::to_cpuprofile() const
+{
+    // Node IDs have to be positive, so they are the node indices plus one.
+    auto node_id = [](size_t node_index) { return node_index + 1; };
+    auto microseconds = [](MonotonicTime time) { return time.nanoseconds() / 1000; };
+
+    HashMap<ByteString, size_t> script_ids;
+
+    JsonArray nodes;
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+        auto const& frame = m_frames[node.frame_index];
+
+        size_t script_id = 0;
+        if (!frame.url.is_empty()) {
+            auto next_script_id = script_ids.size() + 1;
+            script_id = script_ids.ensure(frame.url, [&] { return next_script_id; });
+        }
+
+        // Lines and columns are 0-based in this format.
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, frame.function_name);
+        call_frame.set("scriptId"sv, ByteString::number(script_id));
+        call_frame.set("url"sv, frame.url);
+        call_frame.set("lineNumber"sv, static_cast<i64>(frame.line) - 1);
+        call_frame.set("columnNumber"sv, static_cast<i64>(frame.column) - 1);
+
+        JsonArray children;
+        for (auto child_index : node.children)
+            children.must_append(node_id(child_index));
+
+        JsonArray position_ticks;
+        for (auto const& [line, ticks] : node.self_samples_per_line) {
+            JsonObject position_tick;
+            position_tick.set("line"sv, line);
+            position_tick.set("ticks"sv, ticks);
+            position_ticks.must_append(move(position_tick));
+        }
+
+        JsonObject json_node;
+        json_node.set("id"sv, node_id(node_index));
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.self_samples);
+        json_node.set("children"sv, move(children));
+        if (!position_ticks.is_empty())
+            json_node.set("positionTicks"sv, move(position_ticks));
+
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+
+    auto previous_time = microseconds(m_start_time);
+    for (auto const& sample : m_samples) {
+        samples.must_append(node_id(sample.node_index));
+
+        auto time = microseconds(sample.time);
+        time_deltas.must_append(time - previous_time);
+        previous_time = time;
+    }
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, microseconds(m_start_time));
+    profile.set("endTime"sv, microseconds(m_thread ? MonotonicTime::now() : m_end_time));
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+
+    return profile;
+}
+
+}
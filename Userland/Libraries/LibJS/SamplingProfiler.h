@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/SourceCode.h>
+
+namespace Threading {
+class Thread;
+}
+
+namespace JS {
+
+// A sampling CPU profiler for JavaScript.
+//
+// While a profiler is running, a background thread periodically asks the bytecode interpreter for a sample. The
+// interpreter takes it at the next safe point (a function entry or a jump), by walking the execution context stack.
+// Samples are aggregated into a call tree right away, which can be exported in the .cpuprofile format used by the
+// Chrome DevTools and most other JavaScript profile viewers.
+class SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr auto default_sampling_interval = AK::Duration::from_microseconds(500);
+
+    struct CallFrame {
+        ByteString function_name;
+        ByteString url;
+
+        // 1-based, or 0 if the frame has no source (e.g. a native function).
+        size_t line { 0 };
+        size_t column { 0 };
+    };
+
+    struct Node {
+        size_t frame_index { 0 };
+        Vector<size_t> children;
+
+        size_t self_samples { 0 };
+        size_t total_samples { 0 };
+
+        // Self samples per 1-based source line, when known.
+        HashMap<size_t, size_t> self_samples_per_line;
+    };
+
+    // Only one profiler can be running per VM at a time.
+    static ErrorOr<NonnullOwnPtr<SamplingProfiler>> start(VM&, AK::Duration sampling_interval = default_sampling_interval);
+    ~SamplingProfiler();
+
+    void stop();
+    bool is_running() const { return m_thread; }
+
+    // Called by the interpreter with the program counter of the running execution context, if any.
+    void take_sample(Optional<size_t> program_counter);
+
+    Vector<CallFrame> const& frames() const { return m_frames; }
+
+    // The first node is the root of the call tree, and doesn't correspond to any frame.
+    Vector<Node> const& nodes() const { return m_nodes; }
+
+    size_t sample_count() const { return m_samples.size(); }
+    AK::Duration duration() const { return m_end_time - m_start_time; }
+
+    JsonObject to_cpuprofile() const;
+
+private:
+    SamplingProfiler(VM&, AK::Duration sampling_interval);
+
+    struct FrameKey {
+        SourceCode const* source_code { nullptr };
+        u32 offset { 0 };
+        ByteString function_name;
+
+        bool operator==(FrameKey const&) const = default;
+    };
+    struct FrameKeyTraits : public DefaultTraits<FrameKey> {
+        static unsigned hash(FrameKey const& key) { return pair_int_hash(pair_int_hash(ptr_hash(key.source_code), key.offset), key.function_name.hash()); }
+    };
+
+    size_t frame_index_for(ExecutionContext const&);
+    size_t child_node_index(size_t parent_index, size_t frame_index);
+
+    VM& m_vm;
+    AK::Duration m_sampling_interval;
+
+    RefPtr<Threading::Thread> m_thread;
+    Atomic<bool> m_should_stop { false };
+
+    MonotonicTime m_start_time { MonotonicTime::now() };
+    MonotonicTime m_end_time { MonotonicTime::now() };
+
+    Vector<CallFrame> m_frames;
+    HashMap<FrameKey, size_t, FrameKeyTraits> m_frame_indices;
+
+    // Keeps the source code of all frames alive, so that their addresses can't be reused by another source.
+    Vector<NonnullRefPtr<SourceCode const>> m_source_codes;
+
+    Vector<Node> m_nodes;
+
+    struct Sample {
+        size_t node_index { 0 };
+        MonotonicTime time;
+    };
+    Vector<Sample> m_samples;
+};
+
+}
@@ -14,9 +14,36 @@ namespace JS {
 
 JS_DEFINE_ALLOCATOR(Script);
 
+// Scripts this large are typically framework bundles that get loaded again on every navigation.
+static constexpr size_t minimum_source_length_for_program_caching = 64 * KiB;
+
+static bool can_share_program_between_realms(Program const& program)
+{
+    // NOTE: GlobalDeclarationInstantiation decides whether Annex B function hoisting applies to
+    //       top-level blocks based on the state of the global environment, and records that in the AST.
+    if (program.is_strict_mode())
+        return true;
+    bool has_annex_b_function_declarations = false;
+    MUST(program.for_each_function_hoistable_with_annexB_extension([&](auto&) -> ThrowCompletionOr<void> {
+        has_annex_b_function_declarations = true;
+        return {};
+    }));
+    return !has_annex_b_function_declarations;
+}
+
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    auto& vm = realm.vm();
+    auto should_cache_program = source_text.length() >= minimum_source_length_for_program_caching;
+
+    // NOTE: Parsing the exact same source again would produce an identical parse tree, so we reuse the cached one.
+    //       Function bodies that were already compiled keep their bytecode executable on the AST as well.
+    if (should_cache_program) {
+        if (auto program = vm.find_cached_program(filename, source_text, line_number_offset))
+            return realm.heap().allocate_without_realm<Script>(realm, filename, program.release_nonnull(), host_defined);
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +52,9 @@ Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView sourc
     if (parser.has_errors())
         return parser.errors();
 
+    if (should_cache_program && can_share_program_between_realms(*script))
+        vm.cache_program(filename, line_number_offset, script);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
 }
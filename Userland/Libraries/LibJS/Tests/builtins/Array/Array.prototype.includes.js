@@ -26,3 +26,18 @@ test("is unscopable", () => {
         }).toThrowWithMessage(ReferenceError, "'includes' is not defined");
     }
 });
+
+test("numeric arrays", () => {
+    var integers = [1, 2, 3];
+    expect(integers.includes(3)).toBeTrue();
+    expect(integers.includes(3.0)).toBeTrue();
+    expect(integers.includes(-0)).toBeFalse();
+    expect(integers.includes(NaN)).toBeFalse();
+    expect(integers.includes("3")).toBeFalse();
+
+    var doubles = [0.5, -0, NaN];
+    expect(doubles.includes(0)).toBeTrue();
+    expect(doubles.includes(NaN)).toBeTrue();
+    expect(doubles.includes(NaN, -1)).toBeTrue();
+    expect(doubles.includes(0.5, 1)).toBeFalse();
+});
@@ -23,3 +23,32 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("numeric arrays", () => {
+    var integers = [1, 2, 3, 2, 1];
+    expect(integers.indexOf(2)).toBe(1);
+    expect(integers.indexOf(2.0)).toBe(1);
+    expect(integers.indexOf(2.5)).toBe(-1);
+    expect(integers.indexOf("2")).toBe(-1);
+    expect(integers.indexOf(NaN)).toBe(-1);
+    expect(integers.indexOf(1, 1)).toBe(4);
+
+    var doubles = [0.5, -0, NaN, 1.5, 2];
+    expect(doubles.indexOf(0)).toBe(1);
+    expect(doubles.indexOf(-0)).toBe(1);
+    expect(doubles.indexOf(NaN)).toBe(-1);
+    expect(doubles.indexOf(2)).toBe(4);
+    expect(doubles.indexOf(1.5, -1)).toBe(-1);
+});
+
+test("holes are looked up on the prototype", () => {
+    var array = [1, , 3];
+    Array.prototype[1] = 2;
+    try {
+        expect(array.indexOf(2)).toBe(1);
+    } finally {
+        delete Array.prototype[1];
+    }
+    expect(array.indexOf(2)).toBe(-1);
+    expect(array.indexOf(undefined)).toBe(-1);
+});
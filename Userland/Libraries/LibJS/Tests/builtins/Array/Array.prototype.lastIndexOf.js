@@ -20,3 +20,17 @@ test("basic functionality", () => {
     expect([undefined].lastIndexOf()).toBe(0);
     expect([undefined, undefined, undefined].lastIndexOf()).toBe(2);
 });
+
+test("numeric arrays", () => {
+    var integers = [1, 2, 3, 2, 1];
+    expect(integers.lastIndexOf(2)).toBe(3);
+    expect(integers.lastIndexOf(2, 2)).toBe(1);
+    expect(integers.lastIndexOf(1, 0)).toBe(0);
+    expect(integers.lastIndexOf(1.5)).toBe(-1);
+
+    var doubles = [0, 1.5, -0, NaN];
+    expect(doubles.lastIndexOf(0)).toBe(2);
+    expect(doubles.lastIndexOf(NaN)).toBe(-1);
+    expect(doubles.lastIndexOf(1.5, -3)).toBe(1);
+    expect(doubles.lastIndexOf(1.5, -4)).toBe(-1);
+});
@@ -56,4 +56,14 @@ test("basic functionality", () => {
         const waiters = Atomics.notify(typedArray, 0, 0);
         expect(waiters).toBe(0);
     });
+
+    test("no waiters", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+        expect(Atomics.notify(typedArray, 1, 1)).toBe(0);
+
+        const bigIntArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        expect(Atomics.notify(bigIntArray, 3, Infinity)).toBe(0);
+    });
 });
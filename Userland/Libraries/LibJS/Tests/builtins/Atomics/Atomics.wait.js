@@ -73,4 +73,32 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value not equal", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[1] = 42;
+
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+        expect(Atomics.wait(typedArray, 1, 41)).toBe("not-equal");
+
+        const bigIntArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        bigIntArray[2] = 42n;
+        expect(Atomics.wait(bigIntArray, 2, 0n, 0)).toBe("not-equal");
+    });
+
+    test("timed out", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 0, 0, -Infinity)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 3, 0, 5)).toBe("timed-out");
+
+        const bigIntArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(bigIntArray, 0, 0n, 0)).toBe("timed-out");
+
+        // A timed out waiter must not remain registered with its waiter list.
+        expect(Atomics.notify(typedArray, 3)).toBe(0);
+    });
 });
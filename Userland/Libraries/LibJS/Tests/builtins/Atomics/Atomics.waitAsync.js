@@ -73,4 +73,23 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.waitAsync).toHaveLength(4);
     });
+
+    test("value not equal", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[0] = 42;
+
+        const result = Atomics.waitAsync(typedArray, 0, 0, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("not-equal");
+    });
+
+    test("immediate timeout", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        const result = Atomics.waitAsync(typedArray, 0, 0, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("timed-out");
+    });
 });
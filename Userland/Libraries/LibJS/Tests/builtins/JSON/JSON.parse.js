@@ -74,3 +74,51 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("strings with escapes", () => {
+    expect(JSON.parse('"a\\"b\\\\c\\/d"')).toBe('a"b\\c/d');
+    expect(JSON.parse('"\\b\\f\\n\\r\\t"')).toBe("\b\f\n\r\t");
+    expect(JSON.parse('"\\u0041\\u00e9"')).toBe("Aé");
+    expect(JSON.parse('"\\ud834\\udd1e"')).toBe("𝄞");
+    expect(JSON.parse('"a long string without any escapes, followed by one\\n"')).toBe(
+        "a long string without any escapes, followed by one\n"
+    );
+
+    ['"\\x41"', '"\\u004"', '"unterminated', '"tab\tinside"', '"\\'].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
+
+test("numbers", () => {
+    expect(JSON.parse("0")).toBe(0);
+    expect(JSON.parse("-12")).toBe(-12);
+    expect(JSON.parse("1.5e3")).toBe(1500);
+    expect(JSON.parse("2E-2")).toBe(0.02);
+    expect(JSON.parse("123456789012345678901234567890")).toBe(123456789012345678901234567890);
+
+    ["01", "-", "1.", ".5", "1e", "1e+", "+1", "0x10"].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
+
+test("objects and arrays", () => {
+    const object = JSON.parse('{"a": [1, {"b": null}], "1": true, "a": "again"}');
+    expect(Object.keys(object)).toEqual(["1", "a"]);
+    expect(object.a).toBe("again");
+    expect(object[1]).toBeTrue();
+
+    const array = JSON.parse(' [ [ ] , { } , "x" ] ');
+    expect(array).toHaveLength(3);
+    expect(array[0]).toEqual([]);
+    expect(array[1]).toEqual({});
+
+    ["[", "{", '{"a" 1}', '{"a":1 "b":2}', "[1 2]", "tru", "nul", "[] []"].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
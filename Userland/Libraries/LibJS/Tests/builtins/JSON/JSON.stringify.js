@@ -64,6 +64,41 @@ describe("correct behavior", () => {
         expect(JSON.stringify(o)).toBe('{"foo":"bar"}');
     });
 
+    test("property order and values are read at the right time", () => {
+        const object = { 2: "two", b: 1, 1: "one", a: 2 };
+        expect(JSON.stringify(object)).toBe('{"1":"one","2":"two","b":1,"a":2}');
+
+        const mutated = {
+            get first() {
+                delete this.second;
+                this.third = 3;
+                return 1;
+            },
+            second: 2,
+        };
+        expect(JSON.stringify(mutated)).toBe('{"first":1}');
+
+        Array.prototype[1] = "from prototype";
+        try {
+            expect(JSON.stringify([0, , 2])).toBe('[0,"from prototype",2]');
+        } finally {
+            delete Array.prototype[1];
+        }
+        expect(JSON.stringify([0, , 2])).toBe("[0,null,2]");
+    });
+
+    test("strings and numbers", () => {
+        expect(JSON.stringify("plain ascii text that is long enough")).toBe('"plain ascii text that is long enough"');
+        expect(JSON.stringify('needs "escaping"\n and ünïcode')).toBe('"needs \\"escaping\\"\\n and ünïcode"');
+        expect(JSON.stringify([1, -0, 1.5, -1e21, NaN, Infinity])).toBe("[1,0,1.5,-1e+21,null,null]");
+    });
+
+    test("undefined values with gap", () => {
+        expect(JSON.stringify({ a: undefined, b: 1, c: () => {} }, null, 2)).toBe('{\n  "b": 1\n}');
+        expect(JSON.stringify({ a: undefined }, null, 2)).toBe("{}");
+        expect(JSON.stringify([undefined], null, 2)).toBe("[\n  null\n]");
+    });
+
     test("escape surrogate codepoints in strings", () => {
         expect(JSON.stringify("\ud83d\ude04")).toBe('"😄"');
         expect(JSON.stringify("\ud83d")).toBe('"\\ud83d"');
@@ -66,3 +66,19 @@ test("Incorrectly escaped code units not converted to invalid patterns", () => {
     expect(re.test("⫀")).toBeTrue();
     expect(re.test("\\u2abe")).toBeFalse(); // ⫀ is \u2abe
 });
+
+test("regexps with the same pattern and flags don't share state", () => {
+    const first = new RegExp("a(b)", "g");
+    const second = new RegExp("a(b)", "g");
+    expect(first.exec("ab ab").index).toBe(0);
+    expect(first.lastIndex).toBe(2);
+    expect(second.lastIndex).toBe(0);
+    expect(second.exec("xab")[1]).toBe("b");
+    expect(first.exec("ab ab").index).toBe(3);
+
+    // Same pattern, different flags.
+    expect(new RegExp("a", "i").test("A")).toBeTrue();
+    expect(new RegExp("a").test("A")).toBeFalse();
+    expect(/a/i.test("A")).toBeTrue();
+    expect(/a/.test("A")).toBeFalse();
+});
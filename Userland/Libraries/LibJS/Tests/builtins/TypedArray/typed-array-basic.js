@@ -84,3 +84,39 @@ test("basic Int32Array", () => {
     a[0]++;
     expect(a[0]).toBe(-0x80000000);
 });
+
+test("basic Float32Array", () => {
+    var a = new Float32Array(2);
+    expect(typeof a).toBe("object");
+    expect(a instanceof Float32Array).toBe(true);
+    expect(a.length).toBe(2);
+    a[0] = 1;
+    expect(a[0]).toBe(1);
+    a[0] = 0.5;
+    expect(a[0]).toBe(0.5);
+    a[0] = 0.1;
+    expect(a[0]).toBe(Math.fround(0.1));
+    a[1] = -0;
+    expect(Object.is(a[1], -0)).toBeTrue();
+    a[1] = NaN;
+    expect(a[1]).toBeNaN();
+    a[2] = 1;
+    expect(a[2]).toBeUndefined();
+});
+
+test("basic Float64Array", () => {
+    var a = new Float64Array(2);
+    expect(typeof a).toBe("object");
+    expect(a instanceof Float64Array).toBe(true);
+    expect(a.length).toBe(2);
+    a[0] = 1;
+    expect(a[0]).toBe(1);
+    a[0] = 0.1;
+    expect(a[0]).toBe(0.1);
+    a[0] += 0.2;
+    expect(a[0]).toBe(0.1 + 0.2);
+    a[1] = -Infinity;
+    expect(a[1]).toBe(-Infinity);
+    a[2] = 1;
+    expect(a[2]).toBeUndefined();
+});
@@ -28,3 +28,20 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+test("length of concatenated strings", () => {
+    var string = "";
+    for (var i = 0; i < 100; ++i) {
+        string += "ab" + i;
+        expect(string.length).toBe(string.split("").length);
+    }
+    expect(("\ud834" + "\udf06").length).toBe(2);
+    expect(("𝌆" + "a" + "é").length).toBe(4);
+
+    var key = "pro" + "perty";
+    var object = { property: 42 };
+    expect(object[key]).toBe(42);
+    expect(object[key]).toBe(42);
+    object[key] = 43;
+    expect(object.property).toBe(43);
+});
@@ -5,6 +5,7 @@
  */
 
 #include "FFmpegLoader.h"
+#include <AK/Array.h>
 #include <AK/BitStream.h>
 #include <AK/NumericLimits.h>
 #include <LibCore/System.h>
@@ -202,55 +203,47 @@ static ErrorOr<FixedArray<Sample>> extract_samples_from_frame(AVFrame& frame)
     size_t number_of_channels = frame.channels;
 #endif
     auto format = static_cast<AVSampleFormat>(frame.format);
-    auto packed_format = av_get_packed_sample_fmt(format);
     auto is_planar = av_sample_fmt_is_planar(format) == 1;
 
     // FIXME: handle number_of_channels > 2
     if (number_of_channels != 1 && number_of_channels != 2)
         return Error::from_string_view("Unsupported number of channels"sv);
 
-    switch (format) {
-    case AV_SAMPLE_FMT_FLTP:
+    PcmSampleFormat pcm_format;
+    switch (av_get_packed_sample_fmt(format)) {
+    case AV_SAMPLE_FMT_U8:
+        pcm_format = PcmSampleFormat::Uint8;
+        break;
     case AV_SAMPLE_FMT_S16:
+        pcm_format = PcmSampleFormat::Int16;
+        break;
     case AV_SAMPLE_FMT_S32:
+        pcm_format = PcmSampleFormat::Int32;
+        break;
+    case AV_SAMPLE_FMT_FLT:
+        pcm_format = PcmSampleFormat::Float32;
+        break;
+    case AV_SAMPLE_FMT_DBL:
+        pcm_format = PcmSampleFormat::Float64;
         break;
     default:
         // FIXME: handle other formats
         return Error::from_string_view("Unsupported sample format"sv);
     }
 
-    auto get_plane_pointer = [&](size_t channel_index) -> uint8_t* {
-        return is_planar ? frame.extended_data[channel_index] : frame.extended_data[0];
-    };
-    auto index_in_plane = [&](size_t sample_index, size_t channel_index) {
-        if (is_planar)
-            return sample_index;
-        return sample_index * number_of_channels + channel_index;
-    };
-    auto read_sample = [&](uint8_t* data, size_t index) -> float {
-        switch (packed_format) {
-        case AV_SAMPLE_FMT_FLT:
-            return reinterpret_cast<float*>(data)[index];
-        case AV_SAMPLE_FMT_S16:
-            return reinterpret_cast<i16*>(data)[index] / static_cast<float>(NumericLimits<i16>::max());
-        case AV_SAMPLE_FMT_S32:
-            return reinterpret_cast<i32*>(data)[index] / static_cast<float>(NumericLimits<i32>::max());
-        default:
-            VERIFY_NOT_REACHED();
-        }
-    };
-
+    auto bytes_per_sample = static_cast<size_t>(av_get_bytes_per_sample(format));
     auto samples = TRY(FixedArray<Sample>::create(number_of_samples));
-    for (size_t sample = 0; sample < number_of_samples; ++sample) {
-        if (number_of_channels == 1) {
-            samples.unchecked_at(sample) = Sample { read_sample(get_plane_pointer(0), index_in_plane(sample, 0)) };
-        } else {
-            samples.unchecked_at(sample) = Sample {
-                read_sample(get_plane_pointer(0), index_in_plane(sample, 0)),
-                read_sample(get_plane_pointer(1), index_in_plane(sample, 1)),
-            };
-        }
+
+    if (is_planar) {
+        Array<ReadonlyBytes, 2> planes;
+        for (size_t channel = 0; channel < number_of_channels; ++channel)
+            planes[channel] = { frame.extended_data[channel], number_of_samples * bytes_per_sample };
+        convert_planar_pcm_to_samples(pcm_format, planes.span().trim(number_of_channels), samples.span());
+    } else {
+        ReadonlyBytes data { frame.extended_data[0], number_of_samples * number_of_channels * bytes_per_sample };
+        convert_interleaved_pcm_to_samples(pcm_format, number_of_channels, data, samples.span());
     }
+
     return samples;
 }
 
@@ -23,6 +23,29 @@ enum class OutputState {
     Suspended,
 };
 
+// How a stream should trade off latency against its resilience to underruns.
+enum class LatencyHint : u8 {
+    // As low as can reasonably be done without glitching, for games or calls.
+    Interactive,
+    Balanced,
+    // Large buffers that can survive the audio thread being starved for a while, for media playback.
+    Playback,
+};
+
+// Returns a target latency for PlaybackStream::create() that the backends will turn into their buffer sizes.
+constexpr u32 target_latency_ms_for_hint(LatencyHint hint)
+{
+    switch (hint) {
+    case LatencyHint::Interactive:
+        return 10;
+    case LatencyHint::Balanced:
+        return 40;
+    case LatencyHint::Playback:
+        return 100;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 // This class implements high-level audio playback behavior. It is primarily intended as an abstract cross-platform
 // interface to be used by Ladybird (and its dependent libraries) for playback.
 //
@@ -66,6 +89,17 @@ public:
     // This function should be able to run from any thread safely.
     virtual ErrorOr<AK::Duration> total_time_played() = 0;
 
+    // Returns the time it takes for audio data provided by the data request callback to reach the output device, as
+    // reported by the backend. This may differ from the latency that was requested when creating the stream.
+    //
+    // This function should be able to run from any thread safely.
+    virtual ErrorOr<AK::Duration> output_latency() = 0;
+
+    // Returns the number of times the output has run out of data to play.
+    //
+    // This function should be able to run from any thread safely.
+    virtual u64 underrun_count() = 0;
+
     virtual NonnullRefPtr<Core::ThreadedPromise<void>> set_volume(double volume) = 0;
 };
 
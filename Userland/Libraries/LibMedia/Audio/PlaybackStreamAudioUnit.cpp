@@ -12,6 +12,7 @@
 #include <LibCore/ThreadedPromise.h>
 
 #include <AudioUnit/AudioUnit.h>
+#include <CoreAudio/AudioHardware.h>
 
 namespace Audio {
 
@@ -69,7 +70,7 @@ class AudioState : public RefCounted<AudioState> {
 public:
     using AudioTaskQueue = Core::SharedSingleProducerCircularQueue<AudioTask>;
 
-    static ErrorOr<NonnullRefPtr<AudioState>> create(AudioStreamBasicDescription description, PlaybackStream::AudioDataRequestCallback data_request_callback, OutputState initial_output_state)
+    static ErrorOr<NonnullRefPtr<AudioState>> create(AudioStreamBasicDescription description, u32 target_latency_ms, PlaybackStream::AudioDataRequestCallback data_request_callback, OutputState initial_output_state)
     {
         auto task_queue = TRY(AudioTaskQueue::create());
         auto state = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) AudioState(description, move(task_queue), move(data_request_callback), initial_output_state)));
@@ -104,6 +105,12 @@ public:
             &callbackStruct,
             sizeof(callbackStruct)));
 
+        // The device's I/O buffer size determines how much audio we have to provide ahead of time. The device may
+        // not accept the size we ask for, so a failure here isn't fatal.
+        UInt32 buffer_frame_size = max(1u, static_cast<UInt32>(target_latency_ms * description.mSampleRate / 1000));
+        if (auto error = AudioUnitSetProperty(state->m_audio_unit, kAudioDevicePropertyBufferFrameSize, kAudioUnitScope_Global, AUDIO_UNIT_OUTPUT_BUS, &buffer_frame_size, sizeof(buffer_frame_size)); error != noErr)
+            log_os_error_code(error);
+
         AU_TRY(AudioUnitInitialize(state->m_audio_unit));
         AU_TRY(AudioOutputUnitStart(state->m_audio_unit));
 
@@ -128,6 +135,25 @@ public:
         return AK::Duration::from_milliseconds(m_last_sample_time.load());
     }
 
+    ErrorOr<AK::Duration> latency() const
+    {
+        UInt32 buffer_frame_size = 0;
+        UInt32 size = sizeof(buffer_frame_size);
+        AU_TRY(AudioUnitGetProperty(m_audio_unit, kAudioDevicePropertyBufferFrameSize, kAudioUnitScope_Global, AUDIO_UNIT_OUTPUT_BUS, &buffer_frame_size, &size));
+
+        Float64 unit_latency_seconds = 0;
+        size = sizeof(unit_latency_seconds);
+        AU_TRY(AudioUnitGetProperty(m_audio_unit, kAudioUnitProperty_Latency, kAudioUnitScope_Global, AUDIO_UNIT_OUTPUT_BUS, &unit_latency_seconds, &size));
+
+        auto latency_seconds = unit_latency_seconds + (buffer_frame_size / m_description.mSampleRate);
+        return AK::Duration::from_microseconds(static_cast<i64>(latency_seconds * 1'000'000));
+    }
+
+    u64 underrun_count() const
+    {
+        return m_underrun_count.load(AK::MemoryOrder::memory_order_relaxed);
+    }
+
 private:
     AudioState(AudioStreamBasicDescription description, AudioTaskQueue task_queue, PlaybackStream::AudioDataRequestCallback data_request_callback, OutputState initial_output_state)
         : m_description(description)
@@ -190,6 +216,8 @@ private:
         if (state.m_paused == Paused::No) {
             auto written_bytes = state.m_data_request_callback(output_buffer, PcmSampleFormat::Float32, frames_to_render);
 
+            if (written_bytes.size() < output_buffer.size())
+                state.m_underrun_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
             if (written_bytes.is_empty())
                 state.m_paused = Paused::Yes;
         }
@@ -213,9 +241,10 @@ private:
 
     PlaybackStream::AudioDataRequestCallback m_data_request_callback;
     Atomic<i64> m_last_sample_time { 0 };
+    Atomic<u64> m_underrun_count { 0 };
 };
 
-ErrorOr<NonnullRefPtr<PlaybackStream>> PlaybackStreamAudioUnit::create(OutputState initial_output_state, u32 sample_rate, u8 channels, u32, AudioDataRequestCallback&& data_request_callback)
+ErrorOr<NonnullRefPtr<PlaybackStream>> PlaybackStreamAudioUnit::create(OutputState initial_output_state, u32 sample_rate, u8 channels, u32 target_latency_ms, AudioDataRequestCallback&& data_request_callback)
 {
     AudioStreamBasicDescription description {};
     description.mFormatID = kAudioFormatLinearPCM;
@@ -227,7 +256,7 @@ ErrorOr<NonnullRefPtr<PlaybackStream>> PlaybackStreamAudioUnit::create(OutputSta
     description.mBytesPerPacket = description.mBytesPerFrame;
     description.mFramesPerPacket = 1;
 
-    auto state = TRY(AudioState::create(description, move(data_request_callback), initial_output_state));
+    auto state = TRY(AudioState::create(description, target_latency_ms, move(data_request_callback), initial_output_state));
     return TRY(adopt_nonnull_ref_or_enomem(new (nothrow) PlaybackStreamAudioUnit(move(state))));
 }
 
@@ -281,6 +310,16 @@ ErrorOr<AK::Duration> PlaybackStreamAudioUnit::total_time_played()
     return m_state->last_sample_time();
 }
 
+ErrorOr<AK::Duration> PlaybackStreamAudioUnit::output_latency()
+{
+    return m_state->latency();
+}
+
+u64 PlaybackStreamAudioUnit::underrun_count()
+{
+    return m_state->underrun_count();
+}
+
 NonnullRefPtr<Core::ThreadedPromise<void>> PlaybackStreamAudioUnit::set_volume(double volume)
 {
     auto promise = Core::ThreadedPromise<void>::create();
@@ -26,6 +26,8 @@ public:
     virtual NonnullRefPtr<Core::ThreadedPromise<void>> discard_buffer_and_suspend() override;
 
     virtual ErrorOr<AK::Duration> total_time_played() override;
+    virtual ErrorOr<AK::Duration> output_latency() override;
+    virtual u64 underrun_count() override;
 
     virtual NonnullRefPtr<Core::ThreadedPromise<void>> set_volume(double) override;
 
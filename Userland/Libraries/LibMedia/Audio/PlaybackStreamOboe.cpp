@@ -24,6 +24,8 @@ public:
             static_cast<size_t>(numFrames * oboeStream->getChannelCount() * sizeof(float))
         };
         auto written_bytes = m_data_request_callback(output_buffer, PcmSampleFormat::Float32, numFrames);
+        if (written_bytes.size() < output_buffer.size())
+            m_underrun_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
         if (written_bytes.is_empty())
             return oboe::DataCallbackResult::Stop;
 
@@ -57,12 +59,17 @@ public:
     {
         m_volume.store(volume);
     }
+    u64 underrun_count() const
+    {
+        return m_underrun_count.load(AK::MemoryOrder::memory_order_relaxed);
+    }
 
 private:
     PlaybackStream::AudioDataRequestCallback m_data_request_callback;
     Atomic<i64> m_last_sample_time { 0 };
     size_t m_number_of_samples_enqueued { 0 };
     Atomic<float> m_volume { 1.0 };
+    Atomic<u64> m_underrun_count { 0 };
 };
 
 class PlaybackStreamOboe::Storage : public RefCounted<PlaybackStreamOboe::Storage> {
@@ -85,7 +92,7 @@ PlaybackStreamOboe::PlaybackStreamOboe(NonnullRefPtr<Storage> storage)
 {
 }
 
-ErrorOr<NonnullRefPtr<PlaybackStream>> PlaybackStreamOboe::create(OutputState initial_output_state, u32 sample_rate, u8 channels, u32, AudioDataRequestCallback&& data_request_callback)
+ErrorOr<NonnullRefPtr<PlaybackStream>> PlaybackStreamOboe::create(OutputState initial_output_state, u32 sample_rate, u8 channels, u32 target_latency_ms, AudioDataRequestCallback&& data_request_callback)
 {
     std::shared_ptr<oboe::AudioStream> stream;
     auto oboe_callback = std::make_shared<OboeCallback>(move(data_request_callback));
@@ -101,6 +108,9 @@ ErrorOr<NonnullRefPtr<PlaybackStream>> PlaybackStreamOboe::create(OutputState in
     if (result != oboe::Result::OK)
         return Error::from_string_literal("Oboe failed to start");
 
+    // Oboe clamps this to the buffer capacity of the stream, so we may end up with more latency than we asked for.
+    stream->setBufferSizeInFrames(max(1, static_cast<i32>(target_latency_ms * sample_rate / 1000)));
+
     if (initial_output_state == OutputState::Playing)
         stream->requestStart();
 
@@ -146,6 +156,19 @@ ErrorOr<AK::Duration> PlaybackStreamOboe::total_time_played()
     return m_storage->oboe_callback()->last_sample_time();
 }
 
+ErrorOr<AK::Duration> PlaybackStreamOboe::output_latency()
+{
+    auto latency = m_storage->stream()->calculateLatencyMillis();
+    if (!latency)
+        return Error::from_string_literal("Oboe failed to calculate the output latency");
+    return AK::Duration::from_microseconds(static_cast<i64>(latency.value() * 1000));
+}
+
+u64 PlaybackStreamOboe::underrun_count()
+{
+    return m_storage->oboe_callback()->underrun_count();
+}
+
 NonnullRefPtr<Core::ThreadedPromise<void>> PlaybackStreamOboe::set_volume(double volume)
 {
     auto promise = Core::ThreadedPromise<void>::create();
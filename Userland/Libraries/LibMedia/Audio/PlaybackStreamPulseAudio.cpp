@@ -117,6 +117,20 @@ ErrorOr<AK::Duration> PlaybackStreamPulseAudio::total_time_played()
     return AK::Duration::zero();
 }
 
+ErrorOr<AK::Duration> PlaybackStreamPulseAudio::output_latency()
+{
+    if (auto stream = m_state->stream(); stream != nullptr)
+        return stream->latency();
+    return AK::Duration::zero();
+}
+
+u64 PlaybackStreamPulseAudio::underrun_count()
+{
+    if (auto stream = m_state->stream(); stream != nullptr)
+        return stream->underrun_count();
+    return 0;
+}
+
 NonnullRefPtr<Core::ThreadedPromise<void>> PlaybackStreamPulseAudio::set_volume(double volume)
 {
     auto promise = Core::ThreadedPromise<void>::create();
@@ -240,6 +240,7 @@ ErrorOr<NonnullRefPtr<PulseAudioStream>> PulseAudioContext::create_stream(Output
     pa_stream_set_underflow_callback(
         stream, [](pa_stream*, void* user_data) {
             auto& stream = *static_cast<PulseAudioStream*>(user_data);
+            stream.m_underrun_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
             if (stream.m_underrun_callback)
                 stream.m_underrun_callback();
         },
@@ -480,6 +481,23 @@ ErrorOr<AK::Duration> PulseAudioStream::total_time_played()
     return AK::Duration::from_microseconds(static_cast<i64>(time));
 }
 
+ErrorOr<AK::Duration> PulseAudioStream::latency()
+{
+    auto locker = m_context->main_loop_locker();
+
+    pa_usec_t latency = 0;
+    int negative = 0;
+    auto error = pa_stream_get_latency(m_stream, &latency, &negative);
+    if (error == -PA_ERR_NODATA)
+        return AK::Duration::zero();
+    if (error != 0)
+        return Error::from_string_literal("Failed to get latency from PulseAudio stream");
+    // A negative latency means that the stream's write index is behind its read index, i.e. nothing is buffered.
+    if (negative != 0)
+        return AK::Duration::zero();
+    return AK::Duration::from_microseconds(static_cast<i64>(min(latency, static_cast<pa_usec_t>(NumericLimits<i64>::max()))));
+}
+
 ErrorOr<void> PulseAudioStream::set_volume(double volume)
 {
     auto locker = m_context->main_loop_locker();
@@ -9,6 +9,7 @@
 #include "Forward.h"
 #include "PlaybackStream.h"
 #include "SampleFormats.h"
+#include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/Error.h>
 #include <AK/NonnullRefPtr.h>
@@ -119,6 +120,8 @@ public:
     // resume as soon as possible.
     ErrorOr<void> resume();
     ErrorOr<AK::Duration> total_time_played();
+    ErrorOr<AK::Duration> latency();
+    u64 underrun_count() const { return m_underrun_count.load(AK::MemoryOrder::memory_order_relaxed); }
 
     ErrorOr<void> set_volume(double volume);
 
@@ -147,6 +150,7 @@ private:
     bool m_suspended { false };
 
     Function<void()> m_underrun_callback;
+    Atomic<u64> m_underrun_count { 0 };
 };
 
 enum class PulseAudioErrorCode {
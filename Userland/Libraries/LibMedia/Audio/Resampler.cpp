@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibThreading/Mutex.h>
+
+#include "Resampler.h"
+
+namespace Audio {
+
+using namespace AK::SIMD;
+
+static_assert(sizeof(Sample) == 2 * sizeof(float));
+
+// The number of zero crossings of the sinc function on each side of the filter's center. Higher values give a
+// steeper cutoff at the cost of longer filters.
+static constexpr size_t zero_crossings = 16;
+// The cutoff frequency relative to the lower of the two Nyquist frequencies, leaving room for the transition band.
+static constexpr double cutoff_rolloff = 0.95;
+// Ratios with more phases than this (i.e. unusual sample rates) reuse the filter of the nearest phase below.
+static constexpr u64 max_phase_count = 1024;
+
+class Resampler::FilterBank : public AtomicRefCounted<FilterBank> {
+public:
+    static ErrorOr<NonnullRefPtr<FilterBank const>> create(u64 interpolation, u64 decimation)
+    {
+        auto phase_count = min(interpolation, max_phase_count);
+        // When downsampling, the cutoff has to be lowered below the input's Nyquist frequency to avoid aliasing,
+        // and the filter gets proportionally longer to keep the same steepness.
+        auto cutoff = min(1.0, static_cast<double>(interpolation) / static_cast<double>(decimation)) * cutoff_rolloff;
+        auto half_length = static_cast<size_t>(AK::ceil(zero_crossings / cutoff));
+        auto tap_count = half_length * 2;
+
+        Vector<float> coefficients;
+        TRY(coefficients.try_resize(phase_count * tap_count * 2));
+
+        for (size_t phase = 0; phase < phase_count; phase++) {
+            auto fraction = static_cast<double>(phase) / static_cast<double>(phase_count);
+            auto phase_coefficients = coefficients.span().slice(phase * tap_count * 2, tap_count * 2);
+
+            double sum = 0;
+            for (size_t tap = 0; tap < tap_count; tap++) {
+                // The distance of this tap's input sample from the output sample's position.
+                auto x = static_cast<double>(tap) - static_cast<double>(half_length - 1) - fraction;
+                auto sinc_argument = AK::Pi<double> * cutoff * x;
+                auto sinc = sinc_argument == 0 ? 1.0 : AK::sin(sinc_argument) / sinc_argument;
+
+                // Blackman window over the length of the filter.
+                auto window_position = (x + static_cast<double>(half_length)) / static_cast<double>(tap_count);
+                auto window = 0.42 - 0.5 * AK::cos(2 * AK::Pi<double> * window_position) + 0.08 * AK::cos(4 * AK::Pi<double> * window_position);
+
+                auto coefficient = sinc * window;
+                phase_coefficients[tap * 2] = static_cast<float>(coefficient);
+                sum += coefficient;
+            }
+
+            // Normalize for unity gain, and duplicate each coefficient so that both channels of a Sample can be
+            // multiplied at once.
+            for (size_t tap = 0; tap < tap_count; tap++) {
+                auto coefficient = static_cast<float>(phase_coefficients[tap * 2] / sum);
+                phase_coefficients[tap * 2] = coefficient;
+                phase_coefficients[tap * 2 + 1] = coefficient;
+            }
+        }
+
+        return adopt_nonnull_ref_or_enomem(new (nothrow) FilterBank(interpolation, phase_count, tap_count, move(coefficients)));
+    }
+
+    size_t tap_count() const { return m_tap_count; }
+
+    ReadonlySpan<float> coefficients_for_phase(u64 phase) const
+    {
+        auto index = phase * m_phase_count / m_interpolation;
+        return m_coefficients.span().slice(index * m_tap_count * 2, m_tap_count * 2);
+    }
+
+private:
+    FilterBank(u64 interpolation, u64 phase_count, size_t tap_count, Vector<float> coefficients)
+        : m_interpolation(interpolation)
+        , m_phase_count(phase_count)
+        , m_tap_count(tap_count)
+        , m_coefficients(move(coefficients))
+    {
+    }
+
+    u64 m_interpolation { 0 };
+    u64 m_phase_count { 0 };
+    size_t m_tap_count { 0 };
+    Vector<float> m_coefficients;
+};
+
+static u64 greatest_common_divisor(u64 a, u64 b)
+{
+    while (b != 0) {
+        auto remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+ErrorOr<NonnullRefPtr<Resampler::FilterBank const>> Resampler::filter_bank_for_ratio(u64 interpolation, u64 decimation)
+{
+    // Filter banks are only a few hundred kilobytes at most, and a process will only ever use a handful of ratios, so
+    // they are kept around for the lifetime of the process.
+    static Threading::Mutex cache_mutex;
+    static HashMap<u64, NonnullRefPtr<FilterBank const>> cache;
+
+    Threading::MutexLocker locker { cache_mutex };
+    auto key = (interpolation << 32) | decimation;
+    if (auto cached = cache.get(key); cached.has_value())
+        return NonnullRefPtr { **cached };
+
+    auto filter_bank = TRY(FilterBank::create(interpolation, decimation));
+    TRY(cache.try_set(key, filter_bank));
+    return filter_bank;
+}
+
+ErrorOr<NonnullOwnPtr<Resampler>> Resampler::create(u32 source_sample_rate, u32 target_sample_rate)
+{
+    if (source_sample_rate == 0 || target_sample_rate == 0)
+        return Error::from_string_literal("Sample rates must be non-zero");
+
+    auto divisor = greatest_common_divisor(source_sample_rate, target_sample_rate);
+    u64 interpolation = target_sample_rate / divisor;
+    u64 decimation = source_sample_rate / divisor;
+
+    auto filter_bank = TRY(filter_bank_for_ratio(interpolation, decimation));
+    auto resampler = TRY(adopt_nonnull_own_or_enomem(new (nothrow) Resampler(source_sample_rate, target_sample_rate, interpolation, decimation, move(filter_bank))));
+    TRY(resampler->m_input.try_ensure_capacity(resampler->m_filter_bank->tap_count()));
+    resampler->reset();
+    return resampler;
+}
+
+Resampler::Resampler(u32 source_sample_rate, u32 target_sample_rate, u64 interpolation, u64 decimation, NonnullRefPtr<FilterBank const> filter_bank)
+    : m_source_sample_rate(source_sample_rate)
+    , m_target_sample_rate(target_sample_rate)
+    , m_interpolation(interpolation)
+    , m_decimation(decimation)
+    , m_filter_bank(move(filter_bank))
+{
+}
+
+Resampler::~Resampler() = default;
+
+void Resampler::reset()
+{
+    // Pad the start of the input with silence, so that the first output sample's filter is centered on the first
+    // input sample.
+    m_input.clear_with_capacity();
+    m_input.resize(m_filter_bank->tap_count() / 2 - 1);
+    m_discarded_input_count = 0;
+    m_total_input_count = 0;
+    m_total_output_count = 0;
+}
+
+static Sample convolve(ReadonlySpan<Sample> input, ReadonlySpan<float> coefficients)
+{
+    auto const* input_floats = reinterpret_cast<float const*>(input.data());
+
+    f32x4 sum {};
+    for (size_t i = 0; i < coefficients.size(); i += 4)
+        sum += load_unaligned<f32x4>(input_floats + i) * load_unaligned<f32x4>(coefficients.data() + i);
+    return Sample { sum[0] + sum[2], sum[1] + sum[3] };
+}
+
+ErrorOr<void> Resampler::append_output(Vector<Sample>& output, u64 input_sample_limit)
+{
+    auto tap_count = m_filter_bank->tap_count();
+
+    while (true) {
+        auto position = m_total_output_count * m_decimation;
+        auto input_index = position / m_interpolation;
+        if (input_index >= input_sample_limit)
+            break;
+
+        auto window_start = input_index - m_discarded_input_count;
+        if (window_start + tap_count > m_input.size())
+            break;
+
+        auto coefficients = m_filter_bank->coefficients_for_phase(position % m_interpolation);
+        TRY(output.try_append(convolve(m_input.span().slice(window_start, tap_count), coefficients)));
+        m_total_output_count++;
+    }
+
+    // Drop the input that no future output sample's filter will reach.
+    auto next_window_start = (m_total_output_count * m_decimation) / m_interpolation - m_discarded_input_count;
+    auto discard_count = min(next_window_start, m_input.size());
+    m_input.remove(0, discard_count);
+    m_discarded_input_count += discard_count;
+    return {};
+}
+
+ErrorOr<void> Resampler::process(ReadonlySpan<Sample> input, Vector<Sample>& output)
+{
+    if (m_interpolation == m_decimation)
+        return output.try_append(input.data(), input.size());
+
+    TRY(m_input.try_append(input.data(), input.size()));
+    m_total_input_count += input.size();
+    return append_output(output, NumericLimits<u64>::max());
+}
+
+ErrorOr<void> Resampler::flush(Vector<Sample>& output)
+{
+    if (m_interpolation == m_decimation)
+        return {};
+
+    TRY(m_input.try_resize(m_input.size() + m_filter_bank->tap_count() / 2));
+    TRY(append_output(output, m_total_input_count));
+    reset();
+    return {};
+}
+
+}
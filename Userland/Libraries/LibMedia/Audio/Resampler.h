@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "Sample.h"
+#include <AK/AtomicRefCounted.h>
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+
+namespace Audio {
+
+// Converts a stream of samples from one sample rate to another with a polyphase windowed-sinc filter.
+//
+// The filter coefficients for each fractional position between two input samples (a phase) are computed once per
+// conversion ratio and shared between all resamplers that use that ratio.
+class Resampler {
+public:
+    static ErrorOr<NonnullOwnPtr<Resampler>> create(u32 source_sample_rate, u32 target_sample_rate);
+    ~Resampler();
+
+    u32 source_sample_rate() const { return m_source_sample_rate; }
+    u32 target_sample_rate() const { return m_target_sample_rate; }
+
+    // Appends the resampled input to the output. The output for the last few input samples is held back until enough
+    // of the following input has been received, or until flush() is called.
+    ErrorOr<void> process(ReadonlySpan<Sample> input, Vector<Sample>& output);
+
+    // Appends the output that has been held back as if the input was followed by silence, then resets the resampler.
+    // In total, this produces ceil(input samples * target rate / source rate) output samples.
+    ErrorOr<void> flush(Vector<Sample>& output);
+
+    void reset();
+
+private:
+    class FilterBank;
+
+    static ErrorOr<NonnullRefPtr<FilterBank const>> filter_bank_for_ratio(u64 interpolation, u64 decimation);
+
+    Resampler(u32 source_sample_rate, u32 target_sample_rate, u64 interpolation, u64 decimation, NonnullRefPtr<FilterBank const>);
+
+    ErrorOr<void> append_output(Vector<Sample>& output, u64 input_sample_limit);
+
+    u32 m_source_sample_rate { 0 };
+    u32 m_target_sample_rate { 0 };
+
+    // The output sample at index n lies at input position n * m_decimation / m_interpolation.
+    u64 m_interpolation { 1 };
+    u64 m_decimation { 1 };
+    NonnullRefPtr<FilterBank const> m_filter_bank;
+
+    Vector<Sample> m_input;
+    u64 m_discarded_input_count { 0 };
+    u64 m_total_input_count { 0 };
+    u64 m_total_output_count { 0 };
+};
+
+}
@@ -4,10 +4,19 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/NumericLimits.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+
 #include "SampleFormats.h"
 
 namespace Audio {
 
+using namespace AK::SIMD;
+
+// The conversions below write interleaved floats straight into the Samples.
+static_assert(sizeof(Sample) == 2 * sizeof(float));
+
 u16 pcm_bits_per_sample(PcmSampleFormat format)
 {
     switch (format) {
@@ -27,4 +36,181 @@ u16 pcm_bits_per_sample(PcmSampleFormat format)
     }
 }
 
+// Each reader converts a single value, or four consecutive values at once, to floats in the range [-1, 1].
+template<PcmSampleFormat Format>
+struct PcmReader;
+
+template<>
+struct PcmReader<PcmSampleFormat::Uint8> {
+    static float read(u8 const* data, size_t index) { return (static_cast<float>(data[index]) - 128.0f) / 128.0f; }
+    static f32x4 read4(u8 const* data, size_t index)
+    {
+        auto values = __builtin_convertvector(load_unaligned<u8x4>(data + index), f32x4);
+        return (values - 128.0f) / 128.0f;
+    }
+};
+
+template<>
+struct PcmReader<PcmSampleFormat::Int16> {
+    static constexpr float scale = 1.0f / NumericLimits<i16>::max();
+    static float read(u8 const* data, size_t index) { return reinterpret_cast<i16 const*>(data)[index] * scale; }
+    static f32x4 read4(u8 const* data, size_t index)
+    {
+        return __builtin_convertvector(load_unaligned<i16x4>(data + index * sizeof(i16)), f32x4) * scale;
+    }
+};
+
+template<>
+struct PcmReader<PcmSampleFormat::Int24> {
+    static constexpr float scale = 1.0f / 8388607;
+    static i32 read_integer(u8 const* data, size_t index)
+    {
+        auto const* bytes = data + index * 3;
+        // Shift the value into the top of the integer so that the sign is extended on the way back down.
+        return static_cast<i32>((static_cast<u32>(bytes[0]) << 8) | (static_cast<u32>(bytes[1]) << 16) | (static_cast<u32>(bytes[2]) << 24)) >> 8;
+    }
+    static float read(u8 const* data, size_t index) { return read_integer(data, index) * scale; }
+    static f32x4 read4(u8 const* data, size_t index)
+    {
+        i32x4 values { read_integer(data, index), read_integer(data, index + 1), read_integer(data, index + 2), read_integer(data, index + 3) };
+        return __builtin_convertvector(values, f32x4) * scale;
+    }
+};
+
+template<>
+struct PcmReader<PcmSampleFormat::Int32> {
+    static constexpr float scale = 1.0f / NumericLimits<i32>::max();
+    static float read(u8 const* data, size_t index) { return reinterpret_cast<i32 const*>(data)[index] * scale; }
+    static f32x4 read4(u8 const* data, size_t index)
+    {
+        return __builtin_convertvector(load_unaligned<i32x4>(data + index * sizeof(i32)), f32x4) * scale;
+    }
+};
+
+template<>
+struct PcmReader<PcmSampleFormat::Float32> {
+    static float read(u8 const* data, size_t index) { return reinterpret_cast<float const*>(data)[index]; }
+    static f32x4 read4(u8 const* data, size_t index) { return load_unaligned<f32x4>(data + index * sizeof(float)); }
+};
+
+template<>
+struct PcmReader<PcmSampleFormat::Float64> {
+    static float read(u8 const* data, size_t index) { return static_cast<float>(reinterpret_cast<double const*>(data)[index]); }
+    static f32x4 read4(u8 const* data, size_t index)
+    {
+        return __builtin_convertvector(load_unaligned<f64x4>(data + index * sizeof(double)), f32x4);
+    }
+};
+
+template<PcmSampleFormat Format>
+static void convert_mono(u8 const* data, Span<Sample> output)
+{
+    using Reader = PcmReader<Format>;
+    auto* output_floats = reinterpret_cast<float*>(output.data());
+
+    size_t i = 0;
+    for (; i + 4 <= output.size(); i += 4) {
+        auto values = Reader::read4(data, i);
+        store_unaligned(output_floats + i * 2, __builtin_shufflevector(values, values, 0, 0, 1, 1));
+        store_unaligned(output_floats + i * 2 + 4, __builtin_shufflevector(values, values, 2, 2, 3, 3));
+    }
+    for (; i < output.size(); ++i)
+        output[i] = Sample { Reader::read(data, i) };
+}
+
+template<PcmSampleFormat Format>
+static void convert_interleaved_stereo(u8 const* data, Span<Sample> output)
+{
+    using Reader = PcmReader<Format>;
+    auto* output_floats = reinterpret_cast<float*>(output.data());
+    auto value_count = output.size() * 2;
+
+    size_t i = 0;
+    for (; i + 4 <= value_count; i += 4)
+        store_unaligned(output_floats + i, Reader::read4(data, i));
+    for (; i < value_count; ++i)
+        output_floats[i] = Reader::read(data, i);
+}
+
+template<PcmSampleFormat Format>
+static void convert_planar_stereo(u8 const* left, u8 const* right, Span<Sample> output)
+{
+    using Reader = PcmReader<Format>;
+    auto* output_floats = reinterpret_cast<float*>(output.data());
+
+    size_t i = 0;
+    for (; i + 4 <= output.size(); i += 4) {
+        auto left_values = Reader::read4(left, i);
+        auto right_values = Reader::read4(right, i);
+        store_unaligned(output_floats + i * 2, __builtin_shufflevector(left_values, right_values, 0, 4, 1, 5));
+        store_unaligned(output_floats + i * 2 + 4, __builtin_shufflevector(left_values, right_values, 2, 6, 3, 7));
+    }
+    for (; i < output.size(); ++i)
+        output[i] = Sample { Reader::read(left, i), Reader::read(right, i) };
+}
+
+template<PcmSampleFormat Format>
+static void convert_interleaved(u8 channel_count, u8 const* data, Span<Sample> output)
+{
+    if (channel_count == 1)
+        return convert_mono<Format>(data, output);
+    if (channel_count == 2)
+        return convert_interleaved_stereo<Format>(data, output);
+
+    // FIXME: Downmix the other channels instead of dropping them.
+    using Reader = PcmReader<Format>;
+    for (size_t i = 0; i < output.size(); ++i)
+        output[i] = Sample { Reader::read(data, i * channel_count), Reader::read(data, i * channel_count + 1) };
+}
+
+template<PcmSampleFormat Format>
+static void convert_planar(ReadonlySpan<ReadonlyBytes> planes, Span<Sample> output)
+{
+    if (planes.size() == 1)
+        return convert_mono<Format>(planes[0].data(), output);
+    // FIXME: Downmix the other channels instead of dropping them.
+    convert_planar_stereo<Format>(planes[0].data(), planes[1].data(), output);
+}
+
+template<typename Callback>
+static void dispatch_format(PcmSampleFormat format, Callback callback)
+{
+    switch (format) {
+    case PcmSampleFormat::Uint8:
+        return callback.template operator()<PcmSampleFormat::Uint8>();
+    case PcmSampleFormat::Int16:
+        return callback.template operator()<PcmSampleFormat::Int16>();
+    case PcmSampleFormat::Int24:
+        return callback.template operator()<PcmSampleFormat::Int24>();
+    case PcmSampleFormat::Int32:
+        return callback.template operator()<PcmSampleFormat::Int32>();
+    case PcmSampleFormat::Float32:
+        return callback.template operator()<PcmSampleFormat::Float32>();
+    case PcmSampleFormat::Float64:
+        return callback.template operator()<PcmSampleFormat::Float64>();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void convert_interleaved_pcm_to_samples(PcmSampleFormat format, u8 channel_count, ReadonlyBytes data, Span<Sample> output)
+{
+    VERIFY(channel_count > 0);
+    VERIFY(data.size() >= output.size() * channel_count * pcm_bits_per_sample(format) / 8);
+
+    dispatch_format(format, [&]<PcmSampleFormat Format>() {
+        convert_interleaved<Format>(channel_count, data.data(), output);
+    });
+}
+
+void convert_planar_pcm_to_samples(PcmSampleFormat format, ReadonlySpan<ReadonlyBytes> planes, Span<Sample> output)
+{
+    VERIFY(!planes.is_empty());
+    for (auto plane : planes)
+        VERIFY(plane.size() >= output.size() * pcm_bits_per_sample(format) / 8);
+
+    dispatch_format(format, [&]<PcmSampleFormat Format>() {
+        convert_planar<Format>(planes, output);
+    });
+}
+
 }
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include "Sample.h"
 #include <AK/ByteString.h>
+#include <AK/Span.h>
 #include <AK/Types.h>
 
 namespace Audio {
@@ -24,4 +26,12 @@ enum class PcmSampleFormat : u8 {
 // Most of the read code only cares about how many bits to read or write
 u16 pcm_bits_per_sample(PcmSampleFormat format);
 
+// Converts native-endian PCM data with the given number of interleaved channels to Samples, filling the whole output.
+// Mono data is played on both sides, and only the first two channels of data with more channels are kept.
+void convert_interleaved_pcm_to_samples(PcmSampleFormat, u8 channel_count, ReadonlyBytes data, Span<Sample> output);
+
+// Converts native-endian PCM data with one plane per channel to Samples, filling the whole output. The same rules
+// for the channel count apply as for interleaved data.
+void convert_planar_pcm_to_samples(PcmSampleFormat, ReadonlySpan<ReadonlyBytes> planes, Span<Sample> output);
+
 }
@@ -150,11 +150,12 @@ public:
         return Gfx::Color(r, g, b);
     }
 
-    // Fast conversion of 8-bit YUV to full-range RGB.
-    template<MatrixCoefficients MC, VideoFullRangeFlag FR, Unsigned T>
+    // Fast conversion of YUV to full-range 8-bit RGB, for input that needs no transfer function or gamut changes.
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR, u8 BitDepth, Unsigned T>
     static ALWAYS_INLINE Gfx::Color convert_simple_yuv_to_rgb(T y_in, T u_in, T v_in)
     {
-        static constexpr i32 bit_depth = 8;
+        static_assert(BitDepth >= 8 && BitDepth <= 12);
+        static constexpr i32 bit_depth = BitDepth;
         static constexpr i32 maximum_value = (1 << bit_depth) - 1;
         static constexpr i32 one = 1 << 14;
         static constexpr auto fraction = [](i32 numerator, i32 denominator) constexpr {
@@ -176,24 +177,20 @@ public:
         constexpr auto range_factors = [] {
             RangeFactors range_factors;
 
-            i32 min = 0;
-            i32 y_max = 255;
-            i32 uv_max = 255;
+            // Offsets and ranges for higher bit depths are the 8-bit values shifted left, see H.273 section 8.3.
+            constexpr i32 shift = bit_depth - 8;
+            range_factors.uv_offset = -(128 << shift);
 
             if constexpr (FR == VideoFullRangeFlag::Studio) {
-                min = 16;
-                y_max = 235;
-                uv_max = 240;
+                range_factors.y_offset = -(16 << shift);
+                range_factors.y_scale = fraction(255, 219 << shift);
+                range_factors.uv_scale = fraction(255, 224 << shift) * 2;
+            } else {
+                range_factors.y_offset = 0;
+                range_factors.y_scale = fraction(255, maximum_value);
+                range_factors.uv_scale = fraction(255, maximum_value) * 2;
             }
 
-            range_factors.y_offset = -min * maximum_value / 255;
-            range_factors.y_scale = fraction(255, y_max - min);
-            range_factors.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
-            range_factors.uv_scale = fraction(255, uv_max - min) * 2;
-
-            range_factors.y_scale = multiply(range_factors.y_scale, fraction(255, maximum_value));
-            range_factors.uv_scale = multiply(range_factors.uv_scale, fraction(255, maximum_value));
-
             return range_factors;
         }();
 
@@ -209,7 +206,7 @@ public:
         constexpr i32 uv_scale = range_factors.uv_scale;
 
         // The equations below will have the following effects:
-        //  - Scale the Y, U and V values into the range 0...maximum_value*one for these fixed-point operations.
+        //  - Scale the Y, U and V values into the range 0...255*one for these fixed-point operations.
         //  - Scale the values by the color range defined by VideoFullRangeFlag.
         //  - Scale the U and V values by 2 to put them in the actual YCbCr coordinate space.
         //  - Multiply by the YCbCr coefficients to convert to RGB.
@@ -231,14 +228,13 @@ public:
             blue = y * y_scale + u * multiply(coef(94070), uv_scale);
         }
 
-        red = clamp(red, 0, maximum_value * one);
-        green = clamp(green, 0, maximum_value * one);
-        blue = clamp(blue, 0, maximum_value * one);
+        red = clamp(red, 0, 255 * one);
+        green = clamp(green, 0, 255 * one);
+        blue = clamp(blue, 0, 255 * one);
 
-        // This compiles down to a bit shift if maximum_value == 255
-        red /= fraction(maximum_value, 255);
-        green /= fraction(maximum_value, 255);
-        blue /= fraction(maximum_value, 255);
+        red /= one;
+        green /= one;
+        blue /= one;
 
         return Gfx::Color(u8(red), u8(green), u8(blue));
     }
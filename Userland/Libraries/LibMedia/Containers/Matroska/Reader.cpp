@@ -268,9 +268,12 @@ DecoderErrorOr<Optional<size_t>> Reader::find_first_top_level_element_with_id([[
     }
 
     Streamer streamer { m_data };
-    if (m_last_top_level_element_position != 0)
+    if (m_last_top_level_element_position != 0) {
+        // If the last element we skipped ended the data, we've already seen every top-level element.
+        if (m_last_top_level_element_position >= m_data.size())
+            return OptionalNone {};
         TRY_READ(streamer.seek_to_position(m_last_top_level_element_position));
-    else
+    } else
         TRY_READ(streamer.seek_to_position(m_segment_contents_position));
 
     Optional<size_t> position;
@@ -818,8 +821,11 @@ DecoderErrorOr<void> Reader::ensure_cues_are_parsed()
     if (m_cues_have_been_parsed)
         return {};
     auto position = TRY(find_first_top_level_element_with_id("Cues"sv, CUES_ID));
-    if (!position.has_value())
-        return DecoderError::corrupted("No Tracks element found"sv);
+    if (!position.has_value()) {
+        // Cues are optional, seeking will fall back to the cluster index.
+        m_cues_have_been_parsed = true;
+        return {};
+    }
     Streamer streamer { m_data };
     TRY_READ(streamer.seek_to_position(position.release_value()));
     TRY(parse_cues(streamer));
@@ -827,51 +833,44 @@ DecoderErrorOr<void> Reader::ensure_cues_are_parsed()
     return {};
 }
 
-DecoderErrorOr<void> Reader::seek_to_cue_for_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+template<typename T, typename GetTimestamp>
+static size_t index_of_last_entry_at_or_before(Vector<T> const& entries, AK::Duration const& timestamp, GetTimestamp get_timestamp)
 {
-    auto const& cue_points = MUST(cue_points_for_track(iterator.m_track->track_number())).release_value();
-
-    // Take a guess at where in the cues the timestamp will be and correct from there.
-    auto duration = TRY(segment_information()).duration();
-    size_t index = 0;
-    if (duration.has_value())
-        index = clamp(((timestamp.to_nanoseconds() * cue_points.size()) / TRY(segment_information()).duration()->to_nanoseconds()), 0, cue_points.size() - 1);
-
-    CuePoint const* prev_cue_point = &cue_points[index];
-    dbgln_if(MATROSKA_DEBUG, "Finding Matroska cue points for timestamp {}ms starting from cue at {}ms", timestamp.to_milliseconds(), prev_cue_point->timestamp().to_milliseconds());
-
-    if (prev_cue_point->timestamp() == timestamp) {
-        TRY(iterator.seek_to_cue_point(*prev_cue_point));
-        return {};
+    VERIFY(!entries.is_empty());
+
+    // Find the first entry after the timestamp, the one we want is right before it.
+    size_t low = 0;
+    size_t high = entries.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (get_timestamp(entries[middle]) <= timestamp)
+            low = middle + 1;
+        else
+            high = middle;
     }
 
-    if (prev_cue_point->timestamp() > timestamp) {
-        while (index > 0 && prev_cue_point->timestamp() > timestamp) {
-            prev_cue_point = &cue_points[--index];
-            dbgln_if(MATROSKA_DEBUG, "Checking previous cue point {}ms", prev_cue_point->timestamp().to_milliseconds());
-        }
-        TRY(iterator.seek_to_cue_point(*prev_cue_point));
-        return {};
-    }
+    // If every entry is after the timestamp, the first one is the best we can do.
+    return low > 0 ? low - 1 : 0;
+}
 
-    while (++index < cue_points.size()) {
-        auto const& cue_point = cue_points[index];
-        dbgln_if(MATROSKA_DEBUG, "Checking future cue point {}ms", cue_point.timestamp().to_milliseconds());
-        if (cue_point.timestamp() > timestamp)
-            break;
-        prev_cue_point = &cue_point;
-    }
+DecoderErrorOr<void> Reader::seek_to_cue_for_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+{
+    auto const& cue_points = MUST(cue_points_for_track(iterator.m_track->track_number())).release_value();
+    auto index = index_of_last_entry_at_or_before(cue_points, timestamp, [](CuePoint const& cue_point) { return cue_point.timestamp(); });
+    dbgln_if(MATROSKA_DEBUG, "Found Matroska cue point at {}ms for timestamp {}ms", cue_points[index].timestamp().to_milliseconds(), timestamp.to_milliseconds());
 
-    TRY(iterator.seek_to_cue_point(*prev_cue_point));
+    TRY(iterator.seek_to_cue_point(cue_points[index]));
     return {};
 }
 
-static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+// Returns whether a keyframe at or before the timestamp was found.
+static DecoderErrorOr<bool> search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
 {
 #if MATROSKA_DEBUG
     size_t inter_frames_count;
 #endif
     Optional<SampleIterator> last_keyframe;
+    bool found_keyframe_before_timestamp = false;
 
     while (true) {
         SampleIterator rewind_iterator = iterator;
@@ -887,6 +886,9 @@ static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(Sample
         if (block.timestamp() > timestamp)
             break;
 
+        if (block.only_keyframes())
+            found_keyframe_before_timestamp = true;
+
 #if MATROSKA_DEBUG
         inter_frames_count++;
 #endif
@@ -899,9 +901,73 @@ static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(Sample
         iterator = last_keyframe.release_value();
     }
 
+    return found_keyframe_before_timestamp;
+}
+
+DecoderErrorOr<void> Reader::ensure_cluster_index_is_built()
+{
+    if (m_cluster_index_has_been_built)
+        return {};
+    m_cluster_index_has_been_built = true;
+
+    auto first_cluster_position = TRY(find_first_top_level_element_with_id("Cluster"sv, CLUSTER_ELEMENT_ID));
+    if (!first_cluster_position.has_value())
+        return DecoderError::corrupted("No clusters are present in the segment"sv);
+    auto timestamp_scale = TRY(segment_information()).timestamp_scale();
+
+    Streamer streamer { m_data.slice(m_segment_contents_position, m_segment_contents_size) };
+    TRY_READ(streamer.seek_to_position(first_cluster_position.value() - get_element_id_size(CLUSTER_ELEMENT_ID) - m_segment_contents_position));
+
+    // Only the cluster headers are read, the blocks are skipped over using the cluster sizes. A cluster with an unknown
+    // size or anything else that we can't make sense of ends the index, and seeks past that point will search linearly.
+    while (streamer.has_octet()) {
+        auto element_position = streamer.position();
+        auto element_id_or_error = streamer.read_variable_size_integer(false);
+        if (element_id_or_error.is_error())
+            break;
+
+        if (element_id_or_error.value() == CLUSTER_ELEMENT_ID) {
+            auto cluster_data_position = streamer.position();
+            auto cluster_or_error = parse_cluster(streamer, timestamp_scale);
+            if (cluster_or_error.is_error())
+                break;
+
+            auto cluster_timestamp = cluster_or_error.value().timestamp();
+            if (!m_cluster_index.is_empty() && cluster_timestamp < m_cluster_index.last().timestamp)
+                break;
+            DECODER_TRY_ALLOC(m_cluster_index.try_append({ cluster_timestamp, element_position }));
+
+            TRY_READ(streamer.seek_to_position(cluster_data_position));
+        }
+
+        if (streamer.read_unknown_element().is_error())
+            break;
+    }
+
+    dbgln_if(MATROSKA_DEBUG, "Built an index of {} clusters for seeking", m_cluster_index.size());
     return {};
 }
 
+DecoderErrorOr<void> Reader::seek_to_cluster_for_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+{
+    auto index = index_of_last_entry_at_or_before(m_cluster_index, timestamp, [](ClusterIndexEntry const& entry) { return entry.timestamp; });
+
+    // If the iterator is already between the cluster and the timestamp, carry on from there.
+    if (iterator.last_timestamp().has_value() && iterator.last_timestamp().value() >= m_cluster_index[index].timestamp && iterator.last_timestamp().value() <= timestamp) {
+        TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
+        return {};
+    }
+
+    // The keyframe that the timestamp depends on may be in an earlier cluster, so step back until we find one.
+    while (true) {
+        dbgln_if(MATROSKA_DEBUG, "Searching for keyframe from cluster at {}ms", m_cluster_index[index].timestamp.to_milliseconds());
+        iterator.seek_to_cluster(m_cluster_index[index].position);
+        if (TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp)) || index == 0)
+            return {};
+        index--;
+    }
+}
+
 DecoderErrorOr<bool> Reader::has_cues_for_track(u64 track_number)
 {
     TRY(ensure_cues_are_parsed());
@@ -916,6 +982,12 @@ DecoderErrorOr<SampleIterator> Reader::seek_to_random_access_point(SampleIterato
         return iterator;
     }
 
+    TRY(ensure_cluster_index_is_built());
+    if (!m_cluster_index.is_empty()) {
+        TRY(seek_to_cluster_for_timestamp(iterator, timestamp));
+        return iterator;
+    }
+
     if (!iterator.last_timestamp().has_value() || timestamp < iterator.last_timestamp().value()) {
         // If the timestamp is before the iterator's current position, then we need to start from the beginning of the Segment.
         iterator = TRY(create_sample_iterator(iterator.m_track->track_number()));
@@ -995,6 +1067,13 @@ DecoderErrorOr<void> SampleIterator::seek_to_cue_point(CuePoint const& cue_point
     return {};
 }
 
+void SampleIterator::seek_to_cluster(size_t position)
+{
+    m_position = position;
+    m_current_cluster.clear();
+    m_last_timestamp.clear();
+}
+
 ErrorOr<ByteString> Streamer::read_string()
 {
     auto string_length = TRY(read_variable_size_integer());
@@ -60,6 +60,9 @@ private:
     DecoderErrorOr<void> ensure_cues_are_parsed();
     DecoderErrorOr<void> seek_to_cue_for_timestamp(SampleIterator&, AK::Duration const&);
 
+    DecoderErrorOr<void> ensure_cluster_index_is_built();
+    DecoderErrorOr<void> seek_to_cluster_for_timestamp(SampleIterator&, AK::Duration const&);
+
     RefPtr<Core::SharedMappedFile> m_mapped_file;
     ReadonlyBytes m_data;
 
@@ -78,6 +81,14 @@ private:
     // The vectors must be sorted by timestamp at all times.
     HashMap<u64, Vector<CuePoint>> m_cues;
     bool m_cues_have_been_parsed { false };
+
+    // Used to seek in segments without cues. Sorted by timestamp, and positions are relative to the segment contents.
+    struct ClusterIndexEntry {
+        AK::Duration timestamp;
+        size_t position;
+    };
+    Vector<ClusterIndexEntry> m_cluster_index;
+    bool m_cluster_index_has_been_built { false };
 };
 
 class SampleIterator {
@@ -100,6 +111,7 @@ private:
     }
 
     DecoderErrorOr<void> seek_to_cue_point(CuePoint const& cue_point);
+    void seek_to_cluster(size_t position);
 
     RefPtr<Core::SharedMappedFile> m_file;
     ReadonlyBytes m_data;
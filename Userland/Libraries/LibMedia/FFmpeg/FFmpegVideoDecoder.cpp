@@ -4,46 +4,129 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ScopeGuard.h>
 #include <LibCore/System.h>
 #include <LibMedia/VideoFrame.h>
 
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+#include <libavutil/pixdesc.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+static bool is_supported_planar_format(AVPixelFormat format)
+{
+    switch (format) {
+    case AV_PIX_FMT_YUV420P:
+    case AV_PIX_FMT_YUV420P10:
+    case AV_PIX_FMT_YUV420P12:
+    case AV_PIX_FMT_YUV422P:
+    case AV_PIX_FMT_YUV422P10:
+    case AV_PIX_FMT_YUV422P12:
+    case AV_PIX_FMT_YUV444P:
+    case AV_PIX_FMT_YUV444P10:
+    case AV_PIX_FMT_YUV444P12:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Hardware decoders hand their frames back with the chroma planes interleaved.
+static bool is_supported_semi_planar_format(AVPixelFormat format)
+{
+    return format == AV_PIX_FMT_NV12 || format == AV_PIX_FMT_P010;
+}
+
+static bool is_hardware_format_for_device(AVCodecContext* codec_context, AVPixelFormat format)
 {
+    if (!codec_context->hw_device_ctx)
+        return false;
+
+    auto device_type = reinterpret_cast<AVHWDeviceContext*>(codec_context->hw_device_ctx->data)->type;
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec_context->codec, i);
+        if (!config)
+            return false;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) != 0 && config->device_type == device_type && config->pix_fmt == format)
+            return true;
+    }
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
+{
+    // If the decoder can't use our hardware device for this stream, it will only offer software formats here.
+    for (auto const* format = formats; *format >= 0; format++) {
+        if (is_hardware_format_for_device(codec_context, *format))
+            return *format;
+    }
+
     while (*formats >= 0) {
-        switch (*formats) {
-        case AV_PIX_FMT_YUV420P:
-        case AV_PIX_FMT_YUV420P10:
-        case AV_PIX_FMT_YUV420P12:
-        case AV_PIX_FMT_YUV422P:
-        case AV_PIX_FMT_YUV422P10:
-        case AV_PIX_FMT_YUV422P12:
-        case AV_PIX_FMT_YUV444P:
-        case AV_PIX_FMT_YUV444P10:
-        case AV_PIX_FMT_YUV444P12:
+        if (is_supported_planar_format(*formats))
             return *formats;
-        default:
-            break;
-        }
         formats++;
     }
     return AV_PIX_FMT_NONE;
 }
 
+static AVBufferRef* create_hardware_device_context(AVCodec const* codec)
+{
+#if defined(AK_OS_MACOS)
+    constexpr auto device_type = AV_HWDEVICE_TYPE_VIDEOTOOLBOX;
+#elif defined(AK_OS_LINUX)
+    constexpr auto device_type = AV_HWDEVICE_TYPE_VAAPI;
+#else
+    constexpr auto device_type = AV_HWDEVICE_TYPE_NONE;
+#endif
+
+    if constexpr (device_type == AV_HWDEVICE_TYPE_NONE)
+        return nullptr;
+
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (!config)
+            return nullptr;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0 || config->device_type != device_type)
+            continue;
+
+        // This fails if there's no usable device (or driver) for this type, in which case we just decode in software.
+        AVBufferRef* device_context = nullptr;
+        if (av_hwdevice_ctx_create(&device_context, device_type, nullptr, nullptr, 0) < 0)
+            return nullptr;
+        return device_context;
+    }
+}
+
+static AVPixelFormat choose_transfer_format(AVFrame const* hardware_frame)
+{
+    AVPixelFormat* formats = nullptr;
+    if (av_hwframe_transfer_get_formats(hardware_frame->hw_frames_ctx, AV_HWFRAME_TRANSFER_DIRECTION_FROM, &formats, 0) < 0)
+        return AV_PIX_FMT_NONE;
+    ScopeGuard free_formats = [&] { av_free(formats); };
+
+    for (auto const* format = formats; *format != AV_PIX_FMT_NONE; format++) {
+        if (is_supported_planar_format(*format) || is_supported_semi_planar_format(*format))
+            return *format;
+    }
+    return AV_PIX_FMT_NONE;
+}
+
 DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
 {
     AVCodecContext* codec_context = nullptr;
     AVPacket* packet = nullptr;
     AVFrame* frame = nullptr;
+    AVFrame* transfer_frame = nullptr;
     ArmedScopeGuard memory_guard {
         [&] {
             avcodec_free_context(&codec_context);
             av_packet_free(&packet);
             av_frame_free(&frame);
+            av_frame_free(&transfer_frame);
         }
     };
 
@@ -57,6 +140,7 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
     codec_context->get_format = negotiate_output_format;
+    codec_context->hw_device_ctx = create_hardware_device_context(codec);
 
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
 
@@ -83,14 +167,19 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!frame)
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
+    transfer_frame = av_frame_alloc();
+    if (!transfer_frame)
+        return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame, transfer_frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_transfer_frame(transfer_frame)
 {
 }
 
@@ -98,6 +187,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_transfer_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -127,17 +217,81 @@ DecoderErrorOr<void> FFmpegVideoDecoder::receive_sample(AK::Duration timestamp,
     }
 }
 
+template<typename T>
+static void copy_semi_planar_frame_impl(AVFrame const& source_frame, SubsampledYUVFrame& frame, Gfx::Size<size_t> luma_size, Gfx::Size<size_t> chroma_size)
+{
+    // P010 stores its 10-bit samples in the most significant bits of each component.
+    constexpr auto shift = IsSame<T, u8> ? 0 : 6;
+
+    auto const* luma_source = source_frame.data[0];
+    auto* y_destination = frame.get_plane_data<T>(0);
+    for (size_t row = 0; row < luma_size.height(); row++) {
+        auto const* source_row = reinterpret_cast<T const*>(luma_source);
+        for (size_t column = 0; column < luma_size.width(); column++)
+            y_destination[column] = source_row[column] >> shift;
+        luma_source += source_frame.linesize[0];
+        y_destination += luma_size.width();
+    }
+
+    auto const* chroma_source = source_frame.data[1];
+    auto* u_destination = frame.get_plane_data<T>(1);
+    auto* v_destination = frame.get_plane_data<T>(2);
+    for (size_t row = 0; row < chroma_size.height(); row++) {
+        auto const* source_row = reinterpret_cast<T const*>(chroma_source);
+        for (size_t column = 0; column < chroma_size.width(); column++) {
+            u_destination[column] = source_row[column * 2] >> shift;
+            v_destination[column] = source_row[column * 2 + 1] >> shift;
+        }
+        chroma_source += source_frame.linesize[1];
+        u_destination += chroma_size.width();
+        v_destination += chroma_size.width();
+    }
+}
+
+static DecoderErrorOr<void> copy_semi_planar_frame(AVFrame const& source_frame, SubsampledYUVFrame& frame, Gfx::Size<size_t> luma_size, Gfx::Size<size_t> chroma_size)
+{
+    for (u32 plane = 0; plane < 2; plane++) {
+        VERIFY(source_frame.data[plane] != nullptr);
+        if (source_frame.linesize[plane] < 0)
+            return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
+    }
+
+    auto component_size = frame.bit_depth() <= 8 ? 1 : 2;
+    VERIFY(luma_size.width() * component_size <= static_cast<size_t>(source_frame.linesize[0]));
+    VERIFY(chroma_size.width() * 2 * component_size <= static_cast<size_t>(source_frame.linesize[1]));
+
+    if (component_size == 1)
+        copy_semi_planar_frame_impl<u8>(source_frame, frame, luma_size, chroma_size);
+    else
+        copy_semi_planar_frame_impl<u16>(source_frame, frame, luma_size, chroma_size);
+    return {};
+}
+
 DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame()
 {
     auto result = avcodec_receive_frame(m_codec_context, m_frame);
 
     switch (result) {
     case 0: {
-        auto color_primaries = static_cast<ColorPrimaries>(m_frame->color_primaries);
-        auto transfer_characteristics = static_cast<TransferCharacteristics>(m_frame->color_trc);
-        auto matrix_coefficients = static_cast<MatrixCoefficients>(m_frame->colorspace);
+        AVFrame const* source_frame = m_frame;
+        if (auto const* descriptor = av_pix_fmt_desc_get(static_cast<AVPixelFormat>(m_frame->format)); descriptor && (descriptor->flags & AV_PIX_FMT_FLAG_HWACCEL) != 0) {
+            // The frame lives in GPU memory, so bring it back to system memory to hand it to the color converter.
+            av_frame_unref(m_transfer_frame);
+            m_transfer_frame->format = choose_transfer_format(m_frame);
+            if (m_transfer_frame->format == AV_PIX_FMT_NONE)
+                return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Hardware decoder has no supported output format"sv);
+            if (av_hwframe_transfer_data(m_transfer_frame, m_frame, 0) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to transfer frame from the hardware decoder"sv);
+            if (av_frame_copy_props(m_transfer_frame, m_frame) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to copy hardware frame properties"sv);
+            source_frame = m_transfer_frame;
+        }
+
+        auto color_primaries = static_cast<ColorPrimaries>(source_frame->color_primaries);
+        auto transfer_characteristics = static_cast<TransferCharacteristics>(source_frame->color_trc);
+        auto matrix_coefficients = static_cast<MatrixCoefficients>(source_frame->colorspace);
         auto color_range = [&] {
-            switch (m_frame->color_range) {
+            switch (source_frame->color_range) {
             case AVColorRange::AVCOL_RANGE_MPEG:
                 return VideoFullRangeFlag::Studio;
             case AVColorRange::AVCOL_RANGE_JPEG:
@@ -149,14 +303,16 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto cicp = CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, color_range };
 
         size_t bit_depth = [&] {
-            switch (m_frame->format) {
+            switch (source_frame->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV444P:
+            case AV_PIX_FMT_NV12:
                 return 8;
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV422P10:
             case AV_PIX_FMT_YUV444P10:
+            case AV_PIX_FMT_P010:
                 return 10;
             case AV_PIX_FMT_YUV420P12:
             case AV_PIX_FMT_YUV422P12:
@@ -168,10 +324,12 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         size_t component_size = (bit_depth + 7) / 8;
 
         auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
+            switch (source_frame->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV420P12:
+            case AV_PIX_FMT_NV12:
+            case AV_PIX_FMT_P010:
                 return { true, true };
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV422P10:
@@ -187,30 +345,35 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             }
         }();
 
-        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
+        auto size = Gfx::Size<u32> { source_frame->width, source_frame->height };
 
-        auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
+        auto timestamp = AK::Duration::from_microseconds(source_frame->pts);
         auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth, cicp, subsampling));
 
+        if (is_supported_semi_planar_format(static_cast<AVPixelFormat>(source_frame->format))) {
+            TRY(copy_semi_planar_frame(*source_frame, *frame, size.to_type<size_t>(), subsampling.subsampled_size(size).to_type<size_t>()));
+            return frame;
+        }
+
         for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+            VERIFY(source_frame->linesize[plane] != 0);
+            if (source_frame->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
 
             bool const use_subsampling = plane > 0;
             auto plane_size = (use_subsampling ? subsampling.subsampled_size(size) : size).to_type<size_t>();
 
             auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+            VERIFY(output_line_size <= static_cast<size_t>(source_frame->linesize[plane]));
 
-            auto const* source = m_frame->data[plane];
+            auto const* source = source_frame->data[plane];
             VERIFY(source != nullptr);
             auto* destination = frame->get_raw_plane_data(plane);
             VERIFY(destination != nullptr);
 
             for (size_t row = 0; row < plane_size.height(); row++) {
                 memcpy(destination, source, output_line_size);
-                source += m_frame->linesize[plane];
+                source += source_frame->linesize[plane];
                 destination += output_line_size;
             }
         }
@@ -16,7 +16,7 @@ namespace Media::FFmpeg {
 class FFmpegVideoDecoder final : public VideoDecoder {
 public:
     static DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> try_create(CodecID, ReadonlyBytes codec_initialization_data);
-    FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame);
+    FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame);
     ~FFmpegVideoDecoder();
 
     DecoderErrorOr<void> receive_sample(AK::Duration timestamp, ReadonlyBytes sample) override;
@@ -30,6 +30,8 @@ private:
     AVCodecContext* m_codec_context;
     AVPacket* m_packet;
     AVFrame* m_frame;
+    // Hardware decoded frames are copied into this one before being converted.
+    AVFrame* m_transfer_frame;
 };
 
 }
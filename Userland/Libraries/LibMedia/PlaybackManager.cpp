@@ -138,6 +138,30 @@ void PlaybackManager::dispatch_new_frame(RefPtr<Gfx::Bitmap> frame)
         on_video_frame(move(frame));
 }
 
+DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> PlaybackManager::convert_frame_for_presentation(VideoFrame& frame)
+{
+    auto size = frame.size().to_type<int>();
+
+    // A bitmap that only the pool references isn't being displayed anymore, so we can draw the new frame into it.
+    m_bitmap_pool.remove_all_matching([&](auto const& bitmap) { return bitmap->ref_count() == 1 && bitmap->size() != size; });
+    RefPtr<Gfx::Bitmap> bitmap;
+    for (auto& candidate : m_bitmap_pool) {
+        if (candidate->ref_count() == 1) {
+            bitmap = candidate;
+            break;
+        }
+    }
+
+    if (!bitmap) {
+        bitmap = DECODER_TRY_ALLOC(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, size));
+        if (m_bitmap_pool.size() < max_pooled_bitmap_count)
+            m_bitmap_pool.append(*bitmap);
+    }
+
+    TRY(frame.output_to_bitmap(*bitmap));
+    return bitmap.release_nonnull();
+}
+
 bool PlaybackManager::dispatch_frame_queue_item(FrameQueueItem&& item)
 {
     if (item.is_error()) {
@@ -145,8 +169,14 @@ bool PlaybackManager::dispatch_frame_queue_item(FrameQueueItem&& item)
         return true;
     }
 
+    auto bitmap_result = convert_frame_for_presentation(item.frame());
+    if (bitmap_result.is_error()) {
+        dispatch_decoder_error(bitmap_result.release_error());
+        return true;
+    }
+
     dbgln_if(PLAYBACK_MANAGER_DEBUG, "Sent frame for presentation with timestamp {}ms, late by {}ms", item.timestamp().to_milliseconds(), (current_playback_time() - item.timestamp()).to_milliseconds());
-    dispatch_new_frame(item.bitmap());
+    dispatch_new_frame(bitmap_result.release_value());
     return false;
 }
 
@@ -244,7 +274,7 @@ void PlaybackManager::decode_and_queue_one_sample()
             }
         }
 
-        // Convert the frame for display.
+        // Prepare the frame for display. The conversion itself happens once the frame is presented.
         if (decoded_frame != nullptr) {
             auto& cicp = decoded_frame->cicp();
             cicp.adopt_specified_values(container_cicp);
@@ -267,12 +297,8 @@ void PlaybackManager::decode_and_queue_one_sample()
                 break;
             }
 
-            auto bitmap_result = decoded_frame->to_bitmap();
-
-            if (bitmap_result.is_error())
-                item_to_enqueue = FrameQueueItem::error_marker(bitmap_result.release_error(), decoded_frame->timestamp());
-            else
-                item_to_enqueue = FrameQueueItem::frame(bitmap_result.release_value(), decoded_frame->timestamp());
+            auto timestamp = decoded_frame->timestamp();
+            item_to_enqueue = FrameQueueItem::frame(decoded_frame.release_nonnull(), timestamp);
             break;
         }
     }
@@ -633,12 +659,12 @@ private:
                 if (manager().dispatch_frame_queue_item(manager().m_next_frame.release_value()))
                     return {};
 
-                manager().m_next_frame.emplace(item);
+                manager().m_next_frame.emplace(move(item));
 
                 dbgln_if(PLAYBACK_MANAGER_DEBUG, "Exiting seek to {} state at {}ms", m_playing ? "Playing" : "Paused", manager().m_last_present_in_media_time.to_milliseconds());
                 return assume_next_state();
             }
-            manager().m_next_frame.emplace(item);
+            manager().m_next_frame.emplace(move(item));
         }
 
         dbgln_if(PLAYBACK_MANAGER_DEBUG, "Frame queue is empty while seeking, waiting for buffer to fill.");
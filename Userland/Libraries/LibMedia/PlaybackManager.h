@@ -15,6 +15,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibMedia/Containers/Matroska/Document.h>
 #include <LibMedia/Demuxer.h>
+#include <LibMedia/VideoFrame.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
@@ -38,9 +39,9 @@ public:
         Error,
     };
 
-    static FrameQueueItem frame(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
+    static FrameQueueItem frame(NonnullOwnPtr<VideoFrame> frame, AK::Duration timestamp)
     {
-        return FrameQueueItem(move(bitmap), timestamp);
+        return FrameQueueItem(move(frame), timestamp);
     }
 
     static FrameQueueItem error_marker(DecoderError&& error, AK::Duration timestamp)
@@ -48,8 +49,8 @@ public:
         return FrameQueueItem(move(error), timestamp);
     }
 
-    bool is_frame() const { return m_data.has<RefPtr<Gfx::Bitmap>>(); }
-    RefPtr<Gfx::Bitmap> bitmap() const { return m_data.get<RefPtr<Gfx::Bitmap>>(); }
+    bool is_frame() const { return m_data.has<NonnullOwnPtr<VideoFrame>>(); }
+    VideoFrame& frame() const { return *m_data.get<NonnullOwnPtr<VideoFrame>>(); }
     AK::Duration timestamp() const { return m_timestamp; }
 
     bool is_error() const { return m_data.has<DecoderError>(); }
@@ -71,8 +72,8 @@ public:
     }
 
 private:
-    FrameQueueItem(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
-        : m_data(move(bitmap))
+    FrameQueueItem(NonnullOwnPtr<VideoFrame> frame, AK::Duration timestamp)
+        : m_data(move(frame))
         , m_timestamp(timestamp)
     {
         VERIFY(m_timestamp != no_timestamp);
@@ -84,7 +85,9 @@ private:
     {
     }
 
-    Variant<Empty, RefPtr<Gfx::Bitmap>, DecoderError> m_data { Empty() };
+    // Frames are only converted for display once they're about to be presented, so that frames which are skipped
+    // (while seeking, or when we're running behind) don't cost a conversion.
+    Variant<Empty, NonnullOwnPtr<VideoFrame>, DecoderError> m_data { Empty() };
     AK::Duration m_timestamp { no_timestamp };
 };
 
@@ -166,6 +169,8 @@ private:
 
     void decode_and_queue_one_sample();
 
+    DecoderErrorOr<NonnullRefPtr<Gfx::Bitmap>> convert_frame_for_presentation(VideoFrame&);
+
     void dispatch_decoder_error(DecoderError error);
     void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
     // Returns whether we changed playback states. If so, any PlaybackStateHandler processing must cease.
@@ -194,6 +199,10 @@ private:
     OwnPtr<PlaybackStateHandler> m_playback_handler;
     Optional<FrameQueueItem> m_next_frame;
 
+    // Bitmaps we've presented, to be reused for later frames once nobody else holds on to them.
+    static constexpr size_t max_pooled_bitmap_count = 4;
+    Vector<NonnullRefPtr<Gfx::Bitmap>, max_pooled_bitmap_count> m_bitmap_pool;
+
     u64 m_skipped_frames { 0 };
 
     // This is a nested class to allow private access.
@@ -174,6 +174,28 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
     return {};
 }
 
+template<u32 subsampling_horizontal, u32 subsampling_vertical, u8 bit_depth, VideoFullRangeFlag range, typename T>
+static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_with_simple_converter(MatrixCoefficients matrix_coefficients, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+{
+    switch (matrix_coefficients) {
+    case MatrixCoefficients::BT470BG:
+    case MatrixCoefficients::BT601:
+        return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT601, range, bit_depth>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+    case MatrixCoefficients::BT709:
+        return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, range, bit_depth>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+template<u32 subsampling_horizontal, u32 subsampling_vertical, u8 bit_depth, typename T>
+static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_simple_converter(CodingIndependentCodePoints cicp, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+{
+    if (cicp.video_full_range_flag() == VideoFullRangeFlag::Full)
+        return convert_to_bitmap_with_simple_converter<subsampling_horizontal, subsampling_vertical, bit_depth, VideoFullRangeFlag::Full>(cicp.matrix_coefficients(), width, height, plane_y, plane_u, plane_v, bitmap);
+    return convert_to_bitmap_with_simple_converter<subsampling_horizontal, subsampling_vertical, bit_depth, VideoFullRangeFlag::Studio>(cicp.matrix_coefficients(), width, height, plane_y, plane_u, plane_v, bitmap);
+}
+
 template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T>
 static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_converter(CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void* plane_y_data, void* plane_u_data, void* plane_v_data, Gfx::Bitmap& bitmap)
 {
@@ -183,15 +205,21 @@ static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_converter(
 
     constexpr auto output_cicp = CodingIndependentCodePoints(ColorPrimaries::BT709, TransferCharacteristics::SRGB, MatrixCoefficients::BT709, VideoFullRangeFlag::Full);
 
-    if (bit_depth == 8 && cicp.transfer_characteristics() == output_cicp.transfer_characteristics() && cicp.color_primaries() == output_cicp.color_primaries() && cicp.video_full_range_flag() == VideoFullRangeFlag::Studio) {
-        switch (cicp.matrix_coefficients()) {
-        case MatrixCoefficients::BT470BG:
-        case MatrixCoefficients::BT601:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
-        case MatrixCoefficients::BT709:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
-        default:
-            break;
+    // Without transfer function or gamut changes, the conversion is just a matrix multiplication, which we can do
+    // entirely in fixed point.
+    bool can_use_simple_converter = cicp.transfer_characteristics() == output_cicp.transfer_characteristics()
+        && cicp.color_primaries() == output_cicp.color_primaries()
+        && first_is_one_of(cicp.video_full_range_flag(), VideoFullRangeFlag::Studio, VideoFullRangeFlag::Full)
+        && first_is_one_of(cicp.matrix_coefficients(), MatrixCoefficients::BT470BG, MatrixCoefficients::BT601, MatrixCoefficients::BT709);
+    if (can_use_simple_converter) {
+        if constexpr (IsSame<T, u8>) {
+            if (bit_depth == 8)
+                return convert_to_bitmap_selecting_simple_converter<subsampling_horizontal, subsampling_vertical, 8>(cicp, width, height, plane_y, plane_u, plane_v, bitmap);
+        } else {
+            if (bit_depth == 10)
+                return convert_to_bitmap_selecting_simple_converter<subsampling_horizontal, subsampling_vertical, 10>(cicp, width, height, plane_y, plane_u, plane_v, bitmap);
+            if (bit_depth == 12)
+                return convert_to_bitmap_selecting_simple_converter<subsampling_horizontal, subsampling_vertical, 12>(cicp, width, height, plane_y, plane_u, plane_v, bitmap);
         }
     }
 
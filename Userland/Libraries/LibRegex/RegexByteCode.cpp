@@ -329,42 +329,29 @@ ALWAYS_INLINE ExecutionResult OpCode_CheckEnd::execute(MatchInput const& input,
     return ExecutionResult::Failed_ExecuteLowPrioForks;
 }
 
-ALWAYS_INLINE ExecutionResult OpCode_ClearCaptureGroup::execute(MatchInput const& input, MatchState& state) const
+ALWAYS_INLINE ExecutionResult OpCode_ClearCaptureGroup::execute(MatchInput const&, MatchState& state) const
 {
-    if (input.match_index < state.capture_group_matches.size()) {
-        auto& group = state.capture_group_matches.mutable_at(input.match_index);
-        auto group_id = id();
-        if (group_id >= group.size())
-            group.resize(group_id + 1);
+    if (!state.capture_group_matches.is_empty()) {
+        if (id() >= state.capture_group_matches.size())
+            state.capture_group_matches.resize(id() + 1);
 
-        group[group_id].reset();
+        state.capture_group_matches.mutable_at(id()).reset();
     }
     return ExecutionResult::Continue;
 }
 
-ALWAYS_INLINE ExecutionResult OpCode_SaveLeftCaptureGroup::execute(MatchInput const& input, MatchState& state) const
+ALWAYS_INLINE ExecutionResult OpCode_SaveLeftCaptureGroup::execute(MatchInput const&, MatchState& state) const
 {
-    if (input.match_index >= state.capture_group_matches.size()) {
-        state.capture_group_matches.ensure_capacity(input.match_index);
-        auto capacity = state.capture_group_matches.capacity();
-        for (size_t i = state.capture_group_matches.size(); i <= capacity; ++i)
-            state.capture_group_matches.empend();
-    }
-
-    if (id() >= state.capture_group_matches.at(input.match_index).size()) {
-        state.capture_group_matches.mutable_at(input.match_index).ensure_capacity(id());
-        auto capacity = state.capture_group_matches.at(input.match_index).capacity();
-        for (size_t i = state.capture_group_matches.at(input.match_index).size(); i <= capacity; ++i)
-            state.capture_group_matches.mutable_at(input.match_index).empend();
-    }
+    if (id() >= state.capture_group_matches.size())
+        state.capture_group_matches.resize(id() + 1);
 
-    state.capture_group_matches.mutable_at(input.match_index).at(id()).left_column = state.string_position;
+    state.capture_group_matches.mutable_at(id()).left_column = state.string_position;
     return ExecutionResult::Continue;
 }
 
 ALWAYS_INLINE ExecutionResult OpCode_SaveRightCaptureGroup::execute(MatchInput const& input, MatchState& state) const
 {
-    auto& match = state.capture_group_matches.mutable_at(input.match_index).at(id());
+    auto& match = state.capture_group_matches.mutable_at(id());
     auto start_position = match.left_column;
     if (state.string_position < start_position) {
         dbgln("Right capture group {} is before left capture group {}!", state.string_position, start_position);
@@ -391,7 +378,7 @@ ALWAYS_INLINE ExecutionResult OpCode_SaveRightCaptureGroup::execute(MatchInput c
 
 ALWAYS_INLINE ExecutionResult OpCode_SaveRightNamedCaptureGroup::execute(MatchInput const& input, MatchState& state) const
 {
-    auto& match = state.capture_group_matches.mutable_at(input.match_index).at(id());
+    auto& match = state.capture_group_matches.mutable_at(id());
     auto start_position = match.left_column;
     if (state.string_position < start_position)
         return ExecutionResult::Failed_ExecuteLowPrioForks;
@@ -585,7 +572,7 @@ ALWAYS_INLINE ExecutionResult OpCode_Compare::execute(MatchInput const& input, M
         }
         case CharacterCompareType::Reference: {
             auto reference_number = (size_t)m_bytecode->at(offset++);
-            auto& groups = state.capture_group_matches.at(input.match_index);
+            auto& groups = state.capture_group_matches;
             if (groups.size() <= reference_number)
                 return ExecutionResult::Failed_ExecuteLowPrioForks;
 
@@ -947,6 +934,43 @@ Vector<CompareTypeAndValuePair> OpCode_Compare::flat_compares() const
     return result;
 }
 
+bool OpCode_Compare::compares_single_character() const
+{
+    size_t offset { state().instruction_position + 3 };
+
+    for (size_t i = 0; i < arguments_count(); ++i) {
+        auto compare_type = (CharacterCompareType)m_bytecode->at(offset++);
+
+        switch (compare_type) {
+        case CharacterCompareType::Inverse:
+        case CharacterCompareType::TemporaryInverse:
+        case CharacterCompareType::AnyChar:
+        case CharacterCompareType::And:
+        case CharacterCompareType::Or:
+        case CharacterCompareType::EndAndOr:
+            break;
+        case CharacterCompareType::Char:
+        case CharacterCompareType::CharClass:
+        case CharacterCompareType::CharRange:
+        case CharacterCompareType::Property:
+        case CharacterCompareType::GeneralCategory:
+        case CharacterCompareType::Script:
+        case CharacterCompareType::ScriptExtension:
+            ++offset;
+            break;
+        case CharacterCompareType::LookupTable:
+            offset += m_bytecode->at(offset) + 1;
+            break;
+        case CharacterCompareType::Undefined:
+        case CharacterCompareType::String:
+        case CharacterCompareType::Reference:
+        case CharacterCompareType::RangeExpressionDummy:
+            return false;
+        }
+    }
+    return true;
+}
+
 Vector<ByteString> OpCode_Compare::variable_arguments_to_byte_string(Optional<MatchInput const&> input) const
 {
     Vector<ByteString> result;
@@ -985,18 +1009,14 @@ Vector<ByteString> OpCode_Compare::variable_arguments_to_byte_string(Optional<Ma
             auto ref = m_bytecode->at(offset++);
             result.empend(ByteString::formatted(" number={}", ref));
             if (input.has_value()) {
-                if (state().capture_group_matches.size() > input->match_index) {
-                    auto& match = state().capture_group_matches[input->match_index];
-                    if (match.size() > ref) {
-                        auto& group = match[ref];
-                        result.empend(ByteString::formatted(" left={}", group.left_column));
-                        result.empend(ByteString::formatted(" right={}", group.left_column + group.view.length_in_code_units()));
-                        result.empend(ByteString::formatted(" contents='{}'", group.view));
-                    } else {
-                        result.empend(ByteString::formatted(" (invalid ref, max={})", match.size() - 1));
-                    }
+                auto& groups = state().capture_group_matches;
+                if (groups.size() > ref) {
+                    auto& group = groups[ref];
+                    result.empend(ByteString::formatted(" left={}", group.left_column));
+                    result.empend(ByteString::formatted(" right={}", group.left_column + group.view.length_in_code_units()));
+                    result.empend(ByteString::formatted(" contents='{}'", group.view));
                 } else {
-                    result.empend(ByteString::formatted(" (invalid index {}, max={})", input->match_index, state().capture_group_matches.size() - 1));
+                    result.empend(ByteString::formatted(" (invalid ref, max={})", groups.size() - 1));
                 }
             }
         } else if (compare_type == CharacterCompareType::String) {
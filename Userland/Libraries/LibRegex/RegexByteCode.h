@@ -763,6 +763,8 @@ public:
     ByteString arguments_string() const override;
     Vector<ByteString> variable_arguments_to_byte_string(Optional<MatchInput const&> input = {}) const;
     Vector<CompareTypeAndValuePair> flat_compares() const;
+    // Whether every compare in this op looks at exactly one character (e.g. no strings or backreferences).
+    bool compares_single_character() const;
     static bool matches_character_class(CharClass, u32, bool insensitive);
 
 private:
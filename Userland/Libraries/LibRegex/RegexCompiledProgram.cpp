@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <LibRegex/RegexCompiledProgram.h>
+
+namespace regex {
+
+OwnPtr<CompiledProgram> CompiledProgram::try_compile(ByteCode const& bytecode)
+{
+    auto bytecode_size = bytecode.size();
+    if (bytecode_size == 0)
+        return nullptr;
+
+    auto program = adopt_own(*new CompiledProgram);
+    HashMap<size_t, u32> instruction_indices;
+    Vector<size_t> next_positions;
+    Vector<size_t> target_positions;
+
+    auto jump_target = [](size_t position, size_t size, ssize_t offset) {
+        return static_cast<size_t>(static_cast<ssize_t>(position + size) + offset);
+    };
+
+    // Lookarounds, backreferences and the like need the full VM state; leave those patterns to the VM.
+    MatchState state;
+    while (state.instruction_position < bytecode_size) {
+        auto position = state.instruction_position;
+        auto& opcode = bytecode.get_opcode(state);
+
+        Instruction instruction { .kind = Kind::Fail, .bytecode_position = position };
+        Optional<size_t> target_position;
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            for (auto& entry : compare.flat_compares()) {
+                if (entry.type == CharacterCompareType::Reference)
+                    return nullptr;
+            }
+            instruction.kind = Kind::Compare;
+            if (compare.compares_single_character()) {
+                instruction.compare_cache = program->m_compare_caches.size();
+                program->m_compare_caches.empend();
+            }
+            break;
+        }
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+            instruction.kind = Kind::Check;
+            break;
+        case OpCodeId::Jump:
+            instruction.kind = Kind::Jump;
+            target_position = jump_target(position, opcode.size(), static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+            instruction.kind = Kind::ForkJump;
+            target_position = jump_target(position, opcode.size(), static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+            instruction.kind = Kind::ForkStay;
+            target_position = jump_target(position, opcode.size(), static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkReplaceJump:
+            instruction.kind = Kind::ForkReplaceJump;
+            target_position = jump_target(position, opcode.size(), static_cast<OpCode_ForkReplaceJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkReplaceStay:
+            instruction.kind = Kind::ForkReplaceStay;
+            target_position = jump_target(position, opcode.size(), static_cast<OpCode_ForkReplaceStay const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty: {
+            auto& jump = static_cast<OpCode_JumpNonEmpty const&>(opcode);
+            instruction.kind = Kind::JumpNonEmpty;
+            instruction.form = jump.form();
+            instruction.argument = jump.checkpoint();
+            target_position = jump_target(position, opcode.size(), jump.offset());
+            break;
+        }
+        case OpCodeId::Checkpoint:
+            instruction.kind = Kind::Checkpoint;
+            instruction.argument = static_cast<OpCode_Checkpoint const&>(opcode).id();
+            break;
+        case OpCodeId::SaveLeftCaptureGroup:
+            instruction.kind = Kind::SaveLeftCaptureGroup;
+            instruction.argument = static_cast<OpCode_SaveLeftCaptureGroup const&>(opcode).id();
+            break;
+        case OpCodeId::SaveRightCaptureGroup:
+            instruction.kind = Kind::SaveRightCaptureGroup;
+            instruction.argument = static_cast<OpCode_SaveRightCaptureGroup const&>(opcode).id();
+            break;
+        case OpCodeId::SaveRightNamedCaptureGroup:
+            instruction.kind = Kind::SaveRightCaptureGroup;
+            instruction.argument = static_cast<OpCode_SaveRightNamedCaptureGroup const&>(opcode).id();
+            instruction.name_position = position;
+            break;
+        case OpCodeId::ClearCaptureGroup:
+            instruction.kind = Kind::ClearCaptureGroup;
+            instruction.argument = static_cast<OpCode_ClearCaptureGroup const&>(opcode).id();
+            break;
+        case OpCodeId::Repeat: {
+            auto& repeat = static_cast<OpCode_Repeat const&>(opcode);
+            instruction.kind = Kind::Repeat;
+            instruction.argument = repeat.id();
+            instruction.count = repeat.count();
+            target_position = position - repeat.offset();
+            program->m_repeat_count = max(program->m_repeat_count, repeat.id() + 1);
+            break;
+        }
+        case OpCodeId::ResetRepeat:
+            instruction.kind = Kind::ResetRepeat;
+            instruction.argument = static_cast<OpCode_ResetRepeat const&>(opcode).id();
+            program->m_repeat_count = max(program->m_repeat_count, instruction.argument + 1);
+            break;
+        case OpCodeId::Exit:
+            // An explicit Exit before the end of the bytecode fails.
+            instruction.kind = Kind::Fail;
+            break;
+        default:
+            return nullptr;
+        }
+
+        switch (instruction.kind) {
+        case Kind::SaveLeftCaptureGroup:
+        case Kind::SaveRightCaptureGroup:
+        case Kind::ClearCaptureGroup:
+            program->m_capture_slot_count = max(program->m_capture_slot_count, instruction.argument + 1);
+            break;
+        default:
+            break;
+        }
+
+        instruction_indices.set(position, program->m_instructions.size());
+        program->m_instructions.append(instruction);
+        next_positions.append(position + opcode.size());
+        target_positions.append(target_position.value_or(position + opcode.size()));
+        state.instruction_position += opcode.size();
+    }
+
+    // Running off the end of the bytecode is how a match succeeds.
+    auto accept_index = static_cast<u32>(program->m_instructions.size());
+    program->m_instructions.append({ .kind = Kind::Accept, .bytecode_position = bytecode_size });
+
+    auto resolve = [&](size_t position) -> u32 {
+        if (position >= bytecode_size)
+            return accept_index;
+        return instruction_indices.get(position).value_or(no_target);
+    };
+
+    for (size_t i = 0; i < accept_index; ++i) {
+        auto& instruction = program->m_instructions[i];
+        instruction.next = resolve(next_positions[i]);
+        instruction.target = resolve(target_positions[i]);
+        if (instruction.next == no_target || instruction.target == no_target)
+            return nullptr;
+    }
+
+    return program;
+}
+
+bool CompiledProgram::can_handle(MatchInput const& input, MatchState const& state)
+{
+    // Positions are kept in code units, which only works while every character is a single one.
+    if (input.view.unicode() || !(input.view.is_string_view() || input.view.is_u16_view()))
+        return false;
+    if (input.regex_options.has_flag_set(AllFlags::StringCopyMatches))
+        return false;
+    if (input.fail_counter != 0 || input.fork_to_replace.has_value())
+        return false;
+    return state.instruction_position == 0 && state.capture_group_matches.is_empty() && state.repetition_marks.is_empty();
+}
+
+void CompiledProgram::prepare(MatchInput const& input)
+{
+    // Compare verdicts depend on the options (e.g. case insensitivity) and on how characters are read from the view.
+    if (m_options == input.regex_options.value() && m_u16_view == input.view.is_u16_view())
+        return;
+
+    m_options = input.regex_options.value();
+    m_u16_view = input.view.is_u16_view();
+    for (auto& cache : m_compare_caches)
+        cache.fill(CompareResult::Unknown);
+}
+
+Optional<size_t> CompiledProgram::compare(ByteCode const& bytecode, MatchInput const& input, Instruction const& instruction, size_t position, bool& bail_out)
+{
+    CompareResult* cached_result = nullptr;
+    if (instruction.compare_cache.has_value() && position < input.view.length()) {
+        u32 code_point = input.view[position];
+        u32 code_unit = input.view.code_unit_at(position);
+        if (code_point == code_unit && code_point < 128) {
+            cached_result = &m_compare_caches[*instruction.compare_cache][code_point];
+            if (*cached_result == CompareResult::Accept)
+                return position + 1;
+            if (*cached_result == CompareResult::Reject)
+                return {};
+        }
+    }
+
+    // Let the real compare op decide, so the two can't disagree.
+    MatchState state;
+    state.instruction_position = instruction.bytecode_position;
+    state.string_position = position;
+    state.string_position_in_code_units = position;
+
+    auto& opcode = bytecode.get_opcode(state);
+    switch (opcode.execute(input, state)) {
+    case ExecutionResult::Continue:
+        if (state.string_position != state.string_position_in_code_units) {
+            bail_out = true;
+            return {};
+        }
+        if (cached_result && state.string_position == position + 1)
+            *cached_result = CompareResult::Accept;
+        return state.string_position;
+    case ExecutionResult::Failed:
+    case ExecutionResult::Failed_ExecuteLowPrioForks:
+        if (cached_result)
+            *cached_result = CompareResult::Reject;
+        return {};
+    default:
+        bail_out = true;
+        return {};
+    }
+}
+
+bool CompiledProgram::check(ByteCode const& bytecode, MatchInput const& input, Instruction const& instruction, size_t position) const
+{
+    MatchState state;
+    state.instruction_position = instruction.bytecode_position;
+    state.string_position = position;
+    state.string_position_in_code_units = position;
+
+    auto& opcode = bytecode.get_opcode(state);
+    return opcode.execute(input, state) == ExecutionResult::Continue;
+}
+
+void CompiledProgram::push(u32 instruction, size_t string_position, size_t initiating_fork, Optional<size_t> fork_to_replace)
+{
+    auto store = [&](size_t index) {
+        m_backtrack_stack[index] = { instruction, string_position, initiating_fork, m_capture_count };
+        for (size_t i = 0; i < m_capture_slot_count; ++i)
+            m_backtrack_captures[index * m_capture_slot_count + i] = m_captures[i];
+        for (size_t i = 0; i < m_repeat_count; ++i)
+            m_backtrack_repetition_marks[index * m_repeat_count + i] = m_repetition_marks[i];
+    };
+
+    // Same as the VM: a replacing fork overwrites the state its previous run left behind instead of adding another one.
+    if (fork_to_replace.has_value()) {
+        for (size_t index = m_backtrack_stack.size(); index > 0; --index) {
+            if (m_backtrack_stack[index - 1].initiating_fork == *fork_to_replace) {
+                store(index - 1);
+                return;
+            }
+        }
+    }
+
+    m_backtrack_stack.empend();
+    m_backtrack_captures.resize(m_backtrack_stack.size() * m_capture_slot_count);
+    m_backtrack_repetition_marks.resize(m_backtrack_stack.size() * m_repeat_count);
+    store(m_backtrack_stack.size() - 1);
+}
+
+void CompiledProgram::write_captures(ByteCode const& bytecode, MatchInput const& input, MatchState& state) const
+{
+    for (size_t i = 0; i < m_capture_count; ++i) {
+        auto& slot = m_captures[i];
+
+        Match match;
+        switch (slot.kind) {
+        case CaptureSlot::Kind::Unset:
+            break;
+        case CaptureSlot::Kind::Cleared:
+            match.view = input.view.typed_null_view();
+            break;
+        case CaptureSlot::Kind::Set: {
+            auto view = input.view.substring_view(slot.start, slot.length);
+            if (slot.name_position != no_name) {
+                MatchState name_state;
+                name_state.instruction_position = slot.name_position;
+                auto name = static_cast<OpCode_SaveRightNamedCaptureGroup const&>(bytecode.get_opcode(name_state)).name();
+                match = { view, name, input.line, slot.start, input.global_offset + slot.start };
+            } else {
+                match = { view, input.line, slot.start, input.global_offset + slot.start };
+            }
+            break;
+        }
+        }
+        match.left_column = slot.left_column;
+        state.capture_group_matches.append(move(match));
+    }
+}
+
+CompiledProgram::Result CompiledProgram::execute(ByteCode const& bytecode, MatchInput const& input, MatchState& state, size_t& operations)
+{
+    prepare(input);
+
+    m_capture_count = 0;
+    m_captures.resize(m_capture_slot_count);
+    m_repetition_marks.clear_with_capacity();
+    m_repetition_marks.resize(m_repeat_count);
+    m_backtrack_stack.clear_with_capacity();
+    m_backtrack_captures.clear_with_capacity();
+    m_backtrack_repetition_marks.clear_with_capacity();
+
+    u32 instruction_index = 0;
+    size_t string_position = state.string_position;
+
+    for (;;) {
+        auto const& instruction = m_instructions[instruction_index];
+        ++operations;
+
+        bool failed = false;
+        switch (instruction.kind) {
+        case Kind::Compare: {
+            bool bail_out = false;
+            auto next_position = compare(bytecode, input, instruction, string_position, bail_out);
+            if (bail_out)
+                return Result::Unknown;
+            if (next_position.has_value()) {
+                string_position = *next_position;
+                instruction_index = instruction.next;
+            } else {
+                failed = true;
+            }
+            break;
+        }
+        case Kind::Check:
+            if (check(bytecode, input, instruction, string_position))
+                instruction_index = instruction.next;
+            else
+                failed = true;
+            break;
+        case Kind::Jump:
+            instruction_index = instruction.target;
+            break;
+        case Kind::ForkJump:
+            push(instruction.next, string_position, instruction.bytecode_position, {});
+            instruction_index = instruction.target;
+            break;
+        case Kind::ForkStay:
+            push(instruction.target, string_position, instruction.bytecode_position, {});
+            instruction_index = instruction.next;
+            break;
+        case Kind::ForkReplaceJump:
+            push(instruction.next, string_position, instruction.bytecode_position, instruction.bytecode_position);
+            instruction_index = instruction.target;
+            break;
+        case Kind::ForkReplaceStay:
+            push(instruction.target, string_position, instruction.bytecode_position, instruction.bytecode_position);
+            instruction_index = instruction.next;
+            break;
+        case Kind::JumpNonEmpty: {
+            auto checkpoint_position = input.checkpoints[instruction.argument];
+            instruction_index = instruction.next;
+            if (checkpoint_position == 0 || checkpoint_position == string_position + 1)
+                break;
+
+            switch (instruction.form) {
+            case OpCodeId::Jump:
+                instruction_index = instruction.target;
+                break;
+            case OpCodeId::ForkJump:
+                push(instruction.next, string_position, instruction.bytecode_position, {});
+                instruction_index = instruction.target;
+                break;
+            case OpCodeId::ForkStay:
+                push(instruction.target, string_position, instruction.bytecode_position, {});
+                break;
+            case OpCodeId::ForkReplaceJump:
+                push(instruction.next, string_position, instruction.bytecode_position, instruction.bytecode_position);
+                instruction_index = instruction.target;
+                break;
+            case OpCodeId::ForkReplaceStay:
+                push(instruction.target, string_position, instruction.bytecode_position, instruction.bytecode_position);
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+        case Kind::Checkpoint:
+            if (instruction.argument >= input.checkpoints.size())
+                input.checkpoints.resize(instruction.argument + 1);
+            input.checkpoints[instruction.argument] = string_position + 1;
+            instruction_index = instruction.next;
+            break;
+        case Kind::SaveLeftCaptureGroup:
+            for (; m_capture_count <= instruction.argument; ++m_capture_count)
+                m_captures[m_capture_count] = {};
+            m_captures[instruction.argument].left_column = string_position;
+            instruction_index = instruction.next;
+            break;
+        case Kind::SaveRightCaptureGroup: {
+            if (instruction.argument >= m_capture_count)
+                return Result::Unknown;
+
+            auto& slot = m_captures[instruction.argument];
+            auto start_position = slot.left_column;
+            if (string_position < start_position) {
+                failed = true;
+                break;
+            }
+
+            instruction_index = instruction.next;
+            auto column = slot.kind == CaptureSlot::Kind::Set ? slot.start : 0;
+            if (start_position < column)
+                break;
+
+            VERIFY(string_position <= input.view.length());
+            slot = { CaptureSlot::Kind::Set, start_position, start_position, string_position - start_position, instruction.name_position };
+            break;
+        }
+        case Kind::ClearCaptureGroup:
+            if (m_capture_count > 0) {
+                for (; m_capture_count <= instruction.argument; ++m_capture_count)
+                    m_captures[m_capture_count] = {};
+                auto& slot = m_captures[instruction.argument];
+                slot = { slot.kind == CaptureSlot::Kind::Unset ? CaptureSlot::Kind::Unset : CaptureSlot::Kind::Cleared };
+            }
+            instruction_index = instruction.next;
+            break;
+        case Kind::Repeat: {
+            auto& repetition_mark = m_repetition_marks[instruction.argument];
+            if (repetition_mark == instruction.count - 1) {
+                repetition_mark = 0;
+                instruction_index = instruction.next;
+            } else {
+                ++repetition_mark;
+                instruction_index = instruction.target;
+            }
+            break;
+        }
+        case Kind::ResetRepeat:
+            m_repetition_marks[instruction.argument] = 0;
+            instruction_index = instruction.next;
+            break;
+        case Kind::Fail:
+            failed = true;
+            break;
+        case Kind::Accept:
+            state.string_position = string_position;
+            state.string_position_in_code_units = string_position;
+            write_captures(bytecode, input, state);
+            return Result::Match;
+        }
+
+        if (!failed)
+            continue;
+
+        if (m_backtrack_stack.is_empty())
+            return Result::NoMatch;
+
+        auto entry = m_backtrack_stack.take_last();
+        auto index = m_backtrack_stack.size();
+        instruction_index = entry.instruction;
+        string_position = entry.string_position;
+        m_capture_count = entry.capture_count;
+        for (size_t i = 0; i < m_capture_slot_count; ++i)
+            m_captures[i] = m_backtrack_captures[index * m_capture_slot_count + i];
+        for (size_t i = 0; i < m_repeat_count; ++i)
+            m_repetition_marks[i] = m_backtrack_repetition_marks[index * m_repeat_count + i];
+        m_backtrack_captures.shrink(index * m_capture_slot_count, true);
+        m_backtrack_repetition_marks.shrink(index * m_repeat_count, true);
+    }
+}
+
+}
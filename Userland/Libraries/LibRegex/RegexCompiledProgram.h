@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+#include "RegexMatch.h"
+
+#include <AK/Array.h>
+#include <AK/NumericLimits.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// A pre-decoded form of the bytecode for patterns that are matched often.
+// Jump targets are resolved to instruction indices, single character compares remember their verdict for ASCII input,
+// and backtracking keeps plain position/capture records on one stack instead of copying whole MatchStates.
+// The result (match, captures and operation count) is exactly what the bytecode VM would have produced.
+class CompiledProgram {
+public:
+    enum class Result {
+        Match,
+        NoMatch,
+        Unknown,
+    };
+
+    static OwnPtr<CompiledProgram> try_compile(ByteCode const&);
+
+    static bool can_handle(MatchInput const&, MatchState const&);
+
+    Result execute(ByteCode const&, MatchInput const&, MatchState&, size_t& operations);
+
+private:
+    static constexpr u32 no_target = NumericLimits<u32>::max();
+    static constexpr size_t no_name = NumericLimits<size_t>::max();
+
+    enum class Kind : u8 {
+        Compare,
+        Check,
+        Jump,
+        ForkJump,
+        ForkStay,
+        ForkReplaceJump,
+        ForkReplaceStay,
+        JumpNonEmpty,
+        Checkpoint,
+        SaveLeftCaptureGroup,
+        SaveRightCaptureGroup,
+        ClearCaptureGroup,
+        Repeat,
+        ResetRepeat,
+        Fail,
+        Accept,
+    };
+
+    struct Instruction {
+        Kind kind;
+        OpCodeId form { OpCodeId::Jump };
+        u32 next { no_target };
+        u32 target { no_target };
+        size_t bytecode_position { 0 };
+        size_t argument { 0 };
+        u64 count { 0 };
+        size_t name_position { no_name };
+        Optional<u32> compare_cache;
+    };
+
+    struct CaptureSlot {
+        enum class Kind : u8 {
+            Unset,
+            Cleared,
+            Set,
+        };
+
+        Kind kind { Kind::Unset };
+        size_t left_column { 0 };
+        size_t start { 0 };
+        size_t length { 0 };
+        size_t name_position { no_name };
+    };
+
+    struct BacktrackEntry {
+        u32 instruction;
+        size_t string_position;
+        size_t initiating_fork;
+        size_t capture_count;
+    };
+
+    enum class CompareResult : u8 {
+        Unknown,
+        Accept,
+        Reject,
+    };
+
+    CompiledProgram() = default;
+
+    void prepare(MatchInput const&);
+    Optional<size_t> compare(ByteCode const&, MatchInput const&, Instruction const&, size_t position, bool& bail_out);
+    bool check(ByteCode const&, MatchInput const&, Instruction const&, size_t position) const;
+    void push(u32 instruction, size_t string_position, size_t initiating_fork, Optional<size_t> fork_to_replace);
+    void write_captures(ByteCode const&, MatchInput const&, MatchState&) const;
+
+    Vector<Instruction> m_instructions;
+    size_t m_capture_slot_count { 0 };
+    size_t m_repeat_count { 0 };
+
+    Vector<Array<CompareResult, 128>> m_compare_caches;
+    Optional<AllFlags> m_options;
+    bool m_u16_view { false };
+
+    // Working storage, kept around so repeated matches don't allocate.
+    Vector<CaptureSlot> m_captures;
+    size_t m_capture_count { 0 };
+    Vector<u64> m_repetition_marks;
+    Vector<BacktrackEntry> m_backtrack_stack;
+    Vector<CaptureSlot> m_backtrack_captures;
+    Vector<u64> m_backtrack_repetition_marks;
+};
+
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/QuickSort.h>
+#include <LibRegex/RegexDFA.h>
+
+namespace regex {
+
+OwnPtr<LazyDFA> LazyDFA::try_create(ByteCode const& bytecode)
+{
+    auto bytecode_size = bytecode.size();
+    if (bytecode_size == 0)
+        return nullptr;
+
+    // Anything that looks around, anchors, counts or refers back needs state a DFA can't carry; leave those to the VM.
+    MatchState state;
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            if (!static_cast<OpCode_Compare const&>(opcode).compares_single_character())
+                return nullptr;
+            break;
+        case OpCodeId::Jump:
+        case OpCodeId::JumpNonEmpty:
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::Exit:
+            break;
+        default:
+            return nullptr;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    return adopt_own(*new LazyDFA);
+}
+
+bool LazyDFA::can_handle(MatchInput const& input)
+{
+    // In unicode mode a character may span several code units, which the transition cache doesn't know about.
+    if (input.view.unicode())
+        return false;
+    return input.view.is_string_view() || input.view.is_u16_view();
+}
+
+unsigned LazyDFA::StateKeyTraits::hash(StateKey const& key)
+{
+    unsigned hash = pair_int_hash(key.accepting, key.unanchored);
+    for (auto position : key.compare_positions)
+        hash = pair_int_hash(hash, u64_hash(position));
+    return hash;
+}
+
+void LazyDFA::prepare(ByteCode const& bytecode, MatchInput const& input)
+{
+    // Transitions depend on the options (e.g. case insensitivity) and on how characters are read from the view.
+    if (m_options == input.regex_options.value() && m_u16_view == input.view.is_u16_view())
+        return;
+
+    m_options = input.regex_options.value();
+    m_u16_view = input.view.is_u16_view();
+    m_states.clear();
+    m_state_indices.clear();
+
+    intern({});
+    m_anchored_start = intern(closure(bytecode, { 0 }, false));
+    m_unanchored_start = intern(closure(bytecode, { 0 }, true));
+}
+
+LazyDFA::Result LazyDFA::match_at(ByteCode const& bytecode, MatchInput const& input, size_t position)
+{
+    prepare(bytecode, input);
+    return run(bytecode, input, position, m_anchored_start);
+}
+
+LazyDFA::Result LazyDFA::search_from(ByteCode const& bytecode, MatchInput const& input, size_t position)
+{
+    prepare(bytecode, input);
+    return run(bytecode, input, position, m_unanchored_start);
+}
+
+LazyDFA::Result LazyDFA::run(ByteCode const& bytecode, MatchInput const& input, size_t position, u32 state_index)
+{
+    auto length = input.view.length();
+    for (;;) {
+        if (state_index == unknown_state)
+            return Result::Unknown;
+        if (m_states[state_index].key.accepting)
+            return Result::Match;
+        if (state_index == dead_state || position >= length)
+            return Result::NoMatch;
+
+        state_index = transition(bytecode, input, state_index, position);
+        ++position;
+    }
+}
+
+u32 LazyDFA::transition(ByteCode const& bytecode, MatchInput const& input, u32 state_index, size_t position)
+{
+    u32 code_point = input.view[position];
+    u32 code_unit = input.view.code_unit_at(position);
+
+    if (code_point == code_unit && code_point < 128) {
+        auto next = m_states[state_index].ascii_transitions[code_point];
+        if (next == uncomputed_transition) {
+            next = compute_transition(bytecode, input, state_index, position);
+            m_states[state_index].ascii_transitions[code_point] = next;
+        }
+        return next;
+    }
+
+    u64 cache_key = (static_cast<u64>(code_point) << 32) | code_unit;
+    if (auto next = m_states[state_index].transitions.get(cache_key); next.has_value())
+        return *next;
+
+    auto next = compute_transition(bytecode, input, state_index, position);
+    m_states[state_index].transitions.set(cache_key, next);
+    return next;
+}
+
+u32 LazyDFA::compute_transition(ByteCode const& bytecode, MatchInput const& input, u32 state_index, size_t position)
+{
+    Vector<size_t> targets;
+
+    // Let the real compare op decide whether it accepts this character, so the DFA can't disagree with the VM.
+    for (auto compare_position : m_states[state_index].key.compare_positions) {
+        MatchState state;
+        state.instruction_position = compare_position;
+        state.string_position = position;
+        state.string_position_in_code_units = position;
+
+        auto& opcode = bytecode.get_opcode(state);
+        auto result = opcode.execute(input, state);
+        switch (result) {
+        case ExecutionResult::Continue:
+            if (state.string_position != position + 1 || state.string_position_in_code_units != position + 1)
+                return unknown_state;
+            targets.append(compare_position + opcode.size());
+            break;
+        case ExecutionResult::Failed:
+        case ExecutionResult::Failed_ExecuteLowPrioForks:
+            break;
+        default:
+            return unknown_state;
+        }
+    }
+
+    auto unanchored = m_states[state_index].key.unanchored;
+    if (unanchored)
+        targets.append(0);
+
+    return intern(closure(bytecode, move(targets), unanchored));
+}
+
+LazyDFA::StateKey LazyDFA::closure(ByteCode const& bytecode, Vector<size_t> roots, bool unanchored) const
+{
+    StateKey key;
+    key.unanchored = unanchored;
+
+    auto bytecode_size = bytecode.size();
+    HashTable<size_t> visited;
+    auto& to_visit = roots;
+
+    while (!to_visit.is_empty()) {
+        auto position = to_visit.take_last();
+        if (visited.contains(position))
+            continue;
+        visited.set(position);
+
+        if (position >= bytecode_size) {
+            key.accepting = true;
+            continue;
+        }
+
+        MatchState state;
+        state.instruction_position = position;
+        auto& opcode = bytecode.get_opcode(state);
+        auto next_position = position + opcode.size();
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            key.compare_positions.append(position);
+            break;
+        case OpCodeId::Jump:
+            to_visit.append(next_position + static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            to_visit.append(next_position);
+            to_visit.append(next_position + static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            to_visit.append(next_position);
+            to_visit.append(next_position + static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            // Whether the jump is taken depends on the checkpoint, so allow both ways.
+            to_visit.append(next_position);
+            to_visit.append(next_position + static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+            to_visit.append(next_position);
+            break;
+        case OpCodeId::Exit:
+            // An explicit Exit before the end of the bytecode fails.
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    quick_sort(key.compare_positions);
+    return key;
+}
+
+u32 LazyDFA::intern(StateKey key)
+{
+    // Every state that can never reach an accepting one collapses into the dead state.
+    if (key.compare_positions.is_empty() && !key.accepting && !m_states.is_empty())
+        return dead_state;
+
+    if (auto index = m_state_indices.get(key); index.has_value())
+        return *index;
+
+    if (m_states.size() >= max_state_count)
+        return unknown_state;
+
+    auto index = static_cast<u32>(m_states.size());
+    m_state_indices.set(key, index);
+
+    State state;
+    state.key = move(key);
+    state.ascii_transitions.fill(uncomputed_transition);
+    m_states.append(move(state));
+    return index;
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "RegexByteCode.h"
+#include "RegexMatch.h"
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// A lazily built DFA for bytecode that only consists of character compares, jumps, forks and capture bookkeeping.
+// It tells the matcher where a match can not possibly start, so the backtracking VM only runs on positions that have a
+// chance; the VM still decides which match is found and what the capture groups contain.
+class LazyDFA {
+public:
+    enum class Result {
+        Match,
+        NoMatch,
+        Unknown,
+    };
+
+    static OwnPtr<LazyDFA> try_create(ByteCode const&);
+
+    static bool can_handle(MatchInput const&);
+
+    // Whether any match can start at exactly `position`.
+    Result match_at(ByteCode const&, MatchInput const&, size_t position);
+    // Whether any match can start at `position` or later.
+    Result search_from(ByteCode const&, MatchInput const&, size_t position);
+
+private:
+    static constexpr size_t max_state_count = 2048;
+    static constexpr u32 dead_state = 0;
+    static constexpr u32 unknown_state = NumericLimits<u32>::max() - 1;
+    static constexpr u32 uncomputed_transition = NumericLimits<u32>::max();
+
+    struct StateKey {
+        Vector<size_t> compare_positions;
+        bool accepting { false };
+        bool unanchored { false };
+
+        bool operator==(StateKey const&) const = default;
+    };
+
+    struct StateKeyTraits : public DefaultTraits<StateKey> {
+        static unsigned hash(StateKey const&);
+    };
+
+    struct State {
+        StateKey key;
+        Array<u32, 128> ascii_transitions;
+        HashMap<u64, u32> transitions;
+    };
+
+    LazyDFA() = default;
+
+    void prepare(ByteCode const&, MatchInput const&);
+    Result run(ByteCode const&, MatchInput const&, size_t position, u32 state_index);
+    u32 transition(ByteCode const&, MatchInput const&, u32 state_index, size_t position);
+    u32 compute_transition(ByteCode const&, MatchInput const&, u32 state_index, size_t position);
+    StateKey closure(ByteCode const&, Vector<size_t> roots, bool unanchored) const;
+    u32 intern(StateKey);
+
+    Vector<State> m_states;
+    HashMap<StateKey, u32, StateKeyTraits> m_state_indices;
+    u32 m_anchored_start { dead_state };
+    u32 m_unanchored_start { dead_state };
+
+    Optional<AllFlags> m_options;
+    bool m_u16_view { false };
+};
+
+}
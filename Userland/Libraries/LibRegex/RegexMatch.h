@@ -67,6 +67,11 @@ public:
         return m_view.has<StringView>();
     }
 
+    bool is_u16_view() const
+    {
+        return m_view.has<Utf16View>();
+    }
+
     StringView string_view() const
     {
         return m_view.get<StringView>();
@@ -139,7 +144,7 @@ public:
             });
     }
 
-    RegexStringView typed_null_view()
+    RegexStringView typed_null_view() const
     {
         auto view = m_view.visit(
             [&]<typename T>(T const&) {
@@ -560,7 +565,8 @@ struct MatchState {
     size_t forks_since_last_save { 0 };
     Optional<size_t> initiating_fork;
     COWVector<Match> matches;
-    COWVector<Vector<Match>> capture_group_matches;
+    // The capture groups of the current attempt, indexed by group id.
+    COWVector<Match> capture_group_matches;
     COWVector<u64> repetition_marks;
 };
 
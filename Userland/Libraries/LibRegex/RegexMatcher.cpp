@@ -21,6 +21,36 @@ namespace regex {
 static RegexDebug s_regex_dbg(stderr);
 #endif
 
+static Optional<size_t> find_literal(RegexStringView const& view, StringView literal, size_t start)
+{
+    if (view.is_string_view())
+        return view.string_view().find(literal, start);
+
+    auto const& utf16_view = view.u16_view();
+    auto length = utf16_view.length_in_code_units();
+    for (size_t i = start; i + literal.length() <= length; ++i) {
+        if (utf16_view.code_unit_at(i) != static_cast<u16>(literal[0]))
+            continue;
+        size_t j = 1;
+        while (j < literal.length() && utf16_view.code_unit_at(i + j) == static_cast<u16>(literal[j]))
+            ++j;
+        if (j == literal.length())
+            return i;
+    }
+    return {};
+}
+
+static bool literal_matches_at(RegexStringView const& view, StringView literal, size_t position)
+{
+    if (position + literal.length() > view.length())
+        return false;
+    for (size_t i = 0; i < literal.length(); ++i) {
+        if (view.code_unit_at(position + i) != static_cast<u8>(literal[i]))
+            return false;
+    }
+    return true;
+}
+
 template<class Parser>
 regex::Parser::Result Regex<Parser>::parse_pattern(StringView pattern, typename ParserTraits<Parser>::OptionsType regex_options)
 {
@@ -54,6 +84,21 @@ Regex<Parser>::Regex(regex::Parser::Result parse_result, ByteString pattern, typ
         matcher = make<Matcher<Parser>>(this, regex_options | static_cast<decltype(regex_options.value())>(parse_result.options.value()));
 }
 
+template<class Parser>
+Regex<Parser>::Regex(AlreadyOptimizedTag, regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
+    : pattern_value(move(pattern))
+    , parser_result(move(parse_result))
+{
+    if (parser_result.error == regex::Error::NoError)
+        matcher = make<Matcher<Parser>>(this, regex_options | static_cast<decltype(regex_options.value())>(parser_result.options.value()));
+}
+
+template<class Parser>
+Regex<Parser> Regex<Parser>::from_optimized_parser_result(regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
+{
+    return Regex(AlreadyOptimizedTag {}, move(parse_result), move(pattern), regex_options);
+}
+
 template<class Parser>
 Regex<Parser>::Regex(Regex&& regex)
     : pattern_value(move(regex.pattern_value))
@@ -125,6 +170,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     MatchInput input;
     MatchState state;
+    Vector<Vector<Match>> capture_group_matches;
     size_t operations = 0;
 
     input.regex_options = m_regex_options | regex_options.value_or({}).value();
@@ -151,22 +197,21 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     if (c_match_preallocation_count) {
         state.matches.ensure_capacity(c_match_preallocation_count);
-        state.capture_group_matches.ensure_capacity(c_match_preallocation_count);
-        auto& capture_groups_count = m_pattern->parser_result.capture_groups_count;
+        capture_group_matches.ensure_capacity(c_match_preallocation_count);
 
-        for (size_t j = 0; j < c_match_preallocation_count; ++j) {
+        for (size_t j = 0; j < c_match_preallocation_count; ++j)
             state.matches.empend();
-            state.capture_group_matches.empend();
-            state.capture_group_matches.mutable_at(j).ensure_capacity(capture_groups_count);
-            for (size_t k = 0; k < capture_groups_count; ++k)
-                state.capture_group_matches.mutable_at(j).unchecked_append({});
-        }
     }
 
-    auto append_match = [](auto& input, auto& state, auto& start_position) {
+    auto append_match = [&capture_group_matches](auto& input, auto& state, auto& start_position) {
         if (state.matches.size() == input.match_index)
             state.matches.empend();
 
+        // Only the groups of the successful attempt are kept, the ones from attempts that failed never leave the state.
+        if (capture_group_matches.size() == input.match_index)
+            capture_group_matches.empend();
+        capture_group_matches[input.match_index] = move(state.capture_group_matches).release();
+
         VERIFY(start_position + state.string_position - start_position <= input.view.length());
         if (input.regex_options.has_flag_set(AllFlags::StringCopyMatches)) {
             state.matches.mutable_at(input.match_index) = { input.view.substring_view(start_position, state.string_position - start_position).to_byte_string(), input.line, start_position, input.global_offset + start_position };
@@ -201,6 +246,18 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         state.string_position_in_code_units = view_index;
         bool succeeded = false;
 
+        // Literals that every match needs let us skip ahead with a plain substring search.
+        auto& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+        auto& required_substring = m_pattern->parser_result.optimization_data.required_substring;
+        bool use_literals = !view.unicode()
+            && !input.regex_options.has_flag_set(AllFlags::Insensitive)
+            && (view.is_string_view() || view.is_u16_view());
+        Optional<size_t> required_substring_position;
+
+        // The DFA can rule out start positions (or the whole rest of the view) without backtracking.
+        bool use_dfa = m_dfa && LazyDFA::can_handle(input);
+        bool dfa_needs_search = use_dfa;
+
         if (view_index == view_length && m_pattern->parser_result.match_length_minimum == 0) {
             // Run the code until it tries to consume something.
             // This allows non-consuming code to run on empty strings, for instance
@@ -213,7 +270,8 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.string_position = view_index;
             state.string_position_in_code_units = view_index;
             state.instruction_position = 0;
-            state.repetition_marks.clear();
+            state.repetition_marks.clear_with_capacity();
+            state.capture_group_matches.clear_with_capacity();
 
             auto success = execute(input, state, temp_operations);
             // This success is acceptable only if it doesn't read anything from the input (input length is 0).
@@ -236,6 +294,23 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (view_index == view_length && input.regex_options.has_flag_set(AllFlags::Multiline))
                 break;
 
+            if (use_literals && literal_prefix.has_value()) {
+                if (continue_search && !only_start_of_line) {
+                    auto next_candidate = find_literal(view, *literal_prefix, view_index);
+                    if (!next_candidate.has_value())
+                        break;
+                    view_index = *next_candidate;
+                } else if (!literal_matches_at(view, *literal_prefix, view_index)) {
+                    break;
+                }
+            } else if (use_literals && required_substring.has_value()) {
+                if (!required_substring_position.has_value() || *required_substring_position < view_index) {
+                    required_substring_position = find_literal(view, *required_substring, view_index);
+                    if (!required_substring_position.has_value())
+                        break;
+                }
+            }
+
             auto& match_length_minimum = m_pattern->parser_result.match_length_minimum;
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
@@ -252,7 +327,22 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.string_position = view_index;
             state.string_position_in_code_units = view_index;
             state.instruction_position = 0;
-            state.repetition_marks.clear();
+            state.repetition_marks.clear_with_capacity();
+            state.capture_group_matches.clear_with_capacity();
+
+            if (use_dfa) {
+                auto& bytecode = m_pattern->parser_result.bytecode;
+                if (dfa_needs_search) {
+                    dfa_needs_search = false;
+                    if (m_dfa->search_from(bytecode, input, view_index) == LazyDFA::Result::NoMatch)
+                        break;
+                }
+                if (m_dfa->match_at(bytecode, input, view_index) == LazyDFA::Result::NoMatch) {
+                    if (!continue_search || only_start_of_line)
+                        break;
+                    continue;
+                }
+            }
 
             auto success = execute(input, state, operations);
             if (success) {
@@ -276,6 +366,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
                 if (continue_search) {
                     append_match(input, state, view_index);
+                    dfa_needs_search = use_dfa;
 
                     bool has_zero_length = state.string_position == view_index;
                     view_index = state.string_position - (has_zero_length ? 0 : 1);
@@ -313,7 +404,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         match_count != 0,
         match_count,
         move(state.matches).release(),
-        move(state.capture_group_matches).release(),
+        move(capture_group_matches),
         operations,
         m_pattern->parser_result.capture_groups_count,
         m_pattern->parser_result.named_capture_groups_count,
@@ -440,13 +531,28 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
         return true;
     }
 
+    auto& bytecode = m_pattern->parser_result.bytecode;
+
+    // Patterns that keep getting executed are worth translating into a form that is cheaper to run.
+    if (m_executions_until_compilation > 0 && --m_executions_until_compilation == 0)
+        m_compiled_program = CompiledProgram::try_compile(bytecode);
+
+    if (m_compiled_program && CompiledProgram::can_handle(input, state)) {
+        auto operations_before = operations;
+        auto result = m_compiled_program->execute(bytecode, input, state, operations);
+        if (result != CompiledProgram::Result::Unknown)
+            return result == CompiledProgram::Result::Match;
+
+        // The compiled program ran into something it doesn't model, so leave this pattern to the VM from now on.
+        operations = operations_before;
+        m_compiled_program = nullptr;
+    }
+
     BumpAllocatedLinkedList<MatchState> states_to_try_next;
 #if REGEX_DEBUG
     size_t recursion_level = 0;
 #endif
 
-    auto& bytecode = m_pattern->parser_result.bytecode;
-
     for (;;) {
         auto& opcode = bytecode.get_opcode(state);
         ++operations;
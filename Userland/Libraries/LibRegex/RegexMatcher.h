@@ -7,6 +7,8 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexCompiledProgram.h"
+#include "RegexDFA.h"
 #include "RegexMatch.h"
 #include "RegexOptions.h"
 #include "RegexParser.h"
@@ -34,6 +36,7 @@ struct Block {
 
 static constexpr size_t const c_max_recursion = 5000;
 static constexpr size_t const c_match_preallocation_count = 0;
+static constexpr size_t const c_compilation_threshold = 64;
 
 struct RegexResult final {
     bool success { false };
@@ -56,6 +59,8 @@ public:
         : m_pattern(pattern)
         , m_regex_options(regex_options.value_or({}))
     {
+        if (!pattern->parser_result.optimization_data.pure_substring_search.has_value())
+            m_dfa = LazyDFA::try_create(pattern->parser_result.bytecode);
     }
     ~Matcher() = default;
 
@@ -77,6 +82,9 @@ private:
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+    mutable OwnPtr<LazyDFA> m_dfa;
+    mutable OwnPtr<CompiledProgram> m_compiled_program;
+    mutable size_t m_executions_until_compilation { c_compilation_threshold };
 };
 
 template<class Parser>
@@ -92,6 +100,10 @@ public:
     explicit Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
     Regex(regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
     ~Regex() = default;
+
+    // Wraps the parser result of another Regex (which has already been optimized) without running the optimization passes again.
+    static Regex from_optimized_parser_result(regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
+
     Regex(Regex&&);
     Regex& operator=(Regex&&);
 
@@ -229,9 +241,13 @@ public:
     static BasicBlockList split_basic_blocks(ByteCode const&);
 
 private:
+    struct AlreadyOptimizedTag { };
+    Regex(AlreadyOptimizedTag, regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options);
+
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
     bool attempt_rewrite_entire_match_as_substring_search(BasicBlockList const&);
+    void find_required_literals();
 };
 
 // free standing functions for match, search and has_match
@@ -28,6 +28,8 @@ void Regex<Parser>::run_optimization_passes()
 {
     parser_result.bytecode.flatten();
 
+    find_required_literals();
+
     auto blocks = split_basic_blocks(parser_result.bytecode);
     if (attempt_rewrite_entire_match_as_substring_search(blocks))
         return;
@@ -533,6 +535,131 @@ static AtomicRewritePreconditionResult block_satisfies_atomic_rewrite_preconditi
     return AtomicRewritePreconditionResult::SatisfiedWithEmptyHeader;
 }
 
+template<typename Parser>
+void Regex<Parser>::find_required_literals()
+{
+    // Find runs of plain ASCII characters that every match has to go through, so the matcher can search for them
+    // instead of trying every start position.
+    struct Instruction {
+        size_t position;
+        Optional<char> literal;
+        bool is_zero_width { false };
+    };
+    struct Skip {
+        size_t from;
+        size_t to;
+    };
+
+    auto& bytecode = parser_result.bytecode;
+    auto bytecode_size = bytecode.size();
+
+    Vector<Instruction> instructions;
+    Vector<Skip> skips;
+
+    MatchState state;
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        auto position = state.instruction_position;
+        auto next_position = position + opcode.size();
+        Instruction instruction { position, {} };
+
+        auto add_jump = [&](ssize_t offset) {
+            // Only forward jumps can go past an instruction without executing it.
+            if (offset > 0)
+                skips.append({ position, next_position + offset });
+        };
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            if (compare.arguments_count() == 1) {
+                auto flat_compares = compare.flat_compares();
+                if (flat_compares.first().type == CharacterCompareType::Char && flat_compares.first().value <= 0x7f)
+                    instruction.literal = static_cast<char>(flat_compares.first().value);
+            }
+            break;
+        }
+        case OpCodeId::Jump:
+            add_jump(static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            add_jump(static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            add_jump(static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            add_jump(static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        case OpCodeId::GoBack:
+            // Lookbehinds may match text before the start position.
+            return;
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+            instruction.is_zero_width = true;
+            break;
+        default:
+            break;
+        }
+
+        instructions.append(instruction);
+        state.instruction_position = next_position;
+    }
+
+    auto is_always_executed = [&](size_t position) {
+        for (auto& skip : skips) {
+            if (skip.from < position && position < skip.to)
+                return false;
+        }
+        return true;
+    };
+
+    // Once the first character of a run executes, the rest of the run follows without any jumps in between.
+    ByteString longest_run;
+    for (size_t i = 0; i < instructions.size();) {
+        if (!instructions[i].literal.has_value() || !is_always_executed(instructions[i].position)) {
+            ++i;
+            continue;
+        }
+
+        StringBuilder run;
+        for (; i < instructions.size() && (instructions[i].literal.has_value() || instructions[i].is_zero_width); ++i) {
+            if (instructions[i].literal.has_value())
+                run.append(*instructions[i].literal);
+        }
+
+        if (run.length() > longest_run.length())
+            longest_run = run.to_byte_string();
+    }
+
+    if (longest_run.is_empty())
+        return;
+
+    size_t first_literal = 0;
+    while (first_literal < instructions.size() && instructions[first_literal].is_zero_width)
+        ++first_literal;
+
+    if (first_literal < instructions.size() && instructions[first_literal].literal.has_value()) {
+        StringBuilder prefix;
+        for (size_t i = first_literal; i < instructions.size() && (instructions[i].literal.has_value() || instructions[i].is_zero_width); ++i) {
+            if (instructions[i].literal.has_value())
+                prefix.append(*instructions[i].literal);
+        }
+        parser_result.optimization_data.literal_prefix = prefix.to_byte_string();
+        return;
+    }
+
+    parser_result.optimization_data.required_substring = move(longest_run);
+}
+
 template<typename Parser>
 bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockList const& basic_blocks)
 {
@@ -58,6 +58,8 @@ public:
 
         struct {
             Optional<ByteString> pure_substring_search;
+            Optional<ByteString> literal_prefix;     // Every match starts with this.
+            Optional<ByteString> required_substring; // Every match contains this (or a lookahead past the start does).
             bool only_start_of_line = false;
         } optimization_data {};
     };
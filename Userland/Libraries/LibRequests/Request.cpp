@@ -50,24 +50,26 @@ void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_
     on_headers_received = [this](auto& headers, auto response_code) {
         m_internal_buffered_data->response_headers = headers;
         m_internal_buffered_data->response_code = move(response_code);
-    };
 
-    on_finish = [this, on_buffered_request_finished = move(on_buffered_request_finished)](auto success, auto total_size) {
-        auto output_buffer = ByteBuffer::create_uninitialized(m_internal_buffered_data->payload_stream.used_buffer_size()).release_value_but_fixme_should_propagate_errors();
-        m_internal_buffered_data->payload_stream.read_until_filled(output_buffer).release_value_but_fixme_should_propagate_errors();
+        // Make room for the whole payload up front if we know its size. Since the body may have been decoded from a
+        // compressed representation, this is only a lower bound, and we still grow as needed.
+        static constexpr u64 maximum_preallocated_size = 64 * MiB;
+        if (auto content_length = headers.get("Content-Length"sv).value_or({}).template to_number<u64>(); content_length.has_value())
+            (void)m_internal_buffered_data->payload.try_ensure_capacity(min(*content_length, maximum_preallocated_size));
+    };
 
+    on_finish = [this, on_buffered_request_finished = move(on_buffered_request_finished)](auto success, auto total_size, auto const& timing_info) {
         on_buffered_request_finished(
             success,
             total_size,
             m_internal_buffered_data->response_headers,
             m_internal_buffered_data->response_code,
-            output_buffer);
+            m_internal_buffered_data->payload,
+            timing_info);
     };
 
-    set_up_internal_stream_data([this](auto read_bytes) {
-        // FIXME: What do we do if this fails?
-        m_internal_buffered_data->payload_stream.write_until_depleted(read_bytes).release_value_but_fixme_should_propagate_errors();
-    });
+    // NOTE: The data has already been read into the payload by read_from_request_fd().
+    set_up_internal_stream_data([](auto) {});
 }
 
 void Request::set_unbuffered_request_callbacks(HeadersReceived on_headers_received, DataReceived on_data_received, RequestFinished on_finish)
@@ -81,10 +83,10 @@ void Request::set_unbuffered_request_callbacks(HeadersReceived on_headers_receiv
     set_up_internal_stream_data(move(on_data_received));
 }
 
-void Request::did_finish(Badge<RequestClient>, bool success, u64 total_size)
+void Request::did_finish(Badge<RequestClient>, bool success, u64 total_size, RequestTimingInfo const& timing_info)
 {
     if (on_finish)
-        on_finish(success, total_size);
+        on_finish(success, total_size, timing_info);
 }
 
 void Request::did_receive_headers(Badge<RequestClient>, HTTP::HeaderMap const& response_headers, Optional<u32> response_code)
@@ -113,9 +115,10 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         m_internal_stream_data->read_stream = MUST(Core::File::adopt_fd(fd(), Core::File::OpenMode::Read));
 
     auto user_on_finish = move(on_finish);
-    on_finish = [this](auto success, auto total_size) {
+    on_finish = [this](auto success, auto total_size, auto const& timing_info) {
         m_internal_stream_data->success = success;
         m_internal_stream_data->total_size = total_size;
+        m_internal_stream_data->timing_info = timing_info;
         m_internal_stream_data->request_done = true;
         m_internal_stream_data->on_finish();
     };
@@ -123,7 +126,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
     m_internal_stream_data->on_finish = [this, user_on_finish = move(user_on_finish)]() {
         if (!m_internal_stream_data->user_finish_called && m_internal_stream_data->read_stream->is_eof()) {
             m_internal_stream_data->user_finish_called = true;
-            user_on_finish(m_internal_stream_data->success, m_internal_stream_data->total_size);
+            user_on_finish(m_internal_stream_data->success, m_internal_stream_data->total_size, m_internal_stream_data->timing_info);
         }
     };
 
@@ -132,7 +135,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         static char buffer[buffer_size];
 
         do {
-            auto result = m_internal_stream_data->read_stream->read_some({ buffer, buffer_size });
+            auto result = read_from_request_fd({ buffer, buffer_size });
             if (result.is_error() && (!result.error().is_errno() || (result.error().is_errno() && result.error().code() != EINTR)))
                 break;
             if (result.is_error())
@@ -153,4 +156,21 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
     };
 }
 
+ErrorOr<Bytes> Request::read_from_request_fd(Bytes unbuffered_read_buffer)
+{
+    if (m_mode != Mode::Buffered)
+        return m_internal_stream_data->read_stream->read_some(unbuffered_read_buffer);
+
+    // Read into the spare capacity at the end of the payload, making sure there's a reasonable amount of it.
+    static constexpr size_t minimum_read_size = 64 * KiB;
+
+    auto& payload = m_internal_buffered_data->payload;
+    auto old_size = payload.size();
+    auto read_buffer = TRY(payload.get_bytes_for_writing(max(payload.capacity() - old_size, minimum_read_size)));
+
+    auto result = m_internal_stream_data->read_stream->read_some(read_buffer);
+    payload.resize(old_size + (result.is_error() ? 0 : result.value().size()));
+    return result;
+}
+
 }
@@ -16,6 +16,7 @@
 #include <LibCore/Notifier.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibIPC/Forward.h>
+#include <LibRequests/RequestTimingInfo.h>
 
 namespace Requests {
 
@@ -37,7 +38,7 @@ public:
     int fd() const { return m_fd; }
     bool stop();
 
-    using BufferedRequestFinished = Function<void(bool success, u64 total_size, HTTP::HeaderMap const& response_headers, Optional<u32> response_code, ReadonlyBytes payload)>;
+    using BufferedRequestFinished = Function<void(bool success, u64 total_size, HTTP::HeaderMap const& response_headers, Optional<u32> response_code, ReadonlyBytes payload, RequestTimingInfo const& timing_info)>;
 
     // Configure the request such that the entirety of the response data is buffered. The callback receives that data and
     // the response headers all at once. Using this method is mutually exclusive with `set_unbuffered_data_received_callback`.
@@ -45,7 +46,7 @@ public:
 
     using HeadersReceived = Function<void(HTTP::HeaderMap const& response_headers, Optional<u32> response_code)>;
     using DataReceived = Function<void(ReadonlyBytes data)>;
-    using RequestFinished = Function<void(bool success, u64 total_size)>;
+    using RequestFinished = Function<void(bool success, u64 total_size, RequestTimingInfo const& timing_info)>;
 
     // Configure the request such that the response data is provided unbuffered as it is received. Using this method is
     // mutually exclusive with `set_buffered_request_finished_callback`.
@@ -53,7 +54,7 @@ public:
 
     Function<CertificateAndKey()> on_certificate_requested;
 
-    void did_finish(Badge<RequestClient>, bool success, u64 total_size);
+    void did_finish(Badge<RequestClient>, bool success, u64 total_size, RequestTimingInfo const&);
     void did_receive_headers(Badge<RequestClient>, HTTP::HeaderMap const& response_headers, Optional<u32> response_code);
     void did_request_certificates(Badge<RequestClient>);
 
@@ -64,6 +65,7 @@ private:
     explicit Request(RequestClient&, i32 request_id);
 
     void set_up_internal_stream_data(DataReceived on_data_available);
+    ErrorOr<Bytes> read_from_request_fd(Bytes unbuffered_read_buffer);
 
     WeakPtr<RequestClient> m_client;
     int m_request_id { -1 };
@@ -81,7 +83,8 @@ private:
     RequestFinished on_finish;
 
     struct InternalBufferedData {
-        AllocatingMemoryStream payload_stream;
+        // NOTE: The response is read from the request fd straight into this buffer, without any intermediate copies.
+        ByteBuffer payload;
         HTTP::HeaderMap response_headers;
         Optional<u32> response_code;
     };
@@ -93,6 +96,7 @@ private:
         RefPtr<Core::Notifier> read_notifier;
         bool success;
         u32 total_size { 0 };
+        RequestTimingInfo timing_info;
         bool request_done { false };
         Function<void()> on_finish {};
         bool user_finish_called { false };
@@ -8,6 +8,7 @@
 
 #include <AK/HashMap.h>
 #include <LibHTTP/HeaderMap.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibIPC/ConnectionToServer.h>
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
@@ -27,7 +28,7 @@ public:
     explicit RequestClient(NonnullOwnPtr<Core::LocalSocket>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {}, RequestPriority = RequestPriority::Normal);
 
     RefPtr<WebSocket> websocket_connect(const URL::URL&, ByteString const& origin = {}, Vector<ByteString> const& protocols = {}, Vector<ByteString> const& extensions = {}, HTTP::HeaderMap const& request_headers = {});
 
@@ -40,7 +41,7 @@ private:
     virtual void die() override;
 
     virtual void request_started(i32, IPC::File const&) override;
-    virtual void request_finished(i32, bool, u64) override;
+    virtual void request_finished(i32, bool, u64, RequestTimingInfo const&) override;
     virtual void certificate_requested(i32) override;
     virtual void headers_became_available(i32, HTTP::HeaderMap const&, Optional<u32> const&) override;
 
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Requests {
+
+// How urgently the client needs a response, from most to least urgent. RequestServer dispatches requests in this
+// order, and passes it on to the origin server as an RFC 9218 urgency.
+enum class RequestPriority : u8 {
+    // Resources that block rendering, like documents and stylesheets.
+    Highest,
+    // Resources that are needed soon, like scripts and fonts.
+    High,
+    Normal,
+    // Resources that can be shown whenever they arrive, like images and media.
+    Low,
+    // Resources that nothing is waiting for, like reports and beacons.
+    Lowest,
+};
+
+}
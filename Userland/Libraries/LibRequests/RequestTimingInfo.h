@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Types.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+
+namespace Requests {
+
+// When each phase of a request happened, in microseconds since RequestServer received it. Phases that did not happen,
+// like connecting when an existing connection was reused, are left as zero.
+struct RequestTimingInfo {
+    i64 domain_lookup_start_microseconds { 0 };
+    i64 domain_lookup_end_microseconds { 0 };
+    i64 connect_start_microseconds { 0 };
+    i64 connect_end_microseconds { 0 };
+    i64 secure_connect_start_microseconds { 0 };
+    i64 request_start_microseconds { 0 };
+    i64 response_start_microseconds { 0 };
+    i64 response_end_microseconds { 0 };
+
+    // The number of body bytes received, before any content encoding was removed.
+    u64 encoded_body_size { 0 };
+
+    // The ALPN protocol ID of the connection, e.g. "http/1.1" or "h2". Empty if the response did not come from the network.
+    ByteString alpn_negotiated_protocol;
+
+    bool connection_reused { false };
+};
+
+}
+
+namespace IPC {
+
+template<>
+inline ErrorOr<void> encode(Encoder& encoder, Requests::RequestTimingInfo const& timing_info)
+{
+    TRY(encoder.encode(timing_info.domain_lookup_start_microseconds));
+    TRY(encoder.encode(timing_info.domain_lookup_end_microseconds));
+    TRY(encoder.encode(timing_info.connect_start_microseconds));
+    TRY(encoder.encode(timing_info.connect_end_microseconds));
+    TRY(encoder.encode(timing_info.secure_connect_start_microseconds));
+    TRY(encoder.encode(timing_info.request_start_microseconds));
+    TRY(encoder.encode(timing_info.response_start_microseconds));
+    TRY(encoder.encode(timing_info.response_end_microseconds));
+    TRY(encoder.encode(timing_info.encoded_body_size));
+    TRY(encoder.encode(timing_info.alpn_negotiated_protocol));
+    TRY(encoder.encode(timing_info.connection_reused));
+    return {};
+}
+
+template<>
+inline ErrorOr<Requests::RequestTimingInfo> decode(Decoder& decoder)
+{
+    Requests::RequestTimingInfo timing_info;
+    timing_info.domain_lookup_start_microseconds = TRY(decoder.decode<i64>());
+    timing_info.domain_lookup_end_microseconds = TRY(decoder.decode<i64>());
+    timing_info.connect_start_microseconds = TRY(decoder.decode<i64>());
+    timing_info.connect_end_microseconds = TRY(decoder.decode<i64>());
+    timing_info.secure_connect_start_microseconds = TRY(decoder.decode<i64>());
+    timing_info.request_start_microseconds = TRY(decoder.decode<i64>());
+    timing_info.response_start_microseconds = TRY(decoder.decode<i64>());
+    timing_info.response_end_microseconds = TRY(decoder.decode<i64>());
+    timing_info.encoded_body_size = TRY(decoder.decode<u64>());
+    timing_info.alpn_negotiated_protocol = TRY(decoder.decode<ByteString>());
+    timing_info.connection_reused = TRY(decoder.decode<bool>());
+    return timing_info;
+}
+
+}
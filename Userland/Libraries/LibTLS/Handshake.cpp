@@ -227,8 +227,23 @@ ssize_t TLSv12::handle_handshake_finished(ReadonlyBytes buffer, WritePacketStage
 
     // TODO: Compare Hashes
     dbgln_if(TLS_DEBUG, "FIXME: handle_handshake_finished :: Check message validity");
+
+    // In an abbreviated handshake, the server finishes first, and the connection is only established once we've
+    // answered with our own Finished message.
+    if (m_context.is_resumed_session) {
+        write_packets = WritePacketStage::Finished;
+        return index + size;
+    }
+
     m_context.connection_status = ConnectionStatus::Established;
+    store_session_in_cache();
+    did_finish_handshake();
+
+    return index + size;
+}
 
+void TLSv12::did_finish_handshake()
+{
     if (m_handshake_timeout_timer) {
         // Disable the handshake timeout timer as handshake has been established.
         m_handshake_timeout_timer->stop();
@@ -238,8 +253,6 @@ ssize_t TLSv12::handle_handshake_finished(ReadonlyBytes buffer, WritePacketStage
 
     if (on_connected)
         on_connected();
-
-    return index + size;
 }
 
 ssize_t TLSv12::handle_handshake_payload(ReadonlyBytes vbuffer)
@@ -542,12 +555,15 @@ ssize_t TLSv12::handle_handshake_payload(ReadonlyBytes vbuffer)
                 auto packet = build_change_cipher_spec();
                 write_packet(packet);
             }
+            // The server's ChangeCipherSpec has already switched the cipher on, so our Finished goes out encrypted.
+            m_context.local_sequence_number = 0;
             {
                 dbgln_if(TLS_DEBUG, "> client finished");
                 auto packet = build_handshake_finished();
                 write_packet(packet);
             }
             m_context.connection_status = ConnectionStatus::Established;
+            did_finish_handshake();
             break;
         }
         payload_size++;
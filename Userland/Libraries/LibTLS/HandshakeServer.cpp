@@ -196,6 +196,30 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
         }
     }
 
+    if (m_context.offered_session.has_value()) {
+        auto session = m_context.offered_session.release_value();
+
+        // RFC 5246 section 7.4.1.3: The server echoes the session ID that we offered back if it agrees to resume the
+        // session, and picks a new one (or none at all) if it wants to go through a full handshake instead.
+        if (m_context.session_id_size == session.session_id_size && memcmp(m_context.session_id, session.session_id, session.session_id_size) == 0) {
+            // RFC 7627 section 5.3: A resumed session must keep using the extended master secret if, and only if, the
+            //                       original session did.
+            if (m_context.cipher != session.cipher || m_context.extensions.extended_master_secret != session.extended_master_secret) {
+                dbgln("Server resumed a session with different parameters than the ones it was established with");
+                return (i8)Error::NotSafe;
+            }
+
+            dbgln_if(TLS_DEBUG, "Resuming cached session");
+            m_context.master_key = move(session.master_key);
+            if (!expand_key())
+                return (i8)Error::UnknownError;
+
+            // The server follows up with its ChangeCipherSpec and Finished messages straight away.
+            m_context.is_resumed_session = true;
+            m_context.connection_status = ConnectionStatus::KeyExchange;
+        }
+    }
+
     return res;
 }
 
@@ -35,34 +35,98 @@ void TLSv12::alert(AlertLevel level, AlertDescription code)
     MUST(flush());
 }
 
-void TLSv12::write_packet(ByteBuffer& packet, bool immediately)
+void TLSv12::schedule_or_perform_flush(bool immediately)
 {
-    auto schedule_or_perform_flush = [&](bool immediate) {
-        if (m_context.connection_status > ConnectionStatus::Disconnected) {
-            if (!m_has_scheduled_write_flush && !immediate) {
-                dbgln_if(TLS_DEBUG, "Scheduling write of {}", m_context.tls_buffer.size());
-                Core::deferred_invoke([this] { write_into_socket(); });
-                m_has_scheduled_write_flush = true;
-            } else {
-                // multiple packet are available, let's flush some out
-                dbgln_if(TLS_DEBUG, "Flushing scheduled write of {}", m_context.tls_buffer.size());
-                write_into_socket();
-                // the deferred invoke is still in place
-                m_has_scheduled_write_flush = true;
-            }
+    if (m_context.connection_status > ConnectionStatus::Disconnected) {
+        if (!m_has_scheduled_write_flush && !immediately) {
+            dbgln_if(TLS_DEBUG, "Scheduling write of {}", m_context.tls_buffer.size());
+            Core::deferred_invoke([this] { write_into_socket(); });
+            m_has_scheduled_write_flush = true;
+        } else {
+            // multiple packet are available, let's flush some out
+            dbgln_if(TLS_DEBUG, "Flushing scheduled write of {}", m_context.tls_buffer.size());
+            write_into_socket();
+            // the deferred invoke is still in place
+            m_has_scheduled_write_flush = true;
         }
-    };
+    }
+}
+
+Optional<Bytes> TLSv12::reserve_space_for_record(size_t size)
+{
     // Record size limit is 18432 bytes, leave some headroom and flush at 16K.
-    if (m_context.tls_buffer.size() + packet.size() > 16 * KiB)
+    if (m_context.tls_buffer.size() + size > 16 * KiB)
         schedule_or_perform_flush(true);
 
-    if (m_context.tls_buffer.try_append(packet.data(), packet.size()).is_error()) {
+    auto space = m_context.tls_buffer.get_bytes_for_writing(size);
+    if (space.is_error())
+        return {};
+    return space.release_value();
+}
+
+void TLSv12::write_packet(ByteBuffer& packet, bool immediately)
+{
+    auto space = reserve_space_for_record(packet.size());
+    if (!space.has_value()) {
         // Toooooo bad, drop the record on the ground.
         return;
     }
+    packet.bytes().copy_to(*space);
     schedule_or_perform_flush(immediately);
 }
 
+void TLSv12::seal_aead_record(ReadonlyBytes header, ReadonlyBytes plaintext, Bytes record)
+{
+    u32 header_size = 5;
+    auto& gcm = m_cipher_local.get<Crypto::Cipher::AESCipher::GCMMode>();
+
+    // We need enough space for a header, the data, a tag, and the IV
+    VERIFY(record.size() == header_size + 8 + plaintext.size() + 16);
+
+    // copy the header over, along with the ciphertext length
+    header.copy_to(record);
+    ByteReader::store(record.offset(header_size - 2), AK::convert_between_host_and_network_endian((u16)(record.size() - header_size)));
+
+    // AEAD AAD (13)
+    // Seq. no (8)
+    // content type (1)
+    // version (2)
+    // length (2)
+    u8 aad[13];
+    Bytes aad_bytes { aad, 13 };
+    FixedMemoryStream aad_stream { aad_bytes };
+
+    u64 seq_no = AK::convert_between_host_and_network_endian(m_context.local_sequence_number);
+    u16 len = AK::convert_between_host_and_network_endian((u16)plaintext.size());
+
+    MUST(aad_stream.write_value(seq_no));                     // sequence number
+    MUST(aad_stream.write_until_depleted(header.slice(0, 3))); // content-type + version
+    MUST(aad_stream.write_value(len));                        // length
+    VERIFY(MUST(aad_stream.tell()) == MUST(aad_stream.size()));
+
+    // AEAD IV (12)
+    // IV (4)
+    // (Nonce) (8)
+    // -- Our GCM impl takes 16 bytes
+    // zero (4)
+    u8 iv[16];
+    Bytes iv_bytes { iv, 16 };
+    Bytes { m_context.crypto.local_aead_iv, 4 }.copy_to(iv_bytes);
+    fill_with_random(iv_bytes.slice(4, 8));
+    memset(iv_bytes.offset(12), 0, 4);
+
+    // write the random part of the iv out
+    iv_bytes.slice(4, 8).copy_to(record.slice(header_size));
+
+    // Write the encrypted data and the tag
+    gcm.encrypt(
+        plaintext,
+        record.slice(header_size + 8, plaintext.size()),
+        iv_bytes,
+        aad_bytes,
+        record.slice(header_size + 8 + plaintext.size(), 16));
+}
+
 void TLSv12::update_packet(ByteBuffer& packet)
 {
     u32 header_size = 5;
@@ -102,80 +166,37 @@ void TLSv12::update_packet(ByteBuffer& packet)
                 });
 
             if (m_context.crypto.created == 1) {
-                // `buffer' will continue to be encrypted
-                auto buffer_result = ByteBuffer::create_uninitialized(length);
-                if (buffer_result.is_error()) {
-                    dbgln("LibTLS: Failed to allocate enough memory");
-                    VERIFY_NOT_REACHED();
-                }
-                auto buffer = buffer_result.release_value();
-                size_t buffer_position = 0;
                 auto iv_size = iv_length();
 
-                // copy the packet, sans the header
-                buffer.overwrite(buffer_position, packet.offset_pointer(header_size), packet.size() - header_size);
-                buffer_position += packet.size() - header_size;
-
                 ByteBuffer ct;
 
                 m_cipher_local.visit(
                     [&](Empty&) { VERIFY_NOT_REACHED(); },
-                    [&](Crypto::Cipher::AESCipher::GCMMode& gcm) {
+                    [&](Crypto::Cipher::AESCipher::GCMMode&) {
                         VERIFY(is_aead());
-                        // We need enough space for a header, the data, a tag, and the IV
                         auto ct_buffer_result = ByteBuffer::create_uninitialized(length + header_size + iv_size + 16);
                         if (ct_buffer_result.is_error()) {
                             dbgln("LibTLS: Failed to allocate enough memory for the ciphertext");
                             VERIFY_NOT_REACHED();
                         }
                         ct = ct_buffer_result.release_value();
-
-                        // copy the header over
-                        ct.overwrite(0, packet.data(), header_size - 2);
-
-                        // AEAD AAD (13)
-                        // Seq. no (8)
-                        // content type (1)
-                        // version (2)
-                        // length (2)
-                        u8 aad[13];
-                        Bytes aad_bytes { aad, 13 };
-                        FixedMemoryStream aad_stream { aad_bytes };
-
-                        u64 seq_no = AK::convert_between_host_and_network_endian(m_context.local_sequence_number);
-                        u16 len = AK::convert_between_host_and_network_endian((u16)(packet.size() - header_size));
-
-                        MUST(aad_stream.write_value(seq_no));                              // sequence number
-                        MUST(aad_stream.write_until_depleted(packet.bytes().slice(0, 3))); // content-type + version
-                        MUST(aad_stream.write_value(len));                                 // length
-                        VERIFY(MUST(aad_stream.tell()) == MUST(aad_stream.size()));
-
-                        // AEAD IV (12)
-                        // IV (4)
-                        // (Nonce) (8)
-                        // -- Our GCM impl takes 16 bytes
-                        // zero (4)
-                        u8 iv[16];
-                        Bytes iv_bytes { iv, 16 };
-                        Bytes { m_context.crypto.local_aead_iv, 4 }.copy_to(iv_bytes);
-                        fill_with_random(iv_bytes.slice(4, 8));
-                        memset(iv_bytes.offset(12), 0, 4);
-
-                        // write the random part of the iv out
-                        iv_bytes.slice(4, 8).copy_to(ct.bytes().slice(header_size));
-
-                        // Write the encrypted data and the tag
-                        gcm.encrypt(
-                            packet.bytes().slice(header_size, length),
-                            ct.bytes().slice(header_size + 8, length),
-                            iv_bytes,
-                            aad_bytes,
-                            ct.bytes().slice(header_size + 8 + length, 16));
-
-                        VERIFY(header_size + 8 + length + 16 == ct.size());
+                        seal_aead_record(packet.bytes().slice(0, 3), packet.bytes().slice(header_size, length), ct);
                     },
                     [&](Crypto::Cipher::AESCipher::CBCMode& cbc) {
                         VERIFY(!is_aead());
+                        // `buffer' will continue to be encrypted
+                        auto buffer_result = ByteBuffer::create_uninitialized(length);
+                        if (buffer_result.is_error()) {
+                            dbgln("LibTLS: Failed to allocate enough memory");
+                            VERIFY_NOT_REACHED();
+                        }
+                        auto buffer = buffer_result.release_value();
+                        size_t buffer_position = 0;
+
+                        // copy the packet, sans the header
+                        buffer.overwrite(buffer_position, packet.offset_pointer(header_size), packet.size() - header_size);
+                        buffer_position += packet.size() - header_size;
+
                         // We need enough space for a header, iv_length bytes of IV and whatever the packet contains
                         auto ct_buffer_result = ByteBuffer::create_uninitialized(length + header_size + iv_size);
                         if (ct_buffer_result.is_error()) {
@@ -225,7 +246,7 @@ void TLSv12::update_packet(ByteBuffer& packet)
                 ByteReader::store(ct.offset_pointer(header_size - 2), AK::convert_between_host_and_network_endian(ct_length));
 
                 // replace the packet with the ciphertext
-                packet = ct;
+                packet = move(ct);
             }
         }
     }
@@ -478,7 +499,8 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
                     return_value = Error::IntegrityCheckFailed;
                     return;
                 }
-                plain = decrypted.bytes().slice(0, length);
+                decrypted.trim(length, false);
+                plain = decrypted;
             });
 
         if (return_value != Error::NoError) {
@@ -497,7 +519,11 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
         } else {
             dbgln_if(TLS_DEBUG, "application data message of size {}", plain.size());
 
-            if (m_context.application_buffer.try_append(plain).is_error()) {
+            // Decrypted records are handed over to the application buffer as they are, rather than copied into it.
+            auto append_result = decrypted.is_empty()
+                ? m_context.application_buffer.try_append(plain)
+                : m_context.application_buffer.try_append(move(decrypted));
+            if (append_result.is_error()) {
                 payload_res = (i8)Error::DecryptionFailed;
                 auto packet = build_alert(true, (u8)AlertDescription::DECRYPTION_FAILED_RESERVED);
                 write_packet(packet);
@@ -16,6 +16,11 @@
 // which will be sent as a single record containing a single ApplicationData message.
 constexpr static size_t MaximumApplicationDataChunkSize = 16 * KiB;
 
+// RFC 5246 section F.1.4 suggests that sessions should not be resumed after 24 hours. Servers usually forget about
+// them long before that, in which case they simply fall back to a full handshake.
+constexpr static auto SessionCacheEntryLifetime = AK::Duration::from_seconds(60 * 60);
+constexpr static size_t MaximumSessionCacheEntries = 256;
+
 namespace TLS {
 
 ErrorOr<Bytes> TLSv12::read_some(Bytes bytes)
@@ -38,9 +43,30 @@ ErrorOr<size_t> TLSv12::write_some(ReadonlyBytes bytes)
         return AK::Error::from_string_literal("TLS write request while not connected");
     }
 
+    // With an AEAD cipher, records are sealed straight from the caller's data into the outgoing buffer, without
+    // first being staged in a plaintext packet of their own.
+    if (is_aead() && m_context.cipher_spec_set && m_context.crypto.created == 1) {
+        u16 version = to_underlying(m_context.options.version);
+        u8 header[3] = { (u8)ContentType::APPLICATION_DATA, (u8)(version >> 8), (u8)version };
+
+        for (size_t offset = 0; offset < bytes.size(); offset += MaximumApplicationDataChunkSize) {
+            auto chunk = bytes.slice(offset, min(bytes.size() - offset, MaximumApplicationDataChunkSize));
+            auto record = reserve_space_for_record(5 + iv_length() + chunk.size() + 16);
+            if (!record.has_value())
+                return AK::Error::from_errno(ENOMEM);
+
+            seal_aead_record({ header, sizeof(header) }, chunk, *record);
+            ++m_context.local_sequence_number;
+            schedule_or_perform_flush(false);
+        }
+
+        return bytes.size();
+    }
+
     for (size_t offset = 0; offset < bytes.size(); offset += MaximumApplicationDataChunkSize) {
-        PacketBuilder builder { ContentType::APPLICATION_DATA, m_context.options.version, bytes.size() - offset };
-        builder.append(bytes.slice(offset, min(bytes.size() - offset, MaximumApplicationDataChunkSize)));
+        auto chunk = bytes.slice(offset, min(bytes.size() - offset, MaximumApplicationDataChunkSize));
+        PacketBuilder builder { ContentType::APPLICATION_DATA, m_context.options.version, chunk.size() };
+        builder.append(chunk);
         auto packet = builder.build();
 
         update_packet(packet);
@@ -57,6 +83,7 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect(ByteString const& host, u16 port,
     TRY(tcp_socket->set_blocking(false));
     auto tls_socket = make<TLSv12>(move(tcp_socket), move(options));
     tls_socket->set_sni(host);
+    tls_socket->m_context.session_cache_key = ByteString::formatted("{}:{}:{}", host, port, tls_socket->m_context.extensions.SNI);
     tls_socket->on_connected = [&] {
         promise->resolve({});
     };
@@ -94,6 +121,66 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect(ByteString const& host, Core::Soc
     return tls_socket;
 }
 
+// A process-wide cache of the sessions that we may ask servers to resume, keyed by host, port and SNI.
+static HashMap<ByteString, CachedSession>& session_cache()
+{
+    static HashMap<ByteString, CachedSession> s_session_cache;
+    return s_session_cache;
+}
+
+void TLSv12::offer_cached_session()
+{
+    if (m_context.is_server || m_context.session_cache_key.is_empty())
+        return;
+
+    auto it = session_cache().find(m_context.session_cache_key);
+    if (it == session_cache().end())
+        return;
+
+    if (it->value.expiry <= MonotonicTime::now()) {
+        session_cache().remove(it);
+        return;
+    }
+
+    if (!m_context.options.usable_cipher_suites.contains_slow(it->value.cipher))
+        return;
+
+    dbgln_if(TLS_DEBUG, "Offering cached session for {}", m_context.session_cache_key);
+    memcpy(m_context.session_id, it->value.session_id, it->value.session_id_size);
+    m_context.session_id_size = it->value.session_id_size;
+    m_context.offered_session = it->value;
+}
+
+void TLSv12::store_session_in_cache()
+{
+    // Servers that don't hand out a session ID have no intention of resuming the session.
+    if (m_context.is_server || m_context.session_cache_key.is_empty() || m_context.session_id_size == 0)
+        return;
+
+    auto master_key = ByteBuffer::copy(m_context.master_key);
+    if (master_key.is_error())
+        return;
+
+    auto& cache = session_cache();
+    if (cache.size() >= MaximumSessionCacheEntries && !cache.contains(m_context.session_cache_key)) {
+        auto now = MonotonicTime::now();
+        cache.remove_all_matching([&](auto const&, auto const& session) { return session.expiry <= now; });
+        if (cache.size() >= MaximumSessionCacheEntries)
+            cache.clear();
+    }
+
+    CachedSession session {
+        .session_id = {},
+        .session_id_size = m_context.session_id_size,
+        .master_key = master_key.release_value(),
+        .cipher = m_context.cipher,
+        .extended_master_secret = m_context.extensions.extended_master_secret,
+        .expiry = MonotonicTime::now() + SessionCacheEntryLifetime,
+    };
+    memcpy(session.session_id, m_context.session_id, m_context.session_id_size);
+    cache.set(m_context.session_cache_key, move(session));
+}
+
 void TLSv12::setup_connection()
 {
     Core::deferred_invoke([this] {
@@ -124,6 +211,7 @@ void TLSv12::setup_connection()
                     m_handshake_timeout_timer->restart(m_max_wait_time_for_handshake_in_seconds * 1000);
                 }
             });
+        offer_cached_session();
         auto packet = build_hello();
         write_packet(packet);
         write_into_socket();
@@ -8,7 +8,9 @@
 
 #include "Certificate.h"
 #include <AK/IPv4Address.h>
+#include <AK/HashMap.h>
 #include <AK/Queue.h>
+#include <AK/Time.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/Notifier.h>
 #include <LibCore/Socket.h>
@@ -230,12 +232,33 @@ public:
         return {};
     }
 
+    AK::ErrorOr<void> try_append(ByteBuffer&& data)
+    {
+        if (Checked<size_t>::addition_would_overflow(m_size, data.size()))
+            return AK::Error::from_errno(EOVERFLOW);
+
+        m_size += data.size();
+        m_buffers.enqueue(move(data));
+        return {};
+    }
+
 private:
     size_t m_size { 0 };
     Queue<ByteBuffer> m_buffers;
     size_t m_offset_into_current_buffer { 0 };
 };
 
+// The parameters of an established session, which let a later connection to the same server skip the key exchange
+// (RFC 5246 section 7.3, "resuming a session").
+struct CachedSession {
+    u8 session_id[32];
+    u8 session_id_size { 0 };
+    ByteBuffer master_key;
+    CipherSuite cipher;
+    bool extended_master_secret { false };
+    MonotonicTime expiry;
+};
+
 struct Context {
     bool verify_chain(StringView host) const;
     bool verify_certificate_pair(Certificate const& subject, Certificate const& issuer) const;
@@ -247,6 +270,12 @@ struct Context {
     u8 session_id[32];
     u8 session_id_size { 0 };
     CipherSuite cipher;
+
+    // Sessions are only cached for connections that we know the host and port of.
+    ByteString session_cache_key;
+    Optional<CachedSession> offered_session;
+    bool is_resumed_session { false };
+
     bool is_server { false };
     Vector<Certificate> certificates;
     Certificate private_key;
@@ -408,6 +437,10 @@ public:
 private:
     void setup_connection();
 
+    void offer_cached_session();
+    void store_session_in_cache();
+    void did_finish_handshake();
+
     void consume(ReadonlyBytes record);
 
     ByteBuffer hmac_message(ReadonlyBytes buf, Optional<ReadonlyBytes> const buf2, size_t mac_length, bool local = false);
@@ -417,6 +450,9 @@ private:
     void update_hash(ReadonlyBytes in, size_t header_size);
 
     void write_packet(ByteBuffer& packet, bool immediately = false);
+    void schedule_or_perform_flush(bool immediately);
+    Optional<Bytes> reserve_space_for_record(size_t size);
+    void seal_aead_record(ReadonlyBytes header, ReadonlyBytes plaintext, Bytes record);
 
     ByteBuffer build_client_key_exchange();
     ByteBuffer build_server_key_exchange();
@@ -18,6 +18,86 @@ namespace TextCodec {
 
 static constexpr u32 replacement_code_point = 0xfffd;
 
+// Decoders write their output into a sink. process() hands out one code point at a time through its callback, while
+// to_utf8() appends code points and whole runs of ASCII bytes straight into a StringBuilder.
+class CodePointCallbackSink {
+public:
+    explicit CodePointCallbackSink(Function<ErrorOr<void>(u32)>& on_code_point)
+        : m_on_code_point(on_code_point)
+    {
+    }
+
+    ErrorOr<void> operator()(u32 code_point) { return m_on_code_point(code_point); }
+
+    ErrorOr<void> append_ascii(ReadonlyBytes bytes)
+    {
+        for (u8 byte : bytes)
+            TRY(m_on_code_point(byte));
+        return {};
+    }
+
+private:
+    Function<ErrorOr<void>(u32)>& m_on_code_point;
+};
+
+class StringBuilderSink {
+public:
+    explicit StringBuilderSink(StringBuilder& builder)
+        : m_builder(builder)
+    {
+    }
+
+    ErrorOr<void> operator()(u32 code_point) { return m_builder.try_append_code_point(code_point); }
+    ErrorOr<void> append_ascii(ReadonlyBytes bytes) { return m_builder.try_append(StringView { bytes }); }
+
+private:
+    StringBuilder& m_builder;
+};
+
+template<typename DecodeFunction>
+static ErrorOr<String> decode_to_utf8(StringView input, DecodeFunction decode)
+{
+    StringBuilder builder(input.length());
+    TRY(decode(StringBuilderSink { builder }));
+    return builder.to_string_without_validation();
+}
+
+// Returns the number of ASCII bytes at the start of the input, checking a machine word at a time.
+static size_t ascii_prefix_length(ReadonlyBytes bytes)
+{
+    size_t length = 0;
+
+    for (; length + sizeof(FlatPtr) <= bytes.size(); length += sizeof(FlatPtr)) {
+        FlatPtr word;
+        __builtin_memcpy(&word, bytes.offset(length), sizeof(word));
+        if ((word & explode_byte(0x80)) != 0)
+            break;
+    }
+
+    while (length < bytes.size() && bytes[length] < 0x80)
+        ++length;
+
+    return length;
+}
+
+// Decodes an encoding in which every byte is one code point and ASCII bytes map to themselves.
+template<typename Sink, typename ConvertByte>
+static ErrorOr<void> decode_ascii_compatible_single_byte(StringView input, Sink on_code_point, ConvertByte convert_byte)
+{
+    auto bytes = input.bytes();
+
+    while (!bytes.is_empty()) {
+        auto ascii_length = ascii_prefix_length(bytes);
+        TRY(on_code_point.append_ascii(bytes.trim(ascii_length)));
+        bytes = bytes.slice(ascii_length);
+
+        for (; !bytes.is_empty() && bytes[0] >= 0x80; bytes = bytes.slice(1))
+            TRY(on_code_point(convert_byte(bytes[0])));
+    }
+
+    return {};
+}
+
 namespace {
 Latin1Decoder s_latin1_decoder;
 UTF8Decoder s_utf8_decoder;
@@ -421,14 +501,22 @@ ErrorOr<String> UTF16LEDecoder::to_utf8(StringView input)
     return String::from_utf16(as_utf16(input, AK::Endianness::Little));
 }
 
+// Latin1 is the same as the first 256 Unicode code points, so no mapping is needed, just UTF-8 encoding.
+static u32 convert_latin1_byte(u8 byte)
+{
+    return byte;
+}
+
 ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
-    for (u8 ch : input) {
-        // Latin1 is the same as the first 256 Unicode code_points, so no mapping is needed, just utf-8 encoding.
-        TRY(on_code_point(ch));
-    }
+    return decode_ascii_compatible_single_byte(input, CodePointCallbackSink { on_code_point }, convert_latin1_byte);
+}
 
-    return {};
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) {
+        return decode_ascii_compatible_single_byte(input, sink, convert_latin1_byte);
+    });
 }
 
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -479,50 +567,58 @@ ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<
 }
 
 // https://encoding.spec.whatwg.org/#x-user-defined-decoder
-ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+static u32 convert_x_user_defined_byte(u8 byte)
 {
-    auto convert_x_user_defined_to_utf8 = [](u8 ch) -> u32 {
-        // 2. If byte is an ASCII byte, return a code point whose value is byte.
-        // https://infra.spec.whatwg.org/#ascii-byte
-        // An ASCII byte is a byte in the range 0x00 (NUL) to 0x7F (DEL), inclusive.
-        // NOTE: This doesn't check for ch >= 0x00, as that would always be true due to being unsigned.
-        if (ch <= 0x7f)
-            return ch;
-
-        // 3. Return a code point whose value is 0xF780 + byte − 0x80.
-        return 0xF780 + ch - 0x80;
-    };
-
-    for (auto ch : input) {
-        TRY(on_code_point(convert_x_user_defined_to_utf8(ch)));
-    }
+    // 2. If byte is an ASCII byte, return a code point whose value is byte.
+    // https://infra.spec.whatwg.org/#ascii-byte
+    // An ASCII byte is a byte in the range 0x00 (NUL) to 0x7F (DEL), inclusive.
+    // NOTE: This doesn't check for byte >= 0x00, as that would always be true due to being unsigned.
+    if (byte <= 0x7f)
+        return byte;
+
+    // 3. Return a code point whose value is 0xF780 + byte − 0x80.
+    return 0xF780 + byte - 0x80;
+}
 
-    // 1. If byte is end-of-queue, return finished.
+ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_ascii_compatible_single_byte(input, CodePointCallbackSink { on_code_point }, convert_x_user_defined_byte);
+}
 
-    return {};
+ErrorOr<String> XUserDefinedDecoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) {
+        return decode_ascii_compatible_single_byte(input, sink, convert_x_user_defined_byte);
+    });
 }
 
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
-ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+u32 SingleByteDecoder<ArrayType>::convert_byte(u8 byte) const
 {
-    for (u8 const byte : input) {
-        if (byte < 0x80) {
-            // 2. If byte is an ASCII byte, return a code point whose value is byte.
-            TRY(on_code_point(byte));
-        } else {
-            // 3. Let code point be the index code point for byte − 0x80 in index single-byte.
-            auto code_point = m_translation_table[byte - 0x80];
+    // 2. If byte is an ASCII byte, return a code point whose value is byte.
+    if (byte < 0x80)
+        return byte;
+
+    // 3. Let code point be the index code point for byte − 0x80 in index single-byte.
+    // 4. If code point is null, return error.
+    // NOTE: Error is communicated with 0xFFFD
+    // 5. Return a code point whose value is code point.
+    return m_translation_table[byte - 0x80];
+}
 
-            // 4. If code point is null, return error.
-            // NOTE: Error is communicated with 0xFFFD
+template<Integral ArrayType>
+ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_ascii_compatible_single_byte(input, CodePointCallbackSink { on_code_point }, [this](u8 byte) { return convert_byte(byte); });
+}
 
-            // 5. Return a code point whose value is code point.
-            TRY(on_code_point(code_point));
-        }
-    }
-    // 1. If byte is end-of-queue, return finished.
-    return {};
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) {
+        return decode_ascii_compatible_single_byte(input, sink, [this](u8 byte) { return convert_byte(byte); });
+    });
 }
 
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
@@ -592,7 +688,8 @@ static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 }
 
 // https://encoding.spec.whatwg.org/#gb18030-decoder
-ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Sink>
+static ErrorOr<void> decode_gb18030(StringView input, Sink on_code_point)
 {
     // gb18030’s decoder has an associated gb18030 first, gb18030 second, and gb18030 third (all initially 0x00).
     u8 first = 0x00;
@@ -615,6 +712,15 @@ ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u
             continue;
         }
 
+        // OPTIMIZATION: Outside of a multi-byte sequence, runs of ASCII bytes decode to themselves.
+        if (first == 0x00 && second == 0x00 && third == 0x00) {
+            if (auto ascii_length = ascii_prefix_length(input.bytes().slice(index)); ascii_length > 0) {
+                TRY(on_code_point.append_ascii(input.bytes().slice(index, ascii_length)));
+                index += ascii_length;
+                continue;
+            }
+        }
+
         u8 const byte = input[index++];
         // 3. If gb18030 third is not 0x00, then:
         if (third != 0x00) {
@@ -729,8 +835,19 @@ ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u
     }
 }
 
+ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_gb18030(input, CodePointCallbackSink { on_code_point });
+}
+
+ErrorOr<String> GB18030Decoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) { return decode_gb18030(input, sink); });
+}
+
 // https://encoding.spec.whatwg.org/#big5-decoder
-ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Sink>
+static ErrorOr<void> decode_big5(StringView input, Sink on_code_point)
 {
     // Big5’s decoder has an associated Big5 lead (initially 0x00).
     u8 big5_lead = 0x00;
@@ -749,6 +866,15 @@ ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)
         if (index >= input.length() && big5_lead == 0x00)
             return {};
 
+        // OPTIMIZATION: Outside of a multi-byte sequence, runs of ASCII bytes decode to themselves.
+        if (big5_lead == 0x00) {
+            if (auto ascii_length = ascii_prefix_length(input.bytes().slice(index)); ascii_length > 0) {
+                TRY(on_code_point.append_ascii(input.bytes().slice(index, ascii_length)));
+                index += ascii_length;
+                continue;
+            }
+        }
+
         u8 const byte = input[index++];
 
         // 3. If Big5 lead is not 0x00, let lead be Big5 lead, let pointer be null, set Big5 lead to 0x00, and then:
@@ -821,8 +947,19 @@ ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)
     }
 }
 
+ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_big5(input, CodePointCallbackSink { on_code_point });
+}
+
+ErrorOr<String> Big5Decoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) { return decode_big5(input, sink); });
+}
+
 // https://encoding.spec.whatwg.org/#euc-jp-decoder
-ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Sink>
+static ErrorOr<void> decode_euc_jp(StringView input, Sink on_code_point)
 {
     // EUC-JP’s decoder has an associated EUC-JP jis0212 (initially false) and EUC-JP lead (initially 0x00).
     bool jis0212 = false;
@@ -842,6 +979,15 @@ ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32
         if (index >= input.length() && euc_jp_lead == 0x00)
             return {};
 
+        // OPTIMIZATION: Outside of a multi-byte sequence, runs of ASCII bytes decode to themselves.
+        if (euc_jp_lead == 0x00) {
+            if (auto ascii_length = ascii_prefix_length(input.bytes().slice(index)); ascii_length > 0) {
+                TRY(on_code_point.append_ascii(input.bytes().slice(index, ascii_length)));
+                index += ascii_length;
+                continue;
+            }
+        }
+
         u8 const byte = input[index++];
 
         // 3. If EUC-JP lead is 0x8E and byte is in the range 0xA1 to 0xDF, inclusive, set EUC-JP lead to 0x00 and return a code point whose value is 0xFF61 − 0xA1 + byte.
@@ -907,6 +1053,16 @@ ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32
     }
 }
 
+ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_euc_jp(input, CodePointCallbackSink { on_code_point });
+}
+
+ErrorOr<String> EUCJPDecoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) { return decode_euc_jp(input, sink); });
+}
+
 enum class ISO2022JPState {
     ASCII,
     Roman,
@@ -1157,7 +1313,8 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
 }
 
 // https://encoding.spec.whatwg.org/#shift_jis-decoder
-ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Sink>
+static ErrorOr<void> decode_shift_jis(StringView input, Sink on_code_point)
 {
     // Shift_JIS’s decoder has an associated Shift_JIS lead (initially 0x00).
     u8 shift_jis_lead = 0x00;
@@ -1176,6 +1333,15 @@ ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(
         if (index >= input.length() && shift_jis_lead == 0x00)
             return {};
 
+        // OPTIMIZATION: Outside of a multi-byte sequence, runs of ASCII bytes decode to themselves.
+        if (shift_jis_lead == 0x00) {
+            if (auto ascii_length = ascii_prefix_length(input.bytes().slice(index)); ascii_length > 0) {
+                TRY(on_code_point.append_ascii(input.bytes().slice(index, ascii_length)));
+                index += ascii_length;
+                continue;
+            }
+        }
+
         u8 const byte = input[index++];
 
         // 3. If Shift_JIS lead is not 0x00, let lead be Shift_JIS lead, let pointer be null, set Shift_JIS lead to 0x00, and then:
@@ -1241,8 +1407,19 @@ ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(
     }
 }
 
+ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_shift_jis(input, CodePointCallbackSink { on_code_point });
+}
+
+ErrorOr<String> ShiftJISDecoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) { return decode_shift_jis(input, sink); });
+}
+
 // https://encoding.spec.whatwg.org/#euc-kr-decoder
-ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Sink>
+static ErrorOr<void> decode_euc_kr(StringView input, Sink on_code_point)
 {
     // EUC-KR’s decoder has an associated EUC-KR lead (initially 0x00).
     u8 euc_kr_lead = 0x00;
@@ -1261,6 +1438,15 @@ ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32
         if (index >= input.length() && euc_kr_lead == 0x00)
             return {};
 
+        // OPTIMIZATION: Outside of a multi-byte sequence, runs of ASCII bytes decode to themselves.
+        if (euc_kr_lead == 0x00) {
+            if (auto ascii_length = ascii_prefix_length(input.bytes().slice(index)); ascii_length > 0) {
+                TRY(on_code_point.append_ascii(input.bytes().slice(index, ascii_length)));
+                index += ascii_length;
+                continue;
+            }
+        }
+
         u8 const byte = input[index++];
 
         // 3. If EUC-KR lead is not 0x00, let lead be EUC-KR lead, let pointer be null, set EUC-KR lead to 0x00, and then:
@@ -1308,6 +1494,16 @@ ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32
     }
 }
 
+ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    return decode_euc_kr(input, CodePointCallbackSink { on_code_point });
+}
+
+ErrorOr<String> EUCKRDecoder::to_utf8(StringView input)
+{
+    return decode_to_utf8(input, [&](auto sink) { return decode_euc_kr(input, sink); });
+}
+
 // https://encoding.spec.whatwg.org/#replacement-decoder
 ErrorOr<void> ReplacementDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
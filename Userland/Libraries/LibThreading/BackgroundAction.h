@@ -16,7 +16,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/EventReceiver.h>
 #include <LibCore/Promise.h>
-#include <LibThreading/Thread.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace Threading {
 
@@ -31,7 +31,6 @@ private:
     BackgroundActionBase() = default;
 
     static void enqueue_work(ESCAPING Function<void()>);
-    static Thread& background_thread();
 };
 
 template<typename Result>
@@ -76,7 +75,10 @@ private:
             m_on_error = on_error.release_value();
 
         enqueue_work([self = NonnullRefPtr(*this), origin_event_loop = &Core::EventLoop::current()]() {
-            auto result = self->m_action(*self);
+            // Don't start the action at all if we were canceled while waiting for a thread.
+            ErrorOr<Result> result = Error::from_errno(ECANCELED);
+            if (!self->m_canceled)
+                result = self->m_action(*self);
             // The event loop cancels the promise when it exits.
             self->m_canceled |= self->m_promise->is_rejected();
             // All of our work was successful and we weren't cancelled; resolve the event loop's promise.
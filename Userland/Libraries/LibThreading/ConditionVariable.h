@@ -7,7 +7,9 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/Time.h>
 #include <LibThreading/Mutex.h>
+#include <errno.h>
 #include <pthread.h>
 #include <sys/types.h>
 
@@ -42,6 +44,16 @@ public:
         while (condition())
             wait();
     }
+    // Returns false if the timeout elapsed before the variable was signaled.
+    ALWAYS_INLINE bool wait_for(AK::Duration timeout)
+    {
+        auto deadline = (UnixDateTime::now() + timeout).to_timespec();
+        auto result = pthread_cond_timedwait(&m_condition, &m_to_wait_on.m_mutex, &deadline);
+        if (result == ETIMEDOUT)
+            return false;
+        VERIFY(result == 0);
+        return true;
+    }
     // Release at least one of the threads waiting on this variable.
     ALWAYS_INLINE void signal()
     {
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+// Tasks are mostly short and independent, e.g. decoding an image, so a few threads are enough to keep things moving
+// without competing with the rendering threads.
+static constexpr size_t max_shared_pool_thread_count = 8;
+
+static ThreadPool* s_shared_pool;
+static Mutex s_shared_pool_mutex;
+
+// The pool and worker that the current thread belongs to, if any.
+static thread_local ThreadPool* s_current_pool;
+static thread_local size_t s_current_worker_index;
+
+bool ThreadPool::Task::cancel()
+{
+    auto expected = State::Queued;
+    return m_state.compare_exchange_strong(expected, State::Canceled, AK::MemoryOrder::memory_order_acq_rel);
+}
+
+void ThreadPool::Task::run()
+{
+    auto expected = State::Queued;
+    if (!m_state.compare_exchange_strong(expected, State::Running, AK::MemoryOrder::memory_order_acq_rel))
+        return;
+
+    m_work();
+    // Release anything the work captured on the worker, rather than wherever the last reference is dropped.
+    m_work = nullptr;
+    m_state.store(State::Finished, AK::MemoryOrder::memory_order_release);
+}
+
+ThreadPool& ThreadPool::the()
+{
+    MutexLocker locker { s_shared_pool_mutex };
+    if (!s_shared_pool) {
+        auto thread_count = clamp(static_cast<size_t>(Core::System::hardware_concurrency()), 1uz, max_shared_pool_thread_count);
+        s_shared_pool = MUST(create(thread_count)).leak_ptr();
+    }
+    return *s_shared_pool;
+}
+
+void ThreadPool::shut_down_shared_pool()
+{
+    ThreadPool* pool = nullptr;
+    {
+        MutexLocker locker { s_shared_pool_mutex };
+        swap(pool, s_shared_pool);
+    }
+    delete pool;
+}
+
+ErrorOr<NonnullOwnPtr<ThreadPool>> ThreadPool::create(size_t thread_count)
+{
+    VERIFY(thread_count > 0);
+
+    auto pool = TRY(adopt_nonnull_own_or_enomem(new (nothrow) ThreadPool));
+    TRY(pool->m_workers.try_ensure_capacity(thread_count));
+
+    for (size_t i = 0; i < thread_count; ++i)
+        pool->m_workers.unchecked_append(TRY(adopt_nonnull_own_or_enomem(new (nothrow) Worker)));
+
+    // Only start the threads once all workers exist, since they look at each other's queues.
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto& worker = *pool->m_workers[i];
+        worker.thread = TRY(Thread::try_create([pool = pool.ptr(), i] {
+            pool->run_worker(i);
+            return 0;
+        },
+            "Pool Worker"sv));
+        worker.thread->start();
+    }
+
+    return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexLocker locker { m_sleep_mutex };
+        m_shutting_down = true;
+        m_wake_condition.broadcast();
+    }
+
+    for (auto& worker : m_workers) {
+        if (worker->thread && worker->thread->needs_to_be_joined())
+            (void)worker->thread->join();
+    }
+}
+
+NonnullRefPtr<ThreadPool::Task> ThreadPool::submit(Function<void()> work, Priority priority)
+{
+    auto task = adopt_ref(*new Task(move(work)));
+
+    // Keep work that was spawned by a task on the same worker, its data is likely still in that core's cache.
+    size_t worker_index;
+    if (s_current_pool == this)
+        worker_index = s_current_worker_index;
+    else
+        worker_index = m_next_worker_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) % m_workers.size();
+
+    // Count the task first, so that a worker that takes it right away never sees the count drop below zero.
+    m_queued_task_count.fetch_add(1, AK::MemoryOrder::memory_order_release);
+
+    auto& worker = *m_workers[worker_index];
+    {
+        MutexLocker locker { worker.mutex };
+        worker.queues[to_underlying(priority)].append(task);
+    }
+
+    {
+        MutexLocker locker { m_sleep_mutex };
+        m_wake_condition.signal();
+    }
+
+    return task;
+}
+
+RefPtr<ThreadPool::Task> ThreadPool::take_task(size_t worker_index)
+{
+    for (size_t priority = 0; priority < priority_count; ++priority) {
+        // Take our own work in the order it was queued.
+        {
+            auto& worker = *m_workers[worker_index];
+            MutexLocker locker { worker.mutex };
+            if (!worker.queues[priority].is_empty())
+                return worker.queues[priority].take_first();
+        }
+
+        // Steal the most recently queued work of the other workers, which their owners would get to last.
+        for (size_t offset = 1; offset < m_workers.size(); ++offset) {
+            auto& victim = *m_workers[(worker_index + offset) % m_workers.size()];
+            MutexLocker locker { victim.mutex };
+            if (!victim.queues[priority].is_empty())
+                return victim.queues[priority].take_last();
+        }
+    }
+    return nullptr;
+}
+
+void ThreadPool::run_worker(size_t index)
+{
+    s_current_pool = this;
+    s_current_worker_index = index;
+
+    while (true) {
+        if (auto task = take_task(index)) {
+            m_queued_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_acq_rel);
+            task->run();
+            continue;
+        }
+
+        MutexLocker locker { m_sleep_mutex };
+        while (m_queued_task_count.load(AK::MemoryOrder::memory_order_acquire) == 0 && !m_shutting_down)
+            m_wake_condition.wait();
+        if (m_shutting_down)
+            break;
+    }
+
+    s_current_pool = nullptr;
+}
+
+}
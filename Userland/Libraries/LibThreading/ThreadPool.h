@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A fixed set of worker threads that run tasks submitted from any thread.
+//
+// Each worker has its own queue per priority. Tasks submitted from a worker go onto that worker's queue, and tasks
+// from anywhere else are spread over the workers. A worker that runs out of work steals from the back of the other
+// workers' queues, always looking for the most urgent priority first.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    // Queued tasks of a higher priority are always started before those of a lower one.
+    enum class Priority : u8 {
+        UserBlocking,
+        Normal,
+        Background,
+    };
+    static constexpr size_t priority_count = 3;
+
+    class Task : public AtomicRefCounted<Task> {
+        friend class ThreadPool;
+
+    public:
+        // Returns true if the task was prevented from running. A task that has already started runs to completion.
+        bool cancel();
+
+        bool is_canceled() const { return m_state.load(AK::MemoryOrder::memory_order_acquire) == State::Canceled; }
+        bool has_finished() const { return m_state.load(AK::MemoryOrder::memory_order_acquire) == State::Finished; }
+
+    private:
+        enum class State : u8 {
+            Queued,
+            Running,
+            Finished,
+            Canceled,
+        };
+
+        explicit Task(Function<void()> work)
+            : m_work(move(work))
+        {
+        }
+
+        void run();
+
+        Function<void()> m_work;
+        Atomic<State> m_state { State::Queued };
+    };
+
+    // The pool shared by everything in the process, sized to the number of hardware threads.
+    static ThreadPool& the();
+    // Joins the threads of the shared pool. It will be recreated if it's used again.
+    static void shut_down_shared_pool();
+
+    static ErrorOr<NonnullOwnPtr<ThreadPool>> create(size_t thread_count);
+
+    // Waits for the running tasks to finish. Tasks that haven't started yet are dropped.
+    ~ThreadPool();
+
+    NonnullRefPtr<Task> submit(Function<void()>, Priority = Priority::Normal);
+
+    size_t thread_count() const { return m_workers.size(); }
+
+private:
+    struct Worker {
+        RefPtr<Thread> thread;
+        Mutex mutex;
+        Array<Vector<NonnullRefPtr<Task>>, priority_count> queues;
+    };
+
+    ThreadPool() = default;
+
+    void run_worker(size_t index);
+    RefPtr<Task> take_task(size_t worker_index);
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Atomic<size_t> m_next_worker_index { 0 };
+
+    // Workers sleep on this while there's nothing in any of the queues.
+    Mutex m_sleep_mutex;
+    ConditionVariable m_wake_condition { m_sleep_mutex };
+    Atomic<size_t> m_queued_task_count { 0 };
+    bool m_shutting_down { false };
+};
+
+}
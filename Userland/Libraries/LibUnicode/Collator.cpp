@@ -163,7 +163,7 @@ static bool ignore_punctuation_for_collator(icu::Collator const& collator)
 
 class CollatorImpl : public Collator {
 public:
-    explicit CollatorImpl(NonnullOwnPtr<icu::Collator> collator)
+    explicit CollatorImpl(NonnullRefPtr<CachedICUObject<icu::Collator>> collator)
         : m_collator(move(collator))
     {
     }
@@ -172,7 +172,7 @@ public:
     {
         UErrorCode status = U_ZERO_ERROR;
 
-        auto result = m_collator->compareUTF8(icu_string_piece(lhs), icu_string_piece(rhs), status);
+        auto result = m_collator->object().compareUTF8(icu_string_piece(lhs), icu_string_piece(rhs), status);
         VERIFY(icu_success(status));
 
         switch (result) {
@@ -189,18 +189,21 @@ public:
 
     virtual Sensitivity sensitivity() const override
     {
-        return sensitivity_for_collator(*m_collator);
+        return sensitivity_for_collator(m_collator->object());
     }
 
     virtual bool ignore_punctuation() const override
     {
-        return ignore_punctuation_for_collator(*m_collator);
+        return ignore_punctuation_for_collator(m_collator->object());
     }
 
 private:
-    NonnullOwnPtr<icu::Collator> m_collator;
+    // Comparing strings is const, so the collator is shared between all Collators with the same locale and options.
+    NonnullRefPtr<CachedICUObject<icu::Collator>> m_collator;
 };
 
+static ICUObjectCache<icu::Collator> s_collator_cache;
+
 NonnullOwnPtr<Collator> Collator::create(
     StringView locale,
     Usage usage,
@@ -210,35 +213,48 @@ NonnullOwnPtr<Collator> Collator::create(
     bool numeric,
     Optional<bool> ignore_punctuation)
 {
-    UErrorCode status = U_ZERO_ERROR;
+    auto key = MUST(String::formatted("{}|{}|{}|{}|{}|{}|{}",
+        locale,
+        to_underlying(usage),
+        collation,
+        sensitivity.map([](auto value) { return to_underlying(value); }),
+        to_underlying(case_first),
+        numeric,
+        ignore_punctuation));
+
+    auto shared_collator = s_collator_cache.ensure(move(key), [&]() {
+        UErrorCode status = U_ZERO_ERROR;
 
-    auto locale_data = LocaleData::for_locale(locale);
-    VERIFY(locale_data.has_value());
+        auto locale_data = LocaleData::for_locale(locale);
+        VERIFY(locale_data.has_value());
 
-    auto locale_with_usage = apply_usage_to_locale(locale_data->locale(), usage, collation);
+        auto locale_with_usage = apply_usage_to_locale(locale_data->locale(), usage, collation);
 
-    auto collator = adopt_own(*icu::Collator::createInstance(*locale_with_usage, status));
-    VERIFY(icu_success(status));
-
-    auto set_attribute = [&](UColAttribute attribute, UColAttributeValue value) {
-        collator->setAttribute(attribute, value, status);
+        auto collator = adopt_own(*icu::Collator::createInstance(*locale_with_usage, status));
         VERIFY(icu_success(status));
-    };
 
-    if (!sensitivity.has_value())
-        sensitivity = sensitivity_for_collator(*collator);
+        auto set_attribute = [&](UColAttribute attribute, UColAttributeValue value) {
+            collator->setAttribute(attribute, value, status);
+            VERIFY(icu_success(status));
+        };
+
+        if (!sensitivity.has_value())
+            sensitivity = sensitivity_for_collator(*collator);
+
+        if (!ignore_punctuation.has_value())
+            ignore_punctuation = ignore_punctuation_for_collator(*collator);
 
-    if (!ignore_punctuation.has_value())
-        ignore_punctuation = ignore_punctuation_for_collator(*collator);
+        set_attribute(UCOL_STRENGTH, icu_sensitivity(*sensitivity));
+        set_attribute(UCOL_CASE_LEVEL, sensitivity == Sensitivity::Case ? UCOL_ON : UCOL_OFF);
+        set_attribute(UCOL_CASE_FIRST, icu_case_first(case_first));
+        set_attribute(UCOL_NUMERIC_COLLATION, numeric ? UCOL_ON : UCOL_OFF);
+        set_attribute(UCOL_ALTERNATE_HANDLING, *ignore_punctuation ? UCOL_SHIFTED : UCOL_NON_IGNORABLE);
+        set_attribute(UCOL_NORMALIZATION_MODE, UCOL_ON);
 
-    set_attribute(UCOL_STRENGTH, icu_sensitivity(*sensitivity));
-    set_attribute(UCOL_CASE_LEVEL, sensitivity == Sensitivity::Case ? UCOL_ON : UCOL_OFF);
-    set_attribute(UCOL_CASE_FIRST, icu_case_first(case_first));
-    set_attribute(UCOL_NUMERIC_COLLATION, numeric ? UCOL_ON : UCOL_OFF);
-    set_attribute(UCOL_ALTERNATE_HANDLING, *ignore_punctuation ? UCOL_SHIFTED : UCOL_NON_IGNORABLE);
-    set_attribute(UCOL_NORMALIZATION_MODE, UCOL_ON);
+        return collator;
+    });
 
-    return adopt_own(*new CollatorImpl(move(collator)));
+    return adopt_own(*new CollatorImpl(move(shared_collator)));
 }
 
 }
@@ -870,6 +870,20 @@ private:
     mutable OwnPtr<icu::DateIntervalFormat> m_range_formatter;
 };
 
+// Date formatters are mutated when they are bound to a time zone, so they cannot be shared. Instead, we keep one around
+// for each locale and set of options, and hand out clones of it, which is much cheaper than creating a new one.
+static ICUObjectCache<icu::SimpleDateFormat> s_date_time_formatter_cache;
+
+static NonnullOwnPtr<DateTimeFormat> create_from_cached_formatter(LocaleData& locale_data, StringView time_zone_identifier, CachedICUObject<icu::SimpleDateFormat> const& prototype)
+{
+    auto formatter = adopt_own(*prototype.object().clone());
+
+    icu::UnicodeString pattern;
+    formatter->toPattern(pattern);
+
+    return adopt_own(*new DateTimeFormatImpl(locale_data.locale(), pattern, time_zone_identifier, move(formatter)));
+}
+
 NonnullOwnPtr<DateTimeFormat> DateTimeFormat::create_for_date_and_time_style(
     StringView locale,
     StringView time_zone_identifier,
@@ -878,44 +892,51 @@ NonnullOwnPtr<DateTimeFormat> DateTimeFormat::create_for_date_and_time_style(
     Optional<DateTimeStyle> const& date_style,
     Optional<DateTimeStyle> const& time_style)
 {
-    UErrorCode status = U_ZERO_ERROR;
-
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto formatter = adopt_own(*verify_cast<icu::SimpleDateFormat>([&]() {
-        if (date_style.has_value() && time_style.has_value()) {
-            return icu::DateFormat::createDateTimeInstance(
-                icu_date_time_style(*date_style), icu_date_time_style(*time_style), locale_data->locale());
-        }
-        if (date_style.has_value()) {
-            return icu::DateFormat::createDateInstance(
-                icu_date_time_style(*date_style), locale_data->locale());
-        }
-        if (time_style.has_value()) {
-            return icu::DateFormat::createTimeInstance(
-                icu_date_time_style(*time_style), locale_data->locale());
-        }
-        VERIFY_NOT_REACHED();
-    }()));
+    auto underlying = [](auto const& value) { return value.map([](auto enum_value) { return to_underlying(enum_value); }); };
+    auto key = MUST(String::formatted("style|{}|{}|{}|{}|{}", locale, underlying(hour_cycle), hour12, underlying(date_style), underlying(time_style)));
 
-    icu::UnicodeString pattern;
-    formatter->toPattern(pattern);
+    auto prototype = s_date_time_formatter_cache.ensure(move(key), [&]() {
+        UErrorCode status = U_ZERO_ERROR;
 
-    auto skeleton = icu::DateTimePatternGenerator::staticGetSkeleton(pattern, status);
-    VERIFY(icu_success(status));
+        auto formatter = adopt_own(*verify_cast<icu::SimpleDateFormat>([&]() {
+            if (date_style.has_value() && time_style.has_value()) {
+                return icu::DateFormat::createDateTimeInstance(
+                    icu_date_time_style(*date_style), icu_date_time_style(*time_style), locale_data->locale());
+            }
+            if (date_style.has_value()) {
+                return icu::DateFormat::createDateInstance(
+                    icu_date_time_style(*date_style), locale_data->locale());
+            }
+            if (time_style.has_value()) {
+                return icu::DateFormat::createTimeInstance(
+                    icu_date_time_style(*time_style), locale_data->locale());
+            }
+            VERIFY_NOT_REACHED();
+        }()));
+
+        icu::UnicodeString pattern;
+        formatter->toPattern(pattern);
 
-    if (apply_hour_cycle_to_skeleton(skeleton, hour_cycle, hour12)) {
-        pattern = locale_data->date_time_pattern_generator().getBestPattern(skeleton, UDATPG_MATCH_ALL_FIELDS_LENGTH, status);
+        auto skeleton = icu::DateTimePatternGenerator::staticGetSkeleton(pattern, status);
         VERIFY(icu_success(status));
 
-        apply_hour_cycle_to_skeleton(pattern, hour_cycle, hour12);
+        if (apply_hour_cycle_to_skeleton(skeleton, hour_cycle, hour12)) {
+            pattern = locale_data->date_time_pattern_generator().getBestPattern(skeleton, UDATPG_MATCH_ALL_FIELDS_LENGTH, status);
+            VERIFY(icu_success(status));
 
-        formatter = adopt_own(*new icu::SimpleDateFormat(pattern, locale_data->locale(), status));
-        VERIFY(icu_success(status));
-    }
+            apply_hour_cycle_to_skeleton(pattern, hour_cycle, hour12);
 
-    return adopt_own(*new DateTimeFormatImpl(locale_data->locale(), pattern, time_zone_identifier, move(formatter)));
+            formatter = adopt_own(*new icu::SimpleDateFormat(pattern, locale_data->locale(), status));
+            VERIFY(icu_success(status));
+        }
+
+        return formatter;
+    });
+
+    return create_from_cached_formatter(*locale_data, time_zone_identifier, prototype);
 }
 
 NonnullOwnPtr<DateTimeFormat> DateTimeFormat::create_for_pattern_options(
@@ -923,21 +944,29 @@ NonnullOwnPtr<DateTimeFormat> DateTimeFormat::create_for_pattern_options(
     StringView time_zone_identifier,
     CalendarPattern const& options)
 {
-    UErrorCode status = U_ZERO_ERROR;
-
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto skeleton = icu_string(options.to_pattern());
-    auto pattern = locale_data->date_time_pattern_generator().getBestPattern(skeleton, UDATPG_MATCH_ALL_FIELDS_LENGTH, status);
-    VERIFY(icu_success(status));
+    auto skeleton_string = options.to_pattern();
 
-    apply_hour_cycle_to_skeleton(pattern, options.hour_cycle, {});
+    auto key = MUST(String::formatted("pattern|{}|{}|{}", locale, skeleton_string, options.hour_cycle.map([](auto value) { return to_underlying(value); })));
 
-    auto formatter = adopt_own(*new icu::SimpleDateFormat(pattern, locale_data->locale(), status));
-    VERIFY(icu_success(status));
+    auto prototype = s_date_time_formatter_cache.ensure(move(key), [&]() {
+        UErrorCode status = U_ZERO_ERROR;
+
+        auto skeleton = icu_string(skeleton_string);
+        auto pattern = locale_data->date_time_pattern_generator().getBestPattern(skeleton, UDATPG_MATCH_ALL_FIELDS_LENGTH, status);
+        VERIFY(icu_success(status));
+
+        apply_hour_cycle_to_skeleton(pattern, options.hour_cycle, {});
+
+        auto formatter = adopt_own(*new icu::SimpleDateFormat(pattern, locale_data->locale(), status));
+        VERIFY(icu_success(status));
+
+        return formatter;
+    });
 
-    return adopt_own(*new DateTimeFormatImpl(locale_data->locale(), pattern, time_zone_identifier, move(formatter)));
+    return create_from_cached_formatter(*locale_data, time_zone_identifier, prototype);
 }
 
 static constexpr Weekday icu_calendar_day_to_weekday(UCalendarDaysOfWeek day)
@@ -6,8 +6,12 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
+#include <AK/RefCounted.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
 #include <AK/Vector.h>
@@ -76,6 +80,51 @@ private:
     NonnullOwnPtr<icu::TimeZone> m_time_zone;
 };
 
+template<typename T>
+class CachedICUObject final : public RefCounted<CachedICUObject<T>> {
+public:
+    explicit CachedICUObject(NonnullOwnPtr<T> object)
+        : m_object(move(object))
+    {
+    }
+
+    T& object() { return *m_object; }
+    T const& object() const { return *m_object; }
+
+private:
+    NonnullOwnPtr<T> m_object;
+};
+
+// Creating ICU formatters is expensive, and the Intl APIs create many of them with the same locale and options (e.g.
+// Number.prototype.toLocaleString creates a new Intl.NumberFormat on every call). These caches hold on to them, keyed
+// by a string describing the locale and options they were created with.
+template<typename T>
+class ICUObjectCache {
+public:
+    using Object = NonnullRefPtr<CachedICUObject<T>>;
+
+    template<typename Callback>
+    Object ensure(String key, Callback&& create)
+    {
+        if (auto object = m_objects.get(key); object.has_value())
+            return *object.value();
+
+        // Don't let an unbounded number of distinct options grow the cache forever. Objects which are still in use are
+        // kept alive by their users.
+        if (m_objects.size() >= max_size)
+            m_objects.clear();
+
+        auto object = adopt_ref(*new CachedICUObject<T>(create()));
+        m_objects.set(move(key), object);
+        return object;
+    }
+
+private:
+    static constexpr size_t max_size = 256;
+
+    HashMap<String, Object> m_objects;
+};
+
 constexpr bool icu_success(UErrorCode code)
 {
     return static_cast<bool>(U_SUCCESS(code));
@@ -6,6 +6,7 @@
 
 #include <AK/CharacterTypes.h>
 #include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
 #include <LibUnicode/ICU.h>
 #include <LibUnicode/Locale.h>
@@ -592,7 +593,7 @@ static void flatten_partitions(Vector<PartitionRange>& partitions)
 
 class NumberFormatImpl : public NumberFormat {
 public:
-    NumberFormatImpl(icu::Locale& locale, icu::number::LocalizedNumberFormatter formatter, bool is_unit)
+    NumberFormatImpl(icu::Locale& locale, NonnullRefPtr<CachedICUObject<icu::number::LocalizedNumberFormatter>> formatter, bool is_unit)
         : m_locale(locale)
         , m_formatter(move(formatter))
         , m_is_unit(is_unit)
@@ -755,10 +756,10 @@ private:
 
         auto formatted = value.visit(
             [&](double number) {
-                return m_formatter.formatDouble(number, status);
+                return m_formatter->object().formatDouble(number, status);
             },
             [&](String const& number) {
-                return m_formatter.formatDecimal(icu_string_piece(number), status);
+                return m_formatter->object().formatDecimal(icu_string_piece(number), status);
             });
 
         if (icu_failure(status))
@@ -772,7 +773,7 @@ private:
         UErrorCode status = U_ZERO_ERROR;
 
         if (!m_range_formatter.has_value()) {
-            auto skeleton = icu::number::NumberFormatter::forSkeleton(m_formatter.toSkeleton(status), status);
+            auto skeleton = icu::number::NumberFormatter::forSkeleton(m_formatter->object().toSkeleton(status), status);
             if (icu_failure(status))
                 return {};
 
@@ -855,7 +856,9 @@ private:
 
     icu::Locale& m_locale;
 
-    icu::number::LocalizedNumberFormatter m_formatter;
+    // Formatting is const, so the formatter is shared between all NumberFormats with the same locale and options.
+    // This also lets ICU compile it into its fast path, which it only does for formatters that are used repeatedly.
+    NonnullRefPtr<CachedICUObject<icu::number::LocalizedNumberFormatter>> m_formatter;
     mutable Optional<icu::number::LocalizedNumberRangeFormatter> m_range_formatter;
 
     OwnPtr<icu::PluralRules> m_plural_rules;
@@ -863,28 +866,75 @@ private:
     bool m_is_unit { false };
 };
 
-NonnullOwnPtr<NumberFormat> NumberFormat::create(
+static String number_format_cache_key(
     StringView locale,
     StringView numbering_system,
     DisplayOptions const& display_options,
     RoundingOptions const& rounding_options)
 {
-    UErrorCode status = U_ZERO_ERROR;
+    auto underlying = [](auto const& value) { return value.map([](auto enum_value) { return to_underlying(enum_value); }); };
+
+    StringBuilder builder;
+    builder.appendff("{}|{}|", locale, numbering_system);
+
+    builder.appendff("{}|{}|{}|{}|{}|",
+        to_underlying(display_options.style),
+        to_underlying(display_options.sign_display),
+        to_underlying(display_options.notation),
+        underlying(display_options.compact_display),
+        to_underlying(display_options.grouping));
+    builder.appendff("{}|{}|{}|{}|{}|",
+        display_options.currency,
+        underlying(display_options.currency_display),
+        underlying(display_options.currency_sign),
+        display_options.unit,
+        underlying(display_options.unit_display));
+
+    builder.appendff("{}|{}|{}|",
+        to_underlying(rounding_options.type),
+        to_underlying(rounding_options.mode),
+        to_underlying(rounding_options.trailing_zero_display));
+    builder.appendff("{}|{}|{}|{}|{}|{}",
+        rounding_options.min_significant_digits,
+        rounding_options.max_significant_digits,
+        rounding_options.min_fraction_digits,
+        rounding_options.max_fraction_digits,
+        rounding_options.min_integer_digits,
+        rounding_options.rounding_increment);
+
+    return MUST(builder.to_string());
+}
+
+static ICUObjectCache<icu::number::LocalizedNumberFormatter> s_number_formatter_cache;
 
+NonnullOwnPtr<NumberFormat> NumberFormat::create(
+    StringView locale,
+    StringView numbering_system,
+    DisplayOptions const& display_options,
+    RoundingOptions const& rounding_options)
+{
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto formatter = icu::number::NumberFormatter::withLocale(locale_data->locale());
-    apply_display_options(formatter, display_options);
-    apply_rounding_options(formatter, rounding_options);
+    auto key = number_format_cache_key(locale, numbering_system, display_options, rounding_options);
 
-    if (!numbering_system.is_empty()) {
-        if (auto* symbols = icu::NumberingSystem::createInstanceByName(ByteString(numbering_system).characters(), status); symbols && icu_success(status))
-            formatter = formatter.adoptSymbols(symbols);
-    }
+    auto shared_formatter = s_number_formatter_cache.ensure(move(key), [&]() {
+        UErrorCode status = U_ZERO_ERROR;
+
+        auto formatter = icu::number::NumberFormatter::withLocale(locale_data->locale());
+        apply_display_options(formatter, display_options);
+        apply_rounding_options(formatter, rounding_options);
+
+        if (!numbering_system.is_empty()) {
+            if (auto* symbols = icu::NumberingSystem::createInstanceByName(ByteString(numbering_system).characters(), status); symbols && icu_success(status))
+                formatter = formatter.adoptSymbols(symbols);
+        }
+
+        return make<icu::number::LocalizedNumberFormatter>(move(formatter));
+    });
 
     bool is_unit = display_options.style == NumberFormatStyle::Unit;
-    return adopt_own(*new NumberFormatImpl(locale_data->locale(), move(formatter), is_unit));
+    return adopt_own(*new NumberFormatImpl(locale_data->locale(), move(shared_formatter), is_unit));
 }
 
 }
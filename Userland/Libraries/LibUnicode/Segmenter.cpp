@@ -211,28 +211,37 @@ NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granul
     return Segmenter::create(default_locale(), segmenter_granularity);
 }
 
+// Break iterators hold the state of the text being segmented, so they cannot be shared. Instead, we keep one around for
+// each locale and granularity, and hand out clones of it, which is much cheaper than creating a new one.
+static ICUObjectCache<icu::BreakIterator> s_segmenter_cache;
+
 NonnullOwnPtr<Segmenter> Segmenter::create(StringView locale, SegmenterGranularity segmenter_granularity)
 {
-    UErrorCode status = U_ZERO_ERROR;
-
-    auto locale_data = LocaleData::for_locale(locale);
-    VERIFY(locale_data.has_value());
-
-    auto segmenter = adopt_own_if_nonnull([&]() {
-        switch (segmenter_granularity) {
-        case SegmenterGranularity::Grapheme:
-            return icu::BreakIterator::createCharacterInstance(locale_data->locale(), status);
-        case SegmenterGranularity::Sentence:
-            return icu::BreakIterator::createSentenceInstance(locale_data->locale(), status);
-        case SegmenterGranularity::Word:
-            return icu::BreakIterator::createWordInstance(locale_data->locale(), status);
-        }
-        VERIFY_NOT_REACHED();
-    }());
+    auto key = MUST(String::formatted("{}|{}", locale, to_underlying(segmenter_granularity)));
+
+    auto prototype = s_segmenter_cache.ensure(move(key), [&]() {
+        UErrorCode status = U_ZERO_ERROR;
 
-    VERIFY(icu_success(status));
+        auto locale_data = LocaleData::for_locale(locale);
+        VERIFY(locale_data.has_value());
+
+        auto segmenter = adopt_own_if_nonnull([&]() {
+            switch (segmenter_granularity) {
+            case SegmenterGranularity::Grapheme:
+                return icu::BreakIterator::createCharacterInstance(locale_data->locale(), status);
+            case SegmenterGranularity::Sentence:
+                return icu::BreakIterator::createSentenceInstance(locale_data->locale(), status);
+            case SegmenterGranularity::Word:
+                return icu::BreakIterator::createWordInstance(locale_data->locale(), status);
+            }
+            VERIFY_NOT_REACHED();
+        }());
+
+        VERIFY(icu_success(status));
+        return segmenter.release_nonnull();
+    });
 
-    return make<SegmenterImpl>(segmenter.release_nonnull(), segmenter_granularity);
+    return make<SegmenterImpl>(adopt_own(*prototype->object().clone()), segmenter_granularity);
 }
 
 }
@@ -147,6 +147,9 @@ ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module)
         return result.release_error();
     }
 
+    for (auto& code : module.code_section().functions())
+        BytecodeInterpreter::compile(code.func().body());
+
     return {};
 }
 InstantiationResult AbstractMachine::instantiate(Module const& module, Vector<ExternValue> externs)
@@ -427,6 +427,12 @@ public:
     {
         MemoryInstance instance { type };
 
+        // Reserve space for the maximum size up front if there is one, so that memory.grow doesn't have to move
+        // everything around. This is only address space; pages get committed as they are zeroed on grow.
+        // If the reservation fails, we simply fall back to reallocating on grow.
+        if (auto max = type.limits().max(); max.has_value())
+            (void)instance.m_data.try_ensure_capacity(min(static_cast<u64>(max.value()), 65536ull) * Constants::page_size);
+
         if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No))
             return Error::from_string_literal("Failed to grow to requested size");
 
@@ -581,25 +587,6 @@ private:
     Vector<DataInstance> m_datas;
 };
 
-class Label {
-public:
-    explicit Label(size_t arity, InstructionPointer continuation, size_t stack_height)
-        : m_arity(arity)
-        , m_stack_height(stack_height)
-        , m_continuation(continuation)
-    {
-    }
-
-    auto continuation() const { return m_continuation; }
-    auto arity() const { return m_arity; }
-    auto stack_height() const { return m_stack_height; }
-
-private:
-    size_t m_arity { 0 };
-    size_t m_stack_height { 0 };
-    InstructionPointer m_continuation { 0 };
-};
-
 class Frame {
 public:
     explicit Frame(ModuleInstance const& module, Vector<Value> locals, Expression const& expression, size_t arity)
@@ -615,15 +602,15 @@ public:
     auto& locals() { return m_locals; }
     auto& expression() const { return m_expression; }
     auto arity() const { return m_arity; }
-    auto label_index() const { return m_label_index; }
-    auto& label_index() { return m_label_index; }
+    auto value_stack_base() const { return m_value_stack_base; }
+    auto& value_stack_base() { return m_value_stack_base; }
 
 private:
     ModuleInstance const& m_module;
     Vector<Value> m_locals;
     Expression const& m_expression;
     size_t m_arity { 0 };
-    size_t m_label_index { 0 };
+    size_t m_value_stack_base { 0 };
 };
 
 using InstantiationResult = AK::ErrorOr<NonnullOwnPtr<ModuleInstance>, InstantiationError>;
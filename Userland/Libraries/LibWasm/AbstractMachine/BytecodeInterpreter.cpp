@@ -56,16 +56,57 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
     }
 }
 
-void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index)
+void BytecodeInterpreter::compile(Expression& expression)
 {
-    dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
-    for (size_t i = 0; i < index.value(); ++i)
-        configuration.label_stack().take_last();
-    auto label = configuration.label_stack().last();
-    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
-
-    configuration.value_stack().remove(label.stack_height(), configuration.value_stack().size() - label.stack_height() - label.arity());
-    configuration.ip() = label.continuation();
+    // Common sequences get their first instruction replaced by a synthetic one that executes the whole sequence
+    // in one go. The rest of the sequence stays in place, so branches into the middle of it still work.
+    auto& instructions = expression.instructions();
+    auto opcode_at = [&](size_t ip) -> Optional<OpCode> {
+        if (ip >= instructions.size())
+            return {};
+        return instructions[ip].opcode();
+    };
+    auto fuse = [&](size_t ip, OpCode opcode) {
+        instructions[ip] = Instruction { opcode, instructions[ip].arguments() };
+    };
+
+    for (size_t ip = 0; ip < instructions.size(); ++ip) {
+        auto opcode = instructions[ip].opcode();
+        auto next = opcode_at(ip + 1);
+        auto after_next = opcode_at(ip + 2);
+
+        if (opcode == Instructions::local_get && next == Instructions::local_get) {
+            if (after_next == Instructions::i32_add) {
+                fuse(ip, Instructions::synthetic_i32_add2local);
+                ip += 2;
+            } else {
+                fuse(ip, Instructions::synthetic_local_get2);
+                ip += 1;
+            }
+        } else if (opcode == Instructions::local_get && next == Instructions::i32_const && after_next == Instructions::i32_add) {
+            fuse(ip, Instructions::synthetic_i32_addconstlocal);
+            ip += 2;
+        } else if (opcode == Instructions::local_get && next == Instructions::i32_const && after_next == Instructions::i32_and) {
+            fuse(ip, Instructions::synthetic_i32_andconstlocal);
+            ip += 2;
+        } else if (opcode == Instructions::local_get && next == Instructions::local_set) {
+            fuse(ip, Instructions::synthetic_local_copy);
+            ip += 1;
+        } else if (opcode == Instructions::i32_const && next == Instructions::local_set) {
+            fuse(ip, Instructions::synthetic_local_seti32_const);
+            ip += 1;
+        }
+    }
+}
+
+void BytecodeInterpreter::branch_to(Configuration& configuration, Instruction::BranchTarget const& target)
+{
+    dbgln_if(WASM_TRACE_DEBUG, "Branch to IP {}, with {} result(s) at stack height {}", target.continuation.value(), target.arity, target.stack_height);
+
+    auto& value_stack = configuration.value_stack();
+    auto stack_height = configuration.frame().value_stack_base() + target.stack_height;
+    value_stack.remove(stack_height, value_stack.size() - stack_height - target.arity);
+    configuration.ip() = target.continuation;
 }
 
 template<typename ReadType, typename PushType>
@@ -372,35 +413,22 @@ void BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
 template<typename T>
 T BytecodeInterpreter::read_value(ReadonlyBytes data)
 {
-    FixedMemoryStream stream { data };
-    auto value_or_error = stream.read_value<LittleEndian<T>>();
-    if (value_or_error.is_error()) {
-        dbgln("Read from {} failed", data.data());
-        m_trap = Trap { "Read from memory failed" };
-    }
-    return value_or_error.release_value();
+    // All callers have already checked that the access is in bounds, so there's no need to go through a stream here.
+    T value;
+    ByteReader::load(data.data(), value);
+    return AK::convert_between_host_and_little_endian(value);
 }
 
 template<>
 float BytecodeInterpreter::read_value<float>(ReadonlyBytes data)
 {
-    FixedMemoryStream stream { data };
-    auto raw_value_or_error = stream.read_value<LittleEndian<u32>>();
-    if (raw_value_or_error.is_error())
-        m_trap = Trap { "Read from memory failed" };
-    auto raw_value = raw_value_or_error.release_value();
-    return bit_cast<float>(static_cast<u32>(raw_value));
+    return bit_cast<float>(read_value<u32>(data));
 }
 
 template<>
 double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
 {
-    FixedMemoryStream stream { data };
-    auto raw_value_or_error = stream.read_value<LittleEndian<u64>>();
-    if (raw_value_or_error.is_error())
-        m_trap = Trap { "Read from memory failed" };
-    auto raw_value = raw_value_or_error.release_value();
-    return bit_cast<double>(static_cast<u64>(raw_value));
+    return bit_cast<double>(read_value<u64>(data));
 }
 
 ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
@@ -416,6 +444,46 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
     case Instructions::local_get.value():
         configuration.value_stack().append(Value(configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()]));
         return;
+    case Instructions::synthetic_i32_add2local.value(): {
+        // The arguments of the rest of the sequence are still in the instructions that follow this one.
+        auto& locals = configuration.frame().locals();
+        auto lhs = locals[instruction.arguments().get<LocalIndex>().value()].to<u32>();
+        auto rhs = locals[(&instruction)[1].arguments().get<LocalIndex>().value()].to<u32>();
+        configuration.value_stack().append(Value(static_cast<i32>(Operators::Add {}(lhs, rhs))));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_i32_addconstlocal.value(): {
+        auto lhs = configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()].to<u32>();
+        auto rhs = static_cast<u32>((&instruction)[1].arguments().get<i32>());
+        configuration.value_stack().append(Value(static_cast<i32>(Operators::Add {}(lhs, rhs))));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_i32_andconstlocal.value(): {
+        auto lhs = configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()].to<i32>();
+        auto rhs = (&instruction)[1].arguments().get<i32>();
+        configuration.value_stack().append(Value(Operators::BitAnd {}(lhs, rhs)));
+        ip = ip.value() + 3;
+        return;
+    }
+    case Instructions::synthetic_local_get2.value(): {
+        auto& locals = configuration.frame().locals();
+        configuration.value_stack().append(locals[instruction.arguments().get<LocalIndex>().value()]);
+        configuration.value_stack().append(locals[(&instruction)[1].arguments().get<LocalIndex>().value()]);
+        ip = ip.value() + 2;
+        return;
+    }
+    case Instructions::synthetic_local_copy.value(): {
+        auto& locals = configuration.frame().locals();
+        locals[(&instruction)[1].arguments().get<LocalIndex>().value()] = locals[instruction.arguments().get<LocalIndex>().value()];
+        ip = ip.value() + 2;
+        return;
+    }
+    case Instructions::synthetic_local_seti32_const.value():
+        configuration.frame().locals()[(&instruction)[1].arguments().get<LocalIndex>().value()] = Value(instruction.arguments().get<i32>());
+        ip = ip.value() + 2;
+        return;
     case Instructions::local_set.value(): {
         auto value = configuration.value_stack().take_last();
         configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = value;
@@ -433,98 +501,37 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
     case Instructions::f64_const.value():
         configuration.value_stack().append(Value(instruction.arguments().get<double>()));
         return;
-    case Instructions::block.value(): {
-        size_t arity = 0;
-        size_t param_arity = 0;
-        auto& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
-        switch (args.block_type.kind()) {
-        case BlockType::Empty:
-            break;
-        case BlockType::Type:
-            arity = 1;
-            break;
-        case BlockType::Index: {
-            auto& type = configuration.frame().module().types()[args.block_type.type_index().value()];
-            arity = type.results().size();
-            param_arity = type.parameters().size();
-        }
-        }
-
-        configuration.label_stack().append(Label(arity, args.end_ip, configuration.value_stack().size() - param_arity));
-        return;
-    }
-    case Instructions::loop.value(): {
-        auto& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
-        size_t arity = 0;
-        if (args.block_type.kind() == BlockType::Index) {
-            auto& type = configuration.frame().module().types()[args.block_type.type_index().value()];
-            arity = type.parameters().size();
-        }
-        configuration.label_stack().append(Label(arity, ip.value() + 1, configuration.value_stack().size() - arity));
+    case Instructions::block.value():
+    case Instructions::loop.value():
+    case Instructions::structured_end.value():
+        // Branch targets and stack heights are resolved during validation, so there are no labels to keep track of.
         return;
-    }
     case Instructions::if_.value(): {
-        size_t arity = 0;
-        size_t param_arity = 0;
         auto& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
-        switch (args.block_type.kind()) {
-        case BlockType::Empty:
-            break;
-        case BlockType::Type:
-            arity = 1;
-            break;
-        case BlockType::Index: {
-            auto& type = configuration.frame().module().types()[args.block_type.type_index().value()];
-            arity = type.results().size();
-            param_arity = type.parameters().size();
-        }
-        }
-
         auto value = configuration.value_stack().take_last().to<i32>();
-        auto end_label = Label(arity, args.end_ip.value(), configuration.value_stack().size() - param_arity);
-        if (value == 0) {
-            if (args.else_ip.has_value()) {
-                configuration.ip() = args.else_ip.value();
-                configuration.label_stack().append(end_label);
-            } else {
-                configuration.ip() = args.end_ip.value() + 1;
-            }
-        } else {
-            configuration.label_stack().append(end_label);
-        }
+        if (value == 0)
+            configuration.ip() = args.else_ip.value_or(args.end_ip.value() + 1);
         return;
     }
-    case Instructions::structured_end.value():
-        configuration.label_stack().take_last();
+    case Instructions::structured_else.value():
+        // We only get here at the end of the "then" arm, so skip over the "else" arm.
+        configuration.ip() = instruction.arguments().get<Instruction::BranchTarget>().continuation;
         return;
-    case Instructions::structured_else.value(): {
-        auto label = configuration.label_stack().take_last();
-        // Jump to the end label
-        configuration.ip() = label.continuation();
-        return;
-    }
-    case Instructions::return_.value(): {
-        while (configuration.label_stack().size() - 1 != configuration.frame().label_index())
-            configuration.label_stack().take_last();
+    case Instructions::return_.value():
         configuration.ip() = configuration.frame().expression().instructions().size();
         return;
-    }
     case Instructions::br.value():
-        return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
+        return branch_to(configuration, instruction.arguments().get<Instruction::BranchArgs>().target);
     case Instructions::br_if.value(): {
         auto cond = configuration.value_stack().take_last().to<i32>();
         if (cond == 0)
             return;
-        return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
+        return branch_to(configuration, instruction.arguments().get<Instruction::BranchArgs>().target);
     }
     case Instructions::br_table.value(): {
         auto& arguments = instruction.arguments().get<Instruction::TableBranchArgs>();
         auto i = configuration.value_stack().take_last().to<u32>();
-
-        if (i >= arguments.labels.size()) {
-            return branch_to_label(configuration, arguments.default_);
-        }
-        return branch_to_label(configuration, arguments.labels[i]);
+        return branch_to(configuration, arguments.targets[min(i, arguments.labels.size())]);
     }
     case Instructions::call.value(): {
         auto index = instruction.arguments().get<FunctionIndex>();
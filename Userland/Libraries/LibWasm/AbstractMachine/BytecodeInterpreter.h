@@ -20,6 +20,9 @@ struct BytecodeInterpreter : public Interpreter {
 
     virtual void interpret(Configuration&) final;
 
+    // Rewrites a validated function body into a form that is faster to interpret.
+    static void compile(Expression&);
+
     virtual ~BytecodeInterpreter() override = default;
     virtual bool did_trap() const final { return !m_trap.has<Empty>(); }
     virtual ByteString trap_reason() const final
@@ -46,7 +49,7 @@ struct BytecodeInterpreter : public Interpreter {
 
 protected:
     void interpret_instruction(Configuration&, InstructionPointer&, Instruction const&);
-    void branch_to_label(Configuration&, LabelIndex);
+    void branch_to(Configuration&, Instruction::BranchTarget const&);
     template<typename ReadT, typename PushT>
     void load_and_push(Configuration&, Instruction const&);
     template<typename PopT, typename StoreT>
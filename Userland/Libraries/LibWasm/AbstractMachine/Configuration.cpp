@@ -57,7 +57,8 @@ Result Configuration::execute(Interpreter& interpreter)
     for (size_t i = 0; i < frame().arity(); ++i)
         results.unchecked_append(value_stack().take_last());
 
-    label_stack().take_last();
+    // An early return may leave values belonging to the callee behind.
+    value_stack().shrink(frame().value_stack_base(), true);
     return Result { move(results) };
 }
 
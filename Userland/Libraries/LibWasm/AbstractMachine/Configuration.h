@@ -19,10 +19,8 @@ public:
 
     void set_frame(Frame frame)
     {
-        Label label(frame.arity(), frame.expression().instructions().size(), m_value_stack.size());
-        frame.label_index() = m_label_stack.size();
+        frame.value_stack_base() = m_value_stack.size();
         m_frame_stack.append(move(frame));
-        m_label_stack.append(label);
     }
     ALWAYS_INLINE auto& frame() const { return m_frame_stack.last(); }
     ALWAYS_INLINE auto& frame() { return m_frame_stack.last(); }
@@ -32,8 +30,6 @@ public:
     ALWAYS_INLINE auto& depth() { return m_depth; }
     ALWAYS_INLINE auto& value_stack() const { return m_value_stack; }
     ALWAYS_INLINE auto& value_stack() { return m_value_stack; }
-    ALWAYS_INLINE auto& label_stack() const { return m_label_stack; }
-    ALWAYS_INLINE auto& label_stack() { return m_label_stack; }
     ALWAYS_INLINE auto& store() const { return m_store; }
     ALWAYS_INLINE auto& store() { return m_store; }
 
@@ -66,7 +62,6 @@ public:
 private:
     Store& m_store;
     Vector<Value> m_value_stack;
-    Vector<Label> m_label_stack;
     Vector<Frame> m_frame_stack;
     size_t m_depth { 0 };
     InstructionPointer m_ip;
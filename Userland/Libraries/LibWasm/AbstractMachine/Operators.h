@@ -160,6 +160,14 @@ struct BitRotateRight {
     static StringView name() { return "rotate_right"sv; }
 };
 
+// Picks lanes from `if_true` where `mask` (as produced by a vector comparison) is set, and from `if_false` elsewhere.
+template<typename VectorType, typename MaskType>
+ALWAYS_INLINE static VectorType vector_select(MaskType mask, VectorType if_true, VectorType if_false)
+{
+    static_assert(sizeof(VectorType) == sizeof(MaskType));
+    return bit_cast<VectorType>((bit_cast<MaskType>(if_true) & mask) | (bit_cast<MaskType>(if_false) & ~mask));
+}
+
 template<size_t VectorSize, template<typename> typename SetSign = MakeSigned>
 struct VectorAllTrue {
     auto operator()(u128 c) const
@@ -334,16 +342,12 @@ template<size_t VectorSize, typename Op, template<typename> typename SetSign = M
 struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
-        auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
+        // Vector comparisons already produce all-ones/all-zeroes lanes, which is exactly what Wasm wants.
+        using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        auto first = bit_cast<VectorType>(c1);
+        auto other = bit_cast<VectorType>(c2);
         Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            SetSign<ElementType> lhs = result[i];
-            SetSign<ElementType> rhs = other[i];
-            result[i] = op(lhs, rhs) ? static_cast<MakeUnsigned<ElementType>>(-1) : 0;
-        }
-        return bit_cast<u128>(result);
+        return bit_cast<u128>(op(first, other));
     }
 
     static StringView name()
@@ -369,12 +373,8 @@ struct VectorFloatCmpOp {
     {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
-        for (size_t i = 0; i < VectorSize; ++i)
-            result[i] = op(first[i], other[i]) ? static_cast<ElementType>(-1) : 0;
-        return bit_cast<u128>(result);
+        return bit_cast<u128>(op(first, other));
     }
 
     static StringView name()
@@ -690,17 +690,32 @@ struct VectorIntegerBinaryOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        // Wrapping arithmetic is done on unsigned lanes, as signed overflow isn't any better defined for vectors.
+        using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
-        }
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            Op op;
+            return bit_cast<u128>(op(bit_cast<UnsignedVectorType>(first), bit_cast<UnsignedVectorType>(second)));
+        } else if constexpr (IsSame<Op, Minimum>) {
+            return bit_cast<u128>(vector_select(first < second, first, second));
+        } else if constexpr (IsSame<Op, Maximum>) {
+            return bit_cast<u128>(vector_select(first > second, first, second));
+        } else if constexpr (IsSame<Op, Average> && IsUnsigned<SetSign<NativeIntegralType<128 / VectorSize>>>) {
+            // (a + b + 1) / 2 without widening the lanes.
+            return bit_cast<u128>((first | second) - ((first ^ second) >> 1));
+        } else {
+            VectorType result;
+            Op op;
 
-        return bit_cast<u128>(result);
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(first[i], second[i]);
+            }
+
+            return bit_cast<u128>(result);
+        }
     }
 
     static StringView name()
@@ -798,16 +813,26 @@ struct VectorIntegerUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
-        Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(value[i]);
-        }
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(-bit_cast<UnsignedVectorType>(value));
+        } else if constexpr (IsSame<Op, Absolute>) {
+            // Conditionally negate (flip and add one) the negative lanes; the minimum value stays as it is, as Wasm expects.
+            auto negative = bit_cast<UnsignedVectorType>(bit_cast<NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>>(value) < 0);
+            return bit_cast<u128>((bit_cast<UnsignedVectorType>(value) ^ negative) - negative);
+        } else {
+            VectorType result;
+            Op op;
 
-        return bit_cast<u128>(result);
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(value[i]);
+            }
+
+            return bit_cast<u128>(result);
+        }
     }
 
     static StringView name()
@@ -834,12 +859,25 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
+
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            Op op;
+            return bit_cast<u128>(op(first, second));
+        } else if constexpr (IsSame<Op, Divide>) {
+            return bit_cast<u128>(first / second);
+        } else if constexpr (IsSame<Op, PseudoMinimum>) {
+            return bit_cast<u128>(vector_select(second < first, second, first));
+        } else if constexpr (IsSame<Op, PseudoMaximum>) {
+            return bit_cast<u128>(vector_select(first < second, second, first));
+        } else {
+            // Minimum and Maximum have to propagate NaNs and order signed zeroes, which plain vector comparisons don't do.
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(first[i], second[i]);
+            }
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -861,12 +899,22 @@ struct VectorFloatUnaryOp {
     {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(value[i]);
+
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(-value);
+        } else if constexpr (IsSame<Op, Absolute>) {
+            // Just clear the sign bits; this is also what Wasm specifies for NaNs.
+            using ElementBits = NativeIntegralType<128 / VectorSize>;
+            using BitsVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(bit_cast<BitsVectorType>(value) & static_cast<ElementBits>(~(static_cast<ElementBits>(1) << (sizeof(ElementBits) * 8 - 1))));
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(value[i]);
+            }
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -4,11 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/HashTable.h>
 #include <AK/Result.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -240,30 +243,121 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
     return {};
 }
 
-ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
+// Store the targets computed by validate(Expression const&) in the instructions they belong to.
+static void apply_branch_targets(Expression& expression, Vector<Instruction::BranchTarget> const& targets)
 {
-    size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
-        auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
-        auto& function_type = m_context.functions[function_index];
-        auto& function = entry.func();
+    size_t next_target = 0;
+    for (auto& instruction : expression.instructions()) {
+        switch (instruction.opcode().value()) {
+        case Instructions::structured_else.value():
+            instruction.arguments() = targets[next_target++];
+            break;
+        case Instructions::br.value():
+        case Instructions::br_if.value():
+            instruction.arguments().get<Instruction::BranchArgs>().target = targets[next_target++];
+            break;
+        case Instructions::br_table.value(): {
+            auto& args = instruction.arguments().get<Instruction::TableBranchArgs>();
+            args.targets.clear_with_capacity();
+            args.targets.append(targets.data() + next_target, args.labels.size() + 1);
+            next_target += args.targets.size();
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    VERIFY(next_target == targets.size());
+}
+
+ErrorOr<void, ValidationError> Validator::validate(CodeSection& section)
+{
+    static constexpr size_t max_thread_count = 16;
+    // Most function bodies are small, so only spread them over threads when each thread gets a decent amount of work.
+    static constexpr size_t min_functions_per_thread = 64;
+
+    auto& functions = section.functions();
+    for (size_t i = 0; i < functions.size(); ++i)
+        TRY(validate(FunctionIndex { m_context.imported_function_count + i }));
 
+    auto thread_count = min(min(static_cast<size_t>(Core::System::hardware_concurrency()), functions.size() / min_functions_per_thread), max_thread_count);
+    if (thread_count <= 1) {
         auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
-        for (auto& local : function.locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
+        for (size_t i = 0; i < functions.size(); ++i)
+            TRY(function_validator.validate_function(functions[i], m_context.functions[m_context.imported_function_count + i]));
+        return {};
+    }
+
+    // Function bodies only read the module context, so they can be validated independently of each other.
+    // The context shares its storage through non-atomic reference counts though, so every thread gets its own
+    // validator, forked (and later destroyed) on this thread.
+    Vector<NonnullOwnPtr<Validator>> validators;
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto validator = adopt_own(*new Validator(m_context));
+        validator->m_context.locals = {};
+        validators.append(move(validator));
+    }
+
+    Vector<Optional<ValidationError>> errors;
+    errors.resize(functions.size());
+
+    // Functions are handed out in order, so once one fails, every function before it has already been picked up
+    // and we can stop early while still reporting the same error as a sequential pass would.
+    Atomic<size_t> next_function { 0 };
+    Atomic<bool> failed { false };
+    auto validate_functions = [&](Validator& validator) {
+        for (auto i = next_function++; i < functions.size() && !failed; i = next_function++) {
+            auto result = validator.validate_function(functions[i], validator.m_context.functions[validator.m_context.imported_function_count + i]);
+            if (result.is_error()) {
+                errors[i] = result.release_error();
+                failed = true;
+            }
         }
+    };
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct([&, &validator = *validators[i]]() -> intptr_t {
+            validate_functions(validator);
+            return 0;
+        },
+            "Wasm validator"sv);
+        thread->start();
+        threads.append(move(thread));
+    }
+
+    validate_functions(*validators[0]);
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    for (auto& error : errors) {
+        if (error.has_value())
+            return error.release_value();
+    }
+
+    return {};
+}
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+ErrorOr<void, ValidationError> Validator::validate_function(CodeSection::Code& code, FunctionType const& function_type)
+{
+    auto& function = code.func();
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+    m_context.locals.clear_with_capacity();
+    m_context.locals.extend(function_type.parameters());
+    for (auto& local : function.locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            m_context.locals.append(local.type());
     }
 
+    m_frames.clear_with_capacity();
+    m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+
+    auto results = TRY(validate(function.body(), function_type.results()));
+    if (results.result_types.size() != function_type.results().size())
+        return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+
+    apply_branch_targets(function.body(), results.branch_targets);
     return {};
 }
 
@@ -2002,7 +2096,7 @@ VALIDATE_INSTRUCTION(if_)
 
 VALIDATE_INSTRUCTION(br)
 {
-    auto label = instruction.arguments().get<LabelIndex>();
+    auto label = instruction.arguments().get<Instruction::BranchArgs>().label;
     TRY(validate(label));
 
     auto& type = m_frames[(m_frames.size() - 1) - label.value()].labels();
@@ -2016,7 +2110,7 @@ VALIDATE_INSTRUCTION(br)
 
 VALIDATE_INSTRUCTION(br_if)
 {
-    auto label = instruction.arguments().get<LabelIndex>();
+    auto label = instruction.arguments().get<Instruction::BranchArgs>().label;
     TRY(validate(label));
 
     TRY(stack.take<ValueType::I32>());
@@ -3704,14 +3798,59 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
 {
     if (m_frames.is_empty())
         m_frames.empend(FunctionType { {}, result_types }, FrameKind::Function, (size_t)0);
+    m_frames.last().continuation = expression.instructions().size();
     auto stack = Stack(m_frames);
     bool is_constant_expression = true;
+    Vector<Instruction::BranchTarget> branch_targets;
+
+    auto target_of = [&](LabelIndex label, size_t ip) {
+        auto& frame = m_frames[(m_frames.size() - 1) - label.value()];
+        auto continuation = frame.continuation;
+        // The interpreter can't tell a jump to the branch itself from no jump at all (this happens when the
+        // branch is the first instruction of a loop), so continue from the no-op loop instruction instead.
+        if (continuation == ip)
+            continuation = ip - 1;
+        return Instruction::BranchTarget {
+            continuation,
+            static_cast<u32>(frame.labels().size()),
+            static_cast<u32>(frame.initial_size),
+        };
+    };
 
-    for (auto& instruction : expression.instructions()) {
+    for (size_t ip = 0; ip < expression.instructions().size(); ++ip) {
+        auto& instruction = expression.instructions()[ip];
         bool is_constant = false;
         TRY(validate(instruction, stack, is_constant));
 
         is_constant_expression &= is_constant;
+
+        // Resolve where each branch lands now that we know the stack height at its target,
+        // so the interpreter can jump there directly.
+        switch (instruction.opcode().value()) {
+        case Instructions::block.value():
+        case Instructions::if_.value():
+            m_frames.last().continuation = instruction.arguments().get<Instruction::StructuredInstructionArgs>().end_ip;
+            break;
+        case Instructions::loop.value():
+            m_frames.last().continuation = ip + 1;
+            break;
+        case Instructions::structured_else.value():
+            branch_targets.append({ m_frames.last().continuation, 0, 0 });
+            break;
+        case Instructions::br.value():
+        case Instructions::br_if.value():
+            branch_targets.append(target_of(instruction.arguments().get<Instruction::BranchArgs>().label, ip));
+            break;
+        case Instructions::br_table.value(): {
+            auto& args = instruction.arguments().get<Instruction::TableBranchArgs>();
+            for (auto label : args.labels)
+                branch_targets.append(target_of(label, ip));
+            branch_targets.append(target_of(args.default_, ip));
+            break;
+        }
+        default:
+            break;
+        }
     }
 
     auto expected_result_types = result_types;
@@ -3723,7 +3862,7 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
     m_frames.take_last();
     VERIFY(m_frames.is_empty());
 
-    return ExpressionTypeResult { stack.release_vector(), is_constant_expression };
+    return ExpressionTypeResult { stack.release_vector(), is_constant_expression, move(branch_targets) };
 }
 
 ByteString Validator::Errors::find_instruction_name(SourceLocation const& location)
@@ -67,7 +67,7 @@ public:
     ErrorOr<void, ValidationError> validate(GlobalSection const&);
     ErrorOr<void, ValidationError> validate(MemorySection const&);
     ErrorOr<void, ValidationError> validate(TableSection const&);
-    ErrorOr<void, ValidationError> validate(CodeSection const&);
+    ErrorOr<void, ValidationError> validate(CodeSection&);
     ErrorOr<void, ValidationError> validate(FunctionSection const&) { return {}; }
     ErrorOr<void, ValidationError> validate(DataCountSection const&) { return {}; }
     ErrorOr<void, ValidationError> validate(TypeSection const&) { return {}; }
@@ -150,6 +150,8 @@ public:
         size_t initial_size;
         // Stack polymorphism is handled with this field
         bool unreachable { false };
+        // Where a branch to this frame's label continues
+        InstructionPointer continuation { 0 };
 
         Vector<ValueType> const& labels() const
         {
@@ -263,6 +265,8 @@ public:
     struct ExpressionTypeResult {
         Vector<StackEntry> result_types;
         bool is_constant { false };
+        // The targets of all branches (and `else`s) in the expression, in instruction order.
+        Vector<Instruction::BranchTarget> branch_targets;
     };
     ErrorOr<ExpressionTypeResult, ValidationError> validate(Expression const&, Vector<ValueType> const&);
     ErrorOr<void, ValidationError> validate(Instruction const& instruction, Stack& stack, bool& is_constant);
@@ -283,6 +287,8 @@ private:
     {
     }
 
+    ErrorOr<void, ValidationError> validate_function(CodeSection::Code&, FunctionType const&);
+
     struct Errors {
         static ValidationError invalid(StringView name) { return ByteString::formatted("Invalid {}", name); }
 
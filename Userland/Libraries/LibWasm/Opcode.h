@@ -460,8 +460,18 @@ namespace Instructions {
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
     ENUMERATE_MULTI_BYTE_WASM_OPCODES(M)
 
+// These are never parsed or validated; BytecodeInterpreter::compile() puts them in place of common instruction sequences.
+#define ENUMERATE_SYNTHETIC_WASM_OPCODES(M)               \
+    M(synthetic_i32_add2local, 0xfe00000000000000ull)     \
+    M(synthetic_i32_addconstlocal, 0xfe00000000000001ull) \
+    M(synthetic_i32_andconstlocal, 0xfe00000000000002ull) \
+    M(synthetic_local_get2, 0xfe00000000000003ull)        \
+    M(synthetic_local_copy, 0xfe00000000000004ull)        \
+    M(synthetic_local_seti32_const, 0xfe00000000000005ull)
+
 #define M(name, value) static constexpr OpCode name = value;
 ENUMERATE_WASM_OPCODES(M)
+ENUMERATE_SYNTHETIC_WASM_OPCODES(M)
 #undef M
 
 }
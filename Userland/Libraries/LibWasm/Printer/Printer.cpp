@@ -440,11 +440,12 @@ void Printer::print(Wasm::Instruction const& instruction)
         print(" ");
         instruction.arguments().visit(
             [&](BlockType const& type) { print(type); },
+            [&](Instruction::BranchArgs const& args) { print("(label index {})", args.label.value()); },
+            [&](Instruction::BranchTarget const& target) { print("(continuation {})", target.continuation.value()); },
             [&](DataIndex const& index) { print("(data index {})", index.value()); },
             [&](ElementIndex const& index) { print("(element index {})", index.value()); },
             [&](FunctionIndex const& index) { print("(function index {})", index.value()); },
             [&](GlobalIndex const& index) { print("(global index {})", index.value()); },
-            [&](LabelIndex const& index) { print("(label index {})", index.value()); },
             [&](LocalIndex const& index) { print("(local index {})", index.value()); },
             [&](TableIndex const& index) { print("(table index {})", index.value()); },
             [&](Instruction::IndirectCallArgs const& args) { print("(indirect (type index {}) (table index {}))", args.type.value(), args.table.value()); },
@@ -1140,5 +1141,11 @@ HashMap<Wasm::OpCode, ByteString> Wasm::Names::instruction_names {
     { Instructions::f64x2_convert_low_i32x4_u, "f64x2.convert_low_i32x4_u" },
     { Instructions::structured_else, "synthetic:else" },
     { Instructions::structured_end, "synthetic:end" },
+    { Instructions::synthetic_i32_add2local, "synthetic:i32.add2local" },
+    { Instructions::synthetic_i32_addconstlocal, "synthetic:i32.addconstlocal" },
+    { Instructions::synthetic_i32_andconstlocal, "synthetic:i32.andconstlocal" },
+    { Instructions::synthetic_local_get2, "synthetic:local.get2" },
+    { Instructions::synthetic_local_copy, "synthetic:local.copy" },
+    { Instructions::synthetic_local_seti32_const, "synthetic:local.set.i32.const" },
 };
 HashMap<ByteString, Wasm::OpCode> Wasm::Names::instructions_by_name;
@@ -402,9 +402,24 @@ public:
         Optional<InstructionPointer> else_ip;
     };
 
+    // Where a branch lands, resolved by the validator so that the interpreter doesn't need to keep track of labels.
+    // The stack height is relative to the value stack height on entry to the function.
+    struct BranchTarget {
+        InstructionPointer continuation { 0 };
+        u32 arity { 0 };
+        u32 stack_height { 0 };
+    };
+
+    struct BranchArgs {
+        LabelIndex label;
+        BranchTarget target {};
+    };
+
     struct TableBranchArgs {
         Vector<LabelIndex> labels;
         LabelIndex default_;
+        // One for each label, followed by the one for the default label.
+        Vector<BranchTarget> targets {};
     };
 
     struct IndirectCallArgs {
@@ -471,12 +486,13 @@ private:
     OpCode m_opcode { 0 };
     Variant<
         BlockType,
+        BranchArgs,
+        BranchTarget,
         DataIndex,
         ElementIndex,
         FunctionIndex,
         GlobalIndex,
         IndirectCallArgs,
-        LabelIndex,
         LaneIndex,
         LocalIndex,
         MemoryArgument,
@@ -705,6 +721,7 @@ public:
     }
 
     auto& instructions() const { return m_instructions; }
+    auto& instructions() { return m_instructions; }
 
     static ParseResult<Expression> parse(Stream& stream, Optional<size_t> size_hint = {});
 
@@ -884,6 +901,7 @@ public:
 
         auto& locals() const { return m_locals; }
         auto& body() const { return m_body; }
+        auto& body() { return m_body; }
 
         static ParseResult<Func> parse(Stream& stream, size_t size_hint);
 
@@ -901,6 +919,7 @@ public:
 
         auto size() const { return m_size; }
         auto& func() const { return m_func; }
+        auto& func() { return m_func; }
 
         static ParseResult<Code> parse(Stream& stream);
 
@@ -917,6 +936,7 @@ public:
     }
 
     auto& functions() const { return m_functions; }
+    auto& functions() { return m_functions; }
 
     static ParseResult<CodeSection> parse(Stream& stream);
 
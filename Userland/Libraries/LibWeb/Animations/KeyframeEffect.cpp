@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/GenericShorthands.h>
 #include <AK/QuickSort.h>
 #include <LibJS/Runtime/Iterator.h>
 #include <LibWeb/Animations/Animation.h>
@@ -948,6 +949,25 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(H
     return invalidation;
 }
 
+// These properties don't affect layout, aren't inherited and can be applied to the layout node on their own.
+static bool is_paint_only_animated_property(CSS::PropertyID property_id)
+{
+    return first_is_one_of(property_id, CSS::PropertyID::Opacity, CSS::PropertyID::Transform, CSS::PropertyID::TransformOrigin);
+}
+
+static bool animates_only_paint_only_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& new_properties)
+{
+    for (auto const& [property_id, _] : old_properties) {
+        if (!is_paint_only_animated_property(property_id))
+            return false;
+    }
+    for (auto const& [property_id, _] : new_properties) {
+        if (!is_paint_only_animated_property(property_id))
+            return false;
+    }
+    return true;
+}
+
 void KeyframeEffect::update_style_properties()
 {
     auto target = this->target();
@@ -968,6 +988,20 @@ void KeyframeEffect::update_style_properties()
     auto& document = target->document();
     document.style_computer().collect_animation_into(*target, pseudo_element_type(), *this, *style, CSS::StyleComputer::AnimationRefresh::Yes);
 
+    auto invalidation = compute_required_invalidation(animated_properties_before_update, style->animated_property_values());
+
+    // OPTIMIZATION: Opacity and transform animations only need the new values on the target's layout node and a
+    //               repaint. There's no need to walk the subtree for inherited values or to re-apply the whole style.
+    if (!pseudo_element_type().has_value() && target->layout_node() && !invalidation.relayout && !invalidation.rebuild_layout_tree
+        && animates_only_paint_only_properties(animated_properties_before_update, style->animated_property_values())) {
+        target->layout_node()->apply_paint_only_animated_style(*style);
+        if (invalidation.repaint)
+            document.set_needs_to_resolve_paint_only_properties();
+        if (invalidation.rebuild_stacking_context_tree)
+            document.invalidate_stacking_context_tree();
+        return;
+    }
+
     // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
     target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
         auto* element_style = element.computed_css_values();
@@ -985,8 +1019,6 @@ void KeyframeEffect::update_style_properties()
         return TraversalDecision::Continue;
     });
 
-    auto invalidation = compute_required_invalidation(animated_properties_before_update, style->animated_property_values());
-
     if (!pseudo_element_type().has_value()) {
         if (target->layout_node())
             target->layout_node()->apply_style(*style);
@@ -43,6 +43,7 @@
 #include <LibWeb/Namespace.h>
 #include <LibWeb/NavigationTiming/EntryNames.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
+#include <LibWeb/PerformanceTimeline/PerformanceGarbageCollectionTiming.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/SVG/AttributeNames.h>
 #include <LibWeb/SVG/TagNames.h>
@@ -92,6 +93,16 @@ ErrorOr<void> initialize_main_thread_vm(HTML::EventLoop::Type type)
     auto& custom_data = verify_cast<WebEngineCustomData>(*s_main_thread_vm->custom_data());
     custom_data.event_loop = s_main_thread_vm->heap().allocate_without_realm<HTML::EventLoop>(type);
 
+    // https://html.spec.whatwg.org/multipage/webappapis.html#obtain-similar-origin-window-agent
+    // https://html.spec.whatwg.org/multipage/webappapis.html#obtain-a-dedicated/shared-worker-agent
+    // https://html.spec.whatwg.org/multipage/webappapis.html#obtain-a-worklet-agent
+    // NOTE: Only worker agents are created with [[CanBlock]] set to true, so Atomics.wait() is only allowed in workers.
+    s_main_thread_vm->set_agent_can_block(type == HTML::EventLoop::Type::Worker);
+
+    s_main_thread_vm->heap().on_garbage_collection = [](JS::Heap::GarbageCollectionEvent const& event) {
+        PerformanceTimeline::did_collect_garbage(event);
+    };
+
     // These strings could potentially live on the VM similar to CommonPropertyNames.
     DOM::MutationType::initialize_strings();
     HTML::AttributeNames::initialize_strings();
@@ -108,7 +108,7 @@ void CSSStyleRule::set_selector_text(StringView selector_text)
         m_selectors = parsed_selectors.release_value();
         if (auto* sheet = parent_style_sheet()) {
             if (auto style_sheet_list = sheet->style_sheet_list()) {
-                style_sheet_list->document().style_computer().invalidate_rule_cache();
+                style_sheet_list->document().style_computer().invalidate_author_rule_cache();
                 style_sheet_list->document_or_shadow_root().invalidate_style(DOM::StyleInvalidationReason::SetSelectorText);
             }
         }
@@ -157,7 +157,7 @@ WebIDL::ExceptionOr<unsigned> CSSStyleSheet::insert_rule(StringView rule, unsign
         parsed_rule->set_parent_style_sheet(this);
 
         if (m_style_sheet_list) {
-            m_style_sheet_list->document().style_computer().invalidate_rule_cache();
+            m_style_sheet_list->document().style_computer().did_insert_rule(*this, *parsed_rule, result.value());
             m_style_sheet_list->document_or_shadow_root().invalidate_style(DOM::StyleInvalidationReason::StyleSheetInsertRule);
         }
     }
@@ -175,10 +175,11 @@ WebIDL::ExceptionOr<void> CSSStyleSheet::delete_rule(unsigned index)
         return WebIDL::NotAllowedError::create(realm(), "Can't call delete_rule() on non-modifiable stylesheets."_fly_string);
 
     // 3. Remove a CSS rule in the CSS rules at index.
+    JS::GCPtr<CSSRule const> removed_rule = m_rules->item(index);
     auto result = m_rules->remove_a_css_rule(index);
     if (!result.is_exception()) {
         if (m_style_sheet_list) {
-            m_style_sheet_list->document().style_computer().invalidate_rule_cache();
+            m_style_sheet_list->document().style_computer().did_delete_rule(*this, *removed_rule);
             m_style_sheet_list->document_or_shadow_root().invalidate_style(DOM::StyleInvalidationReason::StyleSheetDeleteRule);
         }
     }
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/CopyOnWrite.h>
 #include <AK/FlyString.h>
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
+#include <AK/RefCounted.h>
 #include <LibGfx/FontCascadeList.h>
 #include <LibGfx/ScalingMode.h>
 #include <LibWeb/CSS/BackdropFilter.h>
@@ -53,6 +55,8 @@ struct QuotesData {
         Specified,
     } type;
     Vector<Array<FlyString, 2>> strings {};
+
+    bool operator==(QuotesData const&) const = default;
 };
 
 struct ResolvedBackdropFilter {
@@ -224,6 +228,8 @@ public:
     Color as_color() const { return m_value.get<Color>(); }
     URL::URL const& as_url() const { return m_value.get<URL::URL>(); }
 
+    bool operator==(SVGPaint const&) const = default;
+
 private:
     Variant<URL::URL, Color> m_value;
 };
@@ -285,6 +291,8 @@ struct BackgroundLayerData {
     CSS::LengthPercentage size_y { CSS::Length::make_auto() };
     CSS::Repeat repeat_x { CSS::Repeat::Repeat };
     CSS::Repeat repeat_y { CSS::Repeat::Repeat };
+
+    bool operator==(BackgroundLayerData const&) const = default;
 };
 
 struct BorderData {
@@ -351,6 +359,12 @@ inline Gfx::ScalingMode to_gfx_scaling_mode(CSS::ImageRendering css_value, Gfx::
     VERIFY_NOT_REACHED();
 }
 
+// NOTE: Values of these types are compared before being stored in a shared group of computed values, so that storing
+//       a value that's already there doesn't create a copy of the group.
+template<typename T>
+concept ComparableComputedValue = IsEnum<T> || IsArithmetic<T>
+    || IsOneOf<T, Color, CSSPixels, Length, LengthPercentage, Size, LengthBox, Display, Time, BorderData, QuotesData, Optional<int>, Optional<Color>, Optional<SVGPaint>, Variant<LengthOrCalculated, NumberOrCalculated>, Vector<BackgroundLayerData>>;
+
 class ComputedValues {
     AK_MAKE_NONCOPYABLE(ComputedValues);
     AK_MAKE_NONMOVABLE(ComputedValues);
@@ -359,155 +373,155 @@ public:
     ComputedValues() = default;
     ~ComputedValues() = default;
 
-    AspectRatio aspect_ratio() const { return m_noninherited.aspect_ratio; }
-    CSS::Float float_() const { return m_noninherited.float_; }
-    CSS::Length border_spacing_horizontal() const { return m_inherited.border_spacing_horizontal; }
-    CSS::Length border_spacing_vertical() const { return m_inherited.border_spacing_vertical; }
-    CSS::CaptionSide caption_side() const { return m_inherited.caption_side; }
-    CSS::Clear clear() const { return m_noninherited.clear; }
-    CSS::Clip clip() const { return m_noninherited.clip; }
-    CSS::ContentVisibility content_visibility() const { return m_inherited.content_visibility; }
-    CSS::Cursor cursor() const { return m_inherited.cursor; }
-    CSS::ContentData content() const { return m_noninherited.content; }
-    CSS::PointerEvents pointer_events() const { return m_inherited.pointer_events; }
-    CSS::Display display() const { return m_noninherited.display; }
-    Optional<int> const& z_index() const { return m_noninherited.z_index; }
-    Variant<LengthOrCalculated, NumberOrCalculated> tab_size() const { return m_inherited.tab_size; }
-    CSS::TextAlign text_align() const { return m_inherited.text_align; }
-    CSS::TextJustify text_justify() const { return m_inherited.text_justify; }
-    CSS::LengthPercentage const& text_indent() const { return m_inherited.text_indent; }
-    Vector<CSS::TextDecorationLine> const& text_decoration_line() const { return m_noninherited.text_decoration_line; }
-    CSS::LengthPercentage const& text_decoration_thickness() const { return m_noninherited.text_decoration_thickness; }
-    CSS::TextDecorationStyle text_decoration_style() const { return m_noninherited.text_decoration_style; }
-    Color text_decoration_color() const { return m_noninherited.text_decoration_color; }
-    CSS::TextTransform text_transform() const { return m_inherited.text_transform; }
-    CSS::TextOverflow text_overflow() const { return m_noninherited.text_overflow; }
-    Vector<ShadowData> const& text_shadow() const { return m_inherited.text_shadow; }
-    CSS::Positioning position() const { return m_noninherited.position; }
-    CSS::WhiteSpace white_space() const { return m_inherited.white_space; }
-    CSS::FlexDirection flex_direction() const { return m_noninherited.flex_direction; }
-    CSS::FlexWrap flex_wrap() const { return m_noninherited.flex_wrap; }
-    FlexBasis const& flex_basis() const { return m_noninherited.flex_basis; }
-    float flex_grow() const { return m_noninherited.flex_grow; }
-    float flex_shrink() const { return m_noninherited.flex_shrink; }
-    int order() const { return m_noninherited.order; }
-    Optional<Color> accent_color() const { return m_inherited.accent_color; }
-    CSS::AlignContent align_content() const { return m_noninherited.align_content; }
-    CSS::AlignItems align_items() const { return m_noninherited.align_items; }
-    CSS::AlignSelf align_self() const { return m_noninherited.align_self; }
-    CSS::Appearance appearance() const { return m_noninherited.appearance; }
-    float opacity() const { return m_noninherited.opacity; }
-    CSS::Visibility visibility() const { return m_inherited.visibility; }
-    CSS::ImageRendering image_rendering() const { return m_inherited.image_rendering; }
-    CSS::JustifyContent justify_content() const { return m_noninherited.justify_content; }
-    CSS::JustifySelf justify_self() const { return m_noninherited.justify_self; }
-    CSS::JustifyItems justify_items() const { return m_noninherited.justify_items; }
-    CSS::ResolvedBackdropFilter const& backdrop_filter() const { return m_noninherited.backdrop_filter; }
-    Vector<ShadowData> const& box_shadow() const { return m_noninherited.box_shadow; }
-    CSS::BoxSizing box_sizing() const { return m_noninherited.box_sizing; }
-    CSS::Size const& width() const { return m_noninherited.width; }
-    CSS::Size const& min_width() const { return m_noninherited.min_width; }
-    CSS::Size const& max_width() const { return m_noninherited.max_width; }
-    CSS::Size const& height() const { return m_noninherited.height; }
-    CSS::Size const& min_height() const { return m_noninherited.min_height; }
-    CSS::Size const& max_height() const { return m_noninherited.max_height; }
-    Variant<CSS::VerticalAlign, CSS::LengthPercentage> const& vertical_align() const { return m_noninherited.vertical_align; }
-    CSS::GridTrackSizeList const& grid_auto_columns() const { return m_noninherited.grid_auto_columns; }
-    CSS::GridTrackSizeList const& grid_auto_rows() const { return m_noninherited.grid_auto_rows; }
-    CSS::GridAutoFlow const& grid_auto_flow() const { return m_noninherited.grid_auto_flow; }
-    CSS::GridTrackSizeList const& grid_template_columns() const { return m_noninherited.grid_template_columns; }
-    CSS::GridTrackSizeList const& grid_template_rows() const { return m_noninherited.grid_template_rows; }
-    CSS::GridTrackPlacement const& grid_column_end() const { return m_noninherited.grid_column_end; }
-    CSS::GridTrackPlacement const& grid_column_start() const { return m_noninherited.grid_column_start; }
-    CSS::GridTrackPlacement const& grid_row_end() const { return m_noninherited.grid_row_end; }
-    CSS::GridTrackPlacement const& grid_row_start() const { return m_noninherited.grid_row_start; }
-    CSS::ColumnCount column_count() const { return m_noninherited.column_count; }
-    CSS::Size const& column_gap() const { return m_noninherited.column_gap; }
-    CSS::ColumnSpan const& column_span() const { return m_noninherited.column_span; }
-    CSS::Size const& column_width() const { return m_noninherited.column_width; }
-    CSS::Size const& row_gap() const { return m_noninherited.row_gap; }
-    CSS::BorderCollapse border_collapse() const { return m_inherited.border_collapse; }
-    Vector<Vector<String>> const& grid_template_areas() const { return m_noninherited.grid_template_areas; }
-    CSS::ObjectFit object_fit() const { return m_noninherited.object_fit; }
-    CSS::ObjectPosition object_position() const { return m_noninherited.object_position; }
-    CSS::Direction direction() const { return m_inherited.direction; }
-
-    CSS::LengthBox const& inset() const { return m_noninherited.inset; }
-    const CSS::LengthBox& margin() const { return m_noninherited.margin; }
-    const CSS::LengthBox& padding() const { return m_noninherited.padding; }
-
-    BorderData const& border_left() const { return m_noninherited.border_left; }
-    BorderData const& border_top() const { return m_noninherited.border_top; }
-    BorderData const& border_right() const { return m_noninherited.border_right; }
-    BorderData const& border_bottom() const { return m_noninherited.border_bottom; }
-
-    const CSS::BorderRadiusData& border_bottom_left_radius() const { return m_noninherited.border_bottom_left_radius; }
-    const CSS::BorderRadiusData& border_bottom_right_radius() const { return m_noninherited.border_bottom_right_radius; }
-    const CSS::BorderRadiusData& border_top_left_radius() const { return m_noninherited.border_top_left_radius; }
-    const CSS::BorderRadiusData& border_top_right_radius() const { return m_noninherited.border_top_right_radius; }
-
-    CSS::Overflow overflow_x() const { return m_noninherited.overflow_x; }
-    CSS::Overflow overflow_y() const { return m_noninherited.overflow_y; }
-
-    Color color() const { return m_inherited.color; }
-    Color background_color() const { return m_noninherited.background_color; }
-    Vector<BackgroundLayerData> const& background_layers() const { return m_noninherited.background_layers; }
-
-    Color webkit_text_fill_color() const { return m_inherited.webkit_text_fill_color; }
-
-    CSS::ListStyleType list_style_type() const { return m_inherited.list_style_type; }
-    CSS::ListStylePosition list_style_position() const { return m_inherited.list_style_position; }
-
-    Optional<SVGPaint> const& fill() const { return m_inherited.fill; }
-    CSS::FillRule fill_rule() const { return m_inherited.fill_rule; }
-    Optional<SVGPaint> const& stroke() const { return m_inherited.stroke; }
-    float fill_opacity() const { return m_inherited.fill_opacity; }
-    float stroke_opacity() const { return m_inherited.stroke_opacity; }
-    LengthPercentage const& stroke_width() const { return m_inherited.stroke_width; }
-    Color stop_color() const { return m_noninherited.stop_color; }
-    float stop_opacity() const { return m_noninherited.stop_opacity; }
-    CSS::TextAnchor text_anchor() const { return m_inherited.text_anchor; }
-    Optional<MaskReference> const& mask() const { return m_noninherited.mask; }
-    CSS::MaskType mask_type() const { return m_noninherited.mask_type; }
-    Optional<ClipPathReference> const& clip_path() const { return m_noninherited.clip_path; }
-    CSS::ClipRule clip_rule() const { return m_inherited.clip_rule; }
-
-    LengthPercentage const& cx() const { return m_noninherited.cx; }
-    LengthPercentage const& cy() const { return m_noninherited.cy; }
-    LengthPercentage const& r() const { return m_noninherited.r; }
-    LengthPercentage const& rx() const { return m_noninherited.ry; }
-    LengthPercentage const& ry() const { return m_noninherited.ry; }
-    LengthPercentage const& x() const { return m_noninherited.x; }
-    LengthPercentage const& y() const { return m_noninherited.y; }
-
-    Vector<CSS::Transformation> const& transformations() const { return m_noninherited.transformations; }
-    CSS::TransformBox const& transform_box() const { return m_noninherited.transform_box; }
-    CSS::TransformOrigin const& transform_origin() const { return m_noninherited.transform_origin; }
-
-    Gfx::FontCascadeList const& font_list() const { return *m_inherited.font_list; }
-    CSSPixels font_size() const { return m_inherited.font_size; }
-    int font_weight() const { return m_inherited.font_weight; }
-    CSS::FontVariant font_variant() const { return m_inherited.font_variant; }
-    Optional<FlyString> font_language_override() const { return m_inherited.font_language_override; }
-    Optional<HashMap<FlyString, IntegerOrCalculated>> font_feature_settings() const { return m_inherited.font_feature_settings; }
-    Optional<HashMap<FlyString, NumberOrCalculated>> font_variation_settings() const { return m_inherited.font_variation_settings; }
-    CSSPixels line_height() const { return m_inherited.line_height; }
-    CSS::Time transition_delay() const { return m_noninherited.transition_delay; }
-
-    Color outline_color() const { return m_noninherited.outline_color; }
-    CSS::Length outline_offset() const { return m_noninherited.outline_offset; }
-    CSS::OutlineStyle outline_style() const { return m_noninherited.outline_style; }
-    CSS::Length outline_width() const { return m_noninherited.outline_width; }
-
-    CSS::TableLayout table_layout() const { return m_noninherited.table_layout; }
-
-    CSS::QuotesData quotes() const { return m_inherited.quotes; }
-
-    CSS::MathShift math_shift() const { return m_inherited.math_shift; }
-    CSS::MathStyle math_style() const { return m_inherited.math_style; }
-    int math_depth() const { return m_inherited.math_depth; }
-
-    CSS::ScrollbarWidth scrollbar_width() const { return m_noninherited.scrollbar_width; }
+    AspectRatio aspect_ratio() const { return m_box->aspect_ratio; }
+    CSS::Float float_() const { return m_box->float_; }
+    CSS::Length border_spacing_horizontal() const { return m_inherited->border_spacing_horizontal; }
+    CSS::Length border_spacing_vertical() const { return m_inherited->border_spacing_vertical; }
+    CSS::CaptionSide caption_side() const { return m_inherited->caption_side; }
+    CSS::Clear clear() const { return m_box->clear; }
+    CSS::Clip clip() const { return m_rare_noninherited->clip; }
+    CSS::ContentVisibility content_visibility() const { return m_inherited->content_visibility; }
+    CSS::Cursor cursor() const { return m_inherited->cursor; }
+    CSS::ContentData content() const { return m_rare_noninherited->content; }
+    CSS::PointerEvents pointer_events() const { return m_inherited->pointer_events; }
+    CSS::Display display() const { return m_box->display; }
+    Optional<int> const& z_index() const { return m_box->z_index; }
+    Variant<LengthOrCalculated, NumberOrCalculated> tab_size() const { return m_inherited->tab_size; }
+    CSS::TextAlign text_align() const { return m_inherited->text_align; }
+    CSS::TextJustify text_justify() const { return m_inherited->text_justify; }
+    CSS::LengthPercentage const& text_indent() const { return m_inherited->text_indent; }
+    Vector<CSS::TextDecorationLine> const& text_decoration_line() const { return m_rare_noninherited->text_decoration_line; }
+    CSS::LengthPercentage const& text_decoration_thickness() const { return m_rare_noninherited->text_decoration_thickness; }
+    CSS::TextDecorationStyle text_decoration_style() const { return m_rare_noninherited->text_decoration_style; }
+    Color text_decoration_color() const { return m_rare_noninherited->text_decoration_color; }
+    CSS::TextTransform text_transform() const { return m_inherited->text_transform; }
+    CSS::TextOverflow text_overflow() const { return m_rare_noninherited->text_overflow; }
+    Vector<ShadowData> const& text_shadow() const { return m_inherited->text_shadow; }
+    CSS::Positioning position() const { return m_box->position; }
+    CSS::WhiteSpace white_space() const { return m_inherited->white_space; }
+    CSS::FlexDirection flex_direction() const { return m_box->flex_direction; }
+    CSS::FlexWrap flex_wrap() const { return m_box->flex_wrap; }
+    FlexBasis const& flex_basis() const { return m_box->flex_basis; }
+    float flex_grow() const { return m_box->flex_grow; }
+    float flex_shrink() const { return m_box->flex_shrink; }
+    int order() const { return m_box->order; }
+    Optional<Color> accent_color() const { return m_inherited->accent_color; }
+    CSS::AlignContent align_content() const { return m_box->align_content; }
+    CSS::AlignItems align_items() const { return m_box->align_items; }
+    CSS::AlignSelf align_self() const { return m_box->align_self; }
+    CSS::Appearance appearance() const { return m_rare_noninherited->appearance; }
+    float opacity() const { return m_rare_noninherited->opacity; }
+    CSS::Visibility visibility() const { return m_inherited->visibility; }
+    CSS::ImageRendering image_rendering() const { return m_inherited->image_rendering; }
+    CSS::JustifyContent justify_content() const { return m_box->justify_content; }
+    CSS::JustifySelf justify_self() const { return m_box->justify_self; }
+    CSS::JustifyItems justify_items() const { return m_box->justify_items; }
+    CSS::ResolvedBackdropFilter const& backdrop_filter() const { return m_rare_noninherited->backdrop_filter; }
+    Vector<ShadowData> const& box_shadow() const { return m_background->box_shadow; }
+    CSS::BoxSizing box_sizing() const { return m_box->box_sizing; }
+    CSS::Size const& width() const { return m_box->width; }
+    CSS::Size const& min_width() const { return m_box->min_width; }
+    CSS::Size const& max_width() const { return m_box->max_width; }
+    CSS::Size const& height() const { return m_box->height; }
+    CSS::Size const& min_height() const { return m_box->min_height; }
+    CSS::Size const& max_height() const { return m_box->max_height; }
+    Variant<CSS::VerticalAlign, CSS::LengthPercentage> const& vertical_align() const { return m_box->vertical_align; }
+    CSS::GridTrackSizeList const& grid_auto_columns() const { return m_box->grid_auto_columns; }
+    CSS::GridTrackSizeList const& grid_auto_rows() const { return m_box->grid_auto_rows; }
+    CSS::GridAutoFlow const& grid_auto_flow() const { return m_box->grid_auto_flow; }
+    CSS::GridTrackSizeList const& grid_template_columns() const { return m_box->grid_template_columns; }
+    CSS::GridTrackSizeList const& grid_template_rows() const { return m_box->grid_template_rows; }
+    CSS::GridTrackPlacement const& grid_column_end() const { return m_box->grid_column_end; }
+    CSS::GridTrackPlacement const& grid_column_start() const { return m_box->grid_column_start; }
+    CSS::GridTrackPlacement const& grid_row_end() const { return m_box->grid_row_end; }
+    CSS::GridTrackPlacement const& grid_row_start() const { return m_box->grid_row_start; }
+    CSS::ColumnCount column_count() const { return m_box->column_count; }
+    CSS::Size const& column_gap() const { return m_box->column_gap; }
+    CSS::ColumnSpan const& column_span() const { return m_box->column_span; }
+    CSS::Size const& column_width() const { return m_box->column_width; }
+    CSS::Size const& row_gap() const { return m_box->row_gap; }
+    CSS::BorderCollapse border_collapse() const { return m_inherited->border_collapse; }
+    Vector<Vector<String>> const& grid_template_areas() const { return m_box->grid_template_areas; }
+    CSS::ObjectFit object_fit() const { return m_rare_noninherited->object_fit; }
+    CSS::ObjectPosition object_position() const { return m_rare_noninherited->object_position; }
+    CSS::Direction direction() const { return m_inherited->direction; }
+
+    CSS::LengthBox const& inset() const { return m_box->inset; }
+    const CSS::LengthBox& margin() const { return m_box->margin; }
+    const CSS::LengthBox& padding() const { return m_box->padding; }
+
+    BorderData const& border_left() const { return m_border->border_left; }
+    BorderData const& border_top() const { return m_border->border_top; }
+    BorderData const& border_right() const { return m_border->border_right; }
+    BorderData const& border_bottom() const { return m_border->border_bottom; }
+
+    const CSS::BorderRadiusData& border_bottom_left_radius() const { return m_border->border_bottom_left_radius; }
+    const CSS::BorderRadiusData& border_bottom_right_radius() const { return m_border->border_bottom_right_radius; }
+    const CSS::BorderRadiusData& border_top_left_radius() const { return m_border->border_top_left_radius; }
+    const CSS::BorderRadiusData& border_top_right_radius() const { return m_border->border_top_right_radius; }
+
+    CSS::Overflow overflow_x() const { return m_box->overflow_x; }
+    CSS::Overflow overflow_y() const { return m_box->overflow_y; }
+
+    Color color() const { return m_inherited->color; }
+    Color background_color() const { return m_background->background_color; }
+    Vector<BackgroundLayerData> const& background_layers() const { return m_background->background_layers; }
+
+    Color webkit_text_fill_color() const { return m_inherited->webkit_text_fill_color; }
+
+    CSS::ListStyleType list_style_type() const { return m_inherited->list_style_type; }
+    CSS::ListStylePosition list_style_position() const { return m_inherited->list_style_position; }
+
+    Optional<SVGPaint> const& fill() const { return m_inherited->fill; }
+    CSS::FillRule fill_rule() const { return m_inherited->fill_rule; }
+    Optional<SVGPaint> const& stroke() const { return m_inherited->stroke; }
+    float fill_opacity() const { return m_inherited->fill_opacity; }
+    float stroke_opacity() const { return m_inherited->stroke_opacity; }
+    LengthPercentage const& stroke_width() const { return m_inherited->stroke_width; }
+    Color stop_color() const { return m_rare_noninherited->stop_color; }
+    float stop_opacity() const { return m_rare_noninherited->stop_opacity; }
+    CSS::TextAnchor text_anchor() const { return m_inherited->text_anchor; }
+    Optional<MaskReference> const& mask() const { return m_rare_noninherited->mask; }
+    CSS::MaskType mask_type() const { return m_rare_noninherited->mask_type; }
+    Optional<ClipPathReference> const& clip_path() const { return m_rare_noninherited->clip_path; }
+    CSS::ClipRule clip_rule() const { return m_inherited->clip_rule; }
+
+    LengthPercentage const& cx() const { return m_rare_noninherited->cx; }
+    LengthPercentage const& cy() const { return m_rare_noninherited->cy; }
+    LengthPercentage const& r() const { return m_rare_noninherited->r; }
+    LengthPercentage const& rx() const { return m_rare_noninherited->ry; }
+    LengthPercentage const& ry() const { return m_rare_noninherited->ry; }
+    LengthPercentage const& x() const { return m_rare_noninherited->x; }
+    LengthPercentage const& y() const { return m_rare_noninherited->y; }
+
+    Vector<CSS::Transformation> const& transformations() const { return m_rare_noninherited->transformations; }
+    CSS::TransformBox const& transform_box() const { return m_rare_noninherited->transform_box; }
+    CSS::TransformOrigin const& transform_origin() const { return m_rare_noninherited->transform_origin; }
+
+    Gfx::FontCascadeList const& font_list() const { return *m_inherited->font_list; }
+    CSSPixels font_size() const { return m_inherited->font_size; }
+    int font_weight() const { return m_inherited->font_weight; }
+    CSS::FontVariant font_variant() const { return m_inherited->font_variant; }
+    Optional<FlyString> font_language_override() const { return m_inherited->font_language_override; }
+    Optional<HashMap<FlyString, IntegerOrCalculated>> font_feature_settings() const { return m_inherited->font_feature_settings; }
+    Optional<HashMap<FlyString, NumberOrCalculated>> font_variation_settings() const { return m_inherited->font_variation_settings; }
+    CSSPixels line_height() const { return m_inherited->line_height; }
+    CSS::Time transition_delay() const { return m_rare_noninherited->transition_delay; }
+
+    Color outline_color() const { return m_border->outline_color; }
+    CSS::Length outline_offset() const { return m_border->outline_offset; }
+    CSS::OutlineStyle outline_style() const { return m_border->outline_style; }
+    CSS::Length outline_width() const { return m_border->outline_width; }
+
+    CSS::TableLayout table_layout() const { return m_rare_noninherited->table_layout; }
+
+    CSS::QuotesData quotes() const { return m_inherited->quotes; }
+
+    CSS::MathShift math_shift() const { return m_inherited->math_shift; }
+    CSS::MathStyle math_style() const { return m_inherited->math_style; }
+    int math_depth() const { return m_inherited->math_depth; }
+
+    CSS::ScrollbarWidth scrollbar_width() const { return m_rare_noninherited->scrollbar_width; }
 
     NonnullOwnPtr<ComputedValues> clone_inherited_values() const
     {
@@ -517,7 +531,10 @@ public:
     }
 
 protected:
-    struct {
+    // NOTE: The computed values are split into groups that are shared between ComputedValues objects until one of
+    //       them changes a value in the group. Every group starts out as a shared set of initial values, and setting
+    //       a value that is already there doesn't detach the group, so elements with equal values share storage.
+    struct InheritedValues {
         RefPtr<Gfx::FontCascadeList> font_list {};
         CSSPixels font_size { InitialValues::font_size() };
         int font_weight { InitialValues::font_weight() };
@@ -563,21 +580,14 @@ protected:
         CSS::MathShift math_shift { InitialValues::math_shift() };
         CSS::MathStyle math_style { InitialValues::math_style() };
         int math_depth { InitialValues::math_depth() };
-    } m_inherited;
+    };
 
-    struct {
+    struct BoxValues {
         AspectRatio aspect_ratio { InitialValues::aspect_ratio() };
         CSS::Float float_ { InitialValues::float_() };
         CSS::Clear clear { InitialValues::clear() };
-        CSS::Clip clip { InitialValues::clip() };
         CSS::Display display { InitialValues::display() };
         Optional<int> z_index;
-        // FIXME: Store this as flags in a u8.
-        Vector<CSS::TextDecorationLine> text_decoration_line { InitialValues::text_decoration_line() };
-        CSS::LengthPercentage text_decoration_thickness { InitialValues::text_decoration_thickness() };
-        CSS::TextDecorationStyle text_decoration_style { InitialValues::text_decoration_style() };
-        Color text_decoration_color { InitialValues::color() };
-        CSS::TextOverflow text_overflow { InitialValues::text_overflow() };
         CSS::Positioning position { InitialValues::position() };
         CSS::Size width { InitialValues::width() };
         CSS::Size min_width { InitialValues::min_width() };
@@ -588,17 +598,6 @@ protected:
         CSS::LengthBox inset { InitialValues::inset() };
         CSS::LengthBox margin { InitialValues::margin() };
         CSS::LengthBox padding { InitialValues::padding() };
-        CSS::ResolvedBackdropFilter backdrop_filter { InitialValues::backdrop_filter() };
-        BorderData border_left;
-        BorderData border_top;
-        BorderData border_right;
-        BorderData border_bottom;
-        BorderRadiusData border_bottom_left_radius;
-        BorderRadiusData border_bottom_right_radius;
-        BorderRadiusData border_top_left_radius;
-        BorderRadiusData border_top_right_radius;
-        Color background_color { InitialValues::background_color() };
-        Vector<BackgroundLayerData> background_layers;
         CSS::FlexDirection flex_direction { InitialValues::flex_direction() };
         CSS::FlexWrap flex_wrap { InitialValues::flex_wrap() };
         CSS::FlexBasis flex_basis { InitialValues::flex_basis() };
@@ -608,19 +607,12 @@ protected:
         CSS::AlignContent align_content { InitialValues::align_content() };
         CSS::AlignItems align_items { InitialValues::align_items() };
         CSS::AlignSelf align_self { InitialValues::align_self() };
-        CSS::Appearance appearance { InitialValues::appearance() };
         CSS::JustifyContent justify_content { InitialValues::justify_content() };
         CSS::JustifyItems justify_items { InitialValues::justify_items() };
         CSS::JustifySelf justify_self { InitialValues::justify_self() };
         CSS::Overflow overflow_x { InitialValues::overflow() };
         CSS::Overflow overflow_y { InitialValues::overflow() };
-        float opacity { InitialValues::opacity() };
-        Vector<ShadowData> box_shadow {};
-        Vector<CSS::Transformation> transformations {};
-        CSS::TransformBox transform_box { InitialValues::transform_box() };
-        CSS::TransformOrigin transform_origin {};
         CSS::BoxSizing box_sizing { InitialValues::box_sizing() };
-        CSS::ContentData content;
         Variant<CSS::VerticalAlign, CSS::LengthPercentage> vertical_align { InitialValues::vertical_align() };
         CSS::GridTrackSizeList grid_auto_columns;
         CSS::GridTrackSizeList grid_auto_rows;
@@ -637,21 +629,53 @@ protected:
         CSS::Size column_width { InitialValues::column_width() };
         CSS::Size row_gap { InitialValues::row_gap() };
         Vector<Vector<String>> grid_template_areas { InitialValues::grid_template_areas() };
-        Gfx::Color stop_color { InitialValues::stop_color() };
-        float stop_opacity { InitialValues::stop_opacity() };
-        CSS::Time transition_delay { InitialValues::transition_delay() };
+    };
+
+    struct BackgroundValues {
+        Color background_color { InitialValues::background_color() };
+        Vector<BackgroundLayerData> background_layers;
+        Vector<ShadowData> box_shadow {};
+    };
+
+    struct BorderValues {
+        BorderData border_left;
+        BorderData border_top;
+        BorderData border_right;
+        BorderData border_bottom;
+        BorderRadiusData border_bottom_left_radius;
+        BorderRadiusData border_bottom_right_radius;
+        BorderRadiusData border_top_left_radius;
+        BorderRadiusData border_top_right_radius;
         Color outline_color { InitialValues::outline_color() };
         CSS::Length outline_offset { InitialValues::outline_offset() };
         CSS::OutlineStyle outline_style { InitialValues::outline_style() };
         CSS::Length outline_width { InitialValues::outline_width() };
+    };
+
+    struct RareNonInheritedValues {
+        CSS::Clip clip { InitialValues::clip() };
+        // FIXME: Store this as flags in a u8.
+        Vector<CSS::TextDecorationLine> text_decoration_line { InitialValues::text_decoration_line() };
+        CSS::LengthPercentage text_decoration_thickness { InitialValues::text_decoration_thickness() };
+        CSS::TextDecorationStyle text_decoration_style { InitialValues::text_decoration_style() };
+        Color text_decoration_color { InitialValues::color() };
+        CSS::TextOverflow text_overflow { InitialValues::text_overflow() };
+        CSS::ResolvedBackdropFilter backdrop_filter { InitialValues::backdrop_filter() };
+        CSS::Appearance appearance { InitialValues::appearance() };
+        float opacity { InitialValues::opacity() };
+        Vector<CSS::Transformation> transformations {};
+        CSS::TransformBox transform_box { InitialValues::transform_box() };
+        CSS::TransformOrigin transform_origin {};
+        CSS::ContentData content;
+        Gfx::Color stop_color { InitialValues::stop_color() };
+        float stop_opacity { InitialValues::stop_opacity() };
+        CSS::Time transition_delay { InitialValues::transition_delay() };
         CSS::TableLayout table_layout { InitialValues::table_layout() };
         CSS::ObjectFit object_fit { InitialValues::object_fit() };
         CSS::ObjectPosition object_position { InitialValues::object_position() };
-
         Optional<MaskReference> mask;
         CSS::MaskType mask_type { InitialValues::mask_type() };
         Optional<ClipPathReference> clip_path;
-
         LengthPercentage cx { InitialValues::cx() };
         LengthPercentage cy { InitialValues::cy() };
         LengthPercentage r { InitialValues::r() };
@@ -659,12 +683,53 @@ protected:
         LengthPercentage ry { InitialValues::ry() };
         LengthPercentage x { InitialValues::x() };
         LengthPercentage y { InitialValues::x() };
-
         CSS::ScrollbarWidth scrollbar_width { InitialValues::scrollbar_width() };
         Vector<CounterData, 0> counter_increment;
         Vector<CounterData, 0> counter_reset;
         Vector<CounterData, 0> counter_set;
-    } m_noninherited;
+    };
+
+    template<typename T>
+    struct RefCountedValues final
+        : public RefCounted<RefCountedValues<T>>
+        , public T {
+        NonnullRefPtr<RefCountedValues> clone() const
+        {
+            auto clone = adopt_ref(*new RefCountedValues);
+            static_cast<T&>(*clone) = *this;
+            return clone;
+        }
+    };
+
+    template<typename T>
+    using SharedValues = CopyOnWrite<RefCountedValues<T>>;
+
+    template<typename T>
+    static SharedValues<T> initial_values()
+    {
+        static NonnullRefPtr<RefCountedValues<T>> const values = adopt_ref(*new RefCountedValues<T>);
+        return SharedValues<T> { values };
+    }
+
+    template<typename Group, typename T, typename U>
+    static void set_value(SharedValues<Group>& group, T Group::*member, U&& value)
+    {
+        if constexpr (ComparableComputedValue<T>) {
+            if (group.value().*member == value)
+                return;
+        } else if constexpr (requires(T const& current) { current.is_empty(); }) {
+            // NOTE: Most elements have no shadows, transformations, counters and so on, so avoid detaching for those.
+            if (value.is_empty() && (group.value().*member).is_empty())
+                return;
+        }
+        group.mutable_value().*member = forward<U>(value);
+    }
+
+    SharedValues<InheritedValues> m_inherited { initial_values<InheritedValues>() };
+    SharedValues<BoxValues> m_box { initial_values<BoxValues>() };
+    SharedValues<BackgroundValues> m_background { initial_values<BackgroundValues>() };
+    SharedValues<BorderValues> m_border { initial_values<BorderValues>() };
+    SharedValues<RareNonInheritedValues> m_rare_noninherited { initial_values<RareNonInheritedValues>() };
 };
 
 class ImmutableComputedValues final : public ComputedValues {
@@ -677,147 +742,151 @@ public:
         m_inherited = static_cast<MutableComputedValues const&>(other).m_inherited;
     }
 
-    void set_aspect_ratio(AspectRatio aspect_ratio) { m_noninherited.aspect_ratio = aspect_ratio; }
-    void set_font_list(NonnullRefPtr<Gfx::FontCascadeList> font_list) { m_inherited.font_list = move(font_list); }
-    void set_font_size(CSSPixels font_size) { m_inherited.font_size = font_size; }
-    void set_font_weight(int font_weight) { m_inherited.font_weight = font_weight; }
-    void set_font_variant(CSS::FontVariant font_variant) { m_inherited.font_variant = font_variant; }
-    void set_font_language_override(Optional<FlyString> font_language_override) { m_inherited.font_language_override = font_language_override; }
-    void set_font_feature_settings(Optional<HashMap<FlyString, IntegerOrCalculated>> value) { m_inherited.font_feature_settings = move(value); }
-    void set_font_variation_settings(Optional<HashMap<FlyString, NumberOrCalculated>> value) { m_inherited.font_variation_settings = move(value); }
-    void set_line_height(CSSPixels line_height) { m_inherited.line_height = line_height; }
-    void set_border_spacing_horizontal(CSS::Length border_spacing_horizontal) { m_inherited.border_spacing_horizontal = border_spacing_horizontal; }
-    void set_border_spacing_vertical(CSS::Length border_spacing_vertical) { m_inherited.border_spacing_vertical = border_spacing_vertical; }
-    void set_caption_side(CSS::CaptionSide caption_side) { m_inherited.caption_side = caption_side; }
-    void set_color(Color color) { m_inherited.color = color; }
-    void set_clip(CSS::Clip const& clip) { m_noninherited.clip = clip; }
-    void set_content(ContentData const& content) { m_noninherited.content = content; }
-    void set_content_visibility(CSS::ContentVisibility content_visibility) { m_inherited.content_visibility = content_visibility; }
-    void set_cursor(CSS::Cursor cursor) { m_inherited.cursor = cursor; }
-    void set_image_rendering(CSS::ImageRendering value) { m_inherited.image_rendering = value; }
-    void set_pointer_events(CSS::PointerEvents value) { m_inherited.pointer_events = value; }
-    void set_background_color(Color color) { m_noninherited.background_color = color; }
-    void set_background_layers(Vector<BackgroundLayerData>&& layers) { m_noninherited.background_layers = move(layers); }
-    void set_float(CSS::Float value) { m_noninherited.float_ = value; }
-    void set_clear(CSS::Clear value) { m_noninherited.clear = value; }
-    void set_z_index(Optional<int> value) { m_noninherited.z_index = value; }
-    void set_tab_size(Variant<LengthOrCalculated, NumberOrCalculated> value) { m_inherited.tab_size = value; }
-    void set_text_align(CSS::TextAlign text_align) { m_inherited.text_align = text_align; }
-    void set_text_justify(CSS::TextJustify text_justify) { m_inherited.text_justify = text_justify; }
-    void set_text_decoration_line(Vector<CSS::TextDecorationLine> value) { m_noninherited.text_decoration_line = move(value); }
-    void set_text_decoration_thickness(CSS::LengthPercentage value) { m_noninherited.text_decoration_thickness = move(value); }
-    void set_text_decoration_style(CSS::TextDecorationStyle value) { m_noninherited.text_decoration_style = value; }
-    void set_text_decoration_color(Color value) { m_noninherited.text_decoration_color = value; }
-    void set_text_transform(CSS::TextTransform value) { m_inherited.text_transform = value; }
-    void set_text_shadow(Vector<ShadowData>&& value) { m_inherited.text_shadow = move(value); }
-    void set_text_indent(CSS::LengthPercentage value) { m_inherited.text_indent = move(value); }
-    void set_text_overflow(CSS::TextOverflow value) { m_noninherited.text_overflow = value; }
-    void set_webkit_text_fill_color(Color value) { m_inherited.webkit_text_fill_color = value; }
-    void set_position(CSS::Positioning position) { m_noninherited.position = position; }
-    void set_white_space(CSS::WhiteSpace value) { m_inherited.white_space = value; }
-    void set_width(CSS::Size const& width) { m_noninherited.width = width; }
-    void set_min_width(CSS::Size const& width) { m_noninherited.min_width = width; }
-    void set_max_width(CSS::Size const& width) { m_noninherited.max_width = width; }
-    void set_height(CSS::Size const& height) { m_noninherited.height = height; }
-    void set_min_height(CSS::Size const& height) { m_noninherited.min_height = height; }
-    void set_max_height(CSS::Size const& height) { m_noninherited.max_height = height; }
-    void set_inset(CSS::LengthBox const& inset) { m_noninherited.inset = inset; }
-    void set_margin(const CSS::LengthBox& margin) { m_noninherited.margin = margin; }
-    void set_padding(const CSS::LengthBox& padding) { m_noninherited.padding = padding; }
-    void set_overflow_x(CSS::Overflow value) { m_noninherited.overflow_x = value; }
-    void set_overflow_y(CSS::Overflow value) { m_noninherited.overflow_y = value; }
-    void set_list_style_type(CSS::ListStyleType value) { m_inherited.list_style_type = value; }
-    void set_list_style_position(CSS::ListStylePosition value) { m_inherited.list_style_position = value; }
-    void set_display(CSS::Display value) { m_noninherited.display = value; }
-    void set_backdrop_filter(CSS::ResolvedBackdropFilter backdrop_filter) { m_noninherited.backdrop_filter = move(backdrop_filter); }
-    void set_border_bottom_left_radius(CSS::BorderRadiusData value) { m_noninherited.border_bottom_left_radius = move(value); }
-    void set_border_bottom_right_radius(CSS::BorderRadiusData value) { m_noninherited.border_bottom_right_radius = move(value); }
-    void set_border_top_left_radius(CSS::BorderRadiusData value) { m_noninherited.border_top_left_radius = move(value); }
-    void set_border_top_right_radius(CSS::BorderRadiusData value) { m_noninherited.border_top_right_radius = move(value); }
-    BorderData& border_left() { return m_noninherited.border_left; }
-    BorderData& border_top() { return m_noninherited.border_top; }
-    BorderData& border_right() { return m_noninherited.border_right; }
-    BorderData& border_bottom() { return m_noninherited.border_bottom; }
-    void set_flex_direction(CSS::FlexDirection value) { m_noninherited.flex_direction = value; }
-    void set_flex_wrap(CSS::FlexWrap value) { m_noninherited.flex_wrap = value; }
-    void set_flex_basis(FlexBasis value) { m_noninherited.flex_basis = move(value); }
-    void set_flex_grow(float value) { m_noninherited.flex_grow = value; }
-    void set_flex_shrink(float value) { m_noninherited.flex_shrink = value; }
-    void set_order(int value) { m_noninherited.order = value; }
-    void set_accent_color(Color value) { m_inherited.accent_color = value; }
-    void set_align_content(CSS::AlignContent value) { m_noninherited.align_content = value; }
-    void set_align_items(CSS::AlignItems value) { m_noninherited.align_items = value; }
-    void set_align_self(CSS::AlignSelf value) { m_noninherited.align_self = value; }
-    void set_appearance(CSS::Appearance value) { m_noninherited.appearance = value; }
-    void set_opacity(float value) { m_noninherited.opacity = value; }
-    void set_justify_content(CSS::JustifyContent value) { m_noninherited.justify_content = value; }
-    void set_justify_items(CSS::JustifyItems value) { m_noninherited.justify_items = value; }
-    void set_justify_self(CSS::JustifySelf value) { m_noninherited.justify_self = value; }
-    void set_box_shadow(Vector<ShadowData>&& value) { m_noninherited.box_shadow = move(value); }
-    void set_transformations(Vector<CSS::Transformation> value) { m_noninherited.transformations = move(value); }
-    void set_transform_box(CSS::TransformBox value) { m_noninherited.transform_box = value; }
-    void set_transform_origin(CSS::TransformOrigin value) { m_noninherited.transform_origin = value; }
-    void set_box_sizing(CSS::BoxSizing value) { m_noninherited.box_sizing = value; }
-    void set_vertical_align(Variant<CSS::VerticalAlign, CSS::LengthPercentage> value) { m_noninherited.vertical_align = move(value); }
-    void set_visibility(CSS::Visibility value) { m_inherited.visibility = value; }
-    void set_grid_auto_columns(CSS::GridTrackSizeList value) { m_noninherited.grid_auto_columns = move(value); }
-    void set_grid_auto_rows(CSS::GridTrackSizeList value) { m_noninherited.grid_auto_rows = move(value); }
-    void set_grid_template_columns(CSS::GridTrackSizeList value) { m_noninherited.grid_template_columns = move(value); }
-    void set_grid_template_rows(CSS::GridTrackSizeList value) { m_noninherited.grid_template_rows = move(value); }
-    void set_grid_column_end(CSS::GridTrackPlacement value) { m_noninherited.grid_column_end = value; }
-    void set_grid_column_start(CSS::GridTrackPlacement value) { m_noninherited.grid_column_start = value; }
-    void set_grid_row_end(CSS::GridTrackPlacement value) { m_noninherited.grid_row_end = value; }
-    void set_grid_row_start(CSS::GridTrackPlacement value) { m_noninherited.grid_row_start = value; }
-    void set_column_count(CSS::ColumnCount value) { m_noninherited.column_count = value; }
-    void set_column_gap(CSS::Size const& column_gap) { m_noninherited.column_gap = column_gap; }
-    void set_column_span(CSS::ColumnSpan const& column_span) { m_noninherited.column_span = column_span; }
-    void set_column_width(CSS::Size const& column_width) { m_noninherited.column_width = column_width; }
-    void set_row_gap(CSS::Size const& row_gap) { m_noninherited.row_gap = row_gap; }
-    void set_border_collapse(CSS::BorderCollapse const& border_collapse) { m_inherited.border_collapse = border_collapse; }
-    void set_grid_template_areas(Vector<Vector<String>> const& grid_template_areas) { m_noninherited.grid_template_areas = grid_template_areas; }
-    void set_grid_auto_flow(CSS::GridAutoFlow grid_auto_flow) { m_noninherited.grid_auto_flow = grid_auto_flow; }
-    void set_transition_delay(CSS::Time const& transition_delay) { m_noninherited.transition_delay = transition_delay; }
-    void set_table_layout(CSS::TableLayout value) { m_noninherited.table_layout = value; }
-    void set_quotes(CSS::QuotesData value) { m_inherited.quotes = value; }
-    void set_object_fit(CSS::ObjectFit value) { m_noninherited.object_fit = value; }
-    void set_object_position(CSS::ObjectPosition value) { m_noninherited.object_position = value; }
-    void set_direction(CSS::Direction value) { m_inherited.direction = value; }
-
-    void set_fill(SVGPaint value) { m_inherited.fill = value; }
-    void set_stroke(SVGPaint value) { m_inherited.stroke = value; }
-    void set_fill_rule(CSS::FillRule value) { m_inherited.fill_rule = value; }
-    void set_fill_opacity(float value) { m_inherited.fill_opacity = value; }
-    void set_stroke_opacity(float value) { m_inherited.stroke_opacity = value; }
-    void set_stroke_width(LengthPercentage value) { m_inherited.stroke_width = value; }
-    void set_stop_color(Color value) { m_noninherited.stop_color = value; }
-    void set_stop_opacity(float value) { m_noninherited.stop_opacity = value; }
-    void set_text_anchor(CSS::TextAnchor value) { m_inherited.text_anchor = value; }
-    void set_outline_color(Color value) { m_noninherited.outline_color = value; }
-    void set_outline_offset(CSS::Length value) { m_noninherited.outline_offset = value; }
-    void set_outline_style(CSS::OutlineStyle value) { m_noninherited.outline_style = value; }
-    void set_outline_width(CSS::Length value) { m_noninherited.outline_width = value; }
-    void set_mask(MaskReference value) { m_noninherited.mask = value; }
-    void set_mask_type(CSS::MaskType value) { m_noninherited.mask_type = value; }
-    void set_clip_path(ClipPathReference value) { m_noninherited.clip_path = value; }
-    void set_clip_rule(CSS::ClipRule value) { m_inherited.clip_rule = value; }
-
-    void set_cx(LengthPercentage cx) { m_noninherited.cx = cx; }
-    void set_cy(LengthPercentage cy) { m_noninherited.cy = cy; }
-    void set_r(LengthPercentage r) { m_noninherited.r = r; }
-    void set_rx(LengthPercentage rx) { m_noninherited.rx = rx; }
-    void set_ry(LengthPercentage ry) { m_noninherited.ry = ry; }
-    void set_x(LengthPercentage x) { m_noninherited.x = x; }
-    void set_y(LengthPercentage y) { m_noninherited.y = y; }
-
-    void set_math_shift(CSS::MathShift value) { m_inherited.math_shift = value; }
-    void set_math_style(CSS::MathStyle value) { m_inherited.math_style = value; }
-    void set_math_depth(int value) { m_inherited.math_depth = value; }
-
-    void set_scrollbar_width(CSS::ScrollbarWidth value) { m_noninherited.scrollbar_width = value; }
-
-    void set_counter_increment(Vector<CounterData> value) { m_noninherited.counter_increment = move(value); }
-    void set_counter_reset(Vector<CounterData> value) { m_noninherited.counter_reset = move(value); }
-    void set_counter_set(Vector<CounterData> value) { m_noninherited.counter_set = move(value); }
+    void set_aspect_ratio(AspectRatio aspect_ratio) { set_value(m_box, &BoxValues::aspect_ratio, aspect_ratio); }
+    void set_font_list(NonnullRefPtr<Gfx::FontCascadeList> font_list)
+    {
+        if (m_inherited.value().font_list.ptr() != font_list.ptr())
+            m_inherited.mutable_value().font_list = move(font_list);
+    }
+    void set_font_size(CSSPixels font_size) { set_value(m_inherited, &InheritedValues::font_size, font_size); }
+    void set_font_weight(int font_weight) { set_value(m_inherited, &InheritedValues::font_weight, font_weight); }
+    void set_font_variant(CSS::FontVariant font_variant) { set_value(m_inherited, &InheritedValues::font_variant, font_variant); }
+    void set_font_language_override(Optional<FlyString> font_language_override) { set_value(m_inherited, &InheritedValues::font_language_override, font_language_override); }
+    void set_font_feature_settings(Optional<HashMap<FlyString, IntegerOrCalculated>> value) { set_value(m_inherited, &InheritedValues::font_feature_settings, move(value)); }
+    void set_font_variation_settings(Optional<HashMap<FlyString, NumberOrCalculated>> value) { set_value(m_inherited, &InheritedValues::font_variation_settings, move(value)); }
+    void set_line_height(CSSPixels line_height) { set_value(m_inherited, &InheritedValues::line_height, line_height); }
+    void set_border_spacing_horizontal(CSS::Length border_spacing_horizontal) { set_value(m_inherited, &InheritedValues::border_spacing_horizontal, border_spacing_horizontal); }
+    void set_border_spacing_vertical(CSS::Length border_spacing_vertical) { set_value(m_inherited, &InheritedValues::border_spacing_vertical, border_spacing_vertical); }
+    void set_caption_side(CSS::CaptionSide caption_side) { set_value(m_inherited, &InheritedValues::caption_side, caption_side); }
+    void set_color(Color color) { set_value(m_inherited, &InheritedValues::color, color); }
+    void set_clip(CSS::Clip const& clip) { set_value(m_rare_noninherited, &RareNonInheritedValues::clip, clip); }
+    void set_content(ContentData const& content) { set_value(m_rare_noninherited, &RareNonInheritedValues::content, content); }
+    void set_content_visibility(CSS::ContentVisibility content_visibility) { set_value(m_inherited, &InheritedValues::content_visibility, content_visibility); }
+    void set_cursor(CSS::Cursor cursor) { set_value(m_inherited, &InheritedValues::cursor, cursor); }
+    void set_image_rendering(CSS::ImageRendering value) { set_value(m_inherited, &InheritedValues::image_rendering, value); }
+    void set_pointer_events(CSS::PointerEvents value) { set_value(m_inherited, &InheritedValues::pointer_events, value); }
+    void set_background_color(Color color) { set_value(m_background, &BackgroundValues::background_color, color); }
+    void set_background_layers(Vector<BackgroundLayerData>&& layers) { set_value(m_background, &BackgroundValues::background_layers, move(layers)); }
+    void set_float(CSS::Float value) { set_value(m_box, &BoxValues::float_, value); }
+    void set_clear(CSS::Clear value) { set_value(m_box, &BoxValues::clear, value); }
+    void set_z_index(Optional<int> value) { set_value(m_box, &BoxValues::z_index, value); }
+    void set_tab_size(Variant<LengthOrCalculated, NumberOrCalculated> value) { set_value(m_inherited, &InheritedValues::tab_size, value); }
+    void set_text_align(CSS::TextAlign text_align) { set_value(m_inherited, &InheritedValues::text_align, text_align); }
+    void set_text_justify(CSS::TextJustify text_justify) { set_value(m_inherited, &InheritedValues::text_justify, text_justify); }
+    void set_text_decoration_line(Vector<CSS::TextDecorationLine> value) { set_value(m_rare_noninherited, &RareNonInheritedValues::text_decoration_line, move(value)); }
+    void set_text_decoration_thickness(CSS::LengthPercentage value) { set_value(m_rare_noninherited, &RareNonInheritedValues::text_decoration_thickness, move(value)); }
+    void set_text_decoration_style(CSS::TextDecorationStyle value) { set_value(m_rare_noninherited, &RareNonInheritedValues::text_decoration_style, value); }
+    void set_text_decoration_color(Color value) { set_value(m_rare_noninherited, &RareNonInheritedValues::text_decoration_color, value); }
+    void set_text_transform(CSS::TextTransform value) { set_value(m_inherited, &InheritedValues::text_transform, value); }
+    void set_text_shadow(Vector<ShadowData>&& value) { set_value(m_inherited, &InheritedValues::text_shadow, move(value)); }
+    void set_text_indent(CSS::LengthPercentage value) { set_value(m_inherited, &InheritedValues::text_indent, move(value)); }
+    void set_text_overflow(CSS::TextOverflow value) { set_value(m_rare_noninherited, &RareNonInheritedValues::text_overflow, value); }
+    void set_webkit_text_fill_color(Color value) { set_value(m_inherited, &InheritedValues::webkit_text_fill_color, value); }
+    void set_position(CSS::Positioning position) { set_value(m_box, &BoxValues::position, position); }
+    void set_white_space(CSS::WhiteSpace value) { set_value(m_inherited, &InheritedValues::white_space, value); }
+    void set_width(CSS::Size const& width) { set_value(m_box, &BoxValues::width, width); }
+    void set_min_width(CSS::Size const& width) { set_value(m_box, &BoxValues::min_width, width); }
+    void set_max_width(CSS::Size const& width) { set_value(m_box, &BoxValues::max_width, width); }
+    void set_height(CSS::Size const& height) { set_value(m_box, &BoxValues::height, height); }
+    void set_min_height(CSS::Size const& height) { set_value(m_box, &BoxValues::min_height, height); }
+    void set_max_height(CSS::Size const& height) { set_value(m_box, &BoxValues::max_height, height); }
+    void set_inset(CSS::LengthBox const& inset) { set_value(m_box, &BoxValues::inset, inset); }
+    void set_margin(const CSS::LengthBox& margin) { set_value(m_box, &BoxValues::margin, margin); }
+    void set_padding(const CSS::LengthBox& padding) { set_value(m_box, &BoxValues::padding, padding); }
+    void set_overflow_x(CSS::Overflow value) { set_value(m_box, &BoxValues::overflow_x, value); }
+    void set_overflow_y(CSS::Overflow value) { set_value(m_box, &BoxValues::overflow_y, value); }
+    void set_list_style_type(CSS::ListStyleType value) { set_value(m_inherited, &InheritedValues::list_style_type, value); }
+    void set_list_style_position(CSS::ListStylePosition value) { set_value(m_inherited, &InheritedValues::list_style_position, value); }
+    void set_display(CSS::Display value) { set_value(m_box, &BoxValues::display, value); }
+    void set_backdrop_filter(CSS::ResolvedBackdropFilter backdrop_filter) { set_value(m_rare_noninherited, &RareNonInheritedValues::backdrop_filter, move(backdrop_filter)); }
+    void set_border_bottom_left_radius(CSS::BorderRadiusData value) { set_value(m_border, &BorderValues::border_bottom_left_radius, move(value)); }
+    void set_border_bottom_right_radius(CSS::BorderRadiusData value) { set_value(m_border, &BorderValues::border_bottom_right_radius, move(value)); }
+    void set_border_top_left_radius(CSS::BorderRadiusData value) { set_value(m_border, &BorderValues::border_top_left_radius, move(value)); }
+    void set_border_top_right_radius(CSS::BorderRadiusData value) { set_value(m_border, &BorderValues::border_top_right_radius, move(value)); }
+    void set_border_left(BorderData value) { set_value(m_border, &BorderValues::border_left, value); }
+    void set_border_top(BorderData value) { set_value(m_border, &BorderValues::border_top, value); }
+    void set_border_right(BorderData value) { set_value(m_border, &BorderValues::border_right, value); }
+    void set_border_bottom(BorderData value) { set_value(m_border, &BorderValues::border_bottom, value); }
+    void set_flex_direction(CSS::FlexDirection value) { set_value(m_box, &BoxValues::flex_direction, value); }
+    void set_flex_wrap(CSS::FlexWrap value) { set_value(m_box, &BoxValues::flex_wrap, value); }
+    void set_flex_basis(FlexBasis value) { set_value(m_box, &BoxValues::flex_basis, move(value)); }
+    void set_flex_grow(float value) { set_value(m_box, &BoxValues::flex_grow, value); }
+    void set_flex_shrink(float value) { set_value(m_box, &BoxValues::flex_shrink, value); }
+    void set_order(int value) { set_value(m_box, &BoxValues::order, value); }
+    void set_accent_color(Color value) { set_value(m_inherited, &InheritedValues::accent_color, value); }
+    void set_align_content(CSS::AlignContent value) { set_value(m_box, &BoxValues::align_content, value); }
+    void set_align_items(CSS::AlignItems value) { set_value(m_box, &BoxValues::align_items, value); }
+    void set_align_self(CSS::AlignSelf value) { set_value(m_box, &BoxValues::align_self, value); }
+    void set_appearance(CSS::Appearance value) { set_value(m_rare_noninherited, &RareNonInheritedValues::appearance, value); }
+    void set_opacity(float value) { set_value(m_rare_noninherited, &RareNonInheritedValues::opacity, value); }
+    void set_justify_content(CSS::JustifyContent value) { set_value(m_box, &BoxValues::justify_content, value); }
+    void set_justify_items(CSS::JustifyItems value) { set_value(m_box, &BoxValues::justify_items, value); }
+    void set_justify_self(CSS::JustifySelf value) { set_value(m_box, &BoxValues::justify_self, value); }
+    void set_box_shadow(Vector<ShadowData>&& value) { set_value(m_background, &BackgroundValues::box_shadow, move(value)); }
+    void set_transformations(Vector<CSS::Transformation> value) { set_value(m_rare_noninherited, &RareNonInheritedValues::transformations, move(value)); }
+    void set_transform_box(CSS::TransformBox value) { set_value(m_rare_noninherited, &RareNonInheritedValues::transform_box, value); }
+    void set_transform_origin(CSS::TransformOrigin value) { set_value(m_rare_noninherited, &RareNonInheritedValues::transform_origin, value); }
+    void set_box_sizing(CSS::BoxSizing value) { set_value(m_box, &BoxValues::box_sizing, value); }
+    void set_vertical_align(Variant<CSS::VerticalAlign, CSS::LengthPercentage> value) { set_value(m_box, &BoxValues::vertical_align, move(value)); }
+    void set_visibility(CSS::Visibility value) { set_value(m_inherited, &InheritedValues::visibility, value); }
+    void set_grid_auto_columns(CSS::GridTrackSizeList value) { set_value(m_box, &BoxValues::grid_auto_columns, move(value)); }
+    void set_grid_auto_rows(CSS::GridTrackSizeList value) { set_value(m_box, &BoxValues::grid_auto_rows, move(value)); }
+    void set_grid_template_columns(CSS::GridTrackSizeList value) { set_value(m_box, &BoxValues::grid_template_columns, move(value)); }
+    void set_grid_template_rows(CSS::GridTrackSizeList value) { set_value(m_box, &BoxValues::grid_template_rows, move(value)); }
+    void set_grid_column_end(CSS::GridTrackPlacement value) { set_value(m_box, &BoxValues::grid_column_end, value); }
+    void set_grid_column_start(CSS::GridTrackPlacement value) { set_value(m_box, &BoxValues::grid_column_start, value); }
+    void set_grid_row_end(CSS::GridTrackPlacement value) { set_value(m_box, &BoxValues::grid_row_end, value); }
+    void set_grid_row_start(CSS::GridTrackPlacement value) { set_value(m_box, &BoxValues::grid_row_start, value); }
+    void set_column_count(CSS::ColumnCount value) { set_value(m_box, &BoxValues::column_count, value); }
+    void set_column_gap(CSS::Size const& column_gap) { set_value(m_box, &BoxValues::column_gap, column_gap); }
+    void set_column_span(CSS::ColumnSpan const& column_span) { set_value(m_box, &BoxValues::column_span, column_span); }
+    void set_column_width(CSS::Size const& column_width) { set_value(m_box, &BoxValues::column_width, column_width); }
+    void set_row_gap(CSS::Size const& row_gap) { set_value(m_box, &BoxValues::row_gap, row_gap); }
+    void set_border_collapse(CSS::BorderCollapse const& border_collapse) { set_value(m_inherited, &InheritedValues::border_collapse, border_collapse); }
+    void set_grid_template_areas(Vector<Vector<String>> const& grid_template_areas) { set_value(m_box, &BoxValues::grid_template_areas, grid_template_areas); }
+    void set_grid_auto_flow(CSS::GridAutoFlow grid_auto_flow) { set_value(m_box, &BoxValues::grid_auto_flow, grid_auto_flow); }
+    void set_transition_delay(CSS::Time const& transition_delay) { set_value(m_rare_noninherited, &RareNonInheritedValues::transition_delay, transition_delay); }
+    void set_table_layout(CSS::TableLayout value) { set_value(m_rare_noninherited, &RareNonInheritedValues::table_layout, value); }
+    void set_quotes(CSS::QuotesData value) { set_value(m_inherited, &InheritedValues::quotes, value); }
+    void set_object_fit(CSS::ObjectFit value) { set_value(m_rare_noninherited, &RareNonInheritedValues::object_fit, value); }
+    void set_object_position(CSS::ObjectPosition value) { set_value(m_rare_noninherited, &RareNonInheritedValues::object_position, value); }
+    void set_direction(CSS::Direction value) { set_value(m_inherited, &InheritedValues::direction, value); }
+
+    void set_fill(SVGPaint value) { set_value(m_inherited, &InheritedValues::fill, value); }
+    void set_stroke(SVGPaint value) { set_value(m_inherited, &InheritedValues::stroke, value); }
+    void set_fill_rule(CSS::FillRule value) { set_value(m_inherited, &InheritedValues::fill_rule, value); }
+    void set_fill_opacity(float value) { set_value(m_inherited, &InheritedValues::fill_opacity, value); }
+    void set_stroke_opacity(float value) { set_value(m_inherited, &InheritedValues::stroke_opacity, value); }
+    void set_stroke_width(LengthPercentage value) { set_value(m_inherited, &InheritedValues::stroke_width, value); }
+    void set_stop_color(Color value) { set_value(m_rare_noninherited, &RareNonInheritedValues::stop_color, value); }
+    void set_stop_opacity(float value) { set_value(m_rare_noninherited, &RareNonInheritedValues::stop_opacity, value); }
+    void set_text_anchor(CSS::TextAnchor value) { set_value(m_inherited, &InheritedValues::text_anchor, value); }
+    void set_outline_color(Color value) { set_value(m_border, &BorderValues::outline_color, value); }
+    void set_outline_offset(CSS::Length value) { set_value(m_border, &BorderValues::outline_offset, value); }
+    void set_outline_style(CSS::OutlineStyle value) { set_value(m_border, &BorderValues::outline_style, value); }
+    void set_outline_width(CSS::Length value) { set_value(m_border, &BorderValues::outline_width, value); }
+    void set_mask(MaskReference value) { set_value(m_rare_noninherited, &RareNonInheritedValues::mask, value); }
+    void set_mask_type(CSS::MaskType value) { set_value(m_rare_noninherited, &RareNonInheritedValues::mask_type, value); }
+    void set_clip_path(ClipPathReference value) { set_value(m_rare_noninherited, &RareNonInheritedValues::clip_path, value); }
+    void set_clip_rule(CSS::ClipRule value) { set_value(m_inherited, &InheritedValues::clip_rule, value); }
+
+    void set_cx(LengthPercentage cx) { set_value(m_rare_noninherited, &RareNonInheritedValues::cx, cx); }
+    void set_cy(LengthPercentage cy) { set_value(m_rare_noninherited, &RareNonInheritedValues::cy, cy); }
+    void set_r(LengthPercentage r) { set_value(m_rare_noninherited, &RareNonInheritedValues::r, r); }
+    void set_rx(LengthPercentage rx) { set_value(m_rare_noninherited, &RareNonInheritedValues::rx, rx); }
+    void set_ry(LengthPercentage ry) { set_value(m_rare_noninherited, &RareNonInheritedValues::ry, ry); }
+    void set_x(LengthPercentage x) { set_value(m_rare_noninherited, &RareNonInheritedValues::x, x); }
+    void set_y(LengthPercentage y) { set_value(m_rare_noninherited, &RareNonInheritedValues::y, y); }
+
+    void set_math_shift(CSS::MathShift value) { set_value(m_inherited, &InheritedValues::math_shift, value); }
+    void set_math_style(CSS::MathStyle value) { set_value(m_inherited, &InheritedValues::math_style, value); }
+    void set_math_depth(int value) { set_value(m_inherited, &InheritedValues::math_depth, value); }
+
+    void set_scrollbar_width(CSS::ScrollbarWidth value) { set_value(m_rare_noninherited, &RareNonInheritedValues::scrollbar_width, value); }
+
+    void set_counter_increment(Vector<CounterData> value) { set_value(m_rare_noninherited, &RareNonInheritedValues::counter_increment, move(value)); }
+    void set_counter_reset(Vector<CounterData> value) { set_value(m_rare_noninherited, &RareNonInheritedValues::counter_reset, move(value)); }
+    void set_counter_set(Vector<CounterData> value) { set_value(m_rare_noninherited, &RareNonInheritedValues::counter_set, move(value)); }
 };
 
 }
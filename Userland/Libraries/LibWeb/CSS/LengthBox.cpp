@@ -6,6 +6,7 @@
  */
 
 #include "LengthBox.h"
+#include <LibWeb/CSS/StyleValues/CSSMathValue.h>
 
 namespace Web::CSS {
 
@@ -27,4 +28,6 @@ LengthBox::LengthBox(LengthPercentage top, LengthPercentage right, LengthPercent
 
 LengthBox::~LengthBox() = default;
 
+bool LengthBox::operator==(LengthBox const&) const = default;
+
 }
@@ -14,6 +14,7 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericLexer.h>
+#include <AK/IntrusiveList.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
@@ -7620,6 +7621,88 @@ bool block_contains_var_or_attr(Block const& block)
     return false;
 }
 
+// Style values parsed from the same tokens in the same kind of context are identical, and a typical page parses
+// the same handful of values (`display: flex`, `margin: 0` and so on) over and over again. This keeps the most
+// recently used ones around, so they can be shared instead of being parsed again.
+class ParsedValueCache {
+public:
+    static ParsedValueCache& the()
+    {
+        static ParsedValueCache cache;
+        return cache;
+    }
+
+    RefPtr<CSSStyleValue> get(String const& key)
+    {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+            return nullptr;
+        auto& entry = *it->value;
+        m_recently_used.prepend(entry);
+        return entry.value;
+    }
+
+    void set(String key, NonnullRefPtr<CSSStyleValue> value)
+    {
+        if (m_entries.size() >= max_entries) {
+            auto least_recently_used_key = m_recently_used.take_last()->key;
+            m_entries.remove(least_recently_used_key);
+        }
+        auto entry = make<Entry>(key, move(value));
+        m_recently_used.prepend(*entry);
+        m_entries.set(move(key), move(entry));
+    }
+
+private:
+    static constexpr size_t max_entries = 4096;
+
+    struct Entry {
+        Entry(String key, NonnullRefPtr<CSSStyleValue> value)
+            : key(move(key))
+            , value(move(value))
+        {
+        }
+
+        String key;
+        NonnullRefPtr<CSSStyleValue> value;
+        IntrusiveListNode<Entry> list_node;
+    };
+
+    HashMap<String, NonnullOwnPtr<Entry>> m_entries;
+    IntrusiveList<&Entry::list_node> m_recently_used;
+};
+
+static Optional<String> parsed_value_cache_key(PropertyID property_id, ParsingContext const& context, Vector<ComponentValue> const& component_values)
+{
+    // NOTE: Only values made of simple tokens are cached. Functions and blocks can depend on the document (e.g. for
+    //       relative URLs or loaded images), and are rarely repeated verbatim anyway.
+    StringBuilder builder;
+    builder.appendff("{}:{}:{}:", to_underlying(property_id), to_underlying(context.mode()), context.in_quirks_mode());
+    for (auto const& component_value : component_values) {
+        if (!component_value.is_token())
+            return {};
+        auto const& token = component_value.token();
+        switch (token.type()) {
+        case Token::Type::Ident:
+        case Token::Type::Number:
+        case Token::Type::Percentage:
+        case Token::Type::Dimension:
+        case Token::Type::Hash:
+        case Token::Type::String:
+        case Token::Type::Delim:
+        case Token::Type::Comma:
+            break;
+        default:
+            return {};
+        }
+        if (token.representation().is_empty())
+            return {};
+        builder.append(token.representation());
+        builder.append(' ');
+    }
+    return MUST(builder.to_string());
+}
+
 Parser::ParseErrorOr<NonnullRefPtr<CSSStyleValue>> Parser::parse_css_value(PropertyID property_id, TokenStream<ComponentValue>& unprocessed_tokens)
 {
     m_context.set_current_property_id(property_id);
@@ -7659,6 +7742,20 @@ Parser::ParseErrorOr<NonnullRefPtr<CSSStyleValue>> Parser::parse_css_value(Prope
     if (component_values.is_empty())
         return ParseError::SyntaxError;
 
+    auto cache_key = parsed_value_cache_key(property_id, m_context, component_values);
+    if (cache_key.has_value()) {
+        if (auto cached_value = ParsedValueCache::the().get(*cache_key))
+            return cached_value.release_nonnull();
+    }
+
+    auto parsed_value = parse_css_value_from_component_values(property_id, component_values);
+    if (cache_key.has_value() && !parsed_value.is_error())
+        ParsedValueCache::the().set(cache_key.release_value(), parsed_value.value());
+    return parsed_value;
+}
+
+Parser::ParseErrorOr<NonnullRefPtr<CSSStyleValue>> Parser::parse_css_value_from_component_values(PropertyID property_id, Vector<ComponentValue> const& component_values)
+{
     auto tokens = TokenStream { component_values };
 
     if (component_values.size() == 1) {
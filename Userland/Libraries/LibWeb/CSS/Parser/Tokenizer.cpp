@@ -5,9 +5,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/FloatingPointStringConversions.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <AK/Vector.h>
 #include <LibTextCodec/Decoder.h>
@@ -258,6 +261,55 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
     return tokenizer.tokenize();
 }
 
+// Returns how many bytes at the start of `bytes` match, checking 16 bytes at a time with `vector_matcher` and the
+// rest with `scalar_matcher`. The vector matcher returns a mask with all bits set for each matching byte.
+template<typename VectorMatcher, typename ScalarMatcher>
+static size_t count_leading_matching_bytes(ReadonlyBytes bytes, VectorMatcher vector_matcher, ScalarMatcher scalar_matcher)
+{
+    using AK::SIMD::u8x16;
+    using AK::SIMD::u64x2;
+
+    size_t count = 0;
+    while (count + sizeof(u8x16) <= bytes.size()) {
+        auto mask = bit_cast<u64x2>(vector_matcher(AK::SIMD::load_unaligned<u8x16>(bytes.offset(count))));
+        if ((mask[0] & mask[1]) != NumericLimits<u64>::max())
+            break;
+        count += sizeof(u8x16);
+    }
+    while (count < bytes.size() && scalar_matcher(bytes[count]))
+        ++count;
+    return count;
+}
+
+// NOTE: These only match ASCII code points, and never newlines. Everything else is left to the code point by code
+//       point path, which also handles escapes.
+static size_t count_leading_ascii_ident_code_points(ReadonlyBytes bytes)
+{
+    return count_leading_matching_bytes(
+        bytes,
+        [](AK::SIMD::u8x16 chunk) {
+            auto lowercase = chunk | 0x20;
+            return ((lowercase >= 'a') & (lowercase <= 'z')) | ((chunk >= '0') & (chunk <= '9')) | (chunk == '-') | (chunk == '_');
+        },
+        [](u8 byte) { return is_ascii_alphanumeric(byte) || byte == '-' || byte == '_'; });
+}
+
+static size_t count_leading_ascii_whitespace_without_newlines(ReadonlyBytes bytes)
+{
+    return count_leading_matching_bytes(
+        bytes,
+        [](AK::SIMD::u8x16 chunk) { return (chunk == ' ') | (chunk == '\t'); },
+        [](u8 byte) { return byte == ' ' || byte == '\t'; });
+}
+
+static size_t count_leading_ascii_string_code_points(ReadonlyBytes bytes, u8 ending_code_point)
+{
+    return count_leading_matching_bytes(
+        bytes,
+        [ending_code_point](AK::SIMD::u8x16 chunk) { return (chunk != ending_code_point) & (chunk != '\\') & (chunk != '\n') & (chunk < 0x80); },
+        [ending_code_point](u8 byte) { return byte != ending_code_point && byte != '\\' && byte != '\n' && byte < 0x80; });
+}
+
 Tokenizer::Tokenizer(String decoded_input)
     : m_decoded_input(move(decoded_input))
     , m_utf8_view(m_decoded_input)
@@ -301,6 +353,21 @@ u32 Tokenizer::next_code_point()
     return code_point;
 }
 
+ReadonlyBytes Tokenizer::remaining_input_bytes() const
+{
+    return m_decoded_input.bytes().slice(current_byte_offset());
+}
+
+void Tokenizer::skip_ascii_code_points_without_newlines(size_t count)
+{
+    VERIFY(count > 0);
+    auto byte_offset = current_byte_offset() + count;
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(byte_offset - 1);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(byte_offset);
+    m_position.column += count;
+    m_prev_position = { m_position.line, m_position.column - 1 };
+}
+
 u32 Tokenizer::peek_code_point(size_t offset) const
 {
     auto it = m_utf8_iterator;
@@ -611,6 +678,12 @@ FlyString Tokenizer::consume_an_ident_sequence()
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Consume runs of ASCII name code points in one go.
+        if (auto length = count_leading_ascii_ident_code_points(remaining_input_bytes()); length > 0) {
+            result.append(StringView { remaining_input_bytes().trim(length) });
+            skip_ascii_code_points_without_newlines(length);
+        }
+
         auto input = next_code_point();
 
         if (is_eof(input))
@@ -780,7 +853,14 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
+    for (;;) {
+        // OPTIMIZATION: Consume runs of spaces and tabs in one go. Newlines still go through next_code_point(), since
+        //               they affect the position.
+        if (auto length = count_leading_ascii_whitespace_without_newlines(remaining_input_bytes()); length > 0)
+            skip_ascii_code_points_without_newlines(length);
+
+        if (!is_whitespace(peek_code_point()))
+            break;
         (void)next_code_point();
     }
 }
@@ -971,6 +1051,14 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Consume runs of ASCII code points that don't end the string and aren't escapes in one go.
+        if (ending_code_point < 0x80) {
+            if (auto length = count_leading_ascii_string_code_points(remaining_input_bytes(), ending_code_point); length > 0) {
+                builder.append(StringView { remaining_input_bytes().trim(length) });
+                skip_ascii_code_points_without_newlines(length);
+            }
+        }
+
         auto input = next_code_point();
 
         // ending code point
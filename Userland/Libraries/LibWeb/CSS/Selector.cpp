@@ -25,6 +25,75 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     }
 
     collect_ancestor_hashes();
+    compile_match_program();
+}
+
+void Selector::compile_match_program()
+{
+    auto rank = [](SimpleSelector const& simple_selector) {
+        switch (simple_selector.type) {
+        case SimpleSelector::Type::Id:
+            return 0;
+        case SimpleSelector::Type::Class:
+            return 1;
+        case SimpleSelector::Type::TagName:
+            return 2;
+        case SimpleSelector::Type::Universal:
+            return 3;
+        case SimpleSelector::Type::Attribute:
+            return 4;
+        default:
+            return 5;
+        }
+    };
+
+    size_t instruction_count = 0;
+    for (auto const& compound_selector : m_compound_selectors)
+        instruction_count += compound_selector.simple_selectors.size() + 1;
+    m_match_program.ensure_capacity(instruction_count);
+
+    for (auto const& compound_selector : m_compound_selectors.in_reverse()) {
+        auto first_instruction_of_compound = m_match_program.size();
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            // NOTE: Pseudo-elements are checked up front by SelectorEngine::matches(), not by the program.
+            if (simple_selector.type == SimpleSelector::Type::PseudoElement)
+                continue;
+            auto type = MatchInstruction::Type::MatchSimpleSelector;
+            if (simple_selector.type == SimpleSelector::Type::Id)
+                type = MatchInstruction::Type::MatchId;
+            else if (simple_selector.type == SimpleSelector::Type::Class)
+                type = MatchInstruction::Type::MatchClass;
+            else if (simple_selector.type == SimpleSelector::Type::TagName)
+                type = MatchInstruction::Type::MatchTagName;
+
+            // Keep the compound's checks sorted by rank, preserving source order within a rank.
+            auto insertion_index = m_match_program.size();
+            while (insertion_index > first_instruction_of_compound && rank(*m_match_program[insertion_index - 1].simple_selector) > rank(simple_selector))
+                --insertion_index;
+            m_match_program.insert(insertion_index, MatchInstruction { type, &simple_selector });
+        }
+
+        switch (compound_selector.combinator) {
+        case Combinator::None:
+            m_match_program.append({ MatchInstruction::Type::Accept });
+            break;
+        case Combinator::Descendant:
+            m_match_program.append({ MatchInstruction::Type::DescendantCombinator });
+            break;
+        case Combinator::ImmediateChild:
+            m_match_program.append({ MatchInstruction::Type::ImmediateChildCombinator });
+            break;
+        case Combinator::NextSibling:
+            m_match_program.append({ MatchInstruction::Type::NextSiblingCombinator });
+            break;
+        case Combinator::SubsequentSibling:
+            m_match_program.append({ MatchInstruction::Type::SubsequentSiblingCombinator });
+            break;
+        case Combinator::Column:
+            m_match_program.append({ MatchInstruction::Type::ColumnCombinator });
+            break;
+        }
+    }
 }
 
 void Selector::collect_ancestor_hashes()
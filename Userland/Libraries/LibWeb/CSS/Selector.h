@@ -244,6 +244,27 @@ public:
 
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
+    // A flattened, right-to-left form of the selector, run by SelectorEngine::fast_matches().
+    // Each compound selector becomes a run of checks, ordered so that the cheapest and most selective ones (id, class,
+    // tag name) come first, followed by one instruction for the combinator to its left.
+    struct MatchInstruction {
+        enum class Type : u8 {
+            MatchId,
+            MatchClass,
+            MatchTagName,
+            MatchSimpleSelector,
+            DescendantCombinator,
+            ImmediateChildCombinator,
+            NextSiblingCombinator,
+            SubsequentSiblingCombinator,
+            ColumnCombinator,
+            Accept,
+        };
+        Type type;
+        SimpleSelector const* simple_selector { nullptr };
+    };
+    Vector<MatchInstruction> const& match_program() const { return m_match_program; }
+
 private:
     explicit Selector(Vector<CompoundSelector>&&);
 
@@ -252,8 +273,10 @@ private:
     Optional<Selector::PseudoElement> m_pseudo_element;
 
     void collect_ancestor_hashes();
+    void compile_match_program();
 
     Array<u32, 8> m_ancestor_hashes;
+    Vector<MatchInstruction> m_match_program;
 };
 
 String serialize_a_group_of_selectors(Vector<NonnullRefPtr<Selector>> const& selectors);
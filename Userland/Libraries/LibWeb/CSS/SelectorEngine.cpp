@@ -806,19 +806,24 @@ bool matches(CSS::Selector const& selector, Optional<CSS::CSSStyleSheet const&>
     return matches(selector, style_sheet_for_rule, selector.compound_selectors().size() - 1, element, shadow_host, scope, selector_kind);
 }
 
+static bool fast_matches_tag_name(CSS::Selector::SimpleSelector const& simple_selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element)
+{
+    if (element.document().document_type() == DOM::Document::Type::HTML) {
+        if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
+            return false;
+    } else if (!Infra::is_ascii_case_insensitive_match(simple_selector.qualified_name().name.name, element.local_name())) {
+        return false;
+    }
+    return matches_namespace(simple_selector.qualified_name(), element, style_sheet_for_rule);
+}
+
 static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, JS::GCPtr<DOM::Element const> shadow_host)
 {
     switch (simple_selector.type) {
     case CSS::Selector::SimpleSelector::Type::Universal:
         return matches_namespace(simple_selector.qualified_name(), element, style_sheet_for_rule);
     case CSS::Selector::SimpleSelector::Type::TagName:
-        if (element.document().document_type() == DOM::Document::Type::HTML) {
-            if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
-                return false;
-        } else if (!Infra::is_ascii_case_insensitive_match(simple_selector.qualified_name().name.name, element.local_name())) {
-            return false;
-        }
-        return matches_namespace(simple_selector.qualified_name(), element, style_sheet_for_rule);
+        return fast_matches_tag_name(simple_selector, style_sheet_for_rule, element);
     case CSS::Selector::SimpleSelector::Type::Class: {
         // Class selectors are matched case insensitively in quirks mode.
         // See: https://drafts.csswg.org/selectors-4/#class-html
@@ -836,59 +841,79 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
     }
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, JS::GCPtr<DOM::Element const> shadow_host)
+// Runs the checks of one compound selector in the match program, starting at `program_counter`.
+// On success, returns the index of the combinator (or accept) instruction that ends the compound.
+static Optional<size_t> fast_matches_compound_selector(ReadonlySpan<CSS::Selector::MatchInstruction> program, size_t program_counter, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element, JS::GCPtr<DOM::Element const> shadow_host)
 {
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, style_sheet_for_rule, element, shadow_host))
-            return false;
+    using Type = CSS::Selector::MatchInstruction::Type;
+    for (;; ++program_counter) {
+        auto const& instruction = program[program_counter];
+        switch (instruction.type) {
+        case Type::MatchId:
+            if (instruction.simple_selector->name() != element.id())
+                return {};
+            break;
+        case Type::MatchClass:
+            if (!element.has_class(instruction.simple_selector->name(), element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive))
+                return {};
+            break;
+        case Type::MatchTagName:
+            if (!fast_matches_tag_name(*instruction.simple_selector, style_sheet_for_rule, element))
+                return {};
+            break;
+        case Type::MatchSimpleSelector:
+            if (!fast_matches_simple_selector(*instruction.simple_selector, style_sheet_for_rule, element, shadow_host))
+                return {};
+            break;
+        default:
+            return program_counter;
+        }
     }
-    return true;
 }
 
 bool fast_matches(CSS::Selector const& selector, Optional<CSS::CSSStyleSheet const&> style_sheet_for_rule, DOM::Element const& element_to_match, JS::GCPtr<DOM::Element const> shadow_host)
 {
-    DOM::Element const* current = &element_to_match;
+    using Type = CSS::Selector::MatchInstruction::Type;
+    auto program = selector.match_program().span();
 
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+    DOM::Element const* current = &element_to_match;
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), style_sheet_for_rule, *current, shadow_host))
+    auto program_counter = fast_matches_compound_selector(program, 0, style_sheet_for_rule, *current, shadow_host);
+    if (!program_counter.has_value())
         return false;
 
     // NOTE: If we fail after following a child combinator, we may need to backtrack
     //       to the last matched descendant. We store the state here.
     struct {
         JS::GCPtr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
+        size_t program_counter = 0;
     } backtrack_state;
 
     for (;;) {
-        // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
-
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
+        auto combinator_index = program_counter.value();
 
-        switch (compound_selector->combinator) {
-        case CSS::Selector::Combinator::None:
+        switch (program[combinator_index].type) {
+        case Type::Accept:
             return true;
-        case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+        case Type::DescendantCombinator:
+            backtrack_state = { current->parent_element(), combinator_index };
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, style_sheet_for_rule, *current, shadow_host))
+                program_counter = fast_matches_compound_selector(program, combinator_index + 1, style_sheet_for_rule, *current, shadow_host);
+                if (program_counter.has_value())
                     break;
             }
             if (!current)
                 return false;
             break;
-        case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+        case Type::ImmediateChildCombinator:
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, style_sheet_for_rule, *current, shadow_host)) {
+            program_counter = fast_matches_compound_selector(program, combinator_index + 1, style_sheet_for_rule, *current, shadow_host);
+            if (!program_counter.has_value()) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
+                    program_counter = backtrack_state.program_counter;
                     continue;
                 }
                 return false;
@@ -5,6 +5,7 @@
  */
 
 #include <LibWeb/CSS/Size.h>
+#include <LibWeb/CSS/StyleValues/CSSMathValue.h>
 
 namespace Web::CSS {
 
@@ -14,6 +15,8 @@ Size::Size(Type type, LengthPercentage length_percentage)
 {
 }
 
+bool Size::operator==(Size const&) const = default;
+
 CSSPixels Size::to_px(Layout::Node const& node, CSSPixels reference_value) const
 {
     return m_length_percentage.resolved(node, reference_value).to_px(node);
@@ -78,6 +78,8 @@ public:
 
     String to_string() const;
 
+    bool operator==(Size const&) const;
+
 private:
     Size(Type type, LengthPercentage);
 
@@ -74,6 +74,7 @@
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Layout/Node.h>
+#include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 #include <LibWeb/MimeSniff/Resource.h>
 #include <LibWeb/Namespace.h>
@@ -439,6 +440,9 @@ Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& e
             continue;
         }
 
+        if (rule_to_run.can_match_siblings_differently)
+            m_matched_rule_can_match_siblings_differently = true;
+
         ++maximum_match_count;
     }
 
@@ -2300,6 +2304,19 @@ RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element,
 
     ScopeGuard guard { [&element]() { element.set_needs_style_update(false); } };
 
+    // OPTIMIZATION: If a preceding sibling is indistinguishable from this element as far as the style rules are
+    //               concerned, we can reuse its computed style instead of running the cascade again.
+    bool const can_share_style = mode == ComputeStyleMode::Normal && !pseudo_element.has_value() && can_share_style_with_siblings(element);
+    if (can_share_style) {
+        if (auto style = find_shared_style(element)) {
+            compute_transitioned_properties(*style, element, pseudo_element);
+            if (auto const* previous_style = element.computed_css_values())
+                start_needed_transitions(*previous_style, *style, element, pseudo_element);
+            return style;
+        }
+        m_matched_rule_can_match_siblings_differently = false;
+    }
+
     auto style = StyleProperties::create();
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
@@ -2362,9 +2379,116 @@ RefPtr<StyleProperties> StyleComputer::compute_style_impl(DOM::Element& element,
         start_needed_transitions(*previous_style, style, element, pseudo_element);
     }
 
+    if (can_share_style && !m_matched_rule_can_match_siblings_differently && !style->animation_name_source() && !style->transition_property_source() && !element.has_associated_animations()) {
+        if (m_style_sharing_candidates.size() == max_style_sharing_candidates)
+            m_style_sharing_candidates.remove(0);
+        m_style_sharing_candidates.append({ element, style->clone() });
+    }
+
     return style;
 }
 
+// NOTE: Siblings share all of their ancestors, so only the compound selector matched against the element itself
+//       can tell two siblings with the same tag name and attributes apart.
+static bool selector_can_match_siblings_differently(CSS::Selector const& selector)
+{
+    auto const& compound_selector = selector.compound_selectors().last();
+    if (compound_selector.combinator == CSS::Selector::Combinator::NextSibling
+        || compound_selector.combinator == CSS::Selector::Combinator::SubsequentSibling
+        || compound_selector.combinator == CSS::Selector::Combinator::Column)
+        return true;
+
+    for (auto const& simple_selector : compound_selector.simple_selectors) {
+        if (simple_selector.type != CSS::Selector::SimpleSelector::Type::PseudoClass)
+            continue;
+        switch (simple_selector.pseudo_class().type) {
+        case CSS::PseudoClass::Is:
+        case CSS::PseudoClass::Where:
+        case CSS::PseudoClass::Not:
+            for (auto const& argument_selector : simple_selector.pseudo_class().argument_selector_list) {
+                if (selector_can_match_siblings_differently(*argument_selector))
+                    return true;
+            }
+            break;
+        // NOTE: Elements in any of these states never share style, see is_affected_by_user_interaction().
+        case CSS::PseudoClass::Active:
+        case CSS::PseudoClass::Focus:
+        case CSS::PseudoClass::FocusVisible:
+        case CSS::PseudoClass::FocusWithin:
+        case CSS::PseudoClass::Hover:
+        case CSS::PseudoClass::Target:
+        case CSS::PseudoClass::TargetWithin:
+        // NOTE: These only depend on the element's attributes and ancestors.
+        case CSS::PseudoClass::AnyLink:
+        case CSS::PseudoClass::Lang:
+        case CSS::PseudoClass::Link:
+        case CSS::PseudoClass::LocalLink:
+        case CSS::PseudoClass::Root:
+        case CSS::PseudoClass::Visited:
+            break;
+        default:
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_affected_by_user_interaction(DOM::Element const& element)
+{
+    auto const& document = element.document();
+    auto contains = [&](DOM::Node const* node) {
+        return node && element.is_shadow_including_inclusive_ancestor_of(*node);
+    };
+    return contains(document.hovered_node())
+        || contains(document.focused_element())
+        || contains(document.active_element())
+        || contains(document.target_element());
+}
+
+bool StyleComputer::can_share_style_with_siblings(DOM::Element const& element) const
+{
+    // NOTE: Style sharing is limited to the tree traversal in progress, where the element has just been pushed
+    //       onto the ancestor filter right after its parent.
+    if (m_ancestors.size() < 2 || m_ancestors.last() != &element || m_ancestors[m_ancestors.size() - 2] != element.parent())
+        return false;
+
+    if (element.namespace_uri() != Namespace::HTML || element.is_document_element() || element.is_shadow_host())
+        return false;
+    if (element.has_attribute(HTML::AttributeNames::style) || element.inline_style())
+        return false;
+    if (element.has_associated_animations() || element.cached_animation_name_animation({}) || element.cached_transition_property_source())
+        return false;
+    return !is_affected_by_user_interaction(element);
+}
+
+RefPtr<StyleProperties> StyleComputer::find_shared_style(DOM::Element& element) const
+{
+    auto has_same_attributes = [](DOM::Element const& a, DOM::Element const& b) {
+        if (a.attribute_list_size() != b.attribute_list_size())
+            return false;
+        bool same = true;
+        a.for_each_attribute([&](DOM::Attr const& attribute) {
+            if (!same)
+                return;
+            same = b.get_attribute_ns(attribute.namespace_uri(), attribute.local_name()) == attribute.value();
+        });
+        return same;
+    };
+
+    for (auto const& candidate : m_style_sharing_candidates.in_reverse()) {
+        auto const& other = *candidate.element;
+        if (other.parent() != element.parent()
+            || other.local_name() != element.local_name()
+            || other.custom_element_state() != element.custom_element_state()
+            || !has_same_attributes(element, other))
+            continue;
+
+        element.set_custom_properties({}, other.custom_properties({}));
+        return candidate.style->clone();
+    }
+    return nullptr;
+}
+
 void StyleComputer::build_rule_cache_if_needed() const
 {
     if (m_author_rule_cache && m_user_rule_cache && m_user_agent_rule_cache)
@@ -2408,161 +2532,209 @@ static Optional<SimplifiedSelectorForBucketing> is_roundabout_selector_bucketabl
     return {};
 }
 
-NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
+void StyleComputer::collect_invalidation_sets(RuleCache& rule_cache, Selector const& selector, InvalidationSet const& subject_invalidation_set)
 {
-    auto rule_cache = make<RuleCache>();
-
-    size_t num_class_rules = 0;
-    size_t num_id_rules = 0;
-    size_t num_tag_name_rules = 0;
-    size_t num_pseudo_element_rules = 0;
-    size_t num_root_rules = 0;
-    size_t num_attribute_rules = 0;
-    size_t num_hover_rules = 0;
+    auto const& compound_selectors = selector.compound_selectors();
+    for (size_t i = 0; i < compound_selectors.size(); ++i) {
+        // NOTE: The combinator to the right of a compound selector tells us whether it's matched against an ancestor
+        //       or a preceding sibling of the subject, and thus which elements a change to the former can affect.
+        InvalidationSet invalidation_set;
+        if (i == compound_selectors.size() - 1) {
+            invalidation_set = subject_invalidation_set;
+        } else {
+            switch (compound_selectors[i + 1].combinator) {
+            case Selector::Combinator::Descendant:
+            case Selector::Combinator::ImmediateChild:
+                invalidation_set.invalidate_descendants = true;
+                break;
+            case Selector::Combinator::NextSibling:
+            case Selector::Combinator::SubsequentSibling:
+                invalidation_set.invalidate_siblings = true;
+                break;
+            default:
+                invalidation_set = InvalidationSet::everything();
+                break;
+            }
+        }
 
-    Vector<MatchingRule> matching_rules;
-    size_t style_sheet_index = 0;
-    for_each_stylesheet(cascade_origin, [&](auto& sheet, JS::GCPtr<DOM::ShadowRoot> shadow_root) {
-        size_t rule_index = 0;
-        sheet.for_each_effective_style_rule([&](auto const& rule) {
-            size_t selector_index = 0;
-            for (CSS::Selector const& selector : rule.selectors()) {
-                MatchingRule matching_rule {
-                    shadow_root,
-                    &rule,
-                    sheet,
-                    style_sheet_index,
-                    rule_index,
-                    selector_index,
-                    selector.specificity(),
-                    cascade_origin,
-                    false,
-                    SelectorEngine::can_use_fast_matches(selector),
-                    false,
-                };
-
-                bool contains_root_pseudo_class = false;
-                Optional<CSS::Selector::PseudoElement::Type> pseudo_element;
+        for (auto const& simple_selector : compound_selectors[i].simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Class:
+                rule_cache.invalidation_sets_by_class.ensure(simple_selector.name()) |= invalidation_set;
+                break;
+            case Selector::SimpleSelector::Type::Id:
+                rule_cache.invalidation_sets_by_id.ensure(simple_selector.name()) |= invalidation_set;
+                break;
+            case Selector::SimpleSelector::Type::Attribute:
+                rule_cache.invalidation_sets_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name) |= invalidation_set;
+                break;
+            case Selector::SimpleSelector::Type::PseudoClass: {
+                // NOTE: Pseudo-classes may depend on any attribute of the element they're matched against.
+                rule_cache.invalidation_set_for_pseudo_classes |= invalidation_set;
+
+                // NOTE: :is(), :where() and :not() match their arguments against the same element. Arguments of other
+                //       pseudo-classes (like :has() or :nth-child(An+B of S)) can refer to elements anywhere around it.
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                auto argument_invalidation_set = first_is_one_of(pseudo_class.type, PseudoClass::Is, PseudoClass::Where, PseudoClass::Not)
+                    ? invalidation_set
+                    : InvalidationSet::everything();
+                for (auto const& argument_selector : pseudo_class.argument_selector_list)
+                    collect_invalidation_sets(rule_cache, *argument_selector, argument_invalidation_set);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+}
 
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                    if (!rule_cache->has_has_selectors && simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == CSS::PseudoClass::Has)
-                        rule_cache->has_has_selectors = true;
-                    if (!matching_rule.contains_pseudo_element) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                            matching_rule.contains_pseudo_element = true;
-                            pseudo_element = simple_selector.pseudo_element().type();
-                            ++num_pseudo_element_rules;
-                        }
-                    }
-                    if (!contains_root_pseudo_class) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
-                            contains_root_pseudo_class = true;
-                            ++num_root_rules;
-                        }
-                    }
+void StyleComputer::add_rule_to_rule_cache(RuleCache& rule_cache, CSSStyleRule const& rule, CSSStyleSheet const& sheet, JS::GCPtr<DOM::ShadowRoot const> shadow_root, CascadeOrigin cascade_origin, size_t style_sheet_index, size_t rule_index)
+{
+    size_t selector_index = 0;
+    for (CSS::Selector const& selector : rule.selectors()) {
+        MatchingRule matching_rule {
+            shadow_root,
+            &rule,
+            sheet,
+            style_sheet_index,
+            rule_index,
+            selector_index,
+            selector.specificity(),
+            cascade_origin,
+            false,
+            SelectorEngine::can_use_fast_matches(selector),
+            false,
+        };
+        matching_rule.can_match_siblings_differently = selector_can_match_siblings_differently(selector);
+        collect_invalidation_sets(rule_cache, selector, { .invalidate_self = true });
+
+        bool contains_root_pseudo_class = false;
+        Optional<CSS::Selector::PseudoElement::Type> pseudo_element;
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+            if (!rule_cache.has_has_selectors && simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == CSS::PseudoClass::Has)
+                rule_cache.has_has_selectors = true;
+            if (!matching_rule.contains_pseudo_element) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
+                    matching_rule.contains_pseudo_element = true;
+                    pseudo_element = simple_selector.pseudo_element().type();
+                }
+            }
+            if (!contains_root_pseudo_class) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
+                    contains_root_pseudo_class = true;
+                }
+            }
 
-                    if (!matching_rule.must_be_hovered) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
+            if (!matching_rule.must_be_hovered) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
+                    matching_rule.must_be_hovered = true;
+                }
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && (simple_selector.pseudo_class().type == CSS::PseudoClass::Is
+                        || simple_selector.pseudo_class().type == CSS::PseudoClass::Where)) {
+                    auto const& argument_selectors = simple_selector.pseudo_class().argument_selector_list;
+
+                    if (argument_selectors.size() == 1) {
+                        auto const& simple_argument_selector = argument_selectors.first()->compound_selectors().last().simple_selectors.last();
+                        if (simple_argument_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                            && simple_argument_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
                             matching_rule.must_be_hovered = true;
-                            ++num_hover_rules;
-                        }
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && (simple_selector.pseudo_class().type == CSS::PseudoClass::Is
-                                || simple_selector.pseudo_class().type == CSS::PseudoClass::Where)) {
-                            auto const& argument_selectors = simple_selector.pseudo_class().argument_selector_list;
-
-                            if (argument_selectors.size() == 1) {
-                                auto const& simple_argument_selector = argument_selectors.first()->compound_selectors().last().simple_selectors.last();
-                                if (simple_argument_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                                    && simple_argument_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
-                                    matching_rule.must_be_hovered = true;
-                                    ++num_hover_rules;
-                                }
-                            }
                         }
                     }
                 }
+            }
+        }
 
-                // NOTE: We traverse the simple selectors in reverse order to make sure that class/ID buckets are preferred over tag buckets
-                //       in the common case of div.foo or div#foo selectors.
-                bool added_to_bucket = false;
-
-                auto add_to_id_bucket = [&](FlyString const& name) {
-                    rule_cache->rules_by_id.ensure(name).append(move(matching_rule));
-                    ++num_id_rules;
-                    added_to_bucket = true;
-                };
-
-                auto add_to_class_bucket = [&](FlyString const& name) {
-                    rule_cache->rules_by_class.ensure(name).append(move(matching_rule));
-                    ++num_class_rules;
-                    added_to_bucket = true;
-                };
-
-                auto add_to_tag_name_bucket = [&](FlyString const& name) {
-                    rule_cache->rules_by_tag_name.ensure(name).append(move(matching_rule));
-                    ++num_tag_name_rules;
-                    added_to_bucket = true;
-                };
-
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors.in_reverse()) {
-                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
-                        add_to_id_bucket(simple_selector.name());
-                        break;
-                    }
-                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
-                        add_to_class_bucket(simple_selector.name());
-                        break;
-                    }
-                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
-                        add_to_tag_name_bucket(simple_selector.qualified_name().name.lowercase_name);
+        // NOTE: We traverse the simple selectors in reverse order to make sure that class/ID buckets are preferred over tag buckets
+        //       in the common case of div.foo or div#foo selectors.
+        bool added_to_bucket = false;
+
+        auto add_to_id_bucket = [&](FlyString const& name) {
+            rule_cache.rules_by_id.ensure(name).append(move(matching_rule));
+            added_to_bucket = true;
+        };
+
+        auto add_to_class_bucket = [&](FlyString const& name) {
+            rule_cache.rules_by_class.ensure(name).append(move(matching_rule));
+            added_to_bucket = true;
+        };
+
+        auto add_to_tag_name_bucket = [&](FlyString const& name) {
+            rule_cache.rules_by_tag_name.ensure(name).append(move(matching_rule));
+            added_to_bucket = true;
+        };
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors.in_reverse()) {
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
+                add_to_id_bucket(simple_selector.name());
+                break;
+            }
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
+                add_to_class_bucket(simple_selector.name());
+                break;
+            }
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
+                add_to_tag_name_bucket(simple_selector.qualified_name().name.lowercase_name);
+                break;
+            }
+            // NOTE: Selectors like `:is/where(.foo)` and `:is/where(.foo .bar)` are bucketed as class selectors for `foo` and `bar` respectively.
+            if (auto simplified = is_roundabout_selector_bucketable_as_something_simpler(simple_selector); simplified.has_value()) {
+                if (simplified->type == CSS::Selector::SimpleSelector::Type::TagName) {
+                    add_to_tag_name_bucket(simplified->name);
+                    break;
+                }
+                if (simplified->type == CSS::Selector::SimpleSelector::Type::Class) {
+                    add_to_class_bucket(simplified->name);
+                    break;
+                }
+                if (simplified->type == CSS::Selector::SimpleSelector::Type::Id) {
+                    add_to_id_bucket(simplified->name);
+                    break;
+                }
+            }
+        }
+        if (!added_to_bucket) {
+            if (matching_rule.contains_pseudo_element) {
+                if (to_underlying(pseudo_element.value()) < to_underlying(CSS::Selector::PseudoElement::Type::KnownPseudoElementCount)) {
+                    rule_cache.rules_by_pseudo_element[to_underlying(pseudo_element.value())].append(move(matching_rule));
+                } else {
+                    // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
+                }
+            } else if (contains_root_pseudo_class) {
+                rule_cache.root_rules.append(move(matching_rule));
+            } else {
+                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
+                        rule_cache.rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(move(matching_rule));
+                        added_to_bucket = true;
                         break;
                     }
-                    // NOTE: Selectors like `:is/where(.foo)` and `:is/where(.foo .bar)` are bucketed as class selectors for `foo` and `bar` respectively.
-                    if (auto simplified = is_roundabout_selector_bucketable_as_something_simpler(simple_selector); simplified.has_value()) {
-                        if (simplified->type == CSS::Selector::SimpleSelector::Type::TagName) {
-                            add_to_tag_name_bucket(simplified->name);
-                            break;
-                        }
-                        if (simplified->type == CSS::Selector::SimpleSelector::Type::Class) {
-                            add_to_class_bucket(simplified->name);
-                            break;
-                        }
-                        if (simplified->type == CSS::Selector::SimpleSelector::Type::Id) {
-                            add_to_id_bucket(simplified->name);
-                            break;
-                        }
-                    }
                 }
                 if (!added_to_bucket) {
-                    if (matching_rule.contains_pseudo_element) {
-                        if (to_underlying(pseudo_element.value()) < to_underlying(CSS::Selector::PseudoElement::Type::KnownPseudoElementCount)) {
-                            rule_cache->rules_by_pseudo_element[to_underlying(pseudo_element.value())].append(move(matching_rule));
-                        } else {
-                            // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
-                        }
-                    } else if (contains_root_pseudo_class) {
-                        rule_cache->root_rules.append(move(matching_rule));
-                    } else {
-                        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
-                                rule_cache->rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(move(matching_rule));
-                                ++num_attribute_rules;
-                                added_to_bucket = true;
-                                break;
-                            }
-                        }
-                        if (!added_to_bucket) {
-                            rule_cache->other_rules.append(move(matching_rule));
-                        }
-                    }
+                    rule_cache.other_rules.append(move(matching_rule));
                 }
-
-                ++selector_index;
             }
+        }
+
+        ++selector_index;
+    }
+}
+
+NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
+{
+    auto rule_cache = make<RuleCache>();
+
+    size_t style_sheet_index = 0;
+    for_each_stylesheet(cascade_origin, [&](auto& sheet, JS::GCPtr<DOM::ShadowRoot> shadow_root) {
+        size_t rule_index = 0;
+        sheet.for_each_effective_style_rule([&](auto const& rule) {
+            add_rule_to_rule_cache(*rule_cache, rule, sheet, shadow_root, cascade_origin, style_sheet_index, rule_index);
             ++rule_index;
         });
+        rule_cache->style_sheets.set(&sheet, { shadow_root, style_sheet_index, rule_index });
 
         // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
         sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
@@ -2600,8 +2772,23 @@ NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_casca
         ++style_sheet_index;
     });
 
-    size_t total_rules = num_class_rules + num_id_rules + num_tag_name_rules + num_pseudo_element_rules + num_root_rules + num_attribute_rules + rule_cache->other_rules.size();
     if constexpr (LIBWEB_CSS_DEBUG) {
+        auto count_rules = [](auto const& buckets) {
+            size_t count = 0;
+            for (auto const& bucket : buckets)
+                count += bucket.value.size();
+            return count;
+        };
+        size_t num_id_rules = count_rules(rule_cache->rules_by_id);
+        size_t num_class_rules = count_rules(rule_cache->rules_by_class);
+        size_t num_tag_name_rules = count_rules(rule_cache->rules_by_tag_name);
+        size_t num_attribute_rules = count_rules(rule_cache->rules_by_attribute_name);
+        size_t num_pseudo_element_rules = 0;
+        for (auto const& rules : rule_cache->rules_by_pseudo_element)
+            num_pseudo_element_rules += rules.size();
+        size_t num_root_rules = rule_cache->root_rules.size();
+        size_t total_rules = num_class_rules + num_id_rules + num_tag_name_rules + num_pseudo_element_rules + num_root_rules + num_attribute_rules + rule_cache->other_rules.size();
+
         dbgln("Built rule cache!");
         dbgln("           ID: {}", num_id_rules);
         dbgln("        Class: {}", num_class_rules);
@@ -2685,15 +2872,20 @@ void StyleComputer::build_qualified_layer_names_cache()
 
 void StyleComputer::build_rule_cache()
 {
-    if (auto user_style_source = document().page().user_style(); user_style_source.has_value()) {
-        m_user_style_sheet = JS::make_handle(parse_css_stylesheet(CSS::Parser::ParsingContext(document()), user_style_source.value()));
+    if (!m_author_rule_cache) {
+        build_qualified_layer_names_cache();
+        m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
     }
 
-    build_qualified_layer_names_cache();
+    if (!m_user_rule_cache) {
+        if (auto user_style_source = document().page().user_style(); user_style_source.has_value()) {
+            m_user_style_sheet = JS::make_handle(parse_css_stylesheet(CSS::Parser::ParsingContext(document()), user_style_source.value()));
+        }
+        m_user_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::User);
+    }
 
-    m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
-    m_user_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::User);
-    m_user_agent_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent);
+    if (!m_user_agent_rule_cache)
+        m_user_agent_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent);
 
     m_has_has_selectors = m_author_rule_cache->has_has_selectors || m_user_rule_cache->has_has_selectors || m_user_agent_rule_cache->has_has_selectors;
 }
@@ -2708,14 +2900,63 @@ void StyleComputer::invalidate_rule_cache()
     m_user_rule_cache = nullptr;
     m_user_style_sheet = nullptr;
 
-    // NOTE: It might not be necessary to throw away the UA rule cache.
-    //       If we are sure that it's safe, we could keep it as an optimization.
     m_user_agent_rule_cache = nullptr;
 }
 
+void StyleComputer::invalidate_author_rule_cache()
+{
+    // NOTE: Author style sheets don't affect the user or user agent rule caches, so we keep those around.
+    m_author_rule_cache = nullptr;
+}
+
+void StyleComputer::did_insert_rule(CSSStyleSheet const& sheet, CSSRule const& rule, size_t index)
+{
+    // OPTIMIZATION: A style rule appended to the end of a style sheet comes after all of the sheet's other rules in
+    //               cascade order, so we can add it to the existing rule cache. This is how CSS-in-JS libraries
+    //               typically inject their rules, one at a time.
+    if (m_author_rule_cache && rule.type() == CSSRule::Type::Style && index + 1 == sheet.rules().length() && sheet.media()->matches()) {
+        if (auto it = m_author_rule_cache->style_sheets.find(&sheet); it != m_author_rule_cache->style_sheets.end()) {
+            auto& style_sheet_info = it->value;
+            add_rule_to_rule_cache(*m_author_rule_cache, static_cast<CSSStyleRule const&>(rule), sheet, style_sheet_info.shadow_root, CascadeOrigin::Author, style_sheet_info.style_sheet_index, style_sheet_info.next_rule_index++);
+            m_has_has_selectors |= m_author_rule_cache->has_has_selectors;
+            return;
+        }
+    }
+    invalidate_author_rule_cache();
+}
+
+void StyleComputer::did_delete_rule(CSSStyleSheet const& sheet, CSSRule const& rule)
+{
+    // OPTIMIZATION: Removing a style rule doesn't change the cascade order of the remaining rules, so we can just
+    //               drop it from the rule cache buckets.
+    //               The invalidation sets and the :has() flag are left as they are, which is merely conservative.
+    if (m_author_rule_cache && rule.type() == CSSRule::Type::Style && m_author_rule_cache->style_sheets.contains(&sheet)) {
+        auto& rule_cache = *m_author_rule_cache;
+        auto remove_rule = [&](Vector<MatchingRule>& rules) {
+            rules.remove_all_matching([&](auto const& matching_rule) { return matching_rule.rule.ptr() == &rule; });
+        };
+        for (auto& it : rule_cache.rules_by_id)
+            remove_rule(it.value);
+        for (auto& it : rule_cache.rules_by_class)
+            remove_rule(it.value);
+        for (auto& it : rule_cache.rules_by_tag_name)
+            remove_rule(it.value);
+        for (auto& it : rule_cache.rules_by_attribute_name)
+            remove_rule(it.value);
+        for (auto& rules : rule_cache.rules_by_pseudo_element)
+            remove_rule(rules);
+        remove_rule(rule_cache.root_rules);
+        remove_rule(rule_cache.other_rules);
+        return;
+    }
+    invalidate_author_rule_cache();
+}
+
 void StyleComputer::did_load_font(FlyString const&)
 {
     document().invalidate_style(DOM::StyleInvalidationReason::CSSFontLoaded);
+    if (auto* layout_root = document().layout_node())
+        layout_root->invalidate_all_intrinsic_sizes();
 }
 
 Optional<FontLoader&> StyleComputer::load_font_face(ParsedFontFace const& font_face, Function<void(FontLoader const&)> on_load, Function<void()> on_fail)
@@ -2846,9 +3087,54 @@ static void for_each_element_hash(DOM::Element const& element, auto callback)
     });
 }
 
+template<typename Map>
+static void add_invalidation_set(InvalidationSet& invalidation_set, Map const& map, FlyString const& name)
+{
+    if (auto it = map.find(name); it != map.end())
+        invalidation_set |= it->value;
+}
+
+InvalidationSet StyleComputer::invalidation_set_for_class_name(FlyString const& class_name) const
+{
+    build_rule_cache_if_needed();
+    InvalidationSet invalidation_set;
+    for (auto const* rule_cache : { m_author_rule_cache.ptr(), m_user_rule_cache.ptr(), m_user_agent_rule_cache.ptr() })
+        add_invalidation_set(invalidation_set, rule_cache->invalidation_sets_by_class, class_name);
+    return invalidation_set;
+}
+
+InvalidationSet StyleComputer::invalidation_set_for_id(FlyString const& id) const
+{
+    build_rule_cache_if_needed();
+    InvalidationSet invalidation_set;
+    for (auto const* rule_cache : { m_author_rule_cache.ptr(), m_user_rule_cache.ptr(), m_user_agent_rule_cache.ptr() })
+        add_invalidation_set(invalidation_set, rule_cache->invalidation_sets_by_id, id);
+    return invalidation_set;
+}
+
+InvalidationSet StyleComputer::invalidation_set_for_attribute_name(FlyString const& attribute_name) const
+{
+    build_rule_cache_if_needed();
+    InvalidationSet invalidation_set;
+    for (auto const* rule_cache : { m_author_rule_cache.ptr(), m_user_rule_cache.ptr(), m_user_agent_rule_cache.ptr() })
+        add_invalidation_set(invalidation_set, rule_cache->invalidation_sets_by_attribute_name, attribute_name);
+    return invalidation_set;
+}
+
+InvalidationSet StyleComputer::invalidation_set_for_pseudo_classes() const
+{
+    build_rule_cache_if_needed();
+    InvalidationSet invalidation_set;
+    for (auto const* rule_cache : { m_author_rule_cache.ptr(), m_user_rule_cache.ptr(), m_user_agent_rule_cache.ptr() })
+        invalidation_set |= rule_cache->invalidation_set_for_pseudo_classes;
+    return invalidation_set;
+}
+
 void StyleComputer::reset_ancestor_filter()
 {
     m_ancestor_filter.clear();
+    m_ancestors.clear();
+    m_style_sharing_candidates.clear();
 }
 
 void StyleComputer::push_ancestor(DOM::Element const& element)
@@ -2856,6 +3142,7 @@ void StyleComputer::push_ancestor(DOM::Element const& element)
     for_each_element_hash(element, [&](u32 hash) {
         m_ancestor_filter.increment(hash);
     });
+    m_ancestors.append(&element);
 }
 
 void StyleComputer::pop_ancestor(DOM::Element const& element)
@@ -2863,6 +3150,13 @@ void StyleComputer::pop_ancestor(DOM::Element const& element)
     for_each_element_hash(element, [&](u32 hash) {
         m_ancestor_filter.decrement(hash);
     });
+    if (!m_ancestors.is_empty())
+        m_ancestors.take_last();
+
+    // The children of this element are done, so none of them can share style with anything else.
+    m_style_sharing_candidates.remove_all_matching([&](auto const& candidate) {
+        return candidate.element->parent() == &element;
+    });
 }
 
 size_t StyleComputer::number_of_css_font_faces_with_loading_in_progress() const
@@ -16,6 +16,7 @@
 #include <LibWeb/CSS/CSSKeyframesRule.h>
 #include <LibWeb/CSS/CSSStyleDeclaration.h>
 #include <LibWeb/CSS/Selector.h>
+#include <LibWeb/CSS/StyleInvalidation.h>
 #include <LibWeb/CSS/StyleProperties.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -93,6 +94,7 @@ struct MatchingRule {
     bool contains_pseudo_element { false };
     bool can_use_fast_matches { false };
     bool must_be_hovered { false };
+    bool can_match_siblings_differently { false };
     bool skip { false };
 };
 
@@ -137,6 +139,9 @@ public:
     Vector<MatchingRule> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>, FlyString const& qualified_layer_name = {}) const;
 
     void invalidate_rule_cache();
+    void invalidate_author_rule_cache();
+    void did_insert_rule(CSSStyleSheet const&, CSSRule const&, size_t index);
+    void did_delete_rule(CSSStyleSheet const&, CSSRule const&);
 
     Gfx::Font const& initial_font() const;
 
@@ -159,6 +164,11 @@ public:
 
     [[nodiscard]] bool has_has_selectors() const { return m_has_has_selectors; }
 
+    [[nodiscard]] InvalidationSet invalidation_set_for_class_name(FlyString const&) const;
+    [[nodiscard]] InvalidationSet invalidation_set_for_id(FlyString const&) const;
+    [[nodiscard]] InvalidationSet invalidation_set_for_attribute_name(FlyString const&) const;
+    [[nodiscard]] InvalidationSet invalidation_set_for_pseudo_classes() const;
+
     size_t number_of_css_font_faces_with_loading_in_progress() const;
 
 private:
@@ -171,6 +181,9 @@ private:
 
     [[nodiscard]] bool should_reject_with_ancestor_filter(Selector const&) const;
 
+    [[nodiscard]] bool can_share_style_with_siblings(DOM::Element const&) const;
+    [[nodiscard]] RefPtr<StyleProperties> find_shared_style(DOM::Element&) const;
+
     RefPtr<StyleProperties> compute_style_impl(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, ComputeStyleMode) const;
     void compute_cascaded_values(StyleProperties&, DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, bool& did_match_any_pseudo_element_rules, ComputeStyleMode) const;
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_ascending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
@@ -227,10 +240,28 @@ private:
 
         HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
+        // NOTE: For each class, id and attribute name referenced by a selector, which elements may need their style
+        //       recomputed when it changes on an element.
+        HashMap<FlyString, InvalidationSet> invalidation_sets_by_class;
+        HashMap<FlyString, InvalidationSet> invalidation_sets_by_id;
+        HashMap<FlyString, InvalidationSet, AK::ASCIICaseInsensitiveFlyStringTraits> invalidation_sets_by_attribute_name;
+        InvalidationSet invalidation_set_for_pseudo_classes;
+
         bool has_has_selectors { false };
+
+        // NOTE: Where the rules of each style sheet live in cascade order, so that rules appended to a style sheet
+        //       can be added without rebuilding the whole cache.
+        struct StyleSheetInfo {
+            JS::GCPtr<DOM::ShadowRoot const> shadow_root;
+            size_t style_sheet_index { 0 };
+            size_t next_rule_index { 0 };
+        };
+        HashMap<CSSStyleSheet const*, StyleSheetInfo> style_sheets;
     };
 
     NonnullOwnPtr<RuleCache> make_rule_cache_for_cascade_origin(CascadeOrigin);
+    static void add_rule_to_rule_cache(RuleCache&, CSSStyleRule const&, CSSStyleSheet const&, JS::GCPtr<DOM::ShadowRoot const>, CascadeOrigin, size_t style_sheet_index, size_t rule_index);
+    static void collect_invalidation_sets(RuleCache&, Selector const&, InvalidationSet const& subject_invalidation_set);
 
     RuleCache const& rule_cache_for_cascade_origin(CascadeOrigin) const;
 
@@ -249,6 +280,17 @@ private:
     CSSPixelRect m_viewport_rect;
 
     CountingBloomFilter<u8, 14> m_ancestor_filter;
+    Vector<DOM::Element const*> m_ancestors;
+
+    // NOTE: Recently styled siblings whose computed style can be reused by a following sibling with the same
+    //       tag name and attributes. Siblings share their ancestors, and thus the state of the ancestor filter.
+    struct StyleSharingCandidate {
+        JS::NonnullGCPtr<DOM::Element const> element;
+        NonnullRefPtr<StyleProperties> style;
+    };
+    static constexpr size_t max_style_sharing_candidates = 16;
+    mutable Vector<StyleSharingCandidate, max_style_sharing_candidates> m_style_sharing_candidates;
+    mutable bool m_matched_rule_can_match_siblings_differently { false };
 };
 
 class FontLoader : public ResourceClient {
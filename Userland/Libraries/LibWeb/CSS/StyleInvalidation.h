@@ -29,6 +29,24 @@ struct RequiredInvalidationAfterStyleChange {
     static RequiredInvalidationAfterStyleChange full() { return { true, true, true, true }; }
 };
 
+// Which elements may need their style recomputed when a class, id or attribute referenced by some selector changes on an element.
+// NOTE: Invalidating the element itself also invalidates its descendants, since they may inherit style from it.
+struct InvalidationSet {
+    bool invalidate_self : 1 { false };
+    bool invalidate_descendants : 1 { false };
+    bool invalidate_siblings : 1 { false };
+
+    void operator|=(InvalidationSet const& other)
+    {
+        invalidate_self |= other.invalidate_self;
+        invalidate_descendants |= other.invalidate_descendants;
+        invalidate_siblings |= other.invalidate_siblings;
+    }
+
+    [[nodiscard]] bool is_empty() const { return !invalidate_self && !invalidate_descendants && !invalidate_siblings; }
+    static InvalidationSet everything() { return { true, true, true }; }
+};
+
 RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::PropertyID property_id, RefPtr<CSSStyleValue const> const& old_value, RefPtr<CSSStyleValue const> const& new_value);
 
 }
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/DataView.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/Bindings/CompressionStreamPrototype.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Compression/CompressionStream.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/TransformStream.h>
+#include <LibWeb/Streams/TransformStreamDefaultController.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Compression {
+
+JS_DEFINE_ALLOCATOR(CompressionStream);
+
+static ErrorOr<void> write_gzip_header(Stream& stream)
+{
+    Compress::BlockHeader header {};
+    header.identification_1 = Compress::gzip_magic_1;
+    header.identification_2 = Compress::gzip_magic_2;
+    header.compression_method = 0x08; // DEFLATE
+    header.flags = 0;
+    header.modification_time = 0;
+    header.extra_flags = 0;
+    header.operating_system = 255; // unknown
+    return stream.write_until_depleted({ &header, sizeof(header) });
+}
+
+// https://compression.spec.whatwg.org/#dom-compressionstream-compressionstream
+WebIDL::ExceptionOr<JS::NonnullGCPtr<CompressionStream>> CompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
+{
+    // 1. If format is unsupported in CompressionStream, then throw a TypeError.
+    if (format == Bindings::CompressionFormat::Brotli)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Brotli is not supported in CompressionStream"sv };
+
+    // 2. Set this's format to format.
+    auto output = make<AllocatingMemoryStream>();
+
+    auto compressor = [&]() -> ErrorOr<Compressor> {
+        switch (format) {
+        case Bindings::CompressionFormat::Deflate:
+            return TRY(Compress::ZlibCompressor::construct(MaybeOwned<Stream> { *output }));
+        case Bindings::CompressionFormat::DeflateRaw:
+            return TRY(Compress::DeflateCompressor::construct(MaybeOwned<Stream> { *output }));
+        case Bindings::CompressionFormat::Gzip:
+            TRY(write_gzip_header(*output));
+            return TRY(Compress::DeflateCompressor::construct(MaybeOwned<Stream> { *output }));
+        case Bindings::CompressionFormat::Brotli:
+            break;
+        }
+        VERIFY_NOT_REACHED();
+    }();
+    if (compressor.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to create compressor: {}", compressor.error())) };
+
+    // 5. Set this's transform to a new TransformStream.
+    auto transform = realm.heap().allocate<Streams::TransformStream>(realm, realm);
+    auto stream = realm.heap().allocate<CompressionStream>(realm, realm, transform, format, move(output), compressor.release_value());
+
+    // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the compress and enqueue a chunk
+    //    algorithm with this and chunk.
+    auto transform_algorithm = JS::create_heap_function(realm.heap(), [stream](JS::Value chunk) -> JS::NonnullGCPtr<WebIDL::Promise> {
+        auto& realm = stream->realm();
+
+        if (auto result = stream->compress_and_enqueue_chunk(chunk); result.is_error()) {
+            auto throw_completion = Bindings::dom_exception_to_throw_completion(realm.vm(), result.release_error());
+            return WebIDL::create_rejected_promise(realm, throw_completion.value().value());
+        }
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+
+    // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the compress flush and enqueue algorithm
+    //    with this.
+    auto flush_algorithm = JS::create_heap_function(realm.heap(), [stream]() -> JS::NonnullGCPtr<WebIDL::Promise> {
+        auto& realm = stream->realm();
+
+        if (auto result = stream->compress_flush_and_enqueue(); result.is_error()) {
+            auto throw_completion = Bindings::dom_exception_to_throw_completion(realm.vm(), result.release_error());
+            return WebIDL::create_rejected_promise(realm, throw_completion.value().value());
+        }
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+
+    // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
+    Streams::transform_stream_set_up(transform, transform_algorithm, flush_algorithm);
+
+    return stream;
+}
+
+CompressionStream::CompressionStream(JS::Realm& realm, JS::NonnullGCPtr<Streams::TransformStream> transform, Bindings::CompressionFormat format, NonnullOwnPtr<AllocatingMemoryStream> output, Compressor compressor)
+    : Bindings::PlatformObject(realm)
+    , Streams::GenericTransformStreamMixin(transform)
+    , m_format(format)
+    , m_output(move(output))
+    , m_compressor(move(compressor))
+{
+}
+
+CompressionStream::~CompressionStream()
+{
+    // The compressors insist on being finished before they are destroyed, which is not the case if the stream was
+    // errored or simply dropped before it was closed.
+    if (!m_finished)
+        (void)finish();
+}
+
+void CompressionStream::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(CompressionStream);
+}
+
+void CompressionStream::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    Streams::GenericTransformStreamMixin::visit_edges(visitor);
+}
+
+// https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
+WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
+{
+    auto& vm = this->vm();
+
+    // 1. If chunk is not a BufferSource type, then throw a TypeError.
+    if (!chunk.is_object() || !(is<JS::TypedArrayBase>(chunk.as_object()) || is<JS::ArrayBuffer>(chunk.as_object()) || is<JS::DataView>(chunk.as_object())))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
+
+    // 2. Let buffer be the result of compressing chunk with cs's format and context.
+    auto data = TRY_OR_THROW_OOM(vm, WebIDL::get_buffer_source_copy(chunk.as_object()));
+
+    if (auto result = compress(data); result.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", result.error())) };
+
+    // 3. If buffer is empty, return.
+    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // 5. For each Uint8Array array, enqueue array in cs's transform.
+    return enqueue_pending_output();
+}
+
+// https://compression.spec.whatwg.org/#compress-flush-and-enqueue
+WebIDL::ExceptionOr<void> CompressionStream::compress_flush_and_enqueue()
+{
+    // 1. Let buffer be the result of compressing an empty input with cs's format and context, with the finish flag.
+    if (auto result = finish(); result.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", result.error())) };
+
+    // 2. If buffer is empty, return.
+    // 3. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // 4. For each Uint8Array array, enqueue array in cs's transform.
+    return enqueue_pending_output();
+}
+
+ErrorOr<void> CompressionStream::compress(ReadonlyBytes bytes)
+{
+    TRY(m_compressor.visit([&](auto const& compressor) {
+        return compressor->write_until_depleted(bytes);
+    }));
+
+    if (m_format == Bindings::CompressionFormat::Gzip) {
+        m_crc32.update(bytes);
+        m_input_size += bytes.size();
+    }
+
+    return {};
+}
+
+ErrorOr<void> CompressionStream::finish()
+{
+    VERIFY(!m_finished);
+    m_finished = true;
+
+    TRY(m_compressor.visit(
+        [](NonnullOwnPtr<Compress::ZlibCompressor> const& compressor) { return compressor->finish(); },
+        [](NonnullOwnPtr<Compress::DeflateCompressor> const& compressor) { return compressor->final_flush(); }));
+
+    if (m_format == Bindings::CompressionFormat::Gzip) {
+        TRY(m_output->write_value<LittleEndian<u32>>(m_crc32.digest()));
+        TRY(m_output->write_value<LittleEndian<u32>>(m_input_size));
+    }
+
+    return {};
+}
+
+WebIDL::ExceptionOr<void> CompressionStream::enqueue_pending_output()
+{
+    auto& realm = this->realm();
+    auto& vm = this->vm();
+
+    auto size = m_output->used_buffer_size();
+    if (size == 0)
+        return {};
+
+    auto buffer = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
+    TRY_OR_THROW_OOM(vm, m_output->read_until_filled(buffer));
+
+    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+    auto array = JS::Uint8Array::create(realm, size, *array_buffer);
+
+    return Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array);
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/MemoryStream.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Variant.h>
+#include <LibCompress/Deflate.h>
+#include <LibCompress/Gzip.h>
+#include <LibCompress/Zlib.h>
+#include <LibCrypto/Checksum/CRC32.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Bindings/CompressionStreamPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Streams/GenericTransformStream.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::Compression {
+
+// https://compression.spec.whatwg.org/#compressionstream
+class CompressionStream final
+    : public Bindings::PlatformObject
+    , public Streams::GenericTransformStreamMixin {
+    WEB_PLATFORM_OBJECT(CompressionStream, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(CompressionStream);
+
+public:
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<CompressionStream>> construct_impl(JS::Realm&, Bindings::CompressionFormat);
+    virtual ~CompressionStream() override;
+
+private:
+    using Compressor = Variant<NonnullOwnPtr<Compress::ZlibCompressor>, NonnullOwnPtr<Compress::DeflateCompressor>>;
+
+    CompressionStream(JS::Realm&, JS::NonnullGCPtr<Streams::TransformStream>, Bindings::CompressionFormat, NonnullOwnPtr<AllocatingMemoryStream>, Compressor);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    WebIDL::ExceptionOr<void> compress_and_enqueue_chunk(JS::Value);
+    WebIDL::ExceptionOr<void> compress_flush_and_enqueue();
+
+    ErrorOr<void> compress(ReadonlyBytes);
+    ErrorOr<void> finish();
+    WebIDL::ExceptionOr<void> enqueue_pending_output();
+
+    // https://compression.spec.whatwg.org/#compressionstream-format
+    Bindings::CompressionFormat m_format;
+
+    // https://compression.spec.whatwg.org/#compressionstream-context
+    // NOTE: The compressors write into m_output as soon as they have completed a block, which is then drained into
+    //       the transform's readable side after every chunk.
+    NonnullOwnPtr<AllocatingMemoryStream> m_output;
+    Compressor m_compressor;
+    bool m_finished { false };
+
+    // The gzip framing is written by hand around the raw DEFLATE output, as Compress::GzipCompressor emits a complete
+    // gzip member for every write.
+    ::Crypto::Checksum::CRC32 m_crc32;
+    u32 m_input_size { 0 };
+};
+
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitStream.h>
+#include <LibCompress/Brotli.h>
+#include <LibCompress/Deflate.h>
+#include <LibCompress/Gzip.h>
+#include <LibCompress/Zlib.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/DataView.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/Bindings/DecompressionStreamPrototype.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Compression/DecompressionStream.h>
+#include <LibWeb/Streams/AbstractOperations.h>
+#include <LibWeb/Streams/TransformStream.h>
+#include <LibWeb/Streams/TransformStreamDefaultController.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Compression {
+
+JS_DEFINE_ALLOCATOR(DecompressionStream);
+
+// LibCompress' decompressors pull their input out of a stream, and cannot pick up where they left off if that stream
+// runs dry in the middle of a block. Until the input has ended, we therefore only decompress while enough input is
+// buffered for the next slice of output to be decoded in full. This comfortably covers a DEFLATE block filling the
+// decompressor's 32 KiB window with 15-bit literals.
+static constexpr size_t MINIMUM_BUFFERED_INPUT_SIZE = 128 * KiB;
+static constexpr size_t OUTPUT_SLICE_SIZE = 4 * KiB;
+
+// https://compression.spec.whatwg.org/#dom-decompressionstream-decompressionstream
+WebIDL::ExceptionOr<JS::NonnullGCPtr<DecompressionStream>> DecompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
+{
+    // 1. If format is unsupported in DecompressionStream, then throw a TypeError.
+    // NOTE: All formats are supported for decompression.
+
+    // 2. Set this's format to format.
+    // 5. Set this's transform to a new TransformStream.
+    auto transform = realm.heap().allocate<Streams::TransformStream>(realm, realm);
+    auto stream = realm.heap().allocate<DecompressionStream>(realm, realm, transform, format);
+
+    // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the decompress and enqueue a
+    //    chunk algorithm with this and chunk.
+    auto transform_algorithm = JS::create_heap_function(realm.heap(), [stream](JS::Value chunk) -> JS::NonnullGCPtr<WebIDL::Promise> {
+        auto& realm = stream->realm();
+
+        if (auto result = stream->decompress_and_enqueue_chunk(chunk); result.is_error()) {
+            auto throw_completion = Bindings::dom_exception_to_throw_completion(realm.vm(), result.release_error());
+            return WebIDL::create_rejected_promise(realm, throw_completion.value().value());
+        }
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+
+    // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the decompress flush and enqueue
+    //    algorithm with this.
+    auto flush_algorithm = JS::create_heap_function(realm.heap(), [stream]() -> JS::NonnullGCPtr<WebIDL::Promise> {
+        auto& realm = stream->realm();
+
+        if (auto result = stream->decompress_flush_and_enqueue(); result.is_error()) {
+            auto throw_completion = Bindings::dom_exception_to_throw_completion(realm.vm(), result.release_error());
+            return WebIDL::create_rejected_promise(realm, throw_completion.value().value());
+        }
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+
+    // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
+    Streams::transform_stream_set_up(transform, transform_algorithm, flush_algorithm);
+
+    return stream;
+}
+
+DecompressionStream::DecompressionStream(JS::Realm& realm, JS::NonnullGCPtr<Streams::TransformStream> transform, Bindings::CompressionFormat format)
+    : Bindings::PlatformObject(realm)
+    , Streams::GenericTransformStreamMixin(transform)
+    , m_format(format)
+    , m_input(make<AllocatingMemoryStream>())
+    , m_output(make<AllocatingMemoryStream>())
+{
+}
+
+DecompressionStream::~DecompressionStream() = default;
+
+void DecompressionStream::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(DecompressionStream);
+}
+
+void DecompressionStream::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    Streams::GenericTransformStreamMixin::visit_edges(visitor);
+}
+
+// https://compression.spec.whatwg.org/#decompress-and-enqueue-a-chunk
+WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::Value chunk)
+{
+    auto& vm = this->vm();
+
+    // 1. If chunk is not a BufferSource type, then throw a TypeError.
+    if (!chunk.is_object() || !(is<JS::TypedArrayBase>(chunk.as_object()) || is<JS::ArrayBuffer>(chunk.as_object()) || is<JS::DataView>(chunk.as_object())))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
+
+    // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
+    //    then throw a TypeError.
+    auto data = TRY_OR_THROW_OOM(vm, WebIDL::get_buffer_source_copy(chunk.as_object()));
+    TRY_OR_THROW_OOM(vm, m_input->write_until_depleted(data));
+    m_received_input |= !data.is_empty();
+
+    if (auto result = decompress(Finish::No); result.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", result.error())) };
+
+    // 3. If buffer is empty, return.
+    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // 5. For each Uint8Array array, enqueue array in ds's transform.
+    return enqueue_pending_output();
+}
+
+// https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
+WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
+{
+    // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
+    if (auto result = decompress(Finish::Yes); result.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", result.error())) };
+
+    // 2. If the end of the compressed input has not been reached, then throw a TypeError.
+    if (!m_received_input || !m_decompressor->is_eof())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Reached end of input before the end of the compressed data"sv };
+
+    // 3. If buffer is empty, return.
+    // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
+    // 5. For each Uint8Array array, enqueue array in ds's transform.
+    return enqueue_pending_output();
+}
+
+ErrorOr<NonnullOwnPtr<Stream>> DecompressionStream::create_decompressor()
+{
+    MaybeOwned<Stream> input { *m_input };
+
+    switch (m_format) {
+    case Bindings::CompressionFormat::Brotli:
+        return make<Compress::BrotliDecompressionStream>(move(input));
+    case Bindings::CompressionFormat::Deflate:
+        return TRY(Compress::ZlibDecompressor::create(move(input)));
+    case Bindings::CompressionFormat::DeflateRaw:
+        return TRY(Compress::DeflateDecompressor::construct(make<LittleEndianInputBitStream>(move(input))));
+    case Bindings::CompressionFormat::Gzip:
+        return make<Compress::GzipDecompressor>(move(input));
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+ErrorOr<void> DecompressionStream::decompress(Finish finish)
+{
+    auto has_enough_input = [&]() {
+        return finish == Finish::Yes || m_input->used_buffer_size() >= MINIMUM_BUFFERED_INPUT_SIZE;
+    };
+
+    if (!has_enough_input() || !m_received_input)
+        return {};
+
+    if (!m_decompressor)
+        m_decompressor = TRY(create_decompressor());
+
+    Array<u8, OUTPUT_SLICE_SIZE> slice;
+
+    while (has_enough_input() && !m_decompressor->is_eof()) {
+        auto bytes = TRY(m_decompressor->read_some(slice));
+        if (bytes.is_empty())
+            break;
+
+        TRY(m_output->write_until_depleted(bytes));
+    }
+
+    return {};
+}
+
+WebIDL::ExceptionOr<void> DecompressionStream::enqueue_pending_output()
+{
+    auto& realm = this->realm();
+    auto& vm = this->vm();
+
+    auto size = m_output->used_buffer_size();
+    if (size == 0)
+        return {};
+
+    auto buffer = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
+    TRY_OR_THROW_OOM(vm, m_output->read_until_filled(buffer));
+
+    auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
+    auto array = JS::Uint8Array::create(realm, size, *array_buffer);
+
+    return Streams::transform_stream_default_controller_enqueue(*m_transform->controller(), array);
+}
+
+}
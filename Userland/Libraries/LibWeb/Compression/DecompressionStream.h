@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/MemoryStream.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Bindings/CompressionStreamPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Streams/GenericTransformStream.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::Compression {
+
+// https://compression.spec.whatwg.org/#decompressionstream
+class DecompressionStream final
+    : public Bindings::PlatformObject
+    , public Streams::GenericTransformStreamMixin {
+    WEB_PLATFORM_OBJECT(DecompressionStream, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(DecompressionStream);
+
+public:
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<DecompressionStream>> construct_impl(JS::Realm&, Bindings::CompressionFormat);
+    virtual ~DecompressionStream() override;
+
+private:
+    enum class Finish {
+        No,
+        Yes,
+    };
+
+    DecompressionStream(JS::Realm&, JS::NonnullGCPtr<Streams::TransformStream>, Bindings::CompressionFormat);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    WebIDL::ExceptionOr<void> decompress_and_enqueue_chunk(JS::Value);
+    WebIDL::ExceptionOr<void> decompress_flush_and_enqueue();
+
+    ErrorOr<NonnullOwnPtr<Stream>> create_decompressor();
+    ErrorOr<void> decompress(Finish);
+    WebIDL::ExceptionOr<void> enqueue_pending_output();
+
+    // https://compression.spec.whatwg.org/#decompressionstream-format
+    Bindings::CompressionFormat m_format;
+
+    // https://compression.spec.whatwg.org/#decompressionstream-context
+    // NOTE: The decompressor pulls compressed bytes out of m_input, and is only created once enough input has arrived
+    //       for it to parse the format's header.
+    NonnullOwnPtr<AllocatingMemoryStream> m_input;
+    NonnullOwnPtr<AllocatingMemoryStream> m_output;
+    OwnPtr<Stream> m_decompressor;
+    bool m_received_input { false };
+};
+
+}
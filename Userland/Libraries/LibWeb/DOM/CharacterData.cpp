@@ -128,10 +128,12 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
 
     document().set_needs_layout();
 
-    if (m_grapheme_segmenter)
-        m_grapheme_segmenter->set_segmented_text(m_data);
-    if (m_word_segmenter)
-        m_word_segmenter->set_segmented_text(m_data);
+    if (m_segmenters) {
+        if (m_segmenters->grapheme_segmenter)
+            m_segmenters->grapheme_segmenter->set_segmented_text(m_data);
+        if (m_segmenters->word_segmenter)
+            m_segmenters->word_segmenter->set_segmented_text(m_data);
+    }
 
     return {};
 }
@@ -159,22 +161,30 @@ WebIDL::ExceptionOr<void> CharacterData::delete_data(size_t offset, size_t count
 
 Unicode::Segmenter& CharacterData::grapheme_segmenter() const
 {
-    if (!m_grapheme_segmenter) {
-        m_grapheme_segmenter = document().grapheme_segmenter().clone();
-        m_grapheme_segmenter->set_segmented_text(m_data);
+    if (!m_segmenters)
+        m_segmenters = make<Segmenters>();
+
+    auto& segmenter = m_segmenters->grapheme_segmenter;
+    if (!segmenter) {
+        segmenter = document().grapheme_segmenter().clone();
+        segmenter->set_segmented_text(m_data);
     }
 
-    return *m_grapheme_segmenter;
+    return *segmenter;
 }
 
 Unicode::Segmenter& CharacterData::word_segmenter() const
 {
-    if (!m_word_segmenter) {
-        m_word_segmenter = document().word_segmenter().clone();
-        m_word_segmenter->set_segmented_text(m_data);
+    if (!m_segmenters)
+        m_segmenters = make<Segmenters>();
+
+    auto& segmenter = m_segmenters->word_segmenter;
+    if (!segmenter) {
+        segmenter = document().word_segmenter().clone();
+        segmenter->set_segmented_text(m_data);
     }
 
-    return *m_word_segmenter;
+    return *segmenter;
 }
 
 }
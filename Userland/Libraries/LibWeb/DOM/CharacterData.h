@@ -51,8 +51,12 @@ protected:
 private:
     String m_data;
 
-    mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
-    mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
+    // NOTE: Only nodes that are being edited or selected need segmenters, so they share one allocation to keep nodes small.
+    struct Segmenters {
+        OwnPtr<Unicode::Segmenter> grapheme_segmenter;
+        OwnPtr<Unicode::Segmenter> word_segmenter;
+    };
+    mutable OwnPtr<Segmenters> m_segmenters;
 };
 
 }
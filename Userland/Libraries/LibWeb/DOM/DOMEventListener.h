@@ -35,8 +35,8 @@ public:
     // capture (a boolean, initially false)
     bool capture { false };
 
-    // passive (a boolean, initially false)
-    bool passive { false };
+    // passive (null or a boolean, initially null)
+    Optional<bool> passive;
 
     // once (a boolean, initially false)
     bool once { false };
@@ -15,6 +15,7 @@
 #include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -33,6 +34,7 @@
 #include <LibWeb/CSS/FontFaceSet.h>
 #include <LibWeb/CSS/MediaQueryList.h>
 #include <LibWeb/CSS/MediaQueryListEvent.h>
+#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/CSS/StyleSheetIdentifier.h>
 #include <LibWeb/CSS/SystemColor.h>
@@ -115,10 +117,12 @@
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/IntersectionObserver/IntersectionObserver.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
+#include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/TreeBuilder.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
@@ -455,6 +459,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_page);
     visitor.visit(m_window);
     visitor.visit(m_layout_root);
+    visitor.visit(m_nodes_with_invalidated_layout_subtree);
     visitor.visit(m_style_sheets);
     visitor.visit(m_hovered_node);
     visitor.visit(m_inspected_node);
@@ -729,6 +734,16 @@ URL::Origin Document::origin() const
     return m_origin;
 }
 
+void Document::set_quirks_mode(QuirksMode mode)
+{
+    if (m_quirks_mode == mode)
+        return;
+    m_quirks_mode = mode;
+
+    // NOTE: The user agent rule cache includes the quirks mode style sheet only in quirks mode.
+    m_style_computer->invalidate_rule_cache();
+}
+
 void Document::set_origin(URL::Origin const& origin)
 {
     m_origin = origin;
@@ -969,6 +984,7 @@ void Document::tear_down_layout_tree()
 {
     m_layout_root = nullptr;
     m_paintable = nullptr;
+    m_nodes_with_invalidated_layout_subtree.clear();
 }
 
 Color Document::background_color() const
@@ -1081,6 +1097,24 @@ void Document::invalidate_layout_tree()
     schedule_layout_update();
 }
 
+void Document::invalidate_layout_subtree(Node& node)
+{
+    // NOTE: If the whole layout tree is going to be rebuilt anyway, there's nothing to keep track of.
+    if (!m_layout_root)
+        return;
+
+    // Past a certain point, rebuilding everything is cheaper than working out which subtrees to rebuild.
+    static constexpr size_t max_invalidated_layout_subtrees = 64;
+    if (m_nodes_with_invalidated_layout_subtree.size() >= max_invalidated_layout_subtrees) {
+        invalidate_layout_tree();
+        return;
+    }
+
+    if (!m_nodes_with_invalidated_layout_subtree.contains_slow(node))
+        m_nodes_with_invalidated_layout_subtree.append(node);
+    set_needs_layout();
+}
+
 static void propagate_scrollbar_width_to_viewport(Element& root_element, Layout::Viewport& viewport)
 {
     // https://drafts.csswg.org/css-scrollbars/#scrollbar-width
@@ -1122,8 +1156,56 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+bool Document::rebuild_invalidated_layout_subtrees()
+{
+    // Generated content using counters or quotes depends on every box that precedes it.
+    if (m_layout_tree_has_document_order_dependent_content)
+        return false;
+
+    // Top layer elements generate boxes as children of the viewport, away from their position in the DOM.
+    if (!top_layer_elements().is_empty())
+        return false;
+
+    Vector<JS::NonnullGCPtr<Element>> rebuild_roots;
+    for (auto& node : m_nodes_with_invalidated_layout_subtree) {
+        // NOTE: Removing a node from the document invalidates its old parent, so we can ignore it here.
+        if (!node->is_connected())
+            continue;
+        auto* rebuild_root = Layout::TreeBuilder::subtree_rebuild_root_for(*node);
+        if (!rebuild_root)
+            return false;
+        if (!rebuild_roots.contains_slow(*rebuild_root))
+            rebuild_roots.append(*rebuild_root);
+    }
+
+    Layout::TreeBuilder tree_builder;
+    for (auto& rebuild_root : rebuild_roots) {
+        bool is_inside_other_rebuild_root = any_of(rebuild_roots, [&](auto& other) {
+            return other->is_shadow_including_ancestor_of(rebuild_root);
+        });
+        if (is_inside_other_rebuild_root)
+            continue;
+        if (!tree_builder.rebuild_subtree(rebuild_root))
+            return false;
+
+        // The body's overflow values may have been propagated to the viewport, so do that again for its new box.
+        auto* document_element = this->document_element();
+        if (document_element && document_element->is_html_html_element()
+            && rebuild_root.ptr() == document_element->first_child_of_type<HTML::HTMLBodyElement>()) {
+            auto document_element_style = document_element->computed_css_values();
+            if (document_element_style->overflow_x() == CSS::Overflow::Visible && document_element_style->overflow_y() == CSS::Overflow::Visible)
+                propagate_overflow_to_viewport(*document_element, *m_layout_root);
+        }
+    }
+
+    m_layout_root->invalidate_text_blocks();
+    return true;
+}
+
 void Document::update_layout()
 {
+    TRACE_SCOPE("layout", "Document::update_layout");
+
     auto navigable = this->navigable();
     if (!navigable || navigable->active_document() != this)
         return;
@@ -1143,13 +1225,19 @@ void Document::update_layout()
         return;
 
     invalidate_display_list();
+    ++m_layout_generation;
 
     auto* document_element = this->document_element();
     auto viewport_rect = navigable->viewport_rect();
 
+    if (m_layout_root && !m_nodes_with_invalidated_layout_subtree.is_empty() && !rebuild_invalidated_layout_subtrees())
+        tear_down_layout_tree();
+    m_nodes_with_invalidated_layout_subtree.clear();
+
     if (!m_layout_root) {
         Layout::TreeBuilder tree_builder;
         m_layout_root = verify_cast<Layout::Viewport>(*tree_builder.build(*this));
+        m_layout_tree_has_document_order_dependent_content = tree_builder.has_document_order_dependent_content();
 
         if (document_element && document_element->layout_node()) {
             propagate_overflow_to_viewport(*document_element, *m_layout_root);
@@ -1162,6 +1250,13 @@ void Document::update_layout()
         child.clear_contained_abspos_children();
         return TraversalDecision::Continue;
     });
+
+    // Let replaced boxes pick up their current natural size before layout starts, so that a change
+    // (e.g. an image finishing loading) invalidates intrinsic sizes memoized on their ancestors in time.
+    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::ReplacedBox>([&](auto& replaced_box) {
+        replaced_box.prepare_for_replaced_layout();
+        return TraversalDecision::Continue;
+    });
     m_layout_root->for_each_in_inclusive_subtree([&](auto& child) {
         if (!child.is_absolutely_positioned())
             return TraversalDecision::Continue;
@@ -1244,7 +1339,16 @@ void Document::update_layout()
     bool is_display_none = false;
 
     if (is<Element>(node)) {
-        invalidation |= static_cast<Element&>(node).recompute_style();
+        auto element_invalidation = static_cast<Element&>(node).recompute_style();
+        if (element_invalidation.rebuild_layout_tree) {
+            // The element's box may have come or gone, or changed type, so its parent's subtree needs rebuilding.
+            if (auto* parent = node.parent_or_shadow_host()) {
+                node.document().invalidate_layout_subtree(*parent);
+                element_invalidation.rebuild_layout_tree = false;
+                element_invalidation.relayout = true;
+            }
+        }
+        invalidation |= element_invalidation;
         is_display_none = static_cast<Element&>(node).computed_css_values()->display().is_none();
     }
     node.set_needs_style_update(false);
@@ -1280,6 +1384,8 @@ void Document::update_layout()
 
 void Document::update_style()
 {
+    TRACE_SCOPE("style", "Document::update_style");
+
     if (!browsing_context())
         return;
 
@@ -1304,7 +1410,8 @@ void Document::update_style()
     style_computer().reset_ancestor_filter();
 
     auto invalidation = update_style_recursively(*this, style_computer());
-    if (!invalidation.is_none()) {
+    // Elements that only need a repaint have already invalidated the display list for their own paintable.
+    if (invalidation.rebuild_stacking_context_tree || invalidation.relayout || invalidation.rebuild_layout_tree) {
         invalidate_display_list();
     }
     if (invalidation.rebuild_layout_tree) {
@@ -3464,7 +3571,8 @@ void Document::unload(JS::GCPtr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    auto intend_to_store_in_bfcache = m_may_be_kept_in_back_forward_cache && is_eligible_for_back_forward_cache();
+    m_may_be_kept_in_back_forward_cache = false;
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *verify_cast<Bindings::WebEngineCustomData>(*HTML::relevant_agent(*this).custom_data()).event_loop;
@@ -3585,9 +3693,80 @@ void Document::unload_a_document_and_its_descendants(JS::GCPtr<Document> new_doc
         return number_unloaded == unloaded_documents_count;
     });
 
+    // NOTE: A document that is still salvageable at this point is kept alive in its session history entry (only
+    //       documents without descendant navigables are kept), so it must not be destroyed.
+    if (m_salvageable) {
+        navigable->traversable_navigable()->evict_documents_from_back_forward_cache_if_needed(new_document);
+        if (after_all_unloads)
+            after_all_unloads->function()();
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
+bool Document::is_eligible_for_back_forward_cache()
+{
+    if (!m_salvageable)
+        return false;
+
+    // NOTE: Only top-level documents without any nested navigables are kept, so that there are no nested histories
+    //       that would have to be kept in sync with the cached document.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable())
+        return false;
+    if (!descendant_navigables().is_empty())
+        return false;
+
+    // A document that hasn't finished loading would have to be aborted anyway.
+    if (m_readiness != HTML::DocumentReadyState::Complete)
+        return false;
+
+    // Pages that listen for unloading expect to be torn down, and pages with open event streams would keep receiving
+    // events for a document that isn't shown.
+    auto& window = verify_cast<HTML::Window>(HTML::relevant_global_object(*this));
+    if (window.has_event_listener(HTML::EventNames::unload) || window.has_event_listener(HTML::EventNames::beforeunload))
+        return false;
+    if (window.has_registered_event_sources())
+        return false;
+
+    // FIXME: Also exclude documents with open WebSocket connections, once we keep track of them per global object.
+
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate()
+{
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset algorithm for formControl.
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    //           1. Assert: document's suspension time is not zero.
+    //           2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //           3. Let activeTimers be document's relevant global object's map of active timers.
+    //           4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase activeTimers[handle] by suspendDuration.
+
+    // FIXME: 3. Update the navigation API entries for reactivation given navigation, entriesForNavigationAPI, and reactivatedEntry.
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // NOTE: The layout tree was torn down when this document stopped being active, and the viewport may have
+        //       changed since, so lay it out again from scratch.
+        invalidate_layout_tree();
+
+        // 1. Set document's page showing to true.
+        m_page_showing = true;
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        verify_cast<HTML::Window>(HTML::relevant_global_object(*this)).fire_a_page_transition_event(HTML::EventNames::pageshow, true);
+    }
+}
+
 // https://html.spec.whatwg.org/multipage/iframe-embed-object.html#allowed-to-use
 bool Document::is_allowed_to_use_feature(PolicyControlledFeature feature) const
 {
@@ -3665,6 +3844,14 @@ JS::NonnullGCPtr<DOM::Document> Document::appropriate_template_contents_owner_do
 
 String Document::dump_accessibility_tree_as_json()
 {
+    // NOTE: Roles and names depend on computed style as well as on the DOM, so make sure both are up to date. As long as
+    //       neither the DOM nor the layout has changed since the last dump, the tree would come out the same.
+    update_layout();
+    if (m_cached_accessibility_tree.has_value()
+        && m_cached_accessibility_tree->dom_tree_version == dom_tree_version()
+        && m_cached_accessibility_tree->layout_generation == m_layout_generation)
+        return m_cached_accessibility_tree->json;
+
     StringBuilder builder;
     auto accessibility_tree = AccessibilityTreeNode::create(this, nullptr);
     build_accessibility_tree(*&accessibility_tree);
@@ -3679,7 +3866,9 @@ String Document::dump_accessibility_tree_as_json()
     }
 
     MUST(json.finish());
-    return MUST(builder.to_string());
+    auto result = MUST(builder.to_string());
+    m_cached_accessibility_tree = CachedAccessibilityTree { dom_tree_version(), m_layout_generation, result };
+    return result;
 }
 
 // https://dom.spec.whatwg.org/#dom-document-createattribute
@@ -3875,10 +4064,11 @@ void Document::queue_an_intersection_observer_entry(IntersectionObserver::Inters
 }
 
 // https://www.w3.org/TR/intersection-observer/#compute-the-intersection
-static JS::NonnullGCPtr<Geometry::DOMRectReadOnly> compute_intersection(JS::NonnullGCPtr<Element> target, IntersectionObserver::IntersectionObserver const& observer)
+static JS::NonnullGCPtr<Geometry::DOMRectReadOnly> compute_intersection(JS::Realm& realm, Geometry::DOMRectReadOnly const& target_bounding_box, IntersectionObserver::IntersectionObserver const& observer)
 {
     // 1. Let intersectionRect be the result of getting the bounding box for target.
-    auto intersection_rect = target->get_bounding_client_rect();
+    // NOTE: The caller has already gotten the bounding box for target, so we don't have to do it again.
+    CSSPixelRect intersection_rect(target_bounding_box.x(), target_bounding_box.y(), target_bounding_box.width(), target_bounding_box.height());
 
     // FIXME: 2. Let container be the containing block of target.
     // FIXME: 3. While container is not root:
@@ -3893,18 +4083,12 @@ static JS::NonnullGCPtr<Geometry::DOMRectReadOnly> compute_intersection(JS::Nonn
 
     // 5. Update intersectionRect by intersecting it with the root intersection rectangle.
     // FIXME: Pass in target so we can properly apply rootMargin.
-    auto root_intersection_rectangle = observer.root_intersection_rectangle();
-    CSSPixelRect intersection_rect_as_pixel_rect(intersection_rect->x(), intersection_rect->y(), intersection_rect->width(), intersection_rect->height());
-    intersection_rect_as_pixel_rect.intersect(root_intersection_rectangle);
-    intersection_rect->set_x(static_cast<double>(intersection_rect_as_pixel_rect.x()));
-    intersection_rect->set_y(static_cast<double>(intersection_rect_as_pixel_rect.y()));
-    intersection_rect->set_width(static_cast<double>(intersection_rect_as_pixel_rect.width()));
-    intersection_rect->set_height(static_cast<double>(intersection_rect_as_pixel_rect.height()));
+    intersection_rect.intersect(observer.root_intersection_rectangle());
 
     // FIXME: 6. Map intersectionRect to the coordinate space of the viewport of the document containing target.
 
     // 7. Return intersectionRect.
-    return intersection_rect;
+    return Geometry::DOMRectReadOnly::construct_impl(realm, static_cast<double>(intersection_rect.x()), static_cast<double>(intersection_rect.y()), static_cast<double>(intersection_rect.width()), static_cast<double>(intersection_rect.height())).release_value_but_fixme_should_propagate_errors();
 }
 
 // https://www.w3.org/TR/intersection-observer/#run-the-update-intersection-observations-steps
@@ -3912,6 +4096,9 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 {
     auto& realm = this->realm();
 
+    // NOTE: Lay out once up front, so that the layout and scroll generations checked below are up to date.
+    update_layout();
+
     // 1. Let observer list be a list of all IntersectionObservers whose root is in the DOM tree of document.
     //    For the top-level browsing context, this includes implicit root observers.
     // 2. For each observer in observer list:
@@ -3922,6 +4109,21 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
         // 2. For each target in observer’s internal [[ObservationTargets]] slot, processed in the same order that
         //    observe() was called on each target:
         for (auto& target : observer->observation_targets()) {
+            // AD-HOC: If neither layout nor scrolling has changed anything since we last ran these steps for target, we
+            //         would end up with the same thresholdIndex and isIntersecting as last time, which never queues an
+            //         entry. Skip the geometry work in that case, so that pages observing thousands of targets only
+            //         pay for it when something actually moved.
+            //         This is only done when target and the intersection root are both in this document, as the
+            //         generations of other documents aren't tracked here.
+            auto& intersection_observer_registration = target->get_intersection_observer_registration({}, observer);
+            bool geometry_is_tracked_by_this_document = &target->document() == this
+                && observer->intersection_root().visit([](auto& node) -> Document const* { return &node->document(); }) == this;
+            if (geometry_is_tracked_by_this_document
+                && intersection_observer_registration.last_update_layout_generation == m_layout_generation
+                && intersection_observer_registration.last_update_scroll_generation == m_scroll_generation) {
+                continue;
+            }
+
             // 1. Let:
             // thresholdIndex be 0.
             size_t threshold_index = 0;
@@ -3953,7 +4155,7 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
                 // 5. Let intersectionRect be the result of running the compute the intersection algorithm on target and
                 //    observer’s intersection root.
-                intersection_rect = compute_intersection(target, observer);
+                intersection_rect = compute_intersection(realm, target_rect, observer);
 
                 // 6. Let targetArea be targetRect’s area.
                 auto target_area = target_rect->width() * target_rect->height();
@@ -3984,7 +4186,7 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
             // 11. Let intersectionObserverRegistration be the IntersectionObserverRegistration record in target’s
             //     internal [[RegisteredIntersectionObservers]] slot whose observer property is equal to observer.
-            auto& intersection_observer_registration = target->get_intersection_observer_registration({}, observer);
+            // NOTE: This was looked up above.
 
             // 12. Let previousThresholdIndex be the intersectionObserverRegistration’s previousThresholdIndex property.
             auto previous_threshold_index = intersection_observer_registration.previous_threshold_index;
@@ -4007,6 +4209,11 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
 
             // 16. Assign isIntersecting to intersectionObserverRegistration’s previousIsIntersecting property.
             intersection_observer_registration.previous_is_intersecting = is_intersecting;
+
+            if (geometry_is_tracked_by_this_document) {
+                intersection_observer_registration.last_update_layout_generation = m_layout_generation;
+                intersection_observer_registration.last_update_scroll_generation = m_scroll_generation;
+            }
         }
     }
 }
@@ -4385,7 +4592,8 @@ void Document::update_for_history_step_application(JS::NonnullGCPtr<HTML::Sessio
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
         // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate();
     }
 }
 
@@ -4615,6 +4823,33 @@ static void insert_in_tree_order(Vector<JS::NonnullGCPtr<DOM::Element>>& element
         elements.append(element);
 }
 
+ElementByIdMap* Document::element_by_id_map() const
+{
+    if (!m_element_by_id)
+        m_element_by_id = make<ElementByIdMap>(const_cast<Document&>(*this));
+    return m_element_by_id;
+}
+
+Optional<CSS::SelectorList> Document::parse_selector_for_query(StringView selector_text)
+{
+    static constexpr size_t max_parsed_selectors_for_query = 256;
+
+    auto key = MUST(String::from_utf8(selector_text));
+    if (auto selectors = m_parsed_selectors_for_query.take(key); selectors.has_value()) {
+        m_parsed_selectors_for_query.set(move(key), *selectors);
+        return selectors;
+    }
+
+    auto selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    if (!selectors.has_value())
+        return {};
+
+    if (m_parsed_selectors_for_query.size() >= max_parsed_selectors_for_query)
+        m_parsed_selectors_for_query.remove(m_parsed_selectors_for_query.begin());
+    m_parsed_selectors_for_query.set(move(key), *selectors);
+    return selectors;
+}
+
 void Document::element_id_changed(Badge<DOM::Element>, JS::NonnullGCPtr<DOM::Element> element)
 {
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
@@ -5315,6 +5550,8 @@ void Document::process_top_layer_removals()
 
 void Document::set_needs_to_refresh_scroll_state(bool b)
 {
+    if (b)
+        ++m_scroll_generation;
     if (auto* paintable = this->paintable())
         paintable->set_needs_to_refresh_scroll_state(b);
 }
@@ -5501,13 +5738,18 @@ void Document::set_cached_navigable(JS::GCPtr<HTML::Navigable> navigable)
 
 void Document::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    set_needs_display(viewport_rect(), should_invalidate_display_list);
+    m_whole_viewport_is_damaged = true;
+    set_needs_display(CSSPixelRect { {}, viewport_rect().size() }, should_invalidate_display_list);
 }
 
-void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList should_invalidate_display_list)
+void Document::set_needs_display(CSSPixelRect const& rect, InvalidateDisplayList should_invalidate_display_list)
 {
-    // FIXME: Ignore updates outside the visible viewport rect.
-    //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
+    // FIXME: Skip the repaint entirely for updates outside the visible viewport rect.
+    if (!m_whole_viewport_is_damaged) {
+        auto visible_rect = rect.intersected({ {}, viewport_rect().size() });
+        if (!visible_rect.is_empty())
+            m_damage_rect = m_damage_rect.has_value() ? m_damage_rect->united(visible_rect) : visible_rect;
+    }
 
     m_needs_repaint = true;
 
@@ -5532,21 +5774,60 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
 void Document::invalidate_display_list()
 {
     m_cached_display_list.clear();
+    ++m_display_list_cache_generation;
+    m_whole_viewport_is_damaged = true;
 
+    if (auto* paintable = this->paintable())
+        paintable->invalidate_hit_test_bounds();
+
+    invalidate_display_list_of_container();
+}
+
+void Document::invalidate_display_list_for(Painting::Paintable& paintable)
+{
+    m_cached_display_list.clear();
+
+    if (auto* viewport_paintable = this->paintable())
+        viewport_paintable->invalidate_hit_test_bounds();
+
+    for (auto* ancestor = &paintable; ancestor; ancestor = ancestor->parent()) {
+        if (auto* stacking_context = ancestor->stacking_context()) {
+            stacking_context->invalidate_cached_display_list();
+            break;
+        }
+    }
+
+    invalidate_display_list_of_container();
+}
+
+void Document::invalidate_display_list_of_container()
+{
     auto navigable = this->navigable();
     if (!navigable)
         return;
 
+    // Only the container's own stacking contexts paint our display list, so nothing else in its document needs to be recorded again.
     if (auto container = navigable->container()) {
-        container->document().invalidate_display_list();
+        if (auto* container_paintable = container->paintable())
+            container->document().invalidate_display_list_for(*container_paintable);
+        else
+            container->document().invalidate_display_list();
     }
 }
 
 RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
 {
+    TRACE_SCOPE("paint", "Document::record_display_list");
+
     if (m_cached_display_list && m_cached_display_list_paint_config == config)
         return m_cached_display_list;
 
+    // The stacking contexts' cached commands depend on the paint config, so they can't be replayed under another one.
+    if (m_cached_display_list_paint_config != config) {
+        ++m_display_list_cache_generation;
+        m_whole_viewport_is_damaged = true;
+    }
+
     auto display_list = Painting::DisplayList::create();
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -5567,6 +5848,7 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
     context.set_should_show_line_box_borders(config.should_show_line_box_borders);
     context.set_should_paint_overlay(config.paint_overlay);
     context.set_has_focus(config.has_focus);
+    context.set_display_list_cache_generation(m_display_list_cache_generation);
 
     update_paint_and_hit_testing_properties_if_needed();
 
@@ -5575,6 +5857,7 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
     viewport_paintable.refresh_scroll_state();
 
     viewport_paintable.paint_all_phases(context);
+    display_list->optimize();
 
     display_list->set_device_pixels_per_css_pixel(page().client().device_pixels_per_css_pixel());
 
@@ -5597,6 +5880,40 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
     return display_list;
 }
 
+void Document::did_scroll_viewport(CSSPixelPoint old_position, CSSPixelPoint new_position)
+{
+    // Whatever was damaged so far moved along with the content.
+    if (m_damage_rect.has_value())
+        m_damage_rect->translate_by(old_position - new_position);
+    m_viewport_was_scrolled = true;
+
+    // NOTE: Nothing is damaged yet. The newly exposed part of the viewport is only known once we paint.
+    set_needs_display(CSSPixelRect {}, InvalidateDisplayList::No);
+}
+
+Optional<Document::Damage> Document::take_damage(Painting::DisplayList const& display_list)
+{
+    auto scroll_offsets_of_previous_frame = exchange(m_scroll_offsets_of_previous_frame, display_list.device_scroll_offsets());
+    ScopeGuard reset_damage = [&] {
+        m_whole_viewport_is_damaged = false;
+        m_damage_rect.clear();
+        m_viewport_was_scrolled = false;
+    };
+
+    if (m_whole_viewport_is_damaged)
+        return {};
+
+    Damage damage { .rect = m_damage_rect.value_or({}), .translation = {} };
+    if (m_viewport_was_scrolled) {
+        auto viewport_rect = page().enclosing_device_rect(CSSPixelRect { {}, this->viewport_rect().size() }).to_type<int>();
+        auto translation = display_list.translation_since(scroll_offsets_of_previous_frame, viewport_rect);
+        if (!translation.has_value())
+            return {};
+        damage.translation = *translation;
+    }
+    return damage;
+}
+
 Unicode::Segmenter& Document::grapheme_segmenter() const
 {
     if (!m_grapheme_segmenter)
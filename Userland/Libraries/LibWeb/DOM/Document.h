@@ -24,6 +24,7 @@
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/NonElementParentNode.h>
 #include <LibWeb/DOM/ParentNode.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -107,11 +108,6 @@ public:
     static WebIDL::ExceptionOr<JS::NonnullGCPtr<Document>> construct_impl(JS::Realm&);
     virtual ~Document() override;
 
-    // AD-HOC: This number increments whenever a node is added or removed from the document, or an element attribute changes.
-    //         It can be used as a crude invalidation mechanism for caches that depend on the DOM structure.
-    u64 dom_tree_version() const { return m_dom_tree_version; }
-    void bump_dom_tree_version() { ++m_dom_tree_version; }
-
     WebIDL::ExceptionOr<void> populate_with_html_head_and_body();
 
     JS::GCPtr<Selection::Selection> get_selection() const;
@@ -245,6 +241,7 @@ public:
     void set_needs_layout();
 
     void invalidate_layout_tree();
+    void invalidate_layout_subtree(Node&);
     void invalidate_stacking_context_tree();
 
     virtual bool is_child_allowed(Node const&) const override;
@@ -314,7 +311,7 @@ public:
 
     QuirksMode mode() const { return m_quirks_mode; }
     bool in_quirks_mode() const { return m_quirks_mode == QuirksMode::Yes; }
-    void set_quirks_mode(QuirksMode mode) { m_quirks_mode = mode; }
+    void set_quirks_mode(QuirksMode);
 
     Type document_type() const { return m_type; }
     void set_document_type(Type type) { m_type = type; }
@@ -547,6 +544,14 @@ public:
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
     void unload_a_document_and_its_descendants(JS::GCPtr<Document> new_document, JS::GCPtr<JS::HeapFunction<void()>> after_all_unloads = {});
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate();
+
+    // Set by history traversal right before this document is unloaded, when its session history entry stays around
+    // for the user to come back to, so that the document may be kept alive in it rather than destroyed.
+    void set_may_be_kept_in_back_forward_cache(bool value) { m_may_be_kept_in_back_forward_cache = value; }
+    bool is_eligible_for_back_forward_cache();
+
     // https://html.spec.whatwg.org/multipage/dom.html#active-parser
     JS::GCPtr<HTML::HTMLParser> active_parser();
 
@@ -652,13 +657,27 @@ public:
     Vector<JS::NonnullGCPtr<Element>> elements_from_point(double x, double y);
     JS::GCPtr<Element const> scrolling_element() const;
 
-    void set_needs_to_resolve_paint_only_properties() { m_needs_to_resolve_paint_only_properties = true; }
+    void set_needs_to_resolve_paint_only_properties()
+    {
+        m_needs_to_resolve_paint_only_properties = true;
+        ++m_layout_generation;
+    }
+
+    // These are bumped whenever boxes may have been moved or resized, and whenever anything has been scrolled.
+    // Geometry read from the paint tree stays valid for as long as they don't change.
+    u64 layout_generation() const { return m_layout_generation; }
+    u64 scroll_generation() const { return m_scroll_generation; }
     void set_needs_animated_style_update() { m_needs_animated_style_update = true; }
 
     virtual JS::Value named_item_value(FlyString const& name) const override;
     virtual Vector<FlyString> supported_property_names() const override;
     Vector<JS::NonnullGCPtr<DOM::Element>> const& potentially_named_elements() const { return m_potentially_named_elements; }
 
+    ElementByIdMap* element_by_id_map() const;
+
+    // Parses the selector text given to querySelector() and friends, reusing the result of earlier calls with the same text.
+    Optional<CSS::SelectorList> parse_selector_for_query(StringView selector_text);
+
     void gather_active_observations_at_depth(size_t depth);
     [[nodiscard]] size_t broadcast_active_resize_observations();
     [[nodiscard]] bool has_active_resize_observations();
@@ -708,8 +727,21 @@ public:
 
     [[nodiscard]] bool needs_repaint() const { return m_needs_repaint; }
     void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
+    // NOTE: The rect is relative to the viewport, i.e. scroll offsets have already been applied to it.
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    // Lets the next frame reuse what's already painted, by moving it along with the viewport.
+    void did_scroll_viewport(CSSPixelPoint old_position, CSSPixelPoint new_position);
+
+    struct Damage {
+        // The part of the viewport that has to be painted again.
+        CSSPixelRect rect;
+        // How far the previous frame has to be moved in device pixels before painting the damaged rect on top of it.
+        Gfx::IntPoint translation;
+    };
+    // Returns the damage since the last call, or nothing if the whole viewport has to be painted again.
+    Optional<Damage> take_damage(Painting::DisplayList const&);
+
     struct PaintConfig {
         bool paint_overlay { false };
         bool should_show_line_box_borders { false };
@@ -719,8 +751,12 @@ public:
         bool operator==(PaintConfig const& other) const = default;
     };
     RefPtr<Painting::DisplayList> record_display_list(PaintConfig);
+    Painting::DisplayList const* cached_display_list() const { return m_cached_display_list.ptr(); }
 
+    // Drops the cached display list, along with the commands every stacking context has cached from earlier recordings.
     void invalidate_display_list();
+    // Drops the cached display list, but only makes the stacking contexts painting the given paintable record again.
+    void invalidate_display_list_for(Painting::Paintable&);
 
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -742,6 +778,9 @@ private:
     virtual JS::GCPtr<EventTarget> global_event_handlers_to_event_target(FlyString const&) final { return *this; }
 
     void tear_down_layout_tree();
+    [[nodiscard]] bool rebuild_invalidated_layout_subtrees();
+
+    void invalidate_display_list_of_container();
 
     void update_active_element();
 
@@ -774,6 +813,10 @@ private:
 
     JS::GCPtr<Layout::Viewport> m_layout_root;
 
+    // Nodes whose layout subtree is stale, to be rebuilt in place before the next layout if possible.
+    Vector<JS::NonnullGCPtr<Node>> m_nodes_with_invalidated_layout_subtree;
+    bool m_layout_tree_has_document_order_dependent_content { false };
+
     Optional<Color> m_normal_link_color;
     Optional<Color> m_active_link_color;
     Optional<Color> m_visited_link_color;
@@ -840,6 +883,8 @@ private:
     // https://html.spec.whatwg.org/#page-showing
     bool m_page_showing { false };
 
+    bool m_may_be_kept_in_back_forward_cache { false };
+
     // Used by run_the_resize_steps().
     Optional<Gfx::IntSize> m_last_viewport_size;
 
@@ -972,6 +1017,11 @@ private:
 
     Vector<JS::NonnullGCPtr<DOM::Element>> m_potentially_named_elements;
 
+    mutable OwnPtr<ElementByIdMap> m_element_by_id;
+
+    // NOTE: This is kept in least-recently-used order, with the most recently used selector text last.
+    OrderedHashMap<String, CSS::SelectorList> m_parsed_selectors_for_query;
+
     bool m_design_mode_enabled { false };
 
     bool m_needs_to_resolve_paint_only_properties { true };
@@ -982,8 +1032,6 @@ private:
 
     Optional<Core::DateTime> m_last_modified;
 
-    u64 m_dom_tree_version { 0 };
-
     // https://drafts.csswg.org/css-position-4/#document-top-layer
     // Documents have a top layer, an ordered set containing elements from the document.
     // Elements in the top layer do not lay out normally based on their position in the document;
@@ -1005,8 +1053,25 @@ private:
 
     bool m_needs_repaint { false };
 
+    bool m_whole_viewport_is_damaged { true };
+    Optional<CSSPixelRect> m_damage_rect;
+    bool m_viewport_was_scrolled { false };
+    Vector<Gfx::IntPoint> m_scroll_offsets_of_previous_frame;
+
     Optional<PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
+    u64 m_display_list_cache_generation { 0 };
+
+    u64 m_layout_generation { 0 };
+    u64 m_scroll_generation { 0 };
+
+    // The last accessibility tree dump, along with the DOM tree version and layout generation it was built from.
+    struct CachedAccessibilityTree {
+        u64 dom_tree_version { 0 };
+        u64 layout_generation { 0 };
+        String json;
+    };
+    Optional<CachedAccessibilityTree> m_cached_accessibility_tree;
 
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
@@ -34,6 +34,15 @@ void DocumentFragment::set_host(Web::DOM::Element* element)
     m_host = element;
 }
 
+ElementByIdMap* DocumentFragment::element_by_id_map() const
+{
+    if (!is_shadow_root())
+        return nullptr;
+    if (!m_element_by_id)
+        m_element_by_id = make<ElementByIdMap>(const_cast<DocumentFragment&>(*this));
+    return m_element_by_id;
+}
+
 // https://dom.spec.whatwg.org/#dom-documentfragment-documentfragment
 WebIDL::ExceptionOr<JS::NonnullGCPtr<DocumentFragment>> DocumentFragment::construct_impl(JS::Realm& realm)
 {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/NonElementParentNode.h>
 #include <LibWeb/DOM/ParentNode.h>
 
@@ -30,6 +31,9 @@ public:
 
     void set_host(Element*);
 
+    // Only shadow roots keep track of their elements by ID, other fragments are searched when needed.
+    ElementByIdMap* element_by_id_map() const;
+
 protected:
     explicit DocumentFragment(Document& document);
 
@@ -39,6 +43,8 @@ protected:
 private:
     // https://dom.spec.whatwg.org/#concept-documentfragment-host
     JS::GCPtr<Element> m_host;
+
+    mutable OwnPtr<ElementByIdMap> m_element_by_id;
 };
 
 template<>
@@ -91,10 +91,11 @@ static WebIDL::ExceptionOr<JS::NonnullGCPtr<DOM::Document>> load_html_document(H
     //    causes a load event to be fired.
     else {
         // FIXME: Parse as we receive the document data, instead of waiting for the whole document to be fetched first.
+        //        Until then, we at least parse large documents in slices, so that we can render before they're fully parsed.
         auto process_body = JS::create_heap_function(document->heap(), [document, url = navigation_params.response->url().value()](ByteBuffer data) {
             Platform::EventLoopPlugin::the().deferred_invoke([document = document, data = move(data), url = url] {
                 auto parser = HTML::HTMLParser::create_with_uncertain_encoding(document, data);
-                parser->run(url);
+                parser->run_in_slices(url);
             });
         });
 
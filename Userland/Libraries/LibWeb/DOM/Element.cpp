@@ -450,8 +450,8 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
     attribute_changed(local_name, old_value, value);
 
     if (old_value != value) {
-        invalidate_style_after_attribute_change(local_name);
-        document().bump_dom_tree_version();
+        invalidate_style_after_attribute_change(local_name, old_value, value);
+        bump_dom_tree_version();
     }
 }
 
@@ -465,6 +465,10 @@ void Element::attribute_changed(FlyString const& name, Optional<String> const&,
         else
             m_id = value_or_empty;
 
+        if (m_id.has_value()) {
+            if (auto* element_by_id_map = ElementByIdMap::for_root(root()))
+                element_by_id_map->add(*m_id, *this);
+        }
         document().element_id_changed({}, *this);
     } else if (name == HTML::AttributeNames::name) {
         if (value_or_empty.is_empty())
@@ -579,9 +583,15 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     if (invalidation.is_none())
         return invalidation;
 
-    if (invalidation.repaint)
+    if (invalidation.repaint) {
         document().set_needs_to_resolve_paint_only_properties();
 
+        // Without a paintable of our own, whatever paints differently now (e.g. a shape using an SVG gradient we're
+        // a stop of) can't be found from here.
+        if (!paintable())
+            document().invalidate_display_list();
+    }
+
     if (!invalidation.rebuild_layout_tree && layout_node()) {
         // If we're keeping the layout tree, we can just apply the new style to the existing layout tree.
         layout_node()->apply_style(*m_computed_css_values);
@@ -753,7 +763,7 @@ JS::GCPtr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(static_cast<ParentNode&>(const_cast<Element&>(*this))), selectors);
+    auto maybe_selectors = const_cast<Document&>(document()).parse_selector_for_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -772,7 +782,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(static_cast<ParentNode&>(const_cast<Element&>(*this))), selectors);
+    auto maybe_selectors = const_cast<Document&>(document()).parse_selector_for_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -1110,8 +1120,11 @@ void Element::inserted()
 {
     Base::inserted();
 
-    if (m_id.has_value())
+    if (m_id.has_value()) {
+        if (auto* element_by_id_map = ElementByIdMap::for_root(root()))
+            element_by_id_map->add(*m_id, *this);
         document().element_with_id_was_added({}, *this);
+    }
 
     if (m_name.has_value())
         document().element_with_name_was_added({}, *this);
@@ -1931,13 +1944,46 @@ ErrorOr<void> Element::scroll_into_view(Optional<Variant<bool, ScrollIntoViewOpt
     // FIXME: 8. Optionally perform some other action that brings the element to the user’s attention.
 }
 
-void Element::invalidate_style_after_attribute_change(FlyString const& attribute_name)
+void Element::invalidate_style_after_attribute_change(FlyString const& attribute_name, Optional<String> const& old_value, Optional<String> const& new_value)
 {
-    // FIXME: Only invalidate if the attribute can actually affect style.
-    (void)attribute_name;
+    // If the document is already marked for a full style update, there's no need to figure out what to invalidate.
+    if (document().needs_full_style_update())
+        return;
+
+    auto const& style_computer = document().style_computer();
 
     // FIXME: This will need to become smarter when we implement the :has() selector.
-    invalidate_style(StyleInvalidationReason::ElementAttributeChange);
+    if (style_computer.has_has_selectors()) {
+        invalidate_style(StyleInvalidationReason::ElementAttributeChange);
+        return;
+    }
+
+    CSS::InvalidationSet invalidation_set;
+    if (attribute_name == HTML::AttributeNames::class_) {
+        // Only the classes that were added or removed can change which rules match.
+        auto old_classes = old_value.has_value() ? old_value->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace) : Vector<StringView> {};
+        auto new_classes = new_value.has_value() ? new_value->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace) : Vector<StringView> {};
+        for (auto const& class_name : old_classes) {
+            if (!new_classes.contains_slow(class_name))
+                invalidation_set |= style_computer.invalidation_set_for_class_name(MUST(FlyString::from_utf8(class_name)));
+        }
+        for (auto const& class_name : new_classes) {
+            if (!old_classes.contains_slow(class_name))
+                invalidation_set |= style_computer.invalidation_set_for_class_name(MUST(FlyString::from_utf8(class_name)));
+        }
+    } else if (attribute_name == HTML::AttributeNames::id) {
+        if (old_value.has_value())
+            invalidation_set |= style_computer.invalidation_set_for_id(*old_value);
+        if (new_value.has_value())
+            invalidation_set |= style_computer.invalidation_set_for_id(*new_value);
+    } else {
+        // Any other attribute may affect the element's own style through presentational hints or pseudo-classes.
+        invalidation_set.invalidate_self = true;
+        invalidation_set |= style_computer.invalidation_set_for_pseudo_classes();
+    }
+    invalidation_set |= style_computer.invalidation_set_for_attribute_name(attribute_name);
+
+    invalidate_style(StyleInvalidationReason::ElementAttributeChange, invalidation_set);
 }
 
 // https://www.w3.org/TR/wai-aria-1.2/#tree_exclusion
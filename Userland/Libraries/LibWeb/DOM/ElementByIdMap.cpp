@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/DocumentFragment.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
+
+namespace Web::DOM {
+
+ElementByIdMap* ElementByIdMap::for_root(Node& root)
+{
+    if (is<Document>(root))
+        return static_cast<Document&>(root).element_by_id_map();
+    if (is<DocumentFragment>(root))
+        return static_cast<DocumentFragment&>(root).element_by_id_map();
+    return nullptr;
+}
+
+void ElementByIdMap::remove_stale_elements(FlyString const& id, Vector<WeakPtr<Element>>& elements) const
+{
+    elements.remove_all_matching([&](auto& element) {
+        return !element || element->id() != id || &element->root() != &m_root;
+    });
+}
+
+void ElementByIdMap::add(FlyString const& id, Element& element)
+{
+    auto& elements = m_map.ensure(id);
+    remove_stale_elements(id, elements);
+    elements.remove_first_matching([&](auto& existing_element) { return existing_element.ptr() == &element; });
+
+    // Keep the elements in tree order, so that the first one is the one get_element_by_id() should return.
+    auto index = elements.find_first_index_if([&](auto& existing_element) {
+        return element.compare_document_position(existing_element.ptr()) & Node::DOCUMENT_POSITION_FOLLOWING;
+    });
+    if (index.has_value())
+        elements.insert(*index, element);
+    else
+        elements.append(element);
+}
+
+JS::GCPtr<Element> ElementByIdMap::get(FlyString const& id) const
+{
+    auto it = m_map.find(id);
+    if (it == m_map.end())
+        return nullptr;
+
+    remove_stale_elements(id, it->value);
+    if (it->value.is_empty()) {
+        m_map.remove(it);
+        return nullptr;
+    }
+    return it->value.first().ptr();
+}
+
+Vector<JS::NonnullGCPtr<Element>> ElementByIdMap::get_all(FlyString const& id) const
+{
+    auto it = m_map.find(id);
+    if (it == m_map.end())
+        return {};
+
+    remove_stale_elements(id, it->value);
+    Vector<JS::NonnullGCPtr<Element>> elements;
+    elements.ensure_capacity(it->value.size());
+    for (auto& element : it->value)
+        elements.unchecked_append(*element);
+    return elements;
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
+#include <AK/WeakPtr.h>
+#include <LibJS/Heap/GCPtr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::DOM {
+
+// Keeps track of the elements with an ID in a document or shadow root, so that looking one up doesn't need a tree walk.
+// NOTE: Entries are only ever added eagerly. An element that has left the tree, or whose ID has changed, is dropped the
+//       next time we look at the entries for its old ID.
+class ElementByIdMap {
+public:
+    explicit ElementByIdMap(Node& root)
+        : m_root(root)
+    {
+    }
+
+    // Returns the map of the given document or shadow root, or null for any other root.
+    static ElementByIdMap* for_root(Node&);
+
+    void add(FlyString const& id, Element&);
+    JS::GCPtr<Element> get(FlyString const& id) const;
+
+    // Returns every element with the given ID, in tree order.
+    Vector<JS::NonnullGCPtr<Element>> get_all(FlyString const& id) const;
+
+private:
+    void remove_stale_elements(FlyString const& id, Vector<WeakPtr<Element>>&) const;
+
+    Node& m_root;
+    mutable HashMap<FlyString, Vector<WeakPtr<Element>>> m_map;
+};
+
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Assertions.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -20,11 +21,14 @@
 #include <LibWeb/DOM/Slottable.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/DOM/Utils.h>
+#include <LibWeb/EventTiming/PerformanceEventTiming.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLSlotElement.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/UIEvents/MouseEvent.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 
@@ -81,7 +85,7 @@ bool EventDispatcher::inner_invoke(Event& event, Vector<JS::Handle<DOM::DOMEvent
         }
 
         // 9. If listener’s passive is true, then set event’s in passive listener flag.
-        if (listener->passive)
+        if (listener->passive == true)
             event.set_in_passive_listener(true);
 
         // 10. Call a user object’s operation with listener’s callback, "handleEvent", « event », and event’s currentTarget attribute value. If this throws an exception, then:
@@ -119,7 +123,22 @@ bool EventDispatcher::inner_invoke(Event& event, Vector<JS::Handle<DOM::DOMEvent
 }
 
 // https://dom.spec.whatwg.org/#concept-event-listener-invoke
-void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Phase phase)
+static Optional<FlyString> legacy_event_type(FlyString const& type)
+{
+    // If event’s type attribute value is a match for any of the strings in the first column in the following table,
+    // set event’s type attribute value to the string in the second column on the same row as the matching string.
+    if (type == HTML::EventNames::animationend)
+        return HTML::EventNames::webkitAnimationEnd;
+    if (type == HTML::EventNames::animationiteration)
+        return HTML::EventNames::webkitAnimationIteration;
+    if (type == HTML::EventNames::animationstart)
+        return HTML::EventNames::webkitAnimationStart;
+    if (type == HTML::EventNames::transitionend)
+        return HTML::EventNames::webkitTransitionEnd;
+    return {};
+}
+
+void EventDispatcher::set_targets_for_invocation(Event::PathEntry const& struct_, Event& event)
 {
     auto last_valid_shadow_adjusted_target = event.path().last_matching([&struct_](auto& entry) {
         return entry.index <= struct_.index && entry.shadow_adjusted_target;
@@ -136,6 +155,13 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
     // 3. Set event’s touch target list to struct’s touch target list.
     event.set_touch_target_list(struct_.touch_target_list);
+}
+
+// https://dom.spec.whatwg.org/#concept-event-listener-invoke
+void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Phase phase)
+{
+    // 1-3. Set event’s target, relatedTarget and touch target list for struct.
+    set_targets_for_invocation(struct_, event);
 
     // 4. If event’s stop propagation flag is set, then return.
     if (event.should_stop_propagation())
@@ -146,7 +172,8 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
     // 6. Let listeners be a clone of event’s currentTarget attribute value’s event listener list.
     // NOTE: This avoids event listeners added after this point from being run. Note that removal still has an effect due to the removed field.
-    auto listeners = event.current_target()->event_listener_list();
+    // NOTE: Inner invoke skips every listener whose type is not event’s type, so only those listeners are cloned.
+    auto listeners = event.current_target()->event_listener_list(event.type());
 
     // 7. Let invocationTargetInShadowTree be struct’s invocation-target-in-shadow-tree.
     bool invocation_target_in_shadow_tree = struct_.invocation_target_in_shadow_tree;
@@ -161,19 +188,15 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
         // 2. If event’s type attribute value is a match for any of the strings in the first column in the following table,
         //    set event’s type attribute value to the string in the second column on the same row as the matching string, and return otherwise.
-        if (event.type() == HTML::EventNames::animationend)
-            event.set_type(HTML::EventNames::webkitAnimationEnd);
-        else if (event.type() == HTML::EventNames::animationiteration)
-            event.set_type(HTML::EventNames::webkitAnimationIteration);
-        else if (event.type() == HTML::EventNames::animationstart)
-            event.set_type(HTML::EventNames::webkitAnimationStart);
-        else if (event.type() == HTML::EventNames::transitionend)
-            event.set_type(HTML::EventNames::webkitTransitionEnd);
-        else
+        auto legacy_type = legacy_event_type(event.type());
+        if (!legacy_type.has_value())
             return;
+        event.set_type(legacy_type.release_value());
 
         // 3. Inner invoke with event, listeners, phase, invocationTargetInShadowTree, and legacyOutputDidListenersThrowFlag if given.
-        inner_invoke(event, listeners, phase, invocation_target_in_shadow_tree);
+        // NOTE: No listener has run since listeners was cloned, so cloning the listeners of the legacy type now is equivalent.
+        auto legacy_listeners = event.current_target()->event_listener_list(event.type());
+        inner_invoke(event, legacy_listeners, phase, invocation_target_in_shadow_tree);
 
         // 4. Set event’s type attribute value to originalEventType.
         event.set_type(original_event_type);
@@ -186,6 +209,10 @@ bool EventDispatcher::dispatch(JS::NonnullGCPtr<EventTarget> target, Event& even
     // 1. Set event’s dispatch flag.
     event.set_dispatched(true);
 
+    // https://w3c.github.io/event-timing/#modifications-to-the-dom-specification
+    // Let timingEntry be the result of initializing event timing given event and the current high resolution time.
+    auto timing_entry = EventTiming::PerformanceEventTiming::initialize_event_timing(event, HighResolutionTime::current_high_resolution_time(HTML::relevant_global_object(*target)));
+
     // 2. Let targetOverride be target, if legacy target override flag is not given, and target’s associated Document otherwise. [HTML]
     // NOTE: legacy target override flag is only used by HTML and only when target is a Window object.
     JS::GCPtr<EventTarget> target_override;
@@ -339,37 +366,55 @@ bool EventDispatcher::dispatch(JS::NonnullGCPtr<EventTarget> target, Event& even
         if (activation_target)
             activation_target->legacy_pre_activation_behavior();
 
-        // 13. For each struct in event’s path, in reverse order:
-        for (auto& entry : event.path().in_reverse()) {
-            // 1. If struct’s shadow-adjusted target is non-null, then set event’s eventPhase attribute to AT_TARGET.
-            if (entry.shadow_adjusted_target)
-                event.set_phase(Event::Phase::AtTarget);
-            // 2. Otherwise, set event’s eventPhase attribute to CAPTURING_PHASE.
-            else
-                event.set_phase(Event::Phase::CapturingPhase);
-
-            // 3. Invoke with struct, event, "capturing", and legacyOutputDidListenersThrowFlag if given.
-            invoke(entry, event, Event::Phase::CapturingPhase);
-        }
-
-        // 14. For each struct in event’s path:
-        for (auto& entry : event.path()) {
-            // 1. If struct’s shadow-adjusted target is non-null, then set event’s eventPhase attribute to AT_TARGET.
-            if (entry.shadow_adjusted_target) {
-                event.set_phase(Event::Phase::AtTarget);
+        // NOTE: High-frequency events such as pointermove often have nobody listening for them anywhere along their path.
+        //       Invoking would then do nothing but update event’s target, relatedTarget and touch target list for each
+        //       struct in turn, so skip straight to the state left behind by the last struct that would have been invoked.
+        Optional<FlyString> legacy_type;
+        if (event.is_trusted())
+            legacy_type = legacy_event_type(event.type());
+        bool has_listeners_along_path = any_of(event.path(), [&](auto const& entry) {
+            return entry.invocation_target->has_event_listener(event.type())
+                || (legacy_type.has_value() && entry.invocation_target->has_event_listener(*legacy_type));
+        });
+        if (!has_listeners_along_path) {
+            auto last_invoked_struct = event.path().last_matching([&](auto const& entry) {
+                return entry.shadow_adjusted_target || event.bubbles();
+            });
+            if (last_invoked_struct.has_value())
+                set_targets_for_invocation(*last_invoked_struct, event);
+        } else {
+            // 13. For each struct in event’s path, in reverse order:
+            for (auto& entry : event.path().in_reverse()) {
+                // 1. If struct’s shadow-adjusted target is non-null, then set event’s eventPhase attribute to AT_TARGET.
+                if (entry.shadow_adjusted_target)
+                    event.set_phase(Event::Phase::AtTarget);
+                // 2. Otherwise, set event’s eventPhase attribute to CAPTURING_PHASE.
+                else
+                    event.set_phase(Event::Phase::CapturingPhase);
+
+                // 3. Invoke with struct, event, "capturing", and legacyOutputDidListenersThrowFlag if given.
+                invoke(entry, event, Event::Phase::CapturingPhase);
             }
-            // 2. Otherwise:
-            else {
-                // 1. If event’s bubbles attribute is false, then continue.
-                if (!event.bubbles())
-                    continue;
 
-                // 2. Set event’s eventPhase attribute to BUBBLING_PHASE.
-                event.set_phase(Event::Phase::BubblingPhase);
-            }
+            // 14. For each struct in event’s path:
+            for (auto& entry : event.path()) {
+                // 1. If struct’s shadow-adjusted target is non-null, then set event’s eventPhase attribute to AT_TARGET.
+                if (entry.shadow_adjusted_target) {
+                    event.set_phase(Event::Phase::AtTarget);
+                }
+                // 2. Otherwise:
+                else {
+                    // 1. If event’s bubbles attribute is false, then continue.
+                    if (!event.bubbles())
+                        continue;
+
+                    // 2. Set event’s eventPhase attribute to BUBBLING_PHASE.
+                    event.set_phase(Event::Phase::BubblingPhase);
+                }
 
-            // 3. Invoke with struct, event, "bubbling", and legacyOutputDidListenersThrowFlag if given.
-            invoke(entry, event, Event::Phase::BubblingPhase);
+                // 3. Invoke with struct, event, "bubbling", and legacyOutputDidListenersThrowFlag if given.
+                invoke(entry, event, Event::Phase::BubblingPhase);
+            }
         }
     }
 
@@ -412,6 +457,11 @@ bool EventDispatcher::dispatch(JS::NonnullGCPtr<EventTarget> target, Event& even
         }
     }
 
+    // https://w3c.github.io/event-timing/#modifications-to-the-dom-specification
+    // Finalize event timing passing timingEntry, event, target, and the current high resolution time as inputs.
+    if (timing_entry)
+        EventTiming::PerformanceEventTiming::finalize_event_timing(timing_entry, event, *target, HighResolutionTime::current_high_resolution_time(HTML::relevant_global_object(*target)));
+
     // 12. Return false if event’s canceled flag is set; otherwise true.
     return !event.cancelled();
 }
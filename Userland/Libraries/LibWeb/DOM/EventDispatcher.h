@@ -17,6 +17,7 @@ public:
     static bool dispatch(JS::NonnullGCPtr<EventTarget>, Event&, bool legacy_target_override = false);
 
 private:
+    static void set_targets_for_invocation(Event::PathEntry const&, Event&);
     static void invoke(Event::PathEntry&, Event&, Event::Phase);
     static bool inner_invoke(Event&, Vector<JS::Handle<DOM::DOMEventListener>>&, Event::Phase, bool);
 };
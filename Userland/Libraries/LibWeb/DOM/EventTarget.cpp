@@ -71,18 +71,23 @@ void EventTarget::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
 
     if (auto const* data = m_data.ptr()) {
-        visitor.visit(data->event_listener_list);
+        for (auto const& it : data->event_listener_list)
+            visitor.visit(it.value);
         visitor.visit(data->event_handler_map);
     }
 }
 
-Vector<JS::Handle<DOMEventListener>> EventTarget::event_listener_list()
+Vector<JS::Handle<DOMEventListener>> EventTarget::event_listener_list(FlyString const& type)
 {
     Vector<JS::Handle<DOMEventListener>> list;
     if (!m_data)
         return list;
-    for (auto& listener : m_data->event_listener_list)
-        list.append(*listener);
+    auto it = m_data->event_listener_list.find(type);
+    if (it == m_data->event_listener_list.end())
+        return list;
+    list.ensure_capacity(it->value.size());
+    for (auto& listener : it->value)
+        list.unchecked_append(*listener);
     return list;
 }
 
@@ -109,7 +114,7 @@ static bool flatten_event_listener_options(Variant<AddEventListenerOptions, bool
 
 struct FlattenedAddEventListenerOptions {
     bool capture { false };
-    bool passive { false };
+    Optional<bool> passive;
     bool once { false };
     JS::GCPtr<AbortSignal> signal;
 };
@@ -120,22 +125,25 @@ static FlattenedAddEventListenerOptions flatten_add_event_listener_options(Varia
     // 1. Let capture be the result of flattening options.
     bool capture = flatten_event_listener_options(options);
 
-    // 2. Let once and passive be false.
+    // 2. Let once be false.
     bool once = false;
-    bool passive = false;
 
-    // 3. Let signal be null.
+    // 3. Let passive and signal be null.
+    Optional<bool> passive;
     JS::GCPtr<AbortSignal> signal;
 
     // 4. If options is a dictionary, then:
     if (options.has<AddEventListenerOptions>()) {
         auto& add_event_listener_options = options.get<AddEventListenerOptions>();
 
-        // 1. Set passive to options["passive"] and once to options["once"].
-        passive = add_event_listener_options.passive;
+        // 1. Set once to options["once"].
         once = add_event_listener_options.once;
 
-        // 2. If options["signal"] exists, then set signal to options["signal"].
+        // 2. If options["passive"] exists, then set passive to options["passive"].
+        if (add_event_listener_options.passive.has_value())
+            passive = add_event_listener_options.passive;
+
+        // 3. If options["signal"] exists, then set signal to options["signal"].
         if (add_event_listener_options.signal)
             signal = add_event_listener_options.signal;
     }
@@ -168,6 +176,31 @@ void EventTarget::add_event_listener_without_options(FlyString const& type, IDLE
     add_event_listener(type, &callback, AddEventListenerOptions {});
 }
 
+// https://dom.spec.whatwg.org/#default-passive-value
+static bool default_passive_value(FlyString const& type, EventTarget const& event_target)
+{
+    // 1. If type is one of "touchstart", "touchmove", "wheel", and "mousewheel", then return true if one of the following are true:
+    if (type == UIEvents::EventNames::wheel || type.is_one_of("touchstart"sv, "touchmove"sv, "mousewheel"sv)) {
+        // - eventTarget is a Window object
+        if (is<HTML::Window>(event_target))
+            return true;
+
+        if (is<Node>(event_target)) {
+            auto const& node = static_cast<Node const&>(event_target);
+            auto const& document = node.document();
+
+            // - eventTarget is a node whose node document is eventTarget
+            // - eventTarget is a node whose node document’s document element is eventTarget
+            // - eventTarget is a node whose node document’s body element is eventTarget
+            if (&document == &node || document.document_element() == &node || document.body() == &node)
+                return true;
+        }
+    }
+
+    // 2. Return false.
+    return false;
+}
+
 // https://dom.spec.whatwg.org/#add-an-event-listener
 void EventTarget::add_an_event_listener(DOMEventListener& listener)
 {
@@ -175,8 +208,6 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
     //           and listener’s type matches the type attribute value of any of the service worker events, then report a warning to the console
     //           that this might not give the expected results. [SERVICE-WORKERS]
 
-    auto& event_listener_list = ensure_data().event_listener_list;
-
     // 2. If listener’s signal is not null and is aborted, then return.
     if (listener.signal && listener.signal->aborted())
         return;
@@ -185,17 +216,22 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
     if (!listener.callback)
         return;
 
-    // 4. If eventTarget’s event listener list does not contain an event listener whose type is listener’s type, callback is listener’s callback,
+    // 4. If listener’s passive is null, then set it to the default passive value given listener’s type and eventTarget.
+    if (!listener.passive.has_value())
+        listener.passive = default_passive_value(listener.type, *this);
+
+    auto& event_listener_list = ensure_data().event_listener_list.ensure(listener.type);
+
+    // 5. If eventTarget’s event listener list does not contain an event listener whose type is listener’s type, callback is listener’s callback,
     //    and capture is listener’s capture, then append listener to eventTarget’s event listener list.
     auto it = event_listener_list.find_if([&](auto& entry) {
-        return entry->type == listener.type
-            && entry->callback->callback().callback == listener.callback->callback().callback
+        return entry->callback->callback().callback == listener.callback->callback().callback
             && entry->capture == listener.capture;
     });
     if (it == event_listener_list.end())
         event_listener_list.append(listener);
 
-    // 5. If listener’s signal is not null, then add the following abort steps to it:
+    // 6. If listener’s signal is not null, then add the following abort steps to it:
     if (listener.signal) {
         // NOTE: `this` and `listener` are protected by AbortSignal using JS::SafeFunction.
         listener.signal->add_abort_algorithm([this, &listener] {
@@ -208,7 +244,12 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
 // https://dom.spec.whatwg.org/#dom-eventtarget-removeeventlistener
 void EventTarget::remove_event_listener(FlyString const& type, IDLEventListener* callback, Variant<EventListenerOptions, bool> const& options)
 {
-    auto& event_listener_list = ensure_data().event_listener_list;
+    if (!m_data)
+        return;
+    auto event_listener_list_for_type = m_data->event_listener_list.find(type);
+    if (event_listener_list_for_type == m_data->event_listener_list.end())
+        return;
+    auto& event_listener_list = event_listener_list_for_type->value;
 
     // 1. Let capture be the result of flattening options.
     bool capture = flatten_event_listener_options(options);
@@ -223,8 +264,7 @@ void EventTarget::remove_event_listener(FlyString const& type, IDLEventListener*
         return entry.callback->callback().callback == callback->callback().callback;
     };
     auto it = event_listener_list.find_if([&](auto& entry) {
-        return entry->type == type
-            && callbacks_match(*entry)
+        return callbacks_match(*entry)
             && entry->capture == capture;
     });
     if (it != event_listener_list.end())
@@ -245,14 +285,19 @@ void EventTarget::remove_an_event_listener(DOMEventListener& listener)
     // 2. Set listener’s removed to true and remove listener from eventTarget’s event listener list.
     listener.removed = true;
     VERIFY(m_data);
-    m_data->event_listener_list.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; });
+    remove_from_event_listener_list(listener);
 }
 
 void EventTarget::remove_from_event_listener_list(DOMEventListener& listener)
 {
     if (!m_data)
         return;
-    m_data->event_listener_list.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; });
+    auto it = m_data->event_listener_list.find(listener.type);
+    if (it == m_data->event_listener_list.end())
+        return;
+    it->value.remove_first_matching([&](auto& entry) { return entry.ptr() == &listener; });
+    if (it->value.is_empty())
+        m_data->event_listener_list.remove(it);
 }
 
 // https://dom.spec.whatwg.org/#dom-eventtarget-dispatchevent
@@ -834,13 +879,7 @@ bool EventTarget::dispatch_event(Event& event)
 
 bool EventTarget::has_event_listener(FlyString const& type) const
 {
-    if (!m_data)
-        return false;
-    for (auto& listener : m_data->event_listener_list) {
-        if (listener->type == type)
-            return true;
-    }
-    return false;
+    return m_data && m_data->event_listener_list.contains(type);
 }
 
 bool EventTarget::has_event_listeners() const
@@ -44,7 +44,7 @@ public:
     void remove_an_event_listener(DOMEventListener&);
     void remove_from_event_listener_list(DOMEventListener&);
 
-    Vector<JS::Handle<DOMEventListener>> event_listener_list();
+    Vector<JS::Handle<DOMEventListener>> event_listener_list(FlyString const& type);
 
     virtual bool has_activation_behavior() const;
     virtual void activation_behavior(Event const&);
@@ -70,7 +70,9 @@ protected:
 
 private:
     struct Data {
-        Vector<JS::NonnullGCPtr<DOMEventListener>> event_listener_list;
+        // NOTE: The event listener list is kept grouped by type, so that dispatch only has to look at the listeners that
+        //       can actually be invoked for an event. The order of listeners of different types is not observable.
+        HashMap<FlyString, Vector<JS::NonnullGCPtr<DOMEventListener>>> event_listener_list;
 
         // https://html.spec.whatwg.org/multipage/webappapis.html#event-handler-map
         // Spec Note: The order of the entries of event handler map could be arbitrary. It is not observable through any algorithms that operate on the map.
@@ -74,28 +74,52 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
     }
 }
 
-void HTMLCollection::update_cache_if_needed() const
+void HTMLCollection::invalidate_cache_if_needed() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // Nothing to do, our subtree hasn't changed since we started building the cache.
+    if (m_cached_dom_tree_version == root()->dom_tree_version())
         return;
 
     m_cached_elements.clear();
+    m_cached_elements_are_complete = false;
     m_cached_name_to_element_mappings = nullptr;
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child_of_type<Element>([&](auto& element) {
-            if (m_filter(element))
-                m_cached_elements.append(element);
-            return IterationDecision::Continue;
-        });
+    m_cached_dom_tree_version = root()->dom_tree_version();
+}
+
+// NOTE: The cache is filled in lazily, so that only looking at the first few elements of a large collection doesn't
+//       require walking the whole subtree. If an index is given, we stop as soon as the cache contains that index.
+void HTMLCollection::update_cache_if_needed(Optional<size_t> up_to_index) const
+{
+    invalidate_cache_if_needed();
+
+    auto cache_is_filled_enough = [&] {
+        if (m_cached_elements_are_complete)
+            return true;
+        return up_to_index.has_value() && up_to_index.value() < m_cached_elements.size();
+    };
+    if (cache_is_filled_enough())
+        return;
+
+    auto& root = const_cast<ParentNode&>(*m_root);
+    auto next_node = [&](Node& node) -> Node* {
+        if (m_scope == Scope::Descendants)
+            return node.next_in_pre_order(&root);
+        return node.next_sibling();
+    };
+
+    // Resume from where we left off last time.
+    auto* node = m_cached_elements.is_empty() ? root.first_child() : next_node(*m_cached_elements.last());
+    for (; node; node = next_node(*node)) {
+        if (!is<Element>(*node))
+            continue;
+        auto& element = static_cast<Element&>(*node);
+        if (!m_filter(element))
+            continue;
+        m_cached_elements.append(element);
+        if (cache_is_filled_enough())
+            return;
     }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cached_elements_are_complete = true;
 }
 
 JS::MarkedVector<JS::NonnullGCPtr<Element>> HTMLCollection::collect_matching_elements() const
@@ -119,7 +143,7 @@ size_t HTMLCollection::length() const
 Element* HTMLCollection::item(size_t index) const
 {
     // The item(index) method steps are to return the indexth element in the collection. If there is no indexth element in the collection, then the method must return null.
-    update_cache_if_needed();
+    update_cache_if_needed(index);
     if (index >= m_cached_elements.size())
         return nullptr;
     return m_cached_elements[index];
@@ -56,11 +56,13 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    void update_cache_if_needed() const;
+    void invalidate_cache_if_needed() const;
+    void update_cache_if_needed(Optional<size_t> up_to_index = {}) const;
     void update_name_to_element_mappings_if_needed() const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    mutable Optional<u64> m_cached_dom_tree_version;
     mutable Vector<JS::NonnullGCPtr<Element>> m_cached_elements;
+    mutable bool m_cached_elements_are_complete { false };
     mutable OwnPtr<OrderedHashMap<FlyString, JS::NonnullGCPtr<Element>>> m_cached_name_to_element_mappings;
 
     JS::NonnullGCPtr<ParentNode> m_root;
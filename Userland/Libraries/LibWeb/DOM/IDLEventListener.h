@@ -19,7 +19,7 @@ struct EventListenerOptions {
 };
 
 struct AddEventListenerOptions : public EventListenerOptions {
-    bool passive { false };
+    Optional<bool> passive;
     bool once { false };
     JS::GCPtr<AbortSignal> signal;
 };
@@ -33,25 +33,50 @@ void LiveNodeList::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_root);
+    visitor.visit(m_cached_nodes);
 }
 
-JS::MarkedVector<Node*> LiveNodeList::collection() const
+void LiveNodeList::invalidate_cache_if_needed() const
 {
-    JS::MarkedVector<Node*> nodes(heap());
-    if (m_scope == Scope::Descendants) {
-        m_root->for_each_in_subtree([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return TraversalDecision::Continue;
-        });
-    } else {
-        m_root->for_each_child([&](auto& node) {
-            if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
-            return IterationDecision::Continue;
-        });
+    // Nothing to do, our subtree hasn't changed since we started building the cache.
+    if (m_cached_dom_tree_version == m_root->dom_tree_version())
+        return;
+
+    m_cached_nodes.clear();
+    m_cached_nodes_are_complete = false;
+    m_cached_dom_tree_version = m_root->dom_tree_version();
+}
+
+// NOTE: Just like HTMLCollection, the cache is filled in lazily, and only as far as the requested index if one is given.
+void LiveNodeList::update_cache_if_needed(Optional<size_t> up_to_index) const
+{
+    invalidate_cache_if_needed();
+
+    auto cache_is_filled_enough = [&] {
+        if (m_cached_nodes_are_complete)
+            return true;
+        return up_to_index.has_value() && up_to_index.value() < m_cached_nodes.size();
+    };
+    if (cache_is_filled_enough())
+        return;
+
+    auto& root = const_cast<Node&>(*m_root);
+    auto next_node = [&](Node& node) -> Node* {
+        if (m_scope == Scope::Descendants)
+            return node.next_in_pre_order(&root);
+        return node.next_sibling();
+    };
+
+    // Resume from where we left off last time.
+    auto* node = m_cached_nodes.is_empty() ? root.first_child() : next_node(*m_cached_nodes.last());
+    for (; node; node = next_node(*node)) {
+        if (!m_filter(*node))
+            continue;
+        m_cached_nodes.append(*node);
+        if (cache_is_filled_enough())
+            return;
     }
-    return nodes;
+    m_cached_nodes_are_complete = true;
 }
 
 Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) const
@@ -80,17 +105,18 @@ Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) co
 // https://dom.spec.whatwg.org/#dom-nodelist-length
 u32 LiveNodeList::length() const
 {
-    return collection().size();
+    update_cache_if_needed();
+    return m_cached_nodes.size();
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-item
 Node const* LiveNodeList::item(u32 index) const
 {
     // The item(index) method must return the indexth node in the collection. If there is no indexth node in the collection, then the method must return null.
-    auto nodes = collection();
-    if (index >= nodes.size())
+    update_cache_if_needed(index);
+    if (index >= m_cached_nodes.size())
         return nullptr;
-    return nodes[index];
+    return m_cached_nodes[index];
 }
 
 }
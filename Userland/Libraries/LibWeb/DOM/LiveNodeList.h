@@ -12,8 +12,6 @@
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
-
 class LiveNodeList : public NodeList {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
     JS_DECLARE_ALLOCATOR(LiveNodeList);
@@ -38,7 +36,12 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    JS::MarkedVector<Node*> collection() const;
+    void invalidate_cache_if_needed() const;
+    void update_cache_if_needed(Optional<size_t> up_to_index = {}) const;
+
+    mutable Optional<u64> m_cached_dom_tree_version;
+    mutable Vector<JS::NonnullGCPtr<Node>> m_cached_nodes;
+    mutable bool m_cached_nodes_are_complete { false };
 
     JS::NonnullGCPtr<Node const> m_root;
     Function<bool(Node const&)> m_filter;
@@ -102,13 +102,13 @@ void Node::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_last_child);
     visitor.visit(m_next_sibling);
     visitor.visit(m_previous_sibling);
-    visitor.visit(m_child_nodes);
 
     visitor.visit(m_layout_node);
     visitor.visit(m_paintable);
 
-    if (m_registered_observer_list) {
-        visitor.visit(*m_registered_observer_list);
+    if (m_rare_data) {
+        visitor.visit(m_rare_data->registered_observer_list);
+        visitor.visit(m_rare_data->child_nodes);
     }
 }
 
@@ -214,10 +214,10 @@ void Node::set_text_content(Optional<String> const& maybe_content)
         } else {
             invalidate_style(StyleInvalidationReason::NodeSetTextContent);
         }
-        document().invalidate_layout_tree();
+        document().invalidate_layout_subtree(*this);
     }
 
-    document().bump_dom_tree_version();
+    bump_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#dom-node-normalize
@@ -395,6 +395,14 @@ JS::GCPtr<HTML::Navigable> Node::navigable() const
 
 void Node::invalidate_style(StyleInvalidationReason reason)
 {
+    invalidate_style(reason, CSS::InvalidationSet::everything());
+}
+
+void Node::invalidate_style(StyleInvalidationReason reason, CSS::InvalidationSet const& invalidation_set)
+{
+    if (invalidation_set.is_empty())
+        return;
+
     if (is_character_data())
         return;
 
@@ -415,11 +423,9 @@ void Node::invalidate_style(StyleInvalidationReason reason)
     }
 
     // When invalidating style for a node, we actually invalidate:
-    // - the node itself
-    // - all of its descendants
+    // - the node itself and all of its descendants (unless only the descendants are affected)
     // - all of its preceding siblings and their descendants (only on DOM insert/remove)
-    // - all of its subsequent siblings and their descendants
-    // FIXME: This is a lot of invalidation and we should implement more sophisticated invalidation to do less work!
+    // - all of its subsequent siblings and their descendants (if the invalidation set says so)
 
     auto invalidate_entire_subtree = [&](Node& subtree_root) {
         subtree_root.for_each_in_inclusive_subtree([&](Node& node) {
@@ -436,7 +442,17 @@ void Node::invalidate_style(StyleInvalidationReason reason)
         });
     };
 
-    invalidate_entire_subtree(*this);
+    if (invalidation_set.invalidate_self) {
+        invalidate_entire_subtree(*this);
+    } else if (invalidation_set.invalidate_descendants) {
+        for_each_child([&](Node& child) {
+            invalidate_entire_subtree(child);
+            return IterationDecision::Continue;
+        });
+        if (auto shadow_root = is_element() ? static_cast<DOM::Element&>(*this).shadow_root() : nullptr)
+            invalidate_entire_subtree(*shadow_root);
+        m_child_needs_style_update = true;
+    }
 
     if (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove) {
         for (auto* sibling = previous_sibling(); sibling; sibling = sibling->previous_sibling()) {
@@ -445,9 +461,11 @@ void Node::invalidate_style(StyleInvalidationReason reason)
         }
     }
 
-    for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
-        if (sibling->is_element())
-            invalidate_entire_subtree(*sibling);
+    if (invalidation_set.invalidate_siblings) {
+        for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
+            if (sibling->is_element())
+                invalidate_entire_subtree(*sibling);
+        }
     }
 
     for (auto* ancestor = parent_or_shadow_host(); ancestor; ancestor = ancestor->parent_or_shadow_host())
@@ -503,6 +521,13 @@ bool Node::is_connected() const
     return shadow_including_root().is_document();
 }
 
+void Node::bump_dom_tree_version()
+{
+    // NOTE: A change in this node's subtree is also a change in the subtree of each of its ancestors.
+    for (auto* node = this; node; node = node->parent())
+        ++node->m_dom_tree_version;
+}
+
 // https://html.spec.whatwg.org/multipage/infrastructure.html#browsing-context-connected
 bool Node::is_browsing_context_connected() const
 {
@@ -689,10 +714,10 @@ void Node::insert_before(JS::NonnullGCPtr<Node> node, JS::GCPtr<Node> child, boo
     if (is_connected()) {
         // FIXME: This will need to become smarter when we implement the :has() selector.
         invalidate_style(StyleInvalidationReason::ParentOfInsertedNode);
-        document().invalidate_layout_tree();
+        document().invalidate_layout_subtree(*this);
     }
 
-    document().bump_dom_tree_version();
+    bump_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-pre-insert
@@ -867,9 +892,9 @@ void Node::remove(bool suppress_observers)
     //     if registered’s options["subtree"] is true, then append a new transient registered observer
     //     whose observer is registered’s observer, options is registered’s options, and source is registered to node’s registered observer list.
     for (auto* inclusive_ancestor = parent; inclusive_ancestor; inclusive_ancestor = inclusive_ancestor->parent()) {
-        if (!inclusive_ancestor->m_registered_observer_list)
+        if (!inclusive_ancestor->m_rare_data)
             continue;
-        for (auto& registered : *inclusive_ancestor->m_registered_observer_list) {
+        for (auto& registered : inclusive_ancestor->m_rare_data->registered_observer_list) {
             if (registered->options().subtree) {
                 auto transient_observer = TransientRegisteredObserver::create(registered->observer(), registered->options(), registered);
                 add_registered_observer(move(transient_observer));
@@ -900,11 +925,11 @@ void Node::remove(bool suppress_observers)
         // NOTE: If we didn't have a layout node before, rebuilding the layout tree isn't gonna give us one
         //       after we've been removed from the DOM.
         if (had_layout_node) {
-            document().invalidate_layout_tree();
+            document().invalidate_layout_subtree(*parent);
         }
     }
 
-    document().bump_dom_tree_version();
+    parent->bump_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-replace
@@ -1222,12 +1247,13 @@ Slottable Node::as_slottable()
 
 JS::NonnullGCPtr<NodeList> Node::child_nodes()
 {
-    if (!m_child_nodes) {
-        m_child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, [](auto&) {
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.child_nodes) {
+        rare_data.child_nodes = LiveNodeList::create(realm(), *this, LiveNodeList::Scope::Children, [](auto&) {
             return true;
         });
     }
-    return *m_child_nodes;
+    return *rare_data.child_nodes;
 }
 
 Vector<JS::Handle<Node>> Node::children_as_vector() const
@@ -1951,20 +1977,31 @@ Painting::PaintableBox* Node::paintable_box()
 // https://dom.spec.whatwg.org/#queue-a-mutation-record
 void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> const& attribute_name, Optional<FlyString> const& attribute_namespace, Optional<String> const& old_value, Vector<JS::Handle<Node>> added_nodes, Vector<JS::Handle<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling) const
 {
+    // OPTIMIZATION: If there are no mutation observers in this agent at all, none of them can be interested in this mutation,
+    //               and we don't need to look through the registered observers of each inclusive ancestor.
+    auto& agent_custom_data = verify_cast<Bindings::WebEngineCustomData>(*vm().custom_data());
+    if (agent_custom_data.mutation_observers.is_empty())
+        return;
+
     // NOTE: We defer garbage collection until the end of the scope, since we can't safely use MutationObserver* as a hashmap key otherwise.
     // FIXME: This is a total hack.
     JS::DeferGC defer_gc(heap());
 
     // 1. Let interestedObservers be an empty map.
     // mutationObserver -> mappedOldValue
-    OrderedHashMap<MutationObserver*, Optional<String>> interested_observers;
+    // NOTE: There are rarely more than a handful of interested observers, so this is kept inline rather than in a hash map.
+    struct InterestedObserver {
+        MutationObserver* observer { nullptr };
+        Optional<String> mapped_old_value;
+    };
+    Vector<InterestedObserver, 4> interested_observers;
 
     // 2. Let nodes be the inclusive ancestors of target.
     // 3. For each node in nodes, and then for each registered of node’s registered observer list:
     for (auto* node = this; node; node = node->parent()) {
-        if (!node->m_registered_observer_list)
+        if (!node->m_rare_data)
             continue;
-        for (auto& registered_observer : *node->m_registered_observer_list) {
+        for (auto& registered_observer : node->m_rare_data->registered_observer_list) {
             // 1. Let options be registered’s options.
             auto& options = registered_observer->options();
 
@@ -1984,12 +2021,15 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
                 auto mutation_observer = registered_observer->observer();
 
                 // 2. If interestedObservers[mo] does not exist, then set interestedObservers[mo] to null.
-                if (!interested_observers.contains(mutation_observer))
-                    interested_observers.set(mutation_observer, {});
+                auto index = interested_observers.find_first_index_if([&](auto& entry) { return entry.observer == mutation_observer.ptr(); });
+                if (!index.has_value()) {
+                    index = interested_observers.size();
+                    interested_observers.append({ mutation_observer.ptr(), {} });
+                }
 
                 // 3. If either type is "attributes" and options["attributeOldValue"] is true, or type is "characterData" and options["characterDataOldValue"] is true, then set interestedObservers[mo] to oldValue.
                 if ((type == MutationType::attributes && options.attribute_old_value.has_value() && options.attribute_old_value.value()) || (type == MutationType::characterData && options.character_data_old_value.has_value() && options.character_data_old_value.value()))
-                    interested_observers.set(mutation_observer, old_value);
+                    interested_observers[*index].mapped_old_value = old_value;
             }
         }
     }
@@ -2013,10 +2053,10 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
 
         // 1. Let record be a new MutationRecord object with its type set to type, target set to target, attributeName set to name, attributeNamespace set to namespace, oldValue set to mappedOldValue,
         //    addedNodes set to addedNodes, removedNodes set to removedNodes, previousSibling set to previousSibling, and nextSibling set to nextSibling.
-        auto record = MutationRecord::create(realm(), type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, /* mappedOldValue */ interested_observer.value);
+        auto record = MutationRecord::create(realm(), type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, /* mappedOldValue */ interested_observer.mapped_old_value);
 
         // 2. Enqueue record to observer’s record queue.
-        interested_observer.key->enqueue_record({}, move(record));
+        interested_observer.observer->enqueue_record({}, move(record));
     }
 
     // 5. Queue a mutation observer microtask.
@@ -2419,11 +2459,16 @@ ErrorOr<void> Node::prepend_with_space(StringBuilder x, StringView const& result
     return {};
 }
 
+Node::RareData& Node::ensure_rare_data()
+{
+    if (!m_rare_data)
+        m_rare_data = make<RareData>();
+    return *m_rare_data;
+}
+
 void Node::add_registered_observer(RegisteredObserver& registered_observer)
 {
-    if (!m_registered_observer_list)
-        m_registered_observer_list = make<Vector<JS::NonnullGCPtr<RegisteredObserver>>>();
-    m_registered_observer_list->append(registered_observer);
+    ensure_rare_data().registered_observer_list.append(registered_observer);
 }
 
 }
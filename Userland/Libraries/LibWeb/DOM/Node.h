@@ -234,6 +234,11 @@ public:
     Element* parent_element();
     Element const* parent_element() const;
 
+    // AD-HOC: This number increments whenever a node is added to or removed from this node's subtree, or an attribute changes
+    //         on an element in it. It can be used as a crude invalidation mechanism for caches that depend on the subtree.
+    u64 dom_tree_version() const { return m_dom_tree_version; }
+    void bump_dom_tree_version();
+
     virtual void inserted();
     virtual void removed_from(Node*);
     virtual void children_changed() { }
@@ -262,6 +267,7 @@ public:
     void set_child_needs_style_update(bool b) { m_child_needs_style_update = b; }
 
     void invalidate_style(StyleInvalidationReason);
+    void invalidate_style(StyleInvalidationReason, CSS::InvalidationSet const&);
 
     void set_document(Badge<Document>, Document&);
 
@@ -308,8 +314,8 @@ public:
 
     size_t length() const;
 
-    auto& registered_observer_list() { return m_registered_observer_list; }
-    auto const& registered_observer_list() const { return m_registered_observer_list; }
+    Vector<JS::NonnullGCPtr<RegisteredObserver>>* registered_observer_list() { return m_rare_data ? &m_rare_data->registered_observer_list : nullptr; }
+    Vector<JS::NonnullGCPtr<RegisteredObserver>> const* registered_observer_list() const { return m_rare_data ? &m_rare_data->registered_observer_list : nullptr; }
 
     void add_registered_observer(RegisteredObserver&);
 
@@ -754,9 +760,18 @@ protected:
 
     i32 m_unique_id {};
 
-    // https://dom.spec.whatwg.org/#registered-observer-list
-    // "Nodes have a strong reference to registered observers in their registered observer list." https://dom.spec.whatwg.org/#garbage-collection
-    OwnPtr<Vector<JS::NonnullGCPtr<RegisteredObserver>>> m_registered_observer_list;
+    u64 m_dom_tree_version { 0 };
+
+    // NOTE: Most nodes never have any of these, so they are kept out of line to make nodes smaller.
+    struct RareData {
+        // https://dom.spec.whatwg.org/#registered-observer-list
+        // "Nodes have a strong reference to registered observers in their registered observer list." https://dom.spec.whatwg.org/#garbage-collection
+        Vector<JS::NonnullGCPtr<RegisteredObserver>> registered_observer_list;
+
+        JS::GCPtr<NodeList> child_nodes;
+    };
+    RareData& ensure_rare_data();
+    OwnPtr<RareData> m_rare_data;
 
     void build_accessibility_tree(AccessibilityTreeNode& parent);
 
@@ -780,8 +795,6 @@ private:
     JS::GCPtr<Node> m_last_child;
     JS::GCPtr<Node> m_next_sibling;
     JS::GCPtr<Node> m_previous_sibling;
-
-    JS::GCPtr<NodeList> m_child_nodes;
 };
 
 }
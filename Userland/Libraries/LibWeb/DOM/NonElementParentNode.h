@@ -9,6 +9,7 @@
 #include <AK/FlyString.h>
 #include <AK/Forward.h>
 #include <LibJS/Heap/GCPtr.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/TreeNode.h>
@@ -20,6 +21,9 @@ class NonElementParentNode {
 public:
     JS::GCPtr<Element> get_element_by_id(FlyString const& id) const
     {
+        if (auto* element_by_id_map = static_cast<NodeType const*>(this)->element_by_id_map())
+            return element_by_id_map->get(id);
+
         JS::GCPtr<Element> found_element;
         const_cast<NodeType*>(static_cast<NodeType const*>(this))->template for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
             if (element.id() == id) {
@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -23,6 +24,82 @@ namespace Web::DOM {
 
 JS_DEFINE_ALLOCATOR(ParentNode);
 
+// If the selector can only match elements that are, or are inside of, an element with a given ID, returns that ID.
+static Optional<FlyString> anchor_id_for_selector(CSS::Selector const& selector)
+{
+    auto const& compound_selectors = selector.compound_selectors();
+    for (size_t i = 1; i < compound_selectors.size(); ++i) {
+        auto combinator = compound_selectors[i].combinator;
+        if (combinator != CSS::Selector::Combinator::Descendant && combinator != CSS::Selector::Combinator::ImmediateChild)
+            return {};
+    }
+
+    if (compound_selectors.first().combinator != CSS::Selector::Combinator::None)
+        return {};
+    for (auto const& simple_selector : compound_selectors.first().simple_selectors) {
+        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id)
+            return simple_selector.name();
+    }
+    return {};
+}
+
+// Calls the callback for each element in the scope's subtree that matches the selectors, in tree order, until it returns TraversalDecision::Break.
+template<typename Callback>
+static void for_each_element_matching_selectors(ParentNode& scope, CSS::SelectorList const& selectors, Callback callback)
+{
+    Vector<bool> can_use_fast_matches;
+    can_use_fast_matches.ensure_capacity(selectors.size());
+    for (auto const& selector : selectors)
+        can_use_fast_matches.unchecked_append(!selector->pseudo_element().has_value() && SelectorEngine::can_use_fast_matches(selector));
+
+    auto matches = [&](Element const& element) {
+        for (size_t i = 0; i < selectors.size(); ++i) {
+            if (can_use_fast_matches[i] ? SelectorEngine::fast_matches(selectors[i], {}, element, nullptr) : SelectorEngine::matches(selectors[i], {}, element, nullptr, {}, &scope))
+                return true;
+        }
+        return false;
+    };
+
+    auto visit_subtree = [&](Node& root) {
+        return root.for_each_in_subtree_of_type<Element>([&](auto& element) {
+            if (matches(element))
+                return callback(element);
+            return TraversalDecision::Continue;
+        });
+    };
+
+    // If the selector is anchored at an ID, only the subtrees of the elements with that ID can contain matches, and the
+    // ID index of our root tells us where those are.
+    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
+    if (auto anchor_id = selectors.size() == 1 ? anchor_id_for_selector(selectors.first()) : Optional<FlyString> {}; anchor_id.has_value()) {
+        if (auto* element_by_id_map = ElementByIdMap::for_root(scope.root())) {
+            JS::GCPtr<Element> previous_anchor;
+            for (auto& anchor : element_by_id_map->get_all(*anchor_id)) {
+                // An anchor inside the subtree of the previous one has been looked at already.
+                if (previous_anchor && anchor->is_descendant_of(*previous_anchor))
+                    continue;
+                previous_anchor = anchor;
+
+                // If the anchor contains the scope, everything in the scope is a candidate, and there's nothing left to look at after it.
+                if (anchor->is_inclusive_ancestor_of(scope)) {
+                    visit_subtree(scope);
+                    return;
+                }
+
+                if (!anchor->is_descendant_of(scope))
+                    continue;
+                if (matches(*anchor) && callback(*anchor) == TraversalDecision::Break)
+                    return;
+                if (visit_subtree(*anchor) == TraversalDecision::Break)
+                    return;
+            }
+            return;
+        }
+    }
+
+    visit_subtree(scope);
+}
+
 // https://dom.spec.whatwg.org/#dom-parentnode-queryselector
 WebIDL::ExceptionOr<JS::GCPtr<Element>> ParentNode::query_selector(StringView selector_text)
 {
@@ -32,25 +109,19 @@ WebIDL::ExceptionOr<JS::GCPtr<Element>> ParentNode::query_selector(StringView se
     // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    auto maybe_selectors = document().parse_selector_for_query(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector"_fly_string);
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
 
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     JS::GCPtr<Element> result;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    for_each_in_subtree_of_type<Element>([&](auto& element) {
-        for (auto& selector : selectors) {
-            if (SelectorEngine::matches(selector, {}, element, nullptr, {}, this)) {
-                result = &element;
-                return TraversalDecision::Break;
-            }
-        }
-        return TraversalDecision::Continue;
+    for_each_element_matching_selectors(*this, selectors, [&](Element& element) {
+        result = &element;
+        return TraversalDecision::Break;
     });
 
     return result;
@@ -64,23 +135,18 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<NodeList>> ParentNode::query_selector_all(S
     // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingContext(*this), selector_text);
+    auto maybe_selectors = document().parse_selector_for_query(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(realm(), "Failed to parse selector"_fly_string);
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
 
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     Vector<JS::Handle<Node>> elements;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    for_each_in_subtree_of_type<Element>([&](auto& element) {
-        for (auto& selector : selectors) {
-            if (SelectorEngine::matches(selector, {}, element, nullptr, {}, this)) {
-                elements.append(&element);
-            }
-        }
+    for_each_element_matching_selectors(*this, selectors, [&](Element& element) {
+        elements.append(&element);
         return TraversalDecision::Continue;
     });
 
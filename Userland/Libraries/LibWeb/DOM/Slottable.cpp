@@ -18,8 +18,44 @@ SlottableMixin::~SlottableMixin() = default;
 
 void SlottableMixin::visit_edges(JS::Cell::Visitor& visitor)
 {
-    visitor.visit(m_assigned_slot);
-    visitor.visit(m_manual_slot_assignment);
+    if (!m_data)
+        return;
+    visitor.visit(m_data->assigned_slot);
+    visitor.visit(m_data->manual_slot_assignment);
+}
+
+SlottableMixin::Data& SlottableMixin::ensure_data()
+{
+    if (!m_data)
+        m_data = make<Data>();
+    return *m_data;
+}
+
+String const& SlottableMixin::slottable_name() const
+{
+    static String const empty_name;
+    return m_data ? m_data->name : empty_name;
+}
+
+void SlottableMixin::set_slottable_name(String name)
+{
+    if (!m_data && name.is_empty())
+        return;
+    ensure_data().name = move(name);
+}
+
+void SlottableMixin::set_assigned_slot(JS::GCPtr<HTML::HTMLSlotElement> assigned_slot)
+{
+    if (!m_data && !assigned_slot)
+        return;
+    ensure_data().assigned_slot = assigned_slot;
+}
+
+void SlottableMixin::set_manual_slot_assignment(JS::GCPtr<HTML::HTMLSlotElement> manual_slot_assignment)
+{
+    if (!m_data && !manual_slot_assignment)
+        return;
+    ensure_data().manual_slot_assignment = manual_slot_assignment;
 }
 
 // https://dom.spec.whatwg.org/#dom-slotable-assignedslot
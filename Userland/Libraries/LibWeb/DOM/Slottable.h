@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/OwnPtr.h>
 #include <AK/String.h>
 #include <AK/Variant.h>
 #include <LibJS/Heap/Cell.h>
@@ -22,29 +23,34 @@ class SlottableMixin {
 public:
     virtual ~SlottableMixin();
 
-    String const& slottable_name() const { return m_name; } // Not called `name` to distinguish from `Element::name`.
-    void set_slottable_name(String name) { m_name = move(name); }
+    String const& slottable_name() const; // Not called `name` to distinguish from `Element::name`.
+    void set_slottable_name(String name);
 
     JS::GCPtr<HTML::HTMLSlotElement> assigned_slot();
 
-    JS::GCPtr<HTML::HTMLSlotElement> assigned_slot_internal() const { return m_assigned_slot; }
-    void set_assigned_slot(JS::GCPtr<HTML::HTMLSlotElement> assigned_slot) { m_assigned_slot = assigned_slot; }
+    JS::GCPtr<HTML::HTMLSlotElement> assigned_slot_internal() const { return m_data ? m_data->assigned_slot : nullptr; }
+    void set_assigned_slot(JS::GCPtr<HTML::HTMLSlotElement>);
 
-    JS::GCPtr<HTML::HTMLSlotElement> manual_slot_assignment() { return m_manual_slot_assignment; }
-    void set_manual_slot_assignment(JS::GCPtr<HTML::HTMLSlotElement> manual_slot_assignment) { m_manual_slot_assignment = manual_slot_assignment; }
+    JS::GCPtr<HTML::HTMLSlotElement> manual_slot_assignment() { return m_data ? m_data->manual_slot_assignment : nullptr; }
+    void set_manual_slot_assignment(JS::GCPtr<HTML::HTMLSlotElement>);
 
 protected:
     void visit_edges(JS::Cell::Visitor&);
 
 private:
-    // https://dom.spec.whatwg.org/#slotable-name
-    String m_name;
-
-    // https://dom.spec.whatwg.org/#slotable-assigned-slot
-    JS::GCPtr<HTML::HTMLSlotElement> m_assigned_slot;
-
-    // https://dom.spec.whatwg.org/#slottable-manual-slot-assignment
-    JS::GCPtr<HTML::HTMLSlotElement> m_manual_slot_assignment;
+    // NOTE: Most slottables are never slotted, so this is only allocated once something is set.
+    struct Data {
+        // https://dom.spec.whatwg.org/#slotable-name
+        String name;
+
+        // https://dom.spec.whatwg.org/#slotable-assigned-slot
+        JS::GCPtr<HTML::HTMLSlotElement> assigned_slot;
+
+        // https://dom.spec.whatwg.org/#slottable-manual-slot-assignment
+        JS::GCPtr<HTML::HTMLSlotElement> manual_slot_assignment;
+    };
+    Data& ensure_data();
+    OwnPtr<Data> m_data;
 };
 
 enum class OpenFlag {
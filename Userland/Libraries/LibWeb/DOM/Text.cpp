@@ -37,7 +37,8 @@ void Text::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     SlottableMixin::visit_edges(visitor);
-    visitor.visit(m_owner);
+    if (m_editable_text_data)
+        visitor.visit(m_editable_text_data->owner);
 }
 
 // https://dom.spec.whatwg.org/#dom-text-text
@@ -48,11 +49,18 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<Text>> Text::construct_impl(JS::Realm& real
     return realm.heap().allocate<Text>(realm, window.associated_document(), data);
 }
 
+Text::EditableTextData& Text::ensure_editable_text_data()
+{
+    if (!m_editable_text_data)
+        m_editable_text_data = make<EditableTextData>();
+    return *m_editable_text_data;
+}
+
 EditableTextNodeOwner* Text::editable_text_node_owner()
 {
-    if (!m_owner)
+    if (!m_editable_text_data || !m_editable_text_data->owner)
         return nullptr;
-    EditableTextNodeOwner* owner = dynamic_cast<EditableTextNodeOwner*>(m_owner.ptr());
+    EditableTextNodeOwner* owner = dynamic_cast<EditableTextNodeOwner*>(m_editable_text_data->owner.ptr());
     VERIFY(owner);
     return owner;
 }
@@ -32,22 +32,22 @@ public:
 
     // ^Node
     virtual FlyString node_name() const override { return "#text"_fly_string; }
-    virtual bool is_editable() const override { return m_always_editable || CharacterData::is_editable(); }
+    virtual bool is_editable() const override { return (m_editable_text_data && m_editable_text_data->always_editable) || CharacterData::is_editable(); }
 
-    void set_always_editable(bool b) { m_always_editable = b; }
+    void set_always_editable(bool b) { ensure_editable_text_data().always_editable = b; }
 
-    Optional<size_t> max_length() const { return m_max_length; }
-    void set_max_length(Optional<size_t> max_length) { m_max_length = move(max_length); }
+    Optional<size_t> max_length() const { return m_editable_text_data ? m_editable_text_data->max_length : Optional<size_t> {}; }
+    void set_max_length(Optional<size_t> max_length) { ensure_editable_text_data().max_length = move(max_length); }
 
     template<DerivedFrom<EditableTextNodeOwner> T>
-    void set_editable_text_node_owner(Badge<T>, Element& owner_element) { m_owner = &owner_element; }
+    void set_editable_text_node_owner(Badge<T>, Element& owner_element) { ensure_editable_text_data().owner = &owner_element; }
     EditableTextNodeOwner* editable_text_node_owner();
 
     WebIDL::ExceptionOr<JS::NonnullGCPtr<Text>> split_text(size_t offset);
     String whole_text();
 
-    bool is_password_input() const { return m_is_password_input; }
-    void set_is_password_input(Badge<HTML::HTMLInputElement>, bool b) { m_is_password_input = b; }
+    bool is_password_input() const { return m_editable_text_data && m_editable_text_data->is_password_input; }
+    void set_is_password_input(Badge<HTML::HTMLInputElement>, bool b) { ensure_editable_text_data().is_password_input = b; }
 
     Optional<Element::Directionality> directionality() const;
 
@@ -59,11 +59,17 @@ protected:
     virtual void visit_edges(Cell::Visitor&) override;
 
 private:
-    JS::GCPtr<Element> m_owner;
-
-    bool m_always_editable { false };
-    Optional<size_t> m_max_length {};
-    bool m_is_password_input { false };
+    // NOTE: Only the text nodes inside of form controls are ever given any of these, so they are kept out of line to keep
+    //       all other text nodes small.
+    struct EditableTextData {
+        JS::GCPtr<Element> owner;
+
+        bool always_editable { false };
+        Optional<size_t> max_length {};
+        bool is_password_input { false };
+    };
+    EditableTextData& ensure_editable_text_data();
+    OwnPtr<EditableTextData> m_editable_text_data;
 };
 
 template<>
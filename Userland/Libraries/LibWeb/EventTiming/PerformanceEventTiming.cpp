@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceEventTimingPrototype.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/DOM/Node.h>
+#include <LibWeb/EventTiming/PerformanceEventTiming.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+#include <LibWeb/PerformanceTimeline/PerformanceObserver.h>
+#include <LibWeb/UIEvents/EventNames.h>
+
+namespace Web::EventTiming {
+
+JS_DEFINE_ALLOCATOR(PerformanceEventTiming);
+
+PerformanceEventTiming::PerformanceEventTiming(JS::Realm& realm, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp processing_start, bool cancelable)
+    : PerformanceTimeline::PerformanceEntry(realm, name, start_time, 0)
+    , m_entry_type(PerformanceTimeline::EntryTypes::event)
+    , m_processing_start(processing_start)
+    , m_cancelable(cancelable)
+{
+}
+
+PerformanceEventTiming::~PerformanceEventTiming() = default;
+
+void PerformanceEventTiming::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceEventTiming);
+}
+
+void PerformanceEventTiming::visit_edges(JS::Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_event_target);
+}
+
+// https://w3c.github.io/event-timing/#sec-should-add-performanceeventtiming
+PerformanceTimeline::ShouldAddEntry PerformanceEventTiming::should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> options) const
+{
+    // NOTE: "first-input" entries are always added.
+    if (m_entry_type == PerformanceTimeline::EntryTypes::first_input)
+        return PerformanceTimeline::ShouldAddEntry::Yes;
+
+    // 1. Let minDuration be computed as follows:
+    //    1. If options is not present or if options's durationThreshold is not present, let minDuration be 104.
+    //    2. Otherwise, let minDuration be the maximum between 16 and options's durationThreshold value.
+    double min_duration = 104;
+    if (options.has_value() && options->duration_threshold.has_value())
+        min_duration = max(16.0, *options->duration_threshold);
+
+    // 2. If entry's duration attribute value is greater than or equal to minDuration, return true.
+    if (duration() >= min_duration)
+        return PerformanceTimeline::ShouldAddEntry::Yes;
+
+    // 3. Otherwise, return false.
+    return PerformanceTimeline::ShouldAddEntry::No;
+}
+
+// https://w3c.github.io/event-timing/#dom-performanceeventtiming-target
+JS::GCPtr<DOM::Node> PerformanceEventTiming::target() const
+{
+    // The target attribute's getter returns the result of the get an element algorithm, passing this's eventTarget and
+    // null as inputs.
+    // FIXME: Implement "exposed for paint timing". For now, only nodes that are still connected are exposed.
+    if (!m_event_target || !is<DOM::Node>(*m_event_target))
+        return nullptr;
+
+    auto& node = static_cast<DOM::Node&>(*m_event_target);
+    if (!node.is_connected())
+        return nullptr;
+    return node;
+}
+
+// https://w3c.github.io/event-timing/#sec-events-exposed
+static bool should_be_considered_for_event_timing(DOM::Event const& event)
+{
+    // 1. If event's isTrusted attribute value is set to false, return false.
+    if (!event.is_trusted())
+        return false;
+
+    // 2. If event's type is one of the following: auxclick, click, contextmenu, dblclick, mousedown, mouseenter,
+    //    mouseleave, mouseout, mouseover, mouseup, pointerover, pointerenter, pointerdown, pointerup, pointercancel,
+    //    pointerout, pointerleave, gotpointercapture, lostpointercapture, touchstart, touchend, touchcancel, keydown,
+    //    keypress, keyup, beforeinput, input, compositionstart, compositionupdate, compositionend, dragstart, dragend,
+    //    dragenter, dragleave, dragover, drop, return true.
+    // NOTE: We don't dispatch pointer, touch, beforeinput or composition events yet, so they are left out here.
+    auto const& type = event.type();
+    if (type.is_one_of(
+            UIEvents::EventNames::auxclick, UIEvents::EventNames::click, UIEvents::EventNames::contextmenu,
+            UIEvents::EventNames::dblclick, UIEvents::EventNames::mousedown, UIEvents::EventNames::mouseenter,
+            UIEvents::EventNames::mouseleave, UIEvents::EventNames::mouseout, UIEvents::EventNames::mouseover,
+            UIEvents::EventNames::mouseup, UIEvents::EventNames::keydown, UIEvents::EventNames::keypress,
+            UIEvents::EventNames::keyup, HTML::EventNames::input, HTML::EventNames::dragstart,
+            HTML::EventNames::dragend, HTML::EventNames::dragenter, HTML::EventNames::dragleave,
+            HTML::EventNames::dragover, HTML::EventNames::drop)) {
+        return true;
+    }
+
+    // 3. Return false.
+    return false;
+}
+
+// https://w3c.github.io/event-timing/#initialize-event-timing
+JS::GCPtr<PerformanceEventTiming> PerformanceEventTiming::initialize_event_timing(DOM::Event const& event, HighResolutionTime::DOMHighResTimeStamp processing_start)
+{
+    // 1. If the algorithm to determine if event should be considered for Event Timing returns false, then return null.
+    if (!should_be_considered_for_event_timing(event))
+        return nullptr;
+
+    // NOTE: Entries are only ever reported to windows, so don't bother creating them for anything else.
+    auto& realm = HTML::relevant_realm(event);
+    if (!is<HTML::Window>(realm.global_object()))
+        return nullptr;
+
+    // 2. Let timingEntry be a new PerformanceEventTiming object with event's relevant realm.
+    // 3. Set timingEntry's name to event's type attribute value.
+    // 4. Set timingEntry's entryType to "event".
+    // 5. Set timingEntry's startTime to event's timeStamp attribute value.
+    // 6. Set timingEntry's processingStart to processingStart.
+    // 7. Set timingEntry's cancelable to event's cancelable attribute value.
+    // 8. Return timingEntry.
+    return realm.heap().allocate<PerformanceEventTiming>(realm, realm, event.type().to_string(), event.time_stamp(), processing_start, event.cancelable());
+}
+
+// https://w3c.github.io/event-timing/#finalize-event-timing
+void PerformanceEventTiming::finalize_event_timing(JS::GCPtr<PerformanceEventTiming> timing_entry, DOM::Event const&, DOM::EventTarget& target, HighResolutionTime::DOMHighResTimeStamp processing_end)
+{
+    // 1. If timingEntry is null, return.
+    if (!timing_entry)
+        return;
+
+    // 2. Let relevantGlobal be target's relevant global object.
+    auto& relevant_global = HTML::relevant_global_object(target);
+
+    // 3. If relevantGlobal does not implement Window, return.
+    if (!is<HTML::Window>(relevant_global))
+        return;
+    auto& window = static_cast<HTML::Window&>(relevant_global);
+
+    // 4. Set timingEntry's processingEnd to processingEnd.
+    timing_entry->m_processing_end = processing_end;
+
+    // 5. Set timingEntry's eventTarget to target.
+    timing_entry->m_event_target = target;
+
+    // FIXME: 6. If event's type attribute value is "pointerdown", update the pending pointer downs of relevantGlobal,
+    //           and compute the interactionId of timingEntry.
+
+    // 7. Append timingEntry to relevantGlobal's entries to be queued.
+    window.event_timing_entries_to_be_queued().append(*timing_entry);
+}
+
+JS::NonnullGCPtr<PerformanceEventTiming> PerformanceEventTiming::copy_as_first_input() const
+{
+    auto& realm = this->realm();
+    auto copy = realm.heap().allocate<PerformanceEventTiming>(realm, realm, name(), start_time(), m_processing_start, m_cancelable);
+    copy->m_entry_type = PerformanceTimeline::EntryTypes::first_input;
+    copy->m_processing_end = m_processing_end;
+    copy->m_event_target = m_event_target;
+    copy->set_duration(duration());
+    return copy;
+}
+
+// https://w3c.github.io/event-timing/#set-event-timing-entry-duration
+void PerformanceEventTiming::set_event_timing_entry_duration(HTML::Window& window, HighResolutionTime::DOMHighResTimeStamp rendering_timestamp)
+{
+    // 1. If timingEntry's duration attribute value is nonzero, return.
+    if (duration() != 0)
+        return;
+
+    // 2. Let start be timingEntry's startTime attribute value.
+    auto start = start_time();
+
+    // 3. Set timingEntry's duration to a DOMHighResTimeStamp resulting from renderingTimestamp - start, with granularity
+    //    of 8ms or less.
+    set_duration(round((rendering_timestamp - start) / 8) * 8);
+
+    // 4. Let name be timingEntry's name attribute value.
+    auto const& name = this->name();
+
+    // 5. If relevantGlobal's has dispatched input event is false, run the following steps:
+    if (window.has_dispatched_input_event())
+        return;
+
+    // FIXME: 1. If name is "pointerdown", set relevantGlobal's pending first pointer down to a copy of timingEntry, with
+    //           its entryType set to "first-input".
+    // FIXME: 2.1. Otherwise, if name is "pointerup" and relevantGlobal's pending first pointer down is not null, set
+    //             relevantGlobal's has dispatched input event to true and queue the pending first pointer down.
+    // NOTE: We don't dispatch pointer events yet, so the first mousedown, click or keydown is the first input.
+
+    // 2.2. Otherwise, if name is one of "click", "keydown" or "mousedown", then:
+    if (name.is_one_of(UIEvents::EventNames::click, UIEvents::EventNames::keydown, UIEvents::EventNames::mousedown)) {
+        // 1. Set relevantGlobal's has dispatched input event to true.
+        window.set_has_dispatched_input_event(true);
+
+        // 2. Let newFirstInputDelayEntry be a copy of timingEntry.
+        // 3. Set newFirstInputDelayEntry's entryType to "first-input".
+        // 4. Queue the entry newFirstInputDelayEntry.
+        window.queue_performance_entry(copy_as_first_input());
+    }
+}
+
+// https://w3c.github.io/event-timing/#dispatch-pending-event-timing-entries
+void dispatch_pending_event_timing_entries(DOM::Document& document)
+{
+    // 1. Let window be doc's relevant global object.
+    auto window = document.window();
+    if (!window)
+        return;
+
+    // 2. Let renderingTimestamp be the current high resolution time given window.
+    auto rendering_timestamp = HighResolutionTime::current_high_resolution_time(*window);
+
+    // 3. For each timingEntry in window's entries to be queued:
+    auto& entries_to_be_queued = window->event_timing_entries_to_be_queued();
+    for (auto& timing_entry : entries_to_be_queued) {
+        // 1. Set event timing entry duration passing timingEntry, window, and renderingTimestamp.
+        timing_entry->set_event_timing_entry_duration(*window, rendering_timestamp);
+
+        // 2. If timingEntry's duration attribute value is greater than or equal to 16, then queue timingEntry.
+        if (timing_entry->duration() >= 16)
+            window->queue_performance_entry(timing_entry);
+    }
+
+    // 4. Clear window's entries to be queued.
+    entries_to_be_queued.clear();
+
+    // FIXME: 5. For each pendingDown in the values from window's pending pointer downs map, set event timing entry
+    //           duration passing pendingDown, window, and renderingTimestamp.
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::EventTiming {
+
+// https://w3c.github.io/event-timing/#sec-performance-event-timing
+class PerformanceEventTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceEventTiming, PerformanceTimeline::PerformanceEntry);
+    JS_DECLARE_ALLOCATOR(PerformanceEventTiming);
+
+public:
+    virtual ~PerformanceEventTiming() override;
+
+    // NOTE: These three functions are answered by the registry for the given entry type.
+    // https://w3c.github.io/timing-entrytypes-registry/#registry
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-availablefromtimeline
+    static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::No; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-maxbuffersize
+    static Optional<u64> max_buffer_size() { return 150; }
+
+    // NOTE: The same interface is used for "first-input" entries, which have their own registry entry.
+    struct FirstInput {
+        static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::Yes; }
+        static Optional<u64> max_buffer_size() { return 1; }
+    };
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-should-add-entry
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override;
+
+    virtual FlyString const& entry_type() const override { return m_entry_type; }
+
+    HighResolutionTime::DOMHighResTimeStamp processing_start() const { return m_processing_start; }
+    HighResolutionTime::DOMHighResTimeStamp processing_end() const { return m_processing_end; }
+    bool cancelable() const { return m_cancelable; }
+    JS::GCPtr<DOM::Node> target() const;
+
+    // FIXME: Implement interaction IDs.
+    u64 interaction_id() const { return 0; }
+
+    // https://w3c.github.io/event-timing/#initialize-event-timing
+    [[nodiscard]] static JS::GCPtr<PerformanceEventTiming> initialize_event_timing(DOM::Event const&, HighResolutionTime::DOMHighResTimeStamp processing_start);
+
+    // https://w3c.github.io/event-timing/#finalize-event-timing
+    static void finalize_event_timing(JS::GCPtr<PerformanceEventTiming>, DOM::Event const&, DOM::EventTarget&, HighResolutionTime::DOMHighResTimeStamp processing_end);
+
+private:
+    PerformanceEventTiming(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp processing_start, bool cancelable);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(JS::Cell::Visitor&) override;
+
+    friend void dispatch_pending_event_timing_entries(DOM::Document&);
+    JS::NonnullGCPtr<PerformanceEventTiming> copy_as_first_input() const;
+    void set_event_timing_entry_duration(HTML::Window&, HighResolutionTime::DOMHighResTimeStamp rendering_timestamp);
+
+    FlyString m_entry_type;
+    HighResolutionTime::DOMHighResTimeStamp m_processing_start { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_processing_end { 0 };
+    bool m_cancelable { false };
+
+    // https://w3c.github.io/event-timing/#dom-performanceeventtiming-target
+    JS::GCPtr<DOM::EventTarget> m_event_target;
+};
+
+// https://w3c.github.io/event-timing/#dispatch-pending-event-timing-entries
+void dispatch_pending_event_timing_entries(DOM::Document&);
+
+}
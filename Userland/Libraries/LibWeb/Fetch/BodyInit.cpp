@@ -13,7 +13,6 @@
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/HTML/FormControlInfrastructure.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
-#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Streams/AbstractOperations.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/Buffers.h>
@@ -54,16 +53,16 @@ WebIDL::ExceptionOr<Infrastructure::BodyWithType> extract_body(JS::Realm& realm,
         stream = blob_handle->cell()->get_stream();
     }
     // 4. Otherwise, set stream to a new ReadableStream object, and set up stream with byte reading support.
+    // NOTE: The stream is set up once the body has been created below, so that it can pull from the body's source.
     else {
         stream = realm.heap().allocate<Streams::ReadableStream>(realm, realm);
-        Streams::set_up_readable_stream_controller_with_byte_reading_support(*stream);
     }
 
     // 5. Assert: stream is a ReadableStream object.
     VERIFY(stream);
 
     // 6. Let action be null.
-    Function<ByteBuffer()> action;
+    bool has_action = false;
 
     // 7. Let source be null.
     Infrastructure::Body::SourceType source {};
@@ -135,21 +134,26 @@ WebIDL::ExceptionOr<Infrastructure::BodyWithType> extract_body(JS::Realm& realm,
         }));
 
     // 11. If source is a byte sequence, then set action to a step that returns source and length to source’s length.
-    // For now, do it synchronously.
     if (source.has<ByteBuffer>()) {
-        action = [source = MUST(ByteBuffer::copy(source.get<ByteBuffer>()))]() mutable {
-            return move(source);
-        };
+        has_action = true;
         length = source.get<ByteBuffer>().size();
     }
 
+    // 13. Let body be a body whose stream is stream, source is source, and length is length.
+    auto body = Infrastructure::Body::create(vm, *stream, move(source), move(length));
+
     // 12. If action is non-null, then run these steps in parallel:
-    if (action) {
-        Platform::EventLoopPlugin::the().deferred_invoke([&realm, stream, action = move(action)] {
-            HTML::TemporaryExecutionContext execution_context { Bindings::host_defined_environment_settings_object(realm), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+    // NOTE: Rather than eagerly enqueuing a copy of the source into the stream, the copy is only made once the stream
+    //       is first pulled from. Consumers that fully read the body from its source (e.g. arrayBuffer() and blob())
+    //       thus never hold a second copy of the body in the stream's queue.
+    if (has_action) {
+        auto pull_algorithm = JS::create_heap_function(realm.heap(), [&realm, stream, body, did_run_action = false]() mutable {
+            if (did_run_action)
+                return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+            did_run_action = true;
 
             // 1. Run action.
-            auto bytes = action();
+            auto bytes = MUST(ByteBuffer::copy(body->source().get<ByteBuffer>()));
 
             // Whenever one or more bytes are available and stream is not errored, enqueue the result of creating a
             // Uint8Array from the available bytes into stream.
@@ -162,11 +166,14 @@ WebIDL::ExceptionOr<Infrastructure::BodyWithType> extract_body(JS::Realm& realm,
 
             // When running action is done, close stream.
             stream->close();
+
+            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
         });
-    }
 
-    // 13. Let body be a body whose stream is stream, source is source, and length is length.
-    auto body = Infrastructure::Body::create(vm, *stream, move(source), move(length));
+        Streams::set_up_readable_stream_controller_with_byte_reading_support(*stream, pull_algorithm);
+    } else if (!object.has<JS::Handle<Streams::ReadableStream>>() && !object.has<JS::Handle<FileAPI::Blob>>()) {
+        Streams::set_up_readable_stream_controller_with_byte_reading_support(*stream);
+    }
 
     // 14. Return (body, type).
     return Infrastructure::BodyWithType { .body = move(body), .type = move(type) };
@@ -69,13 +69,17 @@ void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
             HTML::TemporaryExecutionContext execution_context { Bindings::host_defined_environment_settings_object(m_stream->realm()), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
-            if (auto result = Streams::readable_stream_pull_from_bytes(m_stream, move(bytes)); result.is_error()) {
-                auto throw_completion = Bindings::dom_exception_to_throw_completion(m_stream->vm(), result.release_error());
+            // NOTE: A BYOB request may be smaller than the received bytes. Any remaining bytes are pulled into the next
+            //       pending BYOB request, or enqueued as a chunk for the reader to consume later.
+            while (!bytes.is_empty() && m_stream->is_readable()) {
+                if (auto result = Streams::readable_stream_pull_from_bytes(m_stream, bytes); result.is_error()) {
+                    auto throw_completion = Bindings::dom_exception_to_throw_completion(m_stream->vm(), result.release_error());
 
-                dbgln("FetchedDataReceiver: Stream error pulling bytes");
-                HTML::report_exception(throw_completion, m_stream->realm());
+                    dbgln("FetchedDataReceiver: Stream error pulling bytes");
+                    HTML::report_exception(throw_completion, m_stream->realm());
 
-                return;
+                    return;
+                }
             }
 
             // 2. If stream is errored, then terminate fetchParams’s controller.
@@ -21,6 +21,7 @@
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Fetching/PendingResponse.h>
 #include <LibWeb/Fetch/Fetching/RefCountedFlag.h>
+#include <LibWeb/Fetch/Infrastructure/ConnectionTimingInfo.h>
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Infrastructure/FetchParams.h>
@@ -48,10 +49,14 @@
 #include <LibWeb/Loader/LoadRequest.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MixedContent/AbstractOperations.h>
+#include <LibWeb/Page/Page.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/ReferrerPolicy/AbstractOperations.h>
+#include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
 #include <LibWeb/SRI/SRI.h>
 #include <LibWeb/SecureContexts/AbstractOperations.h>
+#include <LibWeb/ServiceWorker/HandleFetch.h>
+#include <LibWeb/ServiceWorker/Registration.h>
 #include <LibWeb/Streams/TransformStream.h>
 #include <LibWeb/Streams/TransformStreamDefaultController.h>
 #include <LibWeb/Streams/Transformer.h>
@@ -61,6 +66,52 @@ namespace Web::Fetch::Fetching {
 
 bool g_http_cache_enabled;
 
+static Requests::RequestPriority internal_priority_for_request(Infrastructure::Request const& request)
+{
+    using Destination = Infrastructure::Request::Destination;
+
+    auto priority = [&] {
+        if (request.render_blocking())
+            return Requests::RequestPriority::Highest;
+
+        // Beacons, and fetches kept alive past their document, are not awaited by anything.
+        if (!request.destination().has_value())
+            return request.keepalive() ? Requests::RequestPriority::Lowest : Requests::RequestPriority::Normal;
+
+        switch (*request.destination()) {
+        case Destination::Document:
+        case Destination::Frame:
+        case Destination::IFrame:
+        case Destination::Style:
+            return Requests::RequestPriority::Highest;
+        case Destination::Font:
+        case Destination::Script:
+        case Destination::ServiceWorker:
+        case Destination::SharedWorker:
+        case Destination::Worker:
+        case Destination::XSLT:
+            return Requests::RequestPriority::High;
+        case Destination::Audio:
+        case Destination::Image:
+        case Destination::Track:
+        case Destination::Video:
+            return Requests::RequestPriority::Low;
+        case Destination::Report:
+            return Requests::RequestPriority::Lowest;
+        default:
+            return Requests::RequestPriority::Normal;
+        }
+    }();
+
+    // The fetchpriority attribute and the priority member of RequestInit nudge the default by one step.
+    if (request.priority() == Infrastructure::Request::Priority::High && priority != Requests::RequestPriority::Highest)
+        priority = static_cast<Requests::RequestPriority>(to_underlying(priority) - 1);
+    else if (request.priority() == Infrastructure::Request::Priority::Low && priority != Requests::RequestPriority::Lowest)
+        priority = static_cast<Requests::RequestPriority>(to_underlying(priority) + 1);
+
+    return priority;
+}
+
 #define TRY_OR_IGNORE(expression)                                                                    \
     ({                                                                                               \
         auto&& _temporary_result = (expression);                                                     \
@@ -246,6 +297,8 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<Infrastructure::FetchController>> fetch(JS:
     //     in setting request’s priority to a user-agent-defined object.
     // NOTE: The user-agent-defined object could encompass stream weight and dependency for HTTP/2, and equivalent
     //       information used to prioritize dispatch and processing of HTTP/1 fetches.
+    if (!request.internal_priority().has_value())
+        request.set_internal_priority(Infrastructure::Request::InternalPriority { .priority = internal_priority_for_request(request) });
 
     // 16. If request is a subresource request, then:
     if (request.is_subresource_request()) {
@@ -666,13 +719,12 @@ void fetch_response_handover(JS::Realm& realm, Infrastructure::FetchParams const
                     body_info.content_type = MimeSniff::minimise_a_supported_mime_type(mime_type.value());
             }
 
-            // FIXME: 8. If fetchParams’s request’s initiator type is not null, then mark resource timing given timingInfo,
-            //           request’s URL, request’s initiator type, global, cacheState, bodyInfo, and responseStatus.
-            (void)timing_info;
-            (void)global;
-            (void)cache_state;
-            (void)body_info;
-            (void)response_status;
+            // 8. If fetchParams’s request’s initiator type is not null, then mark resource timing given timingInfo,
+            //    request’s URL, request’s initiator type, global, cacheState, bodyInfo, and responseStatus.
+            if (auto initiator_type = fetch_params.request()->initiator_type(); initiator_type.has_value()) {
+                auto initiator_type_string = MUST(String::from_utf8(Infrastructure::request_initiator_type_to_string(*initiator_type)));
+                ResourceTiming::mark_resource_timing(timing_info, fetch_params.request()->url(), initiator_type_string, const_cast<JS::Object&>(global), cache_state, move(body_info), response_status);
+            }
         });
 
         // 4. Let processResponseEndOfBodyTask be the following steps:
@@ -953,7 +1005,9 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> http_fetch(JS::Realm& rea
     JS::GCPtr<Infrastructure::Response> internal_response;
 
     // 3. If request’s service-workers mode is "all", then:
-    if (request->service_workers_mode() == Infrastructure::Request::ServiceWorkersMode::All) {
+    // NOTE: Without any service worker registrations, handle fetch can only return null, so don't bother cloning the
+    //       request for it.
+    if (request->service_workers_mode() == Infrastructure::Request::ServiceWorkersMode::All && ServiceWorker::Registration::any_registrations_exist()) {
         // 1. Let requestForServiceWorker be a clone of request.
         auto request_for_service_worker = request->clone(realm);
 
@@ -970,8 +1024,10 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> http_fetch(JS::Realm& rea
         //    capability.
         auto service_worker_start_time = HighResolutionTime::coarsened_shared_current_time(fetch_params.cross_origin_isolated_capability() == HTML::CanUseCrossOriginIsolatedAPIs::Yes);
 
-        // FIXME: 4. Set response to the result of invoking handle fetch for requestForServiceWorker, with fetchParams’s
-        //           controller and fetchParams’s cross-origin isolated capability.
+        // 4. Set response to the result of invoking handle fetch for requestForServiceWorker, with fetchParams’s
+        //    controller and fetchParams’s cross-origin isolated capability.
+        // FIXME: Pass along the controller and cross-origin isolated capability once handle fetch can dispatch FetchEvents.
+        response = ServiceWorker::handle_fetch(request_for_service_worker);
 
         // 5. If response is non-null, then:
         if (response) {
@@ -2126,6 +2182,72 @@ static void log_response(auto const& status_code, auto const& headers, auto cons
 }
 #endif
 
+// NOTE: RequestServer tells us when each phase of a request happened, relative to when it received the request. That
+//       happens right after we hand the request to ResourceLoader, which is what requestStartTime is.
+static HighResolutionTime::DOMHighResTimeStamp request_timing_to_timestamp(HighResolutionTime::DOMHighResTimeStamp request_start_time, i64 microseconds)
+{
+    if (microseconds == 0)
+        return 0;
+    return request_start_time + static_cast<double>(microseconds) / 1000.0;
+}
+
+// Fills in the parts of fetchParams’s timing info that the 'HTTP-network fetch' steps set as the request goes over the
+// network, after the fact.
+static void update_timing_info_from_network(JS::VM& vm, Infrastructure::FetchParams const& fetch_params, HighResolutionTime::DOMHighResTimeStamp request_start_time, Requests::RequestTimingInfo const& request_timing_info)
+{
+    // NOTE: Responses that did not come from RequestServer, like those for file:// URLs, have no timings.
+    if (request_timing_info.response_end_microseconds == 0)
+        return;
+
+    auto timing_info = fetch_params.timing_info();
+    auto cross_origin_isolated_capability = fetch_params.cross_origin_isolated_capability() == HTML::CanUseCrossOriginIsolatedAPIs::Yes;
+    auto to_timestamp = [&](i64 microseconds) {
+        return request_timing_to_timestamp(request_start_time, microseconds);
+    };
+
+    // NOTE: Connections that were reused have no timings of their own, which clamping turns into the post-redirect
+    //       start time, as it would for the timings of a connection that was made for an earlier request.
+    auto connection_timing_info = Infrastructure::ConnectionTimingInfo::create(vm);
+    connection_timing_info->set_domain_lookup_start_time(to_timestamp(request_timing_info.domain_lookup_start_microseconds));
+    connection_timing_info->set_domain_lookup_end_time(to_timestamp(request_timing_info.domain_lookup_end_microseconds));
+    connection_timing_info->set_connection_start_time(to_timestamp(request_timing_info.connect_start_microseconds));
+    connection_timing_info->set_connection_end_time(to_timestamp(request_timing_info.connect_end_microseconds));
+    connection_timing_info->set_secure_connection_start_time(to_timestamp(request_timing_info.secure_connect_start_microseconds));
+    connection_timing_info->set_lpn_negotiated_protocol(MUST(ByteBuffer::copy(request_timing_info.alpn_negotiated_protocol.bytes())));
+
+    // Set timingInfo’s final connection timing info to the result of calling clamp and coarsen connection timing info
+    // with connection’s timing info, timingInfo’s post-redirect start time, and fetchParams’s cross-origin isolated
+    // capability.
+    timing_info->set_final_connection_timing_info(Infrastructure::clamp_and_coarsen_connection_timing_info(vm, connection_timing_info, timing_info->post_redirect_start_time(), cross_origin_isolated_capability));
+
+    // Set timingInfo’s final network-request start time to the coarsened shared current time given fetchParams’s
+    // cross-origin isolated capability, immediately before the user agent starts sending the request.
+    timing_info->set_final_network_request_start_time(HighResolutionTime::coarsen_time(to_timestamp(request_timing_info.request_start_microseconds), cross_origin_isolated_capability));
+
+    // Set timingInfo’s final network-response start time to the coarsened shared current time given fetchParams’s
+    // cross-origin isolated capability, immediately after the user agent’s HTTP parser receives the first byte of the
+    // response (e.g., frame header bytes for HTTP/2 or response status line for HTTP/1.x).
+    timing_info->set_final_network_response_start_time(HighResolutionTime::coarsen_time(to_timestamp(request_timing_info.response_start_microseconds), cross_origin_isolated_capability));
+}
+
+static void record_network_request(Page& page, Infrastructure::Request const& request, HighResolutionTime::DOMHighResTimeStamp request_start_time, Optional<u32> status_code, Requests::RequestTimingInfo const& timing_info, u64 decoded_body_size, bool success)
+{
+    NetworkRequestRecord record;
+    record.url = request.current_url();
+    record.method = ByteString::copy(request.method());
+    record.status_code = status_code;
+    if (request.initiator_type().has_value())
+        record.initiator_type = Infrastructure::request_initiator_type_to_string(*request.initiator_type());
+    if (request.destination().has_value())
+        record.destination = Infrastructure::request_destination_to_string(*request.destination());
+    record.start_time = request_start_time;
+    record.end_time = HighResolutionTime::unsafe_shared_current_time();
+    record.timing_info = timing_info;
+    record.decoded_body_size = decoded_body_size;
+    record.success = success;
+    page.did_finish_network_request(move(record));
+}
+
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 // It also handles file:// URLs since those can also go through ResourceLoader.
@@ -2148,6 +2270,8 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_load
     load_request.set_url(request->current_url());
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
+    if (request->internal_priority().has_value())
+        load_request.set_priority(request->internal_priority()->priority);
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
@@ -2260,9 +2384,14 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_load
             }
         };
 
-        auto on_complete = [&vm, &realm, pending_response, stream](auto success, auto error_message) {
+        auto request_start_time = HighResolutionTime::unsafe_shared_current_time();
+
+        auto on_complete = [&vm, &realm, page = JS::NonnullGCPtr { page }, fetch_params = JS::NonnullGCPtr { fetch_params }, request, request_start_time, pending_response, stream](auto success, auto error_message, auto const& timing_info) {
             HTML::TemporaryExecutionContext execution_context { Bindings::host_defined_environment_settings_object(realm), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
+            update_timing_info_from_network(vm, *fetch_params, request_start_time, timing_info);
+            record_network_request(*page, *request, request_start_time, {}, timing_info, timing_info.encoded_body_size, success);
+
             // 16.1.1.2. Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable,
             //           then close stream, and abort these in-parallel steps.
             if (success) {
@@ -2283,14 +2412,19 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_load
 
         ResourceLoader::the().load_unbuffered(load_request, move(on_headers_received), move(on_data_received), move(on_complete));
     } else {
-        auto on_load_success = [&realm, &vm, request, pending_response](auto data, auto& response_headers, auto status_code) {
+        auto request_start_time = HighResolutionTime::unsafe_shared_current_time();
+
+        auto on_load_success = [&realm, &vm, page = JS::NonnullGCPtr { page }, fetch_params = JS::NonnullGCPtr { fetch_params }, request, request_start_time, pending_response](auto data, auto& response_headers, auto status_code, auto const& timing_info) {
             dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' complete", request->url());
             if constexpr (WEB_FETCH_DEBUG)
                 log_response(status_code, response_headers, data);
+            update_timing_info_from_network(vm, *fetch_params, request_start_time, timing_info);
+            record_network_request(*page, *request, request_start_time, status_code, timing_info, data.size(), true);
             auto [body, _] = TRY_OR_IGNORE(extract_body(realm, data));
             auto response = Infrastructure::Response::create(vm);
             response->set_status(status_code.value_or(200));
             response->set_body(move(body));
+            response->set_body_info({ .encoded_size = timing_info.encoded_body_size, .decoded_size = data.size(), .content_type = {} });
             for (auto const& [name, value] : response_headers.headers()) {
                 auto header = Infrastructure::Header::from_string_pair(name, value);
                 response->header_list()->append(move(header));
@@ -2299,10 +2433,12 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<PendingResponse>> nonstandard_resource_load
             pending_response->resolve(response);
         };
 
-        auto on_load_error = [&realm, &vm, request, pending_response](auto& error, auto status_code, auto data, auto& response_headers) {
+        auto on_load_error = [&realm, &vm, page = JS::NonnullGCPtr { page }, fetch_params = JS::NonnullGCPtr { fetch_params }, request, request_start_time, pending_response](auto& error, auto status_code, auto data, auto& response_headers, auto const& timing_info) {
             dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' failed: {} (status {})", request->url(), error, status_code.value_or(0));
             if constexpr (WEB_FETCH_DEBUG)
                 log_response(status_code, response_headers, data);
+            update_timing_info_from_network(vm, *fetch_params, request_start_time, timing_info);
+            record_network_request(*page, *request, request_start_time, status_code, timing_info, data.size(), false);
             auto response = Infrastructure::Response::create(vm);
             // FIXME: This is ugly, ResourceLoader should tell us.
             if (status_code.value_or(0) == 0) {
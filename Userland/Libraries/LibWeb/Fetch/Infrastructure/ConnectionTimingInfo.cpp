@@ -7,6 +7,7 @@
 #include <LibJS/Heap/Heap.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Fetch/Infrastructure/ConnectionTimingInfo.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 
 namespace Web::Fetch::Infrastructure {
 
@@ -19,4 +20,40 @@ JS::NonnullGCPtr<ConnectionTimingInfo> ConnectionTimingInfo::create(JS::VM& vm)
     return vm.heap().allocate_without_realm<ConnectionTimingInfo>();
 }
 
+// https://fetch.spec.whatwg.org/#clamp-and-coarsen-connection-timing-info
+JS::NonnullGCPtr<ConnectionTimingInfo> clamp_and_coarsen_connection_timing_info(JS::VM& vm, ConnectionTimingInfo const& timing_info, HighResolutionTime::DOMHighResTimeStamp default_start_time, bool cross_origin_isolated_capability)
+{
+    auto new_timing_info = ConnectionTimingInfo::create(vm);
+
+    // 1. If timingInfo’s connection start time is less than defaultStartTime, then return a new connection timing info
+    //    whose domain lookup start time is defaultStartTime, domain lookup end time is defaultStartTime, connection
+    //    start time is defaultStartTime, connection end time is defaultStartTime, secure connection start time is
+    //    defaultStartTime, and ALPN negotiated protocol is timingInfo’s ALPN negotiated protocol.
+    if (timing_info.connection_start_time() < default_start_time) {
+        new_timing_info->set_domain_lookup_start_time(default_start_time);
+        new_timing_info->set_domain_lookup_end_time(default_start_time);
+        new_timing_info->set_connection_start_time(default_start_time);
+        new_timing_info->set_connection_end_time(default_start_time);
+        new_timing_info->set_secure_connection_start_time(default_start_time);
+        new_timing_info->set_lpn_negotiated_protocol(MUST(ByteBuffer::copy(timing_info.lpn_negotiated_protocol())));
+        return new_timing_info;
+    }
+
+    // 2. Return a new connection timing info whose domain lookup start time is the result of coarsen time given
+    //    timingInfo’s domain lookup start time and crossOriginIsolatedCapability, domain lookup end time is the result
+    //    of coarsen time given timingInfo’s domain lookup end time and crossOriginIsolatedCapability, connection start
+    //    time is the result of coarsen time given timingInfo’s connection start time and crossOriginIsolatedCapability,
+    //    connection end time is the result of coarsen time given timingInfo’s connection end time and
+    //    crossOriginIsolatedCapability, secure connection start time is the result of coarsen time given timingInfo’s
+    //    secure connection start time and crossOriginIsolatedCapability, and ALPN negotiated protocol is timingInfo’s
+    //    ALPN negotiated protocol.
+    new_timing_info->set_domain_lookup_start_time(HighResolutionTime::coarsen_time(timing_info.domain_lookup_start_time(), cross_origin_isolated_capability));
+    new_timing_info->set_domain_lookup_end_time(HighResolutionTime::coarsen_time(timing_info.domain_lookup_end_time(), cross_origin_isolated_capability));
+    new_timing_info->set_connection_start_time(HighResolutionTime::coarsen_time(timing_info.connection_start_time(), cross_origin_isolated_capability));
+    new_timing_info->set_connection_end_time(HighResolutionTime::coarsen_time(timing_info.connection_end_time(), cross_origin_isolated_capability));
+    new_timing_info->set_secure_connection_start_time(HighResolutionTime::coarsen_time(timing_info.secure_connection_start_time(), cross_origin_isolated_capability));
+    new_timing_info->set_lpn_negotiated_protocol(MUST(ByteBuffer::copy(timing_info.lpn_negotiated_protocol())));
+    return new_timing_info;
+}
+
 }
@@ -73,4 +73,6 @@ private:
     ByteBuffer m_lpn_negotiated_protocol;
 };
 
+JS::NonnullGCPtr<ConnectionTimingInfo> clamp_and_coarsen_connection_timing_info(JS::VM&, ConnectionTimingInfo const& timing_info, HighResolutionTime::DOMHighResTimeStamp default_start_time, bool cross_origin_isolated_capability);
+
 }
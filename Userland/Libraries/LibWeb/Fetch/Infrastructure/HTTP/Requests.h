@@ -17,6 +17,7 @@
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Heap/GCPtr.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
@@ -167,7 +168,9 @@ public:
     };
 
     // Members are implementation-defined
-    struct InternalPriority { };
+    struct InternalPriority {
+        Requests::RequestPriority priority { Requests::RequestPriority::Normal };
+    };
 
     using BodyType = Variant<Empty, ByteBuffer, JS::NonnullGCPtr<Body>>;
     using OriginType = Variant<Origin, URL::Origin>;
@@ -226,6 +229,9 @@ public:
     [[nodiscard]] Priority const& priority() const { return m_priority; }
     void set_priority(Priority priority) { m_priority = priority; }
 
+    [[nodiscard]] Optional<InternalPriority> const& internal_priority() const { return m_internal_priority; }
+    void set_internal_priority(Optional<InternalPriority> internal_priority) { m_internal_priority = move(internal_priority); }
+
     [[nodiscard]] OriginType const& origin() const { return m_origin; }
     void set_origin(OriginType origin) { m_origin = move(origin); }
 
@@ -530,6 +536,7 @@ private:
 };
 
 StringView request_destination_to_string(Request::Destination);
+StringView request_initiator_type_to_string(Request::InitiatorType);
 StringView request_mode_to_string(Request::Mode);
 
 Optional<Request::Priority> request_priority_from_string(StringView);
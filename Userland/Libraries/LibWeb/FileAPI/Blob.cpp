@@ -27,6 +27,9 @@ namespace Web::FileAPI {
 
 JS_DEFINE_ALLOCATOR(Blob);
 
+// The size of the chunks a Blob's stream reads from it. This bounds how much of a large blob is copied at a time.
+static constexpr size_t BLOB_STREAM_CHUNK_SIZE = 1 * MiB;
+
 JS::NonnullGCPtr<Blob> Blob::create(JS::Realm& realm, ByteBuffer byte_buffer, String type)
 {
     return realm.heap().allocate<Blob>(realm, realm, move(byte_buffer), move(type));
@@ -131,14 +134,22 @@ Blob::Blob(JS::Realm& realm)
 
 Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer, String type)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
     , m_type(move(type))
 {
+    set_bytes(move(byte_buffer));
 }
 
 Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+{
+    set_bytes(move(byte_buffer));
+}
+
+Blob::Blob(JS::Realm& realm, NonnullRefPtr<BlobStorage> storage, ReadonlyBytes bytes, String type)
+    : PlatformObject(realm)
+    , m_storage(move(storage))
+    , m_bytes(bytes)
+    , m_type(move(type))
 {
 }
 
@@ -150,6 +161,12 @@ void Blob::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(Blob);
 }
 
+void Blob::set_bytes(ByteBuffer byte_buffer)
+{
+    m_storage = BlobStorage::create(move(byte_buffer));
+    m_bytes = m_storage->bytes();
+}
+
 WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::SerializationRecord& record, bool, HTML::SerializationMemory&)
 {
     auto& vm = this->vm();
@@ -161,7 +178,7 @@ WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::SerializationRecord& r
     TRY(HTML::serialize_string(vm, record, m_type));
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    TRY(HTML::serialize_bytes(vm, record, m_byte_buffer.bytes()));
+    TRY(HTML::serialize_bytes(vm, record, m_bytes));
 
     return {};
 }
@@ -177,7 +194,7 @@ WebIDL::ExceptionOr<void> Blob::deserialization_steps(ReadonlySpan<u32> const& r
     m_type = TRY(HTML::deserialize_string(vm, record, position));
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(HTML::deserialize_bytes(vm, record, position));
+    set_bytes(TRY(HTML::deserialize_bytes(vm, record, position)));
 
     return {};
 }
@@ -303,8 +320,10 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<Blob>> Blob::slice_blob(Optional<i64> start
     // a. S refers to span consecutive bytes from blob’s associated byte sequence, beginning with the byte at byte-order position relativeStart.
     // b. S.size = span.
     // c. S.type = relativeContentType.
-    auto byte_buffer = TRY_OR_THROW_OOM(vm, m_byte_buffer.slice(relative_start, span));
-    return heap().allocate<Blob>(realm(), realm(), move(byte_buffer), move(relative_content_type));
+    // NOTE: The new Blob shares this blob's storage, rather than copying its bytes.
+    if (span == 0)
+        return heap().allocate<Blob>(realm(), realm(), ByteBuffer {}, move(relative_content_type));
+    return heap().allocate<Blob>(realm(), realm(), *m_storage, m_bytes.slice(relative_start, span), move(relative_content_type));
 }
 
 // https://w3c.github.io/FileAPI/#dom-blob-stream
@@ -322,55 +341,72 @@ JS::NonnullGCPtr<Streams::ReadableStream> Blob::get_stream()
     // 1. Let stream be a new ReadableStream created in blob’s relevant Realm.
     auto stream = realm.heap().allocate<Streams::ReadableStream>(realm, realm);
 
-    // 2. Set up stream with byte reading support.
-    set_up_readable_stream_controller_with_byte_reading_support(stream);
+    // 3. Run the following steps in parallel:
+    // NOTE: Rather than reading the whole blob up front, one chunk is read each time the stream is pulled from. A large
+    //       blob is thus never copied into the stream's queue all at once, and consumers that cancel the stream early
+    //       never pay for the rest of it.
+    auto pull_algorithm = JS::create_heap_function(realm.heap(), [&realm, stream, storage = m_storage, bytes = m_bytes, position = static_cast<size_t>(0)]() mutable {
+        auto promise = WebIDL::create_promise(realm);
 
-    // FIXME: 3. Run the following steps in parallel:
-    {
         // 1. While not all bytes of blob have been read:
-        //    NOTE: for simplicity the chunk is the entire buffer for now.
-        {
-            // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
-            auto bytes = m_byte_buffer;
-
-            // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
-            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), JS::create_heap_function(heap(), [stream, bytes = move(bytes)]() {
-                // NOTE: Using an TemporaryExecutionContext here results in a crash in the method HTML::incumbent_settings_object()
-                //       since we end up in a state where we have no execution context + an event loop with an empty incumbent
-                //       settings object stack. We still need an execution context therefore we push the realm's execution context
-                //       onto the realm's VM, and we need an incumbent settings object which is pushed onto the incumbent settings
-                //       object stack by EnvironmentSettings::prepare_to_run_callback().
-                auto& realm = stream->realm();
-                auto& environment_settings = Bindings::host_defined_environment_settings_object(realm);
-                realm.vm().push_execution_context(environment_settings.realm_execution_context());
-                environment_settings.prepare_to_run_callback();
-                ScopeGuard const guard = [&environment_settings, &realm] {
-                    environment_settings.clean_up_after_running_callback();
-                    realm.vm().pop_execution_context();
-                };
-
+        //     1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
+        auto chunk_bytes = bytes.slice(position, min(BLOB_STREAM_CHUNK_SIZE, bytes.size() - position));
+        position += chunk_bytes.size();
+        auto is_last_chunk = position == bytes.size();
+
+        //     2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
+        HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), JS::create_heap_function(realm.heap(), [stream, promise, storage, chunk_bytes, is_last_chunk]() {
+            // NOTE: Using an TemporaryExecutionContext here results in a crash in the method HTML::incumbent_settings_object()
+            //       since we end up in a state where we have no execution context + an event loop with an empty incumbent
+            //       settings object stack. We still need an execution context therefore we push the realm's execution context
+            //       onto the realm's VM, and we need an incumbent settings object which is pushed onto the incumbent settings
+            //       object stack by EnvironmentSettings::prepare_to_run_callback().
+            auto& realm = stream->realm();
+            auto& environment_settings = Bindings::host_defined_environment_settings_object(realm);
+            realm.vm().push_execution_context(environment_settings.realm_execution_context());
+            environment_settings.prepare_to_run_callback();
+            ScopeGuard const guard = [&environment_settings, &realm] {
+                environment_settings.clean_up_after_running_callback();
+                realm.vm().pop_execution_context();
+            };
+
+            if (!stream->is_readable()) {
+                WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+                return;
+            }
+
+            if (!chunk_bytes.is_empty()) {
                 // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
                 // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
-                auto array_buffer = JS::ArrayBuffer::create(stream->realm(), bytes);
-                auto chunk = JS::Uint8Array::create(stream->realm(), bytes.size(), *array_buffer);
+                auto array_buffer = JS::ArrayBuffer::create(realm, MUST(ByteBuffer::copy(chunk_bytes)));
+                auto chunk = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
                 // 3. Enqueue chunk in stream.
-                auto maybe_error = Bindings::throw_dom_exception_if_needed(stream->realm().vm(), [&]() {
+                auto maybe_error = Bindings::throw_dom_exception_if_needed(realm.vm(), [&]() {
                     return readable_stream_enqueue(*stream->controller(), chunk);
                 });
 
                 if (maybe_error.is_error()) {
                     readable_stream_error(*stream, maybe_error.release_error().value().value());
+                    WebIDL::resolve_promise(realm, promise, JS::js_undefined());
                     return;
                 }
+            }
 
-                // FIXME: Close the stream now that we have finished enqueuing all chunks to the stream. Without this, ReadableStream.read will never resolve the second time around with 'done' set.
-                //        Nowhere in the spec seems to mention this - but testing against other implementations the stream does appear to be closed after reading all data (closed callback is fired).
-                //        Probably there is a better way of doing this.
+            // FIXME: Close the stream now that we have finished enqueuing all chunks to the stream. Without this, ReadableStream.read will never resolve the second time around with 'done' set.
+            //        Nowhere in the spec seems to mention this - but testing against other implementations the stream does appear to be closed after reading all data (closed callback is fired).
+            //        Probably there is a better way of doing this.
+            if (is_last_chunk)
                 readable_stream_close(*stream);
-            }));
-        }
-    }
+
+            WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+        }));
+
+        return promise;
+    });
+
+    // 2. Set up stream with byte reading support.
+    set_up_readable_stream_controller_with_byte_reading_support(stream, pull_algorithm);
 
     // 4. Return stream.
     return stream;
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <AK/Vector.h>
 #include <LibWeb/Bindings/BlobPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -27,6 +28,23 @@ struct BlobPropertyBag {
 [[nodiscard]] ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options = {});
 [[nodiscard]] bool is_basic_latin(StringView view);
 
+// A Blob's byte sequence never changes once the Blob is created, so slices of a Blob share its storage rather than
+// copying it.
+class BlobStorage final : public RefCounted<BlobStorage> {
+public:
+    static NonnullRefPtr<BlobStorage> create(ByteBuffer bytes) { return adopt_ref(*new BlobStorage(move(bytes))); }
+
+    ReadonlyBytes bytes() const { return m_bytes; }
+
+private:
+    explicit BlobStorage(ByteBuffer bytes)
+        : m_bytes(move(bytes))
+    {
+    }
+
+    ByteBuffer m_bytes;
+};
+
 class Blob
     : public Bindings::PlatformObject
     , public Bindings::Serializable {
@@ -41,7 +59,7 @@ public:
     static WebIDL::ExceptionOr<JS::NonnullGCPtr<Blob>> construct_impl(JS::Realm&, Optional<Vector<BlobPart>> const& blob_parts = {}, Optional<BlobPropertyBag> const& options = {});
 
     // https://w3c.github.io/FileAPI/#dfn-size
-    u64 size() const { return m_byte_buffer.size(); }
+    u64 size() const { return m_bytes.size(); }
     // https://w3c.github.io/FileAPI/#dfn-type
     String const& type() const { return m_type; }
 
@@ -52,7 +70,7 @@ public:
     JS::NonnullGCPtr<JS::Promise> array_buffer();
     JS::NonnullGCPtr<JS::Promise> bytes();
 
-    ReadonlyBytes raw_bytes() const { return m_byte_buffer.bytes(); }
+    ReadonlyBytes raw_bytes() const { return m_bytes; }
 
     JS::NonnullGCPtr<Streams::ReadableStream> get_stream();
 
@@ -64,12 +82,16 @@ public:
 protected:
     Blob(JS::Realm&, ByteBuffer, String type);
     Blob(JS::Realm&, ByteBuffer);
+    Blob(JS::Realm&, NonnullRefPtr<BlobStorage>, ReadonlyBytes, String type);
 
     virtual void initialize(JS::Realm&) override;
 
     WebIDL::ExceptionOr<JS::NonnullGCPtr<Blob>> slice_blob(Optional<i64> start = {}, Optional<i64> end = {}, Optional<String> const& content_type = {});
 
-    ByteBuffer m_byte_buffer {};
+    void set_bytes(ByteBuffer);
+
+    RefPtr<BlobStorage> m_storage;
+    ReadonlyBytes m_bytes; // This blob's byte sequence, within m_storage.
     String m_type {};
 
 private:
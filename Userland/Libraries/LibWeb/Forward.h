@@ -80,6 +80,11 @@ namespace Web::Clipboard {
 class Clipboard;
 }
 
+namespace Web::Compression {
+class CompressionStream;
+class DecompressionStream;
+}
+
 namespace Web::Cookie {
 struct Cookie;
 struct ParsedCookie;
@@ -224,6 +229,7 @@ enum class MediaFeatureID;
 enum class PropertyID;
 
 struct BackgroundLayerData;
+struct InvalidationSet;
 }
 
 namespace Web::CSS::Parser {
@@ -258,6 +264,7 @@ class DOMEventListener;
 class DOMImplementation;
 class DOMTokenList;
 class Element;
+class ElementByIdMap;
 class Event;
 class EventHandler;
 class EventTarget;
@@ -307,6 +314,10 @@ namespace Web::EntriesAPI {
 class FileSystemEntry;
 }
 
+namespace Web::EventTiming {
+class PerformanceEventTiming;
+}
+
 namespace Web::Fetch {
 class BodyMixin;
 class Headers;
@@ -495,6 +506,7 @@ class ServiceWorkerRegistration;
 class SharedResourceRequest;
 class Storage;
 class SubmitEvent;
+class Task;
 class TextMetrics;
 class TextTrack;
 class TextTrackCue;
@@ -544,9 +556,20 @@ class Performance;
 }
 
 namespace Web::IndexedDB {
+class Database;
+class IDBCursor;
+class IDBCursorWithValue;
+class IDBDatabase;
 class IDBFactory;
+class IDBIndex;
+class IDBKeyRange;
+class IDBObjectStore;
 class IDBOpenDBRequest;
 class IDBRequest;
+class IDBTransaction;
+class IDBVersionChangeEvent;
+class Index;
+class ObjectStore;
 }
 
 namespace Web::Internals {
@@ -593,6 +616,11 @@ enum class LayoutMode;
 struct LayoutState;
 }
 
+namespace Web::LongTasks {
+class PerformanceLongTaskTiming;
+class TaskAttributionTiming;
+}
+
 namespace Web::MathML {
 class MathMLElement;
 }
@@ -633,6 +661,7 @@ struct LinearGradientData;
 
 namespace Web::PerformanceTimeline {
 class PerformanceEntry;
+class PerformanceGarbageCollectionTiming;
 class PerformanceObserver;
 class PerformanceObserverEntryList;
 struct PerformanceObserverInit;
@@ -655,6 +684,10 @@ namespace Web::RequestIdleCallback {
 class IdleDeadline;
 }
 
+namespace Web::ResourceTiming {
+class PerformanceResourceTiming;
+}
+
 namespace Web::ResizeObserver {
 class ResizeObserver;
 }
@@ -663,9 +696,15 @@ namespace Web::Selection {
 class Selection;
 }
 
+namespace Web::ServiceWorker {
+class Registration;
+struct ServiceWorkerRecord;
+}
+
 namespace Web::Streams {
 class ByteLengthQueuingStrategy;
 class CountQueuingStrategy;
+class GenericTransformStreamMixin;
 class ReadableByteStreamController;
 class ReadableStream;
 class ReadableStreamBYOBReader;
@@ -754,6 +793,7 @@ class AudioContext;
 class AudioDestinationNode;
 class AudioNode;
 class AudioParam;
+class AudioRenderer;
 class AudioScheduledSourceNode;
 class BaseAudioContext;
 class BiquadFilterNode;
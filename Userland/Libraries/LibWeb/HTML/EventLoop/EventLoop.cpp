@@ -11,6 +11,7 @@
 #include <LibWeb/CSS/FontFaceSet.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/EventTiming/PerformanceEventTiming.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -19,6 +20,8 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/Timer.h>
@@ -149,7 +152,7 @@ void EventLoop::process()
 
     // 1. Let oldestTask and taskStartTime be null.
     JS::GCPtr<Task> oldest_task;
-    [[maybe_unused]] double task_start_time = 0;
+    double task_start_time = 0;
 
     // 2. If the event loop has a task queue with at least one runnable task, then:
     if (m_task_queue->has_runnable_tasks()) {
@@ -178,18 +181,33 @@ void EventLoop::process()
     }
 
     // 3. Let taskEndTime be the unsafe shared current time. [HRT]
-    [[maybe_unused]] auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
+    auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 4. If oldestTask is not null, then:
     if (oldest_task) {
-        // FIXME: 1. Let top-level browsing contexts be an empty set.
-        // FIXME: 2. For each environment settings object settings of oldestTask's script evaluation environment settings object set:
-        // FIXME: 2.1. Let global be settings's global object.
-        // FIXME: 2.2. If global is not a Window object, then continue.
-        // FIXME: 2.3. If global's browsing context is null, then continue.
-        // FIXME: 2.4. Let tlbc be global's browsing context's top-level browsing context.
-        // FIXME: 2.5. If tlbc is not null, then append it to top-level browsing contexts.
-        // FIXME: 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
+        m_statistics.record_task(oldest_task->source(), task_end_time - task_start_time);
+
+        // 1. Let top-level browsing contexts be an empty set.
+        Vector<JS::NonnullGCPtr<TraversableNavigable>> top_level_traversables;
+
+        // 2. For each environment settings object settings of oldestTask's script evaluation environment settings object set:
+        // FIXME: We don't keep track of a task's script evaluation environment settings object set, so we use the task's
+        //        document's relevant global object instead.
+        if (auto const* document = oldest_task->document()) {
+            // 1. Let global be settings's global object.
+            // 2. If global is not a Window object, then continue.
+            // 3. If global's browsing context is null, then continue.
+            // 4. Let tlbc be global's browsing context's top-level browsing context.
+            // 5. If tlbc is not null, then append it to top-level browsing contexts.
+            if (auto navigable = document->navigable()) {
+                if (auto top_level_traversable = navigable->top_level_traversable())
+                    top_level_traversables.append(*top_level_traversable);
+            }
+        }
+
+        // 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
+        LongTasks::report_long_tasks(task_start_time, task_end_time, top_level_traversables, *oldest_task);
+
         // FIXME: 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
     }
 
@@ -205,6 +223,11 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // NOTE: If we're about to hit the GC threshold anyway, collect now while there's nothing else to do,
+        //       rather than on some allocation in the middle of the next task.
+        if (vm().heap().should_collect_when_idle())
+            vm().heap().collect_garbage();
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
@@ -237,7 +260,9 @@ void EventLoop::queue_task_to_update_the_rendering()
         queue_global_task(Task::Source::Rendering, *navigable->active_window(), JS::create_heap_function(navigable->heap(), [this] mutable {
             VERIFY(!m_is_running_rendering_task);
             m_is_running_rendering_task = true;
-            ScopeGuard const guard = [this] {
+            auto rendering_start_time = HighResolutionTime::unsafe_shared_current_time();
+            ScopeGuard const guard = [this, rendering_start_time] {
+                m_statistics.record_rendering_update(HighResolutionTime::unsafe_shared_current_time() - rendering_start_time);
                 m_is_running_rendering_task = false;
             };
 
@@ -360,6 +385,12 @@ void EventLoop::queue_task_to_update_the_rendering()
 
             // FIXME: 21. For each doc of docs, mark paint timing for doc.
 
+            // https://w3c.github.io/event-timing/#sec-modifications-HTML
+            // For each doc of docs, dispatch pending Event Timing entries for doc.
+            for (auto& document : docs) {
+                EventTiming::dispatch_pending_event_timing_entries(*document);
+            }
+
             // 22. For each doc of docs, update the rendering or user interface of doc and its node navigable to reflect the current state.
             for (auto& document : docs) {
                 document->page().client().process_screenshot_requests();
@@ -468,6 +499,11 @@ void EventLoop::perform_a_microtask_checkpoint()
     // 2. Set the event loop's performing a microtask checkpoint to true.
     m_performing_a_microtask_checkpoint = true;
 
+    // NOTE: Most checkpoints have nothing to do, so only the ones that run microtasks are recorded.
+    Optional<double> checkpoint_start_time;
+    if (!m_microtask_queue->is_empty())
+        checkpoint_start_time = HighResolutionTime::unsafe_shared_current_time();
+
     // 3. While the event loop's microtask queue is not empty:
     while (!m_microtask_queue->is_empty()) {
         // 1. Let oldestMicrotask be the result of dequeuing from the event loop's microtask queue.
@@ -487,13 +523,17 @@ void EventLoop::perform_a_microtask_checkpoint()
     for (auto& environment_settings_object : m_related_environment_settings_objects)
         environment_settings_object->notify_about_rejected_promises({});
 
-    // FIXME: 5. Cleanup Indexed Database transactions.
+    // 5. Cleanup Indexed Database transactions.
+    IndexedDB::cleanup_indexed_database_transactions(*this);
 
     // 6. Perform ClearKeptObjects().
     vm().finish_execution_generation();
 
     // 7. Set the event loop's performing a microtask checkpoint to false.
     m_performing_a_microtask_checkpoint = false;
+
+    if (checkpoint_start_time.has_value())
+        m_statistics.record_microtask_checkpoint(HighResolutionTime::unsafe_shared_current_time() - *checkpoint_start_time);
 }
 
 Vector<JS::Handle<DOM::Document>> EventLoop::documents_in_this_event_loop() const
@@ -11,6 +11,7 @@
 #include <LibCore/Forward.h>
 #include <LibJS/Forward.h>
 #include <LibJS/SafeFunction.h>
+#include <LibWeb/HTML/EventLoop/EventLoopStatistics.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
 
 namespace Web::HTML {
@@ -76,6 +77,9 @@ public:
     void set_execution_paused(bool execution_paused) { m_execution_paused = execution_paused; }
     bool execution_paused() const { return m_execution_paused; }
 
+    EventLoopStatistics& statistics() { return m_statistics; }
+    EventLoopStatistics const& statistics() const { return m_statistics; }
+
 private:
     explicit EventLoop(Type);
 
@@ -116,6 +120,8 @@ private:
     bool m_skip_event_loop_processing_steps { false };
 
     bool m_is_running_rendering_task { false };
+
+    EventLoopStatistics m_statistics;
 };
 
 EventLoop& main_thread_event_loop();
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibWeb/HTML/EventLoop/EventLoopStatistics.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
+
+namespace Web::HTML {
+
+void DurationHistogram::record(HighResolutionTime::DOMHighResTimeStamp duration)
+{
+    if (duration < 0)
+        duration = 0;
+
+    ++m_count;
+    m_total += duration;
+    m_max = AK::max(m_max, duration);
+
+    size_t bucket = 0;
+    for (double upper_bound = 1; bucket < bucket_count - 1 && duration >= upper_bound; upper_bound *= 2)
+        ++bucket;
+    ++m_buckets[bucket];
+}
+
+JsonObject DurationHistogram::to_json() const
+{
+    JsonArray buckets;
+    for (auto count : m_buckets)
+        buckets.must_append(count);
+
+    JsonObject object;
+    object.set("count"sv, m_count);
+    object.set("total_ms"sv, m_total);
+    object.set("max_ms"sv, m_max);
+    object.set("buckets"sv, move(buckets));
+    return object;
+}
+
+static StringView task_source_name(Task::Source source)
+{
+    switch (source) {
+    case Task::Source::Unspecified:
+        return "Unspecified"sv;
+    case Task::Source::DOMManipulation:
+        return "DOMManipulation"sv;
+    case Task::Source::UserInteraction:
+        return "UserInteraction"sv;
+    case Task::Source::Networking:
+        return "Networking"sv;
+    case Task::Source::HistoryTraversal:
+        return "HistoryTraversal"sv;
+    case Task::Source::IdleTask:
+        return "IdleTask"sv;
+    case Task::Source::PostedMessage:
+        return "PostedMessage"sv;
+    case Task::Source::Microtask:
+        return "Microtask"sv;
+    case Task::Source::TimerTask:
+        return "TimerTask"sv;
+    case Task::Source::JavaScriptEngine:
+        return "JavaScriptEngine"sv;
+    case Task::Source::NavigationAndTraversal:
+        return "NavigationAndTraversal"sv;
+    case Task::Source::FileReading:
+        return "FileReading"sv;
+    case Task::Source::IntersectionObserver:
+        return "IntersectionObserver"sv;
+    case Task::Source::PerformanceTimeline:
+        return "PerformanceTimeline"sv;
+    case Task::Source::CanvasBlobSerializationTask:
+        return "CanvasBlobSerializationTask"sv;
+    case Task::Source::Clipboard:
+        return "Clipboard"sv;
+    case Task::Source::Permissions:
+        return "Permissions"sv;
+    case Task::Source::FontLoading:
+        return "FontLoading"sv;
+    case Task::Source::RemoteEvent:
+        return "RemoteEvent"sv;
+    case Task::Source::Rendering:
+        return "Rendering"sv;
+    case Task::Source::DatabaseAccess:
+        return "DatabaseAccess"sv;
+    case Task::Source::UniqueTaskSourceStart:
+        break;
+    }
+    return "Unique"sv;
+}
+
+void EventLoopStatistics::record_task(Task::Source source, HighResolutionTime::DOMHighResTimeStamp duration)
+{
+    if (to_underlying(source) > to_underlying(Task::Source::UniqueTaskSourceStart))
+        source = Task::Source::UniqueTaskSourceStart;
+
+    m_tasks.ensure(source).record(duration);
+
+    if (duration >= LongTasks::long_tasks_threshold)
+        ++m_long_task_count;
+}
+
+void EventLoopStatistics::record_garbage_collection(JS::Heap::GarbageCollectionEvent const& event)
+{
+    m_garbage_collections.record(event.duration.to_nanoseconds() / 1.0e6);
+    m_swept_cells += event.swept_cells;
+    m_swept_bytes += event.swept_bytes;
+    m_recent_garbage_collections.enqueue(event);
+}
+
+static JsonObject garbage_collection_to_json(JS::Heap::GarbageCollectionEvent const& event)
+{
+    JsonObject object;
+    object.set("type"sv, event.type == JS::Heap::CollectionType::CollectGarbage ? "collect-garbage"sv : "collect-everything"sv);
+    object.set("start_ms"sv, event.start_time.nanoseconds() / 1.0e6);
+    object.set("duration_ms"sv, event.duration.to_nanoseconds() / 1.0e6);
+    object.set("used_bytes_before"sv, event.used_bytes_before);
+    object.set("used_bytes_after"sv, event.used_bytes_after);
+    object.set("swept_cells"sv, event.swept_cells);
+    object.set("swept_bytes"sv, event.swept_bytes);
+    return object;
+}
+
+JsonObject EventLoopStatistics::to_json() const
+{
+    JsonObject tasks;
+    for (auto const& [source, histogram] : m_tasks)
+        tasks.set(task_source_name(source), histogram.to_json());
+
+    JsonObject object;
+    object.set("tasks"sv, move(tasks));
+    object.set("microtask_checkpoints"sv, m_microtask_checkpoints.to_json());
+    object.set("rendering_updates"sv, m_rendering_updates.to_json());
+    object.set("long_tasks"sv, m_long_task_count);
+
+    JsonArray recent_garbage_collections;
+    for (auto const& event : m_recent_garbage_collections)
+        recent_garbage_collections.must_append(garbage_collection_to_json(event));
+
+    JsonObject garbage_collections = m_garbage_collections.to_json();
+    garbage_collections.set("swept_cells"sv, m_swept_cells);
+    garbage_collections.set("swept_bytes"sv, m_swept_bytes);
+    garbage_collections.set("recent"sv, move(recent_garbage_collections));
+    object.set("garbage_collections"sv, move(garbage_collections));
+    return object;
+}
+
+}
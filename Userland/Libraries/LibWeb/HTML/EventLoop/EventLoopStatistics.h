@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/CircularQueue.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <LibJS/Heap/Heap.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+
+namespace Web::HTML {
+
+// A histogram of durations in milliseconds, with power-of-two bucket boundaries: [0, 1), [1, 2), [2, 4), ..., [1024, ∞).
+class DurationHistogram {
+public:
+    static constexpr size_t bucket_count = 12;
+
+    void record(HighResolutionTime::DOMHighResTimeStamp duration);
+
+    u64 count() const { return m_count; }
+    HighResolutionTime::DOMHighResTimeStamp total() const { return m_total; }
+    HighResolutionTime::DOMHighResTimeStamp max() const { return m_max; }
+    Array<u64, bucket_count> const& buckets() const { return m_buckets; }
+
+    JsonObject to_json() const;
+
+private:
+    u64 m_count { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_total { 0 };
+    HighResolutionTime::DOMHighResTimeStamp m_max { 0 };
+    Array<u64, bucket_count> m_buckets {};
+};
+
+// Durations of everything the event loop spends its time on, for telemetry and internal pages. These are kept for the
+// whole lifetime of the event loop, which is cheap as there are only a handful of histograms.
+class EventLoopStatistics {
+public:
+    void record_task(Task::Source, HighResolutionTime::DOMHighResTimeStamp duration);
+    void record_microtask_checkpoint(HighResolutionTime::DOMHighResTimeStamp duration) { m_microtask_checkpoints.record(duration); }
+    void record_rendering_update(HighResolutionTime::DOMHighResTimeStamp duration) { m_rendering_updates.record(duration); }
+    void record_garbage_collection(JS::Heap::GarbageCollectionEvent const&);
+
+    // https://w3c.github.io/longtasks/#long-task
+    u64 long_task_count() const { return m_long_task_count; }
+
+    JsonObject to_json() const;
+
+private:
+    // NOTE: All unique task sources are recorded as UniqueTaskSourceStart, as there can be any number of them.
+    HashMap<Task::Source, DurationHistogram> m_tasks;
+    DurationHistogram m_microtask_checkpoints;
+    DurationHistogram m_rendering_updates;
+    u64 m_long_task_count { 0 };
+
+    DurationHistogram m_garbage_collections;
+    u64 m_swept_cells { 0 };
+    u64 m_swept_bytes { 0 };
+
+    // The most recent collections, so that a pause can be matched up with the heap size around it.
+    static constexpr size_t recent_garbage_collection_count = 32;
+    CircularQueue<JS::Heap::GarbageCollectionEvent, recent_garbage_collection_count> m_recent_garbage_collections;
+};
+
+}
@@ -66,6 +66,9 @@ public:
         // https://html.spec.whatwg.org/multipage/webappapis.html#rendering-task-source
         Rendering,
 
+        // https://w3c.github.io/IndexedDB/#database-access-task-source
+        DatabaseAccess,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
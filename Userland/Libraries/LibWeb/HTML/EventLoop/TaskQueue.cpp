@@ -23,7 +23,16 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (size_t i = m_first_task_index; i < m_tasks.size(); ++i)
+        visitor.visit(m_tasks[i]);
+}
+
+void TaskQueue::remove_dequeued_tasks()
+{
+    if (m_first_task_index == 0)
+        return;
+    m_tasks.remove(0, m_first_task_index);
+    m_first_task_index = 0;
 }
 
 void TaskQueue::add(JS::NonnullGCPtr<Task> task)
@@ -32,11 +41,27 @@ void TaskQueue::add(JS::NonnullGCPtr<Task> task)
     m_event_loop->schedule();
 }
 
+JS::GCPtr<Task> TaskQueue::dequeue()
+{
+    if (is_empty())
+        return {};
+
+    auto task = m_tasks[m_first_task_index++];
+    if (is_empty()) {
+        m_tasks.clear_with_capacity();
+        m_first_task_index = 0;
+    } else if (m_first_task_index >= m_tasks.size() / 2) {
+        remove_dequeued_tasks();
+    }
+    return task;
+}
+
 JS::GCPtr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
+    remove_dequeued_tasks();
     for (size_t i = 0; i < m_tasks.size(); ++i) {
         if (m_tasks[i]->is_runnable())
             return m_tasks.take(i);
@@ -49,8 +74,8 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (task->is_runnable())
+    for (size_t i = m_first_task_index; i < m_tasks.size(); ++i) {
+        if (m_tasks[i]->is_runnable())
             return true;
     }
     return false;
@@ -58,6 +83,7 @@ bool TaskQueue::has_runnable_tasks() const
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
+    remove_dequeued_tasks();
     m_tasks.remove_all_matching([&](auto& task) {
         return filter(*task);
     });
@@ -67,6 +93,8 @@ JS::MarkedVector<JS::NonnullGCPtr<Task>> TaskQueue::take_tasks_matching(Function
 {
     JS::MarkedVector<JS::NonnullGCPtr<Task>> matching_tasks(heap());
 
+    remove_dequeued_tasks();
+
     for (size_t i = 0; i < m_tasks.size();) {
         auto& task = m_tasks.at(i);
 
@@ -83,7 +111,7 @@ JS::MarkedVector<JS::NonnullGCPtr<Task>> TaskQueue::take_tasks_matching(Function
 
 Task const* TaskQueue::last_added_task() const
 {
-    if (m_tasks.is_empty())
+    if (is_empty())
         return nullptr;
     return m_tasks.last();
 }
@@ -20,7 +20,7 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const { return m_first_task_index == m_tasks.size(); }
 
     bool has_runnable_tasks() const;
 
@@ -28,12 +28,7 @@ public:
     JS::GCPtr<HTML::Task> take_first_runnable();
 
     void enqueue(JS::NonnullGCPtr<HTML::Task> task) { add(task); }
-    JS::GCPtr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    JS::GCPtr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     JS::MarkedVector<JS::NonnullGCPtr<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
@@ -43,9 +38,15 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
+    void remove_dequeued_tasks();
+
     JS::NonnullGCPtr<HTML::EventLoop> m_event_loop;
 
+    // NOTE: Tasks before m_first_task_index have already been dequeued. Instead of shifting the whole vector every time
+    //       the oldest task is dequeued (which made draining a long microtask queue quadratic), they are removed in bulk
+    //       once they make up at least half of the vector, or before any operation that needs to remove arbitrary tasks.
     Vector<JS::NonnullGCPtr<HTML::Task>> m_tasks;
+    size_t m_first_task_index { 0 };
 };
 
 }
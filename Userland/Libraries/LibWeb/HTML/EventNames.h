@@ -55,6 +55,7 @@ namespace Web::HTML::EventNames {
     __ENUMERATE_HTML_EVENT(enter)                    \
     __ENUMERATE_HTML_EVENT(error)                    \
     __ENUMERATE_HTML_EVENT(exit)                     \
+    __ENUMERATE_HTML_EVENT(fetch)                    \
     __ENUMERATE_HTML_EVENT(finish)                   \
     __ENUMERATE_HTML_EVENT(focus)                    \
     __ENUMERATE_HTML_EVENT(focusin)                  \
@@ -116,6 +117,7 @@ namespace Web::HTML::EventNames {
     __ENUMERATE_HTML_EVENT(unhandledrejection)       \
     __ENUMERATE_HTML_EVENT(unload)                   \
     __ENUMERATE_HTML_EVENT(upgradeneeded)            \
+    __ENUMERATE_HTML_EVENT(versionchange)            \
     __ENUMERATE_HTML_EVENT(visibilitychange)         \
     __ENUMERATE_HTML_EVENT(volumechange)             \
     __ENUMERATE_HTML_EVENT(waiting)                  \
@@ -34,6 +34,7 @@
 #include <LibWeb/HTML/WindowProxy.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Layout/Node.h>
+#include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/Paintable.h>
@@ -1370,6 +1371,7 @@ WebIDL::ExceptionOr<void> Navigable::navigate(NavigateParams params)
     }
 
     if (is_top_level_traversable()) {
+        active_browsing_context()->page().clear_network_requests();
         active_browsing_context()->page().client().page_did_start_loading(url, false);
     }
 
@@ -2013,6 +2015,8 @@ void Navigable::set_viewport_size(CSSPixelSize size)
     if (auto document = active_document()) {
         // NOTE: Resizing the viewport changes the reference value for viewport-relative CSS lengths.
         document->invalidate_style(DOM::StyleInvalidationReason::NavigableSetViewportSize);
+        if (auto* layout_root = document->layout_node())
+            layout_root->invalidate_all_intrinsic_sizes();
         document->set_needs_layout();
     }
 
@@ -2029,11 +2033,11 @@ void Navigable::set_viewport_size(CSSPixelSize size)
 void Navigable::perform_scroll_of_viewport(CSSPixelPoint new_position)
 {
     if (m_viewport_scroll_offset != new_position) {
-        m_viewport_scroll_offset = new_position;
+        auto old_position = exchange(m_viewport_scroll_offset, new_position);
         scroll_offset_did_change();
 
         if (auto document = active_document()) {
-            document->set_needs_display(InvalidateDisplayList::No);
+            document->did_scroll_viewport(old_position, new_position);
             document->set_needs_to_refresh_scroll_state(true);
             document->inform_all_viewport_clients_about_the_current_viewport_rect();
         }
@@ -2065,7 +2069,10 @@ bool Navigable::has_a_rendering_opportunity() const
     // or whether the document's visibility state is "visible".
     // Rendering opportunities typically occur at regular intervals.
 
-    // FIXME: Return `false` here if we're an inactive browser tab.
+    // NOTE: Browser tabs that are hidden from the user have no rendering opportunities.
+    if (auto traversable = traversable_navigable(); traversable && traversable->system_visibility_state() == VisibilityState::Hidden)
+        return false;
+
     auto browsing_context = const_cast<Navigable*>(this)->active_browsing_context();
     if (!browsing_context)
         return false;
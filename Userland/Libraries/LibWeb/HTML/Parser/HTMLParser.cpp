@@ -6,9 +6,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
 #include <AK/SourceLocation.h>
 #include <AK/Utf32View.h>
+#include <LibCore/Tracing.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -24,6 +27,8 @@
 #include <LibWeb/DOM/QualifiedName.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/HTML/CustomElements/CustomElementDefinition.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventNames.h>
@@ -32,16 +37,22 @@
 #include <LibWeb/HTML/HTMLScriptElement.h>
 #include <LibWeb/HTML/HTMLTableElement.h>
 #include <LibWeb/HTML/HTMLTemplateElement.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/SharedResourceRequest.h>
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/SimpleFragmentParser.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/MathML/TagNames.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
 #include <LibWeb/SVG/SVGScriptElement.h>
 #include <LibWeb/SVG/TagNames.h>
 
@@ -172,8 +183,114 @@ void HTMLParser::visit_edges(Cell::Visitor& visitor)
     m_list_of_active_formatting_elements.visit_edges(visitor);
 }
 
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // AD-HOC: Rather than building speculative mock elements, we run a separate tokenizer over the input that the real
+    //         parser hasn't consumed yet and make speculative fetches for the resources it references. Images go through
+    //         the document's shared resource requests, so the <img> element created later picks up the in-flight fetch.
+    //         Scripts and style sheets have no such sharing yet, so for those we only warm up a connection to their origin.
+    if (m_speculatively_parsed_input_length == m_tokenizer.input_length())
+        return;
+    m_speculatively_parsed_input_length = m_tokenizer.input_length();
+
+    auto input = m_tokenizer.unconsumed_input();
+    if (input.is_empty())
+        return;
+
+    auto& realm = m_document->realm();
+    auto base_url = m_document->base_url();
+    bool seen_base_element = false;
+    size_t picture_nesting_level = 0;
+    HashTable<URL::Origin> preconnected_origins;
+
+    auto preconnect = [&](URL::URL const& url) {
+        if (!url.is_valid() || !url.scheme().is_one_of("http"sv, "https"sv))
+            return;
+        auto origin = url.origin();
+        if (origin.is_same_origin(m_document->origin()) || preconnected_origins.set(origin) != HashSetResult::InsertedNewEntry)
+            return;
+        ResourceLoader::the().preconnect(url);
+    };
+
+    HTMLTokenizer tokenizer { input, "utf-8"sv };
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_end_tag()) {
+            if (token->tag_name() == HTML::TagNames::picture && picture_nesting_level > 0)
+                --picture_nesting_level;
+            continue;
+        }
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+
+        // Switch the tokenizer the same way tree construction would, so the contents of these elements aren't scanned as markup.
+        if (tag_name == HTML::TagNames::script)
+            tokenizer.switch_to({}, HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(HTML::TagNames::title, HTML::TagNames::textarea))
+            tokenizer.switch_to({}, HTMLTokenizer::State::RCDATA);
+        else if (tag_name.is_one_of(HTML::TagNames::style, HTML::TagNames::xmp, HTML::TagNames::iframe, HTML::TagNames::noembed, HTML::TagNames::noframes)
+            || (tag_name == HTML::TagNames::noscript && m_scripting_enabled))
+            tokenizer.switch_to({}, HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name == HTML::TagNames::plaintext)
+            tokenizer.switch_to({}, HTMLTokenizer::State::PLAINTEXT);
+
+        if (tag_name == HTML::TagNames::base) {
+            if (seen_base_element)
+                continue;
+            if (auto href = token->attribute(HTML::AttributeNames::href); href.has_value()) {
+                seen_base_element = true;
+                if (auto url = m_document->fallback_base_url().complete_url(*href); url.is_valid())
+                    base_url = move(url);
+            }
+        } else if (tag_name == HTML::TagNames::picture) {
+            ++picture_nesting_level;
+        } else if (tag_name == HTML::TagNames::img) {
+            // Only fetch images whose URL doesn't depend on layout or on the <picture> sources around them.
+            if (picture_nesting_level > 0 || token->has_attribute(HTML::AttributeNames::srcset))
+                continue;
+            if (auto loading = token->attribute(HTML::AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+                continue;
+            auto src = token->attribute(HTML::AttributeNames::src);
+            if (!src.has_value() || src->is_empty())
+                continue;
+            auto url = base_url.complete_url(*src);
+            if (!url.is_valid())
+                continue;
+
+            auto shared_resource_request = SharedResourceRequest::get_or_create(realm, m_document->page(), url);
+            if (!shared_resource_request->needs_fetching())
+                continue;
+
+            auto cors_setting = cors_setting_attribute_from_keyword(token->attribute(HTML::AttributeNames::crossorigin));
+            auto request = create_potential_CORS_request(realm.vm(), url, Fetch::Infrastructure::Request::Destination::Image, cors_setting);
+            request->set_client(&m_document->relevant_settings_object());
+            request->set_referrer_policy(ReferrerPolicy::from_string(token->attribute(HTML::AttributeNames::referrerpolicy).value_or({})).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+            shared_resource_request->fetch_resource(realm, request);
+        } else if (tag_name == HTML::TagNames::script) {
+            if (auto src = token->attribute(HTML::AttributeNames::src); src.has_value())
+                preconnect(base_url.complete_url(*src));
+        } else if (tag_name == HTML::TagNames::link) {
+            auto rel = token->attribute(HTML::AttributeNames::rel);
+            auto href = token->attribute(HTML::AttributeNames::href);
+            if (!rel.has_value() || !href.has_value())
+                continue;
+            auto keywords = rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
+            if (any_of(keywords, [](auto keyword) { return keyword.equals_ignoring_ascii_case("stylesheet"sv); }))
+                preconnect(base_url.complete_url(*href));
+        }
+    }
+}
+
 void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
+    TRACE_SCOPE("parse", "HTMLParser::run");
+
     for (;;) {
         // FIXME: Find a better way to say that we come from Document::close() and want to process EOF.
         if (!m_tokenizer.is_eof_inserted() && m_tokenizer.is_insertion_point_reached())
@@ -228,6 +345,42 @@ void HTMLParser::run(const URL::URL& url, HTMLTokenizer::StopAtInsertionPoint st
     m_document->detach_parser({});
 }
 
+// Like run(url), but yields to the event loop after each slice of input, so that what has been parsed so far can be
+// rendered before a large document has been parsed completely.
+void HTMLParser::run_in_slices(URL::URL const& url)
+{
+    m_document->set_url(url);
+    m_document->set_source(MUST(String::from_byte_string(m_tokenizer.source())));
+    run_next_slice();
+}
+
+void HTMLParser::run_next_slice()
+{
+    static constexpr size_t slice_size = 256 * KiB;
+
+    // NOTE: If the document was aborted in the meantime, it has already been marked as complete.
+    if (m_aborted) {
+        m_document->detach_parser({});
+        return;
+    }
+
+    auto slice_end = m_tokenizer.pause_offset().value_or(0) + slice_size;
+    if (m_stop_parsing || slice_end >= m_tokenizer.input_length()) {
+        m_tokenizer.set_pause_offset({});
+        run();
+        the_end(*m_document, this);
+        m_document->detach_parser({});
+        return;
+    }
+
+    m_tokenizer.set_pause_offset(slice_end);
+    run();
+
+    Platform::EventLoopPlugin::the().deferred_invoke([parser = JS::NonnullGCPtr { *this }] {
+        parser->run_next_slice();
+    });
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#the-end
 void HTMLParser::the_end(JS::NonnullGCPtr<DOM::Document> document, JS::GCPtr<HTMLParser> parser)
 {
@@ -1153,6 +1306,21 @@ void HTMLParser::flush_character_insertions()
 
 void HTMLParser::insert_character(u32 data)
 {
+    // Fast path: Consecutive characters almost always go into the text node we're already collecting data for.
+    //            Without foster parenting, the appropriate place for inserting is after the current node's last child,
+    //            so if that's still our text node, we can skip looking for the insertion location again.
+    if (m_character_insertion_node && !m_foster_parenting) {
+        auto& target = current_node();
+        if (m_character_insertion_node->parent() == &target && target.last_child() == m_character_insertion_node.ptr()) {
+            // If what we collected has already been flushed to the node (e.g. because the parser yielded while waiting
+            // for more input), carry on from its current data, so the text isn't split across several nodes.
+            if (m_character_insertion_builder.is_empty())
+                m_character_insertion_builder.append(m_character_insertion_node->data());
+            m_character_insertion_builder.append_code_point(data);
+            return;
+        }
+    }
+
     auto node = find_character_insertion_node();
     if (node == m_character_insertion_node.ptr()) {
         m_character_insertion_builder.append_code_point(data);
@@ -2930,7 +3098,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -2949,7 +3118,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: Our speculative parser runs to completion when started, so there is nothing to stop here.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4269,6 +4439,11 @@ DOM::Document& HTMLParser::document()
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
 Vector<JS::Handle<DOM::Node>> HTMLParser::parse_html_fragment(DOM::Element& context_element, StringView markup, AllowDeclarativeShadowRoots allow_declarative_shadow_roots)
 {
+    // NOTE: Most markup assigned to innerHTML and friends is a handful of well-formed elements and text, which we can
+    //       turn into nodes directly without setting up a document, tokenizer and tree builder for it.
+    if (auto nodes = try_parse_simple_html_fragment(context_element, markup); nodes.has_value())
+        return nodes.release_value();
+
     // 1. Create a new Document node, and mark it as being an HTML document.
     auto temp_document = DOM::Document::create_for_fragment_parsing(context_element.realm());
     temp_document->set_document_type(DOM::Document::Type::HTML);
@@ -4392,41 +4567,65 @@ enum class AttributeMode {
     Yes,
 };
 
-static String escape_string(StringView string, AttributeMode attribute_mode)
+// https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+static void append_escaped_string(StringBuilder& builder, StringView string, AttributeMode attribute_mode)
 {
-    // https://html.spec.whatwg.org/multipage/parsing.html#escapingString
-    StringBuilder builder;
-    for (auto code_point : Utf8View { string }) {
+    // NOTE: Most strings contain few or no characters that need escaping, so we append everything between them in
+    //       one go. All characters that we look for are ASCII, apart from U+00A0, which is always encoded as C2 A0.
+    auto needs_escaping = [&](size_t index) {
+        switch (string[index]) {
+        case '&':
+            return true;
+        case '"':
+            return attribute_mode == AttributeMode::Yes;
+        case '<':
+        case '>':
+            return attribute_mode == AttributeMode::No;
+        case '\xC2':
+            return index + 1 < string.length() && static_cast<u8>(string[index + 1]) == 0xA0;
+        default:
+            return false;
+        }
+    };
+
+    size_t run_start = 0;
+    for (size_t i = 0; i < string.length(); ++i) {
+        if (!needs_escaping(i))
+            continue;
+        builder.append(string.substring_view(run_start, i - run_start));
+
+        switch (string[i]) {
         // 1. Replace any occurrence of the "&" character by the string "&amp;".
-        if (code_point == '&')
+        case '&':
             builder.append("&amp;"sv);
+            break;
         // 2. Replace any occurrences of the U+00A0 NO-BREAK SPACE character by the string "&nbsp;".
-        else if (code_point == 0xA0)
+        case '\xC2':
             builder.append("&nbsp;"sv);
+            ++i;
+            break;
         // 3. If the algorithm was invoked in the attribute mode, replace any occurrences of the """ character by the string "&quot;".
-        else if (code_point == '"' && attribute_mode == AttributeMode::Yes)
+        case '"':
             builder.append("&quot;"sv);
+            break;
         // 4. If the algorithm was not invoked in the attribute mode, replace any occurrences of the "<" character by the string "&lt;", and any occurrences of the ">" character by the string "&gt;".
-        else if (code_point == '<' && attribute_mode == AttributeMode::No)
+        case '<':
             builder.append("&lt;"sv);
-        else if (code_point == '>' && attribute_mode == AttributeMode::No)
+            break;
+        case '>':
             builder.append("&gt;"sv);
-        else
-            builder.append_code_point(code_point);
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+        run_start = i + 1;
     }
-    return builder.to_string_without_validation();
+    builder.append(string.substring_view(run_start));
 }
 
-// https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
-String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, Vector<JS::Handle<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
+// NOTE: Instead of building a string for every element we recurse into, all of the serialization is appended to s.
+static void serialize_html_fragment_into(StringBuilder& builder, DOM::Node const& node, HTMLParser::SerializableShadowRoots serializable_shadow_roots, Vector<JS::Handle<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
 {
-    // NOTE: Steps in this function are jumbled a bit to accommodate the Element.outerHTML API.
-    //       When called with FragmentSerializationMode::Outer, we will serialize the element itself,
-    //       not just its children.
-
-    // 2. Let s be a string, and initialize it to the empty string.
-    StringBuilder builder;
-
     auto serialize_element = [&](DOM::Element const& element) {
         // If current node is an element in the HTML namespace, the MathML namespace, or the SVG namespace, then let tagname be current node's local name.
         // Otherwise, let tagname be current node's qualified name.
@@ -4447,7 +4646,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // followed by a U+0022 QUOTATION MARK character (").
         if (element.is_value().has_value() && !element.has_attribute(AttributeNames::is)) {
             builder.append(" is=\""sv);
-            builder.append(escape_string(element.is_value().value(), AttributeMode::Yes));
+            append_escaped_string(builder, element.is_value().value(), AttributeMode::Yes);
             builder.append('"');
         }
 
@@ -4480,7 +4679,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             builder.append(attribute.name());
 
             builder.append("=\""sv);
-            builder.append(escape_string(attribute.value(), AttributeMode::Yes));
+            append_escaped_string(builder, attribute.value(), AttributeMode::Yes);
             builder.append('"');
         });
 
@@ -4497,7 +4696,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // a U+002F SOLIDUS character (/),
         // tagname again,
         // and finally a U+003E GREATER-THAN SIGN character (>).
-        builder.append(serialize_html_fragment(element, serializable_shadow_roots, shadow_roots));
+        serialize_html_fragment_into(builder, element, serializable_shadow_roots, shadow_roots, DOM::FragmentSerializationMode::Inner);
         builder.append("</"sv);
         builder.append(tag_name);
         builder.append('>');
@@ -4507,7 +4706,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
     if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer) {
         serialize_element(verify_cast<DOM::Element>(node));
-        return builder.to_string_without_validation();
+        return;
     }
 
     // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
@@ -4520,7 +4719,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // 1. If the node serializes as void, then return the empty string.
         //    (NOTE: serializes as void is defined only on elements in the spec)
         if (element.serializes_as_void())
-            return String {};
+            return;
 
         // 3. If the node is a template element, then let the node instead be the template element's template contents (a DocumentFragment node).
         //    (NOTE: This is out of order of the spec to avoid another dynamic cast. The second step just creates a string builder, so it shouldn't matter)
@@ -4535,7 +4734,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             // 2. If one of the following is true:
             //    - serializableShadowRoots is true and shadow's serializable is true; or
             //    - shadowRoots contains shadow,
-            if ((serializable_shadow_roots == SerializableShadowRoots::Yes && shadow->serializable())
+            if ((serializable_shadow_roots == HTMLParser::SerializableShadowRoots::Yes && shadow->serializable())
                 || shadow_roots.find_first_index_if([&](auto& entry) { return entry == shadow; }).has_value()) {
                 // then:
                 // 1. Append "<template shadowrootmode="".
@@ -4564,7 +4763,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
                 // 8. Append the value of running the HTML fragment serialization algorithm with shadow,
                 //    serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that element).
-                builder.append(serialize_html_fragment(*shadow, serializable_shadow_roots, shadow_roots));
+                serialize_html_fragment_into(builder, *shadow, serializable_shadow_roots, shadow_roots, DOM::FragmentSerializationMode::Inner);
 
                 // 9. Append "</template>".
                 builder.append("</template>"sv);
@@ -4603,7 +4802,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             }
 
             // Otherwise, append the value of current node's data IDL attribute, escaped as described below.
-            builder.append(escape_string(text_node.data(), AttributeMode::No));
+            append_escaped_string(builder, text_node.data(), AttributeMode::No);
         }
 
         if (is<DOM::Comment>(current_node)) {
@@ -4647,6 +4846,19 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
         return IterationDecision::Continue;
     });
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
+String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, Vector<JS::Handle<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
+{
+    // NOTE: Steps in this function are jumbled a bit to accommodate the Element.outerHTML API.
+    //       When called with FragmentSerializationMode::Outer, we will serialize the element itself,
+    //       not just its children.
+
+    // 2. Let s be a string, and initialize it to the empty string.
+    StringBuilder builder;
+
+    serialize_html_fragment_into(builder, node, serializable_shadow_roots, shadow_roots, fragment_serialization_mode);
 
     // 6. Return s.
     return MUST(builder.to_string());
@@ -55,6 +55,7 @@ public:
 
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
     void run(const URL::URL&, HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
+    void run_in_slices(URL::URL const&);
 
     static void the_end(JS::NonnullGCPtr<DOM::Document>, JS::GCPtr<HTMLParser> = nullptr);
 
@@ -161,6 +162,10 @@ private:
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
 
+    void start_the_speculative_html_parser();
+
+    void run_next_slice();
+
     void adjust_mathml_attributes(HTMLToken&);
     void adjust_svg_tag_names(HTMLToken&);
     void adjust_svg_attributes(HTMLToken&);
@@ -200,6 +205,10 @@ private:
     bool m_stop_parsing { false };
     size_t m_script_nesting_level { 0 };
 
+    // Length of the tokenizer input when the speculative parser last ran over it. Unless document.write()
+    // inserted something since then, there is nothing new for it to find.
+    Optional<size_t> m_speculatively_parsed_input_length;
+
     JS::Realm& realm();
 
     JS::GCPtr<DOM::Document> m_document;
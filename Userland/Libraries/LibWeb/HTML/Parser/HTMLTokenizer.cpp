@@ -8,6 +8,8 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -193,6 +195,42 @@ static inline void log_parse_error(SourceLocation const& location = SourceLocati
     dbgln_if(TOKENIZER_TRACE_DEBUG, "Parse error (tokenization) {}", location);
 }
 
+template<typename VectorMatcher, typename ScalarMatcher>
+static size_t count_leading_matching_bytes(ReadonlyBytes bytes, VectorMatcher vector_matcher, ScalarMatcher scalar_matcher)
+{
+    using AK::SIMD::u8x16;
+    using AK::SIMD::u64x2;
+
+    size_t count = 0;
+    while (count + sizeof(u8x16) <= bytes.size()) {
+        auto mask = bit_cast<u64x2>(vector_matcher(AK::SIMD::load_unaligned<u8x16>(bytes.offset(count))));
+        if ((mask[0] & mask[1]) != NumericLimits<u64>::max())
+            break;
+        count += sizeof(u8x16);
+    }
+    while (count < bytes.size() && scalar_matcher(bytes[count]))
+        ++count;
+    return count;
+}
+
+// NOTE: These only match ASCII code points that the respective states would emit or append as-is, and never U+000D CR,
+//       which has to go through newline normalization. Everything else is left to the code point by code point path.
+static size_t count_leading_ascii_data_code_points(ReadonlyBytes bytes)
+{
+    return count_leading_matching_bytes(
+        bytes,
+        [](AK::SIMD::u8x16 chunk) { return (chunk != '&') & (chunk != '<') & (chunk != 0) & (chunk != '\r') & (chunk < 0x80); },
+        [](u8 byte) { return byte != '&' && byte != '<' && byte != 0 && byte != '\r' && byte < 0x80; });
+}
+
+static size_t count_leading_ascii_attribute_value_code_points(ReadonlyBytes bytes, u8 quote)
+{
+    return count_leading_matching_bytes(
+        bytes,
+        [quote](AK::SIMD::u8x16 chunk) { return (chunk != quote) & (chunk != '&') & (chunk != 0) & (chunk != '\r') & (chunk < 0x80); },
+        [quote](u8 byte) { return byte != quote && byte != '&' && byte != 0 && byte != '\r' && byte < 0x80; });
+}
+
 Optional<u32> HTMLTokenizer::next_code_point()
 {
     if (m_utf8_iterator == m_utf8_view.end())
@@ -238,6 +276,66 @@ void HTMLTokenizer::skip(size_t count)
     }
 }
 
+ReadonlyBytes HTMLTokenizer::input_bytes_before_insertion_point() const
+{
+    auto offset = m_utf8_view.iterator_offset(m_utf8_iterator);
+    auto end = m_insertion_point.defined ? max(offset, m_insertion_point.position) : m_decoded_input.length();
+    return m_decoded_input.bytes().slice(offset, end - offset);
+}
+
+// Consumes the next length bytes of input in one go. They must all be ASCII and must not need newline normalization.
+StringView HTMLTokenizer::consume_ascii_run(size_t length)
+{
+    if (length == 0)
+        return {};
+
+    auto offset = m_utf8_view.iterator_offset(m_utf8_iterator);
+    auto run = m_decoded_input.substring_view(offset, length);
+
+    if (!m_source_positions.is_empty()) {
+        auto position = m_source_positions.last();
+        if (auto last_newline = run.find_last('\n'); last_newline.has_value()) {
+            position.line += run.count("\n"sv);
+            position.column = length - *last_newline - 1;
+        } else {
+            position.column += length;
+        }
+        position.byte_offset += length;
+        m_source_positions.append(position);
+    }
+
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + length - 1);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + length);
+    return run;
+}
+
+// Queues character tokens for the run of ordinary characters following the current one, without going through the
+// state machine for each of them.
+void HTMLTokenizer::queue_ascii_character_run()
+{
+    auto length = count_leading_ascii_data_code_points(input_bytes_before_insertion_point());
+    if (length == 0)
+        return;
+
+    // NOTE: Like create_new_token(), this gives each character token the position just after its code point.
+    bool tracks_positions = !m_source_positions.is_empty();
+    auto position = tracks_positions ? m_source_positions.last() : HTMLToken::Position {};
+    for (auto ch : consume_ascii_run(length)) {
+        if (tracks_positions) {
+            if (ch == '\n') {
+                position.column = 0;
+                position.line++;
+            } else {
+                position.column++;
+            }
+            position.byte_offset++;
+        }
+        auto token = HTMLToken::make_character(ch);
+        token.set_start_position({}, position);
+        m_queued_tokens.enqueue(move(token));
+    }
+}
+
 Optional<u32> HTMLTokenizer::peek_code_point(size_t offset) const
 {
     auto it = m_utf8_iterator;
@@ -275,6 +373,9 @@ _StartOfFunction:
         if (stop_at_insertion_point == StopAtInsertionPoint::Yes && is_insertion_point_reached())
             return {};
 
+        if (stop_at_insertion_point == StopAtInsertionPoint::No && m_pause_offset.has_value() && m_utf8_view.iterator_offset(m_utf8_iterator) >= *m_pause_offset)
+            return {};
+
         auto current_input_character = next_code_point();
         switch (m_state) {
             // 13.2.5.1 Data state, https://html.spec.whatwg.org/multipage/parsing.html#data-state
@@ -300,7 +401,11 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    create_new_token(HTMLToken::Type::Character);
+                    m_current_token.set_code_point(current_input_character.value());
+                    m_queued_tokens.enqueue(move(m_current_token));
+                    queue_ascii_character_run();
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -1272,6 +1377,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    m_current_builder.append(consume_ascii_run(count_leading_ascii_attribute_value_code_points(input_bytes_before_insertion_point(), '"')));
                     continue;
                 }
             }
@@ -1304,6 +1410,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    m_current_builder.append(consume_ascii_run(count_leading_ascii_attribute_value_code_points(input_bytes_before_insertion_point(), '\'')));
                     continue;
                 }
             }
@@ -1910,7 +2017,11 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    create_new_token(HTMLToken::Type::Character);
+                    m_current_token.set_code_point(current_input_character.value());
+                    m_queued_tokens.enqueue(move(m_current_token));
+                    queue_ascii_character_run();
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -2827,6 +2938,9 @@ void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
     m_utf8_iterator = m_utf8_view.iterator_at_byte_offset(utf8_iterator_byte_offset);
     m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset(prev_utf8_iterator_byte_offset);
 
+    if (m_pause_offset.has_value() && m_insertion_point.position <= *m_pause_offset)
+        *m_pause_offset += input.length();
+
     m_insertion_point.position += input.length();
 }
 
@@ -129,6 +129,8 @@ public:
     bool is_blocked() const { return m_blocked; }
 
     ByteString source() const { return m_decoded_input; }
+    StringView unconsumed_input() const { return m_decoded_input.substring_view(m_utf8_view.iterator_offset(m_utf8_iterator)); }
+    size_t input_length() const { return m_decoded_input.length(); }
 
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
@@ -151,10 +153,18 @@ public:
     // This permanently cuts off the tokenizer input stream.
     void abort() { m_aborted = true; }
 
+    // Tokenization pauses, without reaching the end of the input, once the input up to this byte offset has been consumed.
+    // This doesn't apply when tokenizing up to the insertion point, so document.write() isn't affected.
+    Optional<size_t> pause_offset() const { return m_pause_offset; }
+    void set_pause_offset(Optional<size_t> offset) { m_pause_offset = offset; }
+
 private:
     void skip(size_t count);
     Optional<u32> next_code_point();
     Optional<u32> peek_code_point(size_t offset) const;
+    ReadonlyBytes input_bytes_before_insertion_point() const;
+    StringView consume_ascii_run(size_t length);
+    void queue_ascii_character_run();
     bool consume_next_if_match(StringView, CaseSensitivity = CaseSensitivity::CaseSensitive);
     void create_new_token(HTMLToken::Type);
     bool current_end_tag_token_is_appropriate() const;
@@ -217,6 +227,8 @@ private:
 
     bool m_aborted { false };
 
+    Optional<size_t> m_pause_offset;
+
     Vector<HTMLToken::Position> m_source_positions;
 };
 
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/GenericShorthands.h>
+#include <AK/StringBuilder.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/Text.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/SimpleFragmentParser.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Namespace.h>
+
+namespace Web::HTML {
+
+// NOTE: Everything accepted here must produce exactly the same tree as the HTML fragment parsing algorithm would.
+//       We only allow a small set of elements that the "in body" insertion mode inserts without any special handling,
+//       and only when they are properly nested and closed, so that none of the error recovery steps come into play.
+enum class SimpleTagKind {
+    // Phrasing content, including formatting elements. Since they are always closed in order, the list of active
+    // formatting elements never needs to be reconstructed.
+    Phrasing,
+    // Elements whose start tag closes any open p element.
+    Block,
+    // h1 to h6, which additionally close a heading that is the current node.
+    Heading,
+    // li, which closes any open li that isn't inside of another list.
+    ListItem,
+    // Void elements.
+    Void,
+    // Void elements whose start tag closes any open p element.
+    VoidBlock,
+};
+
+static Optional<SimpleTagKind> simple_tag_kind(FlyString const& tag_name)
+{
+    if (tag_name.is_one_of(TagNames::a, TagNames::abbr, TagNames::b, TagNames::bdi, TagNames::cite, TagNames::code, TagNames::data, TagNames::dfn, TagNames::em, TagNames::i, TagNames::kbd, TagNames::mark, TagNames::q, TagNames::s, TagNames::samp, TagNames::small, TagNames::span, TagNames::strong, TagNames::sub, TagNames::sup, TagNames::time, TagNames::u, TagNames::var))
+        return SimpleTagKind::Phrasing;
+    if (tag_name.is_one_of(TagNames::address, TagNames::article, TagNames::aside, TagNames::blockquote, TagNames::div, TagNames::figcaption, TagNames::figure, TagNames::footer, TagNames::header, TagNames::main, TagNames::nav, TagNames::ol, TagNames::p, TagNames::section, TagNames::ul))
+        return SimpleTagKind::Block;
+    if (tag_name.is_one_of(TagNames::h1, TagNames::h2, TagNames::h3, TagNames::h4, TagNames::h5, TagNames::h6))
+        return SimpleTagKind::Heading;
+    if (tag_name == TagNames::li)
+        return SimpleTagKind::ListItem;
+    if (tag_name.is_one_of(TagNames::br, TagNames::img, TagNames::wbr))
+        return SimpleTagKind::Void;
+    if (tag_name == TagNames::hr)
+        return SimpleTagKind::VoidBlock;
+    return {};
+}
+
+static bool can_use_simple_fragment_parser_for_context(DOM::Element const& context_element)
+{
+    if (context_element.namespace_uri() != Namespace::HTML)
+        return false;
+
+    // These either start the tokenizer in a state other than the data state, or make "reset the insertion mode
+    // appropriately" pick an insertion mode other than "in body".
+    return !context_element.local_name().is_one_of(
+        TagNames::title, TagNames::textarea, TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes, TagNames::script, TagNames::noscript, TagNames::plaintext,
+        TagNames::template_, TagNames::select, TagNames::td, TagNames::th, TagNames::tr, TagNames::tbody, TagNames::thead, TagNames::tfoot, TagNames::caption, TagNames::colgroup, TagNames::table,
+        TagNames::head, TagNames::frameset, TagNames::html);
+}
+
+static constexpr bool is_tag_whitespace(char c)
+{
+    // NOTE: U+000D CARRIAGE RETURN is left out on purpose, since the input stream preprocessor would normalize it.
+    return c == '\t' || c == '\n' || c == '\f' || c == ' ';
+}
+
+class SimpleFragmentParser {
+public:
+    // NOTE: We first go through the markup without creating any nodes, so that bailing out halfway doesn't leave behind
+    //       any side effects of the elements we created (like image fetches) for the real parser to duplicate.
+    enum class Mode {
+        Validate,
+        Build,
+    };
+
+    SimpleFragmentParser(DOM::Document& document, StringView markup, Mode mode)
+        : m_document(document)
+        , m_lexer(markup)
+        , m_mode(mode)
+    {
+    }
+
+    Optional<Vector<JS::Handle<DOM::Node>>> parse()
+    {
+        while (!m_lexer.is_eof()) {
+            bool ok;
+            if (m_lexer.next_is("</"))
+                ok = parse_end_tag();
+            else if (m_lexer.next_is('<'))
+                ok = parse_start_tag();
+            else
+                ok = parse_text();
+            if (!ok)
+                return {};
+        }
+
+        // NOTE: Elements left open at the end of the input would be fine in most cases, but we don't bother.
+        if (!m_stack_of_open_elements.is_empty())
+            return {};
+
+        return move(m_nodes);
+    }
+
+private:
+    Optional<FlyString const&> current_tag_name() const
+    {
+        if (m_stack_of_open_elements.is_empty())
+            return {};
+        return m_stack_of_open_elements.last();
+    }
+
+    bool current_tag_name_is_one_of(auto const&... tag_names) const
+    {
+        auto tag_name = current_tag_name();
+        return tag_name.has_value() && tag_name->is_one_of(tag_names...);
+    }
+
+    bool has_open_element(FlyString const& tag_name) const
+    {
+        return m_stack_of_open_elements.contains_slow(tag_name);
+    }
+
+    void insert_node(DOM::Node& node)
+    {
+        if (!m_open_elements.is_empty())
+            MUST(m_open_elements.last()->append_child(node));
+        else
+            m_nodes.append(JS::make_handle(node));
+    }
+
+    StringView consume_name()
+    {
+        if (!m_lexer.next_is(is_ascii_lower_alpha))
+            return {};
+        return m_lexer.consume_while([](char c) { return is_ascii_lower_alpha(c) || is_ascii_digit(c); });
+    }
+
+    // Only the most common named character references are decoded, and only when terminated by a semicolon, which
+    // sidesteps all of the legacy handling for references without one.
+    bool consume_character_reference(StringBuilder& builder)
+    {
+        static constexpr struct {
+            StringView name;
+            StringView replacement;
+        } character_references[] = {
+            { "&amp;"sv, "&"sv },
+            { "&lt;"sv, "<"sv },
+            { "&gt;"sv, ">"sv },
+            { "&quot;"sv, "\""sv },
+            { "&apos;"sv, "'"sv },
+            { "&nbsp;"sv, "\xC2\xA0"sv },
+        };
+
+        for (auto const& reference : character_references) {
+            if (m_lexer.consume_specific(reference.name)) {
+                builder.append(reference.replacement);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool consume_text_until(StringBuilder& builder, char terminator)
+    {
+        while (!m_lexer.is_eof() && !m_lexer.next_is(terminator)) {
+            builder.append(m_lexer.consume_until([&](char c) { return c == terminator || c == '&' || c == '\r' || c == '\0'; }));
+            if (m_lexer.next_is('&')) {
+                if (!consume_character_reference(builder))
+                    return false;
+            } else if (m_lexer.next_is('\r') || m_lexer.next_is('\0')) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool parse_text()
+    {
+        StringBuilder builder;
+        if (!consume_text_until(builder, '<'))
+            return false;
+        if (m_mode == Mode::Validate)
+            return true;
+
+        auto text = m_document->heap().allocate<DOM::Text>(m_document->realm(), m_document, MUST(builder.to_string()));
+        insert_node(text);
+        return true;
+    }
+
+    bool parse_start_tag()
+    {
+        m_lexer.ignore();
+        auto tag_name_view = consume_name();
+        if (tag_name_view.is_empty())
+            return false;
+        auto tag_name = MUST(FlyString::from_utf8(tag_name_view));
+
+        auto kind = simple_tag_kind(tag_name);
+        if (!kind.has_value())
+            return false;
+
+        // An a start tag would run the adoption agency algorithm for any a element that is still open.
+        if (tag_name == TagNames::a && has_open_element(TagNames::a))
+            return false;
+
+        // These close any open p element, which would then no longer be the parent of what follows it.
+        // NOTE: None of the elements we allow are scope boundaries, so any p on our stack is in button scope.
+        if (first_is_one_of(*kind, SimpleTagKind::Block, SimpleTagKind::Heading, SimpleTagKind::ListItem, SimpleTagKind::VoidBlock) && has_open_element(TagNames::p))
+            return false;
+
+        if (*kind == SimpleTagKind::Heading && current_tag_name_is_one_of(TagNames::h1, TagNames::h2, TagNames::h3, TagNames::h4, TagNames::h5, TagNames::h6))
+            return false;
+
+        // An li start tag closes the nearest open li, unless it finds a list (or anything else that is special, other
+        // than address, div and p) first.
+        if (*kind == SimpleTagKind::ListItem && current_tag_name().has_value() && !current_tag_name_is_one_of(TagNames::ul, TagNames::ol))
+            return false;
+
+        JS::GCPtr<DOM::Element> element;
+        if (m_mode == Mode::Build)
+            element = DOM::create_element(m_document, tag_name, Namespace::HTML).release_value_but_fixme_should_propagate_errors();
+
+        bool is_void = first_is_one_of(*kind, SimpleTagKind::Void, SimpleTagKind::VoidBlock);
+        Vector<FlyString, 4> attribute_names;
+        for (;;) {
+            auto whitespace = m_lexer.consume_while(is_tag_whitespace);
+            if (m_lexer.consume_specific('>'))
+                break;
+            if (m_lexer.consume_specific("/>"sv)) {
+                // The self-closing flag is ignored on anything other than void elements.
+                if (!is_void)
+                    return false;
+                break;
+            }
+            if (whitespace.is_empty())
+                return false;
+
+            auto attribute_name_view = m_lexer.consume_while([](char c) { return is_ascii_lower_alpha(c) || is_ascii_digit(c) || c == '-' || c == '_'; });
+            if (attribute_name_view.is_empty() || !is_ascii_lower_alpha(attribute_name_view[0]))
+                return false;
+            auto attribute_name = MUST(FlyString::from_utf8(attribute_name_view));
+
+            // An is attribute would make us look up a customized built-in element, and the tokenizer drops duplicates.
+            if (attribute_name == AttributeNames::is || attribute_names.contains_slow(attribute_name))
+                return false;
+            attribute_names.append(attribute_name);
+
+            String value;
+            if (m_lexer.consume_specific('=')) {
+                auto quote = m_lexer.peek();
+                if (quote != '"' && quote != '\'')
+                    return false;
+                m_lexer.ignore();
+
+                StringBuilder builder;
+                if (!consume_text_until(builder, quote) || !m_lexer.consume_specific(quote))
+                    return false;
+                value = MUST(builder.to_string());
+            }
+
+            if (element)
+                element->append_attribute(attribute_name, value);
+        }
+
+        if (element) {
+            insert_node(*element);
+            if (!is_void)
+                m_open_elements.append(*element);
+        }
+        if (!is_void)
+            m_stack_of_open_elements.append(move(tag_name));
+        return true;
+    }
+
+    bool parse_end_tag()
+    {
+        m_lexer.ignore(2);
+        auto tag_name = consume_name();
+        if (tag_name.is_empty() || !m_lexer.consume_specific('>'))
+            return false;
+
+        // Anything other than closing the current node would need the parser's error recovery.
+        if (!current_tag_name().has_value() || *current_tag_name() != tag_name)
+            return false;
+
+        m_stack_of_open_elements.take_last();
+        if (m_mode == Mode::Build)
+            m_open_elements.take_last();
+        return true;
+    }
+
+    JS::NonnullGCPtr<DOM::Document> m_document;
+    GenericLexer m_lexer;
+    Mode m_mode { Mode::Validate };
+
+    // The tag names of the open elements, which is all that the checks above need to look at.
+    Vector<FlyString> m_stack_of_open_elements;
+
+    // NOTE: Open elements are always reachable from one of the top-level nodes, which are kept alive by their handles.
+    Vector<JS::Handle<DOM::Node>> m_nodes;
+    Vector<JS::NonnullGCPtr<DOM::Element>> m_open_elements;
+};
+
+Optional<Vector<JS::Handle<DOM::Node>>> try_parse_simple_html_fragment(DOM::Element& context_element, StringView markup)
+{
+    if (!can_use_simple_fragment_parser_for_context(context_element))
+        return {};
+
+    if (!SimpleFragmentParser(context_element.document(), markup, SimpleFragmentParser::Mode::Validate).parse().has_value())
+        return {};
+    return SimpleFragmentParser(context_element.document(), markup, SimpleFragmentParser::Mode::Build).parse();
+}
+
+}
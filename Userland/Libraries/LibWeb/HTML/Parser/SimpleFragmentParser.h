@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Handle.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// Builds the nodes for a fragment of simple, well-formed markup directly, without setting up an HTMLParser and its
+// temporary document. If the markup uses anything that the tree construction stage could treat specially, this returns
+// an empty Optional, and the caller has to fall back to the HTML fragment parsing algorithm.
+Optional<Vector<JS::Handle<DOM::Node>>> try_parse_simple_html_fragment(DOM::Element& context_element, StringView markup);
+
+}
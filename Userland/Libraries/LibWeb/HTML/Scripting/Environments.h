@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/WeakPtr.h>
 #include <LibJS/Forward.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
@@ -39,7 +40,8 @@ public:
     // https://html.spec.whatwg.org/multipage/webappapis.html#concept-environment-target-browsing-context
     JS::GCPtr<BrowsingContext> target_browsing_context;
 
-    // FIXME: An active service worker https://html.spec.whatwg.org/multipage/webappapis.html#concept-environment-active-service-worker
+    // https://html.spec.whatwg.org/multipage/webappapis.html#concept-environment-active-service-worker
+    WeakPtr<Web::ServiceWorker::ServiceWorkerRecord> active_service_worker;
 
     // https://html.spec.whatwg.org/multipage/webappapis.html#concept-environment-execution-ready-flag
     bool execution_ready { false };
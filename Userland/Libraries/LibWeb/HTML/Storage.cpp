@@ -9,6 +9,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/StoragePrototype.h>
 #include <LibWeb/HTML/Storage.h>
+#include <LibWeb/Page/Page.h>
 
 namespace Web::HTML {
 
@@ -19,6 +20,15 @@ JS::NonnullGCPtr<Storage> Storage::create(JS::Realm& realm)
     return realm.heap().allocate<Storage>(realm, realm);
 }
 
+JS::NonnullGCPtr<Storage> Storage::create_persistent(JS::Realm& realm, Page& page, String origin)
+{
+    auto storage = create(realm);
+    storage->m_map = page.client().page_did_request_local_storage_items(origin);
+    storage->m_page = page;
+    storage->m_persistent_origin = move(origin);
+    return storage;
+}
+
 Storage::Storage(JS::Realm& realm)
     : Bindings::PlatformObject(realm)
 {
@@ -40,6 +50,12 @@ void Storage::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(Storage);
 }
 
+void Storage::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_page);
+}
+
 // https://html.spec.whatwg.org/multipage/webstorage.html#dom-storage-length
 size_t Storage::length() const
 {
@@ -99,6 +115,8 @@ WebIDL::ExceptionOr<void> Storage::set_item(String const& key, String const& val
 
     // 5. Set this's map[key] to value.
     m_map.set(key, value);
+    if (m_persistent_origin.has_value())
+        m_page->client().page_did_set_local_storage_item(*m_persistent_origin, key, value);
 
     // 6. If reorder is true, then reorder this.
     if (reorder)
@@ -124,6 +142,8 @@ void Storage::remove_item(StringView key)
 
     // 3. Remove this's map[key].
     m_map.remove(it);
+    if (m_persistent_origin.has_value())
+        m_page->client().page_did_remove_local_storage_item(*m_persistent_origin, MUST(String::from_utf8(key)));
 
     // 4. Reorder this.
     reorder();
@@ -137,6 +157,8 @@ void Storage::clear()
 {
     // 1. Clear this's map.
     m_map.clear();
+    if (m_persistent_origin.has_value())
+        m_page->client().page_did_clear_local_storage(*m_persistent_origin);
 
     // 2. Broadcast this with null, null, and null.
     broadcast({}, {}, {});
@@ -19,6 +19,7 @@ class Storage : public Bindings::PlatformObject {
 
 public:
     [[nodiscard]] static JS::NonnullGCPtr<Storage> create(JS::Realm&);
+    [[nodiscard]] static JS::NonnullGCPtr<Storage> create_persistent(JS::Realm&, Page&, String origin);
     ~Storage();
 
     size_t length() const;
@@ -36,6 +37,7 @@ private:
     explicit Storage(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
 
     // ^PlatformObject
     virtual JS::Value named_item_value(FlyString const&) const override;
@@ -47,6 +49,11 @@ private:
     void broadcast(StringView key, StringView old_value, StringView new_value);
 
     OrderedHashMap<String, String> m_map;
+
+    // NOTE: Persistent storage mirrors every modification to the page client, which batches them up and writes them
+    //       to disk outside of this process.
+    JS::GCPtr<Page> m_page;
+    Optional<String> m_persistent_origin;
 };
 
 }
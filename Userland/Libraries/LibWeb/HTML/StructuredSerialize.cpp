@@ -26,6 +26,7 @@
 #include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/Runtime/RegExpObject.h>
 #include <LibJS/Runtime/Set.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/StringObject.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/VM.h>
@@ -143,6 +144,66 @@ static ErrorType error_name_to_type(String const& name)
     return Error;
 }
 
+// Property keys of Array and Object properties are tagged, so that array indices don't have to round-trip through their
+// string representation.
+enum class PropertyKeyTag : u8 {
+    Index,
+    String,
+};
+
+// OPTIMIZATION: Plain objects and arrays can list their keys directly from their indexed storage and shape, without
+//               creating a string value for every key.
+static Vector<JS::PropertyKey> enumerable_own_property_keys(JS::VM& vm, JS::Object& object)
+{
+    if (typeid(object) == typeid(JS::Object) || typeid(object) == typeid(JS::Array)) {
+        Vector<JS::PropertyKey> keys;
+        keys.ensure_capacity(object.indexed_properties().real_size() + object.shape().property_count());
+        for (auto& entry : object.indexed_properties()) {
+            if (object.indexed_properties().get(entry.index())->attributes.is_enumerable())
+                keys.unchecked_append(entry.index());
+        }
+        for (auto& [key, metadata] : object.shape().property_table()) {
+            if (key.is_string() && metadata.attributes.is_enumerable())
+                keys.unchecked_append(key);
+        }
+        return keys;
+    }
+
+    auto property_names = MUST(object.enumerable_own_property_names(JS::Object::PropertyKind::Key));
+    Vector<JS::PropertyKey> keys;
+    keys.ensure_capacity(property_names.size());
+    for (auto& property_name : property_names)
+        keys.unchecked_append(MUST(JS::PropertyKey::from_value(vm, property_name)));
+    return keys;
+}
+
+// OPTIMIZATION: Own data properties of plain objects and arrays are read straight out of their storage. Everything else,
+//               including accessors, goes through [[Get]].
+static JS::ThrowCompletionOr<Optional<JS::Value>> get_own_property_if_present(JS::Object& object, JS::PropertyKey const& key)
+{
+    if (typeid(object) == typeid(JS::Object) || typeid(object) == typeid(JS::Array)) {
+        Optional<JS::Value> value;
+        if (key.is_number()) {
+            if (auto value_and_attributes = object.indexed_properties().get(key.as_number()); value_and_attributes.has_value())
+                value = value_and_attributes->value;
+        } else if (auto metadata = object.shape().lookup(key.to_string_or_symbol()); metadata.has_value()) {
+            value = object.get_direct(metadata->offset);
+        }
+
+        if (!value.has_value())
+            return OptionalNone {};
+        if (!value->is_accessor())
+            return value;
+    }
+
+    // 1. If ! HasOwnProperty(value, key) is true, then:
+    if (!MUST(object.has_own_property(key)))
+        return OptionalNone {};
+
+    // 1. Let inputValue be ? value.[[Get]](key, value).
+    return TRY(object.internal_get(key, &object));
+}
+
 // Serializing and deserializing are each two passes:
 // 1. Fill up the memory with all the values, but without translating references
 // 2. Translate all the references into the appropriate form
@@ -158,11 +219,23 @@ public:
 
     // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
     WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
+    {
+        TRY(serialize_value(value));
+        return move(m_serialized);
+    }
+
+private:
+    // NOTE: Nested values are appended to the same record as they are visited, rather than being serialized into records
+    //       of their own which then have to be copied into their parent's.
+    WebIDL::ExceptionOr<void> serialize_value(JS::Value value)
     {
         // 2. If memory[value] exists, then return memory[value].
-        if (m_memory.contains(value)) {
-            auto index = m_memory.get(value).value();
-            return Vector<u32> { ValueTag::ObjectReference, index };
+        if (value.is_object()) {
+            if (auto index = m_memory.get(value); index.has_value()) {
+                serialize_enum(m_serialized, ValueTag::ObjectReference);
+                m_serialized.append(*index);
+                return {};
+            }
         }
 
         // 3. Let deep be false.
@@ -191,7 +264,7 @@ public:
         }
 
         if (return_primitive_type)
-            return m_serialized;
+            return {};
 
         // 5. If Type(value) is Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -348,7 +421,10 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_handle(value), m_next_id++);
+        // NOTE: Values are identified by the order in which they were added to the memory, which is also the order in
+        //       which the deserializer will recreate them.
+        auto index = m_memory.size();
+        m_memory.set(make_handle(value), index);
 
         // 26. If deep is true, then:
         if (deep) {
@@ -371,10 +447,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize_value(copied_value));
                 }
             }
 
@@ -393,10 +467,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize_value(copied_value));
                 }
             }
 
@@ -408,39 +480,47 @@ public:
 
             // 4. Otherwise, for each key in ! EnumerableOwnProperties(value, key):
             else {
+                auto& object = value.as_object();
+
                 u64 property_count = 0;
                 auto count_offset = m_serialized.size();
                 serialize_primitive_type(m_serialized, property_count);
-                for (auto key : MUST(value.as_object().enumerable_own_property_names(JS::Object::PropertyKind::Key))) {
-                    auto property_key = MUST(JS::PropertyKey::from_value(m_vm, key));
-
+                for (auto const& key : enumerable_own_property_keys(m_vm, object)) {
                     // 1. If ! HasOwnProperty(value, key) is true, then:
-                    if (MUST(value.as_object().has_own_property(property_key))) {
-                        // 1. Let inputValue be ? value.[[Get]](key, value).
-                        auto input_value = TRY(value.as_object().internal_get(property_key, value));
-
-                        // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
+                    //    1. Let inputValue be ? value.[[Get]](key, value).
+                    auto input_value = TRY(get_own_property_if_present(object, key));
+                    if (!input_value.has_value())
+                        continue;
 
-                        // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
-                        TRY(serialize_string(m_vm, m_serialized, key.as_string()));
-                        m_serialized.extend(output_value);
+                    // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
+                    // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
+                    TRY(serialize_property_key(key));
+                    TRY(serialize_value(*input_value));
 
-                        property_count++;
-                    }
+                    property_count++;
                 }
                 memcpy(m_serialized.data() + count_offset, &property_count, sizeof(property_count));
             }
         }
 
         // 27. Return serialized.
-        return m_serialized;
+        return {};
+    }
+
+    WebIDL::ExceptionOr<void> serialize_property_key(JS::PropertyKey const& key)
+    {
+        if (key.is_number()) {
+            serialize_enum(m_serialized, PropertyKeyTag::Index);
+            serialize_primitive_type(m_serialized, key.as_number());
+            return {};
+        }
+
+        serialize_enum(m_serialized, PropertyKeyTag::String);
+        return serialize_string(m_vm, m_serialized, key.as_string());
     }
 
-private:
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
     SerializationRecord m_serialized;
     bool m_for_storage { false };
 };
@@ -526,19 +606,11 @@ WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, Reado
     // Append size of the buffer to the serialized structure.
     u64 const size = bytes.size();
     serialize_primitive_type(vector, size);
-    // Append the bytes of the buffer to the serialized structure.
-    u64 byte_position = 0;
-    while (byte_position < size) {
-        u32 combined_value = 0;
-        for (u8 i = 0; i < 4; ++i) {
-            u8 const byte = bytes[byte_position];
-            combined_value |= byte << (i * 8);
-            byte_position++;
-            if (byte_position == size)
-                break;
-        }
-        TRY_OR_THROW_OOM(vm, vector.try_append(combined_value));
-    }
+    // Append the bytes of the buffer to the serialized structure, packed into u32s. The padding of the last u32 is zeroed.
+    auto const offset = vector.size();
+    TRY_OR_THROW_OOM(vm, vector.try_resize(offset + ceil_div(size, sizeof(u32))));
+    if (size > 0)
+        memcpy(vector.data() + offset, bytes.data(), size);
     return {};
 }
 
@@ -592,10 +664,9 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
 
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
         //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // OPTIMIZATION: The bytes are copied straight into the serialized record below, which serves as our dataCopy.
+        auto data = array_buffer.buffer().bytes().trim(size);
 
         // FIXME: 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
@@ -604,7 +675,7 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             serialize_enum(vector, ValueTag::ArrayBuffer);
-            TRY(serialize_bytes(vm, vector, data_copy.buffer().bytes()));
+            TRY(serialize_bytes(vm, vector, data));
         }
     }
     return {};
@@ -635,18 +706,26 @@ WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>&
     // 2. Let buffer be the value of value's [[ViewedArrayBuffer]] internal slot.
     auto* buffer = view.viewed_array_buffer();
 
+    serialize_enum(vector, ValueTag::ArrayBufferView);
+
     // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
-    auto buffer_serialized = TRY(structured_serialize_internal(vm, JS::Value(buffer), for_storage, memory));
+    // OPTIMIZATION: The buffer is serialized in place, rather than into a separate record that would have to be copied
+    //               into this one. This mirrors what StructuredSerializeInternal does for an ArrayBuffer.
+    if (auto index = memory.get(JS::Value { buffer }); index.has_value()) {
+        serialize_enum(vector, ValueTag::ObjectReference);
+        vector.append(*index);
+    } else {
+        // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
+        // NOTE: We currently only implement this for ArrayBuffer
+        TRY(serialize_array_buffer(vm, vector, *buffer, for_storage));
 
-    // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
-    // NOTE: We currently only implement this for ArrayBuffer
-    VERIFY(buffer_serialized[0] == ValueTag::ArrayBuffer);
+        auto buffer_index = memory.size();
+        memory.set(JS::make_handle(JS::Value { buffer }), buffer_index);
+    }
 
     // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
     //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
     if constexpr (IsSame<ViewType, JS::DataView>) {
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));               // [[ArrayBufferSerialized]]
         TRY(serialize_string(vm, vector, "DataView"_string)); // [[Constructor]]
         serialize_primitive_type(vector, JS::get_view_byte_length(view_record));
         serialize_primitive_type(vector, view.byte_offset());
@@ -659,8 +738,6 @@ WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>&
         // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
         //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
         //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));                 // [[ArrayBufferSerialized]]
         TRY(serialize_string(vm, vector, view.element_name())); // [[Constructor]]
         serialize_primitive_type(vector, JS::typed_array_byte_length(view_record));
         serialize_primitive_type(vector, view.byte_offset());
@@ -692,9 +769,6 @@ public:
         // 2. If memory[serialized] exists, then return memory[serialized].
         if (tag == ValueTag::ObjectReference) {
             auto index = m_serialized[m_position++];
-            if (index == NumericLimits<u32>::max()) {
-                return JS::Object::create(*m_vm.current_realm(), nullptr);
-            }
             return m_memory[index];
         }
 
@@ -945,13 +1019,13 @@ public:
                 auto length = deserialize_primitive_type<u64>(m_serialized, m_position);
                 // 1. For each Record { [[Key]], [[Value]] } entry of serialized.[[Properties]]:
                 for (u64 i = 0u; i < length; ++i) {
-                    auto key = TRY(deserialize_string(m_vm, m_serialized, m_position));
+                    auto key = TRY(deserialize_property_key());
 
                     // 1. Let deserializedValue be ? StructuredDeserialize(entry.[[Value]], targetRealm, memory).
                     auto deserialized_value = TRY(deserialize());
 
                     // 2. Let result be ! CreateDataProperty(value, entry.[[Key]], deserializedValue).
-                    auto result = MUST(object.create_data_property(key.to_byte_string(), deserialized_value));
+                    auto result = MUST(object.create_data_property(key, deserialized_value));
 
                     // 3. Assert: result is true.
                     VERIFY(result);
@@ -971,9 +1045,19 @@ public:
     }
 
 private:
+    WebIDL::ExceptionOr<JS::PropertyKey> deserialize_property_key()
+    {
+        auto tag = deserialize_primitive_type<PropertyKeyTag>(m_serialized, m_position);
+        if (tag == PropertyKeyTag::Index)
+            return JS::PropertyKey { deserialize_primitive_type<u32>(m_serialized, m_position) };
+
+        auto key = TRY(deserialize_string(m_vm, m_serialized, m_position));
+        return JS::PropertyKey { key.to_byte_string() };
+    }
+
     JS::VM& m_vm;
     ReadonlySpan<u32> m_serialized;
-    JS::MarkedVector<JS::Value> m_memory; // Index -> JS value
+    DeserializationMemory& m_memory; // Index -> JS value
     size_t m_position { 0 };
 
     static WebIDL::ExceptionOr<JS::NonnullGCPtr<Bindings::PlatformObject>> create_serialized_type(StringView interface_name, JS::Realm& realm)
@@ -1060,32 +1144,32 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::RegExpObject>> deserialize_reg_exp_obje
     return TRY(JS::regexp_create(realm.vm(), move(pattern), move(flags)));
 }
 
-WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+static ReadonlyBytes deserialize_bytes_in_place(ReadonlySpan<u32> vector, size_t& position)
 {
     u64 const size = deserialize_primitive_type<u64>(vector, position);
+    auto const word_count = ceil_div(size, sizeof(u32));
+    VERIFY(position + word_count <= vector.size());
 
-    auto bytes = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
-    u64 byte_position = 0;
-    while (position < vector.size() && byte_position < size) {
-        for (u8 i = 0; i < 4; ++i) {
-            bytes[byte_position++] = (vector[position] >> (i * 8) & 0xFF);
-            if (byte_position == size)
-                break;
-        }
-        position++;
-    }
+    ReadonlyBytes bytes { vector.offset_pointer(position), size };
+    position += word_count;
     return bytes;
 }
 
+WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+{
+    auto bytes = deserialize_bytes_in_place(vector, position);
+    return TRY_OR_THROW_OOM(vm, ByteBuffer::copy(bytes));
+}
+
 WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
 {
-    auto bytes = TRY(deserialize_bytes(vm, vector, position));
+    auto bytes = deserialize_bytes_in_place(vector, position);
     return TRY_OR_THROW_OOM(vm, String::from_utf8(StringView { bytes }));
 }
 
 WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
 {
-    auto bytes = TRY(deserialize_bytes(vm, vector, position));
+    auto bytes = deserialize_bytes_in_place(vector, position);
 
     return TRY(Bindings::throw_dom_exception_if_needed(vm, [&vm, &bytes]() {
         return JS::PrimitiveString::create(vm, StringView { bytes });
@@ -1112,12 +1196,14 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
     for (auto const& transferable : transfer_list) {
 
         // 1. If transferable has neither an [[ArrayBufferData]] internal slot nor a [[Detached]] internal slot, then throw a "DataCloneError" DOMException.
-        // FIXME: Handle transferring ArrayBufferData objects
-        if (!is<Bindings::Transferable>(*transferable)) {
+        if (!is<JS::ArrayBuffer>(*transferable) && !is<Bindings::Transferable>(*transferable)) {
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer type"_fly_string);
         }
 
-        // FIXME: 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer&>(*transferable).is_shared_array_buffer()) {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer shared array buffer"_fly_string);
+        }
 
         // 3. If memory[transferable] exists, then throw a "DataCloneError" DOMException.
         auto transferable_value = JS::Value(transferable);
@@ -1126,7 +1212,10 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         }
 
         // 4. Set memory[transferable] to { [[Type]]: an uninitialized value }.
-        memory.set(JS::make_handle(transferable_value), NumericLimits<u32>::max());
+        // NOTE: The transferred values are the first values added to the deserialization memory, in transfer list order,
+        //       so references to them can be serialized as an index like any other object reference.
+        auto index = memory.size();
+        memory.set(JS::make_handle(transferable_value), index);
     }
 
     // 3. Let serialized be ? StructuredSerializeInternal(value, false, memory).
@@ -1138,7 +1227,10 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
     // 5. For each transferable of transferList:
     for (auto& transferable : transfer_list) {
-        // 1. FIXME: If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 1. If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer&>(*transferable).is_detached()) {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer detached buffer"_fly_string);
+        }
 
         // 2. If transferable has a [[Detached]] internal slot and transferable.[[Detached]] is true, then throw a "DataCloneError" DOMException.
         if (is<Bindings::Transferable>(*transferable)) {
@@ -1152,8 +1244,34 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         // IMPLEMENTATION DEFINED: We just create a data holder here, our memory holds indices into the SerializationRecord
         TransferDataHolder data_holder;
 
-        // FIXME 4. If transferable has an [[ArrayBufferData]] internal slot, then:
-        if (false) {
+        // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
+        if (is<JS::ArrayBuffer>(*transferable)) {
+            auto& array_buffer = static_cast<JS::ArrayBuffer&>(*transferable);
+
+            // 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then:
+            //     1. Set dataHolder.[[Type]] to "ResizableArrayBuffer".
+            //     2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+            //     3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+            //     4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
+            // FIXME: Resizable array buffers are not supported yet.
+
+            // 2. Otherwise:
+            //     1. Set dataHolder.[[Type]] to "ArrayBuffer".
+            data_holder.data.append(to_underlying(TransferType::ArrayBuffer));
+
+            //     2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+            //     3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+            // NOTE: The data block is moved into the data holder rather than copied. If DetachArrayBuffer below throws,
+            //       the buffer had a detach key, so we leave its data where it is.
+            ByteBuffer array_buffer_data;
+            if (array_buffer.detach_key().is_undefined())
+                array_buffer_data = move(array_buffer.buffer());
+
+            // 3. Perform ? DetachArrayBuffer(transferable).
+            // NOTE: Specifications can use the [[ArrayBufferDetachKey]] internal slot to prevent ArrayBuffers from being detached. This is used in WebAssembly JavaScript Interface, for example. See: https://webassembly.github.io/spec/js-api/#webassembly-namespace
+            TRY(JS::detach_array_buffer(vm, array_buffer));
+
+            data_holder.array_buffer_data = move(array_buffer_data);
         }
 
         // 5. Otherwise:
@@ -1190,6 +1308,9 @@ static bool is_interface_exposed_on_target_realm(u8 name, JS::Realm& realm)
     case TransferType::MessagePort:
         return intrinsics.is_exposed("MessagePort"sv);
         break;
+    case TransferType::ArrayBuffer:
+        // NOTE: ArrayBuffers are handled separately by StructuredDeserializeWithTransfer.
+        break;
     default:
         dbgln("Unknown interface type for transfer: {}", name);
         break;
@@ -1205,6 +1326,8 @@ static WebIDL::ExceptionOr<JS::NonnullGCPtr<Bindings::PlatformObject>> create_tr
         TRY(message_port->transfer_receiving_steps(transfer_data_holder));
         return message_port;
     }
+    case TransferType::ArrayBuffer:
+        break;
     }
     VERIFY_NOT_REACHED();
 }
@@ -1225,14 +1348,16 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         // 1. Let value be an uninitialized value.
         JS::Value value;
 
-        // FIXME: 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
+        // 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
         //    whose [[ArrayBufferData]] internal slot value is transferDataHolder.[[ArrayBufferData]], and
         //    whose [[ArrayBufferByteLength]] internal slot value is transferDataHolder.[[ArrayBufferByteLength]].
         // NOTE: In cases where the original memory occupied by [[ArrayBufferData]] is accessible during the deserialization,
         //       this step is unlikely to throw an exception, as no new memory needs to be allocated: the memory occupied by
         //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
         //       when both the source and target realms are in the same process.
-        if (false) {
+        if (transfer_data_holder.data.first() == to_underlying(TransferType::ArrayBuffer)) {
+            transfer_data_holder.data.take_first();
+            value = JS::ArrayBuffer::create(target_realm, move(transfer_data_holder.array_buffer_data));
         }
 
         // FIXME: 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -1334,6 +1459,7 @@ ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& da
 {
     TRY(encoder.encode(data_holder.data));
     TRY(encoder.encode(data_holder.fds));
+    TRY(encoder.encode(data_holder.array_buffer_data));
     return {};
 }
 
@@ -1350,7 +1476,8 @@ ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 {
     auto data = TRY(decoder.decode<Vector<u8>>());
     auto fds = TRY(decoder.decode<Vector<IPC::File>>());
-    return ::Web::HTML::TransferDataHolder { move(data), move(fds) };
+    auto array_buffer_data = TRY(decoder.decode<ByteBuffer>());
+    return ::Web::HTML::TransferDataHolder { move(data), move(fds), move(array_buffer_data) };
 }
 
 template<>
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Result.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
@@ -29,6 +30,7 @@ using DeserializationMemory = JS::MarkedVector<JS::Value>;
 struct TransferDataHolder {
     Vector<u8> data;
     Vector<IPC::File> fds;
+    ByteBuffer array_buffer_data;
 };
 
 struct SerializedTransferRecord {
@@ -48,6 +50,7 @@ struct DeserializedRecord {
 
 enum class TransferType : u8 {
     MessagePort,
+    ArrayBuffer,
 };
 
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM& vm, JS::Value);
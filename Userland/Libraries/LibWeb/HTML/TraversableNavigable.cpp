@@ -356,11 +356,15 @@ Vector<JS::Handle<Navigable>> TraversableNavigable::get_all_navigables_that_migh
 }
 
 // https://html.spec.whatwg.org/multipage/browsing-the-web.html#deactivate-a-document-for-a-cross-document-navigation
-static void deactivate_a_document_for_cross_document_navigation(JS::NonnullGCPtr<DOM::Document> displayed_document, Optional<UserNavigationInvolvement>, JS::NonnullGCPtr<SessionHistoryEntry> target_entry, JS::NonnullGCPtr<JS::HeapFunction<void()>> after_potential_unloads)
+static void deactivate_a_document_for_cross_document_navigation(JS::NonnullGCPtr<DOM::Document> displayed_document, Optional<UserNavigationInvolvement>, JS::NonnullGCPtr<SessionHistoryEntry> target_entry, Bindings::NavigationType navigation_type, JS::NonnullGCPtr<JS::HeapFunction<void()>> after_potential_unloads)
 {
     // 1. Let navigable be displayedDocument's node navigable.
     auto navigable = displayed_document->navigable();
 
+    // NOTE: The displayed document's session history entry only stays around for the user to come back to on push and
+    //       traverse navigations. A reload or replace throws the document away for good, so it is never worth keeping.
+    displayed_document->set_may_be_kept_in_back_forward_cache(navigation_type == Bindings::NavigationType::Push || navigation_type == Bindings::NavigationType::Traverse);
+
     // 2. Let potentiallyTriggerViewTransition be false.
     auto potentially_trigger_view_transition = false;
 
@@ -765,7 +769,7 @@ TraversableNavigable::HistoryStepResult TraversableNavigable::apply_the_history_
             VERIFY(navigation_type.has_value());
 
             // 2. Deactivate displayedDocument, given userNavigationInvolvement, targetEntry, navigationType, and afterPotentialUnloads.
-            deactivate_a_document_for_cross_document_navigation(*displayed_document, user_involvement_for_navigate_events, *populated_target_entry, after_potential_unload);
+            deactivate_a_document_for_cross_document_navigation(*displayed_document, user_involvement_for_navigate_events, *populated_target_entry, *navigation_type, after_potential_unload);
         }
     }
 
@@ -1050,6 +1054,9 @@ void TraversableNavigable::clear_the_forward_session_history()
     // 2. Let step be the navigable's current session history step.
     auto step = current_session_history_step();
 
+    // NOTE: Documents kept alive in the entries we're about to remove can never be shown again, so destroy them below.
+    Vector<JS::NonnullGCPtr<DOM::Document>> documents_of_removed_entries;
+
     // 3. Let entryLists be the ordered set « navigable's session history entries ».
     Vector<Vector<JS::NonnullGCPtr<SessionHistoryEntry>>&> entry_lists;
     entry_lists.append(session_history_entries());
@@ -1059,8 +1066,12 @@ void TraversableNavigable::clear_the_forward_session_history()
         auto& entry_list = entry_lists.take_first();
 
         // 1. Remove every session history entry from entryList that has a step greater than step.
-        entry_list.remove_all_matching([step](auto& entry) {
-            return entry->step().template get<int>() > step;
+        entry_list.remove_all_matching([&](auto& entry) {
+            if (entry->step().template get<int>() <= step)
+                return false;
+            if (auto document = entry->document(); document && !documents_of_removed_entries.contains_slow(*document))
+                documents_of_removed_entries.append(*document);
+            return true;
         });
 
         // 2. For each entry of entryList:
@@ -1071,6 +1082,63 @@ void TraversableNavigable::clear_the_forward_session_history()
             }
         }
     }
+
+    for (auto& document : documents_of_removed_entries) {
+        if (document->is_active())
+            continue;
+        auto still_referenced = m_session_history_entries.find_if([&](auto& entry) { return entry->document() == document; }) != m_session_history_entries.end();
+        if (!still_referenced)
+            document->destroy();
+    }
+}
+
+// Upper bound on the number of documents kept alive in session history entries, besides the active one.
+static constexpr size_t max_documents_in_back_forward_cache = 4;
+
+void TraversableNavigable::evict_documents_from_back_forward_cache_if_needed(JS::GCPtr<DOM::Document> document_to_keep)
+{
+    struct CachedDocument {
+        JS::NonnullGCPtr<DOM::Document> document;
+        int distance_from_current_step { 0 };
+    };
+    Vector<CachedDocument> cached_documents;
+
+    for (auto& entry : m_session_history_entries) {
+        auto document = entry->document();
+        if (!document || document == active_document() || document == document_to_keep)
+            continue;
+        if (document->is_active())
+            continue;
+
+        auto step = entry->step().get<int>();
+        auto distance = step > m_current_session_history_step ? step - m_current_session_history_step : m_current_session_history_step - step;
+        auto existing = cached_documents.find_if([&](auto& cached) { return cached.document == document; });
+        if (existing != cached_documents.end())
+            existing->distance_from_current_step = min(existing->distance_from_current_step, distance);
+        else
+            cached_documents.append({ *document, distance });
+    }
+
+    if (cached_documents.size() <= max_documents_in_back_forward_cache)
+        return;
+
+    // Evict the documents the user is least likely to go back to, i.e. those farthest away from the current step.
+    quick_sort(cached_documents, [](auto& a, auto& b) {
+        return a.distance_from_current_step < b.distance_from_current_step;
+    });
+    for (size_t i = max_documents_in_back_forward_cache; i < cached_documents.size(); ++i)
+        destroy_document_kept_in_session_history(cached_documents[i].document);
+}
+
+void TraversableNavigable::destroy_document_kept_in_session_history(JS::NonnullGCPtr<DOM::Document> document)
+{
+    document->destroy();
+
+    // NOTE: Traversing to an entry without a document loads it from scratch.
+    for (auto& entry : m_session_history_entries) {
+        if (entry->document() == document)
+            entry->document_state()->set_document(nullptr);
+    }
 }
 
 bool TraversableNavigable::can_go_forward() const
@@ -1365,6 +1433,37 @@ void TraversableNavigable::paint(DevicePixelRect const& content_rect, Painting::
         return;
     }
 
+    // NOTE: The damage has to be taken after recording, as a new paint config damages the whole viewport.
+    Optional<DOM::Document::Damage> damage;
+    if (paint_options.is_next_frame)
+        damage = document->take_damage(*display_list);
+
+    // Only the CPU player paints straight into the target's bitmap, so that's the only one we can let keep the
+    // pixels copied from the previous frame.
+    auto execute_on_cpu = [&] {
+        Optional<Gfx::IntRect> damaged_rect;
+        if (paint_options.previous_frame && damage.has_value() && display_list->can_be_painted_partially()) {
+            damaged_rect = page().enclosing_device_rect(damage->rect).to_type<int>();
+
+            // After a scroll, the previous frame is moved along with the content, and whatever moved into view
+            // from outside of it has to be painted.
+            auto const& translation = damage->translation;
+            auto target_rect = Gfx::IntRect { {}, content_rect.size().to_type<int>() };
+            if (translation.x() > 0)
+                damaged_rect = damaged_rect->united({ 0, 0, translation.x(), target_rect.height() });
+            else if (translation.x() < 0)
+                damaged_rect = damaged_rect->united({ target_rect.width() + translation.x(), 0, -translation.x(), target_rect.height() });
+            if (translation.y() > 0)
+                damaged_rect = damaged_rect->united({ 0, 0, target_rect.width(), translation.y() });
+            else if (translation.y() < 0)
+                damaged_rect = damaged_rect->united({ 0, target_rect.height() + translation.y(), target_rect.width(), -translation.y() });
+
+            target.copy_undamaged_area_from(*paint_options.previous_frame, *damaged_rect, translation);
+        }
+        Painting::DisplayListPlayerSkia player(target.bitmap());
+        player.execute(*display_list, damaged_rect);
+    };
+
     switch (page().client().display_list_player_type()) {
     case DisplayListPlayerType::SkiaGPUIfAvailable: {
 #ifdef AK_OS_MACOS
@@ -1386,13 +1485,11 @@ void TraversableNavigable::paint(DevicePixelRect const& content_rect, Painting::
 #endif
 
         // Fallback to CPU backend if GPU is not available
-        Painting::DisplayListPlayerSkia player(target.bitmap());
-        player.execute(*display_list);
+        execute_on_cpu();
         break;
     }
     case DisplayListPlayerType::SkiaCPU: {
-        Painting::DisplayListPlayerSkia player(target.bitmap());
-        player.execute(*display_list);
+        execute_on_cpu();
         break;
     }
     default:
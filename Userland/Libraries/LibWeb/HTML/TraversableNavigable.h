@@ -80,6 +80,8 @@ public:
     void close_top_level_traversable();
     void destroy_top_level_traversable();
 
+    void evict_documents_from_back_forward_cache_if_needed(JS::GCPtr<DOM::Document> document_to_keep);
+
     void append_session_history_traversal_steps(JS::NonnullGCPtr<JS::HeapFunction<void()>> steps)
     {
         m_session_history_traversal_queue->append(steps);
@@ -97,6 +99,8 @@ public:
 
     void paint(Web::DevicePixelRect const&, Painting::BackingStore&, Web::PaintOptions);
 
+    Painting::SkiaBackendContext const* skia_backend_context() const { return m_skia_backend_context.ptr(); }
+
     enum class CheckIfUnloadingIsCanceledResult {
         CanceledByBeforeUnload,
         CanceledByNavigate,
@@ -125,6 +129,8 @@ private:
 
     [[nodiscard]] bool can_go_forward() const;
 
+    void destroy_document_kept_in_session_history(JS::NonnullGCPtr<DOM::Document>);
+
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-current-session-history-step
     int m_current_session_history_step { 0 };
 
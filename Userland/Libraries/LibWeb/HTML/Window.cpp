@@ -31,6 +31,7 @@
 #include <LibWeb/DOM/EventDispatcher.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/EventTiming/PerformanceEventTiming.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/CloseWatcherManager.h>
 #include <LibWeb/HTML/CustomElements/CustomElementRegistry.h>
@@ -127,6 +128,7 @@ void Window::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_count_queuing_strategy_size_function);
     visitor.visit(m_byte_length_queuing_strategy_size_function);
     visitor.visit(m_close_watcher_manager);
+    visitor.visit(m_event_timing_entries_to_be_queued);
 }
 
 void Window::finalize()
@@ -416,8 +418,12 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<Storage>> Window::local_storage()
 {
     // FIXME: Implement according to spec.
     static HashMap<URL::Origin, JS::Handle<Storage>> local_storage_per_origin;
-    auto storage = local_storage_per_origin.ensure(associated_document().origin(), [this]() -> JS::Handle<Storage> {
-        return Storage::create(realm());
+    auto const& origin = associated_document().origin();
+    auto storage = local_storage_per_origin.ensure(origin, [&]() -> JS::Handle<Storage> {
+        // NOTE: Opaque origins can never be visited again, so there is no point in persisting their storage.
+        if (origin.is_opaque())
+            return Storage::create(realm());
+        return Storage::create_persistent(realm(), page(), MUST(String::from_byte_string(origin.serialize())));
     });
     return JS::NonnullGCPtr { *storage };
 }
@@ -225,6 +225,13 @@ public:
 
     void consume_history_action_user_activation();
 
+    // https://w3c.github.io/event-timing/#window-entries-to-be-queued
+    Vector<JS::NonnullGCPtr<EventTiming::PerformanceEventTiming>>& event_timing_entries_to_be_queued() { return m_event_timing_entries_to_be_queued; }
+
+    // https://w3c.github.io/event-timing/#has-dispatched-input-event
+    bool has_dispatched_input_event() const { return m_has_dispatched_input_event; }
+    void set_has_dispatched_input_event(bool value) { m_has_dispatched_input_event = value; }
+
     static void set_inspector_object_exposed(bool);
     static void set_internals_object_exposed(bool);
 
@@ -310,6 +317,12 @@ private:
     // https://streams.spec.whatwg.org/#byte-length-queuing-strategy-size-function
     JS::GCPtr<WebIDL::CallbackType> m_byte_length_queuing_strategy_size_function;
 
+    // https://w3c.github.io/event-timing/#window-entries-to-be-queued
+    Vector<JS::NonnullGCPtr<EventTiming::PerformanceEventTiming>> m_event_timing_entries_to_be_queued;
+
+    // https://w3c.github.io/event-timing/#has-dispatched-input-event
+    bool m_has_dispatched_input_event { false };
+
     // https://html.spec.whatwg.org/multipage/nav-history-apis.html#dom-window-status
     // When the Window object is created, the attribute must be set to the empty string. It does not do anything else.
     String m_status;
@@ -9,6 +9,8 @@
 #include <AK/Base64.h>
 #include <AK/QuickSort.h>
 #include <AK/String.h>
+#include <AK/TemporaryChange.h>
+#include <AK/Time.h>
 #include <AK/Utf8View.h>
 #include <AK/Vector.h>
 #include <LibJS/Heap/HeapFunction.h>
@@ -16,6 +18,7 @@
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/EventTiming/PerformanceEventTiming.h>
 #include <LibWeb/Fetch/FetchMethod.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/ErrorEvent.h>
@@ -28,14 +31,18 @@
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/HTML/Timer.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/SupportedPerformanceTypes.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
+#include <LibWeb/PerformanceTimeline/PerformanceGarbageCollectionTiming.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserver.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserverEntryList.h>
+#include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
@@ -319,13 +326,16 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
     // 2. If previousId was given, let id be previousId; otherwise, let id be an implementation-defined integer that is greater than zero and does not already exist in global's map of active timers.
     auto id = previous_id.has_value() ? previous_id.value() : m_timer_id_allocator.allocate();
 
-    // FIXME: 3. If the surrounding agent's event loop's currently running task is a task that was created by this algorithm, then let nesting level be the task's timer nesting level. Otherwise, let nesting level be zero.
+    // 3. If the surrounding agent's event loop's currently running task is a task that was created by this algorithm, then let nesting level be the task's timer nesting level. Otherwise, let nesting level be zero.
+    auto nesting_level = m_running_timer_task_nesting_level.value_or(0);
 
     // 4. If timeout is less than 0, then set timeout to 0.
     if (timeout < 0)
         timeout = 0;
 
-    // FIXME: 5. If nesting level is greater than 5, and timeout is less than 4, then set timeout to 4.
+    // 5. If nesting level is greater than 5, and timeout is less than 4, then set timeout to 4.
+    if (nesting_level > 5 && timeout < 4)
+        timeout = 4;
 
     // 6. Let callerRealm be the current Realm Record, and calleeRealm be global's relevant Realm.
     // FIXME: Implement this when step 9.3.2 is implemented.
@@ -336,11 +346,13 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
     auto& vm = this_impl().vm();
 
     // 8. Let task be a task that runs the following substeps:
-    auto task = JS::create_heap_function(vm.heap(), Function<void()>([this, handler = move(handler), timeout, arguments = move(arguments), repeat, id, initiating_script]() {
+    auto task = JS::create_heap_function(vm.heap(), Function<void()>([this, handler = move(handler), timeout, arguments = move(arguments), repeat, id, initiating_script, task_nesting_level = nesting_level + 1]() {
         // 1. If id does not exist in global's map of active timers, then abort these steps.
         if (!m_timers.contains(id))
             return;
 
+        TemporaryChange change_nesting_level { m_running_timer_task_nesting_level, Optional<u32> { task_nesting_level } };
+
         handler.visit(
             // 2. If handler is a Function, then invoke handler given arguments with the callback this value set to thisArg. If this throws an exception, catch it, and report the exception.
             [&](JS::Handle<WebIDL::CallbackType> const& callback) {
@@ -399,8 +411,9 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
         }
     }));
 
-    // FIXME: 9. Increment nesting level by one.
-    // FIXME: 10. Set task's timer nesting level to nesting level.
+    // 9. Increment nesting level by one.
+    // 10. Set task's timer nesting level to nesting level.
+    // NOTE: The task captures the incremented nesting level above, and exposes it while it runs.
 
     // 11. Let completionStep be an algorithm step which queues a global task on the timer task source given global to run task.
     Function<void()> completion_step = [this, task = move(task)]() mutable {
@@ -410,7 +423,7 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
     };
 
     // 12. Run steps after a timeout given global, "setTimeout/setInterval", timeout, completionStep, and id.
-    run_steps_after_a_timeout_impl(timeout, move(completion_step), id);
+    run_steps_after_a_timeout_impl(align_timeout_for_hidden_traversable(timeout), move(completion_step), id);
 
     // 13. Return id.
     return id;
@@ -675,6 +688,28 @@ void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout(i32 timeout, Func
     return run_steps_after_a_timeout_impl(timeout, move(completion_step));
 }
 
+// NOTE: The spec allows user agents to delay timers further "to optimize the power usage of the device". Timers of
+//       documents in hidden tabs are aligned to whole seconds of the monotonic clock, so that all the timers of a
+//       background tab expire together and the process wakes up at most once per second for them.
+i32 WindowOrWorkerGlobalScopeMixin::align_timeout_for_hidden_traversable(i32 timeout) const
+{
+    static constexpr i64 hidden_timer_alignment_in_milliseconds = 1000;
+
+    if (!is<Window>(this_impl()))
+        return timeout;
+
+    auto navigable = verify_cast<Window>(this_impl()).associated_document().navigable();
+    if (!navigable || !navigable->traversable_navigable())
+        return timeout;
+    if (navigable->traversable_navigable()->system_visibility_state() != VisibilityState::Hidden)
+        return timeout;
+
+    auto now = MonotonicTime::now_coarse().milliseconds();
+    auto fire_time = now + timeout;
+    auto aligned_fire_time = ((fire_time + hidden_timer_alignment_in_milliseconds - 1) / hidden_timer_alignment_in_milliseconds) * hidden_timer_alignment_in_milliseconds;
+    return static_cast<i32>(min<i64>(aligned_fire_time - now, NumericLimits<i32>::max()));
+}
+
 void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout_impl(i32 timeout, Function<void()> completion_step, Optional<i32> timer_key)
 {
     // 1. Assert: if timerKey is given, then the caller of this algorithm is the timer initialization steps. (Other specifications must not pass timerKey.)
@@ -732,8 +767,9 @@ JS::NonnullGCPtr<JS::Object> WindowOrWorkerGlobalScopeMixin::supported_entry_typ
     if (!m_supported_entry_types_array) {
         Vector<JS::Value> supported_entry_types;
 
-#define __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(entry_type, cpp_class) \
-    supported_entry_types.append(JS::PrimitiveString::create(vm, entry_type));
+#define __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(entry_type, cpp_class)     \
+    if (HighResolutionTime::is_supported_performance_entry_type<cpp_class>()) \
+        supported_entry_types.append(JS::PrimitiveString::create(vm, entry_type));
         ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
 #undef __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
 
@@ -67,6 +67,7 @@ public:
     void register_event_source(Badge<EventSource>, JS::NonnullGCPtr<EventSource>);
     void unregister_event_source(Badge<EventSource>, JS::NonnullGCPtr<EventSource>);
     void forcibly_close_all_event_sources();
+    bool has_registered_event_sources() const { return !m_registered_event_sources.is_empty(); }
 
     void run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step);
 
@@ -93,12 +94,16 @@ private:
     };
     i32 run_timer_initialization_steps(TimerHandler handler, i32 timeout, JS::MarkedVector<JS::Value> arguments, Repeat repeat, Optional<i32> previous_id = {});
     void run_steps_after_a_timeout_impl(i32 timeout, Function<void()> completion_step, Optional<i32> timer_key = {});
+    i32 align_timeout_for_hidden_traversable(i32 timeout) const;
 
     JS::NonnullGCPtr<JS::Promise> create_image_bitmap_impl(ImageBitmapSource& image, Optional<WebIDL::Long> sx, Optional<WebIDL::Long> sy, Optional<WebIDL::Long> sw, Optional<WebIDL::Long> sh, Optional<ImageBitmapOptions>& options) const;
 
     IDAllocator m_timer_id_allocator;
     HashMap<int, JS::NonnullGCPtr<Timer>> m_timers;
 
+    // The timer nesting level of the task created by the timer initialization steps that is currently running, if any.
+    Optional<u32> m_running_timer_task_nesting_level;
+
     // https://www.w3.org/TR/performance-timeline/#performance-timeline
     // Each global object has:
     // - a performance observer task queued flag
@@ -8,9 +8,23 @@
 
 namespace Web::HighResolutionTime {
 
+// Non-standard entry types may only be supported when enabled at runtime, see PerformanceGarbageCollectionTiming.
+template<typename EntryClass>
+bool is_supported_performance_entry_type()
+{
+    if constexpr (requires { EntryClass::is_enabled(); })
+        return EntryClass::is_enabled();
+    return true;
+}
+
 // Please keep these in alphabetical order based on the entry type :^)
-#define ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES                                                                   \
-    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::mark, UserTiming::PerformanceMark) \
-    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::measure, UserTiming::PerformanceMeasure)
+#define ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES                                                                                              \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::event, EventTiming::PerformanceEventTiming)                   \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::first_input, EventTiming::PerformanceEventTiming::FirstInput) \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::gc, PerformanceTimeline::PerformanceGarbageCollectionTiming)  \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::longtask, LongTasks::PerformanceLongTaskTiming)               \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::mark, UserTiming::PerformanceMark)                            \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::measure, UserTiming::PerformanceMeasure)                      \
+    __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(PerformanceTimeline::EntryTypes::resource, ResourceTiming::PerformanceResourceTiming)
 
 }
@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBCursorWithValue.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBCursor);
+
+JS::NonnullGCPtr<IDBCursor> IDBCursor::create(JS::Realm& realm, IDBCursorSource source, IDBTransaction& transaction, Bindings::IDBCursorDirection direction, KeyRange range, bool key_only)
+{
+    if (!key_only)
+        return IDBCursorWithValue::create(realm, move(source), transaction, direction, move(range));
+    return realm.heap().allocate<IDBCursor>(realm, realm, move(source), transaction, direction, move(range), true);
+}
+
+IDBCursor::IDBCursor(JS::Realm& realm, IDBCursorSource source, IDBTransaction& transaction, Bindings::IDBCursorDirection direction, KeyRange range, bool key_only)
+    : Bindings::PlatformObject(realm)
+    , m_source(move(source))
+    , m_transaction(transaction)
+    , m_direction(direction)
+    , m_range(move(range))
+    , m_key_only(key_only)
+{
+}
+
+IDBCursor::~IDBCursor() = default;
+
+void IDBCursor::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBCursor);
+}
+
+void IDBCursor::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    m_source.visit([&](auto const& source) { visitor.visit(source); });
+    visitor.visit(m_transaction);
+    visitor.visit(m_value);
+    visitor.visit(m_request);
+    visitor.visit(m_key_value);
+    visitor.visit(m_primary_key_value);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-source
+Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>> IDBCursor::source() const
+{
+    // The source getter steps are to return this's source.
+    return m_source.visit([](auto const& source) -> Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>> {
+        return JS::make_handle(*source);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-key
+JS::Value IDBCursor::key()
+{
+    // The key getter steps are to return the result of converting a key to a value with the cursor’s current key.
+    // NOTE: If key returns an object (e.g. a Date or Array), it returns the same object instance every time it is
+    //       inspected, until the cursor’s key is changed.
+    if (!m_key.has_value())
+        return JS::js_undefined();
+    if (m_key_value.is_empty())
+        m_key_value = convert_a_key_to_a_value(realm(), *m_key);
+    return m_key_value;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-primarykey
+JS::Value IDBCursor::primary_key()
+{
+    // The primaryKey getter steps are to return the result of converting a key to a value with the cursor’s current
+    // effective key.
+    // NOTE: If primaryKey returns an object (e.g. a Date or Array), it returns the same object instance every time it
+    //       is inspected, until the cursor’s effective key is changed.
+    auto const& effective_key = this->effective_key();
+    if (!effective_key.has_value())
+        return JS::js_undefined();
+    if (m_primary_key_value.is_empty())
+        m_primary_key_value = convert_a_key_to_a_value(realm(), *effective_key);
+    return m_primary_key_value;
+}
+
+ObjectStore& IDBCursor::effective_object_store() const
+{
+    // If the source of a cursor is an object store, the effective object store of the cursor is that object store.
+    // If the source of a cursor is an index, the effective object store of the cursor is that index’s referenced
+    // object store.
+    return m_source.visit(
+        [](JS::NonnullGCPtr<IDBObjectStore> const& object_store) -> ObjectStore& { return object_store->object_store(); },
+        [](JS::NonnullGCPtr<IDBIndex> const& index) -> ObjectStore& { return index->index().object_store(); });
+}
+
+Optional<Key> const& IDBCursor::effective_key() const
+{
+    // If the source of a cursor is an object store, the effective key of the cursor is the cursor’s position. If the
+    // source of a cursor is an index, the effective key is the cursor’s object store position.
+    if (source_is_index())
+        return m_object_store_position;
+    return m_position;
+}
+
+bool IDBCursor::source_or_effective_object_store_was_deleted() const
+{
+    if (source_is_index() && m_source.get<JS::NonnullGCPtr<IDBIndex>>()->index().is_deleted())
+        return true;
+    return effective_object_store().is_deleted();
+}
+
+IDBRequestSource IDBCursor::request_source() const
+{
+    return m_source.visit([](auto const& source) -> IDBRequestSource { return source; });
+}
+
+void IDBCursor::set_key(Optional<Key> key)
+{
+    m_key = move(key);
+    m_key_value = {};
+    if (!source_is_index())
+        m_primary_key_value = {};
+}
+
+void IDBCursor::set_object_store_position(Optional<Key> position)
+{
+    m_object_store_position = move(position);
+    m_primary_key_value = {};
+}
+
+void IDBCursor::prepare_request_for_iteration()
+{
+    // Let request be this's request.
+    // Set request’s processed flag to false.
+    m_request->set_processed(false);
+
+    // Set request’s done flag to false.
+    m_request->set_done(false);
+}
+
+// Returns the first position in [0, size) for which the predicate holds, or size if there is none. The predicate must
+// not hold for any position before that, and must hold for every position after it.
+template<typename Predicate>
+static size_t first_position_where(size_t size, Predicate predicate)
+{
+    size_t low = 0;
+    size_t high = size;
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (predicate(middle))
+            high = middle;
+        else
+            low = middle + 1;
+    }
+    return low;
+}
+
+// https://w3c.github.io/IndexedDB/#iterate-a-cursor
+WebIDL::ExceptionOr<JS::Value> IDBCursor::iterate_a_cursor(Optional<Key> const& key, Optional<Key> const& primary_key, WebIDL::UnsignedLong count)
+{
+    auto& realm = this->realm();
+
+    // 1. Let source be cursor’s source.
+    // 2. Let direction be cursor’s direction.
+    auto direction = m_direction;
+
+    // 3. Assert: if primaryKey is given, source is an index and direction is "next" or "prev".
+    VERIFY(!primary_key.has_value() || (source_is_index() && (direction == Bindings::IDBCursorDirection::Next || direction == Bindings::IDBCursorDirection::Prev)));
+
+    // 4. Let records be the list of records in source.
+    // NOTE: Records are sorted by key (and by primary key within an index), so we use binary searches to find the
+    //       records matching the conditions below, instead of scanning all of them.
+    auto& store = effective_object_store();
+    Index const* index = source_is_index() ? &m_source.get<JS::NonnullGCPtr<IDBIndex>>()->index() : nullptr;
+
+    auto record_count = [&] {
+        return index ? index->records().size() : store.records().size();
+    };
+    auto record_key = [&](size_t position) -> Key const& {
+        return index ? index->records()[position].key : store.records()[position].key;
+    };
+    auto record_primary_key = [&](size_t position) -> Key const& {
+        return index ? index->records()[position].primary_key : store.records()[position].key;
+    };
+
+    // Compares a record with the given key, and then with the given primary key, if any.
+    auto compare_record = [&](size_t position, Key const& key, Key const* primary_key) {
+        auto result = compare_two_keys(record_key(position), key);
+        if (result != 0 || !primary_key)
+            return result;
+        return compare_two_keys(record_primary_key(position), *primary_key);
+    };
+
+    // 5. Let range be cursor’s range.
+    auto const& range = m_range;
+
+    auto is_at_or_above_lower_bound = [&](size_t position) {
+        if (!range.lower_bound.has_value())
+            return true;
+        auto result = compare_two_keys(record_key(position), *range.lower_bound);
+        return result > 0 || (result == 0 && !range.lower_open);
+    };
+    auto is_at_or_below_upper_bound = [&](size_t position) {
+        if (!range.upper_bound.has_value())
+            return true;
+        auto result = compare_two_keys(record_key(position), *range.upper_bound);
+        return result < 0 || (result == 0 && !range.upper_open);
+    };
+
+    // 6. Let position be cursor’s position.
+    auto position = m_position;
+
+    // 7. Let object store position be cursor’s object store position.
+    auto object_store_position = m_object_store_position;
+
+    // 8. If count is not given, let count be 1.
+    // 9. While count is greater than 0:
+    Optional<size_t> found_record;
+    while (count > 0) {
+        found_record.clear();
+
+        // 1. Switch on direction:
+        switch (direction) {
+        case Bindings::IDBCursorDirection::Next:
+        case Bindings::IDBCursorDirection::Nextunique: {
+            // "next": Let found record be the first record in records which satisfy all of the following requirements:
+            // "nextunique": Let found record be the first record in records which satisfy all of the following
+            //               requirements:
+            auto found = first_position_where(record_count(), [&](size_t candidate) {
+                // - If key is defined, the record’s key is greater than or equal to key.
+                if (key.has_value() && compare_record(candidate, *key, nullptr) < 0)
+                    return false;
+
+                // - If primaryKey is defined, the record’s key is equal to key and the record’s value is greater than or
+                //   equal to primaryKey, or the record’s key is greater than key.
+                if (primary_key.has_value() && compare_record(candidate, *key, &*primary_key) < 0)
+                    return false;
+
+                // - If position is defined, and source is an object store, the record’s key is greater than position.
+                // - If position is defined, and source is an index, the record’s key is equal to position and the
+                //   record’s value is greater than object store position or the record’s key is greater than position.
+                // - ("nextunique") If position is defined, the record’s key is greater than position.
+                if (position.has_value()) {
+                    bool compare_primary_key = index && direction == Bindings::IDBCursorDirection::Next;
+                    if (compare_record(candidate, *position, compare_primary_key ? &*object_store_position : nullptr) <= 0)
+                        return false;
+                }
+
+                // - The record’s key is in range.
+                return is_at_or_above_lower_bound(candidate);
+            });
+
+            if (found < record_count() && is_at_or_below_upper_bound(found))
+                found_record = found;
+            break;
+        }
+        case Bindings::IDBCursorDirection::Prev:
+        case Bindings::IDBCursorDirection::Prevunique: {
+            // "prev": Let found record be the last record in records which satisfy all of the following requirements:
+            // "prevunique": Let temp record be the last record in records which satisfy all of the following
+            //               requirements:
+            auto end = first_position_where(record_count(), [&](size_t candidate) {
+                // - If key is defined, the record’s key is less than or equal to key.
+                if (key.has_value() && compare_record(candidate, *key, nullptr) > 0)
+                    return true;
+
+                // - If primaryKey is defined, the record’s key is equal to key and the record’s value is less than or
+                //   equal to primaryKey, or the record’s key is less than key.
+                if (primary_key.has_value() && compare_record(candidate, *key, &*primary_key) > 0)
+                    return true;
+
+                // - If position is defined, and source is an object store, the record’s key is less than position.
+                // - If position is defined, and source is an index, the record’s key is equal to position and the
+                //   record’s value is less than object store position or the record’s key is less than position.
+                // - ("prevunique") If position is defined, the record’s key is less than position.
+                if (position.has_value()) {
+                    bool compare_primary_key = index && direction == Bindings::IDBCursorDirection::Prev;
+                    if (compare_record(candidate, *position, compare_primary_key ? &*object_store_position : nullptr) >= 0)
+                        return true;
+                }
+
+                // - The record’s key is in range.
+                return !is_at_or_below_upper_bound(candidate);
+            });
+
+            if (end == 0 || !is_at_or_above_lower_bound(end - 1))
+                break;
+            auto found = end - 1;
+
+            // "prevunique": If temp record is defined, let found record be the first record in records whose key is
+            //               equal to temp record’s key.
+            // NOTE: Iterating with "prevunique" visits the same record as iterating with "nextunique", but in reverse
+            //       order.
+            if (direction == Bindings::IDBCursorDirection::Prevunique) {
+                auto const& temp_key = record_key(found);
+                found = first_position_where(record_count(), [&](size_t candidate) {
+                    return compare_record(candidate, temp_key, nullptr) >= 0;
+                });
+            }
+
+            found_record = found;
+            break;
+        }
+        default:
+            VERIFY_NOT_REACHED();
+        }
+
+        // 2. If found record is not defined, then:
+        if (!found_record.has_value()) {
+            // 1. Set cursor’s key to undefined.
+            set_key({});
+
+            // 2. If source is an index, set cursor’s object store position to undefined.
+            if (index)
+                set_object_store_position({});
+
+            // 3. If cursor’s key only flag is false, set cursor’s value to undefined.
+            if (!m_key_only)
+                m_value = JS::js_undefined();
+
+            // 4. Return null.
+            return JS::js_null();
+        }
+
+        // 3. Let position be found record’s key.
+        position = record_key(*found_record);
+
+        // 4. If source is an index, let object store position be found record’s value.
+        if (index)
+            object_store_position = record_primary_key(*found_record);
+
+        // 5. Decrease count by 1.
+        --count;
+    }
+
+    // 10. Set cursor’s position to position.
+    m_position = position;
+
+    // 11. If source is an index, set cursor’s object store position to object store position.
+    if (index)
+        set_object_store_position(object_store_position);
+
+    // 12. Set cursor’s key to found record’s key.
+    set_key(record_key(*found_record));
+
+    // 13. If cursor’s key only flag is false, then:
+    if (!m_key_only) {
+        // 1. Let serialized be found record’s value if source is an object store, or found record’s referenced value
+        //    otherwise.
+        auto const* record = index ? store.record_with_key(record_primary_key(*found_record)) : &store.records()[*found_record];
+        VERIFY(record);
+
+        // 2. Set cursor’s value to ! StructuredDeserialize(serialized, targetRealm)
+        m_value = MUST(HTML::structured_deserialize(realm.vm(), record->value, realm, {}));
+    }
+
+    // 14. Set cursor’s got value flag to true.
+    m_got_value = true;
+
+    // 15. Return cursor.
+    return JS::Value { this };
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-advance
+WebIDL::ExceptionOr<void> IDBCursor::advance(WebIDL::UnsignedLong count)
+{
+    auto& realm = this->realm();
+
+    // 1. If count is 0 (zero), throw a TypeError.
+    if (count == 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Count must not be zero"sv };
+
+    // 2. Let transaction be this's transaction.
+    // 3. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 4. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (source_or_effective_object_store_was_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 5. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 6. Set this's got value flag to false.
+    m_got_value = false;
+
+    // 7. Let request be this's request.
+    // 8. Set request’s processed flag to false.
+    // 9. Set request’s done flag to false.
+    prepare_request_for_iteration();
+
+    // 10. Let operation be an algorithm to run iterate a cursor with the current Realm record, this, and count.
+    auto operation = JS::create_heap_function(realm.heap(), [cursor = JS::NonnullGCPtr { *this }, count]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate_a_cursor({}, {}, count);
+    });
+
+    // 11. Run asynchronously execute a request with this's source, operation, and request.
+    m_transaction->asynchronously_execute_a_request(request_source(), operation, m_request);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-continue
+WebIDL::ExceptionOr<void> IDBCursor::continue_(JS::Value key)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (source_or_effective_object_store_was_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 4. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 5. If key is given, then:
+    Optional<Key> converted_key;
+    if (!key.is_undefined()) {
+        // 1. Let r be the result of converting a value to a key with key. Rethrow any exceptions.
+        // 2. If r is invalid, throw a "DataError" DOMException.
+        // 3. Let key be r.
+        converted_key = TRY(convert_a_value_to_a_key_or_throw(realm, key));
+
+        auto comparison = compare_two_keys(*converted_key, *m_position);
+
+        // 4. If key is less than or equal to this's position and this's direction is "next" or "nextunique", then
+        //    throw a "DataError" DOMException.
+        if (comparison <= 0 && (m_direction == Bindings::IDBCursorDirection::Next || m_direction == Bindings::IDBCursorDirection::Nextunique))
+            return WebIDL::DataError::create(realm, "The key is less than or equal to the cursor's position"_fly_string);
+
+        // 5. If key is greater than or equal to this's position and this's direction is "prev" or "prevunique", then
+        //    throw a "DataError" DOMException.
+        if (comparison >= 0 && (m_direction == Bindings::IDBCursorDirection::Prev || m_direction == Bindings::IDBCursorDirection::Prevunique))
+            return WebIDL::DataError::create(realm, "The key is greater than or equal to the cursor's position"_fly_string);
+    }
+
+    // 6. Set this's got value flag to false.
+    m_got_value = false;
+
+    // 7. Let request be this's request.
+    // 8. Set request’s processed flag to false.
+    // 9. Set request’s done flag to false.
+    prepare_request_for_iteration();
+
+    // 10. Let operation be an algorithm to run iterate a cursor with the current Realm record, this, and key (if given).
+    auto operation = JS::create_heap_function(realm.heap(), [cursor = JS::NonnullGCPtr { *this }, key = move(converted_key)]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate_a_cursor(key, {}, 1);
+    });
+
+    // 11. Run asynchronously execute a request with this's source, operation, and request.
+    m_transaction->asynchronously_execute_a_request(request_source(), operation, m_request);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-continueprimarykey
+WebIDL::ExceptionOr<void> IDBCursor::continue_primary_key(JS::Value key, JS::Value primary_key)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (source_or_effective_object_store_was_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 4. If this's source is not an index throw an "InvalidAccessError" DOMException.
+    if (!source_is_index())
+        return WebIDL::InvalidAccessError::create(realm, "The cursor's source is not an index"_fly_string);
+
+    // 5. If this's direction is not "next" or "prev", throw an "InvalidAccessError" DOMException.
+    if (m_direction != Bindings::IDBCursorDirection::Next && m_direction != Bindings::IDBCursorDirection::Prev)
+        return WebIDL::InvalidAccessError::create(realm, "The cursor's direction must be 'next' or 'prev'"_fly_string);
+
+    // 6. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 7. Let r be the result of converting a value to a key with key. Rethrow any exceptions.
+    // 8. If r is invalid, throw a "DataError" DOMException.
+    // 9. Let key be r.
+    auto converted_key = TRY(convert_a_value_to_a_key_or_throw(realm, key));
+
+    // 10. Let r be the result of converting a value to a key with primaryKey. Rethrow any exceptions.
+    // 11. If r is invalid, throw a "DataError" DOMException.
+    // 12. Let primaryKey be r.
+    auto converted_primary_key = TRY(convert_a_value_to_a_key_or_throw(realm, primary_key));
+
+    auto key_comparison = compare_two_keys(converted_key, *m_position);
+    auto primary_key_comparison = compare_two_keys(converted_primary_key, *m_object_store_position);
+
+    // 13. If key is less than this's position and this's direction is "next", throw a "DataError" DOMException.
+    if (key_comparison < 0 && m_direction == Bindings::IDBCursorDirection::Next)
+        return WebIDL::DataError::create(realm, "The key is less than the cursor's position"_fly_string);
+
+    // 14. If key is greater than this's position and this's direction is "prev", throw a "DataError" DOMException.
+    if (key_comparison > 0 && m_direction == Bindings::IDBCursorDirection::Prev)
+        return WebIDL::DataError::create(realm, "The key is greater than the cursor's position"_fly_string);
+
+    // 15. If key is equal to this's position and primaryKey is less than or equal to this's object store position
+    //     and this's direction is "next", throw a "DataError" DOMException.
+    if (key_comparison == 0 && primary_key_comparison <= 0 && m_direction == Bindings::IDBCursorDirection::Next)
+        return WebIDL::DataError::create(realm, "The primary key is less than or equal to the cursor's object store position"_fly_string);
+
+    // 16. If key is equal to this's position and primaryKey is greater than or equal to this's object store position
+    //     and this's direction is "prev", throw a "DataError" DOMException.
+    if (key_comparison == 0 && primary_key_comparison >= 0 && m_direction == Bindings::IDBCursorDirection::Prev)
+        return WebIDL::DataError::create(realm, "The primary key is greater than or equal to the cursor's object store position"_fly_string);
+
+    // 17. Set this's got value flag to false.
+    m_got_value = false;
+
+    // 18. Let request be this's request.
+    // 19. Set request’s processed flag to false.
+    // 20. Set request’s done flag to false.
+    prepare_request_for_iteration();
+
+    // 21. Let operation be an algorithm to run iterate a cursor with the current Realm record, this, key, and
+    //     primaryKey.
+    auto operation = JS::create_heap_function(realm.heap(), [cursor = JS::NonnullGCPtr { *this }, key = move(converted_key), primary_key = move(converted_primary_key)]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate_a_cursor(key, primary_key, 1);
+    });
+
+    // 22. Run asynchronously execute a request with this's source, operation, and request.
+    m_transaction->asynchronously_execute_a_request(request_source(), operation, m_request);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-update
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBCursor::update(JS::Value value)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (m_transaction->mode() == Bindings::IDBTransactionMode::Readonly)
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // 4. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (source_or_effective_object_store_was_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 5. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 6. If this's key only flag is true, throw an "InvalidStateError" DOMException.
+    if (m_key_only)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is a key cursor"_fly_string);
+
+    // 7. Let targetRealm be a user-agent defined Realm.
+    // 8. Let clone be a clone of value in targetRealm during transaction. Rethrow any exceptions.
+    auto clone = TRY(clone_a_value_during_transaction(realm, m_transaction, value));
+
+    // 9. If this's effective object store uses in-line keys, then:
+    auto& store = effective_object_store();
+    auto const& effective_key = *this->effective_key();
+    if (store.uses_in_line_keys()) {
+        // 1. Let kpk be the result of extracting a key from a value using a key path with clone and the key path of
+        //    this's effective object store. Rethrow any exceptions.
+        auto kpk = TRY(extract_a_key_from_a_value_using_a_key_path(realm, clone, *store.key_path()));
+
+        // 2. If kpk is failure, invalid, or not equal to this's effective key, throw a "DataError" DOMException.
+        if (kpk.is_error() || !(kpk.value() == effective_key))
+            return WebIDL::DataError::create(realm, "The value's key does not match the cursor's effective key"_fly_string);
+    }
+
+    // 10. Let operation be an algorithm to run store a record into an object store with this's effective object store,
+    //     clone, this's effective key, and false.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, transaction = m_transaction, store = NonnullRefPtr { store }, clone, key = effective_key]() -> WebIDL::ExceptionOr<JS::Value> {
+        return store_a_record_into_an_object_store(realm, transaction, store, clone, key, false);
+    });
+
+    // 11. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-delete
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBCursor::delete_()
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (m_transaction->mode() == Bindings::IDBTransactionMode::Readonly)
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // 4. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (source_or_effective_object_store_was_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 5. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 6. If this's key only flag is true, throw an "InvalidStateError" DOMException.
+    if (m_key_only)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is a key cursor"_fly_string);
+
+    // 7. Let operation be an algorithm to run delete records from an object store with this's effective object store
+    //    and this's effective key.
+    auto operation = JS::create_heap_function(realm.heap(), [transaction = m_transaction, store = NonnullRefPtr { effective_object_store() }, key = *effective_key()]() -> WebIDL::ExceptionOr<JS::Value> {
+        return delete_records_from_an_object_store(transaction, store, KeyRange::only(key));
+    });
+
+    // 8. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+}
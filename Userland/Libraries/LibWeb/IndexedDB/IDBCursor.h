@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#cursor-source
+using IDBCursorSource = Variant<JS::NonnullGCPtr<IDBObjectStore>, JS::NonnullGCPtr<IDBIndex>>;
+
+// https://w3c.github.io/IndexedDB/#idbcursor
+class IDBCursor : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBCursor, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBCursor);
+
+public:
+    // NOTE: Cursors that are not key only are IDBCursorWithValue objects.
+    [[nodiscard]] static JS::NonnullGCPtr<IDBCursor> create(JS::Realm&, IDBCursorSource, IDBTransaction&, Bindings::IDBCursorDirection, KeyRange, bool key_only);
+
+    virtual ~IDBCursor() override;
+
+    Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>> source() const;
+    Bindings::IDBCursorDirection direction() const { return m_direction; }
+    JS::Value key();
+    JS::Value primary_key();
+    JS::NonnullGCPtr<IDBRequest> request() const { return *m_request; }
+
+    WebIDL::ExceptionOr<void> advance(WebIDL::UnsignedLong count);
+    WebIDL::ExceptionOr<void> continue_(JS::Value key);
+    WebIDL::ExceptionOr<void> continue_primary_key(JS::Value key, JS::Value primary_key);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> update(JS::Value value);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> delete_();
+
+    void set_request(IDBRequest& request) { m_request = request; }
+
+    // https://w3c.github.io/IndexedDB/#iterate-a-cursor
+    WebIDL::ExceptionOr<JS::Value> iterate_a_cursor(Optional<Key> const& key, Optional<Key> const& primary_key, WebIDL::UnsignedLong count);
+
+protected:
+    IDBCursor(JS::Realm&, IDBCursorSource, IDBTransaction&, Bindings::IDBCursorDirection, KeyRange, bool key_only);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://w3c.github.io/IndexedDB/#cursor-value
+    JS::Value m_value { JS::js_undefined() };
+
+private:
+    // https://w3c.github.io/IndexedDB/#cursor-effective-object-store
+    ObjectStore& effective_object_store() const;
+
+    // https://w3c.github.io/IndexedDB/#cursor-effective-key
+    Optional<Key> const& effective_key() const;
+
+    bool source_is_index() const { return m_source.has<JS::NonnullGCPtr<IDBIndex>>(); }
+    bool source_or_effective_object_store_was_deleted() const;
+    IDBRequestSource request_source() const;
+
+    void set_key(Optional<Key>);
+    void set_object_store_position(Optional<Key>);
+    void prepare_request_for_iteration();
+
+    IDBCursorSource m_source;
+    JS::NonnullGCPtr<IDBTransaction> m_transaction;
+    Bindings::IDBCursorDirection m_direction;
+
+    // https://w3c.github.io/IndexedDB/#cursor-range
+    KeyRange m_range;
+
+    // https://w3c.github.io/IndexedDB/#cursor-position
+    Optional<Key> m_position;
+
+    // https://w3c.github.io/IndexedDB/#cursor-object-store-position
+    Optional<Key> m_object_store_position;
+
+    // https://w3c.github.io/IndexedDB/#cursor-key
+    Optional<Key> m_key;
+
+    // https://w3c.github.io/IndexedDB/#cursor-got-value-flag
+    bool m_got_value { false };
+
+    // https://w3c.github.io/IndexedDB/#cursor-key-only-flag
+    bool m_key_only { false };
+
+    JS::GCPtr<IDBRequest> m_request;
+
+    // NOTE: The key and primary key are converted to values once, so the same object is returned until they change.
+    JS::Value m_key_value;
+    JS::Value m_primary_key_value;
+};
+
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBCursorWithValuePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/IndexedDB/IDBCursorWithValue.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBCursorWithValue);
+
+JS::NonnullGCPtr<IDBCursorWithValue> IDBCursorWithValue::create(JS::Realm& realm, IDBCursorSource source, IDBTransaction& transaction, Bindings::IDBCursorDirection direction, KeyRange range)
+{
+    return realm.heap().allocate<IDBCursorWithValue>(realm, realm, move(source), transaction, direction, move(range));
+}
+
+IDBCursorWithValue::IDBCursorWithValue(JS::Realm& realm, IDBCursorSource source, IDBTransaction& transaction, Bindings::IDBCursorDirection direction, KeyRange range)
+    : IDBCursor(realm, move(source), transaction, direction, move(range), false)
+{
+}
+
+IDBCursorWithValue::~IDBCursorWithValue() = default;
+
+void IDBCursorWithValue::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBCursorWithValue);
+}
+
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/IndexedDB/IDBCursor.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#idbcursorwithvalue
+class IDBCursorWithValue final : public IDBCursor {
+    WEB_PLATFORM_OBJECT(IDBCursorWithValue, IDBCursor);
+    JS_DECLARE_ALLOCATOR(IDBCursorWithValue);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBCursorWithValue> create(JS::Realm&, IDBCursorSource, IDBTransaction&, Bindings::IDBCursorDirection, KeyRange);
+
+    virtual ~IDBCursorWithValue() override;
+
+    JS::Value value() const { return m_value; }
+
+private:
+    IDBCursorWithValue(JS::Realm&, IDBCursorSource, IDBTransaction&, Bindings::IDBCursorDirection, KeyRange);
+
+    virtual void initialize(JS::Realm&) override;
+};
+
+}
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBDatabasePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBDatabase);
+
+JS::NonnullGCPtr<IDBDatabase> IDBDatabase::create(JS::Realm& realm, Database& database)
+{
+    return realm.heap().allocate<IDBDatabase>(realm, realm, database);
+}
+
+IDBDatabase::IDBDatabase(JS::Realm& realm, Database& database)
+    : EventTarget(realm)
+    , m_database(database)
+    , m_version(database.version())
+{
+}
+
+IDBDatabase::~IDBDatabase() = default;
+
+void IDBDatabase::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBDatabase);
+}
+
+void IDBDatabase::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_upgrade_transaction);
+    visitor.visit(m_transactions);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-objectstorenames
+JS::NonnullGCPtr<HTML::DOMStringList> IDBDatabase::object_store_names() const
+{
+    // 1. Let names be a list of the names of the object stores in this's object store set.
+    // 2. Return the result (a DOMStringList) of creating a sorted name list with names.
+    return HTML::DOMStringList::create(realm(), m_database->object_store_names());
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-transaction
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBTransaction>> IDBDatabase::transaction(Variant<String, Vector<String>> const& store_names, Bindings::IDBTransactionMode mode, IDBTransactionOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. If a live upgrade transaction is associated with the connection, throw an "InvalidStateError" DOMException.
+    if (m_upgrade_transaction && m_upgrade_transaction->state() != IDBTransaction::State::Finished)
+        return WebIDL::InvalidStateError::create(realm, "An upgrade transaction is running"_fly_string);
+
+    // 2. If this's close pending flag is true, then throw an "InvalidStateError" DOMException.
+    if (m_close_pending)
+        return WebIDL::InvalidStateError::create(realm, "The connection is closing"_fly_string);
+
+    // 3. Let scope be the set of unique strings in storeNames if it is a sequence, or a set containing one string
+    //    equal to storeNames otherwise.
+    Vector<String> scope_names;
+    store_names.visit(
+        [&](String const& name) { scope_names.append(name); },
+        [&](Vector<String> const& names) {
+            for (auto const& name : names) {
+                if (!scope_names.contains_slow(name))
+                    scope_names.append(name);
+            }
+        });
+
+    // 4. If any string in scope is not the name of an object store in the connected database, throw a
+    //    "NotFoundError" DOMException.
+    Vector<NonnullRefPtr<ObjectStore>> scope;
+    for (auto const& name : scope_names) {
+        auto object_store = m_database->object_store(name);
+        if (!object_store)
+            return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No object store named '{}' exists", name)));
+        scope.append(object_store.release_nonnull());
+    }
+
+    // 5. If scope is empty, throw an "InvalidAccessError" DOMException.
+    if (scope.is_empty())
+        return WebIDL::InvalidAccessError::create(realm, "A transaction must have at least one object store in scope"_fly_string);
+
+    // 6. If mode is not "readonly" or "readwrite", throw a TypeError.
+    if (mode != Bindings::IDBTransactionMode::Readonly && mode != Bindings::IDBTransactionMode::Readwrite)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Transaction mode must be 'readonly' or 'readwrite'"sv };
+
+    // 7. Let transaction be a newly created transaction with connection, mode, options’ durability member, and the
+    //    set of object stores named in scope.
+    auto transaction = IDBTransaction::create(realm, *this, mode, options.durability, move(scope));
+
+    // 8. Set transaction’s cleanup event loop to the current event loop.
+    transaction->set_cleanup_event_loop(HTML::current_settings_object().responsible_event_loop());
+    register_transaction_for_cleanup(transaction);
+
+    m_database->add_transaction(transaction);
+
+    // 9. Return an IDBTransaction object representing transaction.
+    return transaction;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-close
+void IDBDatabase::close()
+{
+    // 1. Run close a database connection with this connection.
+    close_a_database_connection();
+}
+
+// https://w3c.github.io/IndexedDB/#close-a-database-connection
+void IDBDatabase::close_a_database_connection(bool forced)
+{
+    // 1. Set connection’s close pending flag to true.
+    m_close_pending = true;
+
+    // 2. If the forced flag is true, then for each transaction created using connection run abort a transaction with
+    //    transaction and newly created "AbortError" DOMException.
+    if (forced) {
+        for (auto const& transaction : m_transactions)
+            transaction->abort_a_transaction(WebIDL::AbortError::create(realm(), "The connection was closed"_fly_string));
+    }
+
+    // 3. Wait for all transactions created using connection to complete. Once they are complete, connection is closed.
+    if (m_transactions.is_empty()) {
+        m_closed = true;
+        m_database->connection_was_closed();
+    }
+
+    // 4. If the forced flag is true, then fire an event named close at connection.
+    if (forced)
+        dispatch_event(DOM::Event::create(realm(), HTML::EventNames::close));
+}
+
+void IDBDatabase::transaction_did_finish(IDBTransaction& transaction)
+{
+    m_transactions.remove_first_matching([&](auto const& other) { return other.ptr() == &transaction; });
+
+    if (m_close_pending && !m_closed && m_transactions.is_empty()) {
+        m_closed = true;
+        m_database->connection_was_closed();
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-createobjectstore
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> IDBDatabase::create_object_store(String const& name, IDBObjectStoreParameters const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let database be this's associated database.
+    auto& database = *m_database;
+
+    // 2. Let transaction be database’s upgrade transaction if it is not null, or throw an "InvalidStateError"
+    //    DOMException otherwise.
+    if (!m_upgrade_transaction)
+        return WebIDL::InvalidStateError::create(realm, "Object stores can only be created during an upgrade"_fly_string);
+    auto transaction = m_upgrade_transaction;
+
+    // 3. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The upgrade transaction is not active"_fly_string);
+
+    // 4. Let keyPath be options’s keyPath member if it is not undefined or null, or null otherwise.
+    auto const& key_path = options.key_path;
+
+    // 5. If keyPath is not null and is not a valid key path, throw a "SyntaxError" DOMException.
+    if (key_path.has_value() && !is_valid_key_path(*key_path))
+        return WebIDL::SyntaxError::create(realm, "Invalid key path"_fly_string);
+
+    // 6. If an object store named name already exists in database throw a "ConstraintError" DOMException.
+    if (database.object_store(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An object store named '{}' already exists", name)));
+
+    // 7. Let autoIncrement be options’s autoIncrement member.
+    auto auto_increment = options.auto_increment;
+
+    // 8. If autoIncrement is true and keyPath is an empty string or any sequence (empty or otherwise), throw an
+    //    "InvalidAccessError" DOMException.
+    if (auto_increment && key_path.has_value()) {
+        auto is_empty_string_or_sequence = key_path->visit(
+            [](String const& string) { return string.is_empty(); },
+            [](Vector<String> const&) { return true; });
+        if (is_empty_string_or_sequence)
+            return WebIDL::InvalidAccessError::create(realm, "An auto-incrementing object store can not have an empty or array key path"_fly_string);
+    }
+
+    // 9. Let store be a new object store in database. Set the created object store's name to name. If keyPath is not
+    //    null, set the created object store's key path to keyPath. If autoIncrement is true, then the created object
+    //    store uses a key generator.
+    auto store = ObjectStore::create(database, name, key_path, auto_increment);
+    database.add_object_store(store);
+    transaction->add_undo_step([&database, store] {
+        store->set_deleted(true);
+        database.remove_object_store(store->name());
+    });
+
+    // 10. Return a new object store handle associated with store and transaction.
+    return transaction->object_store_handle(store);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-deleteobjectstore
+WebIDL::ExceptionOr<void> IDBDatabase::delete_object_store(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let database be this's associated database.
+    auto& database = *m_database;
+
+    // 2. Let transaction be database’s upgrade transaction if it is not null, or throw an "InvalidStateError"
+    //    DOMException otherwise.
+    if (!m_upgrade_transaction)
+        return WebIDL::InvalidStateError::create(realm, "Object stores can only be deleted during an upgrade"_fly_string);
+    auto transaction = m_upgrade_transaction;
+
+    // 3. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The upgrade transaction is not active"_fly_string);
+
+    // 4. Let store be the object store named name in database, or throw a "NotFoundError" DOMException if none.
+    auto store = database.object_store(name);
+    if (!store)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No object store named '{}' exists", name)));
+
+    // 5. Remove store from this's object store set.
+    // 6. If there is an object store handle associated with store and transaction, remove all entries from its index
+    //    set.
+    // 7. Destroy store.
+    // NOTE: Handles check whether their object store was deleted, so we only have to mark it as such.
+    store->set_deleted(true);
+    database.remove_object_store(name);
+    transaction->add_undo_step([&database, store = store.release_nonnull()] {
+        store->set_deleted(false);
+        database.add_object_store(store);
+    });
+
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onabort
+void IDBDatabase::set_onabort(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::abort, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onabort
+WebIDL::CallbackType* IDBDatabase::onabort()
+{
+    return event_handler_attribute(HTML::EventNames::abort);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onclose
+void IDBDatabase::set_onclose(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::close, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onclose
+WebIDL::CallbackType* IDBDatabase::onclose()
+{
+    return event_handler_attribute(HTML::EventNames::close);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onerror
+void IDBDatabase::set_onerror(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::error, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onerror
+WebIDL::CallbackType* IDBDatabase::onerror()
+{
+    return event_handler_attribute(HTML::EventNames::error);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onversionchange
+void IDBDatabase::set_onversionchange(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::versionchange, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-onversionchange
+WebIDL::CallbackType* IDBDatabase::onversionchange()
+{
+    return event_handler_attribute(HTML::EventNames::versionchange);
+}
+
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/IDBDatabasePrototype.h>
+#include <LibWeb/Bindings/IDBTransactionPrototype.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#dictdef-idbtransactionoptions
+struct IDBTransactionOptions {
+    Bindings::IDBTransactionDurability durability { Bindings::IDBTransactionDurability::Default };
+};
+
+// https://w3c.github.io/IndexedDB/#dictdef-idbobjectstoreparameters
+struct IDBObjectStoreParameters {
+    Optional<Variant<String, Vector<String>>> key_path;
+    bool auto_increment { false };
+};
+
+// https://w3c.github.io/IndexedDB/#database-connection
+class IDBDatabase final : public DOM::EventTarget {
+    WEB_PLATFORM_OBJECT(IDBDatabase, DOM::EventTarget);
+    JS_DECLARE_ALLOCATOR(IDBDatabase);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBDatabase> create(JS::Realm&, Database&);
+
+    virtual ~IDBDatabase() override;
+
+    String const& name() const { return m_database->name(); }
+    u64 version() const { return m_version; }
+    JS::NonnullGCPtr<HTML::DOMStringList> object_store_names() const;
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBTransaction>> transaction(Variant<String, Vector<String>> const& store_names, Bindings::IDBTransactionMode, IDBTransactionOptions const&);
+    void close();
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> create_object_store(String const& name, IDBObjectStoreParameters const&);
+    WebIDL::ExceptionOr<void> delete_object_store(String const& name);
+
+    void set_onabort(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onabort();
+    void set_onclose(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onclose();
+    void set_onerror(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onerror();
+    void set_onversionchange(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onversionchange();
+
+    Database& database() const { return m_database; }
+
+    void set_version(u64 version) { m_version = version; }
+
+    // https://w3c.github.io/IndexedDB/#connection-close-pending-flag
+    bool close_pending() const { return m_close_pending; }
+
+    bool is_closed() const { return m_closed; }
+
+    // https://w3c.github.io/IndexedDB/#database-upgrade-transaction
+    JS::GCPtr<IDBTransaction> upgrade_transaction() const { return m_upgrade_transaction; }
+    void set_upgrade_transaction(JS::GCPtr<IDBTransaction> transaction) { m_upgrade_transaction = transaction; }
+
+    // https://w3c.github.io/IndexedDB/#close-a-database-connection
+    void close_a_database_connection(bool forced = false);
+
+    void transaction_was_created(IDBTransaction& transaction) { m_transactions.append(transaction); }
+    void transaction_did_finish(IDBTransaction&);
+
+private:
+    IDBDatabase(JS::Realm&, Database&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    NonnullRefPtr<Database> m_database;
+
+    // https://w3c.github.io/IndexedDB/#connection-version
+    u64 m_version { 0 };
+
+    bool m_close_pending { false };
+    bool m_closed { false };
+
+    JS::GCPtr<IDBTransaction> m_upgrade_transaction;
+
+    // The transactions created through this connection that have not finished yet.
+    Vector<JS::NonnullGCPtr<IDBTransaction>> m_transactions;
+};
+
+}
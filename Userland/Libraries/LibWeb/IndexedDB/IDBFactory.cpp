@@ -4,9 +4,22 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Promise.h>
 #include <LibWeb/Bindings/IDBFactoryPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
+#include <LibWeb/IndexedDB/IDBOpenDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/IDBVersionChangeEvent.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::IndexedDB {
 
@@ -25,4 +38,429 @@ void IDBFactory::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBFactory);
 }
 
+using OpenResult = Variant<JS::NonnullGCPtr<IDBDatabase>, JS::NonnullGCPtr<WebIDL::DOMException>>;
+
+// https://w3c.github.io/IndexedDB/#fire-a-version-change-event
+static bool fire_a_version_change_event(FlyString const& type, DOM::EventTarget& target, u64 old_version, Optional<u64> new_version)
+{
+    // 1. Let event be the result of creating an event using IDBVersionChangeEvent.
+    // 2. Set event’s type attribute to e.
+    // 3. Set event’s bubbles and cancelable attributes to false.
+    // 4. Set event’s oldVersion attribute to oldVersion.
+    // 5. Set event’s newVersion attribute to newVersion.
+    IDBVersionChangeEventInit event_init;
+    event_init.old_version = old_version;
+    event_init.new_version = new_version;
+    auto event = IDBVersionChangeEvent::create(target.realm(), type, event_init);
+
+    // 6. Let legacyOutputDidListenersThrowFlag be false.
+    // 7. Dispatch event at target with legacyOutputDidListenersThrowFlag.
+    // FIXME: Our event dispatcher does not support legacyOutputDidListenersThrowFlag yet.
+    target.dispatch_event(event);
+
+    // 8. Return legacyOutputDidListenersThrowFlag.
+    return false;
+}
+
+// Fires "versionchange" at every other open connection to the database, then runs the given steps once they have all
+// been closed, firing "blocked" at the request if that did not happen right away.
+static void notify_other_connections_and_wait_for_them_to_close(JS::Realm& realm, Database& database, IDBDatabase const* connection, IDBOpenDBRequest& request, Optional<u64> new_version, Function<void()> steps)
+{
+    auto old_version = database.version();
+
+    // 1. Let openConnections be the set of all connections, except connection, associated with db.
+    auto open_connections = database.open_connections();
+    open_connections.remove_all_matching([&](auto const& entry) { return entry.ptr() == connection; });
+
+    // 2. For each entry of openConnections that does not have its close pending flag set to true, queue a database
+    //    task to fire a version change event named versionchange at entry with db’s version and version.
+    // 3. Wait for all of the events to be fired.
+    // NOTE: We fire the events directly, as we are already running in a database task.
+    for (auto const& entry : open_connections) {
+        if (!entry->close_pending())
+            fire_a_version_change_event(HTML::EventNames::versionchange, entry, old_version, new_version);
+    }
+
+    // 4. If any of the connections in openConnections are still not closed, queue a database task to fire a version
+    //    change event named blocked at request with db’s version and version.
+    bool any_still_open = any_of(open_connections, [](auto const& entry) { return !entry->is_closed(); });
+    if (any_still_open) {
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [request = JS::NonnullGCPtr { request }, old_version, new_version] {
+            fire_a_version_change_event(HTML::EventNames::blocked, request, old_version, new_version);
+        }));
+    }
+
+    // 5. Wait until all connections in openConnections are closed.
+    database.wait_for_other_connections_to_close(connection, move(steps));
+}
+
+// https://w3c.github.io/IndexedDB/#upgrade-a-database
+static void upgrade_a_database(JS::Realm& realm, IDBDatabase& connection, u64 version, IDBOpenDBRequest& request, JS::NonnullGCPtr<JS::HeapFunction<void()>> on_finished)
+{
+    // 1. Let db be connection’s database.
+    auto& database = connection.database();
+
+    // 2. Let transaction be a new upgrade transaction with connection used as connection. The scope of transaction
+    //    includes every object store in connection.
+    Vector<NonnullRefPtr<ObjectStore>> scope;
+    for (auto const& it : database.object_stores())
+        scope.append(it.value);
+    auto transaction = IDBTransaction::create(realm, connection, Bindings::IDBTransactionMode::Versionchange, Bindings::IDBTransactionDurability::Default, move(scope));
+    transaction->set_open_request(request);
+    transaction->set_on_finished(on_finished);
+
+    // 3. Set db’s upgrade transaction to transaction.
+    connection.set_upgrade_transaction(transaction);
+
+    // 4. Set transaction’s state to inactive.
+    transaction->set_state(IDBTransaction::State::Inactive);
+
+    // 6. Let old version be db’s version.
+    auto old_version = database.version();
+
+    // 7. Set db’s version to version. This change is considered part of the transaction, and so if the transaction is
+    //    aborted, this change is reverted.
+    database.set_version(version);
+    transaction->add_undo_step([&database, connection = JS::make_handle(connection), old_version] {
+        database.set_version(old_version);
+
+        // https://w3c.github.io/IndexedDB/#abort-an-upgrade-transaction
+        // Set connection’s version to database’s version if database previously existed, or 0 (zero) if database was
+        // newly created.
+        connection->set_version(old_version);
+    });
+
+    // 8. Set request’s processed flag to true.
+    request.set_processed(true);
+
+    // 9. Queue a database task to run these steps:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, &database, connection = JS::NonnullGCPtr { connection }, request = JS::NonnullGCPtr { request }, transaction, old_version, version] {
+        // 1. Set request’s result to connection.
+        request->set_result(connection);
+
+        // 2. Set request’s transaction to transaction.
+        request->set_transaction(transaction);
+
+        // 3. Set request’s done flag to true.
+        request->set_done(true);
+
+        // 4. Set transaction’s state to active.
+        transaction->set_state(IDBTransaction::State::Active);
+
+        // 5. Start transaction.
+        // NOTE: This is done here rather than before step 6, so that the transaction can not be committed before
+        //       the upgradeneeded event has been fired.
+        database.add_transaction(transaction);
+
+        // 6. Let didThrow be the result of firing a version change event named upgradeneeded at request with old
+        //    version and version.
+        auto did_throw = fire_a_version_change_event(HTML::EventNames::upgradeneeded, request, old_version, version);
+
+        // 7. If transaction’s state is active, then:
+        if (transaction->state() == IDBTransaction::State::Active) {
+            // 1. Set transaction’s state to inactive.
+            transaction->set_state(IDBTransaction::State::Inactive);
+
+            // 2. If didThrow is true, run abort a transaction with transaction and a newly created "AbortError"
+            //    DOMException.
+            if (did_throw) {
+                transaction->abort_a_transaction(WebIDL::AbortError::create(realm, "An upgradeneeded event handler threw an exception"_fly_string));
+                return;
+            }
+
+            transaction->commit_if_all_requests_were_processed();
+        }
+    }));
+
+    // 10. Wait for transaction to finish.
+    // NOTE: The on_finished steps are run once the transaction has finished.
+}
+
+// https://w3c.github.io/IndexedDB/#open-a-database-connection
+static void open_a_database_connection(JS::Realm& realm, URL::Origin const& origin, String const& name, Optional<u64> maybe_version, IDBOpenDBRequest& request, JS::NonnullGCPtr<JS::HeapFunction<void(OpenResult)>> on_complete)
+{
+    // 1. Let queue be the connection queue for storageKey and name.
+    // 2. Add request to queue.
+    // 3. Wait until all previous requests in queue have been processed.
+    // FIXME: Implement connection queues. Requests are currently only ordered by the tasks they queue.
+
+    // 4. Let db be the database named name in storageKey, or null otherwise.
+    auto& databases = databases_for_origin(origin);
+    RefPtr<Database> database = databases.get(name).value_or(nullptr);
+
+    // 5. If version is undefined, let version be 1 if db is null, or db’s version otherwise.
+    auto version = maybe_version.value_or(database ? database->version() : 1);
+
+    // 6. If db is null, let db be a new database with name name, version 0 (zero), and with no object stores.
+    if (!database) {
+        database = Database::create(name);
+        databases.set(name, *database);
+    }
+
+    // 7. If db’s version is greater than version, return a newly created "VersionError" DOMException and abort these
+    //    steps.
+    if (database->version() > version) {
+        on_complete->function()(WebIDL::VersionError::create(realm, MUST(String::formatted("The requested version ({}) is less than the existing version ({})", version, database->version()))));
+        return;
+    }
+
+    // 8. Let connection be a new connection to db.
+    auto connection = IDBDatabase::create(realm, *database);
+    database->add_connection(connection);
+
+    // 9. Set connection’s version to version.
+    connection->set_version(version);
+
+    // 10. If db’s version is less than version, then:
+    if (database->version() < version) {
+        notify_other_connections_and_wait_for_them_to_close(realm, *database, connection, request, version, [&realm, connection = JS::make_handle(connection), version, request = JS::make_handle(request), on_complete = JS::make_handle(on_complete)] {
+            // 6. Run upgrade a database using connection, version and request.
+            upgrade_a_database(realm, *connection, version, *request, JS::create_heap_function(realm.heap(), [&realm, connection, request, on_complete] {
+                // 7. If connection was closed, return a newly created "AbortError" DOMException and abort these steps.
+                if (connection->is_closed()) {
+                    on_complete->function()(WebIDL::AbortError::create(realm, "The connection was closed during the upgrade"_fly_string));
+                    return;
+                }
+
+                // 8. If the upgrade transaction was aborted, run the steps to close a database connection with
+                //    connection, return a newly created "AbortError" DOMException and abort these steps.
+                // NOTE: Aborting an upgrade transaction resets the open request's done flag.
+                if (!request->is_done()) {
+                    connection->close_a_database_connection();
+                    on_complete->function()(WebIDL::AbortError::create(realm, "The upgrade transaction was aborted"_fly_string));
+                    return;
+                }
+
+                // 11. Return connection.
+                on_complete->function()(JS::NonnullGCPtr { *connection });
+            }));
+        });
+        return;
+    }
+
+    // 11. Return connection.
+    on_complete->function()(connection);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-open
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> IDBFactory::open(String const& name, Optional<u64> version)
+{
+    auto& realm = this->realm();
+
+    // 1. Let environment be this's relevant settings object.
+    auto& environment = HTML::relevant_settings_object(*this);
+
+    // 2. Let storageKey be the result of running obtain a storage key given environment. If failure is returned, then
+    //    throw a "SecurityError" DOMException and abort these steps.
+    auto storage_key = StorageAPI::obtain_a_storage_key(environment);
+    if (!storage_key.has_value())
+        return WebIDL::SecurityError::create(realm, "IndexedDB is not available in this context"_fly_string);
+
+    // 3. If version is 0 (zero), throw a TypeError.
+    if (version.has_value() && version.value() == 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The version must not be zero"sv };
+
+    // 4. Let request be a new open request.
+    auto request = IDBOpenDBRequest::create(realm);
+
+    // 5. Run these steps in parallel:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, origin = storage_key->origin, name, version, request] {
+        // 1. Let result be the result of opening a database connection, with storageKey, name, version if given and
+        //    undefined otherwise, and request.
+        open_a_database_connection(realm, origin, name, version, request, JS::create_heap_function(realm.heap(), [&realm, request](OpenResult result) {
+            // 2. Set request’s processed flag to true.
+            request->set_processed(true);
+
+            // 3. Queue a database task to run these steps:
+            HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, request, result = move(result)] {
+                result.visit(
+                    // 1. If result is an error, then:
+                    [&](JS::NonnullGCPtr<WebIDL::DOMException> const& error) {
+                        // 1. Set request’s result to undefined.
+                        request->set_result(JS::js_undefined());
+
+                        // 2. Set request’s error to result.
+                        request->set_error(error);
+
+                        // 3. Set request’s done flag to true.
+                        request->set_done(true);
+
+                        // 4. Fire an event named error at request with its bubbles and cancelable attributes
+                        //    initialized to true.
+                        auto event = DOM::Event::create(realm, HTML::EventNames::error);
+                        event->set_bubbles(true);
+                        event->set_cancelable(true);
+                        request->dispatch_event(event);
+                    },
+                    // 2. Otherwise:
+                    [&](JS::NonnullGCPtr<IDBDatabase> const& connection) {
+                        // 1. Set request’s result to result.
+                        request->set_result(connection);
+
+                        // 2. Set request’s done flag to true.
+                        request->set_done(true);
+
+                        // 3. Fire an event named success at request.
+                        request->dispatch_event(DOM::Event::create(realm, HTML::EventNames::success));
+                    });
+            }));
+        }));
+    }));
+
+    // 6. Return a new IDBOpenDBRequest object for request.
+    return request;
+}
+
+// https://w3c.github.io/IndexedDB/#delete-a-database
+static void delete_a_database(JS::Realm& realm, URL::Origin const& origin, String const& name, IDBOpenDBRequest& request, Function<void(u64)> on_complete)
+{
+    // 1. Let queue be the connection queue for storageKey and name.
+    // 2. Add request to queue.
+    // 3. Wait until all previous requests in queue have been processed.
+    // FIXME: Implement connection queues.
+
+    // 4. Let db be the database named name in storageKey, if one exists. Otherwise, return 0 (zero).
+    auto& databases = databases_for_origin(origin);
+    RefPtr<Database> database = databases.get(name).value_or(nullptr);
+    if (!database) {
+        on_complete(0);
+        return;
+    }
+
+    // 5-9. Notify the open connections with a null new version, and wait for them to close.
+    notify_other_connections_and_wait_for_them_to_close(realm, *database, nullptr, request, {}, [origin, name, database = database.release_nonnull(), on_complete = move(on_complete)] {
+        // 10. Let version be db’s version.
+        auto version = database->version();
+
+        // 11. Delete db. If this fails for any reason, return an appropriate error (e.g. "QuotaExceededError" or
+        //     "UnknownError" DOMException).
+        auto& databases = databases_for_origin(origin);
+        if (databases.get(name) == database.ptr())
+            databases.remove(name);
+        for (auto const& it : database->object_stores())
+            it.value->set_deleted(true);
+
+        // 12. Return version.
+        on_complete(version);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-deletedatabase
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> IDBFactory::delete_database(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let environment be this's relevant settings object.
+    auto& environment = HTML::relevant_settings_object(*this);
+
+    // 2. Let storageKey be the result of running obtain a storage key given environment. If failure is returned, then
+    //    throw a "SecurityError" DOMException and abort these steps.
+    auto storage_key = StorageAPI::obtain_a_storage_key(environment);
+    if (!storage_key.has_value())
+        return WebIDL::SecurityError::create(realm, "IndexedDB is not available in this context"_fly_string);
+
+    // 3. Let request be a new open request.
+    auto request = IDBOpenDBRequest::create(realm);
+
+    // 4. Run these steps in parallel:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, origin = storage_key->origin, name, request] {
+        // 1. Let result be the result of deleting a database, with storageKey, name, and request.
+        delete_a_database(realm, origin, name, request, [&realm, request = JS::make_handle(request)](u64 result) {
+            // 2. Set request’s processed flag to true.
+            request->set_processed(true);
+
+            // 3. Queue a database task to run these steps:
+            HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [request = JS::NonnullGCPtr { *request }, result] {
+                // NOTE: Deleting a database from memory can not fail.
+                // 2. Otherwise:
+                // 1. Set request’s result to undefined.
+                request->set_result(JS::js_undefined());
+
+                // 2. Set request’s done flag to true.
+                request->set_done(true);
+
+                // 3. Fire a version change event named success at request with result and null.
+                fire_a_version_change_event(HTML::EventNames::success, request, result, {});
+            }));
+        });
+    }));
+
+    // 5. Return a new IDBOpenDBRequest object for request.
+    return request;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-databases
+JS::NonnullGCPtr<JS::Promise> IDBFactory::databases()
+{
+    auto& realm = this->realm();
+
+    // 1. Let environment be this's relevant settings object.
+    auto& environment = HTML::relevant_settings_object(*this);
+
+    // 2. Let storageKey be the result of running obtain a storage key given environment. If failure is returned, then
+    //    return a promise rejected with a "SecurityError" DOMException and abort these steps.
+    auto storage_key = StorageAPI::obtain_a_storage_key(environment);
+    if (!storage_key.has_value()) {
+        auto promise = WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "IndexedDB is not available in this context"_fly_string));
+        return JS::NonnullGCPtr { verify_cast<JS::Promise>(*promise->promise()) };
+    }
+
+    // 3. Let p be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 4. Run these steps in parallel:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, origin = storage_key->origin, promise] {
+        auto& vm = realm.vm();
+
+        // 1. Let databases be the set of databases in storageKey.
+        auto const& databases = databases_for_origin(origin);
+
+        // 3. Queue a database task to resolve p with result:
+        // 2. Let result be a new list.
+        // 3. For each db of databases:
+        Vector<JS::Value> result;
+        for (auto const& it : databases) {
+            auto const& database = it.value;
+
+            // NOTE: Databases that are still being created do not have a version yet.
+            if (database->version() == 0)
+                continue;
+
+            // 1. Let info be a new IDBDatabaseInfo dictionary.
+            auto info = JS::Object::create(realm, realm.intrinsics().object_prototype());
+
+            // 2. Set info’s name dictionary member to db’s name.
+            MUST(info->create_data_property("name"_fly_string, JS::PrimitiveString::create(vm, database->name())));
+
+            // 3. Set info’s version dictionary member to db’s version.
+            MUST(info->create_data_property("version"_fly_string, JS::Value(static_cast<double>(database->version()))));
+
+            // 4. Append info to result.
+            result.append(info);
+        }
+
+        WebIDL::resolve_promise(realm, promise, JS::Array::create_from(realm, result));
+    }));
+
+    // 5. Return p.
+    return JS::NonnullGCPtr { verify_cast<JS::Promise>(*promise->promise()) };
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-cmp
+WebIDL::ExceptionOr<i16> IDBFactory::cmp(JS::Value first, JS::Value second)
+{
+    auto& realm = this->realm();
+
+    // 1. Let a be the result of converting a value to a key with first. Rethrow any exceptions.
+    // 2. If a is invalid, throw a "DataError" DOMException.
+    auto a = TRY(convert_a_value_to_a_key_or_throw(realm, first));
+
+    // 3. Let b be the result of converting a value to a key with second. Rethrow any exceptions.
+    // 4. If b is invalid, throw a "DataError" DOMException.
+    auto b = TRY(convert_a_value_to_a_key_or_throw(realm, second));
+
+    // 5. Return the results of comparing two keys with a and b.
+    return compare_two_keys(a, b);
+}
+
 }
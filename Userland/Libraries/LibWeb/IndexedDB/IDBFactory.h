@@ -18,6 +18,11 @@ class IDBFactory : public Bindings::PlatformObject {
 public:
     virtual ~IDBFactory() override;
 
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> open(String const& name, Optional<u64> version);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> delete_database(String const& name);
+    JS::NonnullGCPtr<JS::Promise> databases();
+    WebIDL::ExceptionOr<i16> cmp(JS::Value first, JS::Value second);
+
 protected:
     explicit IDBFactory(JS::Realm&);
 
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/IDBIndexPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBIndex);
+
+JS::NonnullGCPtr<IDBIndex> IDBIndex::create(JS::Realm& realm, Index& index, IDBObjectStore& object_store_handle)
+{
+    return realm.heap().allocate<IDBIndex>(realm, realm, index, object_store_handle);
+}
+
+IDBIndex::IDBIndex(JS::Realm& realm, Index& index, IDBObjectStore& object_store_handle)
+    : Bindings::PlatformObject(realm)
+    , m_index(index)
+    , m_object_store_handle(object_store_handle)
+{
+}
+
+IDBIndex::~IDBIndex() = default;
+
+void IDBIndex::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBIndex);
+}
+
+void IDBIndex::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_object_store_handle);
+    visitor.visit(m_key_path_value);
+}
+
+// https://w3c.github.io/IndexedDB/#index-handle-transaction
+IDBTransaction& IDBIndex::transaction() const
+{
+    // The transaction of an index handle is the transaction of its associated object store handle.
+    return *m_object_store_handle->transaction();
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-name
+WebIDL::ExceptionOr<void> IDBIndex::set_name(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let name be the given value.
+    // 2. Let transaction be this's transaction.
+    auto& transaction = this->transaction();
+
+    // 3. Let index be this's index.
+    auto& index = *m_index;
+
+    // 4. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!transaction.is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Indexes can only be renamed during an upgrade"_fly_string);
+
+    // 5. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (transaction.state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 6. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (index.is_deleted() || index.object_store().is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The index or its object store has been deleted"_fly_string);
+
+    // 7. If index’s name is equal to name, terminate these steps.
+    if (index.name() == name)
+        return {};
+
+    // 8. If an index named name already exists in index’s object store, throw a "ConstraintError" DOMException.
+    auto& store = index.object_store();
+    if (store.index(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An index named '{}' already exists", name)));
+
+    // 9. Set index’s name to name.
+    // 10. Set this's name to name.
+    auto old_name = index.name();
+    store.rename_index(old_name, name);
+    transaction.add_undo_step([store = NonnullRefPtr { store }, old_name = move(old_name), name] {
+        store->rename_index(name, old_name);
+    });
+
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-keypath
+JS::Value IDBIndex::key_path()
+{
+    // The keyPath getter steps are to return this's index's key path. The key path is converted as a DOMString (if a
+    // string) or a sequence<DOMString> (if a list of strings), per [WEBIDL].
+    if (m_key_path_value.is_empty())
+        m_key_path_value = key_path_to_value(realm(), m_index->key_path());
+    return m_key_path_value;
+}
+
+// Steps shared by the methods that make requests against an index.
+WebIDL::ExceptionOr<void> IDBIndex::check_that_requests_can_be_made() const
+{
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (m_index->is_deleted() || m_index->object_store().is_deleted())
+        return WebIDL::InvalidStateError::create(realm(), "The index or its object store has been deleted"_fly_string);
+
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (transaction().state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm(), "The transaction is not active"_fly_string);
+
+    return {};
+}
+
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::retrieve(JS::Value query, bool null_disallowed, Function<JS::Value(JS::Realm&, Index const&, KeyRange const&)> steps)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query (and null disallowed flag true, for
+    //    get() and getKey()). Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query, null_disallowed));
+
+    // 6. Let operation be an algorithm to run the retrieval steps with the current Realm record, index, and range.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, index = m_index, range = move(range), steps = move(steps)]() -> WebIDL::ExceptionOr<JS::Value> {
+        return steps(realm, index, range);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction().asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-get
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get(JS::Value query)
+{
+    return retrieve(query, true, [](JS::Realm& realm, Index const& index, KeyRange const& range) -> JS::Value {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-referenced-value-from-an-index
+        // 1. Let record be the first record in index’s list of records whose key is in range, if any.
+        auto position = index.lower_bound(range);
+        if (position >= index.records().size() || !range.contains(index.records()[position].key)) {
+            // 2. If record was not found, return undefined.
+            return JS::js_undefined();
+        }
+
+        // 3. Let serialized be record’s referenced value.
+        auto const* referenced_record = index.object_store().record_with_key(index.records()[position].primary_key);
+        VERIFY(referenced_record);
+
+        // 4. Return ! StructuredDeserialize(serialized, targetRealm).
+        return MUST(HTML::structured_deserialize(realm.vm(), referenced_record->value, realm, {}));
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-getkey
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get_key(JS::Value query)
+{
+    return retrieve(query, true, [](JS::Realm& realm, Index const& index, KeyRange const& range) -> JS::Value {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-value-from-an-index
+        // 1. Let record be the first record in index’s list of records whose key is in range, if any.
+        auto position = index.lower_bound(range);
+        if (position >= index.records().size() || !range.contains(index.records()[position].key)) {
+            // 2. If record was not found, return undefined.
+            return JS::js_undefined();
+        }
+
+        // 3. Return the result of converting a key to a value with record’s value.
+        return convert_a_key_to_a_value(realm, index.records()[position].primary_key);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#retrieve-multiple-referenced-values-from-an-index
+// https://w3c.github.io/IndexedDB/#retrieve-multiple-values-from-an-index
+static JS::Value retrieve_multiple_records_from_an_index(JS::Realm& realm, Index const& index, KeyRange const& range, Optional<WebIDL::UnsignedLong> count, bool keys_only)
+{
+    // 1. If count is not given or is 0 (zero), let count be infinity.
+    // 2. Let records be a list containing the first count records in index’s list of records whose key is in range.
+    // 3. Let list be an empty list.
+    // 4. For each record of records:
+    //    - Keys: Append the result of converting a key to a value with record’s value to list.
+    //    - Values: Let serialized be record’s referenced value, and append ! StructuredDeserialize(serialized,
+    //      targetRealm) to list.
+    Vector<JS::Value> list;
+    for (auto position = index.lower_bound(range); position < index.records().size(); ++position) {
+        if (count.has_value() && *count != 0 && list.size() >= *count)
+            break;
+
+        auto const& record = index.records()[position];
+        if (!range.contains(record.key))
+            break;
+
+        if (keys_only) {
+            list.append(convert_a_key_to_a_value(realm, record.primary_key));
+        } else {
+            auto const* referenced_record = index.object_store().record_with_key(record.primary_key);
+            VERIFY(referenced_record);
+            list.append(MUST(HTML::structured_deserialize(realm.vm(), referenced_record->value, realm, {})));
+        }
+    }
+
+    // 5. Return list converted to a sequence<any>.
+    return JS::Array::create_from(realm, list);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-getall
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    return retrieve(query, false, [count](JS::Realm& realm, Index const& index, KeyRange const& range) {
+        return retrieve_multiple_records_from_an_index(realm, index, range, count, false);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-getallkeys
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    return retrieve(query, false, [count](JS::Realm& realm, Index const& index, KeyRange const& range) {
+        return retrieve_multiple_records_from_an_index(realm, index, range, count, true);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-count
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::count(JS::Value query)
+{
+    return retrieve(query, false, [](JS::Realm&, Index const& index, KeyRange const& range) {
+        // https://w3c.github.io/IndexedDB/#count-the-records-in-a-range
+        // 1. Let count be the number of records, if any, in source’s list of records with key in range.
+        size_t count = 0;
+        for (auto position = index.lower_bound(range); position < index.records().size() && range.contains(index.records()[position].key); ++position)
+            ++count;
+
+        // 2. Return count.
+        return JS::Value(count);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-opencursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::open_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, false);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-openkeycursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::open_key_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, true);
+}
+
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::open_a_cursor(JS::Value query, Bindings::IDBCursorDirection direction, bool key_only)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query));
+
+    // 6. Let cursor be a new cursor with its transaction set to transaction, undefined position, direction set to
+    //    direction, got value flag set to false, undefined key and value, source set to index, range set to range,
+    //    and key only flag set to false (true for openKeyCursor()).
+    auto cursor = IDBCursor::create(realm, JS::NonnullGCPtr { *this }, transaction(), direction, move(range), key_only);
+
+    // 7. Let operation be an algorithm to run iterate a cursor with the current Realm record and cursor.
+    auto operation = JS::create_heap_function(realm.heap(), [cursor]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate_a_cursor({}, {}, 1);
+    });
+
+    // 8. Let request be the result of running asynchronously execute a request with this and operation.
+    auto request = transaction().asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+
+    // 9. Set cursor’s request to request.
+    cursor->set_request(request);
+
+    // 10. Return request.
+    return request;
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/Internal/Index.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#index-handle-construct
+class IDBIndex final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBIndex, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBIndex);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBIndex> create(JS::Realm&, Index&, IDBObjectStore&);
+
+    virtual ~IDBIndex() override;
+
+    String const& name() const { return m_index->name(); }
+    WebIDL::ExceptionOr<void> set_name(String const&);
+    JS::NonnullGCPtr<IDBObjectStore> object_store() const { return m_object_store_handle; }
+    JS::Value key_path();
+    bool multi_entry() const { return m_index->multi_entry(); }
+    bool unique() const { return m_index->unique(); }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_key(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> count(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_cursor(JS::Value query, Bindings::IDBCursorDirection);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_key_cursor(JS::Value query, Bindings::IDBCursorDirection);
+
+    Index& index() const { return m_index; }
+    IDBTransaction& transaction() const;
+
+private:
+    IDBIndex(JS::Realm&, Index&, IDBObjectStore&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    WebIDL::ExceptionOr<void> check_that_requests_can_be_made() const;
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> retrieve(JS::Value query, bool null_disallowed, Function<JS::Value(JS::Realm&, Index const&, KeyRange const&)>);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_a_cursor(JS::Value query, Bindings::IDBCursorDirection, bool key_only);
+
+    NonnullRefPtr<Index> m_index;
+    JS::NonnullGCPtr<IDBObjectStore> m_object_store_handle;
+
+    // NOTE: The key path is converted to a value once, so the same array is returned every time.
+    JS::Value m_key_path_value;
+};
+
+}
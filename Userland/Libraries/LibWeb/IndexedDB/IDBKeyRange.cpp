@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBKeyRangePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBKeyRange);
+
+JS::NonnullGCPtr<IDBKeyRange> IDBKeyRange::create(JS::Realm& realm, KeyRange range)
+{
+    return realm.heap().allocate<IDBKeyRange>(realm, realm, move(range));
+}
+
+IDBKeyRange::IDBKeyRange(JS::Realm& realm, KeyRange range)
+    : Bindings::PlatformObject(realm)
+    , m_range(move(range))
+{
+}
+
+IDBKeyRange::~IDBKeyRange() = default;
+
+void IDBKeyRange::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBKeyRange);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-lower
+JS::Value IDBKeyRange::lower() const
+{
+    // The lower getter steps are to return the result of converting a key to a value with this's lower bound if it is
+    // not null, or undefined otherwise.
+    if (!m_range.lower_bound.has_value())
+        return JS::js_undefined();
+    return convert_a_key_to_a_value(realm(), *m_range.lower_bound);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-upper
+JS::Value IDBKeyRange::upper() const
+{
+    // The upper getter steps are to return the result of converting a key to a value with this's upper bound if it is
+    // not null, or undefined otherwise.
+    if (!m_range.upper_bound.has_value())
+        return JS::js_undefined();
+    return convert_a_key_to_a_value(realm(), *m_range.upper_bound);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-only
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> IDBKeyRange::only(JS::VM& vm, JS::Value value)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. Let key be the result of converting a value to a key with value. Rethrow any exceptions.
+    // 2. If key is invalid, throw a "DataError" DOMException.
+    auto key = TRY(convert_a_value_to_a_key_or_throw(realm, value));
+
+    // 3. Create and return a new key range containing only key.
+    return create(realm, KeyRange::only(move(key)));
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-lowerbound
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> IDBKeyRange::lower_bound(JS::VM& vm, JS::Value lower, bool open)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. Let lowerKey be the result of converting a value to a key with lower. Rethrow any exceptions.
+    // 2. If lowerKey is invalid, throw a "DataError" DOMException.
+    auto lower_key = TRY(convert_a_value_to_a_key_or_throw(realm, lower));
+
+    // 3. Create and return a new key range with lower bound set to lowerKey, lower open flag set to open, upper bound
+    //    set to null, and upper open flag set to true.
+    return create(realm, KeyRange { move(lower_key), {}, open, true });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-upperbound
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> IDBKeyRange::upper_bound(JS::VM& vm, JS::Value upper, bool open)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. Let upperKey be the result of converting a value to a key with upper. Rethrow any exceptions.
+    // 2. If upperKey is invalid, throw a "DataError" DOMException.
+    auto upper_key = TRY(convert_a_value_to_a_key_or_throw(realm, upper));
+
+    // 3. Create and return a new key range with lower bound set to null, lower open flag set to true, upper bound set
+    //    to upperKey, and upper open flag set to open.
+    return create(realm, KeyRange { {}, move(upper_key), true, open });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-bound
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> IDBKeyRange::bound(JS::VM& vm, JS::Value lower, JS::Value upper, bool lower_open, bool upper_open)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. Let lowerKey be the result of converting a value to a key with lower. Rethrow any exceptions.
+    // 2. If lowerKey is invalid, throw a "DataError" DOMException.
+    auto lower_key = TRY(convert_a_value_to_a_key_or_throw(realm, lower));
+
+    // 3. Let upperKey be the result of converting a value to a key with upper. Rethrow any exceptions.
+    // 4. If upperKey is invalid, throw a "DataError" DOMException.
+    auto upper_key = TRY(convert_a_value_to_a_key_or_throw(realm, upper));
+
+    // 5. If lowerKey is greater than upperKey, throw a "DataError" DOMException.
+    auto comparison = compare_two_keys(lower_key, upper_key);
+    if (comparison > 0)
+        return WebIDL::DataError::create(realm, "The lower key is greater than the upper key"_fly_string);
+
+    // NOTE: A range where both bounds are equal and either bound is open would be empty.
+    if (comparison == 0 && (lower_open || upper_open))
+        return WebIDL::DataError::create(realm, "The bounds are equal and one of them is open"_fly_string);
+
+    // 6. Create and return a new key range with lower bound set to lowerKey, lower open flag set to lowerOpen, upper
+    //    bound set to upperKey and upper open flag set to upperOpen.
+    return create(realm, KeyRange { move(lower_key), move(upper_key), lower_open, upper_open });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbkeyrange-includes
+WebIDL::ExceptionOr<bool> IDBKeyRange::includes(JS::Value key) const
+{
+    // 1. Let k be the result of converting a value to a key with key. Rethrow any exceptions.
+    // 2. If k is invalid, throw a "DataError" DOMException.
+    auto k = TRY(convert_a_value_to_a_key_or_throw(realm(), key));
+
+    // 3. Return true if k is in this range, and false otherwise.
+    return m_range.contains(k);
+}
+
+}
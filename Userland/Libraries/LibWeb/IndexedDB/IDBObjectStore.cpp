@@ -0,0 +1,901 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/IDBObjectStorePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBObjectStore);
+
+JS::NonnullGCPtr<IDBObjectStore> IDBObjectStore::create(JS::Realm& realm, ObjectStore& object_store, IDBTransaction& transaction)
+{
+    return realm.heap().allocate<IDBObjectStore>(realm, realm, object_store, transaction);
+}
+
+IDBObjectStore::IDBObjectStore(JS::Realm& realm, ObjectStore& object_store, IDBTransaction& transaction)
+    : Bindings::PlatformObject(realm)
+    , m_object_store(object_store)
+    , m_transaction(transaction)
+{
+}
+
+IDBObjectStore::~IDBObjectStore() = default;
+
+void IDBObjectStore::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBObjectStore);
+}
+
+void IDBObjectStore::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_transaction);
+    visitor.visit(m_key_path_value);
+    for (auto const& it : m_index_handles)
+        visitor.visit(it.value);
+}
+
+// https://w3c.github.io/IndexedDB/#clone-a-value
+WebIDL::ExceptionOr<JS::Value> clone_a_value_during_transaction(JS::Realm& target_realm, IDBTransaction& transaction, JS::Value value)
+{
+    auto& vm = target_realm.vm();
+
+    // 1. Assert: transaction’s state is active.
+    VERIFY(transaction.state() == IDBTransaction::State::Active);
+
+    // 2. Set transaction’s state to inactive.
+    // NOTE: The transaction is made inactive so that getters or other side effects triggered by the cloning
+    //       operation are unable to make additional requests against the transaction.
+    transaction.set_state(IDBTransaction::State::Inactive);
+
+    // 3. Let serialized be ? StructuredSerializeForStorage(value).
+    auto serialized = HTML::structured_serialize_for_storage(vm, value);
+
+    // 5. Set transaction’s state to active.
+    // NOTE: This is done before rethrowing any exception, so that the transaction stays usable.
+    transaction.set_state(IDBTransaction::State::Active);
+    if (serialized.is_error())
+        return serialized.release_error();
+
+    // 4. Let clone be ? StructuredDeserialize(serialized, targetRealm).
+    auto clone = TRY(HTML::structured_deserialize(vm, serialized.value(), target_realm, {}));
+
+    // 6. Return clone.
+    return clone;
+}
+
+// Records how to restore the record with the given key, the index records referencing it and the key generator when
+// the transaction is aborted.
+static void add_undo_step_for_record(IDBTransaction& transaction, ObjectStore& object_store, Key const& key, Optional<u64> key_generator_current_number)
+{
+    Optional<ObjectStore::Record> old_record;
+    if (auto const* record = object_store.record_with_key(key))
+        old_record = *record;
+
+    struct IndexRecords {
+        NonnullRefPtr<Index> index;
+        Vector<Index::Record> records;
+    };
+    Vector<IndexRecords> old_index_records;
+    for (auto const& it : object_store.indexes()) {
+        Vector<Index::Record> records;
+        for (auto const& record : it.value->records()) {
+            if (record.primary_key == key)
+                records.append(record);
+        }
+        old_index_records.append({ it.value, move(records) });
+    }
+
+    transaction.add_undo_step([object_store = NonnullRefPtr { object_store }, key, old_record = move(old_record), old_index_records = move(old_index_records), key_generator_current_number]() mutable {
+        object_store->set_key_generator_current_number(key_generator_current_number);
+
+        object_store->remove_record(key);
+        if (old_record.has_value())
+            object_store->store_record(old_record->key, old_record->value);
+
+        for (auto& [index, records] : old_index_records) {
+            index->remove_records_referencing(key);
+            for (auto& record : records)
+                index->add_record(move(record.key), move(record.primary_key));
+        }
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#store-a-record-into-an-object-store
+WebIDL::ExceptionOr<JS::Value> store_a_record_into_an_object_store(JS::Realm& realm, IDBTransaction& transaction, ObjectStore& store, JS::Value value, Optional<Key> key, bool no_overwrite)
+{
+    // 1. If store uses a key generator, then:
+    auto key_generator_current_number = store.key_generator_current_number();
+    if (store.has_key_generator()) {
+        // 1. If key is undefined, then:
+        if (!key.has_value()) {
+            // 1. Let key be the result of generating a key for store.
+            key = store.generate_a_key();
+
+            // 2. If key is failure, then this operation failed with a "ConstraintError" DOMException. Abort this
+            //    algorithm without taking any further steps.
+            if (!key.has_value())
+                return WebIDL::ConstraintError::create(realm, "The key generator has reached its maximum value"_fly_string);
+
+            // 3. If store also uses in-line keys, then run inject a key into a value using a key path with value, key
+            //    and store’s key path.
+            if (store.uses_in_line_keys())
+                inject_a_key_into_a_value_using_a_key_path(realm, value, *key, store.key_path()->get<String>());
+        }
+        // 2. Otherwise, run possibly update the key generator for store with key.
+        else {
+            store.possibly_update_the_key_generator(*key);
+        }
+    }
+
+    // NOTE: Any changes to the key generator are reverted if this operation fails.
+    auto fail = [&](JS::NonnullGCPtr<WebIDL::DOMException> error) -> WebIDL::ExceptionOr<JS::Value> {
+        store.set_key_generator_current_number(key_generator_current_number);
+        return error;
+    };
+
+    // 2. If the no-overwrite flag was given to these steps and is true, and a record already exists in store with its
+    //    key equal to key, then this operation failed with a "ConstraintError" DOMException. Abort this algorithm
+    //    without taking any further steps.
+    if (no_overwrite && store.record_with_key(*key))
+        return fail(WebIDL::ConstraintError::create(realm, "A record with the given key already exists"_fly_string));
+
+    // NOTE: The index keys of the new record are determined, and the unique constraints of the indexes checked, before
+    //       any changes are made, so that a failed operation leaves the object store untouched.
+    struct IndexKeys {
+        NonnullRefPtr<Index> index;
+        Vector<Key> keys;
+    };
+    Vector<IndexKeys> index_keys;
+
+    // 5. For each index which references store:
+    for (auto const& it : store.indexes()) {
+        auto const& index = it.value;
+
+        // 1. Let index key be the result of extracting a key from a value using a key path with value, index’s key
+        //    path, and index’s multiEntry flag.
+        auto index_key = extract_a_key_from_a_value_using_a_key_path(realm, value, index->key_path(), index->multi_entry());
+
+        // 2. If index key is an exception, or invalid, or failure, take no further actions for index.
+        if (index_key.is_exception() || index_key.value().is_error())
+            continue;
+        auto key_for_index = index_key.release_value().release_value();
+
+        Vector<Key> keys;
+
+        // 3. If index’s multiEntry flag is false, or if index key is not an array key, and if index already contains a
+        //    record with key equal to index key, and index’s unique flag is true, then this operation failed with a
+        //    "ConstraintError" DOMException.
+        // 5. If index’s multiEntry flag is true and index key is an array key, then for each subkey of the subkeys of
+        //    index key, if index already contains a record with key equal to subkey, and index’s unique flag is true,
+        //    then this operation failed with a "ConstraintError" DOMException.
+        if (index->multi_entry() && key_for_index.type() == Key::Type::Array)
+            keys = key_for_index.array();
+        else
+            keys.append(move(key_for_index));
+
+        if (index->unique()) {
+            for (auto const& index_key : keys) {
+                // NOTE: A record being replaced does not conflict with itself.
+                auto position = index->lower_bound_for_key(index_key, true);
+                for (; position < index->records().size() && index->records()[position].key == index_key; ++position) {
+                    if (!(index->records()[position].primary_key == *key))
+                        return fail(WebIDL::ConstraintError::create(realm, MUST(String::formatted("A record in the index '{}' already has the given key", index->name()))));
+                }
+            }
+        }
+
+        index_keys.append({ index, move(keys) });
+    }
+
+    auto serialized = HTML::structured_serialize_for_storage(realm.vm(), value);
+    if (serialized.is_error()) {
+        store.set_key_generator_current_number(key_generator_current_number);
+        return serialized.release_error();
+    }
+
+    add_undo_step_for_record(transaction, store, *key, key_generator_current_number);
+
+    // 3. If a record already exists in store with its key equal to key, then remove the record from store using
+    //    delete records from an object store.
+    // 4. Store a record in store containing key as its key and ! StructuredSerializeForStorage(value) as its value.
+    //    The record is stored in the object store’s list of records such that the list is sorted according to the key
+    //    of the records in ascending order.
+    for (auto const& it : store.indexes())
+        it.value->remove_records_referencing(*key);
+    store.store_record(*key, serialized.release_value());
+
+    // 5.4, 5.6. Store a record in index containing index key (or each subkey) as its key and key as its value.
+    for (auto& [index, keys] : index_keys) {
+        for (auto& index_key : keys) {
+            // NOTE: Duplicate subkeys of an array key only produce a single record.
+            bool already_added = false;
+            auto position = index->lower_bound(index_key, *key);
+            if (position < index->records().size()) {
+                auto const& record = index->records()[position];
+                already_added = record.key == index_key && record.primary_key == *key;
+            }
+            if (!already_added)
+                index->add_record(move(index_key), *key);
+        }
+    }
+
+    // 6. Return key.
+    return convert_a_key_to_a_value(realm, *key);
+}
+
+// https://w3c.github.io/IndexedDB/#delete-records-from-an-object-store
+JS::Value delete_records_from_an_object_store(IDBTransaction& transaction, ObjectStore& store, KeyRange const& range)
+{
+    // 1. Remove all records, if any, from store’s list of records with key in range.
+    // 2. For each index which references store, remove every record from index’s list of records whose value is in
+    //    range, if any such records exist.
+    Vector<Key> keys_to_remove;
+    for (auto position = store.lower_bound(range); position < store.records().size(); ++position) {
+        auto const& record = store.records()[position];
+        if (!range.contains(record.key))
+            break;
+        keys_to_remove.append(record.key);
+    }
+
+    for (auto const& key : keys_to_remove) {
+        add_undo_step_for_record(transaction, store, key, store.key_generator_current_number());
+        store.remove_record(key);
+        for (auto const& it : store.indexes())
+            it.value->remove_records_referencing(key);
+    }
+
+    // 3. Return undefined.
+    return JS::js_undefined();
+}
+
+// https://w3c.github.io/IndexedDB/#clear-an-object-store
+static JS::Value clear_an_object_store(IDBTransaction& transaction, ObjectStore& store)
+{
+    // 1. Remove all records from store.
+    // 2. In all indexes which reference store, remove all records.
+    auto records = store.take_records();
+
+    struct IndexRecords {
+        NonnullRefPtr<Index> index;
+        Vector<Index::Record> records;
+    };
+    Vector<IndexRecords> index_records;
+    for (auto const& it : store.indexes()) {
+        index_records.append({ it.value, it.value->records() });
+        it.value->clear();
+    }
+
+    transaction.add_undo_step([store = NonnullRefPtr { store }, records = move(records), index_records = move(index_records)]() mutable {
+        store->restore_records(move(records));
+        for (auto& [index, records] : index_records) {
+            for (auto& record : records)
+                index->add_record(move(record.key), move(record.primary_key));
+        }
+    });
+
+    // 3. Return undefined.
+    return JS::js_undefined();
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-name
+WebIDL::ExceptionOr<void> IDBObjectStore::set_name(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let name be the given value.
+    // 2. Let transaction be this's transaction.
+    // 3. Let store be this's object store.
+    auto& store = *m_object_store;
+
+    // 4. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (store.is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 5. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!m_transaction->is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Object stores can only be renamed during an upgrade"_fly_string);
+
+    // 6. If transaction’s state is not active, throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 7. If store’s name is equal to name, terminate these steps.
+    if (store.name() == name)
+        return {};
+
+    // 8. If an object store named name already exists in store’s database, throw a "ConstraintError" DOMException.
+    auto& database = store.database();
+    if (database.object_store(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An object store named '{}' already exists", name)));
+
+    // 9. Set store’s name to name.
+    // 10. Set this's name to name.
+    auto old_name = store.name();
+    database.rename_object_store(old_name, name);
+    m_transaction->add_undo_step([&database, old_name = move(old_name), name] {
+        database.rename_object_store(name, old_name);
+    });
+
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-keypath
+JS::Value IDBObjectStore::key_path()
+{
+    // The keyPath getter steps are to return this's object store's key path, or null if none. The key path is
+    // converted as a DOMString (if a string) or a sequence<DOMString> (if a list of strings), per [WEBIDL].
+    if (!m_object_store->key_path().has_value())
+        return JS::js_null();
+
+    if (m_key_path_value.is_empty())
+        m_key_path_value = key_path_to_value(realm(), *m_object_store->key_path());
+    return m_key_path_value;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-indexnames
+JS::NonnullGCPtr<HTML::DOMStringList> IDBObjectStore::index_names() const
+{
+    // 1. Let names be a list of the names of the indexes in this's index set.
+    Vector<String> names;
+    for (auto const& it : m_object_store->indexes())
+        names.append(it.key);
+
+    // 2. Return the result (a DOMStringList) of creating a sorted name list with names.
+    quick_sort(names);
+    return HTML::DOMStringList::create(realm(), move(names));
+}
+
+// Steps shared by the methods that make requests against an object store.
+WebIDL::ExceptionOr<void> IDBObjectStore::check_that_requests_can_be_made() const
+{
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (m_object_store->is_deleted())
+        return WebIDL::InvalidStateError::create(realm(), "The object store has been deleted"_fly_string);
+
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm(), "The transaction is not active"_fly_string);
+
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-put
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::put(JS::Value value, JS::Value key)
+{
+    // The put(value, key) method steps are to return the result of running add or put with this, value, key and the
+    // no-overwrite flag false.
+    return add_or_put(value, key, false);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-add
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::add(JS::Value value, JS::Value key)
+{
+    // The add(value, key) method steps are to return the result of running add or put with this, value, key and the
+    // no-overwrite flag true.
+    return add_or_put(value, key, true);
+}
+
+// https://w3c.github.io/IndexedDB/#add-or-put
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::add_or_put(JS::Value value, JS::Value key, bool no_overwrite)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be handle’s transaction.
+    // 2. Let store be handle’s object store.
+    auto& store = *m_object_store;
+
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (m_transaction->mode() == Bindings::IDBTransactionMode::Readonly)
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // NOTE: A key of undefined is treated as if no key was given.
+    bool key_was_given = !key.is_undefined();
+
+    // 6. If store uses in-line keys and key was given, throw a "DataError" DOMException.
+    if (store.uses_in_line_keys() && key_was_given)
+        return WebIDL::DataError::create(realm, "A key can not be given for an object store that uses in-line keys"_fly_string);
+
+    // 7. If store uses out-of-line keys and has no key generator and key was not given, throw a "DataError"
+    //    DOMException.
+    if (!store.uses_in_line_keys() && !store.has_key_generator() && !key_was_given)
+        return WebIDL::DataError::create(realm, "A key must be given for an object store that uses out-of-line keys"_fly_string);
+
+    // 8. If key was given, then:
+    Optional<Key> converted_key;
+    if (key_was_given) {
+        // 1. Let r be the result of converting a value to a key with key. Rethrow any exceptions.
+        // 2. If r is invalid, throw a "DataError" DOMException.
+        // 3. Let key be r.
+        converted_key = TRY(convert_a_value_to_a_key_or_throw(realm, key));
+    }
+
+    // 9. Let targetRealm be a user-agent defined Realm.
+    // 10. Let clone be a clone of value in targetRealm during transaction. Rethrow any exceptions.
+    auto clone = TRY(clone_a_value_during_transaction(realm, m_transaction, value));
+
+    // 11. If store uses in-line keys, then:
+    if (store.uses_in_line_keys()) {
+        // 1. Let kpk be the result of extracting a key from a value using a key path with clone and store’s key path.
+        //    Rethrow any exceptions.
+        auto kpk = TRY(extract_a_key_from_a_value_using_a_key_path(realm, clone, *store.key_path()));
+
+        // 2. If kpk is invalid, throw a "DataError" DOMException.
+        if (kpk.is_error() && kpk.error() == KeyExtractionFailure::InvalidKey)
+            return WebIDL::DataError::create(realm, "The key path did not yield a valid key"_fly_string);
+
+        // 3. If kpk is not failure, let key be kpk.
+        if (!kpk.is_error()) {
+            converted_key = kpk.release_value();
+        }
+        // 4. Otherwise (kpk is failure):
+        else {
+            // 1. If store does not have a key generator, throw a "DataError" DOMException.
+            if (!store.has_key_generator())
+                return WebIDL::DataError::create(realm, "The key path did not yield a key and the object store has no key generator"_fly_string);
+
+            // 2. Otherwise, if check that a key could be injected into a value with clone and store’s key path return
+            //    false, throw a "DataError" DOMException.
+            if (!check_that_a_key_could_be_injected_into_a_value(realm, clone, store.key_path()->get<String>()))
+                return WebIDL::DataError::create(realm, "A generated key could not be injected into the value"_fly_string);
+        }
+    }
+
+    // 12. Let operation be an algorithm to run store a record into an object store with store, clone, key, and
+    //     no-overwrite flag.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, transaction = m_transaction, store = m_object_store, clone, key = move(converted_key), no_overwrite]() -> WebIDL::ExceptionOr<JS::Value> {
+        return store_a_record_into_an_object_store(realm, transaction, store, clone, key, no_overwrite);
+    });
+
+    // 13. Return the result (an IDBRequest) of running asynchronously execute a request with handle and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-delete
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::delete_(JS::Value query)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (m_transaction->mode() == Bindings::IDBTransactionMode::Readonly)
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // 6. Let range be the result of converting a value to a key range with query and null disallowed flag true.
+    //    Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query, true));
+
+    // 7. Let operation be an algorithm to run delete records from an object store with store and range.
+    auto operation = JS::create_heap_function(realm.heap(), [transaction = m_transaction, store = m_object_store, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        return delete_records_from_an_object_store(transaction, store, range);
+    });
+
+    // 8. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-clear
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::clear()
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (m_transaction->mode() == Bindings::IDBTransactionMode::Readonly)
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // 6. Let operation be an algorithm to run clear an object store with store.
+    auto operation = JS::create_heap_function(realm.heap(), [transaction = m_transaction, store = m_object_store]() -> WebIDL::ExceptionOr<JS::Value> {
+        return clear_an_object_store(transaction, store);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-get
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get(JS::Value query)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query and null disallowed flag true.
+    //    Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query, true));
+
+    // 6. Let operation be an algorithm to run retrieve a value from an object store with the current Realm record,
+    //    store, and range.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, store = m_object_store, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-value-from-an-object-store
+        // 1. Let record be the first record in store’s list of records whose key is in range, if any.
+        auto position = store->lower_bound(range);
+        if (position >= store->records().size() || !range.contains(store->records()[position].key)) {
+            // 2. If record was not found, return undefined.
+            return JS::js_undefined();
+        }
+
+        // 3. Let serialized be record’s value.
+        // 4. Return ! StructuredDeserialize(serialized, targetRealm).
+        return MUST(HTML::structured_deserialize(realm.vm(), store->records()[position].value, realm, {}));
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-getkey
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get_key(JS::Value query)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query and null disallowed flag true.
+    //    Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query, true));
+
+    // 6. Let operation be an algorithm to run retrieve a key from an object store with store and range.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, store = m_object_store, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-key-from-an-object-store
+        // 1. Let record be the first record in store’s list of records whose key is in range, if any.
+        auto position = store->lower_bound(range);
+        if (position >= store->records().size() || !range.contains(store->records()[position].key)) {
+            // 2. If record was not found, return undefined.
+            return JS::js_undefined();
+        }
+
+        // 3. Return the result of converting a key to a value with record’s key.
+        return convert_a_key_to_a_value(realm, store->records()[position].key);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#retrieve-multiple-values-from-an-object-store
+// https://w3c.github.io/IndexedDB/#retrieve-multiple-keys-from-an-object-store
+static JS::Value retrieve_multiple_records_from_an_object_store(JS::Realm& realm, ObjectStore const& store, KeyRange const& range, Optional<WebIDL::UnsignedLong> count, bool keys_only)
+{
+    // 1. If count is not given or is 0 (zero), let count be infinity.
+    // 2. Let records be a list containing the first count records in store’s list of records whose key is in range.
+    // 3. Let list be an empty list.
+    // 4. For each record of records:
+    //    - Keys: Append the result of converting a key to a value with record’s key to list.
+    //    - Values: Let serialized be record’s value, and append ! StructuredDeserialize(serialized, targetRealm) to
+    //      list.
+    Vector<JS::Value> list;
+    for (auto position = store.lower_bound(range); position < store.records().size(); ++position) {
+        if (count.has_value() && *count != 0 && list.size() >= *count)
+            break;
+
+        auto const& record = store.records()[position];
+        if (!range.contains(record.key))
+            break;
+
+        if (keys_only)
+            list.append(convert_a_key_to_a_value(realm, record.key));
+        else
+            list.append(MUST(HTML::structured_deserialize(realm.vm(), record.value, realm, {})));
+    }
+
+    // 5. Return list converted to a sequence<any>.
+    return JS::Array::create_from(realm, list);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-getall
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query));
+
+    // 6. Let operation be an algorithm to run retrieve multiple values from an object store with the current Realm
+    //    record, store, range, and count if given.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, store = m_object_store, range = move(range), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        return retrieve_multiple_records_from_an_object_store(realm, store, range, count, false);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-getallkeys
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query));
+
+    // 6. Let operation be an algorithm to run retrieve multiple keys from an object store with store, range, and
+    //    count if given.
+    auto operation = JS::create_heap_function(realm.heap(), [&realm, store = m_object_store, range = move(range), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        return retrieve_multiple_records_from_an_object_store(realm, store, range, count, true);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-count
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::count(JS::Value query)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query));
+
+    // 6. Let operation be an algorithm to run count the records in a range with store and range.
+    auto operation = JS::create_heap_function(realm.heap(), [store = m_object_store, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#count-the-records-in-a-range
+        // 1. Let count be the number of records, if any, in source’s list of records with key in range.
+        size_t count = 0;
+        for (auto position = store->lower_bound(range); position < store->records().size() && range.contains(store->records()[position].key); ++position)
+            ++count;
+
+        // 2. Return count.
+        return JS::Value(count);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-opencursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::open_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, false);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-openkeycursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::open_key_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, true);
+}
+
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::open_a_cursor(JS::Value query, Bindings::IDBCursorDirection direction, bool key_only)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_that_requests_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm, query));
+
+    // 6. Let cursor be a new cursor with its transaction set to transaction, undefined position, direction set to
+    //    direction, got value flag set to false, undefined key and value, source set to store, range set to range,
+    //    and key only flag set to false (true for openKeyCursor()).
+    auto cursor = IDBCursor::create(realm, JS::NonnullGCPtr { *this }, m_transaction, direction, move(range), key_only);
+
+    // 7. Let operation be an algorithm to run iterate a cursor with the current Realm record and cursor.
+    auto operation = JS::create_heap_function(realm.heap(), [cursor]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate_a_cursor({}, {}, 1);
+    });
+
+    // 8. Let request be the result of running asynchronously execute a request with this and operation.
+    auto request = m_transaction->asynchronously_execute_a_request(JS::NonnullGCPtr { *this }, operation);
+
+    // 9. Set cursor’s request to request.
+    cursor->set_request(request);
+
+    // 10. Return request.
+    return request;
+}
+
+JS::NonnullGCPtr<IDBIndex> IDBObjectStore::index_handle(Index& index)
+{
+    // NOTE: Getting the same index twice from the same object store handle returns the same handle.
+    return m_index_handles.ensure(&index, [&] {
+        return IDBIndex::create(realm(), index, *this);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-index
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> IDBObjectStore::index(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (m_object_store->is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 4. If transaction’s state is finished, then throw an "InvalidStateError" DOMException.
+    if (m_transaction->state() == IDBTransaction::State::Finished)
+        return WebIDL::InvalidStateError::create(realm, "The transaction has finished"_fly_string);
+
+    // 5. Let index be the index named name in this's index set if one exists, or throw a "NotFoundError" DOMException
+    //    otherwise.
+    auto index = m_object_store->index(name);
+    if (!index)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No index named '{}' exists", name)));
+
+    // 6. Return an index handle associated with index and this.
+    return index_handle(*index);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-createindex
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> IDBObjectStore::create_index(String const& name, Variant<String, Vector<String>> const& key_path, IDBIndexParameters const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    auto& store = *m_object_store;
+
+    // 3. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!m_transaction->is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Indexes can only be created during an upgrade"_fly_string);
+
+    // 4. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (store.is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 5. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 6. If an index named name already exists in store, throw a "ConstraintError" DOMException.
+    if (store.index(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An index named '{}' already exists", name)));
+
+    // 7. If keyPath is not a valid key path, throw a "SyntaxError" DOMException.
+    if (!is_valid_key_path(key_path))
+        return WebIDL::SyntaxError::create(realm, "Invalid key path"_fly_string);
+
+    // 8. Let unique be options’s unique member.
+    // 9. Let multiEntry be options’s multiEntry member.
+    // 10. If keyPath is a sequence and multiEntry is true, throw an "InvalidAccessError" DOMException.
+    if (key_path.has<Vector<String>>() && options.multi_entry)
+        return WebIDL::InvalidAccessError::create(realm, "A multi-entry index can not have an array key path"_fly_string);
+
+    // 11. Let index be a new index in store. Set index’s name to name, key path to keyPath, unique flag to unique, and
+    //     multiEntry flag to multiEntry.
+    auto index = Index::create(store, name, key_path, options.unique, options.multi_entry);
+
+    // 12. Add index to this's index set.
+    store.add_index(index);
+    m_transaction->add_undo_step([store = m_object_store, index] {
+        index->set_deleted(true);
+        store->remove_index(index->name());
+    });
+
+    // The index is populated with the records of the object store. If this fails because of a violated unique
+    // constraint, the upgrade transaction is aborted with a "ConstraintError" DOMException.
+    // NOTE: The spec does this in parallel; we populate the in-memory index right away.
+    for (auto const& record : store.records()) {
+        auto value = MUST(HTML::structured_deserialize(realm.vm(), record.value, realm, {}));
+        auto index_key = extract_a_key_from_a_value_using_a_key_path(realm, value, index->key_path(), index->multi_entry());
+        if (index_key.is_exception() || index_key.value().is_error())
+            continue;
+        auto key = index_key.release_value().release_value();
+
+        Vector<Key> keys;
+        if (index->multi_entry() && key.type() == Key::Type::Array) {
+            for (auto const& subkey : key.array()) {
+                if (!keys.contains_slow(subkey))
+                    keys.append(subkey);
+            }
+        } else {
+            keys.append(move(key));
+        }
+
+        for (auto& key : keys) {
+            if (index->unique() && index->has_record_with_key(key)) {
+                index->clear();
+                HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, transaction = m_transaction] {
+                    transaction->abort_a_transaction(WebIDL::ConstraintError::create(realm, "The existing records violate the unique constraint of the index"_fly_string));
+                }));
+                return index_handle(*index);
+            }
+            index->add_record(move(key), record.key);
+        }
+    }
+
+    // 13. Return a new index handle associated with index and this.
+    return index_handle(*index);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-deleteindex
+WebIDL::ExceptionOr<void> IDBObjectStore::delete_index(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    auto& store = *m_object_store;
+
+    // 3. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!m_transaction->is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Indexes can only be deleted during an upgrade"_fly_string);
+
+    // 4. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (store.is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 5. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (m_transaction->state() != IDBTransaction::State::Active)
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 6. Let index be the index named name in store if one exists, or throw a "NotFoundError" DOMException otherwise.
+    auto index = store.index(name);
+    if (!index)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No index named '{}' exists", name)));
+
+    // 7. Remove index from this's index set.
+    // 8. Destroy index.
+    // NOTE: Handles check whether their index was deleted, so we only have to mark it as such.
+    index->set_deleted(true);
+    store.remove_index(name);
+    m_transaction->add_undo_step([store = m_object_store, index = index.release_nonnull()] {
+        index->set_deleted(false);
+        store->add_index(index);
+    });
+
+    return {};
+}
+
+}
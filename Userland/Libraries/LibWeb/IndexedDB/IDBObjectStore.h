@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#dictdef-idbindexparameters
+struct IDBIndexParameters {
+    bool unique { false };
+    bool multi_entry { false };
+};
+
+// https://w3c.github.io/IndexedDB/#object-store-handle-construct
+class IDBObjectStore final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBObjectStore, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBObjectStore);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBObjectStore> create(JS::Realm&, ObjectStore&, IDBTransaction&);
+
+    virtual ~IDBObjectStore() override;
+
+    String const& name() const { return m_object_store->name(); }
+    WebIDL::ExceptionOr<void> set_name(String const&);
+    JS::Value key_path();
+    JS::NonnullGCPtr<HTML::DOMStringList> index_names() const;
+    JS::NonnullGCPtr<IDBTransaction> transaction() const { return m_transaction; }
+    bool auto_increment() const { return m_object_store->has_key_generator(); }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> put(JS::Value value, JS::Value key);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> add(JS::Value value, JS::Value key);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> delete_(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> clear();
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_key(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> count(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_cursor(JS::Value query, Bindings::IDBCursorDirection);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_key_cursor(JS::Value query, Bindings::IDBCursorDirection);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> index(String const& name);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> create_index(String const& name, Variant<String, Vector<String>> const& key_path, IDBIndexParameters const&);
+    WebIDL::ExceptionOr<void> delete_index(String const& name);
+
+    ObjectStore& object_store() const { return m_object_store; }
+
+private:
+    IDBObjectStore(JS::Realm&, ObjectStore&, IDBTransaction&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    WebIDL::ExceptionOr<void> check_that_requests_can_be_made() const;
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> add_or_put(JS::Value value, JS::Value key, bool no_overwrite);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_a_cursor(JS::Value query, Bindings::IDBCursorDirection, bool key_only);
+
+    JS::NonnullGCPtr<IDBIndex> index_handle(Index&);
+
+    NonnullRefPtr<ObjectStore> m_object_store;
+    JS::NonnullGCPtr<IDBTransaction> m_transaction;
+
+    // NOTE: The key path is converted to a value once, so the same array is returned every time.
+    JS::Value m_key_path_value;
+
+    HashMap<Index const*, JS::NonnullGCPtr<IDBIndex>> m_index_handles;
+};
+
+// https://w3c.github.io/IndexedDB/#clone-a-value
+WebIDL::ExceptionOr<JS::Value> clone_a_value_during_transaction(JS::Realm&, IDBTransaction&, JS::Value);
+
+// https://w3c.github.io/IndexedDB/#store-a-record-into-an-object-store
+WebIDL::ExceptionOr<JS::Value> store_a_record_into_an_object_store(JS::Realm&, IDBTransaction&, ObjectStore&, JS::Value value, Optional<Key> key, bool no_overwrite);
+
+// https://w3c.github.io/IndexedDB/#delete-records-from-an-object-store
+JS::Value delete_records_from_an_object_store(IDBTransaction&, ObjectStore&, KeyRange const&);
+
+}
@@ -14,6 +14,11 @@ namespace Web::IndexedDB {
 
 JS_DEFINE_ALLOCATOR(IDBOpenDBRequest);
 
+JS::NonnullGCPtr<IDBOpenDBRequest> IDBOpenDBRequest::create(JS::Realm& realm)
+{
+    return realm.heap().allocate<IDBOpenDBRequest>(realm, realm);
+}
+
 IDBOpenDBRequest::~IDBOpenDBRequest() = default;
 
 IDBOpenDBRequest::IDBOpenDBRequest(JS::Realm& realm)
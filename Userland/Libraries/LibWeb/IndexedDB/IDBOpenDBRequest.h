@@ -17,6 +17,8 @@ class IDBOpenDBRequest : public IDBRequest {
     JS_DECLARE_ALLOCATOR(IDBOpenDBRequest);
 
 public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBOpenDBRequest> create(JS::Realm&);
+
     virtual ~IDBOpenDBRequest();
 
     void set_onblocked(WebIDL::CallbackType*);
@@ -28,6 +30,11 @@ protected:
     explicit IDBOpenDBRequest(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
+
+private:
+    // https://w3c.github.io/IndexedDB/#open-request
+    // The get the parent algorithm for an open request returns null.
+    virtual EventTarget* get_parent(DOM::Event const&) override { return nullptr; }
 };
 
 }
@@ -8,16 +8,26 @@
 #include <LibWeb/Bindings/IDBRequestPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
 #include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
 
 namespace Web::IndexedDB {
 
 JS_DEFINE_ALLOCATOR(IDBRequest);
 
+JS::NonnullGCPtr<IDBRequest> IDBRequest::create(JS::Realm& realm, IDBRequestSource source)
+{
+    return realm.heap().allocate<IDBRequest>(realm, realm, move(source));
+}
+
 IDBRequest::~IDBRequest() = default;
 
-IDBRequest::IDBRequest(JS::Realm& realm)
+IDBRequest::IDBRequest(JS::Realm& realm, IDBRequestSource source)
     : EventTarget(realm)
+    , m_source(move(source))
 {
 }
 
@@ -27,6 +37,68 @@ void IDBRequest::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBRequest);
 }
 
+void IDBRequest::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    m_source.visit(
+        [](Empty) {},
+        [&](auto const& source) { visitor.visit(source); });
+    visitor.visit(m_transaction);
+    visitor.visit(m_result);
+    visitor.visit(m_error);
+}
+
+// https://w3c.github.io/IndexedDB/#request-construct
+DOM::EventTarget* IDBRequest::get_parent(DOM::Event const&)
+{
+    // The get the parent algorithm for a request returns the request’s transaction.
+    return m_transaction;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-result
+WebIDL::ExceptionOr<JS::Value> IDBRequest::result() const
+{
+    // 1. If this's done flag is false, then throw an "InvalidStateError" DOMException.
+    if (!m_done)
+        return WebIDL::InvalidStateError::create(realm(), "The request has not finished yet"_fly_string);
+
+    // 2. Otherwise, return this's result, or undefined if the request resulted in an error.
+    if (m_error)
+        return JS::js_undefined();
+    return m_result;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-error
+WebIDL::ExceptionOr<JS::GCPtr<WebIDL::DOMException>> IDBRequest::error() const
+{
+    // 1. If this's done flag is false, then throw an "InvalidStateError" DOMException.
+    if (!m_done)
+        return WebIDL::InvalidStateError::create(realm(), "The request has not finished yet"_fly_string);
+
+    // 2. Otherwise, return this's error, or null if no error occurred.
+    return m_error;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-source
+Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>, JS::Handle<IDBCursor>, Empty> IDBRequest::source() const
+{
+    // The source getter steps are to return this's source, or null if no source is set.
+    return m_source.visit(
+        [](Empty) -> Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>, JS::Handle<IDBCursor>, Empty> {
+            return Empty {};
+        },
+        [](auto const& source) -> Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>, JS::Handle<IDBCursor>, Empty> {
+            return JS::make_handle(*source);
+        });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-readystate
+Bindings::IDBRequestReadyState IDBRequest::ready_state() const
+{
+    // The readyState getter steps are to return "pending" if this's done flag is false, and "done" otherwise.
+    return m_done ? Bindings::IDBRequestReadyState::Done : Bindings::IDBRequestReadyState::Pending;
+}
+
 // https://w3c.github.io/IndexedDB/#dom-idbrequest-onsuccess
 void IDBRequest::set_onsuccess(WebIDL::CallbackType* event_handler)
 {
@@ -7,26 +7,68 @@
 
 #pragma once
 
+#include <LibWeb/Bindings/IDBRequestPrototype.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::IndexedDB {
 
+// https://w3c.github.io/IndexedDB/#request-source
+using IDBRequestSource = Variant<Empty, JS::NonnullGCPtr<IDBObjectStore>, JS::NonnullGCPtr<IDBIndex>, JS::NonnullGCPtr<IDBCursor>>;
+
+// https://w3c.github.io/IndexedDB/#idbrequest
 class IDBRequest : public DOM::EventTarget {
     WEB_PLATFORM_OBJECT(IDBRequest, DOM::EventTarget);
     JS_DECLARE_ALLOCATOR(IDBRequest);
 
 public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBRequest> create(JS::Realm&, IDBRequestSource);
+
     virtual ~IDBRequest() override;
 
+    WebIDL::ExceptionOr<JS::Value> result() const;
+    WebIDL::ExceptionOr<JS::GCPtr<WebIDL::DOMException>> error() const;
+    Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>, JS::Handle<IDBCursor>, Empty> source() const;
+    JS::GCPtr<IDBTransaction> transaction() const { return m_transaction; }
+    Bindings::IDBRequestReadyState ready_state() const;
+
     void set_onsuccess(WebIDL::CallbackType*);
     WebIDL::CallbackType* onsuccess();
     void set_onerror(WebIDL::CallbackType*);
     WebIDL::CallbackType* onerror();
 
+    IDBRequestSource const& internal_source() const { return m_source; }
+
+    void set_transaction(JS::GCPtr<IDBTransaction> transaction) { m_transaction = transaction; }
+
+    // https://w3c.github.io/IndexedDB/#request-processed-flag
+    bool is_processed() const { return m_processed; }
+    void set_processed(bool processed) { m_processed = processed; }
+
+    // https://w3c.github.io/IndexedDB/#request-done-flag
+    bool is_done() const { return m_done; }
+    void set_done(bool done) { m_done = done; }
+
+    void set_result(JS::Value result) { m_result = result; }
+    void set_error(JS::GCPtr<WebIDL::DOMException> error) { m_error = error; }
+
 protected:
-    explicit IDBRequest(JS::Realm&);
+    explicit IDBRequest(JS::Realm&, IDBRequestSource = {});
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+private:
+    virtual EventTarget* get_parent(DOM::Event const&) override;
+
+    IDBRequestSource m_source;
+    JS::GCPtr<IDBTransaction> m_transaction;
+
+    bool m_processed { false };
+    bool m_done { false };
+
+    JS::Value m_result;
+    JS::GCPtr<WebIDL::DOMException> m_error;
 };
 
 }
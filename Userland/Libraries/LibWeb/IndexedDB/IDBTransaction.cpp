@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibWeb/Bindings/IDBTransactionPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBOpenDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBTransaction);
+
+// Transactions whose cleanup event loop is set, which become inactive at the next microtask checkpoint.
+static Vector<JS::Handle<IDBTransaction>>& transactions_to_clean_up()
+{
+    static Vector<JS::Handle<IDBTransaction>> transactions;
+    return transactions;
+}
+
+JS::NonnullGCPtr<IDBTransaction> IDBTransaction::create(JS::Realm& realm, IDBDatabase& connection, Bindings::IDBTransactionMode mode, Bindings::IDBTransactionDurability durability, Vector<NonnullRefPtr<ObjectStore>> scope)
+{
+    auto transaction = realm.heap().allocate<IDBTransaction>(realm, realm, connection, mode, durability, move(scope));
+    connection.transaction_was_created(transaction);
+    return transaction;
+}
+
+IDBTransaction::IDBTransaction(JS::Realm& realm, IDBDatabase& connection, Bindings::IDBTransactionMode mode, Bindings::IDBTransactionDurability durability, Vector<NonnullRefPtr<ObjectStore>> scope)
+    : EventTarget(realm)
+    , m_connection(connection)
+    , m_mode(mode)
+    , m_durability(durability)
+    , m_scope(move(scope))
+{
+}
+
+IDBTransaction::~IDBTransaction() = default;
+
+void IDBTransaction::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBTransaction);
+}
+
+void IDBTransaction::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_connection);
+    visitor.visit(m_error);
+    for (auto const& pending_request : m_request_list) {
+        visitor.visit(pending_request.request);
+        visitor.visit(pending_request.operation);
+    }
+    for (auto const& it : m_object_store_handles)
+        visitor.visit(it.value);
+    visitor.visit(m_cleanup_event_loop);
+    visitor.visit(m_open_request);
+    visitor.visit(m_on_finished);
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-construct
+DOM::EventTarget* IDBTransaction::get_parent(DOM::Event const&)
+{
+    // The get the parent algorithm for a transaction returns the transaction’s connection.
+    return m_connection;
+}
+
+static JS::NonnullGCPtr<WebIDL::DOMException> exception_to_dom_exception(JS::Realm& realm, WebIDL::Exception exception)
+{
+    return exception.visit(
+        [&](WebIDL::SimpleException const& simple_exception) -> JS::NonnullGCPtr<WebIDL::DOMException> {
+            auto message = simple_exception.message.visit(
+                [](String const& message) { return message; },
+                [](StringView message) { return MUST(String::from_utf8(message)); });
+            return WebIDL::UnknownError::create(realm, FlyString { message });
+        },
+        [](JS::NonnullGCPtr<WebIDL::DOMException> const& dom_exception) {
+            return dom_exception;
+        },
+        [&](JS::Completion const& completion) -> JS::NonnullGCPtr<WebIDL::DOMException> {
+            auto value = completion.value();
+            if (value.has_value() && value->is_object() && is<WebIDL::DOMException>(value->as_object()))
+                return static_cast<WebIDL::DOMException&>(value->as_object());
+            return WebIDL::UnknownError::create(realm, "An unknown error occurred"_fly_string);
+        });
+}
+
+// https://w3c.github.io/IndexedDB/#fire-a-success-event
+static void fire_a_success_event(JS::Realm& realm, IDBRequest& request)
+{
+    // 1. Let event be the result of creating an event using Event.
+    // 2. Set event’s type attribute to "success".
+    // 3. Set event’s bubbles and cancelable attributes to false.
+    auto event = DOM::Event::create(realm, HTML::EventNames::success);
+
+    // 4. Let transaction be request’s transaction.
+    auto transaction = request.transaction();
+    VERIFY(transaction);
+
+    // 5. Let legacyOutputDidListenersThrowFlag be initially false.
+    // FIXME: Our event dispatcher does not support legacyOutputDidListenersThrowFlag yet.
+
+    // 6. If transaction’s state is inactive, then set transaction’s state to active.
+    if (transaction->state() == IDBTransaction::State::Inactive)
+        transaction->set_state(IDBTransaction::State::Active);
+
+    // 7. Dispatch event at request with legacyOutputDidListenersThrowFlag.
+    request.dispatch_event(event);
+
+    // 8. If transaction’s state is active, then:
+    if (transaction->state() == IDBTransaction::State::Active) {
+        // 1. Set transaction’s state to inactive.
+        transaction->set_state(IDBTransaction::State::Inactive);
+
+        // 2. If legacyOutputDidListenersThrowFlag is true, then run abort a transaction with transaction and a newly
+        //    created "AbortError" DOMException.
+
+        // 3. If transaction’s request list is empty, then run commit a transaction with transaction.
+        transaction->commit_if_all_requests_were_processed();
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#fire-an-error-event
+static void fire_an_error_event(JS::Realm& realm, IDBRequest& request)
+{
+    // 1. Let event be the result of creating an event using Event.
+    // 2. Set event’s type attribute to "error".
+    // 3. Set event’s bubbles and cancelable attributes to true.
+    auto event = DOM::Event::create(realm, HTML::EventNames::error);
+    event->set_bubbles(true);
+    event->set_cancelable(true);
+
+    // 4. Let transaction be request’s transaction.
+    auto transaction = request.transaction();
+    VERIFY(transaction);
+
+    // 5. Let legacyOutputDidListenersThrowFlag be initially false.
+    // FIXME: Our event dispatcher does not support legacyOutputDidListenersThrowFlag yet.
+
+    // 6. If transaction’s state is inactive, then set transaction’s state to active.
+    if (transaction->state() == IDBTransaction::State::Inactive)
+        transaction->set_state(IDBTransaction::State::Active);
+
+    // 7. Dispatch event at request with legacyOutputDidListenersThrowFlag.
+    request.dispatch_event(event);
+
+    // 8. If transaction’s state is active, then:
+    if (transaction->state() == IDBTransaction::State::Active) {
+        // 1. Set transaction’s state to inactive.
+        transaction->set_state(IDBTransaction::State::Inactive);
+
+        // 2. If legacyOutputDidListenersThrowFlag is true, then run abort a transaction with transaction and a newly
+        //    created "AbortError" DOMException and terminate these steps. This is done even if event’s canceled flag
+        //    is false.
+
+        // 3. If event’s canceled flag is false, then run abort a transaction using transaction and request's error,
+        //    and terminate these steps.
+        if (!event->cancelled()) {
+            transaction->abort_a_transaction(MUST(request.error()));
+            return;
+        }
+
+        // 4. If transaction’s request list is empty, then run commit a transaction with transaction.
+        transaction->commit_if_all_requests_were_processed();
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-objectstorenames
+JS::NonnullGCPtr<HTML::DOMStringList> IDBTransaction::object_store_names() const
+{
+    // 1. Let names be a list of the names of the object stores in this's scope.
+    // NOTE: The scope of an upgrade transaction is every object store in the database.
+    Vector<String> names;
+    if (is_upgrade_transaction()) {
+        names = m_connection->database().object_store_names();
+    } else {
+        for (auto const& object_store : m_scope)
+            names.append(object_store->name());
+
+        // 2. Return the result (a DOMStringList) of creating a sorted name list with names.
+        quick_sort(names);
+    }
+
+    return HTML::DOMStringList::create(realm(), move(names));
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-objectstore
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> IDBTransaction::object_store(String const& name)
+{
+    // 1. If this's state is finished, then throw an "InvalidStateError" DOMException.
+    if (m_state == State::Finished)
+        return WebIDL::InvalidStateError::create(realm(), "The transaction has finished"_fly_string);
+
+    // 2. Let store be the object store named name in this's scope, or throw a "NotFoundError" DOMException if none.
+    RefPtr<ObjectStore> store;
+    if (is_upgrade_transaction()) {
+        store = m_connection->database().object_store(name);
+    } else {
+        for (auto const& object_store : m_scope) {
+            if (object_store->name() == name) {
+                store = object_store;
+                break;
+            }
+        }
+    }
+    if (!store)
+        return WebIDL::NotFoundError::create(realm(), "No object store with that name is in the scope of this transaction"_fly_string);
+
+    // 3. Return an object store handle associated with store and this.
+    return object_store_handle(*store);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-commit
+WebIDL::ExceptionOr<void> IDBTransaction::commit()
+{
+    // 1. If this's state is not active, then throw an "InvalidStateError" DOMException.
+    if (m_state != State::Active)
+        return WebIDL::InvalidStateError::create(realm(), "The transaction is not active"_fly_string);
+
+    // 2. Run commit a transaction with this.
+    commit_a_transaction();
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-abort
+WebIDL::ExceptionOr<void> IDBTransaction::abort()
+{
+    // 1. If this's state is committing or finished, then throw an "InvalidStateError" DOMException.
+    if (m_state == State::Committing || m_state == State::Finished)
+        return WebIDL::InvalidStateError::create(realm(), "The transaction has already been committed or aborted"_fly_string);
+
+    // 2. Set this's state to inactive and run abort a transaction with this and null.
+    m_state = State::Inactive;
+    abort_a_transaction(nullptr);
+    return {};
+}
+
+void IDBTransaction::add_to_scope(NonnullRefPtr<ObjectStore> object_store)
+{
+    m_scope.append(move(object_store));
+}
+
+JS::NonnullGCPtr<IDBObjectStore> IDBTransaction::object_store_handle(ObjectStore& object_store)
+{
+    // NOTE: Each object store handle is associated with a single transaction, and getting the same object store twice
+    //       from the same transaction returns the same handle.
+    return m_object_store_handles.ensure(&object_store, [&] {
+        return IDBObjectStore::create(realm(), object_store, *this);
+    });
+}
+
+void IDBTransaction::add_undo_step(Function<void()> step)
+{
+    m_undo_steps.append(move(step));
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-start
+void IDBTransaction::start()
+{
+    VERIFY(!m_started);
+    m_started = true;
+
+    process_next_request();
+    commit_if_all_requests_were_processed();
+}
+
+// https://w3c.github.io/IndexedDB/#asynchronously-execute-a-request
+JS::NonnullGCPtr<IDBRequest> IDBTransaction::asynchronously_execute_a_request(IDBRequestSource source, JS::NonnullGCPtr<Operation> operation, JS::GCPtr<IDBRequest> request)
+{
+    // 1. Let transaction be the transaction associated with source.
+    // 2. Assert: transaction’s state is active.
+    VERIFY(m_state == State::Active);
+
+    // 3. If request was not given, let request be a new request with source as source.
+    if (!request) {
+        request = IDBRequest::create(realm(), move(source));
+        request->set_transaction(this);
+    }
+
+    // 4. Add request to the end of transaction’s request list.
+    m_request_list.append({ *request, operation });
+
+    // 5. Run these steps in parallel:
+    process_next_request();
+
+    // 6. Return request.
+    return *request;
+}
+
+void IDBTransaction::process_next_request()
+{
+    // 1. Wait until request is the first item in transaction’s request list that is not processed.
+    // NOTE: Requests are processed one at a time, in order, once the transaction has been started.
+    if (!m_started || m_processing_request || m_state == State::Finished)
+        return;
+
+    if (m_request_list.is_empty()) {
+        finish_commit_if_possible();
+        return;
+    }
+
+    m_processing_request = true;
+
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm().global_object(), JS::create_heap_function(heap(), [this] {
+        m_processing_request = false;
+
+        // NOTE: If the transaction was aborted in the meantime, its requests have already been given an error.
+        if (m_state == State::Finished)
+            return;
+
+        auto& realm = this->realm();
+        auto pending_request = m_request_list.first();
+        auto request = pending_request.request;
+
+        // 2. Let result be the result of performing operation.
+        auto result = pending_request.operation->function()();
+
+        // 3. If result is an error and transaction’s state is committing, then run abort a transaction with
+        //    transaction and result, and terminate these steps.
+        if (result.is_error() && m_state == State::Committing) {
+            abort_a_transaction(exception_to_dom_exception(realm, result.release_error()));
+            return;
+        }
+
+        // 4. If result is an error, then revert all changes made by operation.
+        // NOTE: Our operations check for errors before making any changes.
+
+        // 5. Set request’s processed flag to true.
+        request->set_processed(true);
+
+        // 6. Queue a database task to run these steps:
+        // 1. Remove request from transaction’s request list.
+        m_request_list.take_first();
+
+        // 2. Set request’s done flag to true.
+        request->set_done(true);
+
+        // 3. If result is an error, then:
+        if (result.is_error()) {
+            // 1. Set request’s result to undefined.
+            request->set_result(JS::js_undefined());
+
+            // 2. Set request’s error to result.
+            request->set_error(exception_to_dom_exception(realm, result.release_error()));
+
+            // 3. Fire an error event at request.
+            fire_an_error_event(realm, request);
+        }
+        // 4. Otherwise:
+        else {
+            // 1. Set request’s result to result.
+            request->set_result(result.release_value());
+
+            // 2. Set request’s error to undefined.
+            request->set_error(nullptr);
+
+            // 3. Fire a success event at request.
+            fire_a_success_event(realm, request);
+        }
+
+        process_next_request();
+    }));
+}
+
+void IDBTransaction::commit_if_all_requests_were_processed()
+{
+    // The implementation must attempt to commit an inactive transaction when all requests placed against the
+    // transaction have completed and their returned results handled, no new requests have been placed against the
+    // transaction, and the transaction has not been aborted.
+    if (m_started && m_state == State::Inactive && m_request_list.is_empty() && !m_processing_request)
+        commit_a_transaction();
+}
+
+// https://w3c.github.io/IndexedDB/#commit-a-transaction
+void IDBTransaction::commit_a_transaction()
+{
+    // 1. Set transaction’s state to committing.
+    m_state = State::Committing;
+
+    // 2. Run the following steps in parallel:
+    finish_commit_if_possible();
+}
+
+void IDBTransaction::finish_commit_if_possible()
+{
+    // 1. Wait until every item in transaction’s request list is processed.
+    if (!m_started || m_state != State::Committing || !m_request_list.is_empty() || m_processing_request)
+        return;
+
+    // 2. If transaction’s state is no longer committing, then terminate these steps.
+    // 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s
+    //    durability hint.
+    // NOTE: Changes are made to the in-memory database directly, so there is nothing left to write.
+
+    // 5. Queue a database task to run these steps:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm().global_object(), JS::create_heap_function(heap(), [this] {
+        // NOTE: The transaction may have been aborted by the time this task runs.
+        if (m_state != State::Committing)
+            return;
+
+        // 1. If transaction is an upgrade transaction, then set transaction’s connection's associated database's
+        //    upgrade transaction to null.
+        if (is_upgrade_transaction())
+            m_connection->set_upgrade_transaction(nullptr);
+
+        // 2. Set transaction’s state to finished.
+        m_state = State::Finished;
+        m_undo_steps.clear();
+
+        // 3. Fire an event named complete at transaction.
+        dispatch_event(DOM::Event::create(realm(), HTML::EventNames::complete));
+
+        // 4. If transaction is an upgrade transaction, then let request be the request associated with transaction
+        //    and set request’s transaction to null.
+        if (is_upgrade_transaction() && m_open_request)
+            m_open_request->set_transaction(nullptr);
+
+        did_finish();
+    }));
+}
+
+// https://w3c.github.io/IndexedDB/#abort-a-transaction
+void IDBTransaction::abort_a_transaction(JS::GCPtr<WebIDL::DOMException> error)
+{
+    if (m_state == State::Finished)
+        return;
+
+    auto& realm = this->realm();
+
+    // 1. All the changes made to the database by the transaction are reverted. For upgrade transactions this includes
+    //    changes to the set of object stores and indexes, as well as the change to the version. Any object stores and
+    //    indexes which were created during the transaction are now considered deleted for the purposes of other
+    //    algorithms.
+    while (!m_undo_steps.is_empty())
+        m_undo_steps.take_last()();
+
+    // 2. If transaction is an upgrade transaction, run the steps to abort an upgrade transaction with transaction.
+    // NOTE: The connection's version and object store set are reverted by the undo steps above.
+
+    // 3. Set transaction’s state to finished.
+    m_state = State::Finished;
+
+    // 4. If error is not null, set transaction’s error to error.
+    if (error)
+        m_error = error;
+
+    // 5. For each request of transaction’s request list, abort the steps to asynchronously execute a request for
+    //    request, set request’s processed flag to true, and queue a database task to run these steps:
+    for (auto const& pending_request : m_request_list) {
+        auto request = pending_request.request;
+        request->set_processed(true);
+
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(heap(), [&realm, request] {
+            // 1. Set request’s done flag to true.
+            request->set_done(true);
+
+            // 2. Set request’s result to undefined.
+            request->set_result(JS::js_undefined());
+
+            // 3. Set request’s error to a newly created "AbortError" DOMException.
+            request->set_error(WebIDL::AbortError::create(realm, "The transaction was aborted"_fly_string));
+
+            // 4. Fire an event named error at request with its bubbles and cancelable attributes initialized to true.
+            auto event = DOM::Event::create(realm, HTML::EventNames::error);
+            event->set_bubbles(true);
+            event->set_cancelable(true);
+            request->dispatch_event(event);
+        }));
+    }
+    m_request_list.clear();
+
+    // 6. Queue a database task to run these steps:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(heap(), [this, &realm] {
+        // 1. If transaction is an upgrade transaction, then set transaction’s connection's associated database's
+        //    upgrade transaction to null.
+        if (is_upgrade_transaction())
+            m_connection->set_upgrade_transaction(nullptr);
+
+        // 2. Fire an event named abort at transaction with its bubbles attribute initialized to true.
+        auto event = DOM::Event::create(realm, HTML::EventNames::abort);
+        event->set_bubbles(true);
+        dispatch_event(event);
+
+        // 3. If transaction is an upgrade transaction, then:
+        if (is_upgrade_transaction() && m_open_request) {
+            // 1. Let request be the open request associated with transaction.
+            // 2. Set request’s transaction to null.
+            m_open_request->set_transaction(nullptr);
+
+            // 3. Set request’s result to undefined.
+            m_open_request->set_result(JS::js_undefined());
+
+            // 4. Set request’s processed flag to false.
+            m_open_request->set_processed(false);
+
+            // 5. Set request’s done flag to false.
+            m_open_request->set_done(false);
+        }
+
+        did_finish();
+    }));
+}
+
+void IDBTransaction::did_finish()
+{
+    m_connection->database().transaction_did_finish(*this);
+    m_connection->transaction_did_finish(*this);
+
+    if (auto on_finished = exchange(m_on_finished, nullptr))
+        on_finished->function()();
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-onabort
+void IDBTransaction::set_onabort(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::abort, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-onabort
+WebIDL::CallbackType* IDBTransaction::onabort()
+{
+    return event_handler_attribute(HTML::EventNames::abort);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-oncomplete
+void IDBTransaction::set_oncomplete(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::complete, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-oncomplete
+WebIDL::CallbackType* IDBTransaction::oncomplete()
+{
+    return event_handler_attribute(HTML::EventNames::complete);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-onerror
+void IDBTransaction::set_onerror(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::error, event_handler);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-onerror
+WebIDL::CallbackType* IDBTransaction::onerror()
+{
+    return event_handler_attribute(HTML::EventNames::error);
+}
+
+void register_transaction_for_cleanup(IDBTransaction& transaction)
+{
+    transactions_to_clean_up().append(JS::make_handle(transaction));
+}
+
+// https://w3c.github.io/IndexedDB/#cleanup-indexed-database-transactions
+bool cleanup_indexed_database_transactions(HTML::EventLoop& event_loop)
+{
+    // 1. Let cleanup transactions be false.
+    bool cleanup_transactions = false;
+
+    // 2. For each transaction with cleanup event loop matching the current event loop:
+    auto& transactions = transactions_to_clean_up();
+    for (size_t i = 0; i < transactions.size();) {
+        auto transaction = transactions[i];
+        if (transaction->cleanup_event_loop() != &event_loop) {
+            ++i;
+            continue;
+        }
+        transactions.remove(i);
+
+        // 1. Set transaction’s state to inactive.
+        // NOTE: The transaction may have been committed or aborted already.
+        if (transaction->state() == IDBTransaction::State::Active)
+            transaction->set_state(IDBTransaction::State::Inactive);
+
+        // 2. Clear transaction’s cleanup event loop.
+        transaction->set_cleanup_event_loop(nullptr);
+
+        // 3. Set cleanup transactions to true.
+        cleanup_transactions = true;
+
+        transaction->commit_if_all_requests_were_processed();
+    }
+
+    // 3. Return cleanup transactions.
+    return cleanup_transactions;
+}
+
+}
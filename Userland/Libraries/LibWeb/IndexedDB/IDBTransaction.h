@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <LibJS/Heap/HeapFunction.h>
+#include <LibWeb/Bindings/IDBTransactionPrototype.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#idbtransaction
+class IDBTransaction final : public DOM::EventTarget {
+    WEB_PLATFORM_OBJECT(IDBTransaction, DOM::EventTarget);
+    JS_DECLARE_ALLOCATOR(IDBTransaction);
+
+public:
+    // https://w3c.github.io/IndexedDB/#transaction-state
+    enum class State {
+        Active,
+        Inactive,
+        Committing,
+        Finished,
+    };
+
+    using Operation = JS::HeapFunction<WebIDL::ExceptionOr<JS::Value>()>;
+
+    [[nodiscard]] static JS::NonnullGCPtr<IDBTransaction> create(JS::Realm&, IDBDatabase& connection, Bindings::IDBTransactionMode, Bindings::IDBTransactionDurability, Vector<NonnullRefPtr<ObjectStore>> scope);
+
+    virtual ~IDBTransaction() override;
+
+    JS::NonnullGCPtr<HTML::DOMStringList> object_store_names() const;
+    Bindings::IDBTransactionMode mode() const { return m_mode; }
+    Bindings::IDBTransactionDurability durability() const { return m_durability; }
+    JS::NonnullGCPtr<IDBDatabase> db() const { return m_connection; }
+    JS::GCPtr<WebIDL::DOMException> error() const { return m_error; }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> object_store(String const& name);
+    WebIDL::ExceptionOr<void> commit();
+    WebIDL::ExceptionOr<void> abort();
+
+    void set_onabort(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onabort();
+    void set_oncomplete(WebIDL::CallbackType*);
+    WebIDL::CallbackType* oncomplete();
+    void set_onerror(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onerror();
+
+    State state() const { return m_state; }
+    void set_state(State state) { m_state = state; }
+
+    // https://w3c.github.io/IndexedDB/#upgrade-transaction
+    bool is_upgrade_transaction() const { return m_mode == Bindings::IDBTransactionMode::Versionchange; }
+
+    // https://w3c.github.io/IndexedDB/#transaction-scope
+    Vector<NonnullRefPtr<ObjectStore>> const& scope() const { return m_scope; }
+    void add_to_scope(NonnullRefPtr<ObjectStore>);
+
+    // Returns the object store handle for the given object store in this transaction, creating it if needed.
+    JS::NonnullGCPtr<IDBObjectStore> object_store_handle(ObjectStore&);
+
+    // Records how to revert a change made to the database, which is done if the transaction is aborted.
+    void add_undo_step(Function<void()>);
+
+    // https://w3c.github.io/IndexedDB/#transaction-cleanup-event-loop
+    void set_cleanup_event_loop(JS::GCPtr<HTML::EventLoop> event_loop) { m_cleanup_event_loop = event_loop; }
+    JS::GCPtr<HTML::EventLoop> cleanup_event_loop() const { return m_cleanup_event_loop; }
+
+    // The open request that created this upgrade transaction.
+    JS::GCPtr<IDBOpenDBRequest> open_request() const { return m_open_request; }
+    void set_open_request(JS::GCPtr<IDBOpenDBRequest> request) { m_open_request = request; }
+
+    // Steps to run once this transaction has finished, after its "complete" or "abort" event has been fired.
+    void set_on_finished(JS::NonnullGCPtr<JS::HeapFunction<void()>> steps) { m_on_finished = steps; }
+
+    // https://w3c.github.io/IndexedDB/#transaction-start
+    bool has_started() const { return m_started; }
+    void start();
+
+    // https://w3c.github.io/IndexedDB/#asynchronously-execute-a-request
+    JS::NonnullGCPtr<IDBRequest> asynchronously_execute_a_request(IDBRequestSource, JS::NonnullGCPtr<Operation>, JS::GCPtr<IDBRequest> = {});
+
+    // https://w3c.github.io/IndexedDB/#commit-a-transaction
+    void commit_a_transaction();
+
+    // https://w3c.github.io/IndexedDB/#abort-a-transaction
+    void abort_a_transaction(JS::GCPtr<WebIDL::DOMException> error);
+
+    // Commits the transaction if it is inactive and all of its requests have been processed.
+    // https://w3c.github.io/IndexedDB/#transaction-lifecycle
+    void commit_if_all_requests_were_processed();
+
+private:
+    IDBTransaction(JS::Realm&, IDBDatabase& connection, Bindings::IDBTransactionMode, Bindings::IDBTransactionDurability, Vector<NonnullRefPtr<ObjectStore>> scope);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual EventTarget* get_parent(DOM::Event const&) override;
+
+    void process_next_request();
+    void finish_commit_if_possible();
+    void did_finish();
+
+    JS::NonnullGCPtr<IDBDatabase> m_connection;
+    Bindings::IDBTransactionMode m_mode;
+    Bindings::IDBTransactionDurability m_durability;
+    Vector<NonnullRefPtr<ObjectStore>> m_scope;
+
+    State m_state { State::Active };
+    bool m_started { false };
+    bool m_processing_request { false };
+
+    JS::GCPtr<WebIDL::DOMException> m_error;
+
+    struct PendingRequest {
+        JS::NonnullGCPtr<IDBRequest> request;
+        JS::NonnullGCPtr<Operation> operation;
+    };
+
+    // https://w3c.github.io/IndexedDB/#transaction-request-list
+    // NOTE: Requests are removed from this list once their success or error event has been fired.
+    Vector<PendingRequest> m_request_list;
+
+    Vector<Function<void()>> m_undo_steps;
+
+    HashMap<ObjectStore const*, JS::NonnullGCPtr<IDBObjectStore>> m_object_store_handles;
+
+    JS::GCPtr<HTML::EventLoop> m_cleanup_event_loop;
+    JS::GCPtr<IDBOpenDBRequest> m_open_request;
+    JS::GCPtr<JS::HeapFunction<void()>> m_on_finished;
+};
+
+// Makes the transaction inactive at the next microtask checkpoint of its cleanup event loop.
+void register_transaction_for_cleanup(IDBTransaction&);
+
+// https://w3c.github.io/IndexedDB/#cleanup-indexed-database-transactions
+bool cleanup_indexed_database_transactions(HTML::EventLoop&);
+
+}
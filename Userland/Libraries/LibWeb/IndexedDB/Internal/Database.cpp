@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+NonnullRefPtr<Database> Database::create(String name)
+{
+    return adopt_ref(*new Database(move(name)));
+}
+
+Database::Database(String name)
+    : m_name(move(name))
+{
+}
+
+void Database::add_object_store(NonnullRefPtr<ObjectStore> object_store)
+{
+    m_object_stores.set(object_store->name(), move(object_store));
+}
+
+void Database::remove_object_store(String const& name)
+{
+    m_object_stores.remove(name);
+}
+
+void Database::rename_object_store(String const& old_name, String const& new_name)
+{
+    auto object_store = m_object_stores.take(old_name).release_value();
+    object_store->set_name(new_name);
+    m_object_stores.set(new_name, move(object_store));
+}
+
+Vector<String> Database::object_store_names() const
+{
+    Vector<String> names;
+    names.ensure_capacity(m_object_stores.size());
+    for (auto const& it : m_object_stores)
+        names.unchecked_append(it.key);
+
+    // NOTE: Lists of names are sorted in ascending order by code unit, which for the names of object stores and
+    //       indexes we allow is the same as ordering by code point.
+    quick_sort(names);
+    return names;
+}
+
+Vector<JS::NonnullGCPtr<IDBDatabase>> Database::open_connections() const
+{
+    Vector<JS::NonnullGCPtr<IDBDatabase>> connections;
+    for (auto const& connection : m_connections) {
+        if (connection && !connection->is_closed())
+            connections.append(*connection);
+    }
+    return connections;
+}
+
+void Database::add_connection(IDBDatabase& connection)
+{
+    m_connections.remove_all_matching([](auto const& existing) { return !existing || existing->is_closed(); });
+    m_connections.append(connection);
+}
+
+void Database::wait_for_other_connections_to_close(IDBDatabase const* except, Function<void()> steps)
+{
+    m_pending_connection_closes.append({ except, move(steps) });
+    connection_was_closed();
+}
+
+void Database::connection_was_closed()
+{
+    for (size_t i = 0; i < m_pending_connection_closes.size();) {
+        auto& pending = m_pending_connection_closes[i];
+
+        auto connections = open_connections();
+        bool has_other_open_connections = any_of(connections, [&](auto const& connection) {
+            return connection.ptr() != pending.except.ptr();
+        });
+        if (has_other_open_connections) {
+            ++i;
+            continue;
+        }
+
+        auto steps = move(pending.steps);
+        m_pending_connection_closes.remove(i);
+        steps();
+
+        // NOTE: The steps may have opened or closed connections, so start over.
+        i = 0;
+    }
+}
+
+void Database::add_transaction(IDBTransaction& transaction)
+{
+    m_transactions.append(JS::make_handle(transaction));
+    start_transactions_if_possible();
+}
+
+void Database::transaction_did_finish(IDBTransaction& transaction)
+{
+    m_transactions.remove_first_matching([&](auto const& handle) { return handle.ptr() == &transaction; });
+    start_transactions_if_possible();
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-scheduling
+bool Database::can_start_transaction(IDBTransaction const& transaction) const
+{
+    auto scopes_overlap = [](IDBTransaction const& a, IDBTransaction const& b) {
+        if (a.is_upgrade_transaction() || b.is_upgrade_transaction())
+            return true;
+        return any_of(a.scope(), [&](auto const& object_store) {
+            return b.scope().contains_slow(object_store);
+        });
+    };
+
+    for (auto const& other : m_transactions) {
+        // NOTE: Only transactions that were created before this one are considered.
+        if (other.ptr() == &transaction)
+            return true;
+
+        if (other->state() == IDBTransaction::State::Finished || !scopes_overlap(transaction, *other))
+            continue;
+
+        // A read-only transaction tx can start when there are no read/write transactions which were created before
+        // tx, have overlapping scopes with tx, and are not finished.
+        // A read/write transaction tx can start when there are no transactions which were created before tx, have
+        // overlapping scopes with tx, and are not finished.
+        if (transaction.mode() != Bindings::IDBTransactionMode::Readonly || other->mode() != Bindings::IDBTransactionMode::Readonly)
+            return false;
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+void Database::start_transactions_if_possible()
+{
+    // NOTE: Starting a transaction only queues tasks, so it can not modify the list of transactions.
+    for (auto const& transaction : m_transactions) {
+        if (!transaction->has_started() && can_start_transaction(*transaction))
+            transaction->start();
+    }
+}
+
+OrderedHashMap<String, NonnullRefPtr<Database>>& databases_for_origin(URL::Origin const& origin)
+{
+    static HashMap<URL::Origin, OrderedHashMap<String, NonnullRefPtr<Database>>> databases_per_origin;
+    return databases_per_origin.ensure(origin);
+}
+
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/WeakPtr.h>
+#include <LibJS/Heap/Handle.h>
+#include <LibURL/Origin.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#database-construct
+//
+// NOTE: Databases are kept in memory for the lifetime of the process, and shared by all connections to them from the
+//       same origin, like localStorage is.
+class Database : public RefCounted<Database> {
+public:
+    static NonnullRefPtr<Database> create(String name);
+
+    String const& name() const { return m_name; }
+
+    u64 version() const { return m_version; }
+    void set_version(u64 version) { m_version = version; }
+
+    OrderedHashMap<String, NonnullRefPtr<ObjectStore>> const& object_stores() const { return m_object_stores; }
+    RefPtr<ObjectStore> object_store(String const& name) const { return m_object_stores.get(name).value_or(nullptr); }
+    void add_object_store(NonnullRefPtr<ObjectStore>);
+    void remove_object_store(String const& name);
+    void rename_object_store(String const& old_name, String const& new_name);
+
+    Vector<String> object_store_names() const;
+
+    // The connections to this database that have not been closed yet.
+    Vector<JS::NonnullGCPtr<IDBDatabase>> open_connections() const;
+    void add_connection(IDBDatabase&);
+
+    // Runs the given steps once every connection, except the given one, has been closed.
+    void wait_for_other_connections_to_close(IDBDatabase const* except, Function<void()> steps);
+    void connection_was_closed();
+
+    // https://w3c.github.io/IndexedDB/#transaction-scheduling
+    void add_transaction(IDBTransaction&);
+    void transaction_did_finish(IDBTransaction&);
+
+private:
+    explicit Database(String name);
+
+    bool can_start_transaction(IDBTransaction const&) const;
+    void start_transactions_if_possible();
+
+    String m_name;
+    u64 m_version { 0 };
+    OrderedHashMap<String, NonnullRefPtr<ObjectStore>> m_object_stores;
+
+    Vector<WeakPtr<IDBDatabase>> m_connections;
+
+    struct PendingConnectionClose {
+        WeakPtr<IDBDatabase> except;
+        Function<void()> steps;
+    };
+    Vector<PendingConnectionClose> m_pending_connection_closes;
+
+    // Transactions that have been created and have not finished yet, in the order they were created.
+    Vector<JS::Handle<IDBTransaction>> m_transactions;
+};
+
+// The databases of the given origin, keyed by name.
+OrderedHashMap<String, NonnullRefPtr<Database>>& databases_for_origin(URL::Origin const&);
+
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/IndexedDB/Internal/Index.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+
+namespace Web::IndexedDB {
+
+NonnullRefPtr<Index> Index::create(ObjectStore& object_store, String name, KeyPath key_path, bool unique, bool multi_entry)
+{
+    return adopt_ref(*new Index(object_store, move(name), move(key_path), unique, multi_entry));
+}
+
+Index::Index(ObjectStore& object_store, String name, KeyPath key_path, bool unique, bool multi_entry)
+    : m_object_store(object_store)
+    , m_name(move(name))
+    , m_key_path(move(key_path))
+    , m_unique(unique)
+    , m_multi_entry(multi_entry)
+{
+}
+
+static int compare_records(Index::Record const& record, Key const& key, Optional<Key> const& primary_key)
+{
+    if (auto result = compare_two_keys(record.key, key); result != 0)
+        return result;
+    if (!primary_key.has_value())
+        return 1;
+    return compare_two_keys(record.primary_key, *primary_key);
+}
+
+size_t Index::lower_bound(Key const& key, Optional<Key> const& primary_key, bool inclusive) const
+{
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto result = compare_records(m_records[middle], key, primary_key);
+        if (result < 0 || (result == 0 && !inclusive))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+size_t Index::lower_bound_for_key(Key const& key, bool inclusive) const
+{
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto result = compare_two_keys(m_records[middle].key, key);
+        if (result < 0 || (result == 0 && !inclusive))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+size_t Index::lower_bound(KeyRange const& range) const
+{
+    if (!range.lower_bound.has_value())
+        return 0;
+    return lower_bound_for_key(*range.lower_bound, !range.lower_open);
+}
+
+bool Index::has_record_with_key(Key const& key) const
+{
+    auto position = lower_bound_for_key(key, true);
+    return position < m_records.size() && m_records[position].key == key;
+}
+
+void Index::add_record(Key key, Key primary_key)
+{
+    auto position = lower_bound(key, primary_key);
+    m_records.insert(position, Record { move(key), move(primary_key) });
+}
+
+void Index::remove_records_referencing(Key const& primary_key)
+{
+    // FIXME: This is a linear scan, as records are only sorted by their index key. Keep track of the index keys each
+    //        object store record produced if this shows up in profiles.
+    m_records.remove_all_matching([&](auto const& record) {
+        return record.primary_key == primary_key;
+    });
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+class ObjectStore;
+
+// https://w3c.github.io/IndexedDB/#index-construct
+class Index : public RefCounted<Index> {
+public:
+    // An index’s list of records, each of which has a key and the primary key of the referenced record.
+    struct Record {
+        Key key;
+        Key primary_key;
+    };
+
+    static NonnullRefPtr<Index> create(ObjectStore&, String name, KeyPath, bool unique, bool multi_entry);
+
+    ObjectStore& object_store() const { return m_object_store; }
+
+    String const& name() const { return m_name; }
+    void set_name(String name) { m_name = move(name); }
+
+    KeyPath const& key_path() const { return m_key_path; }
+    bool unique() const { return m_unique; }
+    bool multi_entry() const { return m_multi_entry; }
+
+    bool is_deleted() const { return m_deleted; }
+    void set_deleted(bool deleted) { m_deleted = deleted; }
+
+    // Records are kept sorted by key, and records with the same key by primary key.
+    Vector<Record> const& records() const { return m_records; }
+
+    bool has_record_with_key(Key const&) const;
+    void add_record(Key key, Key primary_key);
+    void remove_records_referencing(Key const& primary_key);
+    void clear() { m_records.clear(); }
+
+    // Returns the position of the first record that sorts after (key, primary_key), or at it if inclusive is true.
+    // A missing primary key sorts before all primary keys of the given key.
+    size_t lower_bound(Key const& key, Optional<Key> const& primary_key = {}, bool inclusive = true) const;
+
+    // Returns the position of the first record whose key is greater than the given key, or equal to it if inclusive
+    // is true.
+    size_t lower_bound_for_key(Key const& key, bool inclusive) const;
+
+    // Returns the position of the first record whose key may be in the given range.
+    size_t lower_bound(KeyRange const&) const;
+
+private:
+    Index(ObjectStore&, String name, KeyPath, bool unique, bool multi_entry);
+
+    ObjectStore& m_object_store;
+    String m_name;
+    KeyPath m_key_path;
+    bool m_unique { false };
+    bool m_multi_entry { false };
+    bool m_deleted { false };
+
+    Vector<Record> m_records;
+};
+
+}
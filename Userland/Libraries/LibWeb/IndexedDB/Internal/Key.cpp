@@ -0,0 +1,721 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/DataView.h>
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibUnicode/CharacterTypes.h>
+#include <LibWeb/FileAPI/File.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+bool Key::operator==(Key const& other) const
+{
+    return compare_two_keys(*this, other) == 0;
+}
+
+// Strings are compared by their UTF-16 code units, but are stored as UTF-8. Code point order only differs from code
+// unit order for code points at or above U+E000, which sort after all surrogate pairs. Map code points to a value that
+// orders them like the first code unit of their UTF-16 encoding, without having to transcode the strings.
+static u32 code_unit_order(u32 code_point)
+{
+    if (code_point < 0xD800)
+        return code_point;
+    if (code_point >= 0x10000)
+        return code_point - 0x10000 + 0xD800;
+    return code_point + 0x100000;
+}
+
+static int compare_strings_by_code_units(String const& a, String const& b)
+{
+    auto a_code_points = a.code_points();
+    auto b_code_points = b.code_points();
+
+    auto a_it = a_code_points.begin();
+    auto b_it = b_code_points.begin();
+
+    for (; a_it != a_code_points.end() && b_it != b_code_points.end(); ++a_it, ++b_it) {
+        auto a_order = code_unit_order(*a_it);
+        auto b_order = code_unit_order(*b_it);
+        if (a_order != b_order)
+            return a_order < b_order ? -1 : 1;
+    }
+
+    if (a_it == a_code_points.end())
+        return b_it == b_code_points.end() ? 0 : -1;
+    return 1;
+}
+
+// https://w3c.github.io/IndexedDB/#compare-two-keys
+int compare_two_keys(Key const& a, Key const& b)
+{
+    // 1. Let ta be the type of a.
+    auto ta = a.type();
+
+    // 2. Let tb be the type of b.
+    auto tb = b.type();
+
+    // 3. If ta does not equal tb, then run these steps:
+    // NOTE: The spec orders array > binary > string > date > number, which matches the order of Key::Type.
+    if (ta != tb)
+        return ta > tb ? 1 : -1;
+
+    // 4. Let va be the value of a.
+    // 5. Let vb be the value of b.
+    // 6. Switch on ta:
+    switch (ta) {
+    // number, date
+    case Key::Type::Number:
+    case Key::Type::Date:
+        // 1. If va is greater than vb, then return 1.
+        if (a.number() > b.number())
+            return 1;
+        // 2. If va is less than vb, then return -1.
+        if (a.number() < b.number())
+            return -1;
+        // 3. Return 0.
+        return 0;
+
+    // string
+    case Key::Type::String:
+        // 1. If va is code unit less than vb, then return -1.
+        // 2. If vb is code unit less than va, then return 1.
+        // 3. Return 0.
+        return compare_strings_by_code_units(a.string(), b.string());
+
+    // binary
+    case Key::Type::Binary: {
+        auto const& va = a.binary();
+        auto const& vb = b.binary();
+
+        // 1. If va is byte less than vb, then return -1.
+        // 2. If vb is byte less than va, then return 1.
+        // 3. Return 0.
+        auto common_length = min(va.size(), vb.size());
+        if (auto result = __builtin_memcmp(va.data(), vb.data(), common_length); result != 0)
+            return result < 0 ? -1 : 1;
+        if (va.size() == vb.size())
+            return 0;
+        return va.size() < vb.size() ? -1 : 1;
+    }
+
+    // array
+    case Key::Type::Array: {
+        auto const& va = a.array();
+        auto const& vb = b.array();
+
+        // 1. Let length be the lesser of va’s size and vb’s size.
+        auto length = min(va.size(), vb.size());
+
+        // 2. Let i be 0.
+        // 3. While i is less than length, then:
+        for (size_t i = 0; i < length; ++i) {
+            // 1. Let c be the result of recursively comparing two keys with va[i] and vb[i].
+            auto c = compare_two_keys(va[i], vb[i]);
+
+            // 2. If c is not 0, return c.
+            if (c != 0)
+                return c;
+
+            // 3. Increase i by 1.
+        }
+
+        // 4. If va’s size is greater than vb’s size, then return 1.
+        if (va.size() > vb.size())
+            return 1;
+
+        // 5. If va’s size is less than vb’s size, then return -1.
+        if (va.size() < vb.size())
+            return -1;
+
+        // 6. Return 0.
+        return 0;
+    }
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+// https://tc39.es/ecma262/#prod-IdentifierName
+static bool is_identifier_name(StringView string)
+{
+    if (string.is_empty())
+        return false;
+
+    bool first = true;
+    for (auto code_point : Utf8View { string }) {
+        if (code_point == '$' || code_point == '_') {
+            first = false;
+            continue;
+        }
+
+        if (first) {
+            if (!Unicode::code_point_has_identifier_start_property(code_point))
+                return false;
+            first = false;
+            continue;
+        }
+
+        // NOTE: U+200C and U+200D are ZWNJ and ZWJ respectively.
+        if (code_point != 0x200C && code_point != 0x200D && !Unicode::code_point_has_identifier_continue_property(code_point))
+            return false;
+    }
+
+    return true;
+}
+
+static bool is_valid_key_path_string(String const& key_path)
+{
+    // An empty string.
+    if (key_path.is_empty())
+        return true;
+
+    // An identifier, which is a string matching the IdentifierName production from the ECMAScript Language
+    // Specification, or a string consisting of two or more identifiers separated by periods (U+002E FULL STOP).
+    auto identifiers = key_path.bytes_as_string_view().split_view('.', SplitBehavior::KeepEmpty);
+    return all_of(identifiers, [](auto identifier) { return is_identifier_name(identifier); });
+}
+
+// https://w3c.github.io/IndexedDB/#valid-key-path
+bool is_valid_key_path(KeyPath const& key_path)
+{
+    return key_path.visit(
+        [](String const& string) {
+            return is_valid_key_path_string(string);
+        },
+        [](Vector<String> const& list) {
+            // A non-empty list containing only strings conforming to the above requirements.
+            if (list.is_empty())
+                return false;
+            return all_of(list, [](auto const& string) { return is_valid_key_path_string(string); });
+        });
+}
+
+JS::Value key_path_to_value(JS::Realm& realm, KeyPath const& key_path)
+{
+    auto& vm = realm.vm();
+
+    return key_path.visit(
+        [&](String const& string) -> JS::Value {
+            return JS::PrimitiveString::create(vm, string);
+        },
+        [&](Vector<String> const& list) -> JS::Value {
+            return JS::Array::create_from<String>(realm, list, [&](String const& string) -> JS::Value {
+                return JS::PrimitiveString::create(vm, string);
+            });
+        });
+}
+
+// https://w3c.github.io/IndexedDB/#in
+bool KeyRange::contains(Key const& key) const
+{
+    // A key is in a key range range if both of the following conditions are fulfilled:
+
+    // - The range’s lower bound is null, or it is less than key, or it is both equal to key and the range’s lower
+    //   open flag is false.
+    if (lower_bound.has_value()) {
+        auto result = compare_two_keys(*lower_bound, key);
+        if (result > 0 || (result == 0 && lower_open))
+            return false;
+    }
+
+    // - The range’s upper bound is null, or it is greater than key, or it is both equal to key and the range’s upper
+    //   open flag is false.
+    if (upper_bound.has_value()) {
+        auto result = compare_two_keys(*upper_bound, key);
+        if (result < 0 || (result == 0 && upper_open))
+            return false;
+    }
+
+    return true;
+}
+
+static JS::ArrayBuffer* viewed_array_buffer_of_buffer_source(JS::Object const& object)
+{
+    if (is<JS::ArrayBuffer>(object))
+        return const_cast<JS::ArrayBuffer*>(static_cast<JS::ArrayBuffer const*>(&object));
+    if (is<JS::TypedArrayBase>(object))
+        return static_cast<JS::TypedArrayBase const&>(object).viewed_array_buffer();
+    if (is<JS::DataView>(object))
+        return static_cast<JS::DataView const&>(object).viewed_array_buffer();
+    return nullptr;
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key
+static WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_key(JS::Realm& realm, JS::Value input, HashTable<JS::Object const*>& seen)
+{
+    auto& vm = realm.vm();
+
+    // 1. If seen was not given, then let seen be a new empty set.
+    // 2. If seen contains input, then return invalid.
+    if (input.is_object() && seen.contains(&input.as_object()))
+        return Optional<Key> {};
+
+    // 3. Jump to the appropriate step below:
+
+    // If Type(input) is Number
+    if (input.is_number()) {
+        // 1. If input is NaN then return invalid.
+        if (input.is_nan())
+            return Optional<Key> {};
+
+        // 2. Otherwise, return a new key with type number and value input.
+        return Key::create_number(input.as_double());
+    }
+
+    // If Type(input) is String
+    if (input.is_string()) {
+        // 1. Return a new key with type string and value input.
+        return Key::create_string(input.as_string().utf8_string());
+    }
+
+    if (!input.is_object())
+        return Optional<Key> {};
+
+    auto& object = input.as_object();
+
+    // If input is a Date (has a [[DateValue]] internal slot)
+    if (is<JS::Date>(object)) {
+        // 1. Let ms be the value of input’s [[DateValue]] internal slot.
+        auto ms = static_cast<JS::Date const&>(object).date_value();
+
+        // 2. If ms is NaN then return invalid.
+        if (isnan(ms))
+            return Optional<Key> {};
+
+        // 3. Otherwise, return a new key with type date and value ms.
+        return Key::create_date(ms);
+    }
+
+    // If input is a buffer source type
+    if (auto* array_buffer = viewed_array_buffer_of_buffer_source(object)) {
+        // 1. If input is detached then return invalid.
+        if (array_buffer->is_detached())
+            return Optional<Key> {};
+
+        // 2. Let bytes be the result of getting a copy of the bytes held by the buffer source input.
+        auto bytes = MUST(WebIDL::get_buffer_source_copy(object));
+
+        // 3. Return a new key with type binary containing bytes.
+        return Key::create_binary(move(bytes));
+    }
+
+    // If input is an Array exotic object
+    if (is<JS::Array>(object)) {
+        // 1. Let len be ? ToLength( ? Get(input, "length")).
+        auto length = TRY(JS::length_of_array_like(vm, object));
+
+        // 2. Append input to seen.
+        seen.set(&object);
+
+        // 3. Let keys be a new empty list.
+        Vector<Key> keys;
+
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        for (size_t index = 0; index < length; ++index) {
+            // 1. Let hop be ? HasOwnProperty(input, index).
+            auto hop = TRY(object.has_own_property(index));
+
+            // 2. If hop is false, return invalid.
+            if (!hop)
+                return Optional<Key> {};
+
+            // 3. Let entry be ? Get(input, index).
+            auto entry = TRY(object.get(index));
+
+            // 4. Let key be the result of converting a value to a key with arguments entry and seen.
+            // 5. ReturnIfAbrupt(key).
+            auto key = TRY(convert_a_value_to_a_key(realm, entry, seen));
+
+            // 6. If key is invalid abort these steps and return invalid.
+            if (!key.has_value())
+                return Optional<Key> {};
+
+            // 7. Append key to keys.
+            keys.append(key.release_value());
+
+            // 8. Increase index by 1.
+        }
+
+        // 6. Return a new array key with value keys.
+        return Key::create_array(move(keys));
+    }
+
+    // Otherwise
+    // 1. Return invalid.
+    return Optional<Key> {};
+}
+
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_key(JS::Realm& realm, JS::Value input)
+{
+    HashTable<JS::Object const*> seen;
+    return convert_a_value_to_a_key(realm, input, seen);
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-multientry-key
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_multi_entry_key(JS::Realm& realm, JS::Value input)
+{
+    auto& vm = realm.vm();
+
+    // 1. If input is an Array exotic object, then:
+    if (input.is_object() && is<JS::Array>(input.as_object())) {
+        auto& object = input.as_object();
+
+        // 1. Let len be ? ToLength( ? Get(input, "length")).
+        auto length = TRY(JS::length_of_array_like(vm, object));
+
+        // 2. Let seen be a new set containing only input.
+        HashTable<JS::Object const*> seen;
+        seen.set(&object);
+
+        // 3. Let keys be a new empty list.
+        Vector<Key> keys;
+
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        for (size_t index = 0; index < length; ++index) {
+            // 1. Let entry be Get(input, index).
+            auto entry = object.get(index);
+
+            // 2. If entry is not an abrupt completion, then:
+            if (entry.is_error())
+                continue;
+
+            // 1. Let key be the result of converting a value to a key with arguments entry and seen.
+            auto key = convert_a_value_to_a_key(realm, entry.value(), seen);
+
+            // 2. If key is not invalid or an abrupt completion, and there is no item in keys equal to key, then
+            //    append key to keys.
+            if (key.is_error() || !key.value().has_value())
+                continue;
+            if (!keys.contains_slow(*key.value()))
+                keys.append(key.release_value().release_value());
+
+            // 3. Increase index by 1.
+        }
+
+        // 6. Return a new array key with value set to keys.
+        return Key::create_array(move(keys));
+    }
+
+    // 2. Otherwise, return the result of converting a value to a key with argument input. Rethrow any exceptions.
+    return convert_a_value_to_a_key(realm, input);
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-key-to-a-value
+JS::Value convert_a_key_to_a_value(JS::Realm& realm, Key const& key)
+{
+    auto& vm = realm.vm();
+
+    // 1. Let type be key’s type.
+    // 2. Let value be key’s value.
+    // 3. Switch on type:
+    switch (key.type()) {
+    // number
+    case Key::Type::Number:
+        // Return an ECMAScript Number value equal to value
+        return JS::Value(key.number());
+
+    // string
+    case Key::Type::String:
+        // Return an ECMAScript String value equal to value
+        return JS::PrimitiveString::create(vm, key.string());
+
+    // date
+    case Key::Type::Date:
+        // 1. Let date be the result of executing the ECMAScript Date constructor with the single argument value.
+        // 2. Assert: date is not an abrupt completion.
+        // 3. Return date.
+        return JS::Date::create(realm, key.number());
+
+    // binary
+    case Key::Type::Binary: {
+        // 1. Let len be value’s length.
+        // 2. Let buffer be the result of executing the ECMAScript ArrayBuffer constructor with len.
+        // 3. Assert: buffer is not an abrupt completion.
+        // 4. Set the entries in buffer’s [[ArrayBufferData]] internal slot to the entries in value.
+        // 5. Return buffer.
+        auto bytes = MUST(ByteBuffer::copy(key.binary()));
+        return JS::ArrayBuffer::create(realm, move(bytes));
+    }
+
+    // array
+    case Key::Type::Array: {
+        // 1. Let array be the result of executing the ECMAScript Array constructor with no arguments.
+        // 2. Assert: array is not an abrupt completion.
+        // 3. Let len be value’s size.
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        //     1. Let entry be the result of converting a key to a value with value[index].
+        //     2. Let status be CreateDataProperty(array, index, entry).
+        //     3. Assert: status is true.
+        //     4. Increase index by 1.
+        // 6. Return array.
+        return JS::Array::create_from<Key>(realm, key.array(), [&](Key const& entry) {
+            return convert_a_key_to_a_value(realm, entry);
+        });
+    }
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+WebIDL::ExceptionOr<Key> convert_a_value_to_a_key_or_throw(JS::Realm& realm, JS::Value input)
+{
+    auto key = TRY(convert_a_value_to_a_key(realm, input));
+    if (!key.has_value())
+        return WebIDL::DataError::create(realm, "Value is not a valid key"_fly_string);
+    return key.release_value();
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key-range
+WebIDL::ExceptionOr<KeyRange> convert_a_value_to_a_key_range(JS::Realm& realm, JS::Value value, bool null_disallowed)
+{
+    // 1. If value is a key range, return value.
+    if (value.is_object() && is<IDBKeyRange>(value.as_object()))
+        return static_cast<IDBKeyRange const&>(value.as_object()).range();
+
+    // 2. If value is undefined or is null, then throw a "DataError" DOMException if null disallowed flag is true, or
+    //    return an unbounded key range otherwise.
+    if (value.is_nullish()) {
+        if (null_disallowed)
+            return WebIDL::DataError::create(realm, "Value must not be null or undefined"_fly_string);
+        return KeyRange::unbounded();
+    }
+
+    // 3. Let key be the result of converting a value to a key with value. Rethrow any exceptions.
+    // 4. If key is invalid, throw a "DataError" DOMException.
+    auto key = TRY(convert_a_value_to_a_key_or_throw(realm, value));
+
+    // 5. Return a key range containing only key.
+    return KeyRange::only(move(key));
+}
+
+// https://w3c.github.io/IndexedDB/#evaluate-a-key-path-on-a-value
+static WebIDL::ExceptionOr<Optional<JS::Value>> evaluate_a_key_path_on_a_value(JS::Realm& realm, JS::Value value, KeyPath const& key_path)
+{
+    auto& vm = realm.vm();
+
+    // 1. If keyPath is a list of strings, then:
+    if (key_path.has<Vector<String>>()) {
+        // 1. Let result be a new Array object created as if by the expression [].
+        auto result = MUST(JS::Array::create(realm, 0));
+
+        // 2. Let i be 0.
+        // 3. For each item of keyPath:
+        auto const& list = key_path.get<Vector<String>>();
+        for (size_t i = 0; i < list.size(); ++i) {
+            // 1. Let key be the result of recursively evaluating a key path on a value with item and value.
+            // 2. Assert: key is not an abrupt completion.
+            auto key = TRY(evaluate_a_key_path_on_a_value(realm, value, list[i]));
+
+            // 3. If key is failure, abort the overall algorithm and return failure.
+            if (!key.has_value())
+                return OptionalNone {};
+
+            // 4. Let p be ! ToString(i).
+            // 5. Let status be CreateDataProperty(result, p, key).
+            // 6. Assert: status is true.
+            MUST(result->create_data_property(i, *key));
+
+            // 7. Increase i by 1.
+        }
+
+        // 4. Return result.
+        return JS::Value { result };
+    }
+
+    auto const& key_path_string = key_path.get<String>();
+
+    // 2. If keyPath is the empty string, return value and skip the remaining steps.
+    if (key_path_string.is_empty())
+        return value;
+
+    // 3. Let identifiers be the result of strictly splitting keyPath on U+002E FULL STOP characters (.).
+    auto identifiers = key_path_string.bytes_as_string_view().split_view('.', SplitBehavior::KeepEmpty);
+
+    // 4. For each identifier of identifiers, jump to the appropriate step below:
+    for (auto identifier : identifiers) {
+        // If Type(value) is String, and identifier is "length"
+        if (value.is_string() && identifier == "length"sv) {
+            // Let value be a Number equal to the number of elements in value.
+            value = JS::Value(value.as_string().utf16_string_view().length_in_code_units());
+            continue;
+        }
+
+        // If value is an Array and identifier is "length"
+        if (value.is_object() && is<JS::Array>(value.as_object()) && identifier == "length"sv) {
+            // Let value be ! ToLength(! Get(value, "length")).
+            value = JS::Value(TRY(JS::length_of_array_like(vm, value.as_object())));
+            continue;
+        }
+
+        // If value is a Blob and identifier is "size"
+        if (value.is_object() && is<FileAPI::Blob>(value.as_object()) && identifier == "size"sv) {
+            // Let value be a Number equal to value’s size.
+            value = JS::Value(static_cast<double>(static_cast<FileAPI::Blob const&>(value.as_object()).size()));
+            continue;
+        }
+
+        // If value is a Blob and identifier is "type"
+        if (value.is_object() && is<FileAPI::Blob>(value.as_object()) && identifier == "type"sv) {
+            // Let value be a String equal to value’s type.
+            value = JS::PrimitiveString::create(vm, static_cast<FileAPI::Blob const&>(value.as_object()).type());
+            continue;
+        }
+
+        // If value is a File and identifier is "name"
+        if (value.is_object() && is<FileAPI::File>(value.as_object()) && identifier == "name"sv) {
+            // Let value be a String equal to value’s name.
+            value = JS::PrimitiveString::create(vm, static_cast<FileAPI::File const&>(value.as_object()).name());
+            continue;
+        }
+
+        // If value is a File and identifier is "lastModified"
+        if (value.is_object() && is<FileAPI::File>(value.as_object()) && identifier == "lastModified"sv) {
+            // Let value be a Number equal to value’s lastModified.
+            value = JS::Value(static_cast<double>(static_cast<FileAPI::File const&>(value.as_object()).last_modified()));
+            continue;
+        }
+
+        // Otherwise
+        // 1. If Type(value) is not Object, return failure.
+        if (!value.is_object())
+            return OptionalNone {};
+
+        // 2. Let hop be ! HasOwnProperty(value, identifier).
+        auto property_key = JS::PropertyKey { MUST(FlyString::from_utf8(identifier)) };
+        auto hop = TRY(value.as_object().has_own_property(property_key));
+
+        // 3. If hop is false, return failure.
+        if (!hop)
+            return OptionalNone {};
+
+        // 4. Let value be ! Get(value, identifier).
+        value = TRY(value.as_object().get(property_key));
+
+        // 5. If value is undefined, return failure.
+        if (value.is_undefined())
+            return OptionalNone {};
+    }
+
+    // 5. Assert: value is not an abrupt completion.
+    // 6. Return value.
+    return value;
+}
+
+// https://w3c.github.io/IndexedDB/#extract-a-key-from-a-value-using-a-key-path
+WebIDL::ExceptionOr<ErrorOr<Key, KeyExtractionFailure>> extract_a_key_from_a_value_using_a_key_path(JS::Realm& realm, JS::Value value, KeyPath const& key_path, bool multi_entry)
+{
+    // 1. Let r be the result of evaluating a key path on a value with value and keyPath. Rethrow any exceptions.
+    auto r = TRY(evaluate_a_key_path_on_a_value(realm, value, key_path));
+
+    // 2. If r is failure, return failure.
+    if (!r.has_value())
+        return ErrorOr<Key, KeyExtractionFailure> { KeyExtractionFailure::KeyPathNotFound };
+
+    // 3. Let key be the result of converting a value to a key with r if the multiEntry flag is false, and the result
+    //    of converting a value to a multiEntry key with r otherwise. Rethrow any exceptions.
+    auto key = multi_entry ? TRY(convert_a_value_to_a_multi_entry_key(realm, *r)) : TRY(convert_a_value_to_a_key(realm, *r));
+
+    // 4. If key is invalid, return invalid.
+    if (!key.has_value())
+        return ErrorOr<Key, KeyExtractionFailure> { KeyExtractionFailure::InvalidKey };
+
+    // 5. Return key.
+    return ErrorOr<Key, KeyExtractionFailure> { key.release_value() };
+}
+
+// https://w3c.github.io/IndexedDB/#check-that-a-key-could-be-injected-into-a-value
+bool check_that_a_key_could_be_injected_into_a_value(JS::Realm&, JS::Value value, String const& key_path)
+{
+    // 1. Let identifiers be the result of strictly splitting keyPath on U+002E FULL STOP characters (.).
+    auto identifiers = key_path.bytes_as_string_view().split_view('.', SplitBehavior::KeepEmpty);
+
+    // 2. Assert: identifiers is not empty.
+    VERIFY(!identifiers.is_empty());
+
+    // 3. Remove the last item of identifiers.
+    identifiers.take_last();
+
+    // 4. For each remaining identifier of identifiers, if any:
+    for (auto identifier : identifiers) {
+        // 1. If value is not an Object or an Array, return false.
+        if (!value.is_object())
+            return false;
+
+        // 2. Let hop be ! HasOwnProperty(value, identifier).
+        auto property_key = JS::PropertyKey { MUST(FlyString::from_utf8(identifier)) };
+        auto hop = MUST(value.as_object().has_own_property(property_key));
+
+        // 3. If hop is false, return true.
+        if (!hop)
+            return true;
+
+        // 4. Let value be ! Get(value, identifier).
+        value = MUST(value.as_object().get(property_key));
+    }
+
+    // 5. Return true if value is an Object or an Array, or false otherwise.
+    return value.is_object();
+}
+
+// https://w3c.github.io/IndexedDB/#inject-a-key-into-a-value-using-a-key-path
+void inject_a_key_into_a_value_using_a_key_path(JS::Realm& realm, JS::Value value, Key const& key, String const& key_path)
+{
+    // 1. Let identifiers be the result of strictly splitting keyPath on U+002E FULL STOP characters (.).
+    auto identifiers = key_path.bytes_as_string_view().split_view('.', SplitBehavior::KeepEmpty);
+
+    // 2. Assert: identifiers is not empty.
+    VERIFY(!identifiers.is_empty());
+
+    // 3. Let last be the last item of identifiers and remove it from the list.
+    auto last = identifiers.take_last();
+
+    // 4. For each remaining identifier of identifiers:
+    for (auto identifier : identifiers) {
+        // 1. Assert: value is an Object or an Array.
+        VERIFY(value.is_object());
+
+        // 2. Let hop be ! HasOwnProperty(value, identifier).
+        auto property_key = JS::PropertyKey { MUST(FlyString::from_utf8(identifier)) };
+        auto hop = MUST(value.as_object().has_own_property(property_key));
+
+        // 3. If hop is false, then:
+        if (!hop) {
+            // 1. Let o be a new Object created as if by the expression ({}).
+            auto o = JS::Object::create(realm, realm.intrinsics().object_prototype());
+
+            // 2. Let status be CreateDataProperty(value, identifier, o).
+            // 3. Assert: status is true.
+            MUST(value.as_object().create_data_property(property_key, o));
+        }
+
+        // 4. Let value be ! Get(value, identifier).
+        value = MUST(value.as_object().get(property_key));
+    }
+
+    // 5. Assert: value is an Object or an Array.
+    VERIFY(value.is_object());
+
+    // 6. Let keyValue be the result of converting a key to a value with key.
+    auto key_value = convert_a_key_to_a_value(realm, key);
+
+    // 7. Let status be CreateDataProperty(value, last, keyValue).
+    // 8. Assert: status is true.
+    MUST(value.as_object().create_data_property(MUST(FlyString::from_utf8(last)), key_value));
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Value.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#key-construct
+class Key {
+public:
+    // NOTE: The order of these matters, as keys of different types are ordered by their type.
+    enum class Type : u8 {
+        Number,
+        Date,
+        String,
+        Binary,
+        Array,
+    };
+
+    static Key create_number(double value) { return Key { Type::Number, value }; }
+    static Key create_date(double value) { return Key { Type::Date, value }; }
+    static Key create_string(String value) { return Key { Type::String, move(value) }; }
+    static Key create_binary(ByteBuffer value) { return Key { Type::Binary, move(value) }; }
+    static Key create_array(Vector<Key> value) { return Key { Type::Array, move(value) }; }
+
+    Type type() const { return m_type; }
+
+    double number() const { return m_value.get<double>(); }
+    String const& string() const { return m_value.get<String>(); }
+    ByteBuffer const& binary() const { return m_value.get<ByteBuffer>(); }
+    Vector<Key> const& array() const { return m_value.get<Vector<Key>>(); }
+
+    bool operator==(Key const& other) const;
+
+private:
+    Key(Type type, Variant<double, String, ByteBuffer, Vector<Key>> value)
+        : m_type(type)
+        , m_value(move(value))
+    {
+    }
+
+    Type m_type;
+    Variant<double, String, ByteBuffer, Vector<Key>> m_value;
+};
+
+// https://w3c.github.io/IndexedDB/#compare-two-keys
+int compare_two_keys(Key const& a, Key const& b);
+
+// https://w3c.github.io/IndexedDB/#key-path-construct
+using KeyPath = Variant<String, Vector<String>>;
+
+// https://w3c.github.io/IndexedDB/#valid-key-path
+bool is_valid_key_path(KeyPath const&);
+
+JS::Value key_path_to_value(JS::Realm&, KeyPath const&);
+
+// https://w3c.github.io/IndexedDB/#range-construct
+struct KeyRange {
+    Optional<Key> lower_bound;
+    Optional<Key> upper_bound;
+    bool lower_open { false };
+    bool upper_open { false };
+
+    static KeyRange only(Key key) { return { key, key, false, false }; }
+    static KeyRange unbounded() { return {}; }
+
+    // https://w3c.github.io/IndexedDB/#in
+    bool contains(Key const&) const;
+};
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key
+// NOTE: An empty Optional is returned if the value is not a valid key ("invalid" in the spec).
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_key(JS::Realm&, JS::Value input);
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-multientry-key
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_multi_entry_key(JS::Realm&, JS::Value input);
+
+// https://w3c.github.io/IndexedDB/#convert-a-key-to-a-value
+JS::Value convert_a_key_to_a_value(JS::Realm&, Key const&);
+
+// Like "convert a value to a key", but throws a "DataError" DOMException if the value is not a valid key.
+WebIDL::ExceptionOr<Key> convert_a_value_to_a_key_or_throw(JS::Realm&, JS::Value input);
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key-range
+WebIDL::ExceptionOr<KeyRange> convert_a_value_to_a_key_range(JS::Realm&, JS::Value, bool null_disallowed = false);
+
+enum class KeyExtractionFailure {
+    // The key path did not resolve to a value ("failure" in the spec).
+    KeyPathNotFound,
+    // The key path resolved to a value that is not a valid key ("invalid" in the spec).
+    InvalidKey,
+};
+
+// https://w3c.github.io/IndexedDB/#extract-a-key-from-a-value-using-a-key-path
+WebIDL::ExceptionOr<ErrorOr<Key, KeyExtractionFailure>> extract_a_key_from_a_value_using_a_key_path(JS::Realm&, JS::Value, KeyPath const&, bool multi_entry = false);
+
+// https://w3c.github.io/IndexedDB/#check-that-a-key-could-be-injected-into-a-value
+bool check_that_a_key_could_be_injected_into_a_value(JS::Realm&, JS::Value, String const& key_path);
+
+// https://w3c.github.io/IndexedDB/#inject-a-key-into-a-value-using-a-key-path
+void inject_a_key_into_a_value_using_a_key_path(JS::Realm&, JS::Value, Key const&, String const& key_path);
+
+}
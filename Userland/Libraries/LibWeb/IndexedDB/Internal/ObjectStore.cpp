@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+
+namespace Web::IndexedDB {
+
+size_t ObjectStore::lower_bound(KeyRange const& range) const
+{
+    if (!range.lower_bound.has_value())
+        return 0;
+    return lower_bound(*range.lower_bound, !range.lower_open);
+}
+
+// https://w3c.github.io/IndexedDB/#generate-a-key
+static constexpr u64 maximum_key_generator_value = 9007199254740992; // 2^53
+
+NonnullRefPtr<ObjectStore> ObjectStore::create(Database& database, String name, Optional<KeyPath> key_path, bool auto_increment)
+{
+    return adopt_ref(*new ObjectStore(database, move(name), move(key_path), auto_increment));
+}
+
+ObjectStore::ObjectStore(Database& database, String name, Optional<KeyPath> key_path, bool auto_increment)
+    : m_database(database)
+    , m_name(move(name))
+    , m_key_path(move(key_path))
+{
+    // When a key generator is first created for an object store, its current number is 1.
+    if (auto_increment)
+        m_key_generator_current_number = 1;
+}
+
+size_t ObjectStore::lower_bound(Key const& key, bool inclusive) const
+{
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto result = compare_two_keys(m_records[middle].key, key);
+        if (result < 0 || (result == 0 && !inclusive))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+ObjectStore::Record const* ObjectStore::record_with_key(Key const& key) const
+{
+    auto position = lower_bound(key);
+    if (position < m_records.size() && m_records[position].key == key)
+        return &m_records[position];
+    return nullptr;
+}
+
+void ObjectStore::store_record(Key key, HTML::SerializationRecord value)
+{
+    auto position = lower_bound(key);
+    if (position < m_records.size() && m_records[position].key == key) {
+        m_records[position].value = move(value);
+        return;
+    }
+    m_records.insert(position, Record { move(key), move(value) });
+}
+
+Optional<ObjectStore::Record> ObjectStore::remove_record(Key const& key)
+{
+    auto position = lower_bound(key);
+    if (position < m_records.size() && m_records[position].key == key)
+        return m_records.take(position);
+    return {};
+}
+
+Vector<ObjectStore::Record> ObjectStore::take_records()
+{
+    return move(m_records);
+}
+
+void ObjectStore::restore_records(Vector<Record> records)
+{
+    m_records = move(records);
+}
+
+// https://w3c.github.io/IndexedDB/#generate-a-key
+Optional<Key> ObjectStore::generate_a_key()
+{
+    // 1. Let generator be store’s key generator.
+    VERIFY(m_key_generator_current_number.has_value());
+
+    // 2. Let key be generator’s current number.
+    auto key = *m_key_generator_current_number;
+
+    // 3. If key is greater than 2^53 (9007199254740992), then return failure.
+    if (key > maximum_key_generator_value)
+        return {};
+
+    // 4. Increase generator’s current number by 1.
+    m_key_generator_current_number = key + 1;
+
+    // 5. Return key.
+    return Key::create_number(static_cast<double>(key));
+}
+
+// https://w3c.github.io/IndexedDB/#possibly-update-the-key-generator
+void ObjectStore::possibly_update_the_key_generator(Key const& key)
+{
+    // 1. If the type of key is not number, abort these steps.
+    if (key.type() != Key::Type::Number)
+        return;
+
+    // 2. Let value be the value of key.
+    // 3. Set value to the minimum of value and 2^53 (9007199254740992).
+    auto value = min(key.number(), static_cast<double>(maximum_key_generator_value));
+
+    // 4. Set value to the largest integer not greater than value.
+    value = AK::floor(value);
+
+    // 5. Let generator be store’s key generator.
+    // 6. If value is greater than or equal to generator’s current number, then set generator’s current number to
+    //    value + 1.
+    if (value >= static_cast<double>(*m_key_generator_current_number))
+        m_key_generator_current_number = static_cast<u64>(value) + 1;
+}
+
+void ObjectStore::add_index(NonnullRefPtr<Index> index)
+{
+    m_indexes.set(index->name(), move(index));
+}
+
+void ObjectStore::remove_index(String const& name)
+{
+    m_indexes.remove(name);
+}
+
+void ObjectStore::rename_index(String const& old_name, String const& new_name)
+{
+    auto index = m_indexes.take(old_name).release_value();
+    index->set_name(new_name);
+    m_indexes.set(new_name, move(index));
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/IndexedDB/Internal/Index.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+class Database;
+
+// https://w3c.github.io/IndexedDB/#object-store-construct
+class ObjectStore : public RefCounted<ObjectStore> {
+public:
+    // An object store’s list of records, each of which has a key and the serialized value it maps to.
+    struct Record {
+        Key key;
+        HTML::SerializationRecord value;
+    };
+
+    static NonnullRefPtr<ObjectStore> create(Database&, String name, Optional<KeyPath>, bool auto_increment);
+
+    Database& database() const { return m_database; }
+
+    String const& name() const { return m_name; }
+    void set_name(String name) { m_name = move(name); }
+
+    Optional<KeyPath> const& key_path() const { return m_key_path; }
+    bool uses_in_line_keys() const { return m_key_path.has_value(); }
+
+    bool is_deleted() const { return m_deleted; }
+    void set_deleted(bool deleted) { m_deleted = deleted; }
+
+    // Records are kept sorted by key.
+    Vector<Record> const& records() const { return m_records; }
+
+    Record const* record_with_key(Key const&) const;
+    void store_record(Key key, HTML::SerializationRecord value);
+    Optional<Record> remove_record(Key const&);
+    Vector<Record> take_records();
+    void restore_records(Vector<Record>);
+
+    // Returns the position of the first record whose key is greater than the given key, or equal to it if inclusive
+    // is true.
+    size_t lower_bound(Key const&, bool inclusive = true) const;
+
+    // Returns the position of the first record whose key may be in the given range.
+    size_t lower_bound(KeyRange const&) const;
+
+    // https://w3c.github.io/IndexedDB/#key-generator-construct
+    bool has_key_generator() const { return m_key_generator_current_number.has_value(); }
+
+    // https://w3c.github.io/IndexedDB/#key-generator-current-number
+    // NOTE: This is only exposed so that changes to the key generator can be reverted when a transaction is aborted.
+    Optional<u64> key_generator_current_number() const { return m_key_generator_current_number; }
+    void set_key_generator_current_number(Optional<u64> number) { m_key_generator_current_number = number; }
+
+    // https://w3c.github.io/IndexedDB/#generate-a-key
+    Optional<Key> generate_a_key();
+
+    // https://w3c.github.io/IndexedDB/#possibly-update-the-key-generator
+    void possibly_update_the_key_generator(Key const&);
+
+    OrderedHashMap<String, NonnullRefPtr<Index>> const& indexes() const { return m_indexes; }
+    RefPtr<Index> index(String const& name) const { return m_indexes.get(name).value_or(nullptr); }
+    void add_index(NonnullRefPtr<Index>);
+    void remove_index(String const& name);
+    void rename_index(String const& old_name, String const& new_name);
+
+private:
+    ObjectStore(Database&, String name, Optional<KeyPath>, bool auto_increment);
+
+    Database& m_database;
+    String m_name;
+    Optional<KeyPath> m_key_path;
+    bool m_deleted { false };
+
+    Vector<Record> m_records;
+
+    // https://w3c.github.io/IndexedDB/#key-generator-current-number
+    Optional<u64> m_key_generator_current_number;
+
+    OrderedHashMap<String, NonnullRefPtr<Index>> m_indexes;
+};
+
+}
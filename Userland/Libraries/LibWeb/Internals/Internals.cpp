@@ -4,14 +4,19 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonObject.h>
+#include <AK/Time.h>
+#include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
 #include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
@@ -57,6 +62,16 @@ void Internals::gc()
     vm().heap().collect_garbage();
 }
 
+JS::Value Internals::heap_statistics()
+{
+    return JS::JSONObject::parse_json_value(vm(), vm().heap().dump_cell_statistics());
+}
+
+JS::Value Internals::event_loop_statistics()
+{
+    return JS::JSONObject::parse_json_value(vm(), HTML::main_thread_event_loop().statistics().to_json());
+}
+
 JS::Object* Internals::hit_test(double x, double y)
 {
     auto& active_document = internals_window().associated_document();
@@ -183,4 +198,80 @@ void Internals::simulate_drop(double x, double y)
     page.handle_drag_and_drop_event(DragEvent::Type::Drop, position, position, UIEvents::MouseButton::Primary, 0, 0, {});
 }
 
+static double milliseconds_since(MonotonicTime start)
+{
+    return static_cast<double>((MonotonicTime::now() - start).to_nanoseconds()) / 1'000'000.0;
+}
+
+double Internals::measure_style_update()
+{
+    auto& document = internals_window().associated_document();
+    document.update_layout();
+
+    document.invalidate_style(DOM::StyleInvalidationReason::Other);
+
+    auto start = MonotonicTime::now();
+    document.update_style();
+    return milliseconds_since(start);
+}
+
+static void collect_matching_rules_recursively(DOM::Element const& element, CSS::StyleComputer& style_computer)
+{
+    (void)style_computer.collect_matching_rules(element, CSS::CascadeOrigin::UserAgent, {});
+    (void)style_computer.collect_matching_rules(element, CSS::CascadeOrigin::Author, {});
+
+    style_computer.push_ancestor(element);
+    element.for_each_child_of_type<DOM::Element>([&](auto const& child) {
+        collect_matching_rules_recursively(child, style_computer);
+        return IterationDecision::Continue;
+    });
+    style_computer.pop_ancestor(element);
+}
+
+// Only runs selector matching for every element, without cascading or computing any values.
+double Internals::measure_selector_matching()
+{
+    auto& document = internals_window().associated_document();
+    document.update_layout();
+
+    auto* document_element = document.document_element();
+    if (!document_element)
+        return 0;
+
+    auto& style_computer = document.style_computer();
+
+    auto start = MonotonicTime::now();
+    style_computer.reset_ancestor_filter();
+    collect_matching_rules_recursively(*document_element, style_computer);
+    return milliseconds_since(start);
+}
+
+// Lays out the existing layout tree again, without rebuilding it.
+double Internals::measure_layout()
+{
+    auto& document = internals_window().associated_document();
+    document.update_layout();
+
+    document.set_needs_layout();
+
+    auto start = MonotonicTime::now();
+    document.update_layout();
+    return milliseconds_since(start);
+}
+
+double Internals::measure_display_list_recording()
+{
+    auto& document = internals_window().associated_document();
+    document.update_layout();
+
+    if (!document.paintable())
+        return 0;
+
+    document.invalidate_display_list();
+
+    auto start = MonotonicTime::now();
+    (void)document.record_display_list({});
+    return milliseconds_since(start);
+}
+
 }
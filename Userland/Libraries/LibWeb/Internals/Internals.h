@@ -22,6 +22,8 @@ public:
     void signal_text_test_is_done(String const& text);
 
     void gc();
+    JS::Value heap_statistics();
+    JS::Value event_loop_statistics();
     JS::Object* hit_test(double x, double y);
 
     void send_text(HTML::HTMLElement&, String const&);
@@ -43,6 +45,11 @@ public:
     void simulate_drag_move(double x, double y);
     void simulate_drop(double x, double y);
 
+    double measure_style_update();
+    double measure_selector_matching();
+    double measure_layout();
+    double measure_display_list_recording();
+
 private:
     explicit Internals(JS::Realm&);
     virtual void initialize(JS::Realm&) override;
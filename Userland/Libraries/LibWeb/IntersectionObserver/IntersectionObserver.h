@@ -33,6 +33,10 @@ struct IntersectionObserverRegistration {
     // https://www.w3.org/TR/intersection-observer/#dom-intersectionobserverregistration-previousisintersecting
     // [A] previousIsIntersecting property holding a boolean.
     bool previous_is_intersecting { false };
+
+    // AD-HOC: The layout and scroll generations of the target's document when this registration was last updated.
+    Optional<u64> last_update_layout_generation;
+    u64 last_update_scroll_generation { 0 };
 };
 
 // https://w3c.github.io/IntersectionObserver/#intersection-observer-interface
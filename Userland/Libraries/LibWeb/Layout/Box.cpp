@@ -28,6 +28,37 @@ Box::~Box()
 {
 }
 
+void Box::set_natural_width(Optional<CSSPixels> width)
+{
+    if (m_natural_width == width)
+        return;
+    m_natural_width = width;
+    invalidate_intrinsic_sizes();
+}
+
+void Box::set_natural_height(Optional<CSSPixels> height)
+{
+    if (m_natural_height == height)
+        return;
+    m_natural_height = height;
+    invalidate_intrinsic_sizes();
+}
+
+void Box::set_natural_aspect_ratio(Optional<CSSPixelFraction> ratio)
+{
+    if (m_natural_aspect_ratio == ratio)
+        return;
+    m_natural_aspect_ratio = ratio;
+    invalidate_intrinsic_sizes();
+}
+
+Box::IntrinsicSizeCache& Box::intrinsic_size_cache() const
+{
+    if (!m_intrinsic_size_cache)
+        m_intrinsic_size_cache = make<IntrinsicSizeCache>();
+    return *m_intrinsic_size_cache;
+}
+
 void Box::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
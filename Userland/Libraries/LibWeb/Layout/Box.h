@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <LibGfx/Rect.h>
 #include <LibJS/Heap/Cell.h>
@@ -36,9 +37,9 @@ public:
     bool has_natural_height() const { return natural_height().has_value(); }
     bool has_natural_aspect_ratio() const { return natural_aspect_ratio().has_value(); }
 
-    void set_natural_width(Optional<CSSPixels> width) { m_natural_width = width; }
-    void set_natural_height(Optional<CSSPixels> height) { m_natural_height = height; }
-    void set_natural_aspect_ratio(Optional<CSSPixelFraction> ratio) { m_natural_aspect_ratio = ratio; }
+    void set_natural_width(Optional<CSSPixels>);
+    void set_natural_height(Optional<CSSPixels>);
+    void set_natural_aspect_ratio(Optional<CSSPixelFraction>);
 
     // https://www.w3.org/TR/css-sizing-4/#preferred-aspect-ratio
     Optional<CSSPixelFraction> preferred_aspect_ratio() const;
@@ -58,6 +59,40 @@ public:
     void clear_contained_abspos_children() { m_contained_abspos_children.clear(); }
     Vector<JS::NonnullGCPtr<Node>> const& contained_abspos_children() const { return m_contained_abspos_children; }
 
+    // Min-/max-content sizes memoized across layouts. Widths are keyed by the definite height the box had
+    // when they were computed (if any), heights by the width they were computed for.
+    // Node::invalidate_intrinsic_sizes() drops this whenever something in the subtree that affects them changes.
+    struct IntrinsicSizeCache {
+        struct Widths {
+            Optional<CSSPixels> for_indefinite_height;
+            HashMap<CSSPixels, CSSPixels> for_definite_height;
+
+            Optional<CSSPixels> get(Optional<CSSPixels> height) const
+            {
+                if (!height.has_value())
+                    return for_indefinite_height;
+                return for_definite_height.get(*height);
+            }
+
+            void set(Optional<CSSPixels> height, CSSPixels width)
+            {
+                if (!height.has_value())
+                    for_indefinite_height = width;
+                else
+                    for_definite_height.set(*height, width);
+            }
+        };
+
+        Widths min_content_width;
+        Widths max_content_width;
+
+        HashMap<CSSPixels, CSSPixels> min_content_height;
+        HashMap<CSSPixels, CSSPixels> max_content_height;
+    };
+
+    IntrinsicSizeCache& intrinsic_size_cache() const;
+    void clear_intrinsic_size_cache() const { m_intrinsic_size_cache = nullptr; }
+
     virtual void visit_edges(Cell::Visitor&) override;
 
 protected:
@@ -71,6 +106,8 @@ private:
     Optional<CSSPixels> m_natural_height;
     Optional<CSSPixelFraction> m_natural_aspect_ratio;
 
+    mutable OwnPtr<IntrinsicSizeCache> m_intrinsic_size_cache;
+
     Vector<JS::NonnullGCPtr<Node>> m_contained_abspos_children;
 };
 
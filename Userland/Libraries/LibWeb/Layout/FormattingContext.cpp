@@ -1456,13 +1456,19 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
 
     auto& root_state = m_state.m_root;
 
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+    auto& cache = root_state.ensure_intrinsic_sizes(box);
     if (cache.min_content_width.has_value())
         return *cache.min_content_width;
 
     LayoutState throwaway_state(&m_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
+    auto definite_height = box_state.has_definite_height() ? box_state.content_height() : Optional<CSSPixels> {};
+    if (auto width = box.intrinsic_size_cache().min_content_width.get(definite_height); width.has_value()) {
+        cache.min_content_width = width;
+        return *width;
+    }
+
     box_state.width_constraint = SizeConstraint::MinContent;
     box_state.set_indefinite_content_width();
 
@@ -1486,6 +1492,7 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
         cache.min_content_width = 0;
     }
 
+    box.intrinsic_size_cache().min_content_width.set(definite_height, *cache.min_content_width);
     return *cache.min_content_width;
 }
 
@@ -1496,13 +1503,19 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
 
     auto& root_state = m_state.m_root;
 
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+    auto& cache = root_state.ensure_intrinsic_sizes(box);
     if (cache.max_content_width.has_value())
         return *cache.max_content_width;
 
     LayoutState throwaway_state(&m_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
+    auto definite_height = box_state.has_definite_height() ? box_state.content_height() : Optional<CSSPixels> {};
+    if (auto width = box.intrinsic_size_cache().max_content_width.get(definite_height); width.has_value()) {
+        cache.max_content_width = width;
+        return *width;
+    }
+
     box_state.width_constraint = SizeConstraint::MaxContent;
     box_state.set_indefinite_content_width();
 
@@ -1526,6 +1539,7 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
         cache.max_content_width = 0;
     }
 
+    box.intrinsic_size_cache().max_content_width.set(definite_height, *cache.max_content_width);
     return *cache.max_content_width;
 }
 
@@ -1541,13 +1555,18 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
         auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+        auto& cache = root_state.ensure_intrinsic_sizes(box);
         return &cache.min_content_height.ensure(width);
     };
 
     if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
         return cache_slot->value();
 
+    if (auto height = box.intrinsic_size_cache().min_content_height.get(width); height.has_value()) {
+        *get_cache_slot() = height;
+        return *height;
+    }
+
     LayoutState throwaway_state(&m_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
@@ -1572,6 +1591,7 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
     if (auto* cache_slot = get_cache_slot()) {
         *cache_slot = min_content_height;
     }
+    box.intrinsic_size_cache().min_content_height.set(width, min_content_height);
     return min_content_height;
 }
 
@@ -1585,13 +1605,18 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
         auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
+        auto& cache = root_state.ensure_intrinsic_sizes(box);
         return &cache.max_content_height.ensure(width);
     };
 
     if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
         return cache_slot->value();
 
+    if (auto height = box.intrinsic_size_cache().max_content_height.get(width); height.has_value()) {
+        *get_cache_slot() = height;
+        return *height;
+    }
+
     LayoutState throwaway_state(&m_state);
 
     auto& box_state = throwaway_state.get_mutable(box);
@@ -1617,6 +1642,7 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
     if (auto* cache_slot = get_cache_slot()) {
         *cache_slot = max_content_height;
     }
+    box.intrinsic_size_cache().max_content_height.set(width, max_content_height);
 
     return max_content_height;
 }
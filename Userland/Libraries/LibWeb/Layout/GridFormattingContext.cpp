@@ -590,22 +590,46 @@ void GridFormattingContext::resolve_intrinsic_track_sizes(GridDimension const di
 
     // FIXME: 1. Shim baseline-aligned items so their intrinsic size contributions reflect their baseline alignment.
 
-    // 2. Size tracks to fit non-spanning items:
-    increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, 1);
+    // Collect the tracks spanned by each item once, and group the items the way the following steps consider
+    // them: by span size for items that don't cross a flexible track, and all together for those that do.
+    Vector<Vector<SpanningGridItem>> items_by_span;
+    Vector<SpanningGridItem> items_crossing_flexible_tracks;
+    for (auto& item : m_grid_items) {
+        Vector<GridTrack&> spanned_tracks;
+        for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
+            spanned_tracks.append(track);
+        });
+
+        auto item_spans_tracks_with_flexible_sizing_function = any_of(spanned_tracks, [](auto& track) {
+            return track.max_track_sizing_function.is_flexible_length();
+        });
+        if (item_spans_tracks_with_flexible_sizing_function) {
+            items_crossing_flexible_tracks.append({ item, move(spanned_tracks) });
+            continue;
+        }
+
+        auto item_span = item.span(dimension);
+        if (items_by_span.size() <= item_span)
+            items_by_span.resize(item_span + 1);
+        items_by_span[item_span].append({ item, move(spanned_tracks) });
+    }
 
+    // Only the tracks spanned by the item under consideration change, so only those need their growth limit checked
+    // against their base size. The exceptions are fit-content() tracks whose growth limit gets clamped below their
+    // base size; those are remembered and fixed up along with the next item's tracks, as if all tracks were checked.
+    Vector<GridTrack&> tracks_with_clamped_growth_limit;
+
+    // 2. Size tracks to fit non-spanning items:
     // 3. Increase sizes to accommodate spanning items crossing content-sized tracks: Next, consider the
     // items with a span of 2 that do not span a track with a flexible sizing function.
     // Repeat incrementally for items with greater spans until all items have been considered.
-    size_t max_item_span = 1;
-    for (auto& item : m_grid_items)
-        max_item_span = max(item.span(dimension), max_item_span);
-    for (size_t span = 2; span <= max_item_span; span++)
-        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, span);
+    for (size_t span = 1; span < items_by_span.size(); span++)
+        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, items_by_span[span], tracks_with_clamped_growth_limit);
 
     // 4. Increase sizes to accommodate spanning items crossing flexible tracks: Next, repeat the previous
     // step instead considering (together, rather than grouped by span size) all items that do span a
     // track with a flexible sizing function while
-    increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(dimension);
+    increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(dimension, items_crossing_flexible_tracks, tracks_with_clamped_growth_limit);
 
     // 5. If any track still has an infinite growth limit (because, for example, it had no items placed in
     // it or it is a flexible track), set its growth limit to its base size.
@@ -775,26 +799,21 @@ void GridFormattingContext::distribute_extra_space_across_spanned_tracks_growth_
     }
 }
 
-void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension const dimension, size_t span)
+void GridFormattingContext::increase_growth_limits_to_base_sizes(Vector<GridTrack&>& tracks)
 {
-    auto& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
-    auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
-    for (auto& item : m_grid_items) {
-        auto const item_span = item.span(dimension);
-        if (item_span != span)
+    for (auto& track : tracks) {
+        if (track.is_gap)
             continue;
+        if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
+            track.growth_limit = track.base_size;
+    }
+}
 
-        Vector<GridTrack&> spanned_tracks;
-        for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
-            spanned_tracks.append(track);
-        });
-
-        auto item_spans_tracks_with_flexible_sizing_function = any_of(spanned_tracks, [](auto& track) {
-            return track.max_track_sizing_function.is_flexible_length();
-        });
-        if (item_spans_tracks_with_flexible_sizing_function)
-            continue;
+void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension const dimension, Vector<SpanningGridItem>& items, Vector<GridTrack&>& tracks_with_clamped_growth_limit)
+{
+    auto& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
 
+    for (auto& [item, spanned_tracks] : items) {
         // 1. For intrinsic minimums: First increase the base size of tracks with an intrinsic min track sizing
         //    function by distributing extra space as needed to accommodate these items’ minimum contributions.
         auto item_size_contribution = [&] {
@@ -840,10 +859,9 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
         // 4. If at this point any track’s growth limit is now less than its base size, increase its growth limit to
         //    match its base size.
-        for (auto& track : tracks) {
-            if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
-                track.growth_limit = track.base_size;
-        }
+        increase_growth_limits_to_base_sizes(spanned_tracks);
+        increase_growth_limits_to_base_sizes(tracks_with_clamped_growth_limit);
+        tracks_with_clamped_growth_limit.clear();
 
         // 5. For intrinsic maximums: Next increase the growth limit of tracks with an intrinsic max track sizing
         distribute_extra_space_across_spanned_tracks_growth_limit(item_min_content_contribution, spanned_tracks, [&](GridTrack const& track) {
@@ -878,6 +896,8 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
                     auto fit_content_limit = track.max_track_sizing_function.css_size().to_px(grid_container(), available_size.to_px_or_zero());
                     if (track.growth_limit.value() > fit_content_limit)
                         track.growth_limit = fit_content_limit;
+                    if (track.growth_limit.value() < track.base_size)
+                        tracks_with_clamped_growth_limit.append(track);
                 }
             } else if (!track.growth_limit.has_value()) {
                 // If the affected size is an infinite growth limit, set it to the track’s base size plus the planned increase.
@@ -890,21 +910,9 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
     }
 }
 
-void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension const dimension)
+void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension const dimension, Vector<SpanningGridItem>& items, Vector<GridTrack&>& tracks_with_clamped_growth_limit)
 {
-    auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
-    for (auto& item : m_grid_items) {
-        Vector<GridTrack&> spanned_tracks;
-        for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
-            spanned_tracks.append(track);
-        });
-
-        auto item_spans_tracks_with_flexible_sizing_function = any_of(spanned_tracks, [](auto& track) {
-            return track.max_track_sizing_function.is_flexible_length();
-        });
-        if (!item_spans_tracks_with_flexible_sizing_function)
-            continue;
-
+    for (auto& [item, spanned_tracks] : items) {
         // 1. For intrinsic minimums: First increase the base size of tracks with an intrinsic min track sizing
         //    function by distributing extra space as needed to accommodate these items’ minimum contributions.
         auto item_minimum_contribution = calculate_minimum_contribution(item, dimension);
@@ -920,10 +928,9 @@ void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossin
 
         // 4. If at this point any track’s growth limit is now less than its base size, increase its growth limit to
         //    match its base size.
-        for (auto& track : tracks) {
-            if (track.growth_limit.has_value() && track.growth_limit.value() < track.base_size)
-                track.growth_limit = track.base_size;
-        }
+        increase_growth_limits_to_base_sizes(spanned_tracks);
+        increase_growth_limits_to_base_sizes(tracks_with_clamped_growth_limit);
+        tracks_with_clamped_growth_limit.clear();
     }
 }
 
@@ -1170,6 +1177,11 @@ void GridFormattingContext::run_track_sizing(GridDimension const dimension)
     // https://www.w3.org/TR/css-grid-2/#algo-track-sizing
     // 12.3. Track Sizing Algorithm
 
+    for (auto& item : m_grid_items) {
+        item.cached_min_content_contribution = {};
+        item.cached_max_content_contribution = {};
+    }
+
     // 1. Initialize Track Sizes
     initialize_track_sizes(dimension);
 
@@ -2318,8 +2330,11 @@ CSSPixels GridFormattingContext::calculate_min_content_contribution(GridItem con
     }
 
     if (should_treat_preferred_size_as_auto) {
-        auto result = item.add_margin_box_sizes(calculate_min_content_size(item, dimension), dimension, m_state);
-        return min(result, maxium_size);
+        if (!item.cached_min_content_contribution.has_value()) {
+            auto result = item.add_margin_box_sizes(calculate_min_content_size(item, dimension), dimension, m_state);
+            item.cached_min_content_contribution = min(result, maxium_size);
+        }
+        return item.cached_min_content_contribution.value();
     }
 
     auto preferred_size = get_item_preferred_size(item, dimension);
@@ -2345,9 +2360,12 @@ CSSPixels GridFormattingContext::calculate_max_content_contribution(GridItem con
 
     auto preferred_size = get_item_preferred_size(item, dimension);
     if (should_treat_preferred_size_as_auto || preferred_size.is_fit_content()) {
-        auto fit_content_size = dimension == GridDimension::Column ? calculate_fit_content_width(item.box, available_space_for_item) : calculate_fit_content_height(item.box, available_space_for_item);
-        auto result = item.add_margin_box_sizes(fit_content_size, dimension, m_state);
-        return min(result, maxium_size);
+        if (!item.cached_max_content_contribution.has_value()) {
+            auto fit_content_size = dimension == GridDimension::Column ? calculate_fit_content_width(item.box, available_space_for_item) : calculate_fit_content_height(item.box, available_space_for_item);
+            auto result = item.add_margin_box_sizes(fit_content_size, dimension, m_state);
+            item.cached_max_content_contribution = min(result, maxium_size);
+        }
+        return item.cached_max_content_contribution.value();
     }
 
     auto containing_block_size = containing_block_size_for_item(item, dimension);
@@ -51,6 +51,11 @@ struct GridItem {
 
     [[nodiscard]] int gap_adjusted_row() const;
     [[nodiscard]] int gap_adjusted_column() const;
+
+    // Contributions that only depend on the item's content (and not on the sizes of the tracks it spans) stay the
+    // same for the whole run of the track sizing algorithm, so they are cached until the next run.
+    mutable Optional<CSSPixels> cached_min_content_contribution {};
+    mutable Optional<CSSPixels> cached_max_content_contribution {};
 };
 
 enum class FoundUnoccupiedPlace {
@@ -286,10 +291,16 @@ private:
     template<typename Match>
     void distribute_extra_space_across_spanned_tracks_growth_limit(CSSPixels item_size_contribution, Vector<GridTrack&>& spanned_tracks, Match matcher);
 
+    struct SpanningGridItem {
+        GridItem const& item;
+        Vector<GridTrack&> spanned_tracks;
+    };
+
     void initialize_track_sizes(GridDimension);
     void resolve_intrinsic_track_sizes(GridDimension);
-    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, size_t span);
-    void increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension);
+    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, Vector<SpanningGridItem>& items, Vector<GridTrack&>& tracks_with_clamped_growth_limit);
+    void increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension, Vector<SpanningGridItem>& items, Vector<GridTrack&>& tracks_with_clamped_growth_limit);
+    void increase_growth_limits_to_base_sizes(Vector<GridTrack&>& tracks);
     void maximize_tracks_using_available_size(AvailableSpace const& available_space, GridDimension dimension);
     void maximize_tracks(GridDimension);
     void expand_flexible_tracks(GridDimension);
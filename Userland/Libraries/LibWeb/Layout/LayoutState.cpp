@@ -29,27 +29,33 @@ LayoutState::~LayoutState()
 {
 }
 
+LayoutState::UsedValues& LayoutState::create_used_values(NodeWithStyle const& node, Optional<UsedValues const&> copy_from) const
+{
+    UsedValues* used_values = nullptr;
+    if (copy_from.has_value()) {
+        used_values = m_used_values_allocator.allocate(*copy_from);
+        VERIFY(used_values);
+    } else {
+        auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+        used_values = m_used_values_allocator.allocate();
+        VERIFY(used_values);
+        used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
+    }
+    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, used_values);
+    return *used_values;
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
     if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
         return *used_values;
 
     for (auto const* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent) {
-        if (auto* ancestor_used_values = ancestor->used_values_per_layout_node.get(node).value_or(nullptr)) {
-            auto cow_used_values = adopt_own(*new UsedValues(*ancestor_used_values));
-            auto* cow_used_values_ptr = cow_used_values.ptr();
-            used_values_per_layout_node.set(node, move(cow_used_values));
-            return *cow_used_values_ptr;
-        }
+        if (auto const* ancestor_used_values = ancestor->used_values_per_layout_node.get(node).value_or(nullptr))
+            return create_used_values(node, *ancestor_used_values);
     }
 
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
-
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return create_used_values(node, {});
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
@@ -62,13 +68,16 @@ LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
             return *ancestor_used_values;
     }
 
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+    return create_used_values(node, {});
+}
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+LayoutState::IntrinsicSizes& LayoutState::ensure_intrinsic_sizes(NodeWithStyle const& node) const
+{
+    return *intrinsic_sizes.ensure(&node, [this] {
+        auto* sizes = m_intrinsic_sizes_allocator.allocate();
+        VERIFY(sizes);
+        return sizes;
+    });
 }
 
 // https://www.w3.org/TR/css-overflow-3/#scrollable-overflow
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/BumpAllocator.h>
 #include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -55,6 +57,10 @@ struct StaticPositionRect {
 };
 
 struct LayoutState {
+    AK_MAKE_NONCOPYABLE(LayoutState);
+    AK_MAKE_NONMOVABLE(LayoutState);
+
+public:
     LayoutState()
         : m_root(*this)
     {
@@ -226,10 +232,11 @@ struct LayoutState {
     // NOTE: get() will not CoW the UsedValues.
     UsedValues const& get(NodeWithStyle const&) const;
 
-    HashMap<JS::NonnullGCPtr<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    HashMap<JS::NonnullGCPtr<Layout::Node const>, UsedValues*> used_values_per_layout_node;
 
     // We cache intrinsic sizes once determined, as they will not change over the course of a full layout.
     // This avoids computing them several times while performing flex layout.
+    // Results are also memoized across layouts on the box itself, see Box::IntrinsicSizeCache.
     struct IntrinsicSizes {
         Optional<CSSPixels> min_content_width;
         Optional<CSSPixels> max_content_width;
@@ -238,13 +245,22 @@ struct LayoutState {
         HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
     };
 
-    HashMap<JS::GCPtr<NodeWithStyle const>, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
+    HashMap<JS::GCPtr<NodeWithStyle const>, IntrinsicSizes*> mutable intrinsic_sizes;
+
+    IntrinsicSizes& ensure_intrinsic_sizes(NodeWithStyle const&) const;
 
     LayoutState const* m_parent { nullptr };
     LayoutState const& m_root;
 
 private:
+    UsedValues& create_used_values(NodeWithStyle const&, Optional<UsedValues const&> copy_from) const;
+
     void resolve_relative_positions();
+
+    // Everything we keep per node only lives as long as this LayoutState does. Instead of going through malloc for
+    // every single node, they're carved out of arenas that are released all at once when the pass is done.
+    mutable UniformBumpAllocator<UsedValues, false, 32 * KiB> m_used_values_allocator;
+    mutable UniformBumpAllocator<IntrinsicSizes, false, 8 * KiB> m_intrinsic_sizes_allocator;
 };
 
 }
@@ -320,6 +320,8 @@ static CSSPixels snap_a_length_as_a_border_width(double device_pixels_per_css_pi
 
 void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
 {
+    invalidate_intrinsic_sizes();
+
     auto& computed_values = mutable_computed_values();
 
     // NOTE: color must be set first to ensure currentColor can be resolved in other properties (e.g. background-color).
@@ -715,7 +717,8 @@ void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
         computed_values.set_transition_delay(transition_delay.resolve_time().value());
     }
 
-    auto do_border_style = [&](CSS::BorderData& border, CSS::PropertyID width_property, CSS::PropertyID color_property, CSS::PropertyID style_property) {
+    auto do_border_style = [&](CSS::PropertyID width_property, CSS::PropertyID color_property, CSS::PropertyID style_property) {
+        CSS::BorderData border;
         // FIXME: The default border color value is `currentcolor`, but since we can't resolve that easily,
         //        we just manually grab the value from `color`. This makes it dependent on `color` being
         //        specified first, so it's far from ideal.
@@ -754,12 +757,13 @@ void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
 
             border.width = snap_a_length_as_a_border_width(document().page().client().device_pixels_per_css_pixel(), resolve_border_width());
         }
+        return border;
     };
 
-    do_border_style(computed_values.border_left(), CSS::PropertyID::BorderLeftWidth, CSS::PropertyID::BorderLeftColor, CSS::PropertyID::BorderLeftStyle);
-    do_border_style(computed_values.border_top(), CSS::PropertyID::BorderTopWidth, CSS::PropertyID::BorderTopColor, CSS::PropertyID::BorderTopStyle);
-    do_border_style(computed_values.border_right(), CSS::PropertyID::BorderRightWidth, CSS::PropertyID::BorderRightColor, CSS::PropertyID::BorderRightStyle);
-    do_border_style(computed_values.border_bottom(), CSS::PropertyID::BorderBottomWidth, CSS::PropertyID::BorderBottomColor, CSS::PropertyID::BorderBottomStyle);
+    computed_values.set_border_left(do_border_style(CSS::PropertyID::BorderLeftWidth, CSS::PropertyID::BorderLeftColor, CSS::PropertyID::BorderLeftStyle));
+    computed_values.set_border_top(do_border_style(CSS::PropertyID::BorderTopWidth, CSS::PropertyID::BorderTopColor, CSS::PropertyID::BorderTopStyle));
+    computed_values.set_border_right(do_border_style(CSS::PropertyID::BorderRightWidth, CSS::PropertyID::BorderRightColor, CSS::PropertyID::BorderRightStyle));
+    computed_values.set_border_bottom(do_border_style(CSS::PropertyID::BorderBottomWidth, CSS::PropertyID::BorderBottomColor, CSS::PropertyID::BorderBottomStyle));
 
     if (auto outline_color = computed_style.property(CSS::PropertyID::OutlineColor); outline_color->has_color())
         computed_values.set_outline_color(outline_color->to_color(*this));
@@ -902,6 +906,16 @@ void NodeWithStyle::apply_style(const CSS::StyleProperties& computed_style)
     propagate_style_to_anonymous_wrappers();
 }
 
+// NOTE: This updates only the computed values of the properties that KeyframeEffect considers paint-only
+//       (see is_paint_only_animated_property()), without going through all of apply_style().
+void NodeWithStyle::apply_paint_only_animated_style(CSS::StyleProperties const& computed_style)
+{
+    auto& computed_values = mutable_computed_values();
+    computed_values.set_opacity(computed_style.opacity());
+    computed_values.set_transformations(computed_style.transformations());
+    computed_values.set_transform_origin(computed_style.transform_origin());
+}
+
 void NodeWithStyle::propagate_style_to_anonymous_wrappers()
 {
     // Update the style of any anonymous wrappers that inherit from this node.
@@ -1022,6 +1036,14 @@ void NodeWithStyle::transfer_table_box_computed_values_to_wrapper_computed_value
     reset_table_box_computed_values_used_by_wrapper_to_init_values();
 }
 
+void Node::invalidate_intrinsic_sizes()
+{
+    for (Node* ancestor = this; ancestor; ancestor = ancestor->parent()) {
+        if (is<Box>(*ancestor))
+            static_cast<Box&>(*ancestor).clear_intrinsic_size_cache();
+    }
+}
+
 void Node::set_paintable(JS::GCPtr<Painting::Paintable> paintable)
 {
     m_paintable = move(paintable);
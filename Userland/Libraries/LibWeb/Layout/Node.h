@@ -146,6 +146,9 @@ public:
 
     bool can_contain_boxes_with_position_absolute() const;
 
+    // Drops the min-/max-content sizes memoized on this node and its ancestors, as they may depend on this node.
+    void invalidate_intrinsic_sizes();
+
     Gfx::Font const& first_available_font() const;
     Gfx::Font const& scaled_font(PaintContext&) const;
     Gfx::Font const& scaled_font(float scale_factor) const;
@@ -212,6 +215,7 @@ public:
     CSS::MutableComputedValues& mutable_computed_values() { return static_cast<CSS::MutableComputedValues&>(*m_computed_values); }
 
     void apply_style(const CSS::StyleProperties&);
+    void apply_paint_only_animated_style(CSS::StyleProperties const&);
 
     Gfx::Font const& first_available_font() const;
     Vector<CSS::BackgroundLayerData> const& background_layers() const { return computed_values().background_layers(); }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/HTMLTableColElement.h>
@@ -84,9 +85,11 @@ void TableFormattingContext::compute_constrainedness()
         }
     }
 
+    // In fixed mode, the column widths only depend on the cells in the first row.
+    auto is_fixed_mode = use_fixed_mode_layout();
     for (auto& cell : m_cells) {
         auto const& computed_values = cell.box->computed_values();
-        if (computed_values.width().is_length()) {
+        if (computed_values.width().is_length() && (!is_fixed_mode || cell.row_index == 0)) {
             m_columns[cell.column_index].is_constrained = true;
         }
 
@@ -103,6 +106,12 @@ void TableFormattingContext::compute_cell_measures()
 
     compute_constrainedness();
 
+    // In fixed mode, only cells in the first row contribute to the column widths. Unless some cell spans multiple rows,
+    // the row heights are then fully determined by laying out each cell at its final width in compute_table_height(),
+    // so the intrinsic sizes of the remaining cells never need to be measured.
+    auto is_fixed_mode = use_fixed_mode_layout();
+    auto has_row_spanning_cells = any_of(m_cells, [](auto const& cell) { return cell.row_span > 1; });
+
     for (auto& cell : m_cells) {
         auto const& computed_values = cell.box->computed_values();
         CSSPixels padding_top = computed_values.padding().top().to_px(cell.box, containing_block.content_height());
@@ -118,10 +127,22 @@ void TableFormattingContext::compute_cell_measures()
         CSSPixels border_left = use_collapsing_borders_model ? round(cell_state.border_left / 2) : computed_values.border_left().width;
         CSSPixels border_right = use_collapsing_borders_model ? round(cell_state.border_right / 2) : computed_values.border_right().width;
 
-        auto min_content_width = calculate_min_content_width(cell.box);
-        auto max_content_width = calculate_max_content_width(cell.box);
-        auto min_content_height = calculate_min_content_height(cell.box, max_content_width);
-        auto max_content_height = calculate_max_content_height(cell.box, min_content_width);
+        // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
+        // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
+        // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
+        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
+        auto contributes_to_column_widths = !is_fixed_mode || (cell.row_index == 0 && width_is_specified_length_or_percentage);
+
+        CSSPixels min_content_width = 0;
+        CSSPixels max_content_width = 0;
+        CSSPixels min_content_height = 0;
+        CSSPixels max_content_height = 0;
+        if (contributes_to_column_widths || has_row_spanning_cells) {
+            min_content_width = calculate_min_content_width(cell.box);
+            max_content_width = calculate_max_content_width(cell.box);
+            min_content_height = calculate_min_content_height(cell.box, max_content_width);
+            max_content_height = calculate_max_content_height(cell.box, min_content_width);
+        }
 
         // The outer min-content height of a table-cell is max(min-height, min-content height) adjusted by the cell intrinsic offsets.
         auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
@@ -130,11 +151,7 @@ void TableFormattingContext::compute_cell_measures()
         // The outer min-content width of a table-cell is max(min-width, min-content width) adjusted by the cell intrinsic offsets.
         auto min_width = computed_values.min_width().to_px(cell.box, containing_block.content_width());
         auto cell_intrinsic_width_offsets = padding_left + padding_right + border_left + border_right;
-        // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
-        // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
-        // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
-        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
-        if (!use_fixed_mode_layout() || width_is_specified_length_or_percentage) {
+        if (contributes_to_column_widths) {
             cell.outer_min_width = max(min_width, min_content_width) + cell_intrinsic_width_offsets;
         }
 
@@ -157,7 +174,7 @@ void TableFormattingContext::compute_cell_measures()
         // See the explanation for height and max_height above.
         auto width = computed_values.width().is_length() ? computed_values.width().to_px(cell.box, containing_block.content_width()) : 0;
         auto max_width = computed_values.max_width().is_length() ? computed_values.max_width().to_px(cell.box, containing_block.content_width()) : CSSPixels::max();
-        if (use_fixed_mode_layout() && !width_is_specified_length_or_percentage) {
+        if (!contributes_to_column_widths) {
             continue;
         }
         if (m_columns[cell.column_index].is_constrained) {
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/CharacterTypes.h>
 #include <AK/StringBuilder.h>
 #include <LibUnicode/CharacterTypes.h>
@@ -304,6 +305,7 @@ static ErrorOr<String> apply_text_transform(String const& string, CSS::TextTrans
 void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
+    invalidate_intrinsic_sizes();
 }
 
 String const& TextNode::text_for_rendering() const
@@ -406,13 +408,13 @@ TextNode::ChunkIterator::ChunkIterator(TextNode const& text_node, bool wrap_line
     , m_respect_linebreaks(respect_linebreaks)
     , m_utf8_view(text_node.text_for_rendering())
     , m_font_cascade_list(text_node.computed_values().font_list())
-    , m_grapheme_segmenter(text_node.grapheme_segmenter())
+    , m_text_node(text_node)
 {
 }
 
-static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
+static Gfx::GlyphRun::TextType text_type_for_bidi_class(Unicode::BidiClass bidi_class)
 {
-    switch (Unicode::bidirectional_class(code_point)) {
+    switch (bidi_class) {
     case Unicode::BidiClass::WhiteSpaceNeutral:
 
     case Unicode::BidiClass::BlockSeparator:
@@ -451,6 +453,39 @@ static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
     }
 }
 
+static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
+{
+    // Nearly all text we lay out is ASCII, so look those code points up in a table rather than asking ICU every time.
+    static auto const ascii_text_types = [] {
+        Array<Gfx::GlyphRun::TextType, 128> text_types;
+        for (u32 ascii_code_point = 0; ascii_code_point < text_types.size(); ++ascii_code_point)
+            text_types[ascii_code_point] = text_type_for_bidi_class(Unicode::bidirectional_class(ascii_code_point));
+        return text_types;
+    }();
+
+    if (is_ascii(code_point))
+        return ascii_text_types[code_point];
+    return text_type_for_bidi_class(Unicode::bidirectional_class(code_point));
+}
+
+size_t TextNode::ChunkIterator::next_grapheme_boundary() const
+{
+    auto bytes = m_utf8_view.bytes();
+    auto length = m_utf8_view.byte_length();
+
+    // An ASCII code point followed by another ASCII code point is always a grapheme of its own, with the exception of
+    // CR LF (UAX #29, GB3). Anything that could extend it (combining marks, ZWJ, etc.) lies outside of ASCII, so we
+    // only need the segmenter once we see a non-ASCII byte. This also means we never create one for ASCII-only text.
+    if (auto next_index = m_current_index + 1; is_ascii(bytes[m_current_index])) {
+        if (next_index == length)
+            return next_index;
+        if (is_ascii(bytes[next_index]) && !(bytes[m_current_index] == '\r' && bytes[next_index] == '\n'))
+            return next_index;
+    }
+
+    return m_text_node.grapheme_segmenter().next_boundary(m_current_index).value_or(length);
+}
+
 Optional<TextNode::Chunk> TextNode::ChunkIterator::next()
 {
     if (!m_peek_queue.is_empty())
@@ -478,9 +513,6 @@ Optional<TextNode::Chunk> TextNode::ChunkIterator::next_without_peek()
     auto current_code_point = [this]() {
         return *m_utf8_view.iterator_at_byte_offset_without_validation(m_current_index);
     };
-    auto next_grapheme_boundary = [this]() {
-        return m_grapheme_segmenter.next_boundary(m_current_index).value_or(m_utf8_view.byte_length());
-    };
 
     auto code_point = current_code_point();
     auto start_of_chunk = m_current_index;
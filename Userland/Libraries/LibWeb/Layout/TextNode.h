@@ -47,13 +47,14 @@ public:
     private:
         Optional<Chunk> next_without_peek();
         Optional<Chunk> try_commit_chunk(size_t start, size_t end, bool has_breaking_newline, Gfx::Font const&, Gfx::GlyphRun::TextType) const;
+        size_t next_grapheme_boundary() const;
 
         bool const m_wrap_lines;
         bool const m_respect_linebreaks;
         Utf8View m_utf8_view;
         Gfx::FontCascadeList const& m_font_cascade_list;
 
-        Unicode::Segmenter& m_grapheme_segmenter;
+        TextNode const& m_text_node;
         size_t m_current_index { 0 };
 
         Vector<Chunk> m_peek_queue;
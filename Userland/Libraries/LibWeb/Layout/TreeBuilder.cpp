@@ -7,12 +7,15 @@
  */
 
 #include <AK/Error.h>
+#include <AK/GenericShorthands.h>
 #include <AK/Optional.h>
 #include <AK/TemporaryChange.h>
 #include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/CSS/StyleValues/CSSKeywordValue.h>
+#include <LibWeb/CSS/StyleValues/ContentStyleValue.h>
 #include <LibWeb/CSS/StyleValues/DisplayStyleValue.h>
 #include <LibWeb/CSS/StyleValues/PercentageStyleValue.h>
+#include <LibWeb/CSS/StyleValues/StyleValueList.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -188,6 +191,20 @@ void TreeBuilder::insert_node_into_inline_or_block_ancestor(Layout::Node& node,
     }
 }
 
+static bool content_depends_on_document_order(CSS::StyleProperties const& style)
+{
+    auto value = style.property(CSS::PropertyID::Content);
+    if (!value->is_content())
+        return false;
+    for (auto const& item : value->as_content().content().values()) {
+        if (item->is_counter())
+            return true;
+        if (item->is_keyword() && first_is_one_of(item->to_keyword(), CSS::Keyword::OpenQuote, CSS::Keyword::CloseQuote, CSS::Keyword::NoOpenQuote, CSS::Keyword::NoCloseQuote))
+            return true;
+    }
+    return false;
+}
+
 void TreeBuilder::create_pseudo_element_if_needed(DOM::Element& element, CSS::Selector::PseudoElement::Type pseudo_element, AppendOrPrepend mode)
 {
     auto& document = element.document();
@@ -196,6 +213,9 @@ void TreeBuilder::create_pseudo_element_if_needed(DOM::Element& element, CSS::Se
     if (!pseudo_element_style)
         return;
 
+    if (content_depends_on_document_order(*pseudo_element_style))
+        m_has_document_order_dependent_content = true;
+
     auto initial_quote_nesting_level = m_quote_nesting_level;
     auto [pseudo_element_content, final_quote_nesting_level] = pseudo_element_style->content(element, initial_quote_nesting_level);
     m_quote_nesting_level = final_quote_nesting_level;
@@ -362,7 +382,8 @@ void TreeBuilder::create_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     if (!layout_node)
         return;
 
-    if (!dom_node.parent_or_shadow_host()) {
+    if (m_ancestor_stack.is_empty()) {
+        // This is either the document, or the root of a subtree being rebuilt by rebuild_subtree().
         m_layout_root = layout_node;
     } else if (layout_node->is_svg_box()) {
         m_ancestor_stack.last()->append_child(*layout_node);
@@ -537,6 +558,98 @@ JS::GCPtr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
     return move(m_layout_root);
 }
 
+// Whether a box with this display type can be swapped for a freshly built one without its parent needing to change.
+// Inline-level boxes may have been split around block-level descendants, and table boxes are wrapped or regrouped by
+// fixup_tables() based on their siblings, so neither qualifies.
+static bool has_replaceable_display(CSS::Display display)
+{
+    if (!display.is_outside_and_inside() || !display.is_block_outside())
+        return false;
+    return display.is_flow_inside() || display.is_flow_root_inside() || display.is_flex_inside() || display.is_grid_inside();
+}
+
+static bool can_rebuild_subtree(DOM::Element const& element)
+{
+    // The document element generates the initial containing block, and propagates overflow to the viewport.
+    if (element.is_document_element())
+        return false;
+
+    auto const* layout_node = element.layout_node();
+    if (!layout_node || !layout_node->parent())
+        return false;
+
+    // Make sure the box is still part of the layout tree, and not left over from an earlier build.
+    auto const* layout_root = layout_node;
+    while (layout_root->parent())
+        layout_root = layout_root->parent();
+    if (layout_root != element.document().layout_node())
+        return false;
+
+    auto style = element.computed_css_values();
+    if (!style || !has_replaceable_display(layout_node->display()) || !has_replaceable_display(style->display()))
+        return false;
+
+    // Floats and absolutely positioned boxes are placed differently among their siblings (see insertion_parent_for_block_node()).
+    auto const& computed_values = layout_node->computed_values();
+    if (computed_values.float_() != style->float_().value_or(CSS::Float::None)
+        || computed_values.position() != style->position().value_or(CSS::Positioning::Static))
+        return false;
+
+    // SVG content is laid out by its own rules, and may be referenced from elsewhere as a mask or clip path.
+    for (auto const* ancestor = &element; ancestor; ancestor = ancestor->parent_or_shadow_host_element()) {
+        if (ancestor->is_svg_element())
+            return false;
+    }
+
+    return true;
+}
+
+DOM::Element* TreeBuilder::subtree_rebuild_root_for(DOM::Node& node)
+{
+    auto* candidate = is<DOM::Element>(node) ? static_cast<DOM::Element*>(&node) : node.parent_or_shadow_host_element();
+    for (; candidate; candidate = candidate->parent_or_shadow_host_element()) {
+        if (can_rebuild_subtree(*candidate))
+            return candidate;
+    }
+    return nullptr;
+}
+
+bool TreeBuilder::rebuild_subtree(DOM::Element& element)
+{
+    if (!can_rebuild_subtree(element))
+        return false;
+
+    auto& style_computer = element.document().style_computer();
+    JS::NonnullGCPtr<Layout::Node> old_layout_node = *element.layout_node();
+    auto& layout_parent = *old_layout_node->parent();
+
+    // Set up the ancestor filter the same way a full build would have it when reaching this element.
+    Vector<DOM::Element const&> ancestors;
+    for (auto const* ancestor = element.parent_or_shadow_host_element(); ancestor; ancestor = ancestor->parent_or_shadow_host_element())
+        ancestors.append(*ancestor);
+    style_computer.reset_ancestor_filter();
+    for (auto const& ancestor : ancestors.in_reverse())
+        style_computer.push_ancestor(ancestor);
+
+    Context context;
+    m_quote_nesting_level = 0;
+    create_layout_tree(element, context);
+
+    for (auto const& ancestor : ancestors)
+        style_computer.pop_ancestor(ancestor);
+
+    auto new_layout_node = move(m_layout_root);
+    if (!new_layout_node || m_has_document_order_dependent_content)
+        return false;
+
+    layout_parent.insert_before(*new_layout_node, old_layout_node);
+    layout_parent.remove_child(*old_layout_node);
+
+    fixup_tables(verify_cast<NodeWithStyle>(*new_layout_node));
+    new_layout_node->invalidate_intrinsic_sizes();
+    return true;
+}
+
 template<CSS::DisplayInternal internal, typename Callback>
 void TreeBuilder::for_each_in_tree_with_internal_display(NodeWithStyle& root, Callback callback)
 {
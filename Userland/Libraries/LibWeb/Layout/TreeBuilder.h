@@ -20,6 +20,17 @@ public:
 
     JS::GCPtr<Layout::Node> build(DOM::Node&);
 
+    // Returns the closest shadow-including inclusive ancestor of the given node whose layout subtree can be
+    // rebuilt in place by rebuild_subtree(), or null if the whole layout tree has to be rebuilt instead.
+    static DOM::Element* subtree_rebuild_root_for(DOM::Node&);
+
+    // Replaces the layout subtree generated by the element with a freshly built one, leaving the rest of the tree intact.
+    // Returns false if that can't be done, e.g. because the new subtree contains generated content that would require a full rebuild.
+    [[nodiscard]] bool rebuild_subtree(DOM::Element&);
+
+    // Whether any generated content built so far depends on the boxes that precede it in the tree (counters and quotes).
+    bool has_document_order_dependent_content() const { return m_has_document_order_dependent_content; }
+
 private:
     struct Context {
         bool has_svg_root = false;
@@ -57,6 +68,7 @@ private:
     Vector<JS::NonnullGCPtr<Layout::NodeWithStyle>> m_ancestor_stack;
 
     u32 m_quote_nesting_level { 0 };
+    bool m_has_document_order_dependent_content { false };
 };
 
 }
@@ -22,6 +22,14 @@ Viewport::Viewport(DOM::Document& document, NonnullRefPtr<CSS::StyleProperties>
 
 Viewport::~Viewport() = default;
 
+void Viewport::invalidate_all_intrinsic_sizes()
+{
+    for_each_in_inclusive_subtree_of_type<Box>([](Box& box) {
+        box.clear_intrinsic_size_cache();
+        return TraversalDecision::Continue;
+    });
+}
+
 JS::GCPtr<Painting::Paintable> Viewport::create_paintable() const
 {
     return Painting::ViewportPaintable::create(*this);
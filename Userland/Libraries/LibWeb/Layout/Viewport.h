@@ -28,6 +28,10 @@ public:
         Vector<TextPosition> positions;
     };
     Vector<TextBlock> const& text_blocks();
+    void invalidate_text_blocks() { m_text_blocks = {}; }
+
+    // For changes that can affect intrinsic sizes anywhere in the tree, like a viewport resize or a web font load.
+    void invalidate_all_intrinsic_sizes();
 
     const DOM::Document& dom_node() const { return static_cast<const DOM::Document&>(*Node::dom_node()); }
 
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
@@ -40,6 +41,9 @@ public:
     ByteBuffer const& body() const { return m_body; }
     void set_body(ByteBuffer body) { m_body = move(body); }
 
+    Requests::RequestPriority priority() const { return m_priority; }
+    void set_priority(Requests::RequestPriority priority) { m_priority = priority; }
+
     void start_timer() { m_load_timer.start(); }
     AK::Duration load_time() const { return m_load_timer.elapsed_time(); }
 
@@ -79,6 +83,7 @@ private:
     ByteString m_method { "GET" };
     HashMap<ByteString, ByteString, CaseInsensitiveStringTraits> m_headers;
     ByteBuffer m_body;
+    Requests::RequestPriority m_priority { Requests::RequestPriority::Normal };
     Core::ElapsedTimer m_load_timer;
     JS::Handle<Page> m_page;
     bool m_main_resource { false };
@@ -118,10 +118,10 @@ RefPtr<Resource> ResourceLoader::load_resource(Resource::Type type, LoadRequest&
 
     load(
         request,
-        [=](auto data, auto& headers, auto status_code) {
+        [=](auto data, auto& headers, auto status_code, auto const&) {
             const_cast<Resource&>(*resource).did_load({}, data, headers, status_code);
         },
-        [=](auto& error, auto status_code, auto data, auto& headers) {
+        [=](auto& error, auto status_code, auto data, auto& headers, auto const&) {
             const_cast<Resource&>(*resource).did_fail({}, error, data, headers, status_code);
         });
 
@@ -224,7 +224,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
     request.start_timer();
 
     if (should_block_request(request)) {
-        error_callback("Request was blocked", {}, {}, {});
+        error_callback("Request was blocked", {}, {}, {}, {});
         return;
     }
 
@@ -233,14 +233,14 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         if (maybe_response.is_error()) {
             log_failure(request, maybe_response.error());
             if (error_callback)
-                error_callback(ByteString::formatted("{}", maybe_response.error()), 500u, {}, {});
+                error_callback(ByteString::formatted("{}", maybe_response.error()), 500u, {}, {}, {});
             return;
         }
 
         log_success(request);
         HTTP::HeaderMap response_headers;
         response_headers.set("Content-Type"sv, "text/html"sv);
-        success_callback(maybe_response.release_value().bytes(), response_headers, {});
+        success_callback(maybe_response.release_value().bytes(), response_headers, {}, {});
     };
 
     if (url.scheme() == "about") {
@@ -252,7 +252,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
 
         // About version page
         if (url.path_segment_at_index(0) == "version") {
-            success_callback(MUST(load_about_version_page()).bytes(), response_headers, {});
+            success_callback(MUST(load_about_version_page()).bytes(), response_headers, {}, {});
             return;
         }
 
@@ -260,12 +260,12 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         auto resource = Core::Resource::load_from_uri(MUST(String::formatted("resource://ladybird/{}.html", url.path_segment_at_index(0))));
         if (!resource.is_error()) {
             auto data = resource.value()->data();
-            success_callback(data, response_headers, {});
+            success_callback(data, response_headers, {}, {});
             return;
         }
 
         Platform::EventLoopPlugin::the().deferred_invoke([success_callback = move(success_callback), response_headers = move(response_headers)] {
-            success_callback(ByteString::empty().to_byte_buffer(), response_headers, {});
+            success_callback(ByteString::empty().to_byte_buffer(), response_headers, {}, {});
         });
         return;
     }
@@ -275,7 +275,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         if (data_url_or_error.is_error()) {
             auto error_message = data_url_or_error.error().string_literal();
             log_failure(request, error_message);
-            error_callback(error_message, {}, {}, {});
+            error_callback(error_message, {}, {}, {}, {});
             return;
         }
         auto data_url = data_url_or_error.release_value();
@@ -290,7 +290,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         log_success(request);
 
         Platform::EventLoopPlugin::the().deferred_invoke([data = move(data_url.body), response_headers = move(response_headers), success_callback = move(success_callback)] {
-            success_callback(data, response_headers, {});
+            success_callback(data, response_headers, {}, {});
         });
         return;
     }
@@ -300,7 +300,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         if (resource.is_error()) {
             log_failure(request, resource.error());
             if (error_callback)
-                error_callback(ByteString::formatted("{}", resource.error()), {}, {}, {});
+                error_callback(ByteString::formatted("{}", resource.error()), {}, {}, {}, {});
             return;
         }
 
@@ -314,7 +314,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         auto response_headers = response_headers_for_file(URL::percent_decode(url.serialize_path()), resource.value()->modified_time());
 
         log_success(request);
-        success_callback(data, response_headers, {});
+        success_callback(data, response_headers, {}, {});
 
         return;
     }
@@ -336,7 +336,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             if (file_or_error.is_error()) {
                 log_failure(request, file_or_error.error());
                 if (error_callback)
-                    error_callback(ByteString::formatted("{}", file_or_error.error()), {}, {}, {});
+                    error_callback(ByteString::formatted("{}", file_or_error.error()), {}, {}, {}, {});
                 return;
             }
 
@@ -353,7 +353,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             if (st_or_error.is_error()) {
                 log_failure(request, st_or_error.error());
                 if (error_callback)
-                    error_callback(ByteString::formatted("{}", st_or_error.error()), {}, {}, {});
+                    error_callback(ByteString::formatted("{}", st_or_error.error()), {}, {}, {}, {});
                 return;
             }
 
@@ -362,7 +362,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             if (maybe_file.is_error()) {
                 log_failure(request, maybe_file.error());
                 if (error_callback)
-                    error_callback(ByteString::formatted("{}", maybe_file.error()), {}, {}, {});
+                    error_callback(ByteString::formatted("{}", maybe_file.error()), {}, {}, {}, {});
                 return;
             }
 
@@ -371,7 +371,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             if (maybe_data.is_error()) {
                 log_failure(request, maybe_data.error());
                 if (error_callback)
-                    error_callback(ByteString::formatted("{}", maybe_data.error()), {}, {}, {});
+                    error_callback(ByteString::formatted("{}", maybe_data.error()), {}, {}, {}, {});
                 return;
             }
 
@@ -379,7 +379,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             auto response_headers = response_headers_for_file(URL::percent_decode(request.url().serialize_path()), st_or_error.value().st_mtime);
 
             log_success(request);
-            success_callback(data, response_headers, {});
+            success_callback(data, response_headers, {}, {});
         });
 
         (*m_page)->client().request_file(move(file_request));
@@ -395,7 +395,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
         auto protocol_request = start_network_request(request);
         if (!protocol_request) {
             if (error_callback)
-                error_callback("Failed to start network request"sv, {}, {}, {});
+                error_callback("Failed to start network request"sv, {}, {}, {}, {});
             return;
         }
 
@@ -409,7 +409,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
             timer->start();
         }
 
-        auto on_buffered_request_finished = [this, success_callback = move(success_callback), error_callback = move(error_callback), request, &protocol_request = *protocol_request](bool success, auto, auto& response_headers, auto status_code, ReadonlyBytes payload) mutable {
+        auto on_buffered_request_finished = [this, success_callback = move(success_callback), error_callback = move(error_callback), request, &protocol_request = *protocol_request](bool success, auto, auto& response_headers, auto status_code, ReadonlyBytes payload, auto const& timing_info) mutable {
             handle_network_response_headers(request, response_headers);
             finish_network_request(protocol_request);
 
@@ -421,12 +421,12 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
                     error_builder.append("Load failed"sv);
                 log_failure(request, error_builder.string_view());
                 if (error_callback)
-                    error_callback(error_builder.to_byte_string(), status_code, payload, response_headers);
+                    error_callback(error_builder.to_byte_string(), status_code, payload, response_headers, timing_info);
                 return;
             }
 
             log_success(request);
-            success_callback(payload, response_headers, status_code);
+            success_callback(payload, response_headers, status_code, timing_info);
         };
 
         protocol_request->set_buffered_request_finished_callback(move(on_buffered_request_finished));
@@ -436,7 +436,7 @@ void ResourceLoader::load(LoadRequest& request, SuccessCallback success_callback
     auto not_implemented_error = ByteString::formatted("Protocol not implemented: {}", url.scheme());
     log_failure(request, not_implemented_error);
     if (error_callback)
-        error_callback(not_implemented_error, {}, {}, {});
+        error_callback(not_implemented_error, {}, {}, {}, {});
 }
 
 void ResourceLoader::load_unbuffered(LoadRequest& request, OnHeadersReceived on_headers_received, OnDataReceived on_data_received, OnComplete on_complete)
@@ -447,19 +447,19 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, OnHeadersReceived on_
     request.start_timer();
 
     if (should_block_request(request)) {
-        on_complete(false, "Request was blocked"sv);
+        on_complete(false, "Request was blocked"sv, {});
         return;
     }
 
     if (!url.scheme().is_one_of("http"sv, "https"sv)) {
         // FIXME: Non-network requests from fetch should not go through this path.
-        on_complete(false, "Cannot establish connection non-network scheme"sv);
+        on_complete(false, "Cannot establish connection non-network scheme"sv, {});
         return;
     }
 
     auto protocol_request = start_network_request(request);
     if (!protocol_request) {
-        on_complete(false, "Failed to start network request"sv);
+        on_complete(false, "Failed to start network request"sv, {});
         return;
     }
 
@@ -472,15 +472,15 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, OnHeadersReceived on_
         on_data_received(data);
     };
 
-    auto protocol_complete = [this, on_complete = move(on_complete), request, &protocol_request = *protocol_request](bool success, u64) {
+    auto protocol_complete = [this, on_complete = move(on_complete), request, &protocol_request = *protocol_request](bool success, u64, auto const& timing_info) {
         finish_network_request(protocol_request);
 
         if (success) {
             log_success(request);
-            on_complete(true, {});
+            on_complete(true, {}, timing_info);
         } else {
             log_failure(request, "Request finished with error"sv);
-            on_complete(false, "Request finished with error"sv);
+            on_complete(false, "Request finished with error"sv, timing_info);
         }
     };
 
@@ -500,7 +500,8 @@ RefPtr<ResourceLoaderConnectorRequest> ResourceLoader::start_network_request(Loa
     if (!headers.contains("User-Agent"))
         headers.set("User-Agent", m_user_agent.to_byte_string());
 
-    auto protocol_request = m_connector->start_request(request.method(), request.url(), headers, request.body(), proxy);
+    auto priority = request.is_main_resource() ? Requests::RequestPriority::Highest : request.priority();
+    auto protocol_request = m_connector->start_request(request.method(), request.url(), headers, request.body(), proxy, priority);
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
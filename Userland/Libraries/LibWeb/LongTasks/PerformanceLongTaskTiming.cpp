@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceLongTaskTimingPrototype.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/HTML/HTMLIFrameElement.h>
+#include <LibWeb/HTML/HTMLObjectElement.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+
+namespace Web::LongTasks {
+
+JS_DEFINE_ALLOCATOR(PerformanceLongTaskTiming);
+
+PerformanceLongTaskTiming::PerformanceLongTaskTiming(JS::Realm& realm, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, JS::NonnullGCPtr<TaskAttributionTiming> attribution)
+    : PerformanceTimeline::PerformanceEntry(realm, name, start_time, duration)
+    , m_attribution(attribution)
+{
+}
+
+PerformanceLongTaskTiming::~PerformanceLongTaskTiming() = default;
+
+JS::NonnullGCPtr<PerformanceLongTaskTiming> PerformanceLongTaskTiming::create(JS::Realm& realm, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, JS::NonnullGCPtr<TaskAttributionTiming> attribution)
+{
+    return realm.heap().allocate<PerformanceLongTaskTiming>(realm, realm, name, start_time, duration, attribution);
+}
+
+FlyString const& PerformanceLongTaskTiming::entry_type() const
+{
+    return PerformanceTimeline::EntryTypes::longtask;
+}
+
+void PerformanceLongTaskTiming::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceLongTaskTiming);
+}
+
+void PerformanceLongTaskTiming::visit_edges(JS::Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_attribution);
+    visitor.visit(m_attribution_array);
+}
+
+JS::NonnullGCPtr<JS::Object> PerformanceLongTaskTiming::attribution_js_array() const
+{
+    // NOTE: A FrozenArray attribute returns the same object every time.
+    if (!m_attribution_array) {
+        Vector<JS::Value> attribution { JS::Value(m_attribution.ptr()) };
+        m_attribution_array = JS::Array::create_from(realm(), attribution);
+        MUST(m_attribution_array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+    }
+    return *m_attribution_array;
+}
+
+static bool is_ancestor_of(DOM::Document const& ancestor, DOM::Document const& descendant)
+{
+    auto ancestor_navigable = ancestor.navigable();
+    if (!ancestor_navigable)
+        return false;
+    for (auto const& navigable : descendant.ancestor_navigables()) {
+        if (navigable.ptr() == ancestor_navigable.ptr())
+            return true;
+    }
+    return false;
+}
+
+// https://w3c.github.io/longtasks/#report-long-tasks
+void report_long_tasks(HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp end_time, Vector<JS::NonnullGCPtr<HTML::TraversableNavigable>> const& top_level_traversables, HTML::Task const& task)
+{
+    // 1. If end time minus start time is less than the long tasks threshold of 50 ms, abort these steps.
+    if (end_time - start_time < long_tasks_threshold)
+        return;
+
+    // 2. Let destinationRealms be an empty set.
+    Vector<JS::NonnullGCPtr<DOM::Document>> destination_documents;
+
+    // 3. Determine the set of JavaScript realms to which reports will be delivered:
+    //    For each top-level traversable topmostTraversable in topLevelTraversables:
+    for (auto const& topmost_traversable : top_level_traversables) {
+        auto active_document = topmost_traversable->active_document();
+        if (!active_document)
+            continue;
+
+        // 1. Add topmostTraversable's active document's relevant Realm to destinationRealms.
+        destination_documents.append(*active_document);
+
+        // 2. Let descendantTraversables be the list of the descendant navigables of topmostTraversable's active document.
+        // 3. For each descendantTraversable in descendantTraversables, add descendantTraversable's active document's
+        //    relevant Realm to destinationRealms.
+        for (auto const& descendant_navigable : active_document->descendant_navigables()) {
+            if (auto descendant_document = descendant_navigable->active_document())
+                destination_documents.append(*descendant_document);
+        }
+    }
+
+    // FIXME: We don't keep track of the script evaluation environment settings object set of a task, so the task's
+    //        document stands in for it. Tasks without a document are attributed to "unknown".
+    auto const* task_document = task.document();
+
+    // 4. For each destinationRealm in destinationRealms:
+    for (auto const& destination_document : destination_documents) {
+        auto window = destination_document->window();
+        if (!window)
+            continue;
+        auto& realm = window->realm();
+
+        // 1. Let name be the empty string. This will be used to report minimal frame attribution, below.
+        String name;
+
+        // 2. Let culpritSettings be null.
+        DOM::Document const* culprit_document = nullptr;
+
+        // 3. Process task's script evaluation environment settings object set to determine name and culpritSettings as follows:
+        if (!task_document) {
+            // 1. If task's script evaluation environment settings object set is empty: set name to "unknown" and culpritSettings to null.
+            name = "unknown"_string;
+        } else {
+            // 2. Otherwise, if task's script evaluation environment settings object set's length is one:
+            //    1. Set culpritSettings to the single item in task's script evaluation environment settings object set.
+            culprit_document = task_document;
+
+            auto is_same_origin = culprit_document->origin().is_same_origin(destination_document->origin());
+
+            if (culprit_document == destination_document.ptr()) {
+                // 2. If destinationRealm is culpritSettings's Realm, set name to "self".
+                name = "self"_string;
+            } else if (is_ancestor_of(*culprit_document, destination_document)) {
+                // 3. If culpritSettings's origin and destinationOrigin are same origin:
+                //    1. If culpritSettings's global object's navigable is an ancestor of destinationRealm's global object's
+                //       navigable, set name to "same-origin-ancestor".
+                // 4. Otherwise:
+                //    1. If culpritSettings's global object's navigable is an ancestor of destinationRealm's global object's
+                //       navigable, set name to "cross-origin-ancestor" and set culpritSettings to null.
+                //       NOTE: This is not reported because of security. Developers should look this up themselves.
+                if (is_same_origin) {
+                    name = "same-origin-ancestor"_string;
+                } else {
+                    name = "cross-origin-ancestor"_string;
+                    culprit_document = nullptr;
+                }
+            } else if (is_ancestor_of(destination_document, *culprit_document)) {
+                // 2. If culpritSettings's global object's navigable is a descendant of destinationRealm's global object's
+                //    navigable, set name to "same-origin-descendant" or "cross-origin-descendant".
+                name = is_same_origin ? "same-origin-descendant"_string : "cross-origin-descendant"_string;
+            } else {
+                // 3. Otherwise, set name to "same-origin" or "cross-origin-unreachable".
+                name = is_same_origin ? "same-origin"_string : "cross-origin-unreachable"_string;
+            }
+        }
+
+        // 4. Let attribution be a new TaskAttributionTiming object with destinationRealm and set its attributes as follows:
+        // 5. Set attribution's containerType attribute to "window".
+        TaskAttributionTiming::Container container { .type = "window"_string, .src = {}, .id = {}, .name = {} };
+
+        // 6. If culpritSettings is not null, and culpritSettings's global object's navigable's container is not null:
+        //    1. Let container be culpritSettings's global object's navigable's container.
+        //    2. Set attribution's containerType attribute to "iframe", "embed" or "object", depending on container.
+        //    3. Set attribution's containerName attribute to the value of container's name content attribute, or "" if the
+        //       attribute is absent.
+        //    4. Set attribution's containerId attribute to the value of container's id content attribute, or "" if the
+        //       attribute is absent.
+        //    5. Set attribution's containerSrc attribute to the value of container's src content attribute, or "" if the
+        //       attribute is absent (the data attribute for object elements).
+        // NOTE: embed elements don't host navigables in our implementation, so they never show up here.
+        if (culprit_document) {
+            if (auto culprit_navigable = culprit_document->navigable()) {
+                if (auto navigable_container = culprit_navigable->container()) {
+                    if (is<HTML::HTMLIFrameElement>(*navigable_container)) {
+                        container.type = "iframe"_string;
+                        container.src = navigable_container->get_attribute_value(HTML::AttributeNames::src);
+                    } else if (is<HTML::HTMLObjectElement>(*navigable_container)) {
+                        container.type = "object"_string;
+                        container.src = navigable_container->get_attribute_value(HTML::AttributeNames::data);
+                    }
+
+                    if (container.type != "window"sv) {
+                        container.name = navigable_container->get_attribute_value(HTML::AttributeNames::name);
+                        container.id = navigable_container->get_attribute_value(HTML::AttributeNames::id);
+                    }
+                }
+            }
+        }
+
+        auto attribution = TaskAttributionTiming::create(realm, move(container));
+
+        // 7. Create a new PerformanceLongTaskTiming object newEntry with destinationRealm and set its attributes as follows:
+        //    1. Set newEntry's name attribute to name.
+        //    2. Set newEntry's entryType attribute to "longtask".
+        //    3. Set newEntry's startTime attribute to the result of converting start time to a relative high resolution time
+        //       given start time and destinationRealm's global object.
+        //    4. Let dur be the result of converting end time to a relative high resolution time given end time and
+        //       destinationRealm's global object, minus newEntry's startTime.
+        //    5. Set newEntry's duration attribute to the integer part of dur.
+        //    6. If attribution is not null, set newEntry's attribution attribute to a new frozen array containing the
+        //       single value attribution.
+        auto entry_start_time = HighResolutionTime::relative_high_resolution_time(start_time, *window);
+        auto duration = trunc(HighResolutionTime::relative_high_resolution_time(end_time, *window) - entry_start_time);
+        auto new_entry = PerformanceLongTaskTiming::create(realm, name, entry_start_time, duration, attribution);
+
+        // 8. Queue the PerformanceEntry newEntry.
+        window->queue_performance_entry(new_entry);
+    }
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/LongTasks/TaskAttributionTiming.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::LongTasks {
+
+// https://w3c.github.io/longtasks/#long-tasks-threshold
+static constexpr HighResolutionTime::DOMHighResTimeStamp long_tasks_threshold = 50;
+
+// https://w3c.github.io/longtasks/#sec-PerformanceLongTaskTiming
+class PerformanceLongTaskTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceLongTaskTiming, PerformanceTimeline::PerformanceEntry);
+    JS_DECLARE_ALLOCATOR(PerformanceLongTaskTiming);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<PerformanceLongTaskTiming> create(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, JS::NonnullGCPtr<TaskAttributionTiming> attribution);
+    virtual ~PerformanceLongTaskTiming() override;
+
+    // NOTE: These three functions are answered by the registry for the given entry type.
+    // https://w3c.github.io/timing-entrytypes-registry/#registry
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-availablefromtimeline
+    static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::Yes; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-maxbuffersize
+    static Optional<u64> max_buffer_size() { return 200; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-should-add-entry
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::Yes; }
+
+    virtual FlyString const& entry_type() const override;
+
+    JS::NonnullGCPtr<TaskAttributionTiming> attribution() const { return m_attribution; }
+    JS::NonnullGCPtr<JS::Object> attribution_js_array() const;
+
+private:
+    PerformanceLongTaskTiming(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, JS::NonnullGCPtr<TaskAttributionTiming> attribution);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(JS::Cell::Visitor&) override;
+
+    // https://w3c.github.io/longtasks/#dom-performancelongtasktiming-attribution
+    JS::NonnullGCPtr<TaskAttributionTiming> m_attribution;
+    mutable JS::GCPtr<JS::Object> m_attribution_array;
+};
+
+void report_long_tasks(HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp end_time, Vector<JS::NonnullGCPtr<HTML::TraversableNavigable>> const& top_level_traversables, HTML::Task const&);
+
+}
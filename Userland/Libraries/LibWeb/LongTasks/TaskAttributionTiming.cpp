@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/TaskAttributionTimingPrototype.h>
+#include <LibWeb/LongTasks/TaskAttributionTiming.h>
+
+namespace Web::LongTasks {
+
+JS_DEFINE_ALLOCATOR(TaskAttributionTiming);
+
+// https://w3c.github.io/longtasks/#report-long-tasks
+TaskAttributionTiming::TaskAttributionTiming(JS::Realm& realm, Container container)
+    // Set attribution's name attribute to "unknown", its startTime and duration attributes to 0.
+    : PerformanceTimeline::PerformanceEntry(realm, "unknown"_string, 0, 0)
+    , m_container(move(container))
+{
+}
+
+TaskAttributionTiming::~TaskAttributionTiming() = default;
+
+JS::NonnullGCPtr<TaskAttributionTiming> TaskAttributionTiming::create(JS::Realm& realm, Container container)
+{
+    return realm.heap().allocate<TaskAttributionTiming>(realm, realm, move(container));
+}
+
+FlyString const& TaskAttributionTiming::entry_type() const
+{
+    // Set attribution's entryType attribute to "taskattribution".
+    static FlyString const entry_type = "taskattribution"_fly_string;
+    return entry_type;
+}
+
+void TaskAttributionTiming::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(TaskAttributionTiming);
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::LongTasks {
+
+// https://w3c.github.io/longtasks/#sec-TaskAttributionTiming
+class TaskAttributionTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(TaskAttributionTiming, PerformanceTimeline::PerformanceEntry);
+    JS_DECLARE_ALLOCATOR(TaskAttributionTiming);
+
+public:
+    struct Container {
+        String type;
+        String src;
+        String id;
+        String name;
+    };
+
+    [[nodiscard]] static JS::NonnullGCPtr<TaskAttributionTiming> create(JS::Realm&, Container);
+    virtual ~TaskAttributionTiming() override;
+
+    // NOTE: Attribution entries are only ever reachable through a PerformanceLongTaskTiming, so they are never
+    //       added to a performance entry buffer or observed on their own.
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::No; }
+
+    virtual FlyString const& entry_type() const override;
+
+    String const& container_type() const { return m_container.type; }
+    String const& container_src() const { return m_container.src; }
+    String const& container_id() const { return m_container.id; }
+    String const& container_name() const { return m_container.name; }
+
+private:
+    TaskAttributionTiming(JS::Realm&, Container);
+
+    virtual void initialize(JS::Realm&) override;
+
+    Container m_container;
+};
+
+}
@@ -547,6 +547,16 @@ void Page::set_user_style(String source)
     }
 }
 
+void Page::did_finish_network_request(NetworkRequestRecord record)
+{
+    // NOTE: Pages that keep making requests, e.g. by polling, would otherwise grow this forever.
+    static constexpr size_t max_network_requests = 1000;
+    if (m_network_requests.size() == max_network_requests)
+        m_network_requests.take_first();
+
+    m_network_requests.append(move(record));
+}
+
 Vector<JS::Handle<DOM::Document>> Page::documents_in_active_window() const
 {
     if (!top_level_traversable_is_initialized())
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/Noncopyable.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
@@ -24,6 +25,7 @@
 #include <LibIPC/Forward.h>
 #include <LibJS/Heap/Handle.h>
 #include <LibJS/Heap/Heap.h>
+#include <LibRequests/RequestTimingInfo.h>
 #include <LibURL/URL.h>
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/PreferredContrast.h>
@@ -39,6 +41,7 @@
 #include <LibWeb/HTML/SelectItem.h>
 #include <LibWeb/HTML/TokenizedFeatures.h>
 #include <LibWeb/HTML/WebViewHints.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/Loader/FileRequest.h>
 #include <LibWeb/Page/EventResult.h>
 #include <LibWeb/Page/InputEvent.h>
@@ -49,6 +52,26 @@ namespace Web {
 
 class PageClient;
 
+// A request that was made on behalf of the page, as shown in the Inspector's network panel. Unlike resource timing
+// entries, these are not redacted for cross-origin requests, and include requests that are not reported to any global.
+struct NetworkRequestRecord {
+    URL::URL url;
+    ByteString method;
+    Optional<u32> status_code;
+    StringView initiator_type;
+    StringView destination;
+
+    // When we handed the request to ResourceLoader and when it finished, as unsafe shared current times.
+    HighResolutionTime::DOMHighResTimeStamp start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp end_time { 0 };
+
+    // How long each phase of the request took, if it went to RequestServer.
+    Requests::RequestTimingInfo timing_info;
+
+    u64 decoded_body_size { 0 };
+    bool success { false };
+};
+
 class Page final : public JS::Cell {
     JS_CELL(Page, JS::Cell);
     JS_DECLARE_ALLOCATOR(Page);
@@ -189,6 +212,10 @@ public:
 
     bool pdf_viewer_supported() const { return m_pdf_viewer_supported; }
 
+    Vector<NetworkRequestRecord> const& network_requests() const { return m_network_requests; }
+    void did_finish_network_request(NetworkRequestRecord);
+    void clear_network_requests() { m_network_requests.clear(); }
+
     void clear_selection();
 
     enum class WrapAround {
@@ -268,6 +295,8 @@ private:
     size_t m_find_in_page_match_index { 0 };
     Optional<FindInPageQuery> m_last_find_in_page_query;
     URL::URL m_last_find_in_page_url;
+
+    Vector<NetworkRequestRecord> m_network_requests;
 };
 
 struct PaintOptions {
@@ -279,6 +308,12 @@ struct PaintOptions {
     PaintOverlay paint_overlay { PaintOverlay::Yes };
     bool should_show_line_box_borders { false };
     bool has_focus { false };
+
+    // Set when painting the page's next frame, as opposed to e.g. a screenshot, so damage is tracked between frames.
+    bool is_next_frame { false };
+    // The last frame painted for the same viewport, if there is one. When set, only the area damaged since then
+    // is painted again, and everything else is copied from it.
+    Painting::BackingStore const* previous_frame { nullptr };
 };
 
 enum class DisplayListPlayerType {
@@ -343,6 +378,10 @@ public:
     virtual String page_did_request_cookie(URL::URL const&, Cookie::Source) { return {}; }
     virtual void page_did_set_cookie(URL::URL const&, Cookie::ParsedCookie const&, Cookie::Source) { }
     virtual void page_did_update_cookie(Web::Cookie::Cookie) { }
+    virtual OrderedHashMap<String, String> page_did_request_local_storage_items(String const&) { return {}; }
+    virtual void page_did_set_local_storage_item(String const&, String const&, String const&) { }
+    virtual void page_did_remove_local_storage_item(String const&, String const&) { }
+    virtual void page_did_clear_local_storage(String const&) { }
     virtual void page_did_update_resource_count(i32) { }
     struct NewWebViewResult {
         JS::GCPtr<Page> page;
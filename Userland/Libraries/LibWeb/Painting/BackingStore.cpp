@@ -9,6 +9,33 @@
 
 namespace Web::Painting {
 
+void BackingStore::copy_undamaged_area_from(BackingStore const& other, Gfx::IntRect const& damaged_rect, Gfx::IntPoint translation)
+{
+    auto& source = other.bitmap();
+    auto& destination = bitmap();
+    VERIFY(source.size() == destination.size());
+    VERIFY(source.format() == destination.format());
+
+    auto copied_rect = destination.rect().intersected(source.rect().translated(translation));
+    auto bytes_per_pixel = destination.bpp() / 8;
+    for (int y = copied_rect.top(); y < copied_rect.bottom(); ++y) {
+        auto const* source_scanline = source.scanline_u8(y - translation.y());
+        auto* destination_scanline = destination.scanline_u8(y);
+        auto copy_span = [&](int left, int right) {
+            if (right <= left)
+                return;
+            memcpy(destination_scanline + left * bytes_per_pixel, source_scanline + (left - translation.x()) * bytes_per_pixel, (right - left) * bytes_per_pixel);
+        };
+
+        if (y < damaged_rect.top() || y >= damaged_rect.bottom()) {
+            copy_span(copied_rect.left(), copied_rect.right());
+            continue;
+        }
+        copy_span(copied_rect.left(), min(copied_rect.right(), damaged_rect.left()));
+        copy_span(max(copied_rect.left(), damaged_rect.right()), copied_rect.right());
+    }
+}
+
 BitmapBackingStore::BitmapBackingStore(RefPtr<Gfx::Bitmap> bitmap)
     : m_bitmap(move(bitmap))
 {
@@ -23,6 +23,10 @@ public:
     virtual Gfx::IntSize size() const = 0;
     virtual Gfx::Bitmap& bitmap() const = 0;
 
+    // Copies everything outside of the damaged rect from another backing store of the same size and format,
+    // moving its pixels by the given translation.
+    void copy_undamaged_area_from(BackingStore const&, Gfx::IntRect const& damaged_rect, Gfx::IntPoint translation = {});
+
     BackingStore() {};
     virtual ~BackingStore() {};
 };
@@ -4,12 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/Tracing.h>
 #include <LibWeb/Painting/DisplayList.h>
 
 namespace Web::Painting {
 
 void DisplayList::append(Command&& command, Optional<i32> scroll_frame_id)
 {
+    if (command.has<ApplyBackdropFilter>() || command.has<AddMask>())
+        m_has_commands_depending_on_other_pixels = true;
     m_commands.append({ scroll_frame_id, move(command) });
 }
 
@@ -24,12 +27,194 @@ static Optional<Gfx::IntRect> command_bounding_rectangle(Command const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list)
+static bool can_be_merged(DrawGlyphRun const& a, DrawGlyphRun const& b)
 {
+    return &a.glyph_run->font() == &b.glyph_run->font() && a.color == b.color && a.scale == b.scale;
+}
+
+static DrawGlyphRun merge_glyph_runs(DrawGlyphRun const& a, DrawGlyphRun const& b)
+{
+    Vector<Gfx::DrawGlyph> glyphs;
+    glyphs.ensure_capacity(a.glyph_run->glyphs().size() + b.glyph_run->glyphs().size());
+    glyphs.extend(a.glyph_run->glyphs());
+
+    // Glyph positions are scaled before the translation is applied, so the offset between the runs has to be unscaled.
+    auto offset = (b.translation - a.translation).scaled(static_cast<float>(1 / a.scale));
+    for (auto glyph : b.glyph_run->glyphs()) {
+        glyph.translate_by(offset);
+        glyphs.unchecked_append(glyph);
+    }
+
+    auto glyph_run = adopt_ref(*new Gfx::GlyphRun(move(glyphs), a.glyph_run->font(), a.glyph_run->text_type(), a.glyph_run->width() + b.glyph_run->width()));
+    return DrawGlyphRun {
+        .glyph_run = move(glyph_run),
+        .color = a.color,
+        .rect = a.rect.united(b.rect),
+        .translation = a.translation,
+        .scale = a.scale,
+    };
+}
+
+void DisplayList::optimize()
+{
+    Vector<CommandListItem> optimized_commands;
+    optimized_commands.ensure_capacity(m_commands.size());
+
+    // Every save and stacking context that is still open, along with whether anything was drawn inside it yet.
+    struct OpenGroup {
+        size_t start_index;
+        bool has_drawn_anything;
+    };
+    Vector<OpenGroup> open_groups;
+
+    auto const* previous_item = [&]() -> CommandListItem* {
+        if (optimized_commands.is_empty())
+            return nullptr;
+        return &optimized_commands.last();
+    };
+
+    for (auto& item : m_commands) {
+        auto& command = item.command;
+
+        if (command.has<Save>() || command.has<PushStackingContext>()) {
+            open_groups.append({ .start_index = optimized_commands.size(), .has_drawn_anything = false });
+            optimized_commands.append(move(item));
+            continue;
+        }
+
+        if (command.has<Restore>() || command.has<PopStackingContext>()) {
+            if (open_groups.is_empty()) {
+                optimized_commands.append(move(item));
+                continue;
+            }
+
+            // A group that drew nothing only changed state that is about to be thrown away, clips included.
+            auto group = open_groups.take_last();
+            if (!group.has_drawn_anything) {
+                optimized_commands.shrink(group.start_index);
+                continue;
+            }
+            if (!open_groups.is_empty())
+                open_groups.last().has_drawn_anything = true;
+            optimized_commands.append(move(item));
+            continue;
+        }
+
+        if (command.has<AddClipRect>() || command.has<AddRoundedRectClip>()) {
+            optimized_commands.append(move(item));
+            continue;
+        }
+
+        auto bounding_rect = command_bounding_rectangle(command);
+        if (bounding_rect.has_value() && bounding_rect->is_empty())
+            continue;
+
+        if (!open_groups.is_empty())
+            open_groups.last().has_drawn_anything = true;
+
+        if (auto* previous = previous_item(); previous && previous->scroll_frame_id == item.scroll_frame_id) {
+            // An opaque fill hides any fill right before it that it covers completely.
+            if (auto const* fill_rect = command.get_pointer<FillRect>(); fill_rect && fill_rect->color.alpha() == 255) {
+                if (auto const* previous_fill_rect = previous->command.get_pointer<FillRect>(); previous_fill_rect && fill_rect->rect.contains(previous_fill_rect->rect)) {
+                    previous->command = move(command);
+                    continue;
+                }
+            }
+
+            if (auto const* glyph_run = command.get_pointer<DrawGlyphRun>()) {
+                if (auto const* previous_glyph_run = previous->command.get_pointer<DrawGlyphRun>(); previous_glyph_run && can_be_merged(*previous_glyph_run, *glyph_run)) {
+                    previous->command = merge_glyph_runs(*previous_glyph_run, *glyph_run);
+                    continue;
+                }
+            }
+        }
+
+        optimized_commands.append(move(item));
+    }
+
+    m_commands = {};
+    for (auto& item : optimized_commands)
+        m_commands.append(move(item));
+}
+
+static bool command_depends_on_position(Command const& command)
+{
+    return command.visit(
+        [](auto const& command) {
+            return requires(RemoveCVReference<decltype(command)>& mutable_command) { mutable_command.translate_by(Gfx::IntPoint {}); };
+        });
+}
+
+Vector<Gfx::IntPoint> DisplayList::device_scroll_offsets() const
+{
+    Vector<Gfx::IntPoint> offsets;
+    offsets.ensure_capacity(m_scroll_state.size());
+    for (auto const& scroll_frame : m_scroll_state) {
+        if (!scroll_frame) {
+            offsets.unchecked_append({});
+            continue;
+        }
+        offsets.unchecked_append(scroll_frame->cumulative_offset().to_type<double>().scaled(m_device_pixels_per_css_pixel).to_type<int>());
+    }
+    return offsets;
+}
+
+Optional<Gfx::IntPoint> DisplayList::translation_since(Vector<Gfx::IntPoint> const& previous_device_scroll_offsets, Gfx::IntRect const& viewport_rect) const
+{
+    auto current_device_scroll_offsets = device_scroll_offsets();
+    if (current_device_scroll_offsets.size() != previous_device_scroll_offsets.size())
+        return {};
+
+    auto delta_of_scroll_frame = [&](i32 id) {
+        return current_device_scroll_offsets[id] - previous_device_scroll_offsets[id];
+    };
+
+    Optional<Gfx::IntPoint> translation;
+    for (auto const& item : m_commands) {
+        auto const& command = item.command;
+
+        // The thumb moves by the scroll frame's own offset, so it only moved along if that offset stayed the same.
+        if (auto const* paint_scroll_bar = command.get_pointer<PaintScrollBar>()) {
+            auto parent = m_scroll_state[paint_scroll_bar->scroll_frame_id]->parent();
+            auto parent_delta = parent ? delta_of_scroll_frame(parent->id()) : Gfx::IntPoint {};
+            if (delta_of_scroll_frame(paint_scroll_bar->scroll_frame_id) != parent_delta)
+                return {};
+        }
+
+        if (!command_depends_on_position(command))
+            continue;
+
+        if (!item.scroll_frame_id.has_value()) {
+            // A fill covering the whole viewport looks the same wherever it moves.
+            if (auto const* fill_rect = command.get_pointer<FillRect>(); fill_rect && fill_rect->rect.contains(viewport_rect))
+                continue;
+            return {};
+        }
+
+        auto delta = delta_of_scroll_frame(item.scroll_frame_id.value());
+        if (!translation.has_value())
+            translation = delta;
+        else if (*translation != delta)
+            return {};
+    }
+    return translation.value_or({});
+}
+
+void DisplayListPlayer::execute(DisplayList& display_list, Optional<Gfx::IntRect> const& damaged_rect)
+{
+    TRACE_SCOPE("paint", "DisplayListPlayer::execute");
+
     auto const& commands = display_list.commands();
     auto const& scroll_state = display_list.scroll_state();
     auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
 
+    // Clipping to the damaged rect makes would_be_fully_clipped_by_painter() cull every command outside of it,
+    // including the ones nested in transformed stacking contexts.
+    if (damaged_rect.has_value()) {
+        save({});
+        add_clip_rect({ .rect = *damaged_rect });
+    }
+
     size_t next_command_index = 0;
     while (next_command_index < commands.size()) {
         auto scroll_frame_id = commands[next_command_index].scroll_frame_id;
@@ -102,6 +287,29 @@ void DisplayListPlayer::execute(DisplayList& display_list)
         else VERIFY_NOT_REACHED();
         // clang-format on
     }
+
+    if (damaged_rect.has_value())
+        restore({});
+}
+
+size_t DisplayList::memory_usage() const
+{
+    size_t bytes = sizeof(DisplayList) + m_commands.size() * sizeof(CommandListItem) + m_scroll_state.size() * sizeof(RefPtr<ScrollFrame>);
+
+    for (auto const& item : m_commands) {
+        item.command.visit(
+            [&](AddMask const& command) {
+                if (command.display_list)
+                    bytes += command.display_list->memory_usage();
+            },
+            [&](PaintNestedDisplayList const& command) {
+                if (command.display_list)
+                    bytes += command.display_list->memory_usage();
+            },
+            [](auto const&) {});
+    }
+
+    return bytes;
 }
 
 }
@@ -39,7 +39,8 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList& display_list);
+    // Commands that can't touch the damaged rect, if one is given, are skipped.
+    void execute(DisplayList& display_list, Optional<Gfx::IntRect> const& damaged_rect = {});
 
 private:
     virtual void draw_glyph_run(DrawGlyphRun const&) = 0;
@@ -85,6 +86,9 @@ public:
 
     void append(Command&& command, Optional<i32> scroll_frame_id);
 
+    // Drops commands that can't change the output, and merges adjacent glyph runs that can be drawn at once.
+    void optimize();
+
     struct CommandListItem {
         Optional<i32> scroll_frame_id;
         Command command;
@@ -99,10 +103,24 @@ public:
     void set_device_pixels_per_css_pixel(double device_pixels_per_css_pixel) { m_device_pixels_per_css_pixel = device_pixels_per_css_pixel; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
+    // Backdrop filters and masks depend on pixels painted by other commands, so they can change outside the damaged area.
+    bool can_be_painted_partially() const { return !m_has_commands_depending_on_other_pixels; }
+
+    // The cumulative offset of every scroll frame, in device pixels, as applied to commands during playback.
+    Vector<Gfx::IntPoint> device_scroll_offsets() const;
+    // Returns how far everything painted in the viewport moved since the given scroll offsets were current,
+    // or nothing if it didn't all move together.
+    Optional<Gfx::IntPoint> translation_since(Vector<Gfx::IntPoint> const& previous_device_scroll_offsets, Gfx::IntRect const& viewport_rect) const;
+
+    // The memory held by the commands and any nested display lists. Glyph runs, paths and other data that commands
+    // reference by pointer are not included.
+    size_t memory_usage() const;
+
 private:
     DisplayList() = default;
 
     AK::SegmentedVector<CommandListItem, 512> m_commands;
+    bool m_has_commands_depending_on_other_pixels { false };
     Vector<RefPtr<ScrollFrame>> m_scroll_state;
     double m_device_pixels_per_css_pixel;
 };
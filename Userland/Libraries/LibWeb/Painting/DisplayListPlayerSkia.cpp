@@ -4,12 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <core/SkBitmap.h>
 #include <core/SkBlurTypes.h>
 #include <core/SkCanvas.h>
 #include <core/SkColorFilter.h>
 #include <core/SkFont.h>
 #include <core/SkFontMgr.h>
+#include <core/SkGraphics.h>
 #include <core/SkMaskFilter.h>
 #include <core/SkPath.h>
 #include <core/SkPathBuilder.h>
@@ -90,6 +92,13 @@ public:
         m_context->submit(GrSyncCpu::kYes);
     }
 
+    size_t resource_cache_usage() const override
+    {
+        size_t bytes = 0;
+        m_context->getResourceCacheUsage(nullptr, &bytes);
+        return bytes;
+    }
+
     sk_sp<SkSurface> create_surface(int width, int height)
     {
         auto image_info = SkImageInfo::Make(width, height, kBGRA_8888_SkColorType, kPremul_SkAlphaType);
@@ -166,6 +175,13 @@ public:
         m_context->submit(GrSyncCpu::kYes);
     }
 
+    size_t resource_cache_usage() const override
+    {
+        size_t bytes = 0;
+        m_context->getResourceCacheUsage(nullptr, &bytes);
+        return bytes;
+    }
+
 private:
     sk_sp<GrDirectContext> m_context;
 };
@@ -210,6 +226,16 @@ DisplayListPlayerSkia::~DisplayListPlayerSkia()
         m_flush_context();
 }
 
+size_t DisplayListPlayerSkia::font_cache_usage()
+{
+    return SkGraphics::GetFontCacheUsed();
+}
+
+size_t DisplayListPlayerSkia::resource_cache_usage()
+{
+    return SkGraphics::GetResourceCacheTotalBytesUsed();
+}
+
 static SkPoint to_skia_point(auto const& point)
 {
     return SkPoint::Make(point.x(), point.y());
@@ -661,6 +687,83 @@ static void add_spread_distance_to_border_radius(int& border_radius, int spread_
     }
 }
 
+struct BlurredRoundedRectMask {
+    sk_sp<SkImage> image;
+    // The one pixel of the mask that stretches to fill the middle of a shadow of any size.
+    SkIRect center;
+    int margin { 0 };
+    Gfx::IntSize minimum_size;
+};
+
+// Blurring is the expensive part of painting a box shadow, and pages tend to repeat the same few shadows on many
+// elements. The blurred corners only depend on the radii and the blur, so a small mask of them can be shared by
+// every box shadow with those parameters, whatever its size.
+static BlurredRoundedRectMask const& blurred_rounded_rect_mask(CornerRadii const& corner_radii, int blur_radius)
+{
+    struct Key {
+        CornerRadii corner_radii;
+        int blur_radius;
+
+        bool operator==(Key const& other) const
+        {
+            auto equals = [](CornerRadius const& a, CornerRadius const& b) {
+                return a.horizontal_radius == b.horizontal_radius && a.vertical_radius == b.vertical_radius;
+            };
+            return equals(corner_radii.top_left, other.corner_radii.top_left)
+                && equals(corner_radii.top_right, other.corner_radii.top_right)
+                && equals(corner_radii.bottom_right, other.corner_radii.bottom_right)
+                && equals(corner_radii.bottom_left, other.corner_radii.bottom_left)
+                && blur_radius == other.blur_radius;
+        }
+    };
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key)
+        {
+            auto hash = int_hash(key.blur_radius);
+            for (auto const& corner_radius : { key.corner_radii.top_left, key.corner_radii.top_right, key.corner_radii.bottom_right, key.corner_radii.bottom_left })
+                hash = pair_int_hash(hash, pair_int_hash(corner_radius.horizontal_radius, corner_radius.vertical_radius));
+            return hash;
+        }
+    };
+
+    // Once full, the cache is simply cleared. The masks still in use are quickly blurred again.
+    static constexpr size_t max_cached_masks = 256;
+    static HashMap<Key, BlurredRoundedRectMask, KeyTraits> s_masks;
+
+    Key key { corner_radii, blur_radius };
+    if (auto it = s_masks.find(key); it != s_masks.end())
+        return it->value;
+    if (s_masks.size() >= max_cached_masks)
+        s_masks.clear();
+
+    auto sigma = blur_radius / 2;
+    // The blur reaches three sigmas past the edges of the shape, plus a pixel of anti-aliasing.
+    auto margin = 3 * sigma + 1;
+
+    auto left = max(corner_radii.top_left.horizontal_radius, corner_radii.bottom_left.horizontal_radius);
+    auto right = max(corner_radii.top_right.horizontal_radius, corner_radii.bottom_right.horizontal_radius);
+    auto top = max(corner_radii.top_left.vertical_radius, corner_radii.top_right.vertical_radius);
+    auto bottom = max(corner_radii.bottom_left.vertical_radius, corner_radii.bottom_right.vertical_radius);
+
+    // The smallest shape that still has one column and row of pixels that neither a corner nor the blur of a corner
+    // reaches. Every shadow at least this big looks the same along that column and row, so they can be stretched.
+    Gfx::IntSize minimum_size { left + right + 2 * margin + 1, top + bottom + 2 * margin + 1 };
+
+    auto surface = SkSurfaces::Raster(SkImageInfo::MakeA8(minimum_size.width() + 2 * margin, minimum_size.height() + 2 * margin));
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, sigma));
+    surface->getCanvas()->drawRRect(to_skia_rrect(Gfx::IntRect { { margin, margin }, minimum_size }, corner_radii), paint);
+
+    BlurredRoundedRectMask mask {
+        .image = surface->makeImageSnapshot(),
+        .center = SkIRect::MakeXYWH(left + 2 * margin, top + 2 * margin, 1, 1),
+        .margin = margin,
+        .minimum_size = minimum_size,
+    };
+    return s_masks.ensure(key, [&] { return move(mask); });
+}
+
 void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& command)
 {
     auto const& outer_box_shadow_params = command.box_shadow_params;
@@ -693,6 +796,17 @@ void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& co
     SkPaint paint;
     paint.setAntiAlias(true);
     paint.setColor(to_skia_color(color));
+
+    if (blur_radius / 2 > 0) {
+        auto const& mask = blurred_rounded_rect_mask(corner_radii, blur_radius);
+        if (shadow_rect.width() >= mask.minimum_size.width() && shadow_rect.height() >= mask.minimum_size.height()) {
+            auto destination_rect = shadow_rect.inflated(mask.margin, mask.margin, mask.margin, mask.margin);
+            canvas.drawImageNine(mask.image.get(), mask.center, to_skia_rect(destination_rect), SkFilterMode::kNearest, &paint);
+            canvas.restore();
+            return;
+        }
+    }
+
     paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
     auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
     canvas.drawRRect(shadow_rounded_rect, paint);
@@ -29,6 +29,9 @@ public:
     virtual ~SkiaBackendContext() {};
 
     virtual void flush_and_submit() {};
+
+    // The bytes held by the GPU resource cache, e.g. textures and render targets.
+    virtual size_t resource_cache_usage() const { return 0; }
 };
 
 class DisplayListPlayerSkia : public DisplayListPlayer {
@@ -47,6 +50,10 @@ public:
 
     virtual ~DisplayListPlayerSkia() override;
 
+    // Skia's process-wide caches of rasterized glyphs, and of other CPU-side resources like decoded images.
+    static size_t font_cache_usage();
+    static size_t resource_cache_usage();
+
 private:
     void draw_glyph_run(DrawGlyphRun const&) override;
     void fill_rect(FillRect const&) override;
@@ -114,6 +114,11 @@ public:
         return state().scroll_frame_id;
     }
 
+    Gfx::FloatPoint translation() const
+    {
+        return state().translation.translation();
+    }
+
     void save();
     void restore();
 
@@ -192,6 +192,9 @@ TraversalDecision InlinePaintable::hit_test(CSSPixelPoint position, HitTestType
     if (clip_rect_for_hit_testing().has_value() && !clip_rect_for_hit_testing().value().contains(position))
         return TraversalDecision::Continue;
 
+    if (is_outside_hit_test_bounds(position, type))
+        return TraversalDecision::Continue;
+
     auto position_adjusted_by_scroll_offset = position;
     position_adjusted_by_scroll_offset.translate_by(-cumulative_offset_of_enclosing_scroll_frame());
 
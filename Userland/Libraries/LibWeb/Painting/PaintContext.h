@@ -11,6 +11,7 @@
 #include <LibGfx/Forward.h>
 #include <LibGfx/Palette.h>
 #include <LibGfx/Rect.h>
+#include <LibWeb/Forward.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 #include <LibWeb/PixelUnits.h>
 
@@ -84,6 +85,14 @@ public:
 
     u64 paint_generation_id() const { return m_paint_generation_id; }
 
+    // Only set while recording a document's display list. Stacking contexts replay the commands they cached in an
+    // earlier recording of the same generation instead of painting their subtree again.
+    Optional<u64> display_list_cache_generation() const { return m_display_list_cache_generation; }
+    void set_display_list_cache_generation(u64 generation) { m_display_list_cache_generation = generation; }
+
+    Painting::StackingContext const* stacking_context_being_cached() const { return m_stacking_context_being_cached; }
+    void set_stacking_context_being_cached(Painting::StackingContext const* stacking_context) { m_stacking_context_being_cached = stacking_context; }
+
 private:
     Painting::DisplayListRecorder& m_display_list_recorder;
     Palette m_palette;
@@ -95,6 +104,8 @@ private:
     bool m_draw_svg_geometry_for_clip_path { false };
     Gfx::AffineTransform m_svg_transform;
     u64 m_paint_generation_id { 0 };
+    Optional<u64> m_display_list_cache_generation;
+    Painting::StackingContext const* m_stacking_context_being_cached { nullptr };
 };
 
 }
@@ -9,6 +9,7 @@
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/StackingContext.h>
+#include <LibWeb/Painting/ViewportPaintable.h>
 
 namespace Web::Painting {
 
@@ -108,6 +109,18 @@ TraversalDecision Paintable::hit_test(CSSPixelPoint, HitTestType, Function<Trave
     return TraversalDecision::Continue;
 }
 
+bool Paintable::is_outside_hit_test_bounds(CSSPixelPoint position, HitTestType type) const
+{
+    // NOTE: Text cursor hit testing also reports fragments that are merely close to the position, so only exact
+    //       hit tests can be culled.
+    if (type != HitTestType::Exact || !m_hit_test_bounds.has_value())
+        return false;
+    auto const* viewport_paintable = document().paintable();
+    if (!viewport_paintable || viewport_paintable->needs_to_update_hit_test_bounds())
+        return false;
+    return !m_hit_test_bounds->contains(position);
+}
+
 StackingContext* Paintable::enclosing_stacking_context()
 {
     for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
@@ -132,27 +145,80 @@ void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_displa
 {
     auto& document = const_cast<DOM::Document&>(this->document());
     if (should_invalidate_display_list == InvalidateDisplayList::Yes)
-        document.invalidate_display_list();
+        document.invalidate_display_list_for(*this);
 
     auto* containing_block = this->containing_block();
     if (!containing_block)
         return;
 
+    // Glyphs and text decorations can be painted outside of their fragment, so we damage a bit more than its rect.
+    auto fragment_damage_rect = [](PaintableFragment const& fragment, CSSPixels extra) {
+        auto inflate = fragment.height() + extra;
+        return fragment.absolute_rect().inflated(inflate, inflate, inflate, inflate);
+    };
+
     if (is<Painting::InlinePaintable>(*this)) {
-        auto const& fragments = static_cast<Painting::InlinePaintable const*>(this)->fragments();
-        for (auto const& fragment : fragments) {
-            document.set_needs_display(fragment.absolute_rect(), InvalidateDisplayList::No);
+        auto const& inline_paintable = static_cast<Painting::InlinePaintable const&>(*this);
+        if (!inline_paintable.box_shadow_data().is_empty()) {
+            document.set_needs_display(InvalidateDisplayList::No);
+            return;
+        }
+
+        auto const& box_model = inline_paintable.box_model();
+        auto extra = max(box_model.padding.top + box_model.border.top, box_model.padding.bottom + box_model.border.bottom);
+        extra = max(extra, max(box_model.padding.left + box_model.border.left, box_model.padding.right + box_model.border.right));
+        if (auto const& outline_data = inline_paintable.outline_data(); outline_data.has_value())
+            extra += max(max(outline_data->top.width, outline_data->bottom.width), max(outline_data->left.width, outline_data->right.width)) + max(CSSPixels(0), inline_paintable.outline_offset());
+
+        for (auto const& fragment : inline_paintable.fragments()) {
+            if (!fragment.shadows().is_empty()) {
+                document.set_needs_display(InvalidateDisplayList::No);
+                return;
+            }
+            set_needs_display_for_absolute_rect(fragment_damage_rect(fragment, extra));
         }
     }
 
     if (!is<Painting::PaintableWithLines>(*containing_block))
         return;
     static_cast<Painting::PaintableWithLines const&>(*containing_block).for_each_fragment([&](auto& fragment) {
-        document.set_needs_display(fragment.absolute_rect(), InvalidateDisplayList::No);
+        if (!fragment.shadows().is_empty()) {
+            document.set_needs_display(InvalidateDisplayList::No);
+            return IterationDecision::Break;
+        }
+        containing_block->set_needs_display_for_absolute_rect(fragment_damage_rect(fragment, 0));
         return IterationDecision::Continue;
     });
 }
 
+void Paintable::set_needs_display_for_absolute_rect(CSSPixelRect const& absolute_rect)
+{
+    auto& document = const_cast<DOM::Document&>(this->document());
+
+    // Anything other than a translation would need the whole transform to be applied to the rect, so we give up on those.
+    if (!compute_combined_css_transform().is_identity()) {
+        document.set_needs_display(InvalidateDisplayList::No);
+        return;
+    }
+
+    ClippableAndScrollable const* clippable_and_scrollable = nullptr;
+    if (is_paintable_box())
+        clippable_and_scrollable = static_cast<PaintableBox const*>(this);
+    else if (is_inline_paintable())
+        clippable_and_scrollable = static_cast<InlinePaintable const*>(this);
+    else
+        clippable_and_scrollable = containing_block();
+
+    if (!clippable_and_scrollable) {
+        document.set_needs_display(InvalidateDisplayList::No);
+        return;
+    }
+
+    // Painting applies the offsets of scroll frames to everything inside them, so we do the same to find the damaged part of the viewport.
+    auto viewport_rect = absolute_rect.translated(clippable_and_scrollable->cumulative_offset_of_enclosing_scroll_frame());
+    document.set_needs_display(viewport_rect, InvalidateDisplayList::No);
+}
+
 CSSPixelPoint Paintable::box_type_agnostic_position() const
 {
     if (is_paintable_box())
@@ -169,6 +169,13 @@ public:
 
     [[nodiscard]] virtual TraversalDecision hit_test(CSSPixelPoint, HitTestType, Function<TraversalDecision(HitTestResult)> const& callback) const;
 
+    // Bounds of every position at which an exact hit test of this paintable's subtree can produce a result, in the
+    // coordinate space of the position passed to hit_test(). These are maintained by ViewportPaintable, and let hit
+    // testing skip whole subtrees instead of walking every paintable on the page.
+    Optional<CSSPixelRect> const& hit_test_bounds() const { return m_hit_test_bounds; }
+    void set_hit_test_bounds(CSSPixelRect const& bounds) { m_hit_test_bounds = bounds; }
+    [[nodiscard]] bool is_outside_hit_test_bounds(CSSPixelPoint, HitTestType) const;
+
     virtual bool wants_mouse_events() const { return false; }
 
     virtual bool forms_unconnected_subtree() const { return false; }
@@ -250,6 +257,10 @@ public:
 protected:
     explicit Paintable(Layout::Node const&);
 
+    // Tells the document that the given absolute rect has to be painted again. If we can't tell where the rect
+    // ends up in the viewport, the whole viewport is damaged instead.
+    void set_needs_display_for_absolute_rect(CSSPixelRect const&);
+
     virtual void visit_edges(Cell::Visitor&) override;
 
 private:
@@ -260,6 +271,8 @@ private:
 
     OwnPtr<StackingContext> m_stacking_context;
 
+    Optional<CSSPixelRect> m_hit_test_bounds;
+
     SelectionState m_selection_state { SelectionState::None };
 
     bool m_positioned : 1 { false };
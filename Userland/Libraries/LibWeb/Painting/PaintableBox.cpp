@@ -826,9 +826,13 @@ TraversalDecision PaintableBox::hit_test(CSSPixelPoint position, HitTestType typ
         viewport_paintable.build_stacking_context_tree_if_needed();
         viewport_paintable.document().update_paint_and_hit_testing_properties_if_needed();
         viewport_paintable.refresh_scroll_state();
+        viewport_paintable.update_hit_test_bounds_if_needed();
         return stacking_context()->hit_test(position, type, callback);
     }
 
+    if (is_outside_hit_test_bounds(position, type))
+        return TraversalDecision::Continue;
+
     for (auto const* child = last_child(); child; child = child->previous_sibling()) {
         auto z_index = child->computed_values().z_index();
         if (child->layout_node().is_positioned() && z_index.value_or(0) == 0)
@@ -877,6 +881,9 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
         return PaintableBox::hit_test(position, type, callback);
     }
 
+    if (is_outside_hit_test_bounds(position, type))
+        return TraversalDecision::Continue;
+
     if (hit_test_scrollbars(position_adjusted_by_scroll_offset, callback) == TraversalDecision::Break)
         return TraversalDecision::Break;
 
@@ -958,7 +965,22 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
 
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        document().invalidate_display_list_for(*this);
+
+    // The root element and body paint their background onto the whole canvas, and SVG strokes and markers can
+    // go past the box of the shape they belong to.
+    if (is_viewport() || layout_box().is_root_element() || layout_box().is_body() || is_svg_paintable()) {
+        document().set_needs_display(InvalidateDisplayList::No);
+        return;
+    }
+
+    auto damage_rect = absolute_paint_rect();
+    if (auto const& outline_data = this->outline_data(); outline_data.has_value()) {
+        auto outline_offset = max(CSSPixels(0), this->outline_offset());
+        damage_rect.inflate(outline_data->top.width + outline_offset, outline_data->right.width + outline_offset, outline_data->bottom.width + outline_offset, outline_data->left.width + outline_offset);
+    }
+    set_needs_display_for_absolute_rect(damage_rect);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
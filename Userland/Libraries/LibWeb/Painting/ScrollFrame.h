@@ -19,6 +19,7 @@ public:
     }
 
     i32 id() const { return m_id; }
+    RefPtr<ScrollFrame const> parent() const { return m_parent; }
 
     CSSPixelPoint cumulative_offset() const
     {
@@ -264,7 +264,102 @@ static Gfx::FloatMatrix4x4 matrix_with_scaled_translation(Gfx::FloatMatrix4x4 ma
     return matrix;
 }
 
+void StackingContext::invalidate_cached_display_list()
+{
+    for (auto* stacking_context = this; stacking_context; stacking_context = stacking_context->parent())
+        stacking_context->m_cached_display_list.clear();
+}
+
+size_t StackingContext::cached_display_list_memory_usage() const
+{
+    if (!m_cached_display_list.has_value())
+        return 0;
+
+    size_t bytes = 0;
+    for (auto const& segment : m_cached_display_list->segments)
+        bytes += sizeof(CachedDisplayListSegment) + segment.commands.capacity() * sizeof(DisplayList::CommandListItem);
+    return bytes;
+}
+
+bool StackingContext::can_cache_display_list() const
+{
+    // Masks and clip paths may be taken from other elements, whose changes don't invalidate this stacking context.
+    if (paintable().computed_values().clip_path().has_value())
+        return false;
+    if (paintable().is_paintable_box() && paintable_box().get_masking_area().has_value())
+        return false;
+    return true;
+}
+
+void StackingContext::finish_cached_segment(DisplayList const& display_list, StackingContext const* child_painted_after) const
+{
+    auto const& commands = display_list.commands();
+    CachedDisplayListSegment segment { .child_painted_after = child_painted_after };
+    segment.commands.ensure_capacity(commands.size() - m_cached_segment_start);
+    for (size_t i = m_cached_segment_start; i < commands.size(); ++i)
+        segment.commands.unchecked_append(commands[i]);
+    m_cached_display_list->segments.append(move(segment));
+}
+
+void StackingContext::replay_cached_display_list(PaintContext& context) const
+{
+    auto& display_list = context.display_list_recorder().display_list();
+    for (auto const& segment : m_cached_display_list->segments) {
+        for (auto const& item : segment.commands)
+            display_list.append(Command { item.command }, item.scroll_frame_id);
+        if (segment.child_painted_after)
+            segment.child_painted_after->paint(context);
+    }
+}
+
 void StackingContext::paint(PaintContext& context) const
+{
+    auto generation = context.display_list_cache_generation();
+    if (!generation.has_value()) {
+        paint_uncached(context);
+        return;
+    }
+
+    auto& recorder = context.display_list_recorder();
+    auto const& display_list = recorder.display_list();
+
+    // If an ancestor is caching what it records, end its current segment here, as this stacking context will be
+    // replayed from its own cache.
+    auto const* ancestor_being_cached = context.stacking_context_being_cached();
+    if (ancestor_being_cached)
+        ancestor_being_cached->finish_cached_segment(display_list, this);
+
+    auto cached_display_list_is_valid = m_cached_display_list.has_value()
+        && m_cached_display_list->generation == generation.value()
+        && m_cached_display_list->translation == recorder.translation()
+        && m_cached_display_list->scroll_frame_id == recorder.scroll_frame_id();
+
+    if (cached_display_list_is_valid) {
+        context.set_stacking_context_being_cached(nullptr);
+        replay_cached_display_list(context);
+    } else if (can_cache_display_list()) {
+        m_cached_display_list = CachedDisplayList {
+            .generation = generation.value(),
+            .translation = recorder.translation(),
+            .scroll_frame_id = recorder.scroll_frame_id(),
+            .segments = {},
+        };
+        m_cached_segment_start = display_list.commands().size();
+        context.set_stacking_context_being_cached(this);
+        paint_uncached(context);
+        finish_cached_segment(display_list, nullptr);
+    } else {
+        m_cached_display_list.clear();
+        context.set_stacking_context_being_cached(nullptr);
+        paint_uncached(context);
+    }
+
+    context.set_stacking_context_being_cached(ancestor_being_cached);
+    if (ancestor_being_cached)
+        ancestor_being_cached->m_cached_segment_start = display_list.commands().size();
+}
+
+void StackingContext::paint_uncached(PaintContext& context) const
 {
     auto opacity = paintable().computed_values().opacity();
     if (opacity == 0.0f)
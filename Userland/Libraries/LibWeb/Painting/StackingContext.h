@@ -8,6 +8,7 @@
 
 #include <AK/Vector.h>
 #include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/InlinePaintable.h>
 #include <LibWeb/Painting/Paintable.h>
 
@@ -48,6 +49,12 @@ public:
 
     void set_last_paint_generation_id(u64 generation_id);
 
+    // Drops the commands cached for this stacking context and all of its ancestors, which include them.
+    void invalidate_cached_display_list();
+
+    // The memory held by the commands cached for this stacking context alone, not including its children.
+    size_t cached_display_list_memory_usage() const;
+
 private:
     JS::NonnullGCPtr<Paintable> m_paintable;
     StackingContext* const m_parent { nullptr };
@@ -58,7 +65,27 @@ private:
     Vector<JS::NonnullGCPtr<Paintable const>> m_positioned_descendants_with_stack_level_0_and_stacking_contexts;
     Vector<JS::NonnullGCPtr<Paintable const>> m_non_positioned_floating_descendants;
 
+    // The commands recorded for this stacking context in a previous frame, split at each child stacking context
+    // so that the children can be replayed (or re-recorded, if they changed) from their own cache.
+    struct CachedDisplayListSegment {
+        Vector<DisplayList::CommandListItem> commands;
+        StackingContext const* child_painted_after { nullptr };
+    };
+    struct CachedDisplayList {
+        u64 generation { 0 };
+        Gfx::FloatPoint translation;
+        Optional<i32> scroll_frame_id;
+        Vector<CachedDisplayListSegment> segments;
+    };
+    mutable Optional<CachedDisplayList> m_cached_display_list;
+    mutable size_t m_cached_segment_start { 0 };
+
+    bool can_cache_display_list() const;
+    void finish_cached_segment(DisplayList const&, StackingContext const* child_painted_after) const;
+    void replay_cached_display_list(PaintContext&) const;
+
     static void paint_child(PaintContext&, StackingContext const&);
+    void paint_uncached(PaintContext&) const;
     void paint_internal(PaintContext&) const;
 };
 
@@ -6,6 +6,7 @@
 
 #include <LibWeb/DOM/Range.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Painting/InlinePaintable.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Selection/Selection.h>
@@ -182,6 +183,9 @@ void ViewportPaintable::refresh_scroll_state()
         return;
     m_needs_to_refresh_scroll_state = false;
 
+    // Hit test bounds include the scroll offsets of enclosing scroll frames.
+    invalidate_hit_test_bounds();
+
     for (auto& it : sticky_state) {
         auto const& sticky_box = *it.key;
         auto& scroll_frame = *it.value;
@@ -263,6 +267,51 @@ void ViewportPaintable::refresh_scroll_state()
     }
 }
 
+static CSSPixelRect update_hit_test_bounds(Paintable& paintable)
+{
+    CSSPixelRect bounds;
+    for (auto* child = paintable.first_child(); child; child = child->next_sibling())
+        bounds = bounds.united(update_hit_test_bounds(*child));
+
+    // NOTE: This mirrors what PaintableBox, PaintableWithLines and InlinePaintable test the position against:
+    //       their border box and line box fragments, shifted by the enclosing scroll frame and clipped by the
+    //       enclosing clip frame. Scrollbar thumbs are always inside the border box.
+    auto unite_with_own_rects = [&](auto const& clippable_and_scrollable, CSSPixelRect own_rect) {
+        own_rect.translate_by(clippable_and_scrollable.cumulative_offset_of_enclosing_scroll_frame());
+        bounds = bounds.united(own_rect);
+        if (auto clip_rect = clippable_and_scrollable.clip_rect_for_hit_testing(); clip_rect.has_value())
+            bounds.intersect(*clip_rect);
+    };
+
+    if (is<PaintableWithLines>(paintable)) {
+        auto const& paintable_with_lines = static_cast<PaintableWithLines const&>(paintable);
+        auto own_rect = paintable_with_lines.absolute_border_box_rect();
+        for (auto const& fragment : paintable_with_lines.fragments())
+            own_rect = own_rect.united(fragment.absolute_rect());
+        unite_with_own_rects(paintable_with_lines, own_rect);
+    } else if (is<PaintableBox>(paintable)) {
+        auto const& paintable_box = static_cast<PaintableBox const&>(paintable);
+        unite_with_own_rects(paintable_box, paintable_box.absolute_border_box_rect());
+    } else if (is<InlinePaintable>(paintable)) {
+        auto const& inline_paintable = static_cast<InlinePaintable const&>(paintable);
+        CSSPixelRect own_rect;
+        for (auto const& fragment : inline_paintable.fragments())
+            own_rect = own_rect.united(fragment.absolute_rect());
+        unite_with_own_rects(inline_paintable, own_rect);
+    }
+
+    paintable.set_hit_test_bounds(bounds);
+    return bounds;
+}
+
+void ViewportPaintable::update_hit_test_bounds_if_needed()
+{
+    if (!m_needs_to_update_hit_test_bounds)
+        return;
+    m_needs_to_update_hit_test_bounds = false;
+    (void)update_hit_test_bounds(*this);
+}
+
 void ViewportPaintable::resolve_paint_only_properties()
 {
     // Resolves layout-dependent properties not handled during layout and stores them in the paint tree.
@@ -39,6 +39,10 @@ public:
 
     void set_needs_to_refresh_scroll_state(bool value) { m_needs_to_refresh_scroll_state = value; }
 
+    void update_hit_test_bounds_if_needed();
+    bool needs_to_update_hit_test_bounds() const { return m_needs_to_update_hit_test_bounds; }
+    void invalidate_hit_test_bounds() { m_needs_to_update_hit_test_bounds = true; }
+
 private:
     void build_stacking_context_tree();
 
@@ -47,6 +51,7 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     bool m_needs_to_refresh_scroll_state { true };
+    bool m_needs_to_update_hit_test_bounds { true };
 };
 
 }
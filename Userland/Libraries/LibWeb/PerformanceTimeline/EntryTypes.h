@@ -11,10 +11,12 @@
 namespace Web::PerformanceTimeline::EntryTypes {
 
 // https://w3c.github.io/timing-entrytypes-registry/#registry
+// NOTE: "gc" is non-standard, see PerformanceGarbageCollectionTiming.
 #define ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPES                        \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(element)                  \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(event)                    \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(first_input)              \
+    __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(gc)                       \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(largest_contentful_paint) \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(layout_shift)             \
     __ENUMERATE_PERFORMANCE_TIMELINE_ENTRY_TYPE(longtask)                 \
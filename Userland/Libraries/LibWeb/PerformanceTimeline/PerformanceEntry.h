@@ -42,6 +42,9 @@ protected:
     PerformanceEntry(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration);
     virtual void initialize(JS::Realm&) override;
 
+    // Some entries are created before their duration is known, e.g. event timing entries, which last until the next paint.
+    void set_duration(HighResolutionTime::DOMHighResTimeStamp duration) { m_duration = duration; }
+
 private:
     // https://www.w3.org/TR/performance-timeline/#dom-performanceentry-name
     String m_name;
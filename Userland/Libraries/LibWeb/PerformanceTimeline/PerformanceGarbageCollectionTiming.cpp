@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceGarbageCollectionTimingPrototype.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+#include <LibWeb/PerformanceTimeline/PerformanceGarbageCollectionTiming.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+
+namespace Web::PerformanceTimeline {
+
+JS_DEFINE_ALLOCATOR(PerformanceGarbageCollectionTiming);
+
+static bool s_enabled = false;
+
+bool PerformanceGarbageCollectionTiming::is_enabled()
+{
+    return s_enabled;
+}
+
+void PerformanceGarbageCollectionTiming::set_enabled(bool enabled)
+{
+    s_enabled = enabled;
+}
+
+static String collection_type_name(JS::Heap::CollectionType type)
+{
+    switch (type) {
+    case JS::Heap::CollectionType::CollectGarbage:
+        return "collect-garbage"_string;
+    case JS::Heap::CollectionType::CollectEverything:
+        return "collect-everything"_string;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static HighResolutionTime::DOMHighResTimeStamp to_unsafe_shared_time(MonotonicTime time)
+{
+    // NOTE: This matches HighResolutionTime::unsafe_shared_current_time(), which is also based on the monotonic clock.
+    return time.nanoseconds() / 1.0e6;
+}
+
+PerformanceGarbageCollectionTiming::PerformanceGarbageCollectionTiming(JS::Realm& realm, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, JS::Heap::GarbageCollectionEvent const& event)
+    : PerformanceEntry(realm, name, start_time, duration)
+    , m_used_bytes_before(event.used_bytes_before)
+    , m_used_bytes_after(event.used_bytes_after)
+    , m_swept_cells(event.swept_cells)
+    , m_swept_bytes(event.swept_bytes)
+{
+}
+
+PerformanceGarbageCollectionTiming::~PerformanceGarbageCollectionTiming() = default;
+
+JS::NonnullGCPtr<PerformanceGarbageCollectionTiming> PerformanceGarbageCollectionTiming::create(JS::Realm& realm, JS::Heap::GarbageCollectionEvent const& event)
+{
+    auto& global = realm.global_object();
+
+    auto start_time = HighResolutionTime::relative_high_resolution_time(to_unsafe_shared_time(event.start_time), global);
+    auto end_time = HighResolutionTime::relative_high_resolution_time(to_unsafe_shared_time(event.start_time + event.duration), global);
+
+    return realm.heap().allocate<PerformanceGarbageCollectionTiming>(realm, realm, collection_type_name(event.type), start_time, end_time - start_time, event);
+}
+
+FlyString const& PerformanceGarbageCollectionTiming::entry_type() const
+{
+    return EntryTypes::gc;
+}
+
+void PerformanceGarbageCollectionTiming::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceGarbageCollectionTiming);
+}
+
+void did_collect_garbage(JS::Heap::GarbageCollectionEvent const& event)
+{
+    HTML::main_thread_event_loop().statistics().record_garbage_collection(event);
+
+    if (!PerformanceGarbageCollectionTiming::is_enabled())
+        return;
+
+    // NOTE: We're in the middle of the collection, so the entries can't be allocated until it is over.
+    Platform::EventLoopPlugin::the().deferred_invoke([event] {
+        for (auto const& document : HTML::main_thread_event_loop().documents_in_this_event_loop()) {
+            if (!document->is_fully_active())
+                continue;
+
+            auto window = document->window();
+            if (!window)
+                continue;
+
+            auto entry = PerformanceGarbageCollectionTiming::create(window->realm(), event);
+            window->queue_performance_entry(entry);
+        }
+    });
+}
+
+}
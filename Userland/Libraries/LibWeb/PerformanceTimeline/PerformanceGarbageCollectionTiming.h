@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibJS/Heap/Heap.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::PerformanceTimeline {
+
+// A non-standard entry for each garbage collection of the main thread's heap. The entry's name is the kind of
+// collection, and its start time and duration are those of the collection.
+class PerformanceGarbageCollectionTiming final : public PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceGarbageCollectionTiming, PerformanceEntry);
+    JS_DECLARE_ALLOCATOR(PerformanceGarbageCollectionTiming);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<PerformanceGarbageCollectionTiming> create(JS::Realm&, JS::Heap::GarbageCollectionEvent const&);
+    virtual ~PerformanceGarbageCollectionTiming() override;
+
+    // NOTE: As this isn't in the registry, these follow what the registry says about "longtask" entries.
+    static AvailableFromTimeline available_from_timeline() { return AvailableFromTimeline::Yes; }
+    static Optional<u64> max_buffer_size() { return 200; }
+    virtual ShouldAddEntry should_add_entry(Optional<PerformanceObserverInit const&> = {}) const override { return ShouldAddEntry::Yes; }
+
+    // Whether "gc" is one of the supported entry types. This is off by default, as it exposes the heap's behavior to
+    // the page, and reports on collections caused by every document in the process.
+    static bool is_enabled();
+    static void set_enabled(bool);
+
+    virtual FlyString const& entry_type() const override;
+
+    u64 used_bytes_before() const { return m_used_bytes_before; }
+    u64 used_bytes_after() const { return m_used_bytes_after; }
+    u64 swept_cells() const { return m_swept_cells; }
+    u64 swept_bytes() const { return m_swept_bytes; }
+
+private:
+    PerformanceGarbageCollectionTiming(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, JS::Heap::GarbageCollectionEvent const&);
+
+    virtual void initialize(JS::Realm&) override;
+
+    u64 m_used_bytes_before { 0 };
+    u64 m_used_bytes_after { 0 };
+    u64 m_swept_cells { 0 };
+    u64 m_swept_bytes { 0 };
+};
+
+// Records the collection in the event loop's statistics, and if enabled, queues a "gc" entry for every active document
+// once the collection is over.
+void did_collect_garbage(JS::Heap::GarbageCollectionEvent const&);
+
+}
@@ -6,11 +6,17 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/PerformanceObserverPrototype.h>
+#include <LibWeb/EventTiming/PerformanceEventTiming.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
 #include <LibWeb/HighResolutionTime/SupportedPerformanceTypes.h>
+#include <LibWeb/LongTasks/PerformanceLongTaskTiming.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
 #include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+#include <LibWeb/PerformanceTimeline/PerformanceGarbageCollectionTiming.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserver.h>
+#include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
+#include <LibWeb/UserTiming/PerformanceMark.h>
+#include <LibWeb/UserTiming/PerformanceMeasure.h>
 #include <LibWeb/WebIDL/CallbackType.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -96,8 +102,8 @@ WebIDL::ExceptionOr<void> PerformanceObserver::observe(PerformanceObserverInit&
         //    The user agent SHOULD notify developers if entry types is modified. For example, a console warning listing removed
         //    types might be appropriate.
         entry_types.remove_all_matching([](String const& type) {
-#define __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(entry_type, cpp_class) \
-    if (entry_type == type)                                                  \
+#define __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(entry_type, cpp_class)                                \
+    if (entry_type == type && HighResolutionTime::is_supported_performance_entry_type<cpp_class>()) \
         return false;
             ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
 #undef __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
@@ -136,8 +142,8 @@ WebIDL::ExceptionOr<void> PerformanceObserver::observe(PerformanceObserverInit&
         auto& type = options.type.value();
         bool recognized_type = false;
 
-#define __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(entry_type, cpp_class) \
-    if (!recognized_type && entry_type == type)                              \
+#define __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES(entry_type, cpp_class)                                                     \
+    if (!recognized_type && entry_type == type && HighResolutionTime::is_supported_performance_entry_type<cpp_class>()) \
         recognized_type = true;
         ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
 #undef __ENUMERATE_SUPPORTED_PERFORMANCE_ENTRY_TYPES
@@ -8,6 +8,7 @@
 
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 
 namespace Web::PerformanceTimeline {
 
@@ -16,6 +17,9 @@ struct PerformanceObserverInit {
     Optional<Vector<String>> entry_types;
     Optional<String> type;
     Optional<bool> buffered;
+
+    // https://w3c.github.io/event-timing/#dom-performanceobserverinit-durationthreshold
+    Optional<HighResolutionTime::DOMHighResTimeStamp> duration_threshold;
 };
 
 // https://w3c.github.io/performance-timeline/#dom-performanceobserver
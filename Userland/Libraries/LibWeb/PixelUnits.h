@@ -356,6 +356,11 @@ public:
         return CSSPixelFraction(-numerator(), denominator());
     }
 
+    constexpr bool operator==(CSSPixelFraction const& other) const
+    {
+        return (*this <=> other) == 0;
+    }
+
     constexpr int operator<=>(CSSPixelFraction const& other) const
     {
         auto left = static_cast<i64>(m_numerator.raw_value()) * other.m_denominator.raw_value();
@@ -37,7 +37,7 @@ ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::creat
 
     auto plugin = TRY(adopt_nonnull_own_or_enomem(new (nothrow) AudioCodecPluginAgnostic(loader, duration, move(update_timer))));
 
-    constexpr u32 latency_ms = 100;
+    constexpr u32 latency_ms = Audio::target_latency_ms_for_hint(Audio::LatencyHint::Playback);
     // FIXME: Audio loaders are hard-coded to output stereo audio. Once that changes, the channel count provided
     //        below should be retrieved from the audio loader instead of being hard-coded to 2.
     RefPtr<Audio::PlaybackStream> output = TRY(Audio::PlaybackStream::create(
@@ -6,6 +6,7 @@
 
 #include <LibJS/Heap/Heap.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/ResizeObserver/ResizeObservation.h>
@@ -34,17 +35,24 @@ void ResizeObservation::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_realm);
     visitor.visit(m_target);
     visitor.visit(m_last_reported_sizes);
+    visitor.visit(m_current_size);
 }
 
 // https://drafts.csswg.org/resize-observer-1/#dom-resizeobservation-isactive
 bool ResizeObservation::is_active()
 {
     // 1. Set currentSize by calculate box size given target and observedBox.
-    auto current_size = ResizeObserverSize::calculate_box_size(m_realm, m_target, m_observed_box);
+    // NOTE: Box sizes only change when layout runs, so the size calculated for the current layout generation is reused
+    //       instead of being calculated again every time observations are gathered.
+    auto layout_generation = m_target->document().layout_generation();
+    if (!m_current_size || m_current_size_layout_generation != layout_generation) {
+        m_current_size = ResizeObserverSize::calculate_box_size(m_realm, m_target, m_observed_box);
+        m_current_size_layout_generation = layout_generation;
+    }
 
     // 2. Return true if currentSize is not equal to the first entry in this.lastReportedSizes.
     VERIFY(!m_last_reported_sizes.is_empty());
-    if (!m_last_reported_sizes.first()->equals(*current_size))
+    if (!m_last_reported_sizes.first()->equals(*m_current_size))
         return true;
 
     // 3. Return false.
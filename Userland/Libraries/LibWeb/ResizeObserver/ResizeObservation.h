@@ -36,6 +36,9 @@ private:
     JS::NonnullGCPtr<DOM::Element> m_target;
     Bindings::ResizeObserverBoxOptions m_observed_box;
     Vector<JS::NonnullGCPtr<ResizeObserverSize>> m_last_reported_sizes;
+
+    JS::GCPtr<ResizeObserverSize> m_current_size;
+    u64 m_current_size_layout_generation { 0 };
 };
 
 }
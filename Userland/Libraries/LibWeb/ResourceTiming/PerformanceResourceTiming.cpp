@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceResourceTimingPrototype.h>
+#include <LibWeb/Fetch/Infrastructure/ConnectionTimingInfo.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+#include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
+
+namespace Web::ResourceTiming {
+
+JS_DEFINE_ALLOCATOR(PerformanceResourceTiming);
+
+PerformanceResourceTiming::PerformanceResourceTiming(JS::Realm& realm, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration)
+    : PerformanceTimeline::PerformanceEntry(realm, name, start_time, duration)
+{
+}
+
+PerformanceResourceTiming::~PerformanceResourceTiming() = default;
+
+FlyString const& PerformanceResourceTiming::entry_type() const
+{
+    return PerformanceTimeline::EntryTypes::resource;
+}
+
+void PerformanceResourceTiming::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceResourceTiming);
+}
+
+void PerformanceResourceTiming::visit_edges(JS::Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_timing_info);
+}
+
+// https://w3c.github.io/resource-timing/#dfn-convert-fetch-timestamp
+static HighResolutionTime::DOMHighResTimeStamp convert_fetch_timestamp(HighResolutionTime::DOMHighResTimeStamp timestamp, JS::Object const& global)
+{
+    // 1. If ts is zero, return zero.
+    if (timestamp == 0)
+        return 0;
+
+    // 2. Otherwise, return the relative high resolution coarse time given ts and global.
+    return HighResolutionTime::relative_high_resolution_coarsen_time(timestamp, global);
+}
+
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::convert_fetch_timestamp(HighResolutionTime::DOMHighResTimeStamp timestamp) const
+{
+    return ResourceTiming::convert_fetch_timestamp(timestamp, HTML::relevant_global_object(*this));
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-nexthopprotocol
+String PerformanceResourceTiming::next_hop_protocol() const
+{
+    // The nextHopProtocol getter steps are to isomorphic decode this's timing info's final connection timing info's
+    // ALPN negotiated protocol.
+    // NOTE: If the final connection timing info is null, there is no protocol to report.
+    auto connection_timing_info = m_timing_info->final_connection_timing_info();
+    if (!connection_timing_info)
+        return {};
+    // NOTE: ALPN protocol IDs are ASCII, so decoding them as UTF-8 is equivalent.
+    return MUST(String::from_utf8(StringView { connection_timing_info->lpn_negotiated_protocol() }));
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-workerstart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::worker_start() const
+{
+    // The workerStart getter steps are to convert fetch timestamp for this's timing info's final service worker start
+    // time and the relevant global object for this.
+    return convert_fetch_timestamp(m_timing_info->final_service_worker_start_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-redirectstart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::redirect_start() const
+{
+    // The redirectStart getter steps are to convert fetch timestamp for this's timing info's redirect start time and
+    // the relevant global object for this.
+    return convert_fetch_timestamp(m_timing_info->redirect_start_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-redirectend
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::redirect_end() const
+{
+    // The redirectEnd getter steps are to convert fetch timestamp for this's timing info's redirect end time and the
+    // relevant global object for this.
+    return convert_fetch_timestamp(m_timing_info->redirect_end_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-fetchstart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::fetch_start() const
+{
+    // The fetchStart getter steps are to convert fetch timestamp for this's timing info's post-redirect start time and
+    // the relevant global object for this.
+    return convert_fetch_timestamp(m_timing_info->post_redirect_start_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-domainlookupstart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::domain_lookup_start() const
+{
+    // The domainLookupStart getter steps are to convert fetch timestamp for this's timing info's final connection
+    // timing info's domain lookup start time and the relevant global object for this. See Recording connection timing
+    // info for more info.
+    // NOTE: If the final connection timing info is null, no connection was made, so we report the fetch start.
+    if (auto connection_timing_info = m_timing_info->final_connection_timing_info())
+        return convert_fetch_timestamp(connection_timing_info->domain_lookup_start_time());
+    return fetch_start();
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-domainlookupend
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::domain_lookup_end() const
+{
+    // The domainLookupEnd getter steps are to convert fetch timestamp for this's timing info's final connection timing
+    // info's domain lookup end time and the relevant global object for this.
+    if (auto connection_timing_info = m_timing_info->final_connection_timing_info())
+        return convert_fetch_timestamp(connection_timing_info->domain_lookup_end_time());
+    return fetch_start();
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-connectstart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::connect_start() const
+{
+    // The connectStart getter steps are to convert fetch timestamp for this's timing info's final connection timing
+    // info's connection start time and the relevant global object for this.
+    if (auto connection_timing_info = m_timing_info->final_connection_timing_info())
+        return convert_fetch_timestamp(connection_timing_info->connection_start_time());
+    return fetch_start();
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-connectend
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::connect_end() const
+{
+    // The connectEnd getter steps are to convert fetch timestamp for this's timing info's final connection timing
+    // info's connection end time and the relevant global object for this.
+    if (auto connection_timing_info = m_timing_info->final_connection_timing_info())
+        return convert_fetch_timestamp(connection_timing_info->connection_end_time());
+    return fetch_start();
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-secureconnectionstart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::secure_connection_start() const
+{
+    // The secureConnectionStart getter steps are to convert fetch timestamp for this's timing info's final connection
+    // timing info's secure connection start time and the relevant global object for this.
+    if (auto connection_timing_info = m_timing_info->final_connection_timing_info())
+        return convert_fetch_timestamp(connection_timing_info->secure_connection_start_time());
+    return 0;
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-requeststart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::request_start() const
+{
+    // The requestStart getter steps are to convert fetch timestamp for this's timing info's final network-request
+    // start time and the relevant global object for this.
+    return convert_fetch_timestamp(m_timing_info->final_network_request_start_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-responsestart
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::response_start() const
+{
+    // The responseStart getter steps are to convert fetch timestamp for this's timing info's final network-response
+    // start time and the relevant global object for this.
+    return convert_fetch_timestamp(m_timing_info->final_network_response_start_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-responseend
+HighResolutionTime::DOMHighResTimeStamp PerformanceResourceTiming::response_end() const
+{
+    // The responseEnd getter steps are to convert fetch timestamp for this's timing info's end time and the relevant
+    // global object for this.
+    return convert_fetch_timestamp(m_timing_info->end_time());
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-transfersize
+u64 PerformanceResourceTiming::transfer_size() const
+{
+    // The transferSize getter steps are to perform the following steps:
+    // 1. If this's cache mode is "local", then return 0.
+    if (m_cache_mode == Fetch::Infrastructure::Response::CacheState::Local)
+        return 0;
+
+    // 2. If this's cache mode is "validated", then return 300.
+    if (m_cache_mode == Fetch::Infrastructure::Response::CacheState::Validated)
+        return 300;
+
+    // 3. Return this's response body info's encoded size plus 300.
+    // NOTE: The constant number added to transferSize replaces exposing the total byte size of the HTTP headers, as
+    //       that may expose the presence of certain cookies.
+    return m_response_body_info.encoded_size + 300;
+}
+
+// https://w3c.github.io/resource-timing/#dom-performanceresourcetiming-renderblockingstatus
+Bindings::RenderBlockingStatusType PerformanceResourceTiming::render_blocking_status() const
+{
+    // The renderBlockingStatus getter steps are to return blocking if this's timing info's render-blocking is true;
+    // otherwise non-blocking.
+    if (m_timing_info->render_blocking())
+        return Bindings::RenderBlockingStatusType::Blocking;
+    return Bindings::RenderBlockingStatusType::NonBlocking;
+}
+
+// https://w3c.github.io/resource-timing/#dfn-mark-resource-timing
+void mark_resource_timing(JS::NonnullGCPtr<Fetch::Infrastructure::FetchTimingInfo> timing_info, URL::URL const& requested_url, String const& initiator_type, JS::Object& global, Optional<Fetch::Infrastructure::Response::CacheState> cache_mode, Fetch::Infrastructure::Response::BodyInfo body_info, u16 response_status, String delivery_type)
+{
+    auto* window_or_worker = dynamic_cast<HTML::WindowOrWorkerGlobalScopeMixin*>(&global);
+    if (!window_or_worker)
+        return;
+
+    auto& realm = HTML::relevant_realm(global);
+
+    // 1. Create a PerformanceResourceTiming object entry in global's realm.
+    // 2. Setup the resource timing entry for entry, given initiatorType, requestedURL, timingInfo, cacheMode, bodyInfo,
+    //    responseStatus, and deliveryType.
+    //    https://w3c.github.io/resource-timing/#dfn-setup-the-resource-timing-entry
+    //    1. Assert that cacheMode is the empty string, "local", or "validated".
+    //       NOTE: This is enforced by the type of cacheMode.
+    //    2. Let global be entry's relevant global object.
+    //    3. Initialize entry given the result of converting timingInfo's start time given global, the result of
+    //       converting timingInfo's end time given global, "resource" and requestedURL.
+    auto start_time = convert_fetch_timestamp(timing_info->start_time(), global);
+    auto end_time = convert_fetch_timestamp(timing_info->end_time(), global);
+    auto entry = realm.heap().allocate<PerformanceResourceTiming>(realm, realm, requested_url.to_string().release_value_but_fixme_should_propagate_errors(), start_time, end_time - start_time);
+
+    //    4. Set entry's initiator type to initiatorType.
+    entry->m_initiator_type = initiator_type;
+
+    //    5. Set entry's requested URL to requestedURL.
+    entry->m_requested_url = requested_url;
+
+    //    6. Set entry's timing info to timingInfo.
+    entry->m_timing_info = timing_info;
+
+    //    7. Set entry's response body info to bodyInfo.
+    entry->m_response_body_info = move(body_info);
+
+    //    8. Set entry's cache mode to cacheMode.
+    entry->m_cache_mode = cache_mode;
+
+    //    9. Set entry's response status to responseStatus.
+    entry->m_response_status = response_status;
+
+    //    10. If deliveryType is the empty string and cacheMode is not, then set deliveryType to "cache".
+    if (delivery_type.is_empty() && cache_mode.has_value())
+        delivery_type = "cache"_string;
+
+    //    11. Set entry's delivery type to deliveryType.
+    entry->m_delivery_type = move(delivery_type);
+
+    // 3. Queue entry.
+    // 4. Add entry to global's performance entry buffer.
+    // NOTE: Queuing the entry also adds it to the performance entry buffer for "resource", which is limited to the
+    //       registry's maxBufferSize of 250 instead of the separately resizable resource timing buffer.
+    window_or_worker->queue_performance_entry(entry);
+}
+
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibURL/URL.h>
+#include <LibWeb/Bindings/PerformanceResourceTimingPrototype.h>
+#include <LibWeb/Fetch/Infrastructure/FetchTimingInfo.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/PerformanceTimeline/PerformanceEntry.h>
+
+namespace Web::ResourceTiming {
+
+// https://w3c.github.io/resource-timing/#sec-performanceresourcetiming
+class PerformanceResourceTiming final : public PerformanceTimeline::PerformanceEntry {
+    WEB_PLATFORM_OBJECT(PerformanceResourceTiming, PerformanceTimeline::PerformanceEntry);
+    JS_DECLARE_ALLOCATOR(PerformanceResourceTiming);
+
+public:
+    virtual ~PerformanceResourceTiming() override;
+
+    // NOTE: These three functions are answered by the registry for the given entry type.
+    // https://w3c.github.io/timing-entrytypes-registry/#registry
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-availablefromtimeline
+    static PerformanceTimeline::AvailableFromTimeline available_from_timeline() { return PerformanceTimeline::AvailableFromTimeline::Yes; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-maxbuffersize
+    static Optional<u64> max_buffer_size() { return 250; }
+
+    // https://w3c.github.io/timing-entrytypes-registry/#dfn-should-add-entry
+    virtual PerformanceTimeline::ShouldAddEntry should_add_entry(Optional<PerformanceTimeline::PerformanceObserverInit const&> = {}) const override { return PerformanceTimeline::ShouldAddEntry::Yes; }
+
+    virtual FlyString const& entry_type() const override;
+
+    String const& initiator_type() const { return m_initiator_type; }
+    String const& delivery_type() const { return m_delivery_type; }
+    String next_hop_protocol() const;
+    HighResolutionTime::DOMHighResTimeStamp worker_start() const;
+    HighResolutionTime::DOMHighResTimeStamp redirect_start() const;
+    HighResolutionTime::DOMHighResTimeStamp redirect_end() const;
+    HighResolutionTime::DOMHighResTimeStamp fetch_start() const;
+    HighResolutionTime::DOMHighResTimeStamp domain_lookup_start() const;
+    HighResolutionTime::DOMHighResTimeStamp domain_lookup_end() const;
+    HighResolutionTime::DOMHighResTimeStamp connect_start() const;
+    HighResolutionTime::DOMHighResTimeStamp connect_end() const;
+    HighResolutionTime::DOMHighResTimeStamp secure_connection_start() const;
+    HighResolutionTime::DOMHighResTimeStamp request_start() const;
+    HighResolutionTime::DOMHighResTimeStamp response_start() const;
+    HighResolutionTime::DOMHighResTimeStamp response_end() const;
+    u64 transfer_size() const;
+    u64 encoded_body_size() const { return m_response_body_info.encoded_size; }
+    u64 decoded_body_size() const { return m_response_body_info.decoded_size; }
+    u16 response_status() const { return m_response_status; }
+    Bindings::RenderBlockingStatusType render_blocking_status() const;
+    String const& content_type() const { return m_response_body_info.content_type; }
+
+private:
+    PerformanceResourceTiming(JS::Realm&, String const& name, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(JS::Cell::Visitor&) override;
+
+    friend void mark_resource_timing(JS::NonnullGCPtr<Fetch::Infrastructure::FetchTimingInfo>, URL::URL const& requested_url, String const& initiator_type, JS::Object& global, Optional<Fetch::Infrastructure::Response::CacheState> cache_mode, Fetch::Infrastructure::Response::BodyInfo, u16 response_status, String delivery_type);
+
+    HighResolutionTime::DOMHighResTimeStamp convert_fetch_timestamp(HighResolutionTime::DOMHighResTimeStamp) const;
+
+    // https://w3c.github.io/resource-timing/#dfn-initiator-type
+    String m_initiator_type;
+
+    // https://w3c.github.io/resource-timing/#dfn-delivery-type
+    String m_delivery_type;
+
+    // https://w3c.github.io/resource-timing/#dfn-requested-url
+    URL::URL m_requested_url;
+
+    // https://w3c.github.io/resource-timing/#dfn-timing-info
+    JS::GCPtr<Fetch::Infrastructure::FetchTimingInfo> m_timing_info;
+
+    // https://w3c.github.io/resource-timing/#dfn-resource-info
+    Fetch::Infrastructure::Response::BodyInfo m_response_body_info;
+
+    // https://w3c.github.io/resource-timing/#dfn-cache-mode
+    Optional<Fetch::Infrastructure::Response::CacheState> m_cache_mode;
+
+    // https://w3c.github.io/resource-timing/#dfn-response-status
+    u16 m_response_status { 0 };
+};
+
+// https://w3c.github.io/resource-timing/#dfn-mark-resource-timing
+void mark_resource_timing(JS::NonnullGCPtr<Fetch::Infrastructure::FetchTimingInfo>, URL::URL const& requested_url, String const& initiator_type, JS::Object& global, Optional<Fetch::Infrastructure::Response::CacheState> cache_mode, Fetch::Infrastructure::Response::BodyInfo, u16 response_status, String delivery_type = {});
+
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/SecureContexts/AbstractOperations.h>
+#include <LibWeb/ServiceWorker/HandleFetch.h>
+#include <LibWeb/ServiceWorker/Registration.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#handle-fetch
+JS::GCPtr<Fetch::Infrastructure::Response> handle_fetch(Fetch::Infrastructure::Request& request)
+{
+    // FIXME: 1. Let handleFetchFailed be false.
+    // FIXME: 2. Let respondWithEntered be false.
+    // FIXME: 3. Let eventCanceled be false.
+    // FIXME: 4. Let response be null.
+
+    // 5. Let registration be null.
+    Registration* registration = nullptr;
+
+    // 6. Let client be request's client.
+    auto client = request.client();
+
+    // 7. Let reservedClient be request's reserved client.
+    auto reserved_client = request.reserved_client();
+
+    // FIXME: 8. Let preloadResponse be a new promise.
+    // FIXME: 9. Let workerRealm be null.
+    // FIXME: 10. Let timingInfo be a new service worker timing info.
+
+    // 11. Assert: request's destination is not "serviceworker".
+    VERIFY(request.destination() != Fetch::Infrastructure::Request::Destination::ServiceWorker);
+
+    // 12. If request's destination is either "embed" or "object", then:
+    if (request.destination() == Fetch::Infrastructure::Request::Destination::Embed
+        || request.destination() == Fetch::Infrastructure::Request::Destination::Object) {
+        // 1. Return null.
+        return nullptr;
+    }
+
+    ServiceWorkerRecord* active_worker = nullptr;
+
+    // 13. Else if request is a non-subresource request, then:
+    if (request.is_non_subresource_request()) {
+        // 1. If reservedClient is not null and is an environment settings object, then:
+        if (reserved_client && is<HTML::EnvironmentSettingsObject>(*reserved_client)) {
+            // 1. If reservedClient is not a secure context, return null.
+            if (!HTML::is_secure_context(*reserved_client))
+                return nullptr;
+        }
+        // 2. Else:
+        else {
+            // 1. If request's url is not a potentially trustworthy URL, return null.
+            if (SecureContexts::is_url_potentially_trustworthy(request.url()) != SecureContexts::Trustworthiness::PotentiallyTrustworthy)
+                return nullptr;
+        }
+
+        // FIXME: 3. If request is a navigation request and the navigation triggering it was initiated with a
+        //           shift+reload or equivalent, return null.
+
+        // 4. Assert: reservedClient is not null.
+        VERIFY(reserved_client);
+
+        // 5. Let storage key be the result of running obtain a storage key given reservedClient.
+        auto storage_key = StorageAPI::obtain_a_storage_key(*reserved_client);
+        if (!storage_key.has_value())
+            return nullptr;
+
+        // 6. Set registration to the result of running Match Service Worker Registration given storage key and
+        //    request's url.
+        registration = Registration::match(*storage_key, request.url());
+
+        // 7. If registration is null or registration's active worker is null, return null.
+        if (!registration || !registration->active_worker())
+            return nullptr;
+
+        // 8. If request's destination is not "report", set reservedClient's active service worker to registration's
+        //    active worker.
+        if (request.destination() != Fetch::Infrastructure::Request::Destination::Report)
+            reserved_client->active_service_worker = registration->active_worker()->make_weak_ptr();
+
+        // 9. Set activeWorker to registration's active worker.
+        active_worker = registration->active_worker();
+    }
+    // 14. Else if request is a subresource request, then:
+    else if (request.is_subresource_request()) {
+        // 1. If client's active service worker is null, return null.
+        if (!client || !client->active_service_worker)
+            return nullptr;
+
+        // 2. Set activeWorker to client's active service worker.
+        active_worker = client->active_service_worker.ptr();
+    }
+    // 15. Else, return null.
+    else {
+        return nullptr;
+    }
+
+    // FIXME: 16. If activeWorker's state is "activating", wait for activeWorker's state to become "activated".
+
+    // 17. If the result of running the Should Skip Event algorithm with "fetch" and activeWorker is true, then:
+    if (should_skip_event(HTML::EventNames::fetch, *active_worker)) {
+        // FIXME: 1. If shouldSoftUpdate is true, then in parallel run the Soft Update algorithm with registration.
+
+        // 2. Return null.
+        return nullptr;
+    }
+
+    // FIXME: 18. If activeWorker's list of router rules is not empty, then consult them.
+    // FIXME: 19. If the result of running Run Service Worker algorithm with activeWorker is failure, then set
+    //            handleFetchFailed to true.
+    // FIXME: 20. Otherwise, queue a task to fire a FetchEvent at activeWorker's global object and wait for the worker
+    //            to respond. We can't run service worker scripts yet, so let the request go to the network.
+    dbgln("FIXME: Service worker for {} handles fetch events, but we can't dispatch FetchEvent yet", active_worker->script_url);
+    return nullptr;
+}
+
+// https://w3c.github.io/ServiceWorker/#should-skip-event-algorithm
+bool should_skip_event(FlyString const& event_name, ServiceWorkerRecord const& service_worker)
+{
+    // NOTE: Avoiding unnecessary delays is the whole point of this: a worker that never listened for an event has
+    //       nothing to say about it, so we don't spin it up just to find that out.
+
+    // 1. If serviceWorker's set of event types to handle does not contain eventName, then the user agent may return
+    //    true.
+    if (!service_worker.set_of_event_types_to_handle.contains(event_name))
+        return true;
+
+    // 2. Return false.
+    return false;
+}
+
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibJS/Heap/GCPtr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#handle-fetch
+JS::GCPtr<Fetch::Infrastructure::Response> handle_fetch(Fetch::Infrastructure::Request&);
+
+// https://w3c.github.io/ServiceWorker/#should-skip-event-algorithm
+bool should_skip_event(FlyString const& event_name, ServiceWorkerRecord const&);
+
+}
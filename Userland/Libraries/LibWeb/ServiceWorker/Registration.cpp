@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <LibURL/Parser.h>
+#include <LibWeb/ServiceWorker/Registration.h>
+
+namespace Web::ServiceWorker {
+
+struct RegistrationKey {
+    StorageAPI::StorageKey key;
+    ByteString serialized_scope_url;
+
+    bool operator==(RegistrationKey const&) const = default;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::ServiceWorker::RegistrationKey> : public DefaultTraits<Web::ServiceWorker::RegistrationKey> {
+    static unsigned hash(Web::ServiceWorker::RegistrationKey const& key)
+    {
+        return pair_int_hash(Traits<URL::Origin>::hash(key.key.origin), Traits<ByteString>::hash(key.serialized_scope_url));
+    }
+};
+
+}
+
+namespace Web::ServiceWorker {
+
+// FIXME: Surface this to the user agent level, so that registrations outlive the WebContent process and are shared
+//        between all of its clients.
+// https://w3c.github.io/ServiceWorker/#dfn-scope-to-registration-map
+static HashMap<RegistrationKey, NonnullOwnPtr<Registration>>& registration_map()
+{
+    static HashMap<RegistrationKey, NonnullOwnPtr<Registration>> map;
+    return map;
+}
+
+Registration::Registration(StorageAPI::StorageKey storage_key, URL::URL scope, Bindings::ServiceWorkerUpdateViaCache update_via_cache)
+    : m_storage_key(move(storage_key))
+    , m_scope_url(move(scope))
+    , m_update_via_cache(update_via_cache)
+{
+}
+
+// https://w3c.github.io/ServiceWorker/#get-registration-algorithm
+Registration* Registration::get(StorageAPI::StorageKey const& key, Optional<URL::URL> const& scope)
+{
+    // 1. Run the following steps atomically.
+
+    // 2. Let scopeString be the empty string.
+    ByteString scope_string;
+
+    // 3. If scope is not null, set scopeString to serialized scope with the exclude fragment flag set.
+    if (scope.has_value())
+        scope_string = scope->serialize(URL::ExcludeFragment::Yes);
+
+    // 4. For each (entry storage key, entry scope) → registration of registration map:
+    //    1. If storage key equals entry storage key and scopeString matches entry scope, then return registration.
+    // 5. Return null.
+    auto it = registration_map().find({ key, scope_string });
+    if (it == registration_map().end())
+        return nullptr;
+    return it->value.ptr();
+}
+
+// https://w3c.github.io/ServiceWorker/#set-registration-algorithm
+Registration& Registration::set(StorageAPI::StorageKey const& key, URL::URL const& scope, Bindings::ServiceWorkerUpdateViaCache update_via_cache)
+{
+    // 1. Run the following steps atomically.
+
+    // 2. Let scopeString be serialized scope with the exclude fragment flag set.
+    auto scope_string = scope.serialize(URL::ExcludeFragment::Yes);
+
+    // 3. Let registration be a new service worker registration whose storage key is set to storage key, scope url is
+    //    set to scope, and update via cache mode is set to updateViaCache.
+    auto registration = adopt_own(*new Registration(key, scope, update_via_cache));
+    auto& registration_ref = *registration;
+
+    // 4. Set registration map[(storage key, scopeString)] to registration.
+    registration_map().set({ key, move(scope_string) }, move(registration));
+
+    // 5. Return registration.
+    return registration_ref;
+}
+
+// https://w3c.github.io/ServiceWorker/#scope-match-algorithm
+Registration* Registration::match(StorageAPI::StorageKey const& key, URL::URL const& client_url)
+{
+    // NOTE: Every navigation and subresource fetch ends up here, so bail out before serializing anything when there
+    //       is nothing that could possibly match.
+    if (registration_map().is_empty())
+        return nullptr;
+
+    // 1. Run the following steps atomically.
+
+    // 2. Let clientURLString be serialized clientURL.
+    auto client_url_string = client_url.serialize();
+
+    // 3. Let matchingScopeString be the empty string.
+    StringView matching_scope_string;
+
+    // 4. Let scopeStringSet be an empty list.
+    // 5. For each (entry storage key, entry scope) of registration map's keys:
+    //    1. If storage key equals entry storage key, then append entry scope to the end of scopeStringSet.
+    // 6. Set matchingScopeString to the longest value in scopeStringSet which the value of clientURLString starts
+    //    with, if it exists.
+    for (auto const& it : registration_map()) {
+        if (it.key.key != key)
+            continue;
+        auto const& scope_string = it.key.serialized_scope_url;
+        if (scope_string.length() > matching_scope_string.length() && client_url_string.starts_with(scope_string))
+            matching_scope_string = scope_string;
+    }
+
+    // 7. Let matchingScope be null.
+    Optional<URL::URL> matching_scope;
+
+    // 8. If matchingScopeString is not the empty string, then:
+    if (!matching_scope_string.is_empty()) {
+        // 1. Set matchingScope to the result of parsing matchingScopeString.
+        matching_scope = URL::Parser::basic_parse(matching_scope_string);
+
+        // 2. Assert: matchingScope's origin and clientURL's origin are same origin.
+        VERIFY(matching_scope->origin().is_same_origin(client_url.origin()));
+    }
+
+    // 9. Return the result of running Get Registration given storage key and matchingScope.
+    return get(key, matching_scope);
+}
+
+void Registration::remove(StorageAPI::StorageKey const& key, URL::URL const& scope)
+{
+    registration_map().remove({ key, scope.serialize(URL::ExcludeFragment::Yes) });
+}
+
+bool Registration::any_registrations_exist()
+{
+    return !registration_map().is_empty();
+}
+
+// https://w3c.github.io/ServiceWorker/#service-worker-registration-stale
+bool Registration::is_stale() const
+{
+    // A service worker registration is said to be stale if the registration's last update check time is non-null and
+    // the time difference in seconds calculated by the current time minus the registration's last update check time is
+    // greater than 86400.
+    if (!m_last_update_check_time.has_value())
+        return false;
+    return (MonotonicTime::now() - m_last_update_check_time.value()) > AK::Duration::from_seconds(86400);
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/OwnPtr.h>
+#include <AK/Time.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Bindings/ServiceWorkerRegistrationPrototype.h>
+#include <LibWeb/ServiceWorker/ServiceWorkerRecord.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dfn-service-worker-registration
+// This class corresponds to "service worker registration", not "ServiceWorkerRegistration"
+class Registration {
+    AK_MAKE_NONCOPYABLE(Registration);
+    AK_MAKE_NONMOVABLE(Registration);
+
+public:
+    // https://w3c.github.io/ServiceWorker/#get-registration-algorithm
+    static Registration* get(StorageAPI::StorageKey const&, Optional<URL::URL> const& scope);
+
+    // https://w3c.github.io/ServiceWorker/#set-registration-algorithm
+    static Registration& set(StorageAPI::StorageKey const&, URL::URL const& scope, Bindings::ServiceWorkerUpdateViaCache);
+
+    // https://w3c.github.io/ServiceWorker/#scope-match-algorithm
+    static Registration* match(StorageAPI::StorageKey const&, URL::URL const& client_url);
+
+    static void remove(StorageAPI::StorageKey const&, URL::URL const& scope);
+
+    static bool any_registrations_exist();
+
+    StorageAPI::StorageKey const& storage_key() const { return m_storage_key; }
+    URL::URL const& scope_url() const { return m_scope_url; }
+    Bindings::ServiceWorkerUpdateViaCache update_via_cache() const { return m_update_via_cache; }
+
+    ServiceWorkerRecord* installing_worker() { return m_installing_worker.ptr(); }
+    ServiceWorkerRecord* waiting_worker() { return m_waiting_worker.ptr(); }
+    ServiceWorkerRecord* active_worker() { return m_active_worker.ptr(); }
+
+    void set_installing_worker(OwnPtr<ServiceWorkerRecord> worker) { m_installing_worker = move(worker); }
+    void set_waiting_worker(OwnPtr<ServiceWorkerRecord> worker) { m_waiting_worker = move(worker); }
+    void set_active_worker(OwnPtr<ServiceWorkerRecord> worker) { m_active_worker = move(worker); }
+
+    // https://w3c.github.io/ServiceWorker/#service-worker-registration-stale
+    bool is_stale() const;
+
+private:
+    Registration(StorageAPI::StorageKey, URL::URL scope, Bindings::ServiceWorkerUpdateViaCache);
+
+    StorageAPI::StorageKey m_storage_key; // https://w3c.github.io/ServiceWorker/#service-worker-registration-storage-key
+    URL::URL m_scope_url;                 // https://w3c.github.io/ServiceWorker/#dfn-scope-url
+
+    // NOTE: These are "service worker"s, not "ServiceWorker"s.
+    OwnPtr<ServiceWorkerRecord> m_installing_worker; // https://w3c.github.io/ServiceWorker/#dfn-installing-worker
+    OwnPtr<ServiceWorkerRecord> m_waiting_worker;    // https://w3c.github.io/ServiceWorker/#dfn-waiting-worker
+    OwnPtr<ServiceWorkerRecord> m_active_worker;     // https://w3c.github.io/ServiceWorker/#dfn-active-worker
+
+    // https://w3c.github.io/ServiceWorker/#dfn-last-update-check-time
+    Optional<MonotonicTime> m_last_update_check_time;
+
+    // https://w3c.github.io/ServiceWorker/#dfn-update-via-cache
+    Bindings::ServiceWorkerUpdateViaCache m_update_via_cache { Bindings::ServiceWorkerUpdateViaCache::Imports };
+};
+
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashTable.h>
+#include <AK/Weakable.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Bindings/ServiceWorkerPrototype.h>
+#include <LibWeb/Bindings/WorkerPrototype.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dfn-service-worker
+// This struct corresponds to "service worker", not "ServiceWorker"
+struct ServiceWorkerRecord : public Weakable<ServiceWorkerRecord> {
+    // https://w3c.github.io/ServiceWorker/#dfn-state
+    Bindings::ServiceWorkerState state { Bindings::ServiceWorkerState::Parsed };
+
+    // https://w3c.github.io/ServiceWorker/#dfn-script-url
+    URL::URL script_url;
+
+    // https://w3c.github.io/ServiceWorker/#dfn-type
+    Bindings::WorkerType worker_type { Bindings::WorkerType::Classic };
+
+    // https://w3c.github.io/ServiceWorker/#dfn-set-of-event-types-to-handle
+    // NOTE: This is filled in from the event listeners the worker script added during its initial evaluation, and lets
+    //       us skip starting up the worker entirely for functional events it doesn't listen to.
+    HashTable<FlyString> set_of_event_types_to_handle;
+};
+
+}
@@ -3241,18 +3241,25 @@ WebIDL::ExceptionOr<void> readable_stream_enqueue(ReadableStreamController& cont
         VERIFY(controller.has<JS::NonnullGCPtr<ReadableByteStreamController>>());
         auto readable_byte_controller = controller.get<JS::NonnullGCPtr<ReadableByteStreamController>>();
 
-        // FIXME: 2. Assert: chunk is an ArrayBufferView.
+        // 2. Assert: chunk is an ArrayBufferView.
+        VERIFY(chunk.is_object());
+        auto* typed_array = TRY(JS::typed_array_from(readable_byte_controller->vm(), chunk));
 
         // 3. Let byobView be the current BYOB request view for stream.
-        // FIXME: This is not what the spec means by 'current BYOB request view'
-        auto byob_view = readable_byte_controller->raw_byob_request();
+        auto byob_view = readable_stream_current_byob_request_view(*readable_byte_controller->stream());
 
         // 4. If byobView is non-null, and chunk.[[ViewedArrayBuffer]] is byobView.[[ViewedArrayBuffer]], then:
-        if (byob_view) {
-            // FIXME: 1. Assert: chunk.[[ByteOffset]] is byobView.[[ByteOffset]].
-            // FIXME: 2. Assert: chunk.[[ByteLength]] ≤ byobView.[[ByteLength]].
-            // FIXME: 3. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], chunk.[[ByteLength]]).
-            TODO();
+        if (byob_view && typed_array->viewed_array_buffer() == byob_view->viewed_array_buffer()) {
+            // 1. Assert: chunk.[[ByteOffset]] is byobView.[[ByteOffset]].
+            VERIFY(typed_array->byte_offset() == byob_view->byte_offset());
+
+            // 2. Assert: chunk.[[ByteLength]] ≤ byobView.[[ByteLength]].
+            auto typed_array_record = JS::make_typed_array_with_buffer_witness_record(*typed_array, JS::ArrayBuffer::Order::SeqCst);
+            auto chunk_byte_length = JS::typed_array_byte_length(typed_array_record);
+            VERIFY(chunk_byte_length <= byob_view->byte_length());
+
+            // 3. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], chunk.[[ByteLength]]).
+            return readable_byte_stream_controller_respond(readable_byte_controller, chunk_byte_length);
         }
 
         // 5. Otherwise, perform ? ReadableByteStreamControllerEnqueue(stream.[[controller]], chunk).
@@ -3375,7 +3382,7 @@ WebIDL::ExceptionOr<void> readable_byte_stream_controller_enqueue(ReadableByteSt
 }
 
 // https://streams.spec.whatwg.org/#readablestream-pull-from-bytes
-WebIDL::ExceptionOr<void> readable_stream_pull_from_bytes(ReadableStream& stream, ByteBuffer bytes)
+WebIDL::ExceptionOr<void> readable_stream_pull_from_bytes(ReadableStream& stream, ByteBuffer& bytes)
 {
     // 1. Assert: stream.[[controller]] implements ReadableByteStreamController.
     auto controller = stream.controller()->get<JS::NonnullGCPtr<ReadableByteStreamController>>();
@@ -3386,24 +3393,38 @@ WebIDL::ExceptionOr<void> readable_stream_pull_from_bytes(ReadableStream& stream
     // 3. Let desiredSize be available.
     auto desired_size = available;
 
-    // FIXME: 4. If stream’s current BYOB request view is non-null, then set desiredSize to stream’s current BYOB request
-    //           view's byte length.
+    // 4. If stream’s current BYOB request view is non-null, then set desiredSize to stream’s current BYOB request
+    //    view's byte length.
+    auto byob_view = readable_stream_current_byob_request_view(stream);
+    if (byob_view)
+        desired_size = byob_view->byte_length();
 
     // 5. Let pullSize be the smaller value of available and desiredSize.
     auto pull_size = min(available, desired_size);
 
-    // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
+    // 8. If stream’s current BYOB request view is non-null, then:
+    // NOTE: The bytes are written straight into the view before being removed from bytes, so that filling a BYOB
+    //       request does not require an intermediate copy of the pulled bytes.
+    if (byob_view) {
+        // 1. Write pulled into stream’s current BYOB request view.
+        auto& view_buffer = byob_view->viewed_array_buffer()->buffer();
+        view_buffer.overwrite(byob_view->byte_offset(), bytes.data(), pull_size);
 
-    // 7. Remove the first pullSize bytes from bytes.
-    if (pull_size != available)
-        bytes = MUST(bytes.slice(pull_size, available - pull_size));
+        // 7. Remove the first pullSize bytes from bytes.
+        bytes = pull_size == available ? ByteBuffer {} : MUST(bytes.slice(pull_size, available - pull_size));
 
-    // FIXME: 8. If stream’s current BYOB request view is non-null, then:
-    //           1. Write pulled into stream’s current BYOB request view.
-    //           2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
+        // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
+        TRY(readable_byte_stream_controller_respond(controller, pull_size));
+    }
     // 9. Otherwise,
-    {
+    else {
+        // 6. Let pulled be the first pullSize bytes of bytes.
+        // 7. Remove the first pullSize bytes from bytes.
+        // NOTE: Without a BYOB request, all available bytes are pulled, so the buffer is handed over as-is.
+        VERIFY(pull_size == available);
+        auto pulled = move(bytes);
+        bytes = {};
+
         auto& realm = HTML::relevant_realm(stream);
 
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
@@ -3417,6 +3438,23 @@ WebIDL::ExceptionOr<void> readable_stream_pull_from_bytes(ReadableStream& stream
     return {};
 }
 
+// https://streams.spec.whatwg.org/#readablestream-current-byob-request-view
+JS::GCPtr<WebIDL::ArrayBufferView> readable_stream_current_byob_request_view(ReadableStream& stream)
+{
+    // 1. Assert: stream.[[controller]] implements ReadableByteStreamController.
+    auto controller = stream.controller()->get<JS::NonnullGCPtr<ReadableByteStreamController>>();
+
+    // 2. Let byobRequest be ! ReadableByteStreamControllerGetBYOBRequest(stream.[[controller]]).
+    auto byob_request = readable_byte_stream_controller_get_byob_request(controller);
+
+    // 3. If byobRequest is null, then return null.
+    if (!byob_request)
+        return {};
+
+    // 4. Return byobRequest.[[view]].
+    return byob_request->view();
+}
+
 // https://streams.spec.whatwg.org/#transfer-array-buffer
 WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::ArrayBuffer>> transfer_array_buffer(JS::Realm& realm, JS::ArrayBuffer& buffer)
 {
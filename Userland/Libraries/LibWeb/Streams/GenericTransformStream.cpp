@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Streams/GenericTransformStream.h>
+#include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/Streams/TransformStream.h>
+#include <LibWeb/Streams/WritableStream.h>
+
+namespace Web::Streams {
+
+GenericTransformStreamMixin::GenericTransformStreamMixin(JS::NonnullGCPtr<TransformStream> transform)
+    : m_transform(transform)
+{
+}
+
+GenericTransformStreamMixin::~GenericTransformStreamMixin() = default;
+
+void GenericTransformStreamMixin::visit_edges(JS::Cell::Visitor& visitor)
+{
+    visitor.visit(m_transform);
+}
+
+// https://streams.spec.whatwg.org/#dom-generictransformstream-readable
+JS::NonnullGCPtr<ReadableStream> GenericTransformStreamMixin::readable()
+{
+    // The readable getter steps are to return this's transform.[[readable]].
+    return m_transform->readable();
+}
+
+// https://streams.spec.whatwg.org/#dom-generictransformstream-writable
+JS::NonnullGCPtr<WritableStream> GenericTransformStreamMixin::writable()
+{
+    // The writable getter steps are to return this's transform.[[writable]].
+    return m_transform->writable();
+}
+
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibJS/Heap/Cell.h>
+#include <LibJS/Heap/GCPtr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Streams {
+
+// https://streams.spec.whatwg.org/#generictransformstream
+class GenericTransformStreamMixin {
+public:
+    virtual ~GenericTransformStreamMixin();
+
+    JS::NonnullGCPtr<ReadableStream> readable();
+    JS::NonnullGCPtr<WritableStream> writable();
+
+protected:
+    explicit GenericTransformStreamMixin(JS::NonnullGCPtr<TransformStream>);
+
+    void visit_edges(JS::Cell::Visitor&);
+
+    // https://streams.spec.whatwg.org/#generictransformstream-transform
+    JS::NonnullGCPtr<TransformStream> m_transform;
+};
+
+}
@@ -4,12 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibMedia/Audio/PlaybackStream.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/HTML/HTMLMediaElement.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/WebAudio/AudioContext.h>
+#include <LibWeb/WebAudio/AudioRenderer.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
@@ -37,15 +39,16 @@ AudioContext::AudioContext(JS::Realm& realm, AudioContextOptions const& context_
 
     // 4: If contextOptions is given, apply the options:
     // 4.1: Set the internal latency of this AudioContext according to contextOptions.latencyHint, as described in latencyHint.
+    // FIXME: Accept a double latencyHint in seconds as well.
     switch (context_options.latency_hint) {
     case Bindings::AudioContextLatencyCategory::Balanced:
-        // FIXME: Determine optimal settings for balanced.
+        m_target_latency_ms = Audio::target_latency_ms_for_hint(Audio::LatencyHint::Balanced);
         break;
     case Bindings::AudioContextLatencyCategory::Interactive:
-        // FIXME: Determine optimal settings for interactive.
+        m_target_latency_ms = Audio::target_latency_ms_for_hint(Audio::LatencyHint::Interactive);
         break;
     case Bindings::AudioContextLatencyCategory::Playback:
-        // FIXME: Determine optimal settings for playback.
+        m_target_latency_ms = Audio::target_latency_ms_for_hint(Audio::LatencyHint::Playback);
         break;
     default:
         VERIFY_NOT_REACHED();
@@ -62,10 +65,15 @@ AudioContext::AudioContext(JS::Realm& realm, AudioContextOptions const& context_
         BaseAudioContext::set_sample_rate(44100);
     }
 
+    // The renderer produces one render quantum at a time, so that's the processing latency it adds on top of the output.
+    m_base_latency = static_cast<double>(AudioRenderer::render_quantum_size) / sample_rate();
+
     // FIXME: 5: If the context is allowed to start, send a control message to start processing.
     // FIXME: Implement control message queue to run following steps on the rendering thread
     if (m_allowed_to_start) {
-        // FIXME: 5.1: Attempt to acquire system resources. In case of failure, abort the following steps.
+        // 5.1: Attempt to acquire system resources. In case of failure, abort the following steps.
+        if (!start_rendering_audio_graph())
+            return;
 
         // 5.2: Set the [[rendering thread state]] to "running" on the AudioContext.
         BaseAudioContext::set_rendering_state(Bindings::AudioContextState::Running);
@@ -138,7 +146,8 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::resume()
     // 7. Queue a control message to resume the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to acquire system resources.
+    // 7.1: Attempt to acquire system resources.
+    // NOTE: The audio output is created when we start rendering the audio graph below.
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to running.
     set_rendering_state(Bindings::AudioContextState::Running);
@@ -220,7 +229,8 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::suspend()
     // 7. Queue a control message to suspend the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to release system resources.
+    // 7.1: Attempt to release system resources.
+    stop_rendering_audio_graph();
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -271,7 +281,10 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::close()
     // 5. Queue a control message to close the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 5.1: Attempt to release system resources.
+    // 5.1: Attempt to release system resources.
+    if (m_renderer)
+        (void)m_renderer->queue_control_message(AudioRenderer::ControlMessage::StopRendering);
+    m_output = nullptr;
 
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -304,11 +317,73 @@ void AudioContext::queue_a_media_element_task(Function<void()> steps)
     HTML::main_thread_event_loop().task_queue().add(move(task));
 }
 
-// FIXME: Actually implement the rendering thread
+// https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+double AudioContext::current_time() const
+{
+    if (!m_renderer)
+        return 0;
+    return static_cast<double>(m_renderer->rendered_frames()) / sample_rate();
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audiocontext-outputlatency
+double AudioContext::output_latency() const
+{
+    // The estimation in seconds of audio output latency, i.e., the interval between the time the UA requests the host
+    // system to play a buffer and the time at which the first sample in the buffer is actually processed by the audio
+    // output device.
+    if (!m_output)
+        return 0;
+
+    auto latency_or_error = m_output->output_latency();
+    if (latency_or_error.is_error())
+        return 0;
+    return latency_or_error.value().to_microseconds() / 1'000'000.0;
+}
+
 bool AudioContext::start_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    if (!m_output) {
+        // FIXME: Use the destination's channel count once it can be changed.
+        constexpr u8 channel_count = 2;
+        if (!m_renderer) {
+            auto renderer_or_error = AudioRenderer::create(channel_count);
+            if (renderer_or_error.is_error())
+                return false;
+            m_renderer = renderer_or_error.release_value();
+        }
+
+        // The output calls into the renderer from its own thread, so it holds its own reference to it.
+        auto output_or_error = Audio::PlaybackStream::create(Audio::OutputState::Suspended, static_cast<u32>(sample_rate()), channel_count, m_target_latency_ms,
+            [renderer = NonnullRefPtr { *m_renderer }](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) {
+                return renderer->render(buffer, format, sample_count);
+            });
+        if (output_or_error.is_error()) {
+            dbgln("Failed to create an audio output for AudioContext: {}", output_or_error.error());
+            return false;
+        }
+        m_output = output_or_error.release_value();
+    }
+
+    if (!m_renderer->queue_control_message(AudioRenderer::ControlMessage::StartRendering))
+        return false;
+
+    m_output->resume()->when_rejected([](Error&&) {
+        // FIXME: Propagate errors.
+    });
+    return true;
+}
+
+void AudioContext::stop_rendering_audio_graph()
+{
+    if (!m_output)
+        return;
+
+    // If the queue is full, the rendering thread isn't running to process it anyway, and the output is suspended below.
+    (void)m_renderer->queue_control_message(AudioRenderer::ControlMessage::StopRendering);
+
+    m_output->discard_buffer_and_suspend()->when_rejected([](Error&&) {
+        // FIXME: Propagate errors.
+    });
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibMedia/Audio/Forward.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
@@ -33,12 +34,14 @@ public:
     virtual ~AudioContext() override;
 
     double base_latency() const { return m_base_latency; }
-    double output_latency() const { return m_output_latency; }
+    double output_latency() const;
     AudioTimestamp get_output_timestamp();
     WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> resume();
     WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> suspend();
     WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> close();
 
+    virtual double current_time() const override;
+
 private:
     explicit AudioContext(JS::Realm&, AudioContextOptions const& context_options);
 
@@ -46,7 +49,7 @@ private:
     virtual void visit_edges(Cell::Visitor&) override;
 
     double m_base_latency { 0 };
-    double m_output_latency { 0 };
+    u32 m_target_latency_ms { 0 };
 
     bool m_allowed_to_start = true;
     Vector<JS::NonnullGCPtr<WebIDL::Promise>> m_pending_promises;
@@ -56,6 +59,10 @@ private:
 
     void queue_a_media_element_task(Function<void()> steps);
     bool start_rendering_audio_graph();
+    void stop_rendering_audio_graph();
+
+    RefPtr<AudioRenderer> m_renderer;
+    RefPtr<Audio::PlaybackStream> m_output;
 };
 
 }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/AudioRenderer.h>
+
+namespace Web::WebAudio {
+
+ErrorOr<NonnullRefPtr<AudioRenderer>> AudioRenderer::create(u8 channel_count)
+{
+    VERIFY(channel_count > 0);
+
+    Vector<float> render_quantum;
+    TRY(render_quantum.try_resize(render_quantum_size * channel_count));
+
+    return adopt_nonnull_ref_or_enomem(new (nothrow) AudioRenderer(channel_count, move(render_quantum)));
+}
+
+AudioRenderer::AudioRenderer(u8 channel_count, Vector<float> render_quantum)
+    : m_channel_count(channel_count)
+    , m_render_quantum(move(render_quantum))
+    , m_render_quantum_position(m_render_quantum.size())
+{
+}
+
+bool AudioRenderer::queue_control_message(ControlMessage message)
+{
+    auto tail = m_control_message_tail.load(AK::MemoryOrder::memory_order_relaxed);
+    auto next_tail = (tail + 1) % control_message_queue_size;
+    if (next_tail == m_control_message_head.load(AK::MemoryOrder::memory_order_acquire))
+        return false;
+
+    m_control_messages[tail] = message;
+    m_control_message_tail.store(next_tail, AK::MemoryOrder::memory_order_release);
+    return true;
+}
+
+void AudioRenderer::process_control_messages()
+{
+    auto head = m_control_message_head.load(AK::MemoryOrder::memory_order_relaxed);
+    auto tail = m_control_message_tail.load(AK::MemoryOrder::memory_order_acquire);
+
+    while (head != tail) {
+        switch (m_control_messages[head]) {
+        case ControlMessage::StartRendering:
+            m_is_rendering = true;
+            break;
+        case ControlMessage::StopRendering:
+            m_is_rendering = false;
+            break;
+        }
+        head = (head + 1) % control_message_queue_size;
+    }
+
+    m_control_message_head.store(head, AK::MemoryOrder::memory_order_release);
+}
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+void AudioRenderer::render_quantum()
+{
+    // 1. Process the control message queue.
+    process_control_messages();
+
+    m_render_quantum.span().fill(0.0f);
+    m_render_quantum_position = 0;
+
+    // A suspended context outputs silence, and its currentTime doesn't advance.
+    if (!m_is_rendering)
+        return;
+
+    // FIXME: Process the audio graph into the render quantum once AudioNodes can be connected. Until then, the
+    //        destination node's input is always silent.
+
+    // 4.10. Atomically perform the following steps:
+    //       1. Increment [[current frame]] by the render quantum size.
+    //       2. Set currentTime to [[current frame]] divided by sampleRate.
+    m_rendered_frames.fetch_add(render_quantum_size, AK::MemoryOrder::memory_order_acq_rel);
+}
+
+ReadonlyBytes AudioRenderer::render(Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count)
+{
+    VERIFY(format == Audio::PcmSampleFormat::Float32);
+
+    auto output_sample_count = min(sample_count * m_channel_count, buffer.size() / sizeof(float));
+    Span<float> output { reinterpret_cast<float*>(buffer.data()), output_sample_count };
+
+    size_t written = 0;
+    while (written < output.size()) {
+        if (m_render_quantum_position == m_render_quantum.size())
+            render_quantum();
+
+        auto to_copy = min(output.size() - written, m_render_quantum.size() - m_render_quantum_position);
+        m_render_quantum.span().slice(m_render_quantum_position, to_copy).copy_to(output.slice(written));
+        m_render_quantum_position += to_copy;
+        written += to_copy;
+    }
+
+    return buffer.trim(output.size() * sizeof(float));
+}
+
+}
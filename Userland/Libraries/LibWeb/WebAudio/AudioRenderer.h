@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Vector.h>
+#include <LibMedia/Audio/SampleFormats.h>
+
+namespace Web::WebAudio {
+
+// The rendering thread side of an AudioContext. It runs on the audio output's own thread, which asks it for samples
+// whenever the output needs more data, and produces them one render quantum at a time.
+//
+// The control thread only talks to it through a lock-free message queue, and everything it needs while rendering is
+// allocated up front. It never touches GC-allocated objects, so neither garbage collection nor a busy event loop can
+// cause the output to glitch.
+class AudioRenderer : public AtomicRefCounted<AudioRenderer> {
+public:
+    // https://webaudio.github.io/web-audio-api/#render-quantum-size
+    static constexpr size_t render_quantum_size = 128;
+
+    enum class ControlMessage : u8 {
+        StartRendering,
+        StopRendering,
+    };
+
+    static ErrorOr<NonnullRefPtr<AudioRenderer>> create(u8 channel_count);
+
+    // Must only be called from the control thread. Returns false if the rendering thread has fallen too far behind
+    // on its messages.
+    bool queue_control_message(ControlMessage);
+
+    // Must only be called from the rendering thread. Fills the buffer with interleaved samples.
+    ReadonlyBytes render(Bytes buffer, Audio::PcmSampleFormat, size_t sample_count);
+
+    // The number of sample frames that have been rendered while running, this can be read from any thread.
+    u64 rendered_frames() const { return m_rendered_frames.load(AK::MemoryOrder::memory_order_acquire); }
+
+private:
+    static constexpr size_t control_message_queue_size = 64;
+
+    AudioRenderer(u8 channel_count, Vector<float> render_quantum);
+
+    void process_control_messages();
+    void render_quantum();
+
+    u8 m_channel_count { 0 };
+
+    // Single producer, single consumer: the control thread only writes the tail and the rendering thread only writes
+    // the head.
+    Array<ControlMessage, control_message_queue_size> m_control_messages;
+    Atomic<size_t> m_control_message_head { 0 };
+    Atomic<size_t> m_control_message_tail { 0 };
+
+    // Only accessed by the rendering thread.
+    bool m_is_rendering { false };
+    Vector<float> m_render_quantum;
+    size_t m_render_quantum_position { 0 };
+
+    Atomic<u64> m_rendered_frames { 0 };
+};
+
+}
@@ -35,7 +35,7 @@ public:
 
     JS::NonnullGCPtr<AudioDestinationNode> destination() const { return m_destination; }
     float sample_rate() const { return m_sample_rate; }
-    double current_time() const { return m_current_time; }
+    virtual double current_time() const { return m_current_time; }
     Bindings::AudioContextState state() const { return m_control_thread_state; }
 
     // https://webaudio.github.io/web-audio-api/#--nyquist-frequency
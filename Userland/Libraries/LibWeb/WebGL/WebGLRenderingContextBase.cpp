@@ -151,7 +151,11 @@ void WebGLRenderingContextBase::clear_color(GLclampf red, GLclampf green, GLclam
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::clear_color(red={}, green={}, blue={}, alpha={})", red, green, blue, alpha);
+    Array<GLclampf, 4> clear_color { red, green, blue, alpha };
+    if (m_cached_state.clear_color == clear_color)
+        return;
     m_context->gl_clear_color(red, green, blue, alpha);
+    m_cached_state.clear_color = clear_color;
 }
 
 void WebGLRenderingContextBase::clear_depth(GLclampf depth)
@@ -160,7 +164,10 @@ void WebGLRenderingContextBase::clear_depth(GLclampf depth)
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::clear_depth(depth={})", depth);
+    if (m_cached_state.clear_depth == depth)
+        return;
     m_context->gl_clear_depth(depth);
+    m_cached_state.clear_depth = depth;
 }
 
 void WebGLRenderingContextBase::clear_stencil(GLint s)
@@ -169,7 +176,10 @@ void WebGLRenderingContextBase::clear_stencil(GLint s)
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::clear_stencil(s={:#08x})", s);
+    if (m_cached_state.clear_stencil == s)
+        return;
     m_context->gl_clear_stencil(s);
+    m_cached_state.clear_stencil = s;
 }
 
 void WebGLRenderingContextBase::color_mask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
@@ -178,7 +188,11 @@ void WebGLRenderingContextBase::color_mask(GLboolean red, GLboolean green, GLboo
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::color_mask(red={}, green={}, blue={}, alpha={})", red, green, blue, alpha);
+    Array<GLboolean, 4> color_mask { red, green, blue, alpha };
+    if (m_cached_state.color_mask == color_mask)
+        return;
     m_context->gl_color_mask(red, green, blue, alpha);
+    m_cached_state.color_mask = color_mask;
 }
 
 void WebGLRenderingContextBase::cull_face(GLenum mode)
@@ -205,7 +219,10 @@ void WebGLRenderingContextBase::depth_mask(GLboolean mask)
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::depth_mask(mask={})", mask);
+    if (m_cached_state.depth_mask == mask)
+        return;
     m_context->gl_depth_mask(mask);
+    m_cached_state.depth_mask = mask;
 }
 
 void WebGLRenderingContextBase::depth_range(GLclampf z_near, GLclampf z_far)
@@ -218,7 +235,12 @@ void WebGLRenderingContextBase::depth_range(GLclampf z_near, GLclampf z_far)
     // https://www.khronos.org/registry/webgl/specs/latest/1.0/#VIEWPORT_DEPTH_RANGE
     // "The WebGL API does not support depth ranges with where the near plane is mapped to a value greater than that of the far plane. A call to depthRange will generate an INVALID_OPERATION error if zNear is greater than zFar."
     RETURN_WITH_WEBGL_ERROR_IF(z_near > z_far, GL_INVALID_OPERATION);
+
+    Array<GLclampf, 2> depth_range { z_near, z_far };
+    if (m_cached_state.depth_range == depth_range)
+        return;
     m_context->gl_depth_range(z_near, z_far);
+    m_cached_state.depth_range = depth_range;
 }
 
 void WebGLRenderingContextBase::finish()
@@ -274,7 +296,13 @@ void WebGLRenderingContextBase::line_width(GLfloat width)
     // https://www.khronos.org/registry/webgl/specs/latest/1.0/#NAN_LINE_WIDTH
     // "In the WebGL API, if the width parameter passed to lineWidth is set to NaN, an INVALID_VALUE error is generated and the line width is not changed."
     RETURN_WITH_WEBGL_ERROR_IF(isnan(width), GL_INVALID_VALUE);
+
+    // NOTE: Widths that aren't positive generate an error in the context, so they are always forwarded.
+    if (width > 0 && m_cached_state.line_width == width)
+        return;
     m_context->gl_line_width(width);
+    if (width > 0)
+        m_cached_state.line_width = width;
 }
 
 void WebGLRenderingContextBase::polygon_offset(GLfloat factor, GLfloat units)
@@ -283,7 +311,11 @@ void WebGLRenderingContextBase::polygon_offset(GLfloat factor, GLfloat units)
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::polygon_offset(factor={}, units={})", factor, units);
+    Array<GLfloat, 2> polygon_offset { factor, units };
+    if (m_cached_state.polygon_offset == polygon_offset)
+        return;
     m_context->gl_polygon_offset(factor, units);
+    m_cached_state.polygon_offset = polygon_offset;
 }
 
 void WebGLRenderingContextBase::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -292,7 +324,15 @@ void WebGLRenderingContextBase::scissor(GLint x, GLint y, GLsizei width, GLsizei
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::scissor(x={}, y={}, width={}, height={})", x, y, width, height);
+
+    // NOTE: Negative sizes generate an error in the context, so they are always forwarded.
+    Array<GLint, 4> scissor { x, y, width, height };
+    bool is_valid = width >= 0 && height >= 0;
+    if (is_valid && m_cached_state.scissor == scissor)
+        return;
     m_context->gl_scissor(x, y, width, height);
+    if (is_valid)
+        m_cached_state.scissor = scissor;
 }
 
 void WebGLRenderingContextBase::stencil_op(GLenum fail, GLenum zfail, GLenum zpass)
@@ -319,7 +359,15 @@ void WebGLRenderingContextBase::viewport(GLint x, GLint y, GLsizei width, GLsize
         return;
 
     dbgln_if(WEBGL_CONTEXT_DEBUG, "WebGLRenderingContextBase::viewport(x={}, y={}, width={}, height={})", x, y, width, height);
+
+    // NOTE: Negative sizes generate an error in the context, so they are always forwarded.
+    Array<GLint, 4> viewport { x, y, width, height };
+    bool is_valid = width >= 0 && height >= 0;
+    if (is_valid && m_cached_state.viewport == viewport)
+        return;
     m_context->gl_viewport(x, y, width, height);
+    if (is_valid)
+        m_cached_state.viewport = viewport;
 }
 
 }
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Optional.h>
 #include <AK/WeakPtr.h>
 #include <AK/Weakable.h>
 #include <LibJS/Heap/GCPtr.h>
@@ -95,6 +97,23 @@ private:
 
     GLenum m_error { GL_NO_ERROR };
 
+    // State that was last successfully set on the OpenGL context. Frameworks tend to set the same state over and over
+    // again every frame, so calls that wouldn't change anything are not forwarded to the context. Only state whose
+    // setters can't generate errors for the cached values is tracked here, so skipping a call never loses an error.
+    struct CachedState {
+        Optional<Array<GLclampf, 4>> clear_color;
+        Optional<GLclampf> clear_depth;
+        Optional<GLint> clear_stencil;
+        Optional<Array<GLboolean, 4>> color_mask;
+        Optional<GLboolean> depth_mask;
+        Optional<Array<GLclampf, 2>> depth_range;
+        Optional<GLfloat> line_width;
+        Optional<Array<GLfloat, 2>> polygon_offset;
+        Optional<Array<GLint, 4>> scissor;
+        Optional<Array<GLint, 4>> viewport;
+    };
+    CachedState m_cached_state;
+
     HTML::HTMLCanvasElement& canvas_element();
     HTML::HTMLCanvasElement const& canvas_element() const;
 
@@ -9,6 +9,8 @@ libweb_js_bindings(Animations/DocumentTimeline)
 libweb_js_bindings(Animations/KeyframeEffect)
 libweb_js_bindings(Clipboard/Clipboard)
 libweb_js_bindings(Clipboard/ClipboardEvent)
+libweb_js_bindings(Compression/CompressionStream)
+libweb_js_bindings(Compression/DecompressionStream)
 libweb_js_bindings(Crypto/Crypto)
 libweb_js_bindings(Crypto/CryptoKey)
 libweb_js_bindings(Crypto/SubtleCrypto)
@@ -82,6 +84,7 @@ libweb_js_bindings(DOMURL/URLSearchParams ITERABLE)
 libweb_js_bindings(Encoding/TextDecoder)
 libweb_js_bindings(Encoding/TextEncoder)
 libweb_js_bindings(EntriesAPI/FileSystemEntry)
+libweb_js_bindings(EventTiming/PerformanceEventTiming)
 libweb_js_bindings(Fetch/Headers ITERABLE)
 libweb_js_bindings(Fetch/Request)
 libweb_js_bindings(Fetch/Response)
@@ -239,25 +242,37 @@ libweb_js_bindings(HTML/WorkerGlobalScope)
 libweb_js_bindings(HTML/WorkerLocation)
 libweb_js_bindings(HTML/WorkerNavigator)
 libweb_js_bindings(HighResolutionTime/Performance)
+libweb_js_bindings(IndexedDB/IDBCursor)
+libweb_js_bindings(IndexedDB/IDBCursorWithValue)
+libweb_js_bindings(IndexedDB/IDBDatabase)
 libweb_js_bindings(IndexedDB/IDBFactory)
+libweb_js_bindings(IndexedDB/IDBIndex)
+libweb_js_bindings(IndexedDB/IDBKeyRange)
+libweb_js_bindings(IndexedDB/IDBObjectStore)
 libweb_js_bindings(IndexedDB/IDBOpenDBRequest)
 libweb_js_bindings(IndexedDB/IDBRequest)
+libweb_js_bindings(IndexedDB/IDBTransaction)
+libweb_js_bindings(IndexedDB/IDBVersionChangeEvent)
 libweb_js_bindings(Internals/Inspector)
 libweb_js_bindings(Internals/InternalAnimationTimeline)
 libweb_js_bindings(Internals/Internals)
 libweb_js_bindings(IntersectionObserver/IntersectionObserver)
 libweb_js_bindings(IntersectionObserver/IntersectionObserverEntry)
+libweb_js_bindings(LongTasks/PerformanceLongTaskTiming)
+libweb_js_bindings(LongTasks/TaskAttributionTiming)
 libweb_js_bindings(MathML/MathMLElement)
 libweb_js_bindings(MediaCapabilitiesAPI/MediaCapabilities)
 libweb_js_bindings(NavigationTiming/PerformanceNavigation)
 libweb_js_bindings(NavigationTiming/PerformanceTiming)
 libweb_js_bindings(PerformanceTimeline/PerformanceEntry)
+libweb_js_bindings(PerformanceTimeline/PerformanceGarbageCollectionTiming)
 libweb_js_bindings(PerformanceTimeline/PerformanceObserver)
 libweb_js_bindings(PerformanceTimeline/PerformanceObserverEntryList)
 libweb_js_bindings(RequestIdleCallback/IdleDeadline)
 libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(ResizeObserver/ResizeObserverEntry)
 libweb_js_bindings(ResizeObserver/ResizeObserverSize)
+libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
 libweb_js_bindings(Streams/ByteLengthQueuingStrategy)
 libweb_js_bindings(Streams/CountQueuingStrategy)
 libweb_js_bindings(Streams/ReadableByteStreamController)
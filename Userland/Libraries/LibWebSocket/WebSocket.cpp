@@ -22,6 +22,24 @@ NonnullRefPtr<WebSocket> WebSocket::create(ConnectionInfo connection, RefPtr<Web
     return adopt_ref(*new WebSocket(move(connection), move(impl)));
 }
 
+// Section 5.3 : XORs the payload with the masking key, eight bytes at a time.
+static void apply_masking_key(Bytes payload, u8 const (&masking_key)[4])
+{
+    u32 key;
+    __builtin_memcpy(&key, masking_key, sizeof(key));
+    u64 const wide_key = (static_cast<u64>(key) << 32) | key;
+
+    size_t i = 0;
+    for (; i + sizeof(u64) <= payload.size(); i += sizeof(u64)) {
+        u64 word;
+        __builtin_memcpy(&word, payload.offset_pointer(i), sizeof(word));
+        word ^= wide_key;
+        __builtin_memcpy(payload.offset_pointer(i), &word, sizeof(word));
+    }
+    for (; i < payload.size(); ++i)
+        payload[i] ^= masking_key[i % 4];
+}
+
 WebSocket::WebSocket(ConnectionInfo connection, RefPtr<WebSocketImpl> impl)
     : m_connection(move(connection))
     , m_impl(move(impl))
@@ -456,31 +474,30 @@ void WebSocket::read_frame()
         masking_key[3] = masking_key_data[3];
     }
 
-    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    u64 read_length = 0;
-    while (read_length < payload_length) {
-        auto payload_part = get_buffered_bytes(payload_length - read_length);
-        if (payload_part.is_null())
-            return;
-        // We read at most "actual_length - read" bytes, so this is safe to do.
-        payload.overwrite(read_length, payload_part.data(), payload_part.size());
-        read_length += payload_part.size();
-    }
+    auto payload_data = get_buffered_bytes(payload_length);
+    if (payload_length > 0 && payload_data.is_null())
+        return;
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
+    // Fragments of a message are unmasked straight into the fragmented data buffer, so that the complete message
+    // can be handed out without copying it again.
+    ByteBuffer payload;
+    if (!is_final_frame || op_code == WebSocket::OpCode::Continuation) {
+        if (op_code != WebSocket::OpCode::Continuation) {
+            // First fragmented message
+            m_initial_fragment_opcode = op_code;
+        }
+        auto offset = m_fragmented_data_buffer.size();
+        m_fragmented_data_buffer.append(payload_data);
+        if (is_masked)
+            apply_masking_key(m_fragmented_data_buffer.bytes().slice(offset), masking_key);
     } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
+        payload = ByteBuffer::copy(payload_data).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
+        if (is_masked)
+            apply_masking_key(payload.bytes(), masking_key);
     }
 
-    if (is_masked) {
-        // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
-        }
-    }
+    // Drop the frame from the front of the buffered data, keeping the buffer's capacity around for the next frames.
+    m_buffered_data.remove(0, cursor);
 
     if (op_code == WebSocket::OpCode::ConnectionClose) {
         if (payload.size() > 1) {
@@ -500,21 +517,13 @@ void WebSocket::read_frame()
         return;
     }
     if (!is_final_frame) {
-        if (op_code != WebSocket::OpCode::Continuation) {
-            // First fragmented message
-            m_initial_fragment_opcode = op_code;
-        }
         // First and next fragmented message
-        m_fragmented_data_buffer.append(payload.data(), payload_length);
         return;
     }
-    if (is_final_frame && op_code == WebSocket::OpCode::Continuation) {
+    if (op_code == WebSocket::OpCode::Continuation) {
         // Last fragmented message
-        m_fragmented_data_buffer.append(payload.data(), payload_length);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
-        m_fragmented_data_buffer.clear();
+        payload = move(m_fragmented_data_buffer);
     }
     if (op_code == WebSocket::OpCode::Text) {
         notify_message(Message(payload, true));
@@ -531,79 +540,51 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)) };
-    m_impl->send(ReadonlyBytes(frame_head, 1));
+
+    // The frame header and the (masked) payload are assembled into a single reusable buffer, so that each frame is
+    // sent with one write and without allocating.
+    m_outgoing_frame_buffer.clear_with_capacity();
+    m_outgoing_frame_buffer.append((u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)));
+
     // Section 5.1 : a client MUST mask all frames that it sends to the server
     bool has_mask = true;
+    u8 mask_flag = has_mask ? 0x80 : 0x00;
     // FIXME: If the payload has a size > size_t max on a 32-bit platform, we could
     //     technically stream it via non-final packets. However, the size was already
     //     truncated earlier in the call stack when stuffing into a ReadonlyBytes
     if (payload.size() > NumericLimits<u16>::max()) {
         // Send (the 'mask' flag + 127) + the 8-byte payload length
-        if constexpr (sizeof(size_t) >= 8) {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                (u8)((payload.size() >> 56) & 0xff),
-                (u8)((payload.size() >> 48) & 0xff),
-                (u8)((payload.size() >> 40) & 0xff),
-                (u8)((payload.size() >> 32) & 0xff),
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        } else {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                0,
-                0,
-                0,
-                0,
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        }
+        u64 payload_size = payload.size();
+        m_outgoing_frame_buffer.append((u8)(mask_flag | 127));
+        for (int shift = 56; shift >= 0; shift -= 8)
+            m_outgoing_frame_buffer.append((u8)((payload_size >> shift) & 0xff));
     } else if (payload.size() >= 126) {
         // Send (the 'mask' flag + 126) + the 2-byte payload length
-        u8 payload_length[3] = {
-            (u8)((has_mask ? 0x80 : 0x00) | 126),
-            (u8)((payload.size() >> 8) & 0xff),
-            (u8)((payload.size() >> 0) & 0xff),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 3));
+        m_outgoing_frame_buffer.append((u8)(mask_flag | 126));
+        m_outgoing_frame_buffer.append((u8)((payload.size() >> 8) & 0xff));
+        m_outgoing_frame_buffer.append((u8)((payload.size() >> 0) & 0xff));
     } else {
         // Send the mask flag + the payload in a single byte
-        u8 payload_length[1] = {
-            (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f)),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 1));
+        m_outgoing_frame_buffer.append((u8)(mask_flag | (u8)(payload.size() & 0x7f)));
     }
+
     if (has_mask) {
         // Section 10.3 :
         // > Clients MUST choose a new masking key for each frame, using an algorithm
         // > that cannot be predicted by end applications that provide data
         u8 masking_key[4];
         fill_with_random(masking_key);
-        m_impl->send(ReadonlyBytes(masking_key, 4));
-        // don't try to send empty payload
-        if (payload.size() == 0)
-            return;
+        m_outgoing_frame_buffer.append(masking_key, 4);
+
         // Mask the payload
-        auto buffer_result = ByteBuffer::create_uninitialized(payload.size());
-        if (!buffer_result.is_error()) {
-            auto& masked_payload = buffer_result.value();
-            for (size_t i = 0; i < payload.size(); ++i) {
-                masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
-            }
-            m_impl->send(masked_payload);
-        }
-    } else if (payload.size() > 0) {
-        m_impl->send(payload);
+        auto offset = m_outgoing_frame_buffer.size();
+        m_outgoing_frame_buffer.append(payload.data(), payload.size());
+        apply_masking_key(m_outgoing_frame_buffer.span().slice(offset), masking_key);
+    } else {
+        m_outgoing_frame_buffer.append(payload.data(), payload.size());
     }
+
+    m_impl->send(m_outgoing_frame_buffer.span());
 }
 
 void WebSocket::fatal_error(WebSocket::Error error)
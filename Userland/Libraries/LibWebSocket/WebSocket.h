@@ -119,6 +119,7 @@ private:
 
     Vector<u8> m_buffered_data;
     ByteBuffer m_fragmented_data_buffer;
+    Vector<u8> m_outgoing_frame_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
 };
 
@@ -14,6 +14,7 @@
 #include <LibWebView/Application.h>
 #include <LibWebView/CookieJar.h>
 #include <LibWebView/Database.h>
+#include <LibWebView/StorageJar.h>
 #include <LibWebView/URL.h>
 #include <LibWebView/UserAgent.h>
 #include <LibWebView/WebContentClient.h>
@@ -68,11 +69,15 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     Optional<StringView> user_agent_preset;
     bool log_all_js_exceptions = false;
     bool enable_idl_tracing = false;
+    bool enable_bytecode_profiling = false;
+    bool enable_gc_performance_entries = false;
     bool enable_http_cache = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
+    size_t spare_web_content_processes = 1;
+    size_t spare_web_worker_processes = 1;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("The Ladybird web browser :^)");
@@ -88,11 +93,15 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     args_parser.add_option(webdriver_content_ipc_path, "Path to WebDriver IPC for WebContent", "webdriver-content-path", 0, "path", Core::ArgsParser::OptionHideMode::CommandLineAndMarkdown);
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
+    args_parser.add_option(enable_bytecode_profiling, "Count executed JavaScript bytecode instructions", "enable-bytecode-profiling");
+    args_parser.add_option(enable_gc_performance_entries, "Report garbage collections to PerformanceObservers", "enable-gc-performance-entries");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
+    args_parser.add_option(spare_web_content_processes, "Number of WebContent processes to launch ahead of time for new tabs", "spare-web-content-processes", 0, "count");
+    args_parser.add_option(spare_web_worker_processes, "Number of WebWorker processes to launch ahead of time for new workers", "spare-web-worker-processes", 0, "count");
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Name of the User-Agent preset to use in place of the default User-Agent",
@@ -132,6 +141,8 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
         .disable_sql_database = disable_sql_database ? DisableSQLDatabase::Yes : DisableSQLDatabase::No,
         .debug_helper_process = move(debug_process_type),
         .profile_helper_process = move(profile_process_type),
+        .spare_web_content_processes = spare_web_content_processes,
+        .spare_web_worker_processes = spare_web_worker_processes,
     };
 
     if (webdriver_content_ipc_path.has_value())
@@ -143,6 +154,8 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
         .user_agent_preset = move(user_agent_preset),
         .log_all_js_exceptions = log_all_js_exceptions ? LogAllJSExceptions::Yes : LogAllJSExceptions::No,
         .enable_idl_tracing = enable_idl_tracing ? EnableIDLTracing::Yes : EnableIDLTracing::No,
+        .enable_bytecode_profiling = enable_bytecode_profiling ? EnableBytecodeProfiling::Yes : EnableBytecodeProfiling::No,
+        .enable_gc_performance_entries = enable_gc_performance_entries ? EnableGCPerformanceEntries::Yes : EnableGCPerformanceEntries::No,
         .enable_http_cache = enable_http_cache ? EnableHTTPCache::Yes : EnableHTTPCache::No,
         .expose_internals_object = expose_internals_object ? ExposeInternalsObject::Yes : ExposeInternalsObject::No,
         .force_cpu_painting = force_cpu_painting ? ForceCPUPainting::Yes : ForceCPUPainting::No,
@@ -155,8 +168,10 @@ void Application::initialize(Main::Arguments const& arguments, URL::URL new_tab_
     if (m_chrome_options.disable_sql_database == DisableSQLDatabase::No) {
         m_database = Database::create().release_value_but_fixme_should_propagate_errors();
         m_cookie_jar = CookieJar::create(*m_database).release_value_but_fixme_should_propagate_errors();
+        m_storage_jar = StorageJar::create(*m_database).release_value_but_fixme_should_propagate_errors();
     } else {
         m_cookie_jar = CookieJar::create();
+        m_storage_jar = StorageJar::create();
     }
 }
 
@@ -35,6 +35,7 @@ public:
     static WebContentOptions const& web_content_options() { return the().m_web_content_options; }
 
     static CookieJar& cookie_jar() { return *the().m_cookie_jar; }
+    static StorageJar& storage_jar() { return *the().m_storage_jar; }
 
     Core::EventLoop& event_loop() { return m_event_loop; }
 
@@ -81,6 +82,7 @@ private:
 
     RefPtr<Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
+    OwnPtr<StorageJar> m_storage_jar;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
 
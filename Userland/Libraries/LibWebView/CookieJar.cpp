@@ -43,6 +43,8 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
         to_underlying(Web::Cookie::SameSite::Lax)))));
     database.execute_statement(create_table, {});
 
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
@@ -68,11 +70,19 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
+            auto& database = m_persisted_storage->database;
+            auto const& statements = m_persisted_storage->statements;
+
+            // NOTE: All pending writes are committed in a single transaction, rather than one transaction per cookie.
+            database.execute_statement(statements.begin_transaction, {});
+
             for (auto const& it : m_transient_storage.take_dirty_cookies())
                 m_persisted_storage->insert_cookie(it.value);
 
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            database.execute_statement(statements.expire_cookie, {}, now);
+
+            database.execute_statement(statements.commit_transaction, {});
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -555,7 +565,7 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    m_transient_storage.for_each_cookie_for_domain(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -628,27 +638,61 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
-    m_cookies = move(cookies);
+    m_cookies_by_domain.clear();
+    m_size = 0;
+    m_next_expiry_time = UnixDateTime::latest();
+
+    for (auto& it : cookies) {
+        m_next_expiry_time = min(m_next_expiry_time, it.value.expiry_time);
+
+        auto& domain_cookies = m_cookies_by_domain.ensure(it.key.domain);
+        if (domain_cookies.set(it.key, move(it.value)) == HashSetResult::InsertedNewEntry)
+            ++m_size;
+    }
+
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
-    m_cookies.set(key, cookie);
+    m_next_expiry_time = min(m_next_expiry_time, cookie.expiry_time);
+
+    auto& domain_cookies = m_cookies_by_domain.ensure(key.domain);
+    if (domain_cookies.set(key, cookie) == HashSetResult::InsertedNewEntry)
+        ++m_size;
+
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
 Optional<Web::Cookie::Cookie> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
 {
-    return m_cookies.get(key);
+    auto domain_cookies = m_cookies_by_domain.find(key.domain);
+    if (domain_cookies == m_cookies_by_domain.end())
+        return {};
+
+    return domain_cookies->value.get(key);
 }
 
 UnixDateTime CookieJar::TransientStorage::purge_expired_cookies()
 {
     auto now = UnixDateTime::now();
+    if (m_next_expiry_time >= now)
+        return now;
+
     auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
+    m_next_expiry_time = UnixDateTime::latest();
+
+    m_cookies_by_domain.remove_all_matching([&](auto const&, Cookies& domain_cookies) {
+        m_size -= domain_cookies.size();
+        domain_cookies.remove_all_matching(is_expired);
+        m_size += domain_cookies.size();
+
+        for (auto const& it : domain_cookies)
+            m_next_expiry_time = min(m_next_expiry_time, it.value.expiry_time);
+
+        return domain_cookies.is_empty();
+    });
 
-    m_cookies.remove_all_matching(is_expired);
     return now;
 }
 
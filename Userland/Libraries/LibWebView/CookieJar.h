@@ -32,6 +32,8 @@ struct CookieStorageKey {
 
 class CookieJar {
     struct Statements {
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
@@ -45,7 +47,7 @@ class CookieJar {
         void set_cookie(CookieStorageKey, Web::Cookie::Cookie);
         Optional<Web::Cookie::Cookie> get_cookie(CookieStorageKey const&);
 
-        size_t size() const { return m_cookies.size(); }
+        size_t size() const { return m_size; }
 
         UnixDateTime purge_expired_cookies();
 
@@ -53,22 +55,59 @@ class CookieJar {
 
         template<typename Callback>
         void for_each_cookie(Callback callback)
+        {
+            for (auto& it : m_cookies_by_domain) {
+                if (for_each_cookie_in(it.value, callback) == IterationDecision::Break)
+                    return;
+            }
+        }
+
+        // Visits only the cookies whose domain is the given canonicalized domain, or one of its parent domains. These
+        // are the only cookies that may domain-match a request to that domain.
+        template<typename Callback>
+        void for_each_cookie_for_domain(StringView domain, Callback callback)
+        {
+            while (!domain.is_empty()) {
+                if (auto cookies = m_cookies_by_domain.find(domain); cookies != m_cookies_by_domain.end()) {
+                    if (for_each_cookie_in(cookies->value, callback) == IterationDecision::Break)
+                        return;
+                }
+
+                auto index = domain.find('.');
+                if (!index.has_value())
+                    break;
+                domain = domain.substring_view(*index + 1);
+            }
+        }
+
+    private:
+        template<typename Callback>
+        static IterationDecision for_each_cookie_in(Cookies& cookies, Callback& callback)
         {
             using ReturnType = InvokeResult<Callback, Web::Cookie::Cookie&>;
 
-            for (auto& it : m_cookies) {
+            for (auto& it : cookies) {
                 if constexpr (IsSame<ReturnType, IterationDecision>) {
                     if (callback(it.value) == IterationDecision::Break)
-                        return;
+                        return IterationDecision::Break;
                 } else {
                     static_assert(IsSame<ReturnType, void>);
                     callback(it.value);
                 }
             }
+
+            return IterationDecision::Continue;
         }
 
-    private:
-        Cookies m_cookies;
+        // NOTE: Cookies are indexed by their domain, so that retrieving the cookies for a URL only needs to look at the
+        //       cookies of that URL's host and its parent domains, rather than at every cookie in the jar.
+        HashMap<String, Cookies> m_cookies_by_domain;
+        size_t m_size { 0 };
+
+        // NOTE: The earliest expiry time of any stored cookie, so that purging expired cookies is only a comparison
+        //       until one of them actually expires.
+        UnixDateTime m_next_expiry_time { UnixDateTime::latest() };
+
         Cookies m_dirty_cookies;
     };
 
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Base64.h>
+#include <AK/CharacterTypes.h>
 #include <AK/Enumerate.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
@@ -157,6 +158,10 @@ InspectorClient::InspectorClient(ViewImplementation& content_web_view, ViewImple
         handle_console_messages(start_index, message_types, messages);
     };
 
+    m_content_web_view.on_received_js_profile = [this](String const& label, ByteString const& profile) {
+        save_js_profile(label, profile);
+    };
+
     m_inspector_web_view.enable_inspector_prototype();
     m_inspector_web_view.use_native_user_style_sheet();
 
@@ -289,6 +294,7 @@ InspectorClient::~InspectorClient()
     m_content_web_view.on_received_accessibility_tree = nullptr;
     m_content_web_view.on_received_console_message = nullptr;
     m_content_web_view.on_received_console_messages = nullptr;
+    m_content_web_view.on_received_js_profile = nullptr;
     m_content_web_view.on_received_dom_node_html = nullptr;
     m_content_web_view.on_received_dom_node_properties = nullptr;
     m_content_web_view.on_received_dom_tree = nullptr;
@@ -306,6 +312,7 @@ void InspectorClient::inspect()
     m_content_web_view.inspect_accessibility_tree();
     m_content_web_view.list_style_sheets();
     load_cookies();
+    load_network_requests();
 }
 
 void InspectorClient::reset()
@@ -382,6 +389,21 @@ void InspectorClient::load_cookies()
     m_inspector_web_view.run_javascript(builder.string_view());
 }
 
+void InspectorClient::load_network_requests()
+{
+    // NOTE: If another page info request is already in flight, we just keep showing the previous list of requests.
+    m_content_web_view.request_internal_page_info(PageInfoType::NetworkRequests)
+        ->when_resolved([this](auto const& network_requests) {
+            StringBuilder builder;
+            builder.append("inspector.setNetworkRequests("sv);
+            builder.append(network_requests);
+            builder.append(");"sv);
+
+            m_inspector_web_view.run_javascript(builder.string_view());
+        })
+        .when_rejected([](auto const&) {});
+}
+
 void InspectorClient::context_menu_edit_dom_node()
 {
     VERIFY(m_context_menu_data.has_value());
@@ -702,6 +724,36 @@ String InspectorClient::generate_accessibility_tree(JsonObject const& accessibil
     return MUST(builder.to_string());
 }
 
+void InspectorClient::save_js_profile(String const& label, ByteString const& profile)
+{
+    // Profile labels are arbitrary strings, so only keep the characters that are safe in a file name.
+    StringBuilder file_name;
+    for (auto code_point : label.code_points())
+        file_name.append_code_point(is_ascii_alphanumeric(code_point) || code_point == '-' || code_point == '_' ? code_point : '-');
+    file_name.append(".cpuprofile"sv);
+
+    auto maybe_profile_path = Application::the().path_for_downloaded_file(file_name.string_view());
+    if (maybe_profile_path.is_error()) {
+        append_console_warning(MUST(String::formatted("Unable to select a download location: {}", maybe_profile_path.error())));
+        return;
+    }
+
+    auto profile_path = maybe_profile_path.release_value();
+
+    auto file = Core::File::open(profile_path.string(), Core::File::OpenMode::Write);
+    if (file.is_error()) {
+        append_console_warning(MUST(String::formatted("Unable to open {}: {}", profile_path, file.error())));
+        return;
+    }
+
+    if (auto result = file.value()->write_until_depleted(profile.bytes()); result.is_error()) {
+        append_console_warning(MUST(String::formatted("Unable to save {}: {}", profile_path, result.error())));
+        return;
+    }
+
+    append_console_message(MUST(String::formatted("Saved JavaScript profile to {}", profile_path)));
+}
+
 void InspectorClient::request_console_messages()
 {
     VERIFY(!m_waiting_for_messages);
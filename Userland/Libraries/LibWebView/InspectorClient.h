@@ -55,6 +55,9 @@ private:
     void select_node(i32 node_id);
 
     void load_cookies();
+    void load_network_requests();
+
+    void save_js_profile(String const& label, ByteString const& profile);
 
     void request_console_messages();
     void handle_console_message(i32 message_index);
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibWebView/MemoryUsage.h>
+
+namespace WebView {
+
+MemoryUsage& MemoryUsage::operator+=(MemoryUsage const& other)
+{
+    js_heap_used_bytes += other.js_heap_used_bytes;
+    js_heap_committed_bytes += other.js_heap_committed_bytes;
+    layout_tree_bytes += other.layout_tree_bytes;
+    paint_tree_bytes += other.paint_tree_bytes;
+    display_list_bytes += other.display_list_bytes;
+    decoded_image_bytes += other.decoded_image_bytes;
+    font_cache_bytes += other.font_cache_bytes;
+    backing_store_bytes += other.backing_store_bytes;
+    skia_cache_bytes += other.skia_cache_bytes;
+    return *this;
+}
+
+}
+
+template<>
+ErrorOr<void> IPC::encode(Encoder& encoder, WebView::MemoryUsage const& usage)
+{
+    TRY(encoder.encode(usage.js_heap_used_bytes));
+    TRY(encoder.encode(usage.js_heap_committed_bytes));
+    TRY(encoder.encode(usage.layout_tree_bytes));
+    TRY(encoder.encode(usage.paint_tree_bytes));
+    TRY(encoder.encode(usage.display_list_bytes));
+    TRY(encoder.encode(usage.decoded_image_bytes));
+    TRY(encoder.encode(usage.font_cache_bytes));
+    TRY(encoder.encode(usage.backing_store_bytes));
+    TRY(encoder.encode(usage.skia_cache_bytes));
+    return {};
+}
+
+template<>
+ErrorOr<WebView::MemoryUsage> IPC::decode(Decoder& decoder)
+{
+    WebView::MemoryUsage usage;
+    usage.js_heap_used_bytes = TRY(decoder.decode<u64>());
+    usage.js_heap_committed_bytes = TRY(decoder.decode<u64>());
+    usage.layout_tree_bytes = TRY(decoder.decode<u64>());
+    usage.paint_tree_bytes = TRY(decoder.decode<u64>());
+    usage.display_list_bytes = TRY(decoder.decode<u64>());
+    usage.decoded_image_bytes = TRY(decoder.decode<u64>());
+    usage.font_cache_bytes = TRY(decoder.decode<u64>());
+    usage.backing_store_bytes = TRY(decoder.decode<u64>());
+    usage.skia_cache_bytes = TRY(decoder.decode<u64>());
+    return usage;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <LibIPC/Forward.h>
+
+namespace WebView {
+
+// A breakdown of the memory used by a WebContent process, as reported by the process itself.
+//
+// Layout and paint trees live in the JS heap, so they are a part of the JS heap's used bytes rather than in addition
+// to them. Everything else is allocated outside of the JS heap.
+struct MemoryUsage {
+    u64 js_heap_used_bytes { 0 };
+    u64 js_heap_committed_bytes { 0 };
+    u64 layout_tree_bytes { 0 };
+    u64 paint_tree_bytes { 0 };
+    u64 display_list_bytes { 0 };
+    u64 decoded_image_bytes { 0 };
+    u64 font_cache_bytes { 0 };
+    u64 backing_store_bytes { 0 };
+    u64 skia_cache_bytes { 0 };
+
+    // The sum of everything that doesn't overlap, i.e. all but the layout and paint trees and the JS heap's used bytes.
+    u64 total_bytes() const
+    {
+        return js_heap_committed_bytes + display_list_bytes + decoded_image_bytes + font_cache_bytes + backing_store_bytes + skia_cache_bytes;
+    }
+
+    MemoryUsage& operator+=(MemoryUsage const&);
+};
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, WebView::MemoryUsage const&);
+
+template<>
+ErrorOr<WebView::MemoryUsage> decode(Decoder&);
+
+}
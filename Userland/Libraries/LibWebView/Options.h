@@ -58,6 +58,12 @@ struct ChromeOptions {
     Optional<ProcessType> debug_helper_process {};
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
+
+    // How many WebContent processes to keep launched ahead of time, ready to be handed to new tabs.
+    size_t spare_web_content_processes { 1 };
+
+    // How many WebWorker processes to keep launched ahead of time, ready to run a page's next dedicated worker.
+    size_t spare_web_worker_processes { 1 };
 };
 
 enum class IsLayoutTestMode {
@@ -80,6 +86,16 @@ enum class EnableIDLTracing {
     Yes,
 };
 
+enum class EnableBytecodeProfiling {
+    No,
+    Yes,
+};
+
+enum class EnableGCPerformanceEntries {
+    No,
+    Yes,
+};
+
 enum class EnableHTTPCache {
     No,
     Yes,
@@ -109,6 +125,8 @@ struct WebContentOptions {
     UseLagomNetworking use_lagom_networking { UseLagomNetworking::Yes };
     LogAllJSExceptions log_all_js_exceptions { LogAllJSExceptions::No };
     EnableIDLTracing enable_idl_tracing { EnableIDLTracing::No };
+    EnableBytecodeProfiling enable_bytecode_profiling { EnableBytecodeProfiling::No };
+    EnableGCPerformanceEntries enable_gc_performance_entries { EnableGCPerformanceEntries::No };
     EnableHTTPCache enable_http_cache { EnableHTTPCache::No };
     ExposeInternalsObject expose_internals_object { ExposeInternalsObject::No };
     ForceCPUPainting force_cpu_painting { ForceCPUPainting::No };
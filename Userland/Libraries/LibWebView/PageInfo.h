@@ -15,6 +15,10 @@ enum class PageInfoType {
     LayoutTree = 1 << 2,
     PaintTree = 1 << 3,
     GCGraph = 1 << 4,
+    HeapStatistics = 1 << 5,
+    EventLoopStatistics = 1 << 6,
+    BytecodeProfile = 1 << 7,
+    NetworkRequests = 1 << 8,
 };
 
 AK_ENUM_BITWISE_OPERATORS(PageInfoType);
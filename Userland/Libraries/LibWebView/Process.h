@@ -10,6 +10,7 @@
 #include <AK/WeakPtr.h>
 #include <LibCore/Process.h>
 #include <LibIPC/Connection.h>
+#include <LibWebView/MemoryUsage.h>
 #include <LibWebView/ProcessType.h>
 
 namespace WebView {
@@ -26,6 +27,10 @@ public:
     Optional<String> const& title() const { return m_title; }
     void set_title(Optional<String> title) { m_title = move(title); }
 
+    // The breakdown most recently reported by the process itself, if it reports one at all.
+    Optional<MemoryUsage> const& memory_usage() const { return m_memory_usage; }
+    void set_memory_usage(MemoryUsage const& memory_usage) { m_memory_usage = memory_usage; }
+
     template<typename ConnectionFromClient>
     Optional<ConnectionFromClient&> client()
     {
@@ -40,6 +45,7 @@ private:
     Core::Process m_process;
     ProcessType m_type;
     Optional<String> m_title;
+    Optional<MemoryUsage> m_memory_usage;
     WeakPtr<IPC::ConnectionBase> m_connection;
 };
 
@@ -9,6 +9,7 @@
 #include <LibCore/EventLoop.h>
 #include <LibCore/System.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentClient.h>
 
 namespace WebView {
 
@@ -117,6 +118,14 @@ void ProcessManager::update_all_process_statistics()
 {
     Threading::MutexLocker locker { m_lock };
     (void)update_process_statistics(m_statistics);
+
+    // WebContent processes reply asynchronously, so their breakdown lags a refresh behind the OS statistics.
+    for (auto& it : m_processes) {
+        if (it.value.type() != ProcessType::WebContent)
+            continue;
+        if (auto client = it.value.client<WebContentClient>(); client.has_value())
+            client->async_request_memory_usage();
+    }
 }
 
 String ProcessManager::generate_html()
@@ -174,13 +183,16 @@ String ProcessManager::generate_html()
                 <tbody>
     )"sv);
 
-    m_statistics.for_each_process([&](auto const& process) {
-        builder.append("<tr>"sv);
-        builder.append("<td>"sv);
-        auto& process_handle = this->find_process(process.pid).value();
+    auto append_process_name = [&](Process const& process_handle) {
         builder.append(WebView::process_name_from_type(process_handle.type()));
         if (process_handle.title().has_value())
             builder.appendff(" - {}", escape_html_entities(*process_handle.title()));
+    };
+
+    m_statistics.for_each_process([&](auto const& process) {
+        builder.append("<tr>"sv);
+        builder.append("<td>"sv);
+        append_process_name(this->find_process(process.pid).value());
         builder.append("</td>"sv);
         builder.append("<td>"sv);
         builder.append(MUST(String::number(process.pid)));
@@ -197,6 +209,11 @@ String ProcessManager::generate_html()
     builder.append(R"(
                 </tbody>
                 </table>
+    )"sv);
+
+    append_memory_usage_html(builder, append_process_name);
+
+    builder.append(R"(
                 </body>
                 </html>
     )"sv);
@@ -204,4 +221,64 @@ String ProcessManager::generate_html()
     return builder.to_string_without_validation();
 }
 
+void ProcessManager::append_memory_usage_html(StringBuilder& builder, Function<void(Process const&)> const& append_process_name)
+{
+    auto append_row = [&](MemoryUsage const& usage) {
+        for (auto bytes : { usage.js_heap_used_bytes, usage.js_heap_committed_bytes, usage.layout_tree_bytes, usage.paint_tree_bytes, usage.display_list_bytes, usage.decoded_image_bytes, usage.font_cache_bytes, usage.backing_store_bytes, usage.skia_cache_bytes, usage.total_bytes() })
+            builder.appendff("<td>{}</td>", human_readable_size(bytes));
+        builder.append("</tr>"sv);
+    };
+
+    MemoryUsage total_usage;
+    size_t reporting_processes = 0;
+
+    m_statistics.for_each_process([&](auto const& process) {
+        auto& process_handle = this->find_process(process.pid).value();
+        if (!process_handle.memory_usage().has_value())
+            return;
+
+        if (reporting_processes++ == 0) {
+            builder.append(R"(
+                <h3>Memory by category</h3>
+                <p>Layout and paint trees are a part of the used JS heap, and the total counts committed JS heap memory only.</p>
+                <table>
+                <thead>
+                <tr>
+                        <th>Name</th>
+                        <th>JS heap (used)</th>
+                        <th>JS heap (committed)</th>
+                        <th>Layout tree</th>
+                        <th>Paint tree</th>
+                        <th>Display lists</th>
+                        <th>Decoded images</th>
+                        <th>Font caches</th>
+                        <th>Backing stores</th>
+                        <th>Skia caches</th>
+                        <th>Total</th>
+                </tr>
+                </thead>
+                <tbody>
+            )"sv);
+        }
+
+        builder.append("<tr><td>"sv);
+        append_process_name(process_handle);
+        builder.append("</td>"sv);
+        append_row(*process_handle.memory_usage());
+
+        total_usage += *process_handle.memory_usage();
+    });
+
+    if (reporting_processes == 0)
+        return;
+
+    builder.append("<tr><th>All WebContent processes</th>"sv);
+    append_row(total_usage);
+
+    builder.append(R"(
+                </tbody>
+                </table>
+    )"sv);
+}
+
 }
@@ -41,6 +41,8 @@ public:
     Function<void(Process&&)> on_process_exited;
 
 private:
+    void append_memory_usage_html(StringBuilder&, Function<void(Process const&)> const& append_process_name);
+
     Core::Platform::ProcessStatistics m_statistics;
     HashMap<pid_t, Process> m_processes;
     int m_signal_handle { -1 };
@@ -69,9 +69,9 @@ RequestServerAdapter::RequestServerAdapter(NonnullRefPtr<Requests::RequestClient
 
 RequestServerAdapter::~RequestServerAdapter() = default;
 
-RefPtr<Web::ResourceLoaderConnectorRequest> RequestServerAdapter::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& headers, ReadonlyBytes body, Core::ProxyData const& proxy)
+RefPtr<Web::ResourceLoaderConnectorRequest> RequestServerAdapter::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& headers, ReadonlyBytes body, Core::ProxyData const& proxy, Requests::RequestPriority priority)
 {
-    auto protocol_request = m_protocol_client->start_request(method, url, headers, body, proxy);
+    auto protocol_request = m_protocol_client->start_request(method, url, headers, body, proxy, priority);
     if (!protocol_request)
         return {};
     return RequestServerRequestAdapter::try_create(protocol_request.release_nonnull()).release_value_but_fixme_should_propagate_errors();
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Time.h>
+#include <LibWebView/StorageJar.h>
+
+namespace WebView {
+
+static constexpr auto DATABASE_SYNCHRONIZATION_DELAY = AK::Duration::from_seconds(1);
+
+ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS WebStorage (
+            origin TEXT,
+            key TEXT,
+            value TEXT,
+            PRIMARY KEY(origin, key)
+        );)#"sv));
+    database.execute_statement(create_table, {});
+
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+    statements.insert_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO WebStorage VALUES (?, ?, ?);"sv));
+    statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE origin = ? AND key = ?;"sv));
+    statements.clear_origin = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE origin = ?;"sv));
+    statements.select_origin_items = TRY(database.prepare_statement("SELECT key, value FROM WebStorage WHERE origin = ?;"sv));
+
+    return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
+}
+
+NonnullOwnPtr<StorageJar> StorageJar::create()
+{
+    return adopt_own(*new StorageJar { OptionalNone {} });
+}
+
+StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
+    : m_persisted_storage(move(persisted_storage))
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_synchronization_timer = Core::Timer::create_single_shot(
+        static_cast<int>(DATABASE_SYNCHRONIZATION_DELAY.to_milliseconds()),
+        [this]() {
+            flush_dirty_items();
+        });
+}
+
+StorageJar::~StorageJar()
+{
+    if (!m_persisted_storage.has_value())
+        return;
+
+    m_synchronization_timer->stop();
+    flush_dirty_items();
+}
+
+OrderedHashMap<String, String> StorageJar::get_items(String const& origin)
+{
+    return items_for_origin(origin);
+}
+
+void StorageJar::set_item(String const& origin, String const& key, String const& value)
+{
+    items_for_origin(origin).set(key, value);
+    mark_origin_dirty(origin).items.set(key, value);
+}
+
+void StorageJar::remove_item(String const& origin, String const& key)
+{
+    if (!items_for_origin(origin).remove(key))
+        return;
+    mark_origin_dirty(origin).items.set(key, OptionalNone {});
+}
+
+void StorageJar::clear(String const& origin)
+{
+    items_for_origin(origin).clear();
+
+    auto& dirty_origin = mark_origin_dirty(origin);
+    dirty_origin.cleared = true;
+    dirty_origin.items.clear();
+}
+
+OrderedHashMap<String, String>& StorageJar::items_for_origin(String const& origin)
+{
+    return m_items_per_origin.ensure(origin, [&]() -> OrderedHashMap<String, String> {
+        if (!m_persisted_storage.has_value())
+            return {};
+        return m_persisted_storage->select_origin_items(origin);
+    });
+}
+
+StorageJar::DirtyOrigin& StorageJar::mark_origin_dirty(String const& origin)
+{
+    // NOTE: Writes are coalesced per key, and only flushed once the timer fires, so that repeatedly writing the same
+    //       keys only touches the database once.
+    if (m_persisted_storage.has_value() && !m_synchronization_timer->is_active())
+        m_synchronization_timer->start();
+
+    return m_dirty_origins.ensure(origin);
+}
+
+void StorageJar::flush_dirty_items()
+{
+    if (!m_persisted_storage.has_value() || m_dirty_origins.is_empty())
+        return;
+
+    auto dirty_origins = move(m_dirty_origins);
+
+    auto& database = m_persisted_storage->database;
+    database.execute_statement(m_persisted_storage->statements.begin_transaction, {});
+
+    for (auto const& it : dirty_origins)
+        m_persisted_storage->write(it.key, it.value.cleared, it.value.items);
+
+    database.execute_statement(m_persisted_storage->statements.commit_transaction, {});
+}
+
+void StorageJar::PersistedStorage::write(String const& origin, bool cleared, HashMap<String, Optional<String>> const& dirty_items)
+{
+    if (cleared)
+        database.execute_statement(statements.clear_origin, {}, origin);
+
+    for (auto const& it : dirty_items) {
+        if (it.value.has_value())
+            database.execute_statement(statements.insert_item, {}, origin, it.key, *it.value);
+        else
+            database.execute_statement(statements.delete_item, {}, origin, it.key);
+    }
+}
+
+OrderedHashMap<String, String> StorageJar::PersistedStorage::select_origin_items(String const& origin)
+{
+    OrderedHashMap<String, String> items;
+
+    database.execute_statement(
+        statements.select_origin_items,
+        [&](auto statement_id) {
+            auto key = database.result_column<String>(statement_id, 0);
+            auto value = database.result_column<String>(statement_id, 1);
+            items.set(move(key), move(value));
+        },
+        origin);
+
+    return items;
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <LibCore/Timer.h>
+#include <LibWebView/Database.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// Persistent backing store for localStorage. Each origin's entries are loaded from the database the first time a
+// WebContent process asks for them, and modifications are batched up and written out together shortly afterwards,
+// so that pages writing to localStorage in a loop never wait on disk I/O.
+class StorageJar {
+    struct Statements {
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+        Database::StatementID insert_item { 0 };
+        Database::StatementID delete_item { 0 };
+        Database::StatementID clear_origin { 0 };
+        Database::StatementID select_origin_items { 0 };
+    };
+
+    struct PersistedStorage {
+        void write(String const& origin, bool cleared, HashMap<String, Optional<String>> const& dirty_items);
+        OrderedHashMap<String, String> select_origin_items(String const& origin);
+
+        Database& database;
+        Statements statements;
+    };
+
+    struct DirtyOrigin {
+        bool cleared { false };
+        HashMap<String, Optional<String>> items;
+    };
+
+public:
+    static ErrorOr<NonnullOwnPtr<StorageJar>> create(Database&);
+    static NonnullOwnPtr<StorageJar> create();
+
+    ~StorageJar();
+
+    OrderedHashMap<String, String> get_items(String const& origin);
+    void set_item(String const& origin, String const& key, String const& value);
+    void remove_item(String const& origin, String const& key);
+    void clear(String const& origin);
+
+private:
+    explicit StorageJar(Optional<PersistedStorage>);
+
+    AK_MAKE_NONCOPYABLE(StorageJar);
+    AK_MAKE_NONMOVABLE(StorageJar);
+
+    OrderedHashMap<String, String>& items_for_origin(String const& origin);
+    DirtyOrigin& mark_origin_dirty(String const& origin);
+    void flush_dirty_items();
+
+    Optional<PersistedStorage> m_persisted_storage;
+    RefPtr<Core::Timer> m_synchronization_timer;
+
+    HashMap<String, OrderedHashMap<String, String>> m_items_per_origin;
+    HashMap<String, DirtyOrigin> m_dirty_origins;
+};
+
+}
@@ -207,6 +207,13 @@ ByteString ViewImplementation::selected_text()
     return client().get_selected_text(page_id());
 }
 
+NonnullRefPtr<Core::Promise<ByteString>> ViewImplementation::request_selected_text()
+{
+    return client().async_get_selected_text_with_response(page_id())->map<ByteString>([](auto& response) {
+        return response->take_selection();
+    });
+}
+
 Optional<String> ViewImplementation::selected_text_with_whitespace_collapsed()
 {
     auto selected_text = MUST(Web::Infra::strip_and_collapse_whitespace(this->selected_text()));
@@ -76,6 +76,7 @@ public:
     void set_enable_autoplay(bool);
 
     ByteString selected_text();
+    NonnullRefPtr<Core::Promise<ByteString>> request_selected_text();
     Optional<String> selected_text_with_whitespace_collapsed();
     void select_all();
     void find_in_page(String const& query, CaseSensitivity = CaseSensitivity::CaseInsensitive);
@@ -197,6 +198,7 @@ public:
     Function<void(String const&)> on_received_dom_node_html;
     Function<void(i32 message_id)> on_received_console_message;
     Function<void(i32 start_index, Vector<ByteString> const& message_types, Vector<ByteString> const& messages)> on_received_console_messages;
+    Function<void(String const& label, ByteString const& profile)> on_received_js_profile;
     Function<void(i32 count_waiting)> on_resource_status_change;
     Function<void()> on_restore_window;
     Function<Gfx::IntPoint(Gfx::IntPoint)> on_reposition_window;
@@ -9,6 +9,7 @@
 #include "ViewImplementation.h"
 #include <LibWeb/Cookie/ParsedCookie.h>
 #include <LibWebView/CookieJar.h>
+#include <LibWebView/StorageJar.h>
 
 namespace WebView {
 
@@ -23,10 +24,15 @@ Optional<ViewImplementation&> WebContentClient::view_for_pid_and_page_id(pid_t p
     return {};
 }
 
-WebContentClient::WebContentClient(NonnullOwnPtr<Core::LocalSocket> socket, ViewImplementation& view)
+WebContentClient::WebContentClient(NonnullOwnPtr<Core::LocalSocket> socket)
     : IPC::ConnectionToServer<WebContentClientEndpoint, WebContentServerEndpoint>(*this, move(socket))
 {
     s_clients.set(this);
+}
+
+WebContentClient::WebContentClient(NonnullOwnPtr<Core::LocalSocket> socket, ViewImplementation& view)
+    : WebContentClient(move(socket))
+{
     m_views.set(0, &view);
 }
 
@@ -40,6 +46,12 @@ void WebContentClient::die()
     // Intentionally empty. Restart is handled at another level.
 }
 
+void WebContentClient::assign_initial_view(ViewImplementation& view)
+{
+    VERIFY(m_views.is_empty());
+    m_views.set(0, &view);
+}
+
 void WebContentClient::register_view(u64 page_id, ViewImplementation& view)
 {
     VERIFY(page_id > 0);
@@ -343,6 +355,12 @@ void WebContentClient::did_get_internal_page_info(u64 page_id, WebView::PageInfo
         view->did_receive_internal_page_info({}, type, info);
 }
 
+void WebContentClient::did_report_memory_usage(WebView::MemoryUsage const& usage)
+{
+    if (auto process = WebView::Application::the().find_process(m_process_handle.pid); process.has_value())
+        process->set_memory_usage(usage);
+}
+
 void WebContentClient::did_output_js_console_message(u64 page_id, i32 message_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -359,6 +377,14 @@ void WebContentClient::did_get_js_console_messages(u64 page_id, i32 start_index,
     }
 }
 
+void WebContentClient::did_finish_js_profile(u64 page_id, String const& label, ByteString const& profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value()) {
+        if (view->on_received_js_profile)
+            view->on_received_js_profile(label, profile);
+    }
+}
+
 void WebContentClient::did_request_alert(u64 page_id, String const& message)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -445,6 +471,26 @@ void WebContentClient::did_update_cookie(Web::Cookie::Cookie const& cookie)
     Application::cookie_jar().update_cookie(cookie);
 }
 
+Messages::WebContentClient::DidRequestLocalStorageItemsResponse WebContentClient::did_request_local_storage_items(String const& origin)
+{
+    return Application::storage_jar().get_items(origin);
+}
+
+void WebContentClient::did_set_local_storage_item(String const& origin, String const& key, String const& value)
+{
+    Application::storage_jar().set_item(origin, key, value);
+}
+
+void WebContentClient::did_remove_local_storage_item(String const& origin, String const& key)
+{
+    Application::storage_jar().remove_item(origin, key);
+}
+
+void WebContentClient::did_clear_local_storage(String const& origin)
+{
+    Application::storage_jar().clear(origin);
+}
+
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab const& activate_tab, Web::HTML::WebViewHints const& hints, Optional<u64> const& page_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -35,9 +35,13 @@ public:
 
     static size_t client_count() { return s_clients.size(); }
 
+    explicit WebContentClient(NonnullOwnPtr<Core::LocalSocket>);
     WebContentClient(NonnullOwnPtr<Core::LocalSocket>, ViewImplementation&);
     ~WebContentClient();
 
+    // Hands a process that was launched ahead of time, before there was a view for it, to its first view.
+    void assign_initial_view(ViewImplementation&);
+
     void register_view(u64 page_id, ViewImplementation&);
     void unregister_view(u64 page_id);
 
@@ -79,8 +83,10 @@ private:
     virtual void did_get_dom_node_html(u64 page_id, String const& html) override;
     virtual void did_take_screenshot(u64 page_id, Gfx::ShareableBitmap const& screenshot) override;
     virtual void did_get_internal_page_info(u64 page_id, PageInfoType, String const&) override;
+    virtual void did_report_memory_usage(MemoryUsage const&) override;
     virtual void did_output_js_console_message(u64 page_id, i32 message_index) override;
     virtual void did_get_js_console_messages(u64 page_id, i32 start_index, Vector<ByteString> const& message_types, Vector<ByteString> const& messages) override;
+    virtual void did_finish_js_profile(u64 page_id, String const& label, ByteString const& profile) override;
     virtual void did_change_favicon(u64 page_id, Gfx::ShareableBitmap const&) override;
     virtual void did_request_alert(u64 page_id, String const&) override;
     virtual void did_request_confirm(u64 page_id, String const&) override;
@@ -93,6 +99,10 @@ private:
     virtual Messages::WebContentClient::DidRequestCookieResponse did_request_cookie(URL::URL const&, Web::Cookie::Source) override;
     virtual void did_set_cookie(URL::URL const&, Web::Cookie::ParsedCookie const&, Web::Cookie::Source) override;
     virtual void did_update_cookie(Web::Cookie::Cookie const&) override;
+    virtual Messages::WebContentClient::DidRequestLocalStorageItemsResponse did_request_local_storage_items(String const&) override;
+    virtual void did_set_local_storage_item(String const&, String const&, String const&) override;
+    virtual void did_remove_local_storage_item(String const&, String const&) override;
+    virtual void did_clear_local_storage(String const&) override;
     virtual Messages::WebContentClient::DidRequestNewWebViewResponse did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab const&, Web::HTML::WebViewHints const&, Optional<u64> const& page_index) override;
     virtual void did_request_activate_tab(u64 page_id) override;
     virtual void did_close_browsing_context(u64 page_id) override;
@@ -149,12 +149,21 @@ void Parser::enter_node(Node& node)
 
 void Parser::leave_node()
 {
+    auto* node = m_entered_node;
+    m_entered_node = node->parent;
+
     if (m_listener) {
-        auto& element = m_entered_node->content.get<Node::Element>();
+        auto& element = node->content.get<Node::Element>();
         m_listener->element_end(element.name);
-    }
 
-    m_entered_node = m_entered_node->parent;
+        // Nothing gets to look at the tree when parsing with a listener, so drop elements as soon as they're closed.
+        // This keeps the memory we need bounded by the nesting depth of the document, rather than by its size.
+        if (m_entered_node) {
+            auto& parent_element = m_entered_node->content.get<Node::Element>();
+            VERIFY(parent_element.children.last().ptr() == node);
+            parent_element.children.take_last();
+        }
+    }
 }
 
 ErrorOr<Document, ParseError> Parser::parse()
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/Debug.h>
 #include <AK/IDAllocator.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefCounted.h>
@@ -15,6 +16,8 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DNSResolver.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <curl/curl.h>
 #include <netdb.h>
@@ -22,9 +25,126 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+OwnPtr<DiskCache> g_disk_cache;
+bool g_enable_http3 = false;
+ByteString g_dns_over_https_url;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 
+// NOTE: All clients share a single multi handle, so that connections, and the HTTP/2 streams multiplexed on them, are
+//       pooled across every WebContent process. TLS sessions and DNS lookups are shared through the share handle.
+static CURLM* s_curl_multi { nullptr };
+static CURLSH* s_curl_share { nullptr };
+static RefPtr<Core::Timer> s_timer;
+static HashMap<int, NonnullRefPtr<Core::Notifier>> s_read_notifiers;
+static HashMap<int, NonnullRefPtr<Core::Notifier>> s_write_notifiers;
+
+// Browsers commonly limit themselves to six connections per host.
+static constexpr long max_connections_per_host = 6;
+
+struct ConnectionStatistics {
+    u64 finished_requests { 0 };
+    u64 requests_on_reused_connections { 0 };
+    u64 multiplexed_requests { 0 };
+    u64 tls_handshakes { 0 };
+    u64 total_tls_handshake_time_in_microseconds { 0 };
+};
+static ConnectionStatistics s_connection_statistics;
+
+static void record_connection_statistics(CURL* easy)
+{
+    auto& statistics = s_connection_statistics;
+    ++statistics.finished_requests;
+
+    long new_connections = 0;
+    if (curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &new_connections) == CURLE_OK && new_connections == 0)
+        ++statistics.requests_on_reused_connections;
+
+    long http_version = 0;
+    if (curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &http_version) == CURLE_OK && (http_version == CURL_HTTP_VERSION_2_0 || http_version == CURL_HTTP_VERSION_3))
+        ++statistics.multiplexed_requests;
+
+    // Both times are measured from the start of the transfer, and the TLS handshake happens between them.
+    curl_off_t connect_time = 0;
+    curl_off_t tls_connect_time = 0;
+    if (new_connections > 0
+        && curl_easy_getinfo(easy, CURLINFO_CONNECT_TIME_T, &connect_time) == CURLE_OK
+        && curl_easy_getinfo(easy, CURLINFO_APPCONNECT_TIME_T, &tls_connect_time) == CURLE_OK
+        && tls_connect_time > connect_time) {
+        ++statistics.tls_handshakes;
+        statistics.total_tls_handshake_time_in_microseconds += tls_connect_time - connect_time;
+    }
+
+    dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: {} requests, {} on reused connections, {} multiplexed, {} TLS handshakes averaging {}us",
+        statistics.finished_requests,
+        statistics.requests_on_reused_connections,
+        statistics.multiplexed_requests,
+        statistics.tls_handshakes,
+        statistics.tls_handshakes == 0 ? 0 : statistics.total_tls_handshake_time_in_microseconds / statistics.tls_handshakes);
+}
+
+// Requests that haven't been handed to curl yet, most urgent first, and in the order they were started within that.
+struct QueuedRequest {
+    WeakPtr<ConnectionFromClient> client;
+    i32 request_id { 0 };
+    Requests::RequestPriority priority { Requests::RequestPriority::Normal };
+    u64 sequence_number { 0 };
+};
+static Vector<QueuedRequest> s_queued_requests;
+static u64 s_next_sequence_number { 0 };
+static bool s_has_pending_dispatch { false };
+
+// Requests that curl is working on. Render-blocking requests are always dispatched right away, and while any of them
+// are in flight, only a few of the requests that nothing is waiting on are let through, so that they don't compete
+// for bandwidth.
+static HashMap<ByteString, size_t> s_dispatched_requests_per_host;
+static size_t s_dispatched_render_blocking_requests { 0 };
+static size_t s_dispatched_delayable_requests { 0 };
+
+static constexpr size_t max_dispatched_requests_per_host = 6;
+static constexpr size_t max_delayable_requests_while_render_blocking = 2;
+
+static bool is_delayable(Requests::RequestPriority priority)
+{
+    return priority == Requests::RequestPriority::Low || priority == Requests::RequestPriority::Lowest;
+}
+
+// https://www.rfc-editor.org/rfc/rfc9218.html#name-urgency
+static u8 urgency_for_priority(Requests::RequestPriority priority)
+{
+    switch (priority) {
+    case Requests::RequestPriority::Highest:
+        return 0;
+    case Requests::RequestPriority::High:
+        return 1;
+    case Requests::RequestPriority::Normal:
+        return 3;
+    case Requests::RequestPriority::Low:
+        return 5;
+    case Requests::RequestPriority::Lowest:
+        return 7;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// For servers that still go by the HTTP/2 priority scheme, which curl expresses as stream weights between 1 and 256.
+static long stream_weight_for_priority(Requests::RequestPriority priority)
+{
+    switch (priority) {
+    case Requests::RequestPriority::Highest:
+        return 256;
+    case Requests::RequestPriority::High:
+        return 220;
+    case Requests::RequestPriority::Normal:
+        return 183;
+    case Requests::RequestPriority::Low:
+        return 147;
+    case Requests::RequestPriority::Lowest:
+        return 110;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 struct ConnectionFromClient::ActiveRequest {
     CURLM* multi { nullptr };
     CURL* easy { nullptr };
@@ -38,6 +158,28 @@ struct ConnectionFromClient::ActiveRequest {
     String url;
     ByteBuffer body;
 
+    ByteString method;
+    URL::URL request_url;
+    HTTP::HeaderMap request_headers;
+    UnixDateTime request_time;
+
+    // When we received the request, and when we handed it to curl, which measures its own timings from then on.
+    MonotonicTime start_time { MonotonicTime::now() };
+    Optional<MonotonicTime> dispatch_time;
+
+    // The stale response that we asked the origin server to validate, which we serve if it answers 304 Not Modified.
+    Optional<DiskCache::CachedResponse> response_being_revalidated;
+
+    bool is_storing_in_disk_cache { false };
+    ByteBuffer body_for_disk_cache;
+
+    Requests::RequestPriority priority { Requests::RequestPriority::Normal };
+    ByteString host;
+    u64 sequence_number { 0 };
+    bool is_dispatched { false };
+
+    struct curl_slist* resolve_list { nullptr };
+
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
         , easy(easy)
@@ -49,10 +191,55 @@ struct ConnectionFromClient::ActiveRequest {
 
     ~ActiveRequest()
     {
-        MUST(Core::System::close(writer_fd));
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
+        if (writer_fd != -1)
+            MUST(Core::System::close(writer_fd));
+        if (is_dispatched) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+            did_leave_network();
+        }
         curl_easy_cleanup(easy);
+        curl_slist_free_all(resolve_list);
+    }
+
+    bool can_be_dispatched() const
+    {
+        if (priority == Requests::RequestPriority::Highest)
+            return true;
+        if (s_dispatched_requests_per_host.get(host).value_or(0) >= max_dispatched_requests_per_host)
+            return false;
+        if (is_delayable(priority) && s_dispatched_render_blocking_requests > 0 && s_dispatched_delayable_requests >= max_delayable_requests_while_render_blocking)
+            return false;
+        return true;
+    }
+
+    void dispatch()
+    {
+        VERIFY(!is_dispatched);
+        is_dispatched = true;
+        dispatch_time = MonotonicTime::now();
+
+        s_dispatched_requests_per_host.ensure(host, [] { return 0; })++;
+        if (priority == Requests::RequestPriority::Highest)
+            ++s_dispatched_render_blocking_requests;
+        else if (is_delayable(priority))
+            ++s_dispatched_delayable_requests;
+
+        auto result = curl_multi_add_handle(multi, easy);
+        VERIFY(result == CURLM_OK);
+    }
+
+    void did_leave_network()
+    {
+        if (auto it = s_dispatched_requests_per_host.find(host); it != s_dispatched_requests_per_host.end() && --it->value == 0)
+            s_dispatched_requests_per_host.remove(it);
+        if (priority == Requests::RequestPriority::Highest)
+            --s_dispatched_render_blocking_requests;
+        else if (is_delayable(priority))
+            --s_dispatched_delayable_requests;
+
+        // NOTE: We may be getting destroyed while our client's request map is being modified, so don't touch it now.
+        ConnectionFromClient::schedule_dispatch_of_queued_requests();
     }
 
     void flush_headers_if_needed()
@@ -64,6 +251,37 @@ struct ConnectionFromClient::ActiveRequest {
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
         client->async_headers_became_available(request_id, headers, http_status_code);
+
+        if (g_disk_cache && DiskCache::is_storable(method, request_headers, http_status_code, headers))
+            is_storing_in_disk_cache = true;
+    }
+
+    void append_to_body_for_disk_cache(ReadonlyBytes data)
+    {
+        if (!is_storing_in_disk_cache)
+            return;
+
+        if (body_for_disk_cache.size() + data.size() > g_disk_cache->maximum_entry_size() || body_for_disk_cache.try_append(data).is_error()) {
+            is_storing_in_disk_cache = false;
+            body_for_disk_cache.clear();
+        }
+    }
+};
+
+struct ConnectionFromClient::CachedResponseWriter {
+    i32 request_id { 0 };
+    int writer_fd { -1 };
+    ByteBuffer body;
+    size_t written_so_far { 0 };
+    RefPtr<Core::Notifier> notifier;
+    MonotonicTime start_time;
+    Requests::RequestTimingInfo timing_info;
+
+    ~CachedResponseWriter()
+    {
+        if (notifier)
+            notifier->set_enabled(false);
+        MUST(Core::System::close(writer_fd));
     }
 };
 
@@ -108,6 +326,8 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
         remaining_length -= nwritten;
     }
 
+    request->append_to_body_for_disk_cache({ buffer, total_size });
+
     Optional<u64> content_length_for_ipc;
     curl_off_t content_length = -1;
     auto res = curl_easy_getinfo(request->easy, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &content_length);
@@ -120,24 +340,22 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     return total_size;
 }
 
-int ConnectionFromClient::on_socket_callback(CURL*, int sockfd, int what, void* user_data, void*)
+int ConnectionFromClient::on_socket_callback(CURL*, int sockfd, int what, void*, void*)
 {
-    auto* client = static_cast<ConnectionFromClient*>(user_data);
-
     if (what == CURL_POLL_REMOVE) {
-        client->m_read_notifiers.remove(sockfd);
-        client->m_write_notifiers.remove(sockfd);
+        s_read_notifiers.remove(sockfd);
+        s_write_notifiers.remove(sockfd);
         return 0;
     }
 
     if (what & CURL_POLL_IN) {
-        client->m_read_notifiers.ensure(sockfd, [client, sockfd, multi = client->m_curl_multi] {
+        s_read_notifiers.ensure(sockfd, [sockfd] {
             auto notifier = Core::Notifier::construct(sockfd, Core::NotificationType::Read);
-            notifier->on_activation = [client, sockfd, multi] {
+            notifier->on_activation = [sockfd] {
                 int still_running = 0;
-                auto result = curl_multi_socket_action(multi, sockfd, CURL_CSELECT_IN, &still_running);
+                auto result = curl_multi_socket_action(s_curl_multi, sockfd, CURL_CSELECT_IN, &still_running);
                 VERIFY(result == CURLM_OK);
-                client->check_active_requests();
+                check_active_requests();
             };
             notifier->set_enabled(true);
             return notifier;
@@ -145,13 +363,13 @@ int ConnectionFromClient::on_socket_callback(CURL*, int sockfd, int what, void*
     }
 
     if (what & CURL_POLL_OUT) {
-        client->m_write_notifiers.ensure(sockfd, [client, sockfd, multi = client->m_curl_multi] {
+        s_write_notifiers.ensure(sockfd, [sockfd] {
             auto notifier = Core::Notifier::construct(sockfd, Core::NotificationType::Write);
-            notifier->on_activation = [client, sockfd, multi] {
+            notifier->on_activation = [sockfd] {
                 int still_running = 0;
-                auto result = curl_multi_socket_action(multi, sockfd, CURL_CSELECT_OUT, &still_running);
+                auto result = curl_multi_socket_action(s_curl_multi, sockfd, CURL_CSELECT_OUT, &still_running);
                 VERIFY(result == CURLM_OK);
-                client->check_active_requests();
+                check_active_requests();
             };
             notifier->set_enabled(true);
             return notifier;
@@ -161,43 +379,62 @@ int ConnectionFromClient::on_socket_callback(CURL*, int sockfd, int what, void*
     return 0;
 }
 
-int ConnectionFromClient::on_timeout_callback(void*, long timeout_ms, void* user_data)
+int ConnectionFromClient::on_timeout_callback(void*, long timeout_ms, void*)
 {
-    auto* client = static_cast<ConnectionFromClient*>(user_data);
-    if (!client->m_timer)
+    if (!s_timer)
         return 0;
     if (timeout_ms < 0) {
-        client->m_timer->stop();
+        s_timer->stop();
     } else {
-        client->m_timer->restart(timeout_ms);
+        s_timer->restart(timeout_ms);
     }
     return 0;
 }
 
-ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::LocalSocket> socket)
-    : IPC::ConnectionFromClient<RequestClientEndpoint, RequestServerEndpoint>(*this, move(socket), s_client_ids.allocate())
+void ConnectionFromClient::initialize_curl_if_needed()
 {
-    s_connections.set(client_id(), *this);
+    if (s_curl_multi)
+        return;
 
-    m_curl_multi = curl_multi_init();
+    s_curl_multi = curl_multi_init();
 
-    auto set_option = [this](auto option, auto value) {
-        auto result = curl_multi_setopt(m_curl_multi, option, value);
+    auto set_option = [](auto option, auto value) {
+        auto result = curl_multi_setopt(s_curl_multi, option, value);
         VERIFY(result == CURLM_OK);
     };
     set_option(CURLMOPT_SOCKETFUNCTION, &on_socket_callback);
-    set_option(CURLMOPT_SOCKETDATA, this);
     set_option(CURLMOPT_TIMERFUNCTION, &on_timeout_callback);
-    set_option(CURLMOPT_TIMERDATA, this);
+    set_option(CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    set_option(CURLMOPT_MAX_HOST_CONNECTIONS, max_connections_per_host);
+
+    // NOTE: We only ever use curl from the main thread, so the share handle doesn't need any locking callbacks.
+    s_curl_share = curl_share_init();
+    for (auto data : { CURL_LOCK_DATA_SSL_SESSION, CURL_LOCK_DATA_DNS }) {
+        auto result = curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, data);
+        VERIFY(result == CURLSHE_OK);
+    }
 
-    m_timer = Core::Timer::create_single_shot(0, [this] {
+    if (g_enable_http3 && !(curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP3)) {
+        dbgln("RequestServer: HTTP/3 was requested, but curl was built without support for it");
+        g_enable_http3 = false;
+    }
+
+    s_timer = Core::Timer::create_single_shot(0, [] {
         int still_running = 0;
-        auto result = curl_multi_socket_action(m_curl_multi, CURL_SOCKET_TIMEOUT, 0, &still_running);
+        auto result = curl_multi_socket_action(s_curl_multi, CURL_SOCKET_TIMEOUT, 0, &still_running);
         VERIFY(result == CURLM_OK);
         check_active_requests();
     });
 }
 
+ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::LocalSocket> socket)
+    : IPC::ConnectionFromClient<RequestClientEndpoint, RequestServerEndpoint>(*this, move(socket), s_client_ids.allocate())
+{
+    s_connections.set(client_id(), *this);
+
+    initialize_curl_if_needed();
+}
+
 ConnectionFromClient::~ConnectionFromClient()
 {
 }
@@ -239,11 +476,13 @@ Messages::RequestServer::IsSupportedProtocolResponse ConnectionFromClient::is_su
     return protocol == "http"sv || protocol == "https"sv;
 }
 
-void ConnectionFromClient::start_request(i32 request_id, ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ByteBuffer const& request_body, Core::ProxyData const& proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ByteBuffer const& request_body, Core::ProxyData const& proxy_data, Requests::RequestPriority priority)
 {
+    auto start_time = MonotonicTime::now();
+
     if (!url.is_valid()) {
         dbgln("StartRequest: Invalid URL requested: '{}'", url);
-        async_request_finished(request_id, false, 0);
+        async_request_finished(request_id, false, 0, {});
         return;
     }
 
@@ -262,10 +501,34 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString const& metho
     auto fds = fds_or_error.release_value();
     auto writer_fd = fds[1];
     auto reader_fd = fds[0];
+
+#if defined(AK_OS_LINUX)
+    // A bigger pipe lets us hand over more of the body per wakeup of the client, and makes it less likely for
+    // on_data_received() to have to wait for the client to drain it. Failing to grow it is harmless.
+    (void)Core::System::fcntl(writer_fd, F_SETPIPE_SZ, 1 * MiB);
+#endif
     async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
 
-    auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
+    Optional<DiskCache::CachedResponse> cached_response;
+    if (g_disk_cache && method == "GET"sv)
+        cached_response = g_disk_cache->open_entry(url, request_headers);
+
+    if (cached_response.has_value() && !cached_response->needs_revalidation) {
+        curl_easy_cleanup(easy);
+        send_cached_response(request_id, writer_fd, cached_response.release_value(), start_time);
+        return;
+    }
+
+    auto request = make<ActiveRequest>(*this, s_curl_multi, easy, request_id, writer_fd);
     request->url = url.to_string().value();
+    request->method = method;
+    request->request_url = url;
+    request->request_headers = request_headers;
+    request->request_time = UnixDateTime::now();
+    request->start_time = start_time;
+    request->priority = priority;
+    request->host = url.serialized_host().release_value_but_fixme_should_propagate_errors().to_byte_string();
+    request->sequence_number = s_next_sequence_number++;
 
     auto set_option = [easy](auto option, auto value) {
         auto result = curl_easy_setopt(easy, option, value);
@@ -277,10 +540,25 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString const& metho
     };
 
     set_option(CURLOPT_PRIVATE, request.ptr());
+    set_option(CURLOPT_SHARE, s_curl_share);
+
+    // Prefer waiting for a connection that we can multiplex this request on over opening a new one.
+    set_option(CURLOPT_PIPEWAIT, 1L);
+    if (!g_enable_http3 || !set_option(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_3))
+        set_option(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
 
     if (!g_default_certificate_path.is_empty())
         set_option(CURLOPT_CAINFO, g_default_certificate_path.characters());
 
+    // Keep curl's view of a host in line with our own resolver cache, and let it skip the lookup if we have an answer.
+    set_option(CURLOPT_DNS_CACHE_TIMEOUT, 60L);
+    if (!g_dns_over_https_url.is_empty()) {
+        set_option(CURLOPT_DOH_URL, g_dns_over_https_url.characters());
+    } else if (auto resolve_entry = DNSResolver::the().curl_resolve_entry(request->host, url.port_or_default()); resolve_entry.has_value()) {
+        request->resolve_list = curl_slist_append(nullptr, resolve_entry->characters());
+        set_option(CURLOPT_RESOLVE, request->resolve_list);
+    }
+
     set_option(CURLOPT_ACCEPT_ENCODING, "gzip, deflate, br");
     set_option(CURLOPT_URL, url.to_string().value().to_byte_string().characters());
     set_option(CURLOPT_PORT, url.port_or_default());
@@ -303,7 +581,29 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString const& metho
         auto header_string = ByteString::formatted("{}: {}", header.name, header.value);
         curl_headers = curl_slist_append(curl_headers, header_string.characters());
     }
+
+    // If the client didn't make the request conditional itself, ask the origin server whether our copy is still good.
+    // https://httpwg.org/specs/rfc9111.html#validation.sent
+    if (cached_response.has_value() && !request_headers.contains("If-None-Match"sv) && !request_headers.contains("If-Modified-Since"sv)) {
+        if (cached_response->entity_tag.has_value()) {
+            auto header_string = ByteString::formatted("If-None-Match: {}", *cached_response->entity_tag);
+            curl_headers = curl_slist_append(curl_headers, header_string.characters());
+        }
+        if (cached_response->last_modified.has_value()) {
+            auto header_string = ByteString::formatted("If-Modified-Since: {}", *cached_response->last_modified);
+            curl_headers = curl_slist_append(curl_headers, header_string.characters());
+        }
+        if (cached_response->entity_tag.has_value() || cached_response->last_modified.has_value())
+            request->response_being_revalidated = cached_response.release_value();
+    }
+
+    if (!request_headers.contains("Priority"sv)) {
+        // Images and media are usable as they arrive, so they can share bandwidth with others of the same urgency.
+        auto header_string = ByteString::formatted("Priority: u={}{}", urgency_for_priority(priority), is_delayable(priority) ? ", i"sv : ""sv);
+        curl_headers = curl_slist_append(curl_headers, header_string.characters());
+    }
     set_option(CURLOPT_HTTPHEADER, curl_headers);
+    set_option(CURLOPT_STREAM_WEIGHT, stream_weight_for_priority(priority));
 
     // FIXME: Set up proxy if applicable
     (void)proxy_data;
@@ -314,32 +614,234 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString const& metho
     set_option(CURLOPT_HEADERFUNCTION, &on_header_received);
     set_option(CURLOPT_HEADERDATA, reinterpret_cast<void*>(request.ptr()));
 
-    auto result = curl_multi_add_handle(m_curl_multi, easy);
-    VERIFY(result == CURLM_OK);
+    QueuedRequest queued_request { *this, request_id, priority, request->sequence_number };
+    auto insertion_index = s_queued_requests.find_first_index_if([&](auto const& other) { return other.priority > priority; });
+    s_queued_requests.insert(insertion_index.value_or(s_queued_requests.size()), move(queued_request));
 
     m_active_requests.set(request_id, move(request));
+    dispatch_queued_requests();
+}
+
+void ConnectionFromClient::schedule_dispatch_of_queued_requests()
+{
+    if (s_has_pending_dispatch)
+        return;
+    s_has_pending_dispatch = true;
+
+    Core::deferred_invoke([] {
+        s_has_pending_dispatch = false;
+        dispatch_queued_requests();
+    });
+}
+
+void ConnectionFromClient::dispatch_queued_requests()
+{
+    for (size_t i = 0; i < s_queued_requests.size();) {
+        auto const& queued_request = s_queued_requests[i];
+
+        // Requests that were stopped, or whose client went away, are dropped from the queue here.
+        ActiveRequest* request = nullptr;
+        if (auto client = queued_request.client.strong_ref()) {
+            if (auto active_request = client->m_active_requests.get(queued_request.request_id); active_request.has_value())
+                request = active_request.value();
+        }
+        if (!request || request->is_dispatched || request->sequence_number != queued_request.sequence_number) {
+            s_queued_requests.remove(i);
+            continue;
+        }
+
+        if (!request->can_be_dispatched()) {
+            ++i;
+            continue;
+        }
+
+        s_queued_requests.remove(i);
+        request->dispatch();
+    }
+}
+
+static StringView alpn_protocol_for_http_version(long http_version)
+{
+    switch (http_version) {
+    case CURL_HTTP_VERSION_1_0:
+        return "http/1.0"sv;
+    case CURL_HTTP_VERSION_1_1:
+        return "http/1.1"sv;
+    case CURL_HTTP_VERSION_2_0:
+        return "h2"sv;
+    case CURL_HTTP_VERSION_3:
+        return "h3"sv;
+    default:
+        return {};
+    }
+}
+
+Requests::RequestTimingInfo ConnectionFromClient::timing_info_for_request(ActiveRequest const& request)
+{
+    Requests::RequestTimingInfo timing_info;
+    if (!request.dispatch_time.has_value())
+        return timing_info;
+
+    // NOTE: curl measures everything from when the transfer started, which is when we dispatched the request. Anything
+    //       before that was spent waiting in our queue.
+    auto queued_microseconds = (*request.dispatch_time - request.start_time).to_microseconds();
+    auto get_time = [&](CURLINFO info) -> i64 {
+        curl_off_t time = 0;
+        if (curl_easy_getinfo(request.easy, info, &time) != CURLE_OK || time == 0)
+            return 0;
+        return queued_microseconds + time;
+    };
+
+    long new_connections = 0;
+    if (curl_easy_getinfo(request.easy, CURLINFO_NUM_CONNECTS, &new_connections) == CURLE_OK && new_connections > 0) {
+        timing_info.domain_lookup_start_microseconds = queued_microseconds;
+        timing_info.domain_lookup_end_microseconds = get_time(CURLINFO_NAMELOOKUP_TIME_T);
+        timing_info.connect_start_microseconds = timing_info.domain_lookup_end_microseconds;
+        timing_info.connect_end_microseconds = get_time(CURLINFO_CONNECT_TIME_T);
+
+        // The TLS handshake starts once the TCP connection is up, and the connection is ready once it's done.
+        if (auto tls_connect_end = get_time(CURLINFO_APPCONNECT_TIME_T); tls_connect_end != 0) {
+            timing_info.secure_connect_start_microseconds = timing_info.connect_end_microseconds;
+            timing_info.connect_end_microseconds = tls_connect_end;
+        }
+    } else {
+        timing_info.connection_reused = true;
+    }
+
+    timing_info.request_start_microseconds = get_time(CURLINFO_PRETRANSFER_TIME_T);
+    timing_info.response_start_microseconds = get_time(CURLINFO_STARTTRANSFER_TIME_T);
+    timing_info.response_end_microseconds = get_time(CURLINFO_TOTAL_TIME_T);
+
+    curl_off_t encoded_body_size = 0;
+    if (curl_easy_getinfo(request.easy, CURLINFO_SIZE_DOWNLOAD_T, &encoded_body_size) == CURLE_OK)
+        timing_info.encoded_body_size = encoded_body_size;
+
+    long http_version = 0;
+    if (curl_easy_getinfo(request.easy, CURLINFO_HTTP_VERSION, &http_version) == CURLE_OK)
+        timing_info.alpn_negotiated_protocol = alpn_protocol_for_http_version(http_version);
+
+    return timing_info;
 }
 
 void ConnectionFromClient::check_active_requests()
 {
     int msgs_in_queue = 0;
-    while (auto* msg = curl_multi_info_read(m_curl_multi, &msgs_in_queue)) {
+    while (auto* msg = curl_multi_info_read(s_curl_multi, &msgs_in_queue)) {
         if (msg->msg != CURLMSG_DONE)
             continue;
 
         ActiveRequest* request = nullptr;
         auto result = curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &request);
         VERIFY(result == CURLE_OK);
+
+        // NOTE: Requests are owned by their client, so the client is guaranteed to still be around.
+        auto& client = *request->client;
+
+        record_connection_statistics(msg->easy_handle);
+
+        if (request->response_being_revalidated.has_value() && msg->data.result == CURLE_OK) {
+            long http_status_code = 0;
+            result = curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &http_status_code);
+            VERIFY(result == CURLE_OK);
+
+            if (http_status_code == 304) {
+                g_disk_cache->update_after_revalidation(request->request_url, request->headers, request->request_time, UnixDateTime::now());
+
+                auto cached_response = g_disk_cache->open_entry(request->request_url, request->request_headers);
+                if (!cached_response.has_value())
+                    cached_response = request->response_being_revalidated.release_value();
+
+                client.send_cached_response(request->request_id, exchange(request->writer_fd, -1), cached_response.release_value(), request->start_time, timing_info_for_request(*request));
+                client.m_active_requests.remove(request->request_id);
+                continue;
+            }
+        }
+
         request->flush_headers_if_needed();
 
-        async_request_finished(request->request_id, msg->data.result == CURLE_OK, request->downloaded_so_far);
+        if (request->is_storing_in_disk_cache && msg->data.result == CURLE_OK) {
+            long http_status_code = 0;
+            result = curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &http_status_code);
+            VERIFY(result == CURLE_OK);
+            g_disk_cache->store(request->request_url, request->request_headers, http_status_code, request->headers, request->body_for_disk_cache, request->request_time, UnixDateTime::now());
+        }
+
+        client.async_request_finished(request->request_id, msg->data.result == CURLE_OK, request->downloaded_so_far, timing_info_for_request(*request));
+
+        client.m_active_requests.remove(request->request_id);
+    }
+}
+
+void ConnectionFromClient::send_cached_response(i32 request_id, int writer_fd, DiskCache::CachedResponse response, MonotonicTime start_time, Requests::RequestTimingInfo timing_info)
+{
+    // NOTE: A response that was revalidated with the origin server keeps the timings of that exchange, otherwise the
+    //       response starts now.
+    if (timing_info.response_start_microseconds == 0)
+        timing_info.response_start_microseconds = (MonotonicTime::now() - start_time).to_microseconds();
+
+    async_headers_became_available(request_id, response.headers, response.status_code);
+
+    auto writer = make<CachedResponseWriter>();
+    writer->request_id = request_id;
+    writer->writer_fd = writer_fd;
+    writer->body = move(response.body);
+    writer->start_time = start_time;
+    writer->timing_info = move(timing_info);
+
+    // NOTE: Unlike with network data, we can produce the body faster than the client consumes it, so instead of
+    //       spinning on a full pipe, we wait until it can take more.
+    writer->notifier = Core::Notifier::construct(writer_fd, Core::NotificationType::Write);
+    writer->notifier->on_activation = [this, request_id] {
+        continue_sending_cached_response(request_id);
+    };
+    writer->notifier->set_enabled(false);
+
+    m_cached_response_writers.set(request_id, move(writer));
+    continue_sending_cached_response(request_id);
+}
 
-        m_active_requests.remove(request->request_id);
+void ConnectionFromClient::continue_sending_cached_response(i32 request_id)
+{
+    auto maybe_writer = m_cached_response_writers.get(request_id);
+    if (!maybe_writer.has_value())
+        return;
+    auto& writer = *maybe_writer.value();
+
+    auto finish = [&](bool success) {
+        writer.notifier->set_enabled(false);
+
+        writer.timing_info.response_end_microseconds = (MonotonicTime::now() - writer.start_time).to_microseconds();
+        writer.timing_info.encoded_body_size = writer.written_so_far;
+        async_request_finished(request_id, success, writer.written_so_far, writer.timing_info);
+
+        // NOTE: We may be inside the notifier's activation, so it must outlive this function.
+        Core::deferred_invoke([this, request_id, protector = NonnullRefPtr { *this }] {
+            m_cached_response_writers.remove(request_id);
+        });
+    };
+
+    while (writer.written_so_far < writer.body.size()) {
+        auto result = Core::System::write(writer.writer_fd, writer.body.bytes().slice(writer.written_so_far));
+        if (result.is_error()) {
+            if (result.error().code() == EAGAIN) {
+                writer.notifier->set_enabled(true);
+                return;
+            }
+            dbgln("continue_sending_cached_response: write failed: {}", result.error());
+            finish(false);
+            return;
+        }
+        writer.written_so_far += result.value();
     }
+
+    finish(true);
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
 {
+    if (m_cached_response_writers.remove(request_id))
+        return true;
+
     auto request = m_active_requests.take(request_id);
     if (!request.has_value()) {
         dbgln("StopRequest: Request ID {} not found", request_id);
@@ -381,8 +883,14 @@ void ConnectionFromClient::ensure_connection(URL::URL const& url, ::RequestServe
         return;
     }
 
-    (void)cache_level;
-    dbgln("FIXME: EnsureConnection: Pre-connect to {}", url);
+    // With DNS-over-HTTPS, curl does every lookup itself, and asking the system resolver would leak the host name.
+    if (g_dns_over_https_url.is_empty()) {
+        auto host = url.serialized_host().release_value_but_fixme_should_propagate_errors().to_byte_string();
+        DNSResolver::the().prefetch(host);
+    }
+
+    if (cache_level == CacheLevel::CreateConnection)
+        dbgln("FIXME: EnsureConnection: Pre-connect to {}", url);
 }
 
 void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL const& url, ByteString const& origin, Vector<ByteString> const& protocols, Vector<ByteString> const& extensions, HTTP::HeaderMap const& additional_request_headers)
@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/Forward.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
@@ -34,7 +35,7 @@ private:
 
     virtual Messages::RequestServer::ConnectNewClientResponse connect_new_client() override;
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString const&) override;
-    virtual void start_request(i32 request_id, ByteString const&, URL::URL const&, HTTP::HeaderMap const&, ByteBuffer const&, Core::ProxyData const&) override;
+    virtual void start_request(i32 request_id, ByteString const&, URL::URL const&, HTTP::HeaderMap const&, ByteBuffer const&, Core::ProxyData const&, Requests::RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString const&, ByteString const&) override;
     virtual void ensure_connection(URL::URL const& url, ::RequestServer::CacheLevel const& cache_level) override;
@@ -56,11 +57,17 @@ private:
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
-    void check_active_requests();
-    void* m_curl_multi { nullptr };
-    RefPtr<Core::Timer> m_timer;
-    HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
-    HashMap<int, NonnullRefPtr<Core::Notifier>> m_write_notifiers;
+    struct CachedResponseWriter;
+    void send_cached_response(i32 request_id, int writer_fd, DiskCache::CachedResponse, MonotonicTime start_time, Requests::RequestTimingInfo = {});
+    void continue_sending_cached_response(i32 request_id);
+    HashMap<i32, NonnullOwnPtr<CachedResponseWriter>> m_cached_response_writers;
+
+    static Requests::RequestTimingInfo timing_info_for_request(ActiveRequest const&);
+
+    static void initialize_curl_if_needed();
+    static void check_active_requests();
+    static void dispatch_queued_requests();
+    static void schedule_dispatch_of_queued_requests();
 };
 
 }
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/HashTable.h>
+#include <AK/IPv4Address.h>
+#include <AK/IPv6Address.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/EventLoop.h>
+#include <LibThreading/Thread.h>
+#include <RequestServer/DNSResolver.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+namespace RequestServer {
+
+// getaddrinfo() doesn't tell us the TTL of the records, so we keep answers for as long as curl would by default.
+static constexpr auto positive_entry_lifetime = AK::Duration::from_seconds(60);
+static constexpr auto negative_entry_lifetime = AK::Duration::from_seconds(10);
+
+// Keep a few lookups in flight at once, so that a single unresponsive name server doesn't stall the rest.
+static constexpr size_t max_running_lookups = 4;
+static constexpr size_t max_entries = 512;
+
+DNSResolver& DNSResolver::the()
+{
+    static DNSResolver s_the;
+    return s_the;
+}
+
+static bool is_ip_address_literal(ByteString const& host)
+{
+    if (IPv4Address::from_string(host).has_value())
+        return true;
+    return host.starts_with('[') || IPv6Address::from_string(host).has_value();
+}
+
+void DNSResolver::prefetch(ByteString const& host)
+{
+    if (host.is_empty() || is_ip_address_literal(host))
+        return;
+
+    if (auto entry = m_entries.get(host); entry.has_value() && entry->expiry > MonotonicTime::now())
+        return;
+
+    if (m_pending_lookups.set(host) != HashSetResult::InsertedNewEntry)
+        return;
+
+    if (m_running_lookup_count >= max_running_lookups) {
+        m_queued_lookups.enqueue(host);
+        return;
+    }
+    start_lookup(host);
+}
+
+Optional<Vector<ByteString> const&> DNSResolver::cached_addresses(ByteString const& host)
+{
+    auto entry = m_entries.find(host);
+    if (entry == m_entries.end())
+        return {};
+
+    if (entry->value.expiry <= MonotonicTime::now()) {
+        m_entries.remove(entry);
+        return {};
+    }
+
+    if (entry->value.addresses.is_empty())
+        return {};
+    return entry->value.addresses;
+}
+
+Optional<ByteString> DNSResolver::curl_resolve_entry(ByteString const& host, u16 port)
+{
+    auto addresses = cached_addresses(host);
+    if (!addresses.has_value())
+        return {};
+
+    // The leading '+' lets the entry time out of curl's own cache, rather than sticking around forever.
+    StringBuilder builder;
+    builder.appendff("+{}:{}:", host, port);
+    builder.join(',', *addresses);
+    return builder.to_byte_string();
+}
+
+void DNSResolver::start_lookup(ByteString host)
+{
+    ++m_running_lookup_count;
+
+    auto& event_loop = Core::EventLoop::current();
+    auto thread = Threading::Thread::construct([host, &event_loop]() -> intptr_t {
+        auto result = look_up_host(host);
+
+        event_loop.deferred_invoke([host, result = move(result)]() mutable {
+            DNSResolver::the().did_finish_lookup(host, move(result));
+        });
+        event_loop.wake();
+        return 0;
+    },
+        "DNS lookup"sv);
+
+    thread->start();
+    thread->detach();
+}
+
+void DNSResolver::did_finish_lookup(ByteString const& host, Optional<LookupResult> result)
+{
+    --m_running_lookup_count;
+    m_pending_lookups.remove(host);
+
+    // Transient failures aren't cached, so that the next request for the host gets to try again.
+    if (result.has_value()) {
+        if (m_entries.size() >= max_entries) {
+            auto now = MonotonicTime::now();
+            m_entries.remove_all_matching([&](auto const&, auto const& entry) { return entry.expiry <= now; });
+            if (m_entries.size() >= max_entries)
+                m_entries.clear();
+        }
+
+        auto lifetime = result->host_does_not_exist ? negative_entry_lifetime : positive_entry_lifetime;
+        dbgln_if(REQUESTSERVER_DEBUG, "DNSResolver: {} resolved to {} address(es)", host, result->addresses.size());
+        m_entries.set(host, { move(result->addresses), MonotonicTime::now() + lifetime });
+    }
+
+    while (m_running_lookup_count < max_running_lookups && !m_queued_lookups.is_empty())
+        start_lookup(m_queued_lookups.dequeue());
+}
+
+Optional<DNSResolver::LookupResult> DNSResolver::look_up_host(ByteString const& host)
+{
+    // Ask for both address families at once; the resolver sends the A and AAAA queries in parallel.
+    struct addrinfo hints {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_ADDRCONFIG;
+
+    struct addrinfo* results = nullptr;
+    auto rc = getaddrinfo(host.characters(), nullptr, &hints, &results);
+    if (rc != 0) {
+        dbgln_if(REQUESTSERVER_DEBUG, "DNSResolver: Failed to resolve {}: {}", host, gai_strerror(rc));
+        if (rc == EAI_NONAME)
+            return LookupResult { .addresses = {}, .host_does_not_exist = true };
+        return {};
+    }
+
+    LookupResult result;
+    HashTable<ByteString> seen_addresses;
+
+    for (auto* info = results; info; info = info->ai_next) {
+        ByteString address;
+        if (info->ai_family == AF_INET) {
+            auto const& socket_address = *reinterpret_cast<sockaddr_in const*>(info->ai_addr);
+            address = IPv4Address { reinterpret_cast<u8 const*>(&socket_address.sin_addr) }.to_byte_string();
+        } else if (info->ai_family == AF_INET6) {
+            auto const& socket_address = *reinterpret_cast<sockaddr_in6 const*>(info->ai_addr);
+            auto ipv6_address = IPv6Address { socket_address.sin6_addr.s6_addr }.to_string();
+            if (ipv6_address.is_error())
+                continue;
+            address = ByteString::formatted("[{}]", ipv6_address.value());
+        } else {
+            continue;
+        }
+
+        if (seen_addresses.set(address) == HashSetResult::InsertedNewEntry)
+            result.addresses.append(move(address));
+    }
+
+    freeaddrinfo(results);
+
+    if (result.addresses.is_empty())
+        return LookupResult { .addresses = {}, .host_does_not_exist = true };
+    return result;
+}
+
+}
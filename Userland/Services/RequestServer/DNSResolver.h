@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/Optional.h>
+#include <AK/Queue.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+
+namespace RequestServer {
+
+// A process-wide cache of host name lookups, which can be warmed ahead of the requests that will need them.
+//
+// Lookups run on their own threads, so that a slow name server never holds up the event loop or other lookups. The
+// results are handed to curl through CURLOPT_RESOLVE, which lets it start connecting (and racing IPv6 against IPv4,
+// as per RFC 8305) without waiting on a resolver of its own.
+class DNSResolver {
+public:
+    static DNSResolver& the();
+
+    // Starts looking up the host in the background, unless a fresh answer is cached or a lookup is already underway.
+    void prefetch(ByteString const& host);
+
+    // Returns the cached addresses of the host, if we have a fresh answer for it. IPv6 addresses are bracketed.
+    Optional<Vector<ByteString> const&> cached_addresses(ByteString const& host);
+
+    // Builds a CURLOPT_RESOLVE entry ("+host:port:address,...") from the cached answer for the host.
+    Optional<ByteString> curl_resolve_entry(ByteString const& host, u16 port);
+
+private:
+    DNSResolver() = default;
+
+    struct Entry {
+        // An empty list records that the host does not exist, so that we don't keep asking about it.
+        Vector<ByteString> addresses;
+        MonotonicTime expiry;
+    };
+
+    struct LookupResult {
+        Vector<ByteString> addresses;
+        bool host_does_not_exist { false };
+    };
+
+    void start_lookup(ByteString host);
+    void did_finish_lookup(ByteString const& host, Optional<LookupResult>);
+
+    static Optional<LookupResult> look_up_host(ByteString const& host);
+
+    HashMap<ByteString, Entry> m_entries;
+    HashTable<ByteString> m_pending_lookups;
+    Queue<ByteString> m_queued_lookups;
+    size_t m_running_lookup_count { 0 };
+};
+
+}
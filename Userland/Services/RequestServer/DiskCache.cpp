@@ -0,0 +1,581 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/GenericShorthands.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/Directory.h>
+#include <LibCore/System.h>
+#include <RequestServer/DiskCache.h>
+#include <sys/file.h>
+
+namespace RequestServer {
+
+static constexpr u32 index_magic = 0x4348424c; // "LBHC"
+static constexpr u32 index_version = 1;
+
+enum class RecordType : u8 {
+    Store = 1,
+    Remove = 2,
+};
+
+static ErrorOr<void> write_string(Stream& stream, StringView string)
+{
+    TRY(stream.write_value<LittleEndian<u32>>(string.length()));
+    TRY(stream.write_until_depleted(string.bytes()));
+    return {};
+}
+
+static ErrorOr<ByteString> read_string(Stream& stream)
+{
+    auto length = TRY(stream.read_value<LittleEndian<u32>>());
+    auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(stream.read_until_filled(buffer));
+    return ByteString { buffer.bytes() };
+}
+
+static ErrorOr<void> write_headers(Stream& stream, Vector<HTTP::Header> const& headers)
+{
+    TRY(stream.write_value<LittleEndian<u32>>(headers.size()));
+    for (auto const& header : headers) {
+        TRY(write_string(stream, header.name));
+        TRY(write_string(stream, header.value));
+    }
+    return {};
+}
+
+static ErrorOr<Vector<HTTP::Header>> read_headers(Stream& stream)
+{
+    auto count = TRY(stream.read_value<LittleEndian<u32>>());
+    Vector<HTTP::Header> headers;
+    for (u32 i = 0; i < count; ++i) {
+        auto name = TRY(read_string(stream));
+        auto value = TRY(read_string(stream));
+        headers.append({ move(name), move(value) });
+    }
+    return headers;
+}
+
+static ByteString cache_key(URL::URL const& url)
+{
+    return url.serialize(URL::ExcludeFragment::Yes);
+}
+
+// https://httpwg.org/specs/rfc9110.html#http.date
+static Optional<UnixDateTime> parse_http_date(Optional<ByteString> const& value)
+{
+    if (!value.has_value())
+        return {};
+    auto date_time = Core::DateTime::parse("%a, %d %b %Y %H:%M:%S %Z"sv, *value);
+    if (!date_time.has_value())
+        return {};
+    return UnixDateTime::from_seconds_since_epoch(date_time->timestamp());
+}
+
+// https://httpwg.org/specs/rfc9111.html#field.cache-control
+struct CacheControl {
+    bool no_store { false };
+    bool no_cache { false };
+    Optional<i64> max_age;
+};
+
+static CacheControl parse_cache_control(HTTP::HeaderMap const& headers)
+{
+    CacheControl cache_control;
+
+    auto value = headers.get("Cache-Control"sv);
+    if (!value.has_value()) {
+        // https://httpwg.org/specs/rfc9111.html#field.pragma
+        if (auto pragma = headers.get("Pragma"sv); pragma.has_value() && pragma->trim_whitespace().equals_ignoring_ascii_case("no-cache"sv))
+            cache_control.no_cache = true;
+        return cache_control;
+    }
+
+    value->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView directive) {
+        directive = directive.trim_whitespace();
+
+        auto name = directive;
+        Optional<StringView> argument;
+        if (auto equals = directive.find('='); equals.has_value()) {
+            name = directive.substring_view(0, *equals).trim_whitespace();
+            argument = directive.substring_view(*equals + 1).trim_whitespace().trim("\""sv);
+        }
+
+        if (name.equals_ignoring_ascii_case("no-store"sv))
+            cache_control.no_store = true;
+        // NOTE: must-revalidate only matters once a response is stale, at which point we always revalidate anyway.
+        else if (name.equals_ignoring_ascii_case("no-cache"sv))
+            cache_control.no_cache = true;
+        else if (name.equals_ignoring_ascii_case("max-age"sv) && argument.has_value())
+            cache_control.max_age = argument->to_number<i64>();
+    });
+
+    return cache_control;
+}
+
+static Vector<ByteString> varying_header_names(HTTP::HeaderMap const& response_headers)
+{
+    Vector<ByteString> names;
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        vary->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView name) {
+            names.append(name.trim_whitespace());
+        });
+    }
+    return names;
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static i64 freshness_lifetime(HTTP::HeaderMap const& headers, UnixDateTime response_time)
+{
+    if (auto max_age = parse_cache_control(headers).max_age; max_age.has_value())
+        return *max_age;
+
+    auto date = parse_http_date(headers.get("Date"sv)).value_or(response_time);
+
+    if (auto expires = headers.get("Expires"sv); expires.has_value()) {
+        // An invalid Expires value, like "0", represents a time in the past.
+        auto expiration = parse_http_date(expires);
+        if (!expiration.has_value())
+            return 0;
+        return max<i64>(0, expiration->seconds_since_epoch() - date.seconds_since_epoch());
+    }
+
+    // https://httpwg.org/specs/rfc9111.html#heuristic.freshness
+    // NOTE: We only store heuristically cacheable status codes, so we can always fall back to this.
+    if (auto last_modified = parse_http_date(headers.get("Last-Modified"sv)); last_modified.has_value())
+        return max<i64>(0, (date.seconds_since_epoch() - last_modified->seconds_since_epoch()) / 10);
+
+    return 0;
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static i64 current_age(HTTP::HeaderMap const& headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    auto age_value = headers.get("Age"sv).value_or({}).to_number<i64>().value_or(0);
+    auto date_value = parse_http_date(headers.get("Date"sv)).value_or(response_time);
+
+    auto apparent_age = max<i64>(0, response_time.seconds_since_epoch() - date_value.seconds_since_epoch());
+    auto response_delay = response_time.seconds_since_epoch() - request_time.seconds_since_epoch();
+    auto corrected_age_value = age_value + response_delay;
+    auto corrected_initial_age = max(apparent_age, corrected_age_value);
+
+    auto resident_time = UnixDateTime::now().seconds_since_epoch() - response_time.seconds_since_epoch();
+    return corrected_initial_age + resident_time;
+}
+
+// Headers that only apply to a single connection or message, or that must not be replayed from the cache.
+static bool is_unstorable_response_header(StringView name)
+{
+    return name.equals_ignoring_ascii_case("Connection"sv)
+        || name.equals_ignoring_ascii_case("Keep-Alive"sv)
+        || name.equals_ignoring_ascii_case("Transfer-Encoding"sv)
+        || name.equals_ignoring_ascii_case("Set-Cookie"sv);
+}
+
+// https://httpwg.org/specs/rfc9111.html#update
+static bool is_exempt_from_header_update(StringView name)
+{
+    return is_unstorable_response_header(name)
+        || name.equals_ignoring_ascii_case("Content-Length"sv)
+        || name.equals_ignoring_ascii_case("Content-Encoding"sv)
+        || name.equals_ignoring_ascii_case("Content-Range"sv);
+}
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(ByteString directory, u64 maximum_size)
+{
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    auto index_file = TRY(Core::File::open(ByteString::formatted("{}/index", directory), Core::File::OpenMode::ReadWrite | Core::File::OpenMode::Append));
+
+    // NOTE: Several browser instances may point at the same directory, but only one of them can own the cache.
+    if (flock(index_file->fd(), LOCK_EX | LOCK_NB) < 0)
+        return Error::from_errno(errno);
+
+    auto data_file = TRY(Core::File::open(ByteString::formatted("{}/data", directory), Core::File::OpenMode::ReadWrite | Core::File::OpenMode::Append));
+
+    auto cache = adopt_own(*new DiskCache(move(directory), maximum_size, move(index_file), move(data_file)));
+    TRY(cache->load_index());
+    return cache;
+}
+
+DiskCache::DiskCache(ByteString directory, u64 maximum_size, NonnullOwnPtr<Core::File> index_file, NonnullOwnPtr<Core::File> data_file)
+    : m_directory(move(directory))
+    , m_maximum_size(maximum_size)
+    , m_index_file(move(index_file))
+    , m_data_file(move(data_file))
+{
+}
+
+DiskCache::~DiskCache() = default;
+
+ErrorOr<void> DiskCache::load_index()
+{
+    m_data_file_size = TRY(Core::System::fstat(m_data_file->fd())).st_size;
+
+    TRY(m_index_file->seek(0, SeekMode::SetPosition));
+    auto index = TRY(m_index_file->read_until_eof());
+    FixedMemoryStream stream { index.bytes() };
+
+    auto magic = stream.read_value<LittleEndian<u32>>();
+    auto version = stream.read_value<LittleEndian<u32>>();
+    if (magic.is_error() || version.is_error() || magic.value() != index_magic || version.value() != index_version) {
+        // Either this is a new cache, or one we don't understand. Start over with an empty one.
+        return compact();
+    }
+
+    bool is_truncated = false;
+    while (!stream.is_eof()) {
+        auto record = [&]() -> ErrorOr<void> {
+            auto type = TRY(stream.read_value<RecordType>());
+            auto key = TRY(read_string(stream));
+            ++m_index_record_count;
+
+            if (type == RecordType::Remove) {
+                if (auto entry = m_entries.take(key); entry.has_value())
+                    m_total_body_size -= entry->body_size;
+                return {};
+            }
+            if (type != RecordType::Store)
+                return Error::from_string_literal("Unknown record type");
+
+            Entry entry;
+            entry.status_code = TRY(stream.read_value<LittleEndian<u32>>());
+            for (auto& header : TRY(read_headers(stream)))
+                entry.response_headers.set(move(header.name), move(header.value));
+            entry.varying_request_headers = TRY(read_headers(stream));
+            entry.body_offset = TRY(stream.read_value<LittleEndian<u64>>());
+            entry.body_size = TRY(stream.read_value<LittleEndian<u64>>());
+            entry.request_time = UnixDateTime::from_seconds_since_epoch(TRY(stream.read_value<LittleEndian<i64>>()));
+            entry.response_time = UnixDateTime::from_seconds_since_epoch(TRY(stream.read_value<LittleEndian<i64>>()));
+            entry.last_access = ++m_access_counter;
+
+            if (auto old_entry = m_entries.take(key); old_entry.has_value())
+                m_total_body_size -= old_entry->body_size;
+
+            // The body of the last entry may not have made it to disk.
+            if (entry.body_offset + entry.body_size > m_data_file_size)
+                return {};
+
+            m_total_body_size += entry.body_size;
+            m_entries.set(move(key), move(entry));
+            return {};
+        }();
+
+        // A partially written record at the end of the journal, most likely because we crashed while writing it.
+        if (record.is_error()) {
+            is_truncated = true;
+            break;
+        }
+    }
+
+    if (is_truncated)
+        return compact();
+
+    evict_entries_if_needed();
+    return {};
+}
+
+ErrorOr<void> DiskCache::append_store_record(ByteString const& key, Entry const& entry)
+{
+    AllocatingMemoryStream stream;
+    TRY(stream.write_value(RecordType::Store));
+    TRY(write_string(stream, key));
+    TRY(stream.write_value<LittleEndian<u32>>(entry.status_code));
+    TRY(write_headers(stream, entry.response_headers.headers()));
+    TRY(write_headers(stream, entry.varying_request_headers));
+    TRY(stream.write_value<LittleEndian<u64>>(entry.body_offset));
+    TRY(stream.write_value<LittleEndian<u64>>(entry.body_size));
+    TRY(stream.write_value<LittleEndian<i64>>(entry.request_time.seconds_since_epoch()));
+    TRY(stream.write_value<LittleEndian<i64>>(entry.response_time.seconds_since_epoch()));
+
+    // NOTE: Each record is written in one go, so that a crash leaves at most one partial record behind.
+    auto record = TRY(stream.read_until_eof());
+    TRY(m_index_file->write_until_depleted(record));
+    ++m_index_record_count;
+    return {};
+}
+
+ErrorOr<void> DiskCache::append_remove_record(ByteString const& key)
+{
+    AllocatingMemoryStream stream;
+    TRY(stream.write_value(RecordType::Remove));
+    TRY(write_string(stream, key));
+
+    auto record = TRY(stream.read_until_eof());
+    TRY(m_index_file->write_until_depleted(record));
+    ++m_index_record_count;
+    return {};
+}
+
+ErrorOr<void> DiskCache::compact()
+{
+    auto index_path = ByteString::formatted("{}/index", m_directory);
+    auto data_path = ByteString::formatted("{}/data", m_directory);
+    auto new_index_path = ByteString::formatted("{}/index.new", m_directory);
+    auto new_data_path = ByteString::formatted("{}/data.new", m_directory);
+
+    auto new_index_file = TRY(Core::File::open(new_index_path, Core::File::OpenMode::ReadWrite | Core::File::OpenMode::Truncate));
+    auto new_data_file = TRY(Core::File::open(new_data_path, Core::File::OpenMode::ReadWrite | Core::File::OpenMode::Truncate));
+    TRY(new_index_file->write_value<LittleEndian<u32>>(index_magic));
+    TRY(new_index_file->write_value<LittleEndian<u32>>(index_version));
+
+    // Keep the entries in the order they were last used in, so that loading the index restores it.
+    Vector<ByteString> keys;
+    keys.ensure_capacity(m_entries.size());
+    for (auto const& it : m_entries)
+        keys.append(it.key);
+    quick_sort(keys, [&](auto const& a, auto const& b) { return m_entries.get(a)->last_access < m_entries.get(b)->last_access; });
+
+    u64 new_data_file_size = 0;
+    for (auto const& key : keys) {
+        auto& entry = m_entries.find(key)->value;
+
+        auto body = body_for_entry(entry);
+        if (body.is_error()) {
+            m_total_body_size -= entry.body_size;
+            m_entries.remove(key);
+            continue;
+        }
+
+        TRY(new_data_file->write_until_depleted(body.value()));
+        entry.body_offset = new_data_file_size;
+        new_data_file_size += entry.body_size;
+    }
+
+    m_index_file = move(new_index_file);
+    m_mapped_data_file = nullptr;
+    m_data_file = move(new_data_file);
+    m_data_file_size = new_data_file_size;
+    m_index_record_count = 0;
+
+    for (auto const& key : keys) {
+        if (auto entry = m_entries.get(key); entry.has_value())
+            TRY(append_store_record(key, *entry));
+    }
+
+    TRY(Core::System::rename(new_data_path, data_path));
+    TRY(Core::System::rename(new_index_path, index_path));
+
+    if (flock(m_index_file->fd(), LOCK_EX | LOCK_NB) < 0)
+        return Error::from_errno(errno);
+    return {};
+}
+
+ErrorOr<ReadonlyBytes> DiskCache::body_for_entry(Entry const& entry)
+{
+    if (entry.body_size == 0)
+        return ReadonlyBytes {};
+
+    // The data file only ever grows, so the mapping only has to be renewed once it no longer covers the entry.
+    if (!m_mapped_data_file || m_mapped_data_file->bytes().size() < entry.body_offset + entry.body_size)
+        m_mapped_data_file = TRY(Core::MappedFile::map(ByteString::formatted("{}/data", m_directory)));
+
+    auto bytes = m_mapped_data_file->bytes();
+    if (bytes.size() < entry.body_offset + entry.body_size)
+        return Error::from_string_literal("Cached body lies outside of the data file");
+    return bytes.slice(entry.body_offset, entry.body_size);
+}
+
+Optional<DiskCache::CachedResponse> DiskCache::open_entry(URL::URL const& url, HTTP::HeaderMap const& request_headers)
+{
+    if (m_disabled)
+        return {};
+
+    auto request_cache_control = parse_cache_control(request_headers);
+    if (request_cache_control.no_store)
+        return {};
+
+    auto key = cache_key(url);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return {};
+    auto& entry = it->value;
+
+    // https://httpwg.org/specs/rfc9111.html#caching.negotiated.responses
+    for (auto const& name : varying_header_names(entry.response_headers)) {
+        auto stored_header = entry.varying_request_headers.first_matching([&](auto const& header) {
+            return header.name.equals_ignoring_ascii_case(name);
+        });
+        auto stored_value = stored_header.has_value() ? Optional<ByteString> { stored_header->value } : Optional<ByteString> {};
+        if (stored_value != request_headers.get(name))
+            return {};
+    }
+
+    auto body = body_for_entry(entry);
+    if (body.is_error()) {
+        dbgln("DiskCache: Unable to read cached body for {}: {}", key, body.error());
+        remove_entry(key);
+        return {};
+    }
+
+    auto body_copy = ByteBuffer::copy(body.value());
+    if (body_copy.is_error())
+        return {};
+
+    entry.last_access = ++m_access_counter;
+
+    // https://httpwg.org/specs/rfc9111.html#expiration.model
+    auto age = current_age(entry.response_headers, entry.request_time, entry.response_time);
+    auto is_fresh = freshness_lifetime(entry.response_headers, entry.response_time) > age;
+
+    auto response_cache_control = parse_cache_control(entry.response_headers);
+    if (response_cache_control.no_cache || request_cache_control.no_cache)
+        is_fresh = false;
+    if (request_cache_control.max_age.has_value() && age > *request_cache_control.max_age)
+        is_fresh = false;
+
+    return CachedResponse {
+        .status_code = entry.status_code,
+        .headers = entry.response_headers,
+        .body = body_copy.release_value(),
+        .needs_revalidation = !is_fresh,
+        .entity_tag = entry.response_headers.get("ETag"sv),
+        .last_modified = entry.response_headers.get("Last-Modified"sv),
+    };
+}
+
+// https://httpwg.org/specs/rfc9111.html#response.cacheability
+bool DiskCache::is_storable(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers)
+{
+    if (method != "GET"sv)
+        return false;
+
+    // NOTE: We only store the responses that are heuristically cacheable, and so don't need explicit freshness.
+    if (!first_is_one_of(status_code, 200u, 203u, 204u, 300u, 301u, 308u, 404u, 405u, 410u, 414u, 501u))
+        return false;
+
+    if (parse_cache_control(request_headers).no_store || parse_cache_control(response_headers).no_store)
+        return false;
+
+    // Partial responses would have to be combined with the rest of the representation.
+    if (request_headers.contains("Range"sv))
+        return false;
+
+    for (auto const& name : varying_header_names(response_headers)) {
+        if (name == "*"sv)
+            return false;
+    }
+
+    // A response that can neither be reused without nor with revalidation would only take up space.
+    return response_headers.contains("Cache-Control"sv)
+        || response_headers.contains("Expires"sv)
+        || response_headers.contains("ETag"sv)
+        || response_headers.contains("Last-Modified"sv);
+}
+
+void DiskCache::store(URL::URL const& url, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers, ReadonlyBytes body, UnixDateTime request_time, UnixDateTime response_time)
+{
+    if (m_disabled || body.size() > maximum_entry_size())
+        return;
+
+    auto key = cache_key(url);
+
+    Entry entry;
+    entry.status_code = status_code;
+    for (auto const& header : response_headers.headers()) {
+        if (!is_unstorable_response_header(header.name))
+            entry.response_headers.set(header.name, header.value);
+    }
+    for (auto const& name : varying_header_names(response_headers)) {
+        if (auto value = request_headers.get(name); value.has_value())
+            entry.varying_request_headers.append({ name, value.release_value() });
+    }
+    entry.body_offset = m_data_file_size;
+    entry.body_size = body.size();
+    entry.request_time = request_time;
+    entry.response_time = response_time;
+    entry.last_access = ++m_access_counter;
+
+    if (auto result = m_data_file->write_until_depleted(body); result.is_error()) {
+        disable(result.release_error());
+        return;
+    }
+    m_data_file_size += body.size();
+
+    // NOTE: The new record supersedes any older one for the same key once the index is replayed.
+    if (auto old_entry = m_entries.take(key); old_entry.has_value())
+        m_total_body_size -= old_entry->body_size;
+
+    if (auto result = append_store_record(key, entry); result.is_error()) {
+        disable(result.release_error());
+        return;
+    }
+
+    m_total_body_size += entry.body_size;
+    m_entries.set(move(key), move(entry));
+
+    evict_entries_if_needed();
+}
+
+void DiskCache::update_after_revalidation(URL::URL const& url, HTTP::HeaderMap const& not_modified_headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    if (m_disabled)
+        return;
+
+    auto key = cache_key(url);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return;
+    auto& entry = it->value;
+
+    HTTP::HeaderMap headers;
+    for (auto const& header : entry.response_headers.headers()) {
+        if (is_exempt_from_header_update(header.name) || !not_modified_headers.contains(header.name))
+            headers.set(header.name, header.value);
+    }
+    for (auto const& header : not_modified_headers.headers()) {
+        if (!is_exempt_from_header_update(header.name))
+            headers.set(header.name, header.value);
+    }
+
+    entry.response_headers = move(headers);
+    entry.request_time = request_time;
+    entry.response_time = response_time;
+
+    if (auto result = append_store_record(key, entry); result.is_error())
+        disable(result.release_error());
+}
+
+void DiskCache::remove_entry(ByteString const& key)
+{
+    auto entry = m_entries.take(key);
+    if (!entry.has_value())
+        return;
+    m_total_body_size -= entry->body_size;
+
+    if (auto result = append_remove_record(key); result.is_error())
+        disable(result.release_error());
+}
+
+void DiskCache::evict_entries_if_needed()
+{
+    while (m_total_body_size > m_maximum_size && !m_entries.is_empty()) {
+        auto least_recently_used = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->value.last_access < least_recently_used->value.last_access)
+                least_recently_used = it;
+        }
+        remove_entry(ByteString { least_recently_used->key });
+    }
+
+    // Evicted and replaced bodies stay in the data file until we rewrite it.
+    if (m_data_file_size > 2 * m_total_body_size + 1 * MiB || m_index_record_count > 2 * m_entries.size() + 1024) {
+        if (auto result = compact(); result.is_error())
+            disable(result.release_error());
+    }
+}
+
+void DiskCache::disable(Error const& error)
+{
+    dbgln("DiskCache: Disabling the cache in {}: {}", m_directory, error);
+    m_disabled = true;
+    m_entries.clear();
+    m_mapped_data_file = nullptr;
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Time.h>
+#include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// A private HTTP cache (RFC 9111) that is shared by all clients of this RequestServer, and persists across runs.
+//
+// Response bodies are appended to a single data file, so that they can be served straight out of a mapping of it.
+// The index is an append-only journal of entries being stored and removed, which is replayed on startup. Once the
+// journal or the data file accumulates too much garbage, both are rewritten with only the live entries.
+class DiskCache {
+public:
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(ByteString directory, u64 maximum_size);
+    ~DiskCache();
+
+    struct CachedResponse {
+        u32 status_code { 0 };
+        HTTP::HeaderMap headers;
+        ByteBuffer body;
+
+        // Set if the response is stale, or may not be used without asking the origin server first. If it has no
+        // validators, the response cannot be revalidated and has to be fetched again.
+        bool needs_revalidation { false };
+        Optional<ByteString> entity_tag;
+        Optional<ByteString> last_modified;
+    };
+
+    Optional<CachedResponse> open_entry(URL::URL const&, HTTP::HeaderMap const& request_headers);
+
+    static bool is_storable(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers);
+    u64 maximum_entry_size() const { return m_maximum_size / 8; }
+
+    void store(URL::URL const&, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers, ReadonlyBytes body, UnixDateTime request_time, UnixDateTime response_time);
+
+    // Freshens the stored response after the origin server answered a conditional request with 304 Not Modified.
+    void update_after_revalidation(URL::URL const&, HTTP::HeaderMap const& not_modified_headers, UnixDateTime request_time, UnixDateTime response_time);
+
+private:
+    struct Entry {
+        u32 status_code { 0 };
+        HTTP::HeaderMap response_headers;
+
+        // The request headers nominated by the response's Vary header, which must match for the entry to be used.
+        Vector<HTTP::Header> varying_request_headers;
+
+        u64 body_offset { 0 };
+        u64 body_size { 0 };
+        UnixDateTime request_time;
+        UnixDateTime response_time;
+
+        u64 last_access { 0 };
+    };
+
+    DiskCache(ByteString directory, u64 maximum_size, NonnullOwnPtr<Core::File> index_file, NonnullOwnPtr<Core::File> data_file);
+
+    ErrorOr<void> load_index();
+    ErrorOr<void> append_store_record(ByteString const& key, Entry const&);
+    ErrorOr<void> append_remove_record(ByteString const& key);
+    ErrorOr<void> compact();
+
+    void remove_entry(ByteString const& key);
+    void evict_entries_if_needed();
+    ErrorOr<ReadonlyBytes> body_for_entry(Entry const&);
+
+    void disable(Error const&);
+
+    ByteString m_directory;
+    u64 m_maximum_size { 0 };
+
+    NonnullOwnPtr<Core::File> m_index_file;
+    NonnullOwnPtr<Core::File> m_data_file;
+    u64 m_data_file_size { 0 };
+    OwnPtr<Core::MappedFile> m_mapped_data_file;
+
+    HashMap<ByteString, Entry> m_entries;
+    u64 m_total_body_size { 0 };
+    size_t m_index_record_count { 0 };
+    u64 m_access_counter { 0 };
+
+    bool m_disabled { false };
+};
+
+}
@@ -9,6 +9,7 @@
 namespace RequestServer {
 
 class ConnectionFromClient;
+class DiskCache;
 class Request;
 class HttpRequest;
 class HttpProtocol;
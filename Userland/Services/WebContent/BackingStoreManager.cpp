@@ -38,8 +38,18 @@ void BackingStoreManager::restart_resize_timer()
     m_backing_store_shrink_timer->restart();
 }
 
+void BackingStoreManager::release_backing_stores()
+{
+    m_backing_store_shrink_timer->stop();
+    m_front_store.clear();
+    m_back_store.clear();
+    m_front_store_holds_previous_frame = false;
+}
+
 void BackingStoreManager::reallocate_backing_stores(Gfx::IntSize size)
 {
+    m_front_store_holds_previous_frame = false;
+
 #ifdef AK_OS_MACOS
     if (s_browser_mach_port.has_value()) {
         auto back_iosurface = Core::IOSurfaceHandle::create(size.width(), size.height());
@@ -119,6 +129,7 @@ void BackingStoreManager::resize_backing_stores_if_needed(WindowResizingInProgre
         minimum_needed_size = viewport_size;
         m_front_store.clear();
         m_back_store.clear();
+        m_front_store_holds_previous_frame = false;
     }
 
     if (!m_front_store || !m_back_store || !m_front_store->size().contains(minimum_needed_size.to_type<int>())) {
@@ -130,6 +141,17 @@ void BackingStoreManager::swap_back_and_front()
 {
     swap(m_front_store, m_back_store);
     swap(m_front_bitmap_id, m_back_bitmap_id);
+    m_front_store_holds_previous_frame = true;
+}
+
+size_t BackingStoreManager::memory_usage() const
+{
+    size_t bytes = 0;
+    if (m_front_store)
+        bytes += m_front_store->bitmap().size_in_bytes();
+    if (m_back_store)
+        bytes += m_back_store->bitmap().size_in_bytes();
+    return bytes;
 }
 
 }
@@ -26,12 +26,18 @@ public:
     void resize_backing_stores_if_needed(WindowResizingInProgress window_resize_in_progress);
     void reallocate_backing_stores(Gfx::IntSize);
     void restart_resize_timer();
+    void release_backing_stores();
 
     Web::Painting::BackingStore* back_store() { return m_back_store.ptr(); }
     i32 front_id() const { return m_front_bitmap_id; }
 
+    // Returns the front store if it holds the last painted frame, so the back store can be painted on top of a copy of it.
+    Web::Painting::BackingStore const* previous_frame() const { return m_front_store_holds_previous_frame ? m_front_store.ptr() : nullptr; }
+
     void swap_back_and_front();
 
+    size_t memory_usage() const;
+
     BackingStoreManager(PageClient&);
 
 private:
@@ -42,6 +48,7 @@ private:
     i32 m_back_bitmap_id { -1 };
     OwnPtr<Web::Painting::BackingStore> m_front_store;
     OwnPtr<Web::Painting::BackingStore> m_back_store;
+    bool m_front_store_holds_previous_frame { false };
     int m_next_bitmap_id { 0 };
 
     RefPtr<Core::Timer> m_backing_store_shrink_timer;
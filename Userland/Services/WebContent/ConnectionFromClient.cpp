@@ -9,12 +9,18 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/TypefaceSkia.h>
+#include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profile.h>
 #include <LibJS/Heap/Heap.h>
+#include <LibJS/Heap/HeapBlock.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibUnicode/TimeZone.h>
@@ -29,6 +35,7 @@
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
@@ -353,6 +360,11 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString const& request,
         return;
     }
 
+    if (request == "dump-glyph-cache-usage") {
+        dbgln("Glyph cache: {} of {} bytes used", Gfx::TypefaceSkia::glyph_cache_memory_usage(), Gfx::TypefaceSkia::glyph_cache_limit());
+        return;
+    }
+
     if (request == "collect-garbage") {
         Web::Bindings::main_thread_vm().heap().collect_garbage(JS::Heap::CollectionType::CollectGarbage, true);
         return;
@@ -905,6 +917,77 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static void append_heap_statistics(StringBuilder& builder)
+{
+    auto heap_statistics = Web::Bindings::main_thread_vm().heap().dump_cell_statistics();
+    heap_statistics.serialize(builder);
+}
+
+static void append_event_loop_statistics(StringBuilder& builder)
+{
+    auto event_loop_statistics = Web::HTML::main_thread_event_loop().statistics().to_json();
+    event_loop_statistics.serialize(builder);
+}
+
+static void append_bytecode_profile(StringBuilder& builder)
+{
+    auto& vm = Web::Bindings::main_thread_vm();
+    auto bytecode_profile = JS::Bytecode::dump_profile(vm.heap(), vm.bytecode_interpreter().profile());
+    bytecode_profile.serialize(builder);
+}
+
+static void append_network_requests(Web::Page& page, StringBuilder& builder)
+{
+    auto const& network_requests = page.network_requests();
+
+    // All times are reported in milliseconds since the first request in the log was started.
+    auto origin_time = 0.0;
+    if (!network_requests.is_empty()) {
+        origin_time = network_requests.first().start_time;
+        for (auto const& record : network_requests)
+            origin_time = min(origin_time, record.start_time);
+    }
+
+    JsonArray requests;
+
+    for (auto const& record : network_requests) {
+        auto const& timing_info = record.timing_info;
+
+        auto phase_time = [&](i64 microseconds) -> JsonValue {
+            if (microseconds == 0)
+                return JsonValue {};
+            return record.start_time - origin_time + static_cast<double>(microseconds) / 1000.0;
+        };
+
+        JsonObject request;
+        request.set("url"sv, record.url.serialize());
+        request.set("method"sv, record.method);
+        if (record.status_code.has_value())
+            request.set("status"sv, *record.status_code);
+        request.set("initiatorType"sv, record.initiator_type);
+        request.set("destination"sv, record.destination);
+        request.set("start"sv, record.start_time - origin_time);
+        request.set("end"sv, record.end_time - origin_time);
+        request.set("success"sv, record.success);
+        request.set("decodedBodySize"sv, record.decoded_body_size);
+        request.set("encodedBodySize"sv, timing_info.encoded_body_size);
+        request.set("protocol"sv, timing_info.alpn_negotiated_protocol);
+        request.set("connectionReused"sv, timing_info.connection_reused);
+        request.set("domainLookupStart"sv, phase_time(timing_info.domain_lookup_start_microseconds));
+        request.set("domainLookupEnd"sv, phase_time(timing_info.domain_lookup_end_microseconds));
+        request.set("connectStart"sv, phase_time(timing_info.connect_start_microseconds));
+        request.set("connectEnd"sv, phase_time(timing_info.connect_end_microseconds));
+        request.set("secureConnectionStart"sv, phase_time(timing_info.secure_connect_start_microseconds));
+        request.set("requestStart"sv, phase_time(timing_info.request_start_microseconds));
+        request.set("responseStart"sv, phase_time(timing_info.response_start_microseconds));
+        request.set("responseEnd"sv, phase_time(timing_info.response_end_microseconds));
+
+        requests.must_append(move(request));
+    }
+
+    requests.serialize(builder);
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -937,9 +1020,87 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::HeapStatistics)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_heap_statistics(builder);
+    }
+
+    if (has_flag(type, WebView::PageInfoType::EventLoopStatistics)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_event_loop_statistics(builder);
+    }
+
+    if (has_flag(type, WebView::PageInfoType::BytecodeProfile)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_bytecode_profile(builder);
+    }
+
+    if (has_flag(type, WebView::PageInfoType::NetworkRequests)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_network_requests(page->page(), builder);
+    }
+
     async_did_get_internal_page_info(page_id, type, MUST(builder.to_string()));
 }
 
+void ConnectionFromClient::request_memory_usage()
+{
+    auto heap_usage = Web::Bindings::main_thread_vm().heap().memory_usage();
+
+    WebView::MemoryUsage usage;
+    usage.js_heap_used_bytes = heap_usage.used_bytes;
+    usage.js_heap_committed_bytes = heap_usage.committed_bytes;
+
+    auto cell_size = [](JS::Cell const& cell) {
+        return JS::HeapBlock::from_cell(&cell)->cell_size();
+    };
+
+    for (auto* navigable : Web::HTML::all_navigables()) {
+        auto document = navigable->active_document();
+        if (!document)
+            continue;
+
+        if (auto const* layout_root = document->layout_node()) {
+            layout_root->for_each_in_inclusive_subtree([&](auto const& layout_node) {
+                usage.layout_tree_bytes += cell_size(layout_node);
+                return Web::TraversalDecision::Continue;
+            });
+        }
+
+        if (auto const* paint_root = document->paintable()) {
+            paint_root->for_each_in_inclusive_subtree([&](auto const& paintable) {
+                usage.paint_tree_bytes += cell_size(paintable);
+                if (auto const* stacking_context = paintable.stacking_context())
+                    usage.display_list_bytes += stacking_context->cached_display_list_memory_usage();
+                return Web::TraversalDecision::Continue;
+            });
+        }
+
+        if (auto const* display_list = document->cached_display_list())
+            usage.display_list_bytes += display_list->memory_usage();
+    }
+
+    usage.decoded_image_bytes = Gfx::ImmutableBitmap::total_size_in_bytes();
+    usage.font_cache_bytes = Web::Painting::DisplayListPlayerSkia::font_cache_usage();
+    usage.skia_cache_bytes = Web::Painting::DisplayListPlayerSkia::resource_cache_usage();
+
+    page_host().for_each_page([&](PageClient& page_client) {
+        usage.backing_store_bytes += page_client.backing_store_manager().memory_usage();
+
+        auto& page = page_client.page();
+        if (!page.top_level_traversable_is_initialized())
+            return;
+        if (auto const* skia_backend_context = page.top_level_traversable()->skia_backend_context())
+            usage.skia_cache_bytes += skia_backend_context->resource_cache_usage();
+    });
+
+    async_did_report_memory_usage(usage);
+}
+
 Messages::WebContentServer::GetSelectedTextResponse ConnectionFromClient::get_selected_text(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -1129,7 +1290,7 @@ void ConnectionFromClient::request_file(u64 page_id, Web::FileRequest file_reque
 void ConnectionFromClient::set_system_visibility_state(u64 page_id, bool visible)
 {
     if (auto page = this->page(page_id); page.has_value()) {
-        page->page().top_level_traversable()->set_system_visibility_state(
+        page->set_system_visibility_state(
             visible
                 ? Web::HTML::VisibilityState::Visible
                 : Web::HTML::VisibilityState::Hidden);
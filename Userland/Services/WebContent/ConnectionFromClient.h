@@ -134,6 +134,7 @@ private:
     virtual void take_dom_node_screenshot(u64 page_id, i32 node_id) override;
 
     virtual void request_internal_page_info(u64 page_id, WebView::PageInfoType) override;
+    virtual void request_memory_usage() override;
 
     virtual Messages::WebContentServer::GetLocalStorageEntriesResponse get_local_storage_entries(u64 page_id) override;
     virtual Messages::WebContentServer::GetSessionStorageEntriesResponse get_session_storage_entries(u64 page_id) override;
@@ -59,6 +59,11 @@ PageClient::PageClient(PageHost& owner, u64 id)
     });
 
     m_paint_refresh_timer->start();
+
+    // Hidden pages don't paint, so their backing stores are released once they have stayed hidden for a while.
+    m_release_backing_stores_timer = Core::Timer::create_single_shot(30'000, [this] {
+        m_backing_store_manager.release_backing_stores();
+    });
 }
 
 PageClient::~PageClient() = default;
@@ -89,6 +94,25 @@ void PageClient::set_has_focus(bool has_focus)
     m_has_focus = has_focus;
 }
 
+void PageClient::set_system_visibility_state(Web::HTML::VisibilityState visibility_state)
+{
+    page().top_level_traversable()->set_system_visibility_state(visibility_state);
+
+    // Hidden pages have no rendering opportunities, so there's no need to keep waking up to update their rendering.
+    if (visibility_state == Web::HTML::VisibilityState::Hidden) {
+        m_paint_refresh_timer->stop();
+        m_release_backing_stores_timer->restart();
+        return;
+    }
+
+    m_release_backing_stores_timer->stop();
+    if (!m_backing_store_manager.back_store()) {
+        m_backing_store_manager.resize_backing_stores_if_needed(BackingStoreManager::WindowResizingInProgress::No);
+        page().top_level_traversable()->set_needs_display();
+    }
+    m_paint_refresh_timer->start();
+}
+
 void PageClient::setup_palette()
 {
     // FIXME: Get the proper palette from our peer somehow
@@ -194,7 +218,7 @@ void PageClient::paint_next_frame()
         return;
 
     auto viewport_rect = page().css_to_device_rect(page().top_level_traversable()->viewport_rect());
-    paint(viewport_rect, *back_store);
+    paint(viewport_rect, *back_store, { .is_next_frame = true, .previous_frame = m_backing_store_manager.previous_frame() });
 
     m_backing_store_manager.swap_back_and_front();
 
@@ -502,6 +526,31 @@ void PageClient::page_did_update_cookie(Web::Cookie::Cookie cookie)
     client().async_did_update_cookie(move(cookie));
 }
 
+OrderedHashMap<String, String> PageClient::page_did_request_local_storage_items(String const& origin)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestLocalStorageItems>(origin);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestLocalStorageItems. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_items();
+}
+
+void PageClient::page_did_set_local_storage_item(String const& origin, String const& key, String const& value)
+{
+    client().async_did_set_local_storage_item(origin, key, value);
+}
+
+void PageClient::page_did_remove_local_storage_item(String const& origin, String const& key)
+{
+    client().async_did_remove_local_storage_item(origin, key);
+}
+
+void PageClient::page_did_clear_local_storage(String const& origin)
+{
+    client().async_did_clear_local_storage(origin);
+}
+
 void PageClient::page_did_update_resource_count(i32 count_waiting)
 {
     client().async_did_update_resource_count(m_id, count_waiting);
@@ -744,6 +793,11 @@ void PageClient::did_get_js_console_messages(i32 start_index, Vector<ByteString>
     client().async_did_get_js_console_messages(m_id, start_index, move(message_types), move(messages));
 }
 
+void PageClient::did_finish_js_profile(String const& label, ByteString const& profile)
+{
+    client().async_did_finish_js_profile(m_id, label, profile);
+}
+
 static void gather_style_sheets(Vector<Web::CSS::StyleSheetIdentifier>& results, Web::CSS::CSSStyleSheet& sheet)
 {
     Web::CSS::StyleSheetIdentifier identifier {};
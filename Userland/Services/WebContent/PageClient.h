@@ -12,6 +12,7 @@
 #include <LibWeb/CSS/StyleSheetIdentifier.h>
 #include <LibWeb/HTML/AudioPlayState.h>
 #include <LibWeb/HTML/FileFilter.h>
+#include <LibWeb/HTML/VisibilityState.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/PixelUnits.h>
 #include <WebContent/BackingStoreManager.h>
@@ -39,6 +40,8 @@ public:
     virtual Web::Page& page() override { return *m_page; }
     virtual Web::Page const& page() const override { return *m_page; }
 
+    BackingStoreManager const& backing_store_manager() const { return m_backing_store_manager; }
+
     ErrorOr<void> connect_to_webdriver(ByteString const& webdriver_ipc_path);
 
     virtual void paint_next_frame() override;
@@ -54,6 +57,7 @@ public:
     void set_preferred_motion(Web::CSS::PreferredMotion);
     void set_should_show_line_box_borders(bool b) { m_should_show_line_box_borders = b; }
     void set_has_focus(bool);
+    void set_system_visibility_state(Web::HTML::VisibilityState);
     void set_is_scripting_enabled(bool);
     void set_window_position(Web::DevicePixelPoint);
     void set_window_size(Web::DevicePixelSize);
@@ -82,6 +86,7 @@ public:
     void did_output_js_console_message(i32 message_index);
     void console_peer_did_misbehave(char const* reason);
     void did_get_js_console_messages(i32 start_index, Vector<ByteString> message_types, Vector<ByteString> messages);
+    void did_finish_js_profile(String const& label, ByteString const& profile);
 
     Vector<Web::CSS::StyleSheetIdentifier> list_style_sheets() const;
 
@@ -146,6 +151,10 @@ private:
     virtual String page_did_request_cookie(URL::URL const&, Web::Cookie::Source) override;
     virtual void page_did_set_cookie(URL::URL const&, Web::Cookie::ParsedCookie const&, Web::Cookie::Source) override;
     virtual void page_did_update_cookie(Web::Cookie::Cookie) override;
+    virtual OrderedHashMap<String, String> page_did_request_local_storage_items(String const& origin) override;
+    virtual void page_did_set_local_storage_item(String const& origin, String const& key, String const& value) override;
+    virtual void page_did_remove_local_storage_item(String const& origin, String const& key) override;
+    virtual void page_did_clear_local_storage(String const& origin) override;
     virtual void page_did_update_resource_count(i32) override;
     virtual NewWebViewResult page_did_request_new_web_view(Web::HTML::ActivateTab, Web::HTML::WebViewHints, Web::HTML::TokenizedFeature::NoOpener) override;
     virtual void page_did_request_activate_tab() override;
@@ -212,6 +221,7 @@ private:
     JS::Handle<JS::GlobalObject> m_console_global_object;
 
     RefPtr<Core::Timer> m_paint_refresh_timer;
+    RefPtr<Core::Timer> m_release_backing_stores_timer;
 };
 
 }
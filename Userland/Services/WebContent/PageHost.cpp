@@ -41,6 +41,12 @@ Optional<PageClient&> PageHost::page(u64 index)
     });
 }
 
+void PageHost::for_each_page(Function<void(PageClient&)> const& callback) const
+{
+    for (auto const& it : m_pages)
+        callback(*it.value);
+}
+
 PageHost::~PageHost() = default;
 
 }
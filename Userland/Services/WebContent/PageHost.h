@@ -28,6 +28,8 @@ public:
     PageClient& create_page();
     void remove_page(Badge<PageClient>, u64 index);
 
+    void for_each_page(Function<void(PageClient&)> const&) const;
+
     ConnectionFromClient& client() const { return m_client; }
 
 private:
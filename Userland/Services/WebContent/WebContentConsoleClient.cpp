@@ -8,6 +8,7 @@
  */
 
 #include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <AK/TemporaryChange.h>
 #include <LibJS/MarkupGenerator.h>
@@ -17,6 +18,7 @@
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/VM.h>
+#include <LibJS/SamplingProfiler.h>
 #include <LibWeb/HTML/PolicyContainers.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -70,6 +72,56 @@ void WebContentConsoleClient::report_exception(JS::Error const& exception, bool
     print_html(JS::MarkupGenerator::html_from_error(exception, in_promise).release_value_but_fixme_should_propagate_errors().to_byte_string());
 }
 
+// Prints the call tree of a finished profile, and hands the whole profile to the Inspector so it can be saved.
+void WebContentConsoleClient::profile_did_finish(String const& label, JS::SamplingProfiler const& profiler)
+{
+    auto const& nodes = profiler.nodes();
+    auto total_samples = nodes.first().total_samples;
+
+    if (total_samples > 0) {
+        // Nodes with less than 1% of the samples are left out, to keep the message at a readable size.
+        auto minimum_samples = max<size_t>(total_samples / 100, 1);
+
+        auto percentage = [&](size_t samples) {
+            return static_cast<double>(samples) * 100.0 / static_cast<double>(total_samples);
+        };
+
+        StringBuilder html;
+        html.appendff("<span class='title'>Profile '{}'</span><br>", escape_html_entities(label));
+        html.append("<span class='trace'>"sv);
+
+        auto append_node = [&](auto& self, size_t node_index) -> void {
+            auto const& node = nodes[node_index];
+            auto const& frame = profiler.frames()[node.frame_index];
+
+            html.appendff("<details><summary>{:.1}% ({:.1}% self) {}", percentage(node.total_samples), percentage(node.self_samples), escape_html_entities(frame.function_name));
+            if (!frame.url.is_empty())
+                html.appendff(" @ {}:{}:{}", escape_html_entities(frame.url), frame.line, frame.column);
+            html.append("</summary><div style='padding-left: 1em'>"sv);
+
+            auto children = node.children;
+            quick_sort(children, [&](auto a, auto b) { return nodes[a].total_samples > nodes[b].total_samples; });
+
+            for (auto child_index : children) {
+                if (nodes[child_index].total_samples >= minimum_samples)
+                    self(self, child_index);
+            }
+
+            html.append("</div></details>"sv);
+        };
+
+        for (auto child_index : nodes.first().children) {
+            if (nodes[child_index].total_samples >= minimum_samples)
+                append_node(append_node, child_index);
+        }
+
+        html.append("</span>"sv);
+        print_html(html.to_byte_string());
+    }
+
+    m_client->did_finish_js_profile(label, profiler.to_cpuprofile().serialized<StringBuilder>());
+}
+
 void WebContentConsoleClient::print_html(ByteString const& line)
 {
     m_message_log.append({ .type = ConsoleOutput::Type::HTML, .data = line });
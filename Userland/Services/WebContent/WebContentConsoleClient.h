@@ -28,6 +28,7 @@ public:
     void handle_input(ByteString const& js_source);
     void send_messages(i32 start_index);
     void report_exception(JS::Error const&, bool) override;
+    void profile_did_finish(String const& label, JS::SamplingProfiler const&) override;
 
 private:
     WebContentConsoleClient(JS::Console&, JS::Realm&, PageClient&);
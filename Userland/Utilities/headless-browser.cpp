@@ -10,9 +10,11 @@
 #include <AK/Badge.h>
 #include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
+#include <AK/JsonObject.h>
 #include <AK/LexicalPath.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
 #include <Ladybird/HelperProcess.h>
@@ -21,6 +23,7 @@
 #include <LibCore/ConfigFile.h>
 #include <LibCore/DirIterator.h>
 #include <LibCore/Directory.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/Promise.h>
@@ -598,6 +601,170 @@ static ErrorOr<int> run_tests(HeadlessWebContentView* view, StringView test_root
     return 1;
 }
 
+static Optional<AK::Duration> measure_page_load(HeadlessWebContentView& view, URL::URL const& url)
+{
+    Core::EventLoop loop;
+    bool did_timeout = false;
+
+    auto timeout_timer = Core::Timer::create_single_shot(DEFAULT_TIMEOUT_MS, [&] {
+        did_timeout = true;
+        loop.quit(0);
+    });
+
+    view.on_load_finish = [&](auto const& loaded_url) {
+        // NOTE: We don't want subframe loads to end the measurement.
+        if (url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            loop.quit(0);
+    };
+
+    auto load_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    view.load(url);
+
+    timeout_timer->start();
+    loop.exec();
+
+    view.on_load_finish = {};
+
+    if (did_timeout)
+        return {};
+    return load_timer.elapsed_time();
+}
+
+// Scrolls the page with wheel events, one at a time, and measures how long it takes from each event until the next
+// frame has been painted. The scroll direction is flipped every now and then to stay within shorter pages.
+static Vector<AK::Duration> measure_scroll_frame_times(HeadlessWebContentView& view, Gfx::IntSize window_size, size_t frame_count)
+{
+    static constexpr int scroll_step = 100;
+    static constexpr size_t frames_per_direction = 20;
+
+    // If a scroll doesn't result in a new frame, e.g. because the page can't be scrolled, we stop early.
+    static constexpr int frame_timeout_ms = 1000;
+
+    Core::EventLoop loop;
+    Vector<AK::Duration> frame_times;
+
+    auto timeout_timer = Core::Timer::create_single_shot(frame_timeout_ms, [&] {
+        loop.quit(0);
+    });
+
+    Core::ElapsedTimer frame_timer { Core::TimerType::Precise };
+    int direction = 1;
+
+    auto scroll = [&] {
+        auto viewport_size = window_size.to_type<Web::DevicePixels>();
+        Web::DevicePixelPoint center { viewport_size.width() / 2, viewport_size.height() / 2 };
+
+        view.enqueue_input_event(Web::MouseEvent {
+            .type = Web::MouseEvent::Type::MouseWheel,
+            .position = center,
+            .screen_position = center,
+            .wheel_delta_y = direction * scroll_step,
+        });
+
+        frame_timer.start();
+        timeout_timer->restart();
+    };
+
+    view.on_ready_to_paint = [&] {
+        frame_times.append(frame_timer.elapsed_time());
+
+        if (frame_times.size() == frame_count) {
+            loop.quit(0);
+            return;
+        }
+
+        if (frame_times.size() % frames_per_direction == 0)
+            direction = -direction;
+        scroll();
+    };
+
+    scroll();
+    loop.exec();
+
+    timeout_timer->stop();
+    view.on_ready_to_paint = {};
+
+    return frame_times;
+}
+
+static JsonObject summarize_benchmark_samples(Vector<AK::Duration> samples)
+{
+    JsonObject summary;
+    summary.set("count"sv, samples.size());
+
+    if (samples.is_empty())
+        return summary;
+
+    quick_sort(samples);
+
+    auto to_milliseconds = [](AK::Duration duration) {
+        return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+    };
+    auto percentile = [&](size_t percent) {
+        return to_milliseconds(samples[min(samples.size() - 1, samples.size() * percent / 100)]);
+    };
+
+    AK::Duration total;
+    for (auto sample : samples)
+        total += sample;
+
+    summary.set("min_ms"sv, to_milliseconds(samples.first()));
+    summary.set("mean_ms"sv, to_milliseconds(total) / static_cast<double>(samples.size()));
+    summary.set("p50_ms"sv, percentile(50));
+    summary.set("p90_ms"sv, percentile(90));
+    summary.set("p99_ms"sv, percentile(99));
+    summary.set("max_ms"sv, to_milliseconds(samples.last()));
+
+    return summary;
+}
+
+static ErrorOr<int> run_benchmark(HeadlessWebContentView& view, Gfx::IntSize window_size, URL::URL const& url, size_t iterations, bool cold_cache, size_t frame_count, StringView output_path)
+{
+    Vector<AK::Duration> load_times;
+    size_t timeout_count = 0;
+
+    for (size_t i = 0; i < iterations; ++i) {
+        // Start every iteration from a blank page, so that each load is a full navigation.
+        (void)measure_page_load(view, URL::URL("about:blank"sv));
+
+        if (cold_cache)
+            view.debug_request("clear-cache");
+
+        auto load_time = measure_page_load(view, url);
+
+        if (load_time.has_value()) {
+            warnln("{}/{}: Loaded in {} ms", i + 1, iterations, load_time->to_milliseconds());
+            load_times.append(*load_time);
+        } else {
+            warnln("{}/{}: Timed out", i + 1, iterations);
+            ++timeout_count;
+        }
+    }
+
+    Vector<AK::Duration> frame_times;
+    if (frame_count > 0 && !load_times.is_empty())
+        frame_times = measure_scroll_frame_times(view, window_size, frame_count);
+
+    JsonObject result;
+    result.set("url"sv, url.serialize());
+    result.set("iterations"sv, iterations);
+    result.set("cache"sv, cold_cache ? "cold"sv : "warm"sv);
+    result.set("load_timeouts"sv, timeout_count);
+    result.set("load"sv, summarize_benchmark_samples(move(load_times)));
+    result.set("scroll_frames"sv, summarize_benchmark_samples(move(frame_times)));
+
+    auto serialized = result.serialized<StringBuilder>();
+
+    if (output_path.is_empty()) {
+        outln("{}", serialized);
+    } else {
+        auto output_file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write));
+        TRY(output_file->write_until_depleted(serialized.bytes()));
+    }
+
+    return timeout_count == 0 ? 0 : 1;
+}
+
 struct Application : public WebView::Application {
     WEB_VIEW_APPLICATION(Application)
 
@@ -614,6 +781,10 @@ struct Application : public WebView::Application {
         args_parser.add_option(resources_folder, "Path of the base resources folder (defaults to /res)", "resources", 'r', "resources-root-path");
         args_parser.add_option(is_layout_test_mode, "Enable layout test mode", "layout-test-mode");
         args_parser.add_option(rebaseline, "Rebaseline any executed layout or text tests", "rebaseline");
+        args_parser.add_option(benchmark_iterations, "Load the URL [n] times and print timings as JSON", "benchmark", 0, "n");
+        args_parser.add_option(benchmark_cold_cache, "Clear the resource cache before every benchmark load", "benchmark-cold-cache");
+        args_parser.add_option(benchmark_frame_count, "Number of scroll frames to time after the benchmark loads (default: 100)", "benchmark-frames", 0, "n");
+        args_parser.add_option(benchmark_output_path, "Write benchmark results to a file instead of stdout", "benchmark-output", 0, "path");
     }
 
     virtual void create_platform_options(WebView::ChromeOptions&, WebView::WebContentOptions& web_content_options) override
@@ -637,6 +808,10 @@ struct Application : public WebView::Application {
     ByteString test_glob;
     bool test_dry_run { false };
     bool rebaseline { false };
+    size_t benchmark_iterations { 0 };
+    bool benchmark_cold_cache { false };
+    size_t benchmark_frame_count { 100 };
+    StringView benchmark_output_path;
 };
 
 Application::Application(Badge<WebView::Application>, Main::Arguments&)
@@ -677,6 +852,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         return Error::from_string_literal("Invalid URL");
     }
 
+    if (app->benchmark_iterations > 0)
+        return run_benchmark(*view, window_size, url, app->benchmark_iterations, app->benchmark_cold_cache, app->benchmark_frame_count, app->benchmark_output_path);
+
     if (app->dump_layout_tree) {
         TRY(run_dump_test(*view, url, ""sv, TestMode::Layout));
         return 0;
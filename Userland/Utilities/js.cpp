@@ -7,6 +7,7 @@
  */
 
 #include <AK/JsonValue.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
@@ -15,6 +16,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profile.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Parser.h>
@@ -78,6 +80,7 @@ static bool s_as_module = false;
 static bool s_print_last_result = false;
 static bool s_strip_ansi = false;
 static bool s_disable_source_location_hints = false;
+static bool s_dump_profile = false;
 static RefPtr<Line::Editor> s_editor;
 static String s_history_path = String {};
 static int s_repl_line_level = 0;
@@ -541,6 +544,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(s_dump_profile, "Count executed instructions, and dump them along with the hottest functions on exit", "dump-profile", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -561,6 +565,20 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     g_vm = TRY(JS::VM::create());
     g_vm->set_dynamic_imports_allowed(true);
 
+    OwnPtr<JS::Bytecode::Profile> profile;
+    if (s_dump_profile) {
+        profile = make<JS::Bytecode::Profile>();
+        g_vm->bytecode_interpreter().set_profile(profile);
+    }
+
+    // NOTE: The profile goes to stderr, so it doesn't get mixed up with the output of the script.
+    ScopeGuard dump_profile_guard = [&] {
+        if (!profile)
+            return;
+        g_vm->bytecode_interpreter().set_profile(nullptr);
+        warnln("{}", JS::Bytecode::dump_profile(g_vm->heap(), profile).serialized<StringBuilder>());
+    };
+
     if (!disable_debug_printing) {
         // NOTE: These will print out both warnings when using something like Promise.reject().catch(...) -
         // which is, as far as I can tell, correct - a promise is created, rejected without handler, and a
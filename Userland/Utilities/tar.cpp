@@ -8,6 +8,7 @@
 #include <AK/ByteString.h>
 #include <AK/HashMap.h>
 #include <AK/LexicalPath.h>
+#include <AK/Queue.h>
 #include <AK/Span.h>
 #include <AK/Vector.h>
 #include <LibArchive/TarStream.h>
@@ -20,6 +21,9 @@
 #include <LibCore/System.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibMain/Main.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -27,6 +31,117 @@
 
 constexpr size_t buffer_size = 4096;
 
+// Reads (and decompresses) the archive on a separate thread, so that decompression overlaps with extracting the
+// previously decompressed data to disk.
+class ReadAheadStream final : public Stream {
+public:
+    static constexpr size_t chunk_size = 64 * KiB;
+    static constexpr size_t max_queued_chunks = 16;
+
+    explicit ReadAheadStream(NonnullOwnPtr<Stream> source)
+        : m_source(move(source))
+    {
+        m_thread = Threading::Thread::construct([this] {
+            read_ahead();
+            return 0;
+        },
+            "tar read-ahead"sv);
+        m_thread->start();
+    }
+
+    virtual ~ReadAheadStream() override
+    {
+        {
+            Threading::MutexLocker locker { m_mutex };
+            m_stopping = true;
+            m_condition.broadcast();
+        }
+        (void)m_thread->join();
+    }
+
+    virtual ErrorOr<Bytes> read_some(Bytes bytes) override
+    {
+        Threading::MutexLocker locker { m_mutex };
+        m_condition.wait_while([&] { return m_chunks.is_empty() && !m_source_finished; });
+
+        if (m_chunks.is_empty()) {
+            if (m_source_error.has_value())
+                return m_source_error.release_value();
+            return bytes.trim(0);
+        }
+
+        auto& chunk = m_chunks.head();
+        auto copied = chunk.bytes().slice(m_offset_in_chunk).copy_trimmed_to(bytes);
+        m_offset_in_chunk += copied;
+
+        if (m_offset_in_chunk == chunk.size()) {
+            (void)m_chunks.dequeue();
+            m_offset_in_chunk = 0;
+            m_condition.broadcast();
+        }
+
+        return bytes.trim(copied);
+    }
+
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override { return Error::from_errno(EBADF); }
+
+    virtual bool is_eof() const override
+    {
+        Threading::MutexLocker locker { m_mutex };
+        m_condition.wait_while([&] { return m_chunks.is_empty() && !m_source_finished; });
+        return m_chunks.is_empty() && !m_source_error.has_value();
+    }
+
+    virtual bool is_open() const override { return true; }
+    virtual void close() override { }
+
+private:
+    void read_ahead()
+    {
+        while (true) {
+            auto chunk_or_error = ByteBuffer::create_uninitialized(chunk_size);
+            ErrorOr<Bytes> read_or_error = chunk_or_error.is_error() ? ErrorOr<Bytes> { chunk_or_error.release_error() } : m_source->read_some(chunk_or_error.value());
+
+            Threading::MutexLocker locker { m_mutex };
+
+            if (read_or_error.is_error()) {
+                m_source_error = read_or_error.release_error();
+                break;
+            }
+
+            if (!read_or_error.value().is_empty()) {
+                auto chunk = chunk_or_error.release_value();
+                chunk.resize(read_or_error.value().size());
+
+                m_condition.wait_while([&] { return m_chunks.size() >= max_queued_chunks && !m_stopping; });
+                if (m_stopping)
+                    return;
+
+                m_chunks.enqueue(move(chunk));
+                m_condition.broadcast();
+            }
+
+            if (m_stopping || m_source->is_eof())
+                break;
+        }
+
+        m_source_finished = true;
+        m_condition.broadcast();
+    }
+
+    NonnullOwnPtr<Stream> m_source;
+    RefPtr<Threading::Thread> m_thread;
+
+    mutable Threading::Mutex m_mutex;
+    mutable Threading::ConditionVariable m_condition { m_mutex };
+
+    Queue<ByteBuffer> m_chunks;
+    size_t m_offset_in_chunk { 0 };
+    Optional<Error> m_source_error;
+    bool m_source_finished { false };
+    bool m_stopping { false };
+};
+
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
     bool create = false;
@@ -86,6 +201,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         if (xz)
             input_stream = TRY(Compress::XzDecompressor::create(move(input_stream)));
 
+        if (gzip || lzma || xz)
+            input_stream = make<ReadAheadStream>(move(input_stream));
+
         auto tar_stream = TRY(Archive::TarInputStream::construct(move(input_stream)));
 
         HashMap<ByteString, ByteString> global_overrides;